@@ -1,3 +1,6 @@
+# Boot stages are timestamped with lvml.mark(); see lvml.boot_report()
+import lvml
+
 # Mount VFS filesystem
 import vfs
 from esp32 import Partition
@@ -11,32 +14,89 @@ for p in partitions:
         break
 if target_partition:
     vfs.mount(target_partition, "/")
+lvml.mark("vfs_mount")
 
-# Initialize LVML and show splash screen
-import lvml
-import png_lvml
-lvml.init()
-lvml.show_image(png_lvml.PNG_DATA)
-lvml.tick()
-
-# Connect to WiFi
-import network
 import esp32
-wifi = network.WLAN(network.STA_IF)
-wifi.active(True)
 nvs = esp32.NVS("lvml")
+
+# Boot stages overlap unless the NVS flag "boot_sequential" is set: touch
+# comes up on its own task while WiFi associates and the UI is drawn
 try:
-    buf = bytearray(256)
-    size = nvs.get_blob("wifi_ssid", buf)
-    wifi_ssid = buf[:size].decode("utf-8")
-    size = nvs.get_blob("wifi_password", buf)
-    wifi_password = buf[:size].decode("utf-8")
-    if wifi_ssid and wifi_password:
-        wifi.connect(wifi_ssid, wifi_password)
-except Exception as e:
-    print(e)
+    sequential = bool(nvs.get_i32("boot_sequential"))
+except OSError:
+    sequential = False
+
+# Waking from resume.sleep(): the screen that was up comes back from the
+# saved frame and widget snapshot, without the XML and scripts behind it
+import machine
+state = None
+if machine.reset_cause() == machine.DEEPSLEEP_RESET:
+    import resume
+    state = resume.saved_state()
+
+# Show the splash straight from flash, then initialize LVML; LVGL's first
+# frame draws the same image over it (splash_lvml.py is made from
+# images/lvml.png by scripts/make_splash.py)
+splash_shown = False
+if state is not None:
+    try:
+        lvml.splash(resume.FRAME)
+        splash_shown = True
+    except (OSError, ValueError):
+        pass
+if not splash_shown:
+    import splash_lvml
+    lvml.splash(splash_lvml.SPLASH_DATA)
+lvml.init(async_touch=not sequential)
+lvml.mark("lvml_init")
+
+# MicroPython owns the WiFi driver; once it is active, lvml.wifi() hands the
+# station to the network task, which associates, reconnects and tracks the
+# state in the background while boot goes on
+import network
+wifi = network.WLAN(network.STA_IF)
+
+def start_wifi():
+    wifi.active(True)
+    try:
+        buf = bytearray(256)
+        size = nvs.get_blob("wifi_ssid", buf)
+        wifi_ssid = buf[:size].decode("utf-8")
+        size = nvs.get_blob("wifi_password", buf)
+        wifi_password = buf[:size].decode("utf-8")
+        if wifi_ssid and wifi_password:
+            lvml.wifi(wifi_ssid, wifi_password)
+            lvml.mark("wifi_connect")
+            return True
+    except Exception as e:
+        print(e)
     print("No WiFi settings found")
-    
+    return False
+
+if not sequential:
+    wifi_configured = start_wifi()
+
+resumed = False
+if state is not None:
+    try:
+        lvml.restore_state(state)
+        resumed = True
+    except (ValueError, MemoryError) as e:
+        print("Cold boot, saved UI not restored:", e)
+    state = None
+if resumed:
+    lvml.tick()
+    lvml.mark("ui_restored")
+else:
+    import png_lvml
+    lvml.show_image(png_lvml.PNG_DATA)
+    lvml.tick()
+    lvml.mark("lvgl_splash")
+
+if sequential:
+    wifi_configured = start_wifi()
+
+if not wifi_configured and not resumed:
     # Load WiFi settings UI
     try:
         with open("/web/wifi_settings.xml", "r") as f:
@@ -46,3 +106,24 @@ except Exception as e:
         print("WiFi settings UI loaded")
     except Exception as ui_error:
         print("Failed to load WiFi settings UI:", ui_error)
+
+# Boot is done once touch works
+try:
+    lvml.wait_ready("touch")
+except OSError:
+    print("Touch initialization failed")
+lvml.mark("boot_done")
+
+# With the NVS flag "boot_profile" set, keep this boot's timeline, one blob
+# per firmware version ("stage time_us" per line) to compare versions;
+# sequential boots are kept apart under a trailing "s", wakes that restored
+# the saved UI under a trailing "r"
+try:
+    if nvs.get_i32("boot_profile"):
+        report = lvml.boot_report()
+        lines = ["%s %d" % (name, time_us) for name, time_us, _ in report["stages"]]
+        key = "boot_" + lvml.get_version().replace(".", "") + ("s" if sequential else "") + ("r" if resumed else "")
+        nvs.set_blob(key, "\n".join(lines))
+        nvs.commit()
+except OSError:
+    pass  # Profiling not enabled
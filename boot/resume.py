@@ -0,0 +1,62 @@
+# resume.py - Deep sleep that wakes up to the same screen
+#
+# sleep() saves what is on the display as a splash and the widget tree as a
+# snapshot, then enters deep sleep. On wake _boot.py shows the saved frame
+# before LVGL starts and recreates the widgets from the snapshot instead of
+# loading XML and running scripts. The snapshot goes to RTC memory when it
+# fits (it survives deep sleep, not power loss), otherwise to flash.
+#   import resume
+#   resume.sleep(60000)          # wake after a minute (0: only by a wake source)
+
+import machine
+import os
+import lvml
+
+DIR = "/resume"
+FRAME = DIR + "/frame.lvsp"
+STATE = DIR + "/ui.lvss"
+RTC_MAX = 2048                   # MicroPython's RTC user memory on the ESP32
+
+
+def sleep(ms=0):
+    try:
+        os.mkdir(DIR)
+    except OSError:
+        pass
+    with open(FRAME, "wb") as f:
+        lvml.screenshot(f, fmt="splash")
+    state = lvml.snapshot_state()
+    rtc = machine.RTC()
+    if len(state) <= RTC_MAX:
+        rtc.memory(state)
+        try:
+            os.remove(STATE)
+        except OSError:
+            pass
+    else:
+        rtc.memory(b"")
+        with open(STATE, "wb") as f:
+            f.write(state)
+    machine.deepsleep(ms)
+
+
+def saved_state():
+    # Snapshot saved by sleep(), or None
+    state = machine.RTC().memory()
+    if state:
+        return state
+    try:
+        with open(STATE, "rb") as f:
+            return f.read()
+    except OSError:
+        return None
+
+
+def forget():
+    # Make the next wake a cold boot
+    machine.RTC().memory(b"")
+    for path in (FRAME, STATE):
+        try:
+            os.remove(path)
+        except OSError:
+            pass
@@ -0,0 +1,7 @@
+# splash_lvml.py - lvml.png as an LVML splash, for lvml.splash()
+# Auto-generated by scripts/make_splash.py
+
+WIDTH = 320
+HEIGHT = 240
+
+SPLASH_DATA = b'LVSP\x01\x01@\x01\xf0\x00\x00\x00\x0b\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xde\x82\xff\xff\x04\xff\xdf\xff\xde\xff\xff\xff\xdf\xff\xff\x90\xff\xde\x03\xff\xdf\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x08\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\x89\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xff\x83\xff\xde\x02\xff\xff\xff\xde\xff\xff\x82\xff\xde\x06\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xff\x8d\xff\xde\x00\xff\xdf\x85\xff\xde\n\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\x82\xff\xdf\x04\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\x82\xff\xff\x02\xff\xde\xff\xff\xff\xff\x82\xff\xde\x82\xff\xff\t\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xdf\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xfe\x86\xff\xff\x82\xff\xde\x01\xff\xff\xff\xfe\x84\xff\xff\n\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\x83\xff\xff\x10\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x82\xff\xff\x02\xff\xfe\xff\xde\xff\xde\x82\xff\xff\x0e\xff\xde\xff\xfe\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\xff\xdf\x84\xff\xde\x01\xff\xdf\xff\xde\x82\xff\xdf\x0c\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\x82\xff\xde\x04\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\x82\xff\xdf\x05\xff\xde\xff\xde\xff\xdf\xff\xfe\xff\xde\xff\xdf\x83\xff\xff\x84\xff\xde\x01\xff\xdf\xff\xde\x83\xff\xff\x0e\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x06\xff\xff\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xff\xff\xff\x8a\xff\xde\x0b\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xdf\x89\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x9a\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x88\xff\xde\x01\xff\xff\xff\xdf\x88\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xff\x84\xff\xde\x01\xff\xdf\xff\xff\x82\xff\xde\x01\xff\xff\xff\xfe\x82\xff\xff\x00\xff\xdf\x82\xff\xde\t\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\x84\xff\xff\x02\xff\xde\xff\xdf\xff\xff\x82\xff\xfe\t\xff\xff\xff\xff\xff\xfe\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\x82\xff\xff\x82\xff\xdf\x05\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\x82\xff\xde\x0b\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xff\x83\xff\xde\x02\xff\xfe\xff\xde\xff\xde\x83\xff\xff\x08\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\x86\xff\xff\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x82\xff\xde\x08\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\x83\xff\xff\x01\xff\xde\xff\xff\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x10\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\x83\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x83\xff\xde\x0f\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xff\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xde\x84\xff\xdf\x89\xff\xde\x03\xff\xdf\xff\xde\xff\xff\xff\xff\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x83\xff\xde\x06\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xff\x87\xff\xde\x03\xff\xff\xff\xdf\xff\xff\xff\xdf\x84\xff\xde\x01\xff\xff\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x10\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xfe\xff\xde\xff\xdf\xff\xff\xff\xff\xff\xfe\x83\xff\xde\x82\xff\xff\x03\xff\xdf\xff\xde\xff\xdf\xff\xff\x83\xff\xde\x03\xff\xff\xff\xff\xff\xdf\xff\xff\x82\xff\xde\x82\xff\xdf\x1d\xff\xde\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\x83\xff\xff\x05\xff\xfe\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xde\x82\xff\xff\x02\xff\xde\xff\xff\xff\xfe\x83\xff\xff\x0f\xff\xfe\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xdf\xff\xfe\xff\xff\xff\xff\x82\xff\xde\x08\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\x85\xff\xff\x86\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xff\x07\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\x86\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x88\xff\xde\x02\xff\xdf\xff\xff\xff\xde\x82\xff\xdf\x05\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x0f\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x84\xff\xde\x0c\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xdf\x87\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x86\xff\xde\x06\xff\xff\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xde\x82\xff\xdf\x02\xff\xde\xff\xde\xff\xdf\x8c\xff\xde\x04\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\x82\xff\xdf\x87\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xff\x85\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x05\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x05\xff\xff\xff\xde\xff\xdf\xff\xdf\xff\xff\xff\xff\x82\xff\xde\x06\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\x85\xff\xde\x0e\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\x83\xff\xff\x04\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\x82\xff\xff\x82\xff\xde\x04\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xde\x83\xff\xff\x04\xff\xde\xff\xde\xff\xff\xff\xff\xff\xfe\x83\xff\xde\t\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\x82\xff\xdf\x02\xff\xfe\xff\xde\xff\xde\x82\xff\xff\x00\xff\xdf\x82\xff\xde\x02\xff\xfe\xff\xff\xff\xde\x82\xff\xdf\x05\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xdf\x83\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x06\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xde\x83\xff\xff\x82\xff\xdf\x83\xff\xde\x06\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\x83\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xfe\x9a\xff\xde\x00\xff\xdf\x84\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x84\xff\xde\x00\xff\xdf\x8b\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xdf\x9e\xff\xde\x00\xff\xff\x85\xff\xde\x06\xff\xdf\xff\xde\xff\xfe\xff\xdf\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xdf\x86\xff\xde\x08\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xff\x88\xff\xde\x04\xff\xff\xff\xde\xff\xff\xff\xff\xff\xdf\x82\xff\xff\r\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xfe\x83\xff\xff\x07\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xfe\x83\xff\xff\x08\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\x82\xff\xff\x06\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xde\x82\xff\xff\x08\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xff\x84\xff\xde\x00\xff\xdf\x82\xff\xff\x00\xff\xdf\x82\xff\xde\x0f\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xfe\xff\xff\x83\xff\xde\x0f\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xff\x86\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xff\x84\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x02\xff\xdf\xff\xff\xff\xdf\x83\xff\xde\x05\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xdf\x87\xff\xde\x00\xff\xff\x8a\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xff\x8a\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x85\xff\xde\x01\xff\xff\xff\xdf\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xff\x83\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xff\x82\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x00\xff\xdf\x83\xff\xde\t\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xde\x82\xff\xff\x02\xff\xde\xff\xff\xff\xde\x87\xff\xff\x0f\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x83\xff\xfe\x11\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xff\xff\xff\x83\xff\xde\x08\xff\xfe\xff\xfe\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xff\xff\xff\xff\xde\x83\xff\xff\x82\xff\xde\x04\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xdf\x82\xff\xde\x0b\xff\xdf\xff\xdf\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\x82\xff\xdf\x84\xff\xde\x02\xff\xdf\xff\xdf\xff\xde\x83\xff\xdf\x85\xff\xde\x00\xff\xdf\x8a\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xff\x04\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\x84\xff\xde\x01\xff\xff\xff\xff\x82\xff\xde\x01\xff\xff\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x86\xff\xde\t\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xdf\xff\xfe\x87\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x94\xff\xde\n\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\x88\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x89\xff\xde\x00\xff\xff\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x05\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xff\xff\xde\xff\xff\xff\xdf\x88\xff\xde\t\xff\xdf\xff\xff\xff\xde\xff\xfe\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xde\x84\xff\xff\x12\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xde\x82\xff\xff\x07\xff\xdf\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\x82\xff\xff\x03\xff\xfe\xff\xdf\xff\xff\xff\xdf\x89\xff\xde\x07\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xde\x83\xff\xff\x07\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xff\x85\xff\xde\x05\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\x82\xff\xff\x8a\xff\xde\x04\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xdf\x84\xff\xde\n\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xff\x86\xff\xde\t\xff\xff\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xdf\x97\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x89\xff\xde\x04\xff\xdf\xff\xde\xff\xff\xff\xdf\xff\xdf\x82\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\x85\xff\xde\x01\xff\xff\xff\xff\x85\xff\xde\x06\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xdf\xff\xdf\x86\xff\xde\n\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x03\xff\xff\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x82\xff\xde\x07\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xff\x85\xff\xde\x02\xff\xff\xff\xdf\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xff\x88\xff\xde\x04\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\x82\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xff\x03\xff\xfe\xff\xff\xff\xdf\xff\xff\x84\xff\xde\x01\xff\xfe\xff\xde\x82\xff\xff\x04\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\x82\xff\xff\t\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xfe\x87\xff\xff\x08\xff\xfe\xff\xfe\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xff\x83\xff\xde\x05\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\x83\xff\xff\x02\xff\xdf\xff\xde\xff\xde\x82\xff\xff\x82\xff\xdf\x04\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x84\xff\xde\x07\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x0b\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xde\x05\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\x84\xff\xde\x00\xff\xff\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x00\xff\xff\x83\xff\xde\x01\xff\xdf\xff\xdf\x8c\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8a\xff\xde\x01\xff\xff\xff\xff\x89\xff\xde\x00\xff\xdf\x8d\xff\xde\x04\xff\xdf\xff\xfe\xff\xff\xff\xde\xff\xdf\x8b\xff\xde\x08\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xdf\x83\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x84\xff\xde\x05\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xff\xfe\x82\xff\xde\x1f\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xdf\xff\xff\xff\xfe\xff\xde\x83\xff\xff\x01\xff\xde\xff\xde\x84\xff\xfe\x02\xff\xff\xff\xde\xff\xfe\x84\xff\xff\x05\xff\xde\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\x82\xff\xde\x82\xff\xff\x01\xff\xde\xff\xfe\x88\xff\xde\x10\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\x89\xff\xde\x82\xff\xff\x05\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\x83\xff\xde\x08\xff\xdf\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x84\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x83\xff\xde\x02\xff\xdf\xff\xff\xff\xff\x85\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x86\xff\xde\x03\xff\xdf\xff\xff\xff\xdf\xff\xff\x84\xff\xde\x0c\xff\xdf\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x01\xff\xff\xff\xff\x88\xff\xde\x04\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xff\x87\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x84\xff\xde\x0f\xff\xdf\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xff\x82\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xfe\x86\xff\xde\x01\xff\xdf\xff\xff\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x84\xff\xde\x05\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\x82\xff\xde\x03\xff\xfe\xff\xde\xff\xde\xff\xff\x83\xff\xde\x00\xff\xff\x83\xff\xde!\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xdf\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xfe\x83\xff\xff\x08\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xfe\x83\xff\xff\x82\xff\xde\x05\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\xff\xfe\x82\xff\xff\x82\xff\xde\r\xff\xdf\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\x82\xff\xff\x06\xff\xdf\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\x84\xff\xde\x00\xff\xfe\x8a\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x82\xff\xff\x01\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xde\xff\xff\x85\xff\xde\x04\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xff\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x8b\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x9e\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x87\xff\xde\x04\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x8f\xff\xde\x02\xff\xff\xff\xff\xff\xfe\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x05\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xbd\xfeV\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x02\xff\xff\xff\xff\xff\xfe\x88\xff\xde\x06\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xff\xff\x18\x83\xff\xde\x00\xff\xff\x86\xff\xde\x06\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xff\xffY\x82\xff\xff\x00\xff\xde\x82\xff\xff\x01\xff\xfe\xff\xff\x82\xff\xfe\x02\xff\xff\xff\xff\xff\xfe\x82\xff\xff\x83\xff\xfe\x00\xff\xde\x83\xff\xff\x12\xff\xdd\xff\x9b\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xff\xfe\x82\xff\xff\x02\xff\xde\xff\xde\xff\xff\x83\xff\xde\x82\xff\xff\x00\xff\xfe\x82\xff\xde\n\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\x84\xff\xde\x01\xff\xdf\xff\xfe\x83\xff\xde\x05\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xff\x88\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x85\xff\xde\x00\xff\xfe\x86\xff\xde\n\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xfe\xff\xdf\xff\xfe\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xff\x83\xff\xde\x05\xff\xdf\xff\xff\xff\xde\xff\xfe\xff\xff\xff\xff\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x05\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x01\xff\xff\xff\xfe\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x12\xff\xdf\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xdf\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8b\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\t\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xf6v\x85\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xffZ\x82\xff\xde\x0b\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xff\x82\xff\xde\x0f\xffz\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xde\x83\xff\xfe\x82\xff\xff\x00\xff\xde\x84\xff\xfe\x07\xff\xdd\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xfe\x85\xff\xff\x0e\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xfe\x83\xff\xde\r\xff\xdf\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\x83\xff\xff\x03\xff\xfe\xff\xff\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xdf\x82\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x88\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x83\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xff\x03\xff\xde\xff\xde\xff\xdf\xff\xff\x85\xff\xde\x07\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xfe\xff\xdf\x83\xff\xde\x00\xff\xff\x84\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\x82\xff\xff\x02\xff\xde\xff\xff\xff\xff\x83\xff\xde\x07\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\x85\xff\xde\x03\xff\xdf\xff\xff\xff\xde\xff\xff\x89\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\x88\xff\xde\x05\xff\xdf\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xfe\xff\xff\x82\xff\xde\x82\xff\xfe\x82\xff\xde\r\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xffY\xff\xde\x85\xff\xfe\x89\xff\xff\x0e\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xde\x82\xff\xff\x00\xff\xde\x82\xff\xff\t\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xff\x83\xff\xde\x00\xff\xff\x82\xff\xde\x05\xff\xff\xff\xdf\xff\xde\xff\xfe\xff\xff\xff\xdf\x8a\xff\xde\x05\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x02\xff\xdf\xff\xff\xff\xff\x83\xff\xde\x00\xff\xff\x85\xff\xde\x04\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x0c\xff\xfe\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\x84\xff\xde\x82\xff\xff\x8a\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x87\xff\xde\x82\xff\xff\x8f\xff\xde\x00\xff\xff\x86\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x8a\xff\xde\x04\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xff\x83\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x82\xff\xde\x07\xff\xdf\xff\xde\xff\xbe\xff\xff\xff\xde\xff\xde\xff\xbe\xff\xbd\x82\xff\xde\x00\xff\xfe\x82\xff\xde\x12\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xbd\xff\xde\xff\x9c\xff\xbc\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xde\x87\xff\xfe\n\xff\xff\xff\xfe\xff\xde\xff\xde\xfe\xd4\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xfe\x82\xff\xff\x05\xff\xfe\xff\xdf\xff\xff\xff\xff\xff\xfe\xff\xfe\x84\xff\xff\x01\xff\xde\xff\xfe\x82\xff\xff\x03\xff\xdf\xff\xde\xff\xde\xff\xfe\x82\xff\xde\x07\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xde\x82\xff\xff\x84\xff\xde\x05\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xde\x84\xff\xff\n\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x05\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xdf\x88\xff\xde\x02\xff\xff\xff\xde\xff\xde\x84\xff\xff\x08\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\x8c\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xff\x85\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8c\xff\xde\x07\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xfe\x85\xff\xde\x02\xff\xff\xff\xde\xff\xff\x84\xff\xde\x00\xff\xff\x88\xff\xde\x05\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xff\x84\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xbe\x88\xff\xde\x01\xff\xff\xf5\xae\x84\xff\xde\x0e\xff\xbd\xff\xfe\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xde\x82\xff\xfe\x10\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xdf\xff\xde\x85\xff\xff\x0b\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xfe\x82\xff\xff\x04\xff\xfe\xff\xde\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x83\xff\xff\x01\xff\xfe\xff\xdf\x86\xff\xde\x03\xff\xff\xff\xfe\xff\xde\xff\xff\x82\xff\xde\r\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xdf\xff\xff\x89\xff\xde\x04\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xff\x95\xff\xde\x00\xff\xff\x86\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xdf\x84\xff\xde\r\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\x8a\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x91\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xff\x97\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x06\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xde\xffY\xff\xfe\x83\xff\xde\n\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xfe\xff\xff\x82\xff\xfe\x00\xff\xff\x86\xff\xfe\x00\xff\xde\x82\xff\xff\x03\xff\xde\xff\xde\xff\xfe\xff\xfe\x82\xff\xff\x07\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xfe\x82\xff\xff\x1b\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xfe\xff\xff\x84\xff\xde\x05\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xff\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xfe\xff\xde\xff\xde\xff\xfe\x83\xff\xde\x00\xff\xdf\x89\xff\xde\x04\xff\xdf\xff\xff\xff\xfe\xff\xde\xff\xfe\x86\xff\xde\x02\xff\xff\xff\xde\xff\xff\x83\xff\xde\x00\xff\xff\x85\xff\xde\x83\xff\xff\x83\xff\xde\x08\xff\xff\xff\xde\xff\xff\xff\xdf\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xde\x82\xff\xff\x01\xff\xde\xff\xdf\x84\xff\xde\x01\xff\xff\xff\xff\x82\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xfe\x8b\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x88\xff\xde\x01\xff\xff\xff\xff\x84\xff\xde\x02\xff\xff\xff\xde\xff\xff\x82\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x89\xff\xde\x00\xff\xfe\x84\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xfe\x9b\xff\xde\x00\xff\xbe\x8d\xff\xde\x00\xff\xff\x8a\xff\xde\x00\xff\xfe\x83\xff\xde\x05\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xfe\x84\xff\xde\x01\xff\xfe\xff\xfe\x83\xff\xde\x82\xff\xfe\x00\xff\xde\x83\xff\xfe\n\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xde\x82\xff\xfe\x86\xff\xff\x03\xff\xfe\xff\xfe\xff\xbd\xff\xfe\x82\xff\xff\x06\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xde\x82\xff\xfe\x05\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xff\xff\xfe\x83\xff\xff\x00\xff\xbe\x84\xff\xde\x01\xff\xff\xff\xff\x83\xff\xde\n\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xdf\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xff\xff\xfe\x86\xff\xde\x00\xff\xff\x86\xff\xde\x82\xff\xff\x01\xff\xdf\xff\xdf\x86\xff\xde\x01\xff\xfe\xff\xff\x83\xff\xde\x02\xff\xff\xff\xde\xff\xff\x84\xff\xde\x00\xff\xff\x85\xff\xde\x05\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\x84\xff\xff\x88\xff\xde\x00\xff\xff\x82\xff\xde\x02\xff\xff\xff\xde\xff\xff\x94\xff\xde\x01\xff\xdf\xff\xdf\x85\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x83\xff\xde\x07\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\x82\xff\xde\x07\xff\xdf\xff\xde\xff\xdf\xff\xde\xfd\xd2\xff;\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x83\xff\xde\x05\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xfe\x83\xff\xde\x03\xf5\x93\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x88\xff\xde\x05\xff\xdf\xff;\xff\xbe\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xbe\x83\xff\xde\x00\xff\x9c\x82\xff\xde\x00\xff\xff\x84\xff\xde\x03\xff\xfe\xff\xde\xff\xfe\xff\xde\x83\xff\xfe\x82\xff\xde\x01\xff\xfe\xff\xde\x82\xff\xff\x08\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xde\x83\xff\xfe\x0c\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xff\x83\xff\xfe\x02\xff\xff\xff\x16\xff\xdd\x82\xff\xff\x05\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xff\x84\xff\xde\x04\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\x83\xff\xde\x0c\xff\xff\xff\xde\xf7{\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xdf\x82\xff\xde\t\xff\xdf\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xfe\xff\xff\xff\xde\xff\xfe\x88\xff\xde\x04\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xdf\x83\xff\xff\x86\xff\xde\x00\xff\xff\x84\xff\xde\x07\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xdf\x89\xff\xde\x04\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\x8a\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xde\xff\xdf\xff\xdf\x8f\xff\xde\x00\xff\xdf\x86\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x87\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x8f\xff\xde\x01\xfe\x14\xf6w\x8a\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xfe\x84\xff\xde\x00\xff\xff\x83\xff\xde\x02\xff[\xff\xdf\xff\xdf\x87\xff\xde\x01\xfew\xfe\x97\x87\xff\xde\x02\xff\xdf\xff\xdf\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xbd\xf6\xd8\x82\xff\xde\x00\xff\xff\x83\xff\xde\x82\xff\xfe\x01\xff\xde\xff\xfe\x84\xff\xde\x05\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xbd\x83\xff\xfe\x07\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\x82\xff\xfe\x04\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xde\x82\xff\xff\x83\xff\xfe\x0b\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\x82\xff\xde\x00\xff\xfe\x82\xff\xde\x13\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\x83\xff\xde\x00\xff\xff\x82\xff\xde\x08\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x8b\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xff\x86\xff\xde\x03\xff\xff\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x82\xff\xff\x82\xff\xde\x00\xff\xfe\x86\xff\xde\x00\xff\xdf\x84\xff\xde\x02\xff\xff\xff\xde\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x01\xff\xdf\xff\xdf\x87\xff\xde\x08\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xdf\x8e\xff\xde\x00\xff\xff\x8b\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xdf\x84\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xff\x84\xff\xde\x06\xf4n\xfa\xe4\xf5q\xff\xdf\xff\xde\xff\xde\xff\xfe\x8c\xff\xde\x05\xff\xff\xff\xbd\xff\xdf\xff\xff\xff\xde\xff\\\x85\xff\xde\x01\xff\xfe\xff:\x82\xff\xde\x01\xff\xbe\xff\xde\x83\xff\xfe\x03\xff\xff\xff\xde\xff\xde\xff\xfe\x82\xff\xde\x12\xff\xfe\xff\xde\xf6\x10\xff\xfe\xff\xde\xff\xbc\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\x82\xff\xff\r\xff\xbc\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xfe\x82\xff\xde\x07\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\x85\xff\xfe\x02\xff\xde\xff\xff\xff\xff\x82\xff\xfe\x04\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xfe\x82\xff\xde\x84\xff\xff\x02\xff\xde\xff\xfe\xff\xff\x83\xff\xde\x03\xff\xfe\xff\xde\xff\xff\xff\xff\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x83\xff\xff\x92\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x88\xff\xde\x01\xff\xdf\xff\xdf\x8b\xff\xde\x06\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xff\x87\xff\xde\x04\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xff\x92\xff\xde\x03\xff\xdf\xff\xff\xff\xdf\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x87\xff\xde\x00\xff\xff\x82\xff\xde\n\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\x82\xff\xff\x01\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xff\x84\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x89\xff\xde\x02\xf4M\xfaB\xf2\xc4\x83\xff\xde\x00\xff\xff\x84\xff\xde\x01\xff\xdf\xff\xfe\x83\xff\xde\x01\xff|\xff\xfe\x82\xff\xde\x01\xff\xdf\xff\xbe\x85\xff\xde\x02\xff\xfe\xff9\xf4\xcb\x83\xff\xde\x00\xff\xfe\x83\xff\xde\x82\xff\xfe\x11\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xbd\xff\x9b\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xde\x82\xff\xfe\x05\xff\xde\xff\xfe\xff\xff\xff\xdd\xff\xde\xff\xde\x88\xff\xfe\x00\xff\xff\x82\xff\xfe\x05\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\x83\xff\xfe\x00\xff\xde\x85\xff\xfe\x08\xff\xff\xff\xff\xffy\xfd\xa2\xfd\xe4\xff\xde\xff\xff\xff\xff\xff\xfe\x84\xff\xde\x02\xff\xfe\xff\xde\xff\xff\x82\xff\xde\x01\xff\xff\xff\xfe\x82\xff\xde\x03\xff\xfe\xff\xde\xff\xde\xff\xff\x83\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x85\xff\xde\x04\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\x86\xff\xde\x00\xff\xff\x82\xff\xde\x03\xff\xff\xff\xde\xff\xff\xff\xff\x8e\xff\xde\x00\xff\xdf\x82\xff\xde\x06\xff\xff\xff\xdf\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xdf\x87\xff\xde\x04\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\x88\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x88\xff\xde\x01\xff\xff\xff\xdf\x84\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x02\xfe\xda\xfaC\xf2\x83\x83\xff\xde\x00\xff\xbe\x83\xff\xde\x02\xff\xff\xff\xde\xff\xbe\x84\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xfe\x83\xff\xde\x05\xff\xff\xff\xde\xffZ\xfc$\xfb\x80\xfe\xb5\x84\xff\xde\x01\xff\xfe\xff\xdd\x82\xff\xfe\x00\xff\xff\x82\xff\xfe\x00\xff\xff\x83\xff\xfe\x03\xff\xdd\xff\xfe\xff\x9c\xff\xff\x83\xff\xfe\x01\xff\xde\xff\xde\x83\xff\xfe\x02\xff\xde\xff\xfe\xff\xfe\x82\xff\xff\x02\xff\xfe\xff\xfe\xff\xff\x8c\xff\xfe\x0b\xff\xde\xff\xfe\xff\x9b\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xde\x82\xff\xfe\x04\xfe\x04\xfd\xe0\xfd\xc0\xff\xbb\xff\xff\x82\xff\xfe\x04\xff\xde\xff\xde\xf6\xf7\xff\xfe\xff\xff\x83\xff\xde\x15\xf7\x16\xffW\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xfe\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xfe\x84\xff\xde\x01\xff\xff\xff\xff\x85\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x91\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xff\x88\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x06\xff\xdf\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x0f\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xdf\xff\xff\xfd\xf4\xf2\xa4\x86\xff\xde\x08\xff\xfe\xff\xfe\xff\xde\xff\xbe\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xdf\x83\xff\xde\x11\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xff\xfd\xaf\xfc!\xfc\x00\xfb\xe2\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\x83\xff\xfe\x07\xff\xde\xf6\xb1\xff\xbc\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\x83\xff\xfe\x05\xf6/\xff\xdd\xff\xfe\xff\xff\xff\xde\xff\xfe\x83\xff\xde\x84\xff\xfe\x05\xff\xdd\xfe\xad\xfef\xffT\xff\xfe\xff\xde\x82\xff\xfe\x02\xff\xde\xff\xfe\xff\xff\x82\xff\xfe\x05\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xde\x83\xff\xfe\x1e\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xff\xffy\xff\xde\xff\x9a\xfd\xa1\xfd\xe0\xfe\x03\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xf7\x16\xffW\xff\xde\xff\xde\xff\xfe\x86\xff\xde\x05\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xff\x82\xff\xde\x05\xff\xfe\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xff\x8d\xff\xde\t\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\x83\xff\xde\x05\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xfe\x84\xff\xde\x01\xff\xdf\xff\xff\x84\xff\xde\x01\xff\xff\xff\xdf\x84\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xff\xff\xff\x86\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\x83\xff\xde\x02\xff\xff\xff\xdf\xff\xff\x82\xff\xde\x06\xff\xff\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xff\x87\xff\xde\x82\xff\xff\x05\xff\xdf\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xdf\x8b\xff\xde\x08\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xf5q\xfe\xb8\xff\xde\xff\x9d\x85\xff\xde\x00\xff\xfe\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x10\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xfdl\xfc \xfc \xfb\xc0\xfe\x12\xff\xde\xff\xde\xff\xfe\xff\xde\x83\xff\xfe\x10\xff\xdd\xfd\x02\xfe\xf3\xff\xfe\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xdd\xff\xff\xff\xfe\xff\xde\x84\xff\xfe\x00\xff\xff\x83\xff\xfe\n\xf6j\xfd\xe0\xfe \xfe#\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xff\x86\xff\xfe\x01\xff\xff\xff\xff\x85\xff\xfe\'\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xbb\xff\xdc\xff3\xfd\xe0\xf6H\xff\xbb\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xff\xff\x89\xff\xde\r\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x82\xff\xff\x01\xff\xde\xff\xdf\x89\xff\xde\x01\xff\xdf\xff\xff\x86\xff\xde\x07\xff\xdf\xff\xde\xff\xfe\xff\xdf\xff\xde\xff\xdf\xff\xfe\xff\xff\x82\xff\xde\t\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x8b\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xfe\x82\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x89\xff\xde\n\xff\xff\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xbd\xff\xbe\xff\xff\x8a\xff\xde\x00\xff\xfe\x85\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xff\x84\xff\xde\x01\xff\xbe\xf5\x92\x88\xff\xde\x01\xff\xfe\xff\xff\x85\xff\xde\x10\xff\xfe\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xdf\xff\xfe\xff\xfe\xfet\xff\xbd\xff\xff\xfe\x11\xfc\x00\xfc\x00\xfb\xe0\xf4\x05\xff\xde\x82\xff\xfe\x0e\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xffy\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\x83\xff\xfe\x00\xff\xde\x83\xff\xfe\n\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\x9b\xff\xff\xfeg\xfe \xfe@\xfee\x83\xff\xfe\x0c\xff\xde\xff\xfe\xff\xde\xff\xdd\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xff\x87\xff\xfe\x08\xff\xff\xff\xfe\xff\x11\xff\x98\xfe\xcb\xff\x11\xff\xfe\xff\xfe\xff\xde\x82\xff\xfe\x07\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\x83\xff\xde\x83\xff\xff\x00\xff\xfe\x84\xff\xde\x00\xff\xdf\x82\xff\xff\t\xf7\xde\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\x93\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x05\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x03\xff\xfe\xff\xde\xff\xff\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x8a\xff\xde\x00\xff\xdf\x8d\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x8c\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8f\xff\xde\x00\xff\xdf\x85\xff\xde\x82\xff\xdf\x84\xff\xde\x01\xff\xbd\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x83\xff\xde\x07\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x86\xff\xde\x0e\xf6\xf9\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xfe\x8b\xff\xde\x0b\xff\xfe\xff\xfe\xff\xdd\xfc\x02\xfb\xe0\xfb\xc0\xfdm\xff\xde\xff\xde\xff\xbd\xff\xbd\xff\xfe\x82\xff\xde\x05\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xfe\xfe\xd5\x82\xff\xde\x03\xff\xfe\xff\xff\xff\xfe\xff\xde\x82\xff\xfe\x07\xff\xde\xff\xde\xff\x15\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\x82\xff\xfe\r\xff3\xfe`\xfe@\xfe\xf0\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xde\xffz\xff\x9a\xff\xdd\xff\xde\x83\xff\xff\x83\xff\xfe\x03\xff\xde\xf6.\xff\xff\xff\xff\x82\xff\xfe\x04\xff\xff\xff\xfe\xff\xbb\xff4\xfe&\x84\xff\xfe\x01\xff\xff\xff\xfe\x82\xff\xde\x00\xff\xfe\x85\xff\xde\x06\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xff\x84\xff\xde\x06\xff\xdf\xff\xff\xe7\xbe&8~\xda\xff\xde\xff\xff\x86\xff\xde\x06\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xff\x83\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x9b\xff\xde\x01\xff\xff\xff\xdf\x87\xff\xde\x04\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xff\x9e\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x86\xff\xde\x06\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xdf\xff\xde\x82\xff\xdf\x82\xff\xde\x05\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\x90\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x05\xff\xdf\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\x85\xff\xde\x04\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xbe\x86\xff\xde\x00\xff}\x89\xff\xde\x1b\xff\xff\xff\xfe\xff\xde\xff\xdf\xff\x9c\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xfe\xfe\xf7\xfc\x82\xfc\x00\xfe2\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xfe\x82\xff\xde\x83\xff\xfe\x05\xff\x17\xff\xbd\xff{\xff\xfe\xff\xfe\xff\xde\x84\xff\xfe\x04\xff\xdd\xff\xbc\xf5\xe9\xff\xde\xff\xde\x82\xff\xfe\x0b\xff\xde\xff\xde\xff\xfe\xffx\xfe\x01\xfee\xff\xdd\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xff\x82\xff\xfe\x0c\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xde\xff7\xff\xff\x83\xff\xfe\x0e\xff\xde\xff\xde\xff\xdc\xfe&\xffx\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\x82\xff\xde\x02\xff\xfe\xff\xde\xff\xfe\x82\xff\xde\x00\xff\xff\x84\xff\xde\x08\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xdev\x9a\r\xf769\x82\xff\xde\x0b\xff\xdf\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xff\xdf\x9d\xd7}\xff\xde\xff\xde\xff\xff\x82\xff\xde\x01\xff\xfe\xff\xff\x82\xff\xde\x00\xff\xff\x85\xff\xde\x0b\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xfe\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xff\x88\xff\xde\x05\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x05\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x8b\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x8a\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8d\xff\xde\t\xff\xdf\xff\xde\xff\xfe\xff\xdf\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xf6\xda\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x01\xff\xdf\xff\xff\x82\xff\xde\x01\xff\xfe\xff\xff\x82\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xbd\x88\xff\xde\x01\xff\x9d\xff\x9d\x86\xff\xde\x01\xff\xff\xff\xff\x82\xff\xde\x04\xff[\xfc\x03\xf5\x0b\xff\xff\xff\xde\x83\xff\xff\x0b\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xfe\xf5\xfc\xe3\xf5\x8c\xff\xdf\xff\xde\x82\xff\xfe\x0c\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xdd\xff\xbc\xff\xfe\xff\xbd\xff\x9c\xff\xfe\xff\xff\x84\xff\xfe\x02\xff\xdd\xff\xbc\xff\xff\x82\xff\xde\x83\xff\xfe\n\xff\xde\xff\xff\xffv\xfe\x00\xffv\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xde\x85\xff\xfe\x04\xff\xbc\xff\xbc\xff\xfe\xff\xde\xff\xff\x82\xff\xfe\x00\xff\xde\x82\xff\xfe\x0f\xff\xdd\xff\xbd\xff\xde\xff\xde\xfe\'\xff\x10\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xff\x82\xff\xde\x04\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\x82\xff\xde\x07\xff\xfe\xff\xde\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xff\xff\xff\x82\xff\xde\x04\xb7\x1bNy\xcf}\xff\xdf\xff\xfe\x84\xff\xde\x04\xff\xff\xff\xfe\xff\xdf\xff\xdf\xff\xfe\x87\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xff\x82\xff\xde\n\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xfe\x87\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xff\x84\xff\xde\x02\xff\xff\xff\xde\xff\xff\x8f\xff\xde\x00\xff\xff\x8d\xff\xde\x04\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\x89\xff\xde\x00\xff\xdf\x9c\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\x02\xff\xdf\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x84\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x00\xfe\xb7\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xfe\x82\xff\xde\x06\xff{\xfc$\xfc\x05\xff\xff\xff\xde\xff\xde\xff\xfe\x82\xff\xde\x03\xff\xfe\xff\xde\xff\xfe\xff\xde\x82\xff\xfe\x03\xfe\x92\xfd\'\xff\xde\xff\xde\x82\xff\xfe\x84\xff\xde\x02\xff\xfe\xff6\xfe\x8d\x84\xff\xfe\x01\xffW\xff\x9a\x85\xff\xfe\x00\xff\xde\x87\xff\xfe\x01\xff\xdd\xff3\x82\xff\xfe\x01\xff\xde\xff\xde\x84\xff\xfe\x02\xff\xff\xff\xff\xff\xfe\x83\xff\xde\x02\xff\xfe\xff\xfe\xff\xde\x84\xff\xfe\x05\xff\xdd\xff\xfe\xff\xfe\xffx\xfd\xa2\xff\xde\x82\xff\xfe\x03\xff\xff\xff\xfe\xff\xde\xff\xde\x84\xff\xfe\x04\xff\xbb\xff\xbb\xff\xff\xff\xde\xff\xff\x82\xff\xde\x07\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\x82\xff\xff\x02\xff\xde\xff\xfe\xff\xfe\x82\xff\xde\x02\xff\xfe\xff\xde\xff\xff\x82\xff\xde\x00\xff\xfe\x94\xff\xde\x01\xff\xdf\xff\xff\x84\xff\xde\x82\xff\xdf\x01\xff\xde\xff\xdf\x8d\xff\xde\x03\xff\xdf\xff\xdf\xff\xff\xff\xdf\x84\xff\xde\x02\xff\xdf\xff\xde\xff\xfe\x8e\xff\xde\x00\xff\xdf\x93\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x91\xff\xde\x06\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x05\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xff\xff\x88\xff\xde\x02\xff\xfe\xff\xfe\xff}\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xbe\x83\xff\xde\x05\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xf5\xb2\x86\xff\xde\n\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff{\xfe\x95\xff\xfe\xff\xde\xff\xfe\x82\xff\xde\x0f\xff\xdf\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xfe\xff\xfe\xfe\xf5\xfc\x83\xff\x9c\xff\xdd\xff\xfe\xff\xfe\xff\xde\xff\xde\x83\xff\xfe\x0c\xff\xde\xfe\xd3\xf5\xc5\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xdd\xfe\xd3\xff\xde\xff\xfe\xff\xde\x85\xff\xfe\x10\xff\xde\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xba\xff4\xff\xde\xff\xfe\xff\xde\xff\xdd\xff\xdd\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xff\x82\xff\xfe\x00\xff\xde\x82\xff\xfe\r\xff\xde\xff\x16\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\xfeH\xffT\x82\xff\xfe\x0b\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xff\xf6\xd0\xf6\xb2\x84\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xfe\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xfe\x82\xff\xde\x02\xff\xff\xff\xff\xff\xfe\x88\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x83\xff\xde\x07\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xdf\x82\xff\xff\x02\xff\xde\xff\xff\xff\xff\x86\xff\xde\x04\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\x85\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x90\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x03\xff\xff\xff\xfe\xff\xde\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xff\x85\xff\xde\x01\xff\xff\xff\xdf\x88\xff\xde\x07\xff\xdf\xff\xde\xff\xff\xff\xbd\xff\xfe\xff\xde\xff\xff\xff\xff\x88\xff\xde\x00\xff\xff\x83\xff\xde\x02\xf5\x92\xfe5\xff\xbd\x86\xff\xde\x0b\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xff\x82\xff\xde\x82\xff\xfe\t\xff\xff\xff\xfe\xff\xbd\xfc\x81\xff7\xff\xbd\xff\xde\xff\xde\xff\xfe\xff\xde\x83\xff\xfe\r\xff\xbd\xff\xbc\xff7\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xdd\xff\xdd\xff\xfe\xff\xdd\xff\x14\xff\xdd\x83\xff\xfe\n\xff\xdd\xff\xfe\xff\xfe\xff\xdd\xff\xbb\xfe\xcc\xfe\x88\xffv\xff\xdd\xff\xde\xff\xde\x82\xff\xfe\x00\xff\xff\x83\xff\xfe\x01\xffz\xff\xdd\x88\xff\xfe\x0e\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xfe\xff\xdd\xfe\xf0\xfe\xac\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xff\xfe\x85\xff\xff\x01\xff\xfe\xff\xde\x83\xff\xff\x84\xff\xde\x06\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\x83\xff\xde\x00\xff\xff\x85\xff\xde\x04\xff\xdf\xe7\x9d\xf7\xbe\xff\xfe\xff\xdf\x82\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xdf\x83\xff\xde\x00\xff\xdf\x85\xff\xde\t\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xfe\x84\xff\xde\x01\xff\xff\xff\xdf\x83\xff\xde\x00\xff\xdf\x87\xff\xde\x82\xff\xff\x07\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x06\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\x89\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x04\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xff\x82\xff\xde\x00\xff\xdf\x94\xff\xde\x06\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xde\xff\xde\x83\xff\xff\x0b\xff\xde\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xdf\xff\xde\xff\xbd\xff\xde\xff\xff\xff\xff\x84\xff\xde\x06\xf51\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\x85\xff\xde\x0b\xff\xff\xff\xde\xff\x9d\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xff\xff\xbd\xff\xfe\x84\xff\xde\x0e\xfdi\xffY\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xdd\xffz\xff\xde\xff\xde\x82\xff\xfe\x16\xfej\xfd\xe2\xfe\xf1\xfe\x8d\xfe\xef\xfd\xc1\xfd\xe5\xff\xde\xff\xde\xff\xfe\xff\x13\xfeG\xfd\xe3\xfe\x8a\xfd\xe1\xfe\x00\xfe \xfe@\xfe\x86\xfe\xa9\xffS\xff\xde\xff\xde\x83\xff\xfe\x00\xff\xde\x83\xff\xfe\x00\xff\xff\x83\xff\xfe\x01\xff\xdd\xff\xde\x83\xff\xfe\x07\xff\xde\xff\xfe\xfe\x8a\xfe\x01\xfd\xe0\xff\x12\xff\xfe\xff\xde\x83\xff\xfe\x00\xff\xff\x82\xff\xfe\x82\xff\xff\x00\xff\xfe\x82\xff\xff\x82\xff\xde\x07\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xf7{\x82\xff\xde\x02\xef\x9d\xff\xde\xff\xfe\x83\xff\xde\x02\xff\xff\xff\xde\xff\xde\x82\xff\xff\x02\xff\xdf\xff\xdf\xff\xff\x83\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x84\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x08\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xdf\xff\xff\xff\xff\x8b\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x82\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xff\x84\xff\xde\x05\xff\xff\xff\xdf\xff\xfe\xff\xde\xff\xde\xff\xff\x83\xff\xde\x05\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x03\xff\xdf\xff\xde\xff\xdf\xff\xff\x84\xff\xde\x00\xff\xdf\x87\xff\xde\x0f\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xff\x87\xff\xde\x08\xff\xff\xfe6\xff\x9d\xff\xde\xff\xde\xfd0\xfe\x15\xff\x9d\xff\xbe\x86\xff\xde\x06\xff|\xff\xbd\xff\xbd\xff\xde\xf6\x97\xff\xde\xff\xde\x82\xff\xfe\x83\xff\xde%\xff\xff\xff\xff\xff\xfe\xff{\xff\xde\xfe\xf6\xfe\xb2\xff\xfe\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xdc\xfd\x80\xfd\xe0\xfe\x8b\xfe$\xfd\xe0\xfd\xc0\xfd\xa0\xfej\xff4\xff\xdd\xfe\x8b\xfe\x00\xfe \xfe@\xfe`\x84\xfe@\x03\xfef\xff\x9b\xff\xde\xff\xdd\x87\xff\xfe\x03\xff\xff\xff\xfe\xff\xde\xff\xde\x82\xff\xff\x0e\xff\xfe\xff\xdd\xff\xdd\xfe\xce\xfd\xc1\xfe#\xfe\x00\xfe \xfd\xe0\xfe\x88\xff\xbd\xff\xfe\xff\xfe\xff\xde\xff\xff\x83\xff\xfe\n\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xbd\xff\xbd\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\x82\xff\xff\x82\xff\xde\x0c\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xfe\x85\xff\xde\x10\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\x89\xff\xde\x08\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xfe\xff\xde\xff\xff\x84\xff\xde\x01\xff\xff\xff\xff\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x89\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x04\xff\xff\xff\xdf\xff\xde\xff\xff\xff\xdf\x85\xff\xde\x00\xff\xdf\x89\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xff\xff\xdf\xff\xde\xff\xff\x89\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xdf\x85\xff\xde\x00\xff\xdf\x84\xff\xde\x0f\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xff\x85\xff\xde\x05\xf4\xce\xfc\xee\xff\x1a\xff\xbe\xff\xde\xff\xbd\x84\xff\xde\x0b\xff\xbe\xff\xbd\xff\xde\xff\xde\xff\x9d\xff\x9d\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\x86\xff\xde\x02\xff7\xfc\xe3\xff\x17\x84\xff\xfe\x82\xff\xde\x11\xff\x9b\xff\xdd\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xbc\xfeC\xfe"\xfe#\xfe\x03\xfd\xe0\xfe\x00\xfd\xc0\xfd\xc0\xfe\xcd\xfe\x89\xfd\xe0\x82\xfe@\t\xfe`\xfe`\xfe@\xfe \xfe@\xfe@\xfee\xff\xde\xff\xde\xff\xdd\x84\xff\xfe\r\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xbc\xff\x9a\xff\xfe\xff\xff\xff\xff\xffV\xfe%\xfd\xe1\xfd\xc1\xfd\xc0\x83\xfe\x00\x05\xfd\xe0\xf5\xe2\xff\xbd\xff\xde\xff\xde\xff\xfe\x86\xff\xff\x13\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xff\xff\xfe\xff\xdf\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xde\xf7{\xd6\xb3\xef{\xff\xfe\x82\xff\xde\x06\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x03\xff\xff\xff\xfe\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x83\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\x00\xff\xff\x82\xff\xde\x07\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\t\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\x84\xff\xde\x00\xff\xdf\x82\xff\xde\x06\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xfe\x8b\xff\xde\x04\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xfe\xff\xff\x83\xff\xde\x05\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xdf\x82\xff\xde\x83\xff\xdf\x82\xff\xde\x00\xff\xff\x86\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\x86\xff\xde\x03\xff\xff\xff\xde\xff\xff\xff\xdf\x83\xff\xde\x83\xff\xff\x83\xff\xde\x16\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xfe\xff\xde\xff\xde\xff\xbd\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\\\xfd\x0f\xfb\xea\xfe\xd9\xfe5\xff:\xff\xde\xff\xde\xff\xff\x85\xff\xde\x00\xff|\x82\xff\xde\x05\xff\xfe\xff\xde\xff\x9c\xff\xde\xff\xfe\xff\xfe\x83\xff\xde\x06\xff\xfe\xffz\xfc\xc2\xfdH\xff\xde\xff\xde\xff\xfe\x82\xff\xde\t\xff\xfe\xff\xbb\xfd\x83\xffy\xff\xfe\xff\xff\xff\xfe\xff\xdd\xfe\xf1\xfd\xc0\x84\xfd\xe0\x08\xfe\x00\xfe \xfd\xc0\xfd\xe0\xfe\x00\xfe@\xfe@\xfe`\xfe@\x84\xfe \x03\xfe\xee\xff\xde\xff\xbc\xff\xbc\x82\xff\xfe\x1d\xff\xde\xff\xfe\xff\xde\xff\xbc\xfe\xf3\xff\xde\xffW\xff\xfe\xff\xfe\xff\xde\xff\x99\xfed\xfe \xfe\x00\xfd\xe0\xfe\x00\xfe \xfe\x00\xfe \xfe\x00\xf6\x00\xed\xc0\xff\x9a\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xff\xff\xfe\xff\xfe\x88\xff\xff\x02\xff\xde\xff\xde\xff\xdf\x82\xff\xff\x0c\xff\xfe\xff\xfe\xff\xde\xff\xfe\xceq\xd6\xd4\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xff\x85\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x04\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\x82\xff\xde\x0e\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xff\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\x87\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x8f\xff\xde\x01\xff\xdf\xff\xdf\x9c\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x87\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x83\xff\xde\x00\xff\xff\x88\xff\xde\x10\xff\xdf\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\x82\xff\xde\x01\xff\xdf\xff\x9d\x82\xff\xde\x02\xff\xff\xff\xde\xff|\x82\xff\xde\x05\xfeV\xfa\xe5\xf3h\xf3\x88\xf1\xe2\xf66\x87\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xfc\x86\xff\xbd\x86\xff\xde\x1e\xff\xfe\xfdi\xfc\xa1\xff\xbb\xff\xde\xff\xfe\xff\xde\xff\xbd\xff\xdd\xff\xde\xfeN\xfd@\xfd"\xff\xbb\xff\xde\xff\xfe\xffy\xfd\xc3\xfd\xc0\xfd\xa0\xfd\xe0\xfe\x00\xfd\xa0\xfd\xc0\xfd\xe0\xfd\xe0\xfe\x00\xfe\x00\xfd\xc0\xfe \xfe \x82\xfe@\x15\xfe\x00\xfe\x00\xfd\xe0\xfe\x01\xffw\xff\xdd\xff\xdd\xffz\xff\xfe\xfe\xf3\xffV\xff\xde\xff\xdd\xff\xfe\xff\xdd\xff\xdd\xff\xde\xff\xde\xff\xfe\xff\xdd\xff\x9a\xfe\xcb\x82\xfe@\x84\xfe \x07\xfe\x00\xf6\x00\xf6G\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\x83\xff\xff\x0c\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\x82\xff\xde\r\xff\xff\xef7\xf7\xbc\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xcf\x1b\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xff\x86\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xfe\xff\xdf\xff\xff\x84\xff\xde\x00\xff\xff\x84\xff\xde\x04\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\x84\xff\xde\x82\xff\xdf\x03\xff\xff\xff\xde\xff\xde\xff\xff\x8e\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xff\xff\x89\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x01\xff\xff\xff\xdf\x83\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xdf\x89\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\xff\xdf\x84\xff\xde\x03\xf6X\xff\xde\xff\xdf\xff\xff\x92\xff\xde\x02\xff\xff\xff\xde\xff\xff\x82\xff\xde\x07\xff\x9d\xf2\xe6\xf3h\xff\xde\xff\xff\xff\xde\xff\xff\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xdf\xff\xdf\x82\xff\xde\x08\xff\xff\xff\xde\xf3\xc7\xf5\xb2\xff\xde\xff\xde\xff\xdf\xff\xde\xff|\x82\xff\xde\x06\xea\xc7\xfa#\xfaC\xf2"\xfaA\xf9\xa0\xf5\xb3\x83\xff\xde\x00\xff\xbd\x83\xff\xde\x04\xff\xfe\xff\xde\xff\xde\xff\xfe\xff{\x83\xff\xde\x00\xff\xbe\x82\xff\xde\x14\xff\x17\xfc\xa0\xfc\x80\xff\x15\xff\xbc\xff\xff\xff\xde\xff\xbd\xff\x15\xfe\xb1\xfd\x83\xfd\x00\xfd \xfdb\xff6\xff\x9a\xfe)\xfd\x00\xfd@\xfd\x80\xfd\x80\x82\xfd\xc0\x14\xfd\xe0\xfe\x00\xfd\xe0\xfd\xc0\xfe\x00\xfe\x00\xfe \xfe@\xfe@\xfe\x00\xfe\x00\xfe \xfe\x00\xfe\x03\xff\xdd\xffx\xff\xdd\xff\xdd\xff\xde\xffV\xff\x99\x82\xff\xde\x82\xff\xff\x04\xff\xde\xff\xde\xff3\xfef\xfeA\x82\xfe@\x0b\xfe \xfe@\xfe@\xfe \xfe \xfe\x00\xfe\x00\xfe\xee\xff\xbd\xff\xde\xff\xde\xff\xbd\x82\xff\xfe\n\xff\xff\xff\xfe\xff\xff\xff\xff\xff\xfe\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xff\xff\xfe\x82\xff\xde\x13\xff\xfe\xff\xfe\xff\xff\xff\xde\xf7\x9c\xff\xbd\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xef\xbe\xff\xff\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x88\xff\xde\x14\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x82\xff\xde\x08\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x00\xff\xdf\x9d\xff\xde\x01\xff\xdf\xff\xff\x83\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x07\xff\xdf\xff\xde\xff\xde\xf4\xb1\xf6\xfb\xff\xde\xff\xde\xff\xff\x84\xff\xde\x00\xff\xdf\x8a\xff\xde\x0c\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\\\xfb\xc8\xfb\x05\xff;\xff\xde\xff\xff\x84\xff\xde\x03\xff\xff\xf50\xff\xde\xff\xff\x83\xff\xde\x05\xfe\xb7\xfev\xff\xdf\xff\xdf\xff\xff\xff\xff\x83\xff\xde\x07\xf3H\xfaB\xfab\xfab\xfa\xe2\xfa\xc1\xfaA\xff\x9d\x83\xff\xde\x00\xff[\x84\xff\xde\x00\xff\xbd\x89\xff\xde\x15\xfd\xed\xfc\x80\xfc\xc0\xfdd\xfeo\xffz\xff\xdd\xff\x9c\xfd\xec\xfd\x01\xfd \xfd \xfd@\xfd\x00\xfd\x00\xfdA\xfd \xfd\x00\xfd\x80\xfd\xa0\xfd\xa0\xfd\xc0\x82\xfd\xa0\x03\xfd\xc0\xfd\xc0\xfd\xe0\xfe\x00\x82\xfe \x15\xfe\x00\xfd\xe0\xfd\xc0\xfe\x00\xfd\xe0\xfeh\xff5\xfe\xb1\xff\xdd\xff\xde\xff\xde\xff\xfe\xff\xfe\xff\xbc\xff\x9a\xff\xfe\xff\xff\xff\xfe\xff\xbc\xff\xdd\xfe\x89\xfe \x82\xfe@\x02\xfe`\xfe@\xfe@\x82\xfe \x03\xfd\xe0\xfe\x00\xf5\xe0\xff\x11\x85\xff\xde\x84\xff\xfe\x19\xffy\xf6\xf3\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xfe\xff\xdf\xf7z\xff\xbc\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xdf\xff\xff\xff\xde\xff\xff\x96\xff\xde\x01\xff\xfe\xff\xff\x8d\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x87\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x88\xff\xde\x00\xff\xff\x82\xff\xde\x01\xff\xff\xff\xff\x83\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\x84\xff\xde\x01\xff\xdf\xff\xdf\x8c\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xff\x87\xff\xde\x02\xff\xff\xff\xdf\xff\xdf\x89\xff\xde\x02\xff\xff\xff\xde\xff\xff\x82\xff\xde\x01\xff\xfe\xfe\xb9\x85\xff\xde\x00\xff\xff\x82\xff\xde\t\xfd\xb2\xfc\xee\xff\xbe\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xde\x82\xff\xff\x03\xff\xde\xff\xfe\xff\xde\xff\xff\x84\xff\xde\r\xff\xdf\xff\xde\xff\xde\xfe\xfa\xff\xde\xff\xbe\xf1\xe2\xfa\x83\xfa\x83\xfa\xc2\xfb\x01\xfbB\xfa \xff:\x83\xff\xde\x02\xf6v\xff\xde\xff\xbe\x84\xff\xde\x12\xff\x9c\xff\x19\xff\xde\xff\xbe\xff\xde\xff\xbd\xff\xde\xff\xde\xff\x9b\xfc\xc3\xfc\xa0\xfc\xe0\xfd\x00\xfc\xc0\xfd\xca\xff8\xff{\xfe\x8f\xfc\xc0\x84\xfd 3\xfc\xe0\xfd\x00\xfc\xe0\xfd@\xfd`\xfd\x80\xfd\xa0\xfd\xa0\xfd@\xfd\xa0\xfd\xa0\xfd\x80\xfd\xa0\xfd\xe0\xfe \xfe \xfe\x00\xfe\x00\xfd\xe0\xfe\x00\xfe \xfe\x00\xfeH\xff5\xff\xdd\xff\xde\xff\x9a\xff\xde\xff\xde\xff\xbc\xff\xdd\xff\xde\xff\xfe\xff\xfe\xff\xba\xfe\xce\xfe\x02\xfe\x00\xfe \xfe@\xfe \xfe\x00\xfe \xfe@\xfe@\xfe \xfe \xfe\x00\xfe\x00\xf6 \xed\xe1\xff\x98\x82\xff\xde\x00\xff\xfe\x82\xff\xde\x82\xff\xfe\x06\xff\xde\xf6\xf3\xff\x13\xff\xfe\xff\xfe\xff\xde\xff\xfe\x82\xff\xde\x0c\xff\xdf\xff\xde\xff\xfe\xef7\xd6n\xf7\xbb\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\xff\xdf\xff\xfe\x86\xff\xde\x05\xff\xdf\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\x83\xff\xde\x02\xff\xff\xff\xde\xef\x9d\x84\xff\xde\x00\xff\xfe\x82\xff\xde\x02\xff\xff\xff\xfe\xff\xff\x8c\xff\xde\t\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\x83\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xff\xff\xff\xdf\x90\xff\xde\x00\xff\xdf\x8b\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x89\xff\xde\x01\xff\xdf\xff\xff\x99\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xfe\x98\xff|\x82\xff\xde\x00\xff\xfe\x84\xff\xde\x03\xff\xff\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x08\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xdf\xff\xdf\xff\xff\xff\xde\xff\xff\x82\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x0b\xff\xff\xff\xfe\xff\xde\xff\xde\xf2\x03\xfa\x83\xfa\xc3\xfa\xe2\xfa\xe1\xfb\x01\xfa\x81\xff{\x83\xff\xde\x01\xf64\xf7\xdd\x82\xff\xde\r\xff\xff\xff\xde\xff\xde\xfe5\xf4\xed\xff\xff\xff\xde\xff\xde\xff\xbd\xff\xbe\xff\xbc\xfd\xcd\xfc \xfc\xa0\x82\xfc\xe0\x10\xfc\xc1\xfeo\xff\x9c\xfe\x91\xfc\x80\xfc\xa0\xfc\xc0\xfd\x00\xfd\x00\xfd \xfc\xe0\xfb`\xfb`\xfc\xe0\xfd \xfd@\xfd\x80\x83\xfd\xa0\x06\xfd\xc0\xfd\xa0\xfd\xc0\xfe\x00\xfe \xfe \xfd\xe0\x83\xfe\x00\r\xffU\xff\xde\xff\xde\xff\xdd\xffz\xffW\xff\xde\xff\xde\xff\xbc\xff\x98\xff\x10\xfe\xca\xfe\x83\xfe@\x82\xfe \x02\xfe@\xfe \xfe@\x82\xfe \x15\xfe\x00\xfe \xfe \xf6\x00\xf6\x00\xffU\xff\xbd\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xfe\xff\xff\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xfe\xff\xff\xff\xff\x85\xff\xde\x05\xff\xbc\xd5\xe9\xcd\xea\xc6\x0b\xd6\x8f\xff\xdf\x98\xff\xde\x00\xf7\xbe\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x02\xff\xdf\xff\xff\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x8c\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x01\xff\xdf\xff\xfe\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x03\xff\xdf\xff\xdf\xff\xff\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xfe\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x0b\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\x87\xff\xde\x00\xff\xfe\x84\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x84\xff\xde\t\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xfe\x86\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xbe\x82\xff\xde\x17\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xbe\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xde\xf3\x8a\xfa\x02\xfa\xc3\xfbC\xfb#\xfb\x01\xfa\x80\xfeT\x83\xff\xde\x02\xff\xbd\xff:\xff\xbe\x83\xff\xde!\xff\xbd\xf6\xf9\xff\xde\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xdd\xfcc\xfb\xe0\xfc@\xfc\xe0\xfc\xc0\xfc\xc0\xfc\xe0\xfc\xe0\xfc`\xfd\x05\xfc\xe2\xfc`\xfc\xe0\xfd\x00\xfd\x00\xfc\xe0\xfc\xe0\xfc\xc0\xfb\xa0\xfb\xa0\xfc \xfd@\xfd`\xfd`\xfd\x80\xfd`\x82\xfd\x80&\xfd\xa0\xfd\x80\xfd\xc0\xfef\xffT\xfd\xe0\xfe\x00\xfd\xe0\xfd\xe0\xfed\xffz\xffY\xffy\xfe\xac\xfe\xec\xff\x97\xffx\xff2\xfe\xa8\xfe\x00\xfe \xfe@\xfe \xfe`\xfe \xfe \xfe@\xfe`\xfe@\xfe@\xfe\x00\xfe \xfe \xfe@\xfe \xfe\x00\xf5\xe0\xee\x03\xff\xbc\x82\xff\xde\x01\xff\xfe\xff\xfe\x85\xff\xde\x00\xff\xff\x82\xff\xfe\x00\xff\xff\x83\xff\xfe\x06\xff\xde\xff\xde\xd6K\xce)\xce*\xbd\xe9\xe76\x8b\xff\xde\x00\xff\xfe\x85\xff\xde\x00\xff\xff\x86\xff\xde\x01\xff\xff\xff\xff\x86\xff\xde\x0c\xef\x9d\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x87\xff\xde\x02\xff\xfe\xff\xde\xff\xff\x82\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x02\xff\xdf\xff\xff\xff\xff\x85\xff\xde\x01\xff\xdf\xff\xdf\x87\xff\xde\x00\xff\xff\x8c\xff\xde\x00\xff\xff\x86\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x88\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xdf\x8d\xff\xde\x02\xff\xfe\xff\xde\xff\xdf\x9d\xff\xde\x04\xff\xff\xff\xdf\xff\xdf\xff\xfe\xff\xdf\x84\xff\xde\x00\xff\xbe\x84\xff\xde\x02\xff\xff\xf6\x15\xff\x9d\x82\xff\xde\x07\xff\xbe\xf4M\xfa!\xfb#\xfe\xb6\xfb\xa4\xfb\xa3\xfd\xaf\x84\xff\xde\x10\xfe\xf9\xff\xde\xff\xde\xff\x9c\xfe\xd8\xff\xdd\xff\x19\xf4k\xff\xde\xff\xfe\xff\xde\xff\xde\xfd\xf1\xff|\xfd*\xfb\xc0\xfc@\x83\xfc\xc0\x0e\xfc\x80\xfc`\xfc`\xfc\x80\xfc\xa0\xfc\xe0\xfc\xe0\xfd \xfc\xe0\xfc\xe0\xfc\xa0\xfb\x80\xfb\xe0\xfc`\xfd@\x82\xfd`\x03\xfd@\xfd`\xfd@\xfd`\x82\xfd\x80\x10\xfe\xf0\xfe\xd0\xfd\xe0\xfd\xc0\xfd\xe0\xfe\x00\xfd\xe0\xfe\xce\xfe\xf3\xff\x99\xfe\xa9\xfe \xfe \xfd\xe0\xfe \xfe@\xfe`\x83\xfe@\x0e\xfe \xfe \xfe@\xfe \xfe \xfe@\xfe \xfe \xfe@\xfe \xfe\x00\xf5\xe0\xf5\xc0\xf6\x89\xff\xbc\x82\xff\xde\x82\xff\xfe\x00\xf7\x9c\x83\xff\xde\x01\xff\xfe\xff\xfe\x82\xff\xde\x00\xff\xfe\x82\xff\xde\x06\xff\xfe\xefV\xcd\xe7\xce\n\xd6.\xe6\xf6\xff\xfe\x83\xff\xde\x00\xff\xfe\x83\xff\xde\x00\xff\xff\x8a\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xdf\x89\xff\xde\x02\xf7\xbe\xff\xde\xff\xff\x83\xff\xde\n\xff\xfe\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xff\x88\xff\xde\x07\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xff\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x07\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x8f\xff\xde\x02\xff\xfe\xff\xdf\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\x83\xff\xdf\x01\xff\xff\xff\xdf\x92\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xff\x84\xff\xde\x02\xff\xdf\xff\xff\xff\xdf\x82\xff\xde\x05\xff\xff\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\x84\xff\xde\x02\xff\xff\xff\xfe\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xfe\xff\xfe\x82\xff\xde\x13\xf4\xaf\xf2\xc4\xfd\r\xfd\x0c\xfb\xa3\xfdL\xff\xde\xff\xde\xff\x1a\xff\xde\xff\xde\xff:\xff\xde\xff\xbd\xf2b\xfa`\xf4\xce\xff\x9d\xff\x9d\xff\xbe\x82\xff\xde\x08\xf5\xd0\xfe\xd6\xfe\xf7\xfc \xfc\x80\xfc`\xfc`\xfc\xa0\xfc\xa0\x82\xfc\x80\x03\xfc`\xfc \xfc\xe0\xfc\xe0\x82\xfd\x00\x03\xfd \xfc@\xfc \xfc\xa0\x82\xfd`\t\xfd\x80\xfd`\xfd \xfd@\xfd@\xfd\x80\xfd\x80\xfd`\xfda\xfdA\x82\xfd\xa0\x04\xfd\xc0\xfd\x80\xfd\xc1\xfd\xa0\xfe\x89\x83\xfe \x85\xfe@\x00\xfe \x82\xfe@\x00\xfe \x83\xfe@\x08\xfe \xfe@\xfe\x00\xfeD\xfe\xcd\xff\x9a\xff\xdd\xff\xde\xff\xde\x82\xff\xfe\x18\xff\xbb\xff\xff\xff\xde\xff\xbd\xff\xfe\xff\xde\xff\xde\xf7\x9b\xf7\xbc\xff\xfe\xff\xde\xff\xdd\xf7\xdc\xff\xde\xff\xfe\xe75\xc6(\xc6\x06\xee\xd1\xff\xde\xff\xde\xff\xfe\xff\xde\xf7\xbe\xff\xfe\x84\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xfe\x83\xff\xde\x03\xff\xfe\xff\xde\xff\xde\xff\xdf\x8d\xff\xde\x0c\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\xff\xff\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x02\xff\xff\xff\xde\xff\xfe\x88\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xfe\x96\xff\xde\x07\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xff\x88\xff\xde\x02\xff\xfe\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x85\xff\xde\x01\xff\xff\xff\xbe\x89\xff\xde\x00\xff\xdf\x83\xff\xde\x05\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\x82\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xbe\x83\xff\xdeB\xff\xfe\xff\xbd\xff:\xff\x9d\xf5.\xfdn\xfe\xf9\xff\xde\xff\xbe\xff\xde\xff\x9d\xff\xde\xff\xbe\xff\x9d\xfa!\xfa\xc0\xf2\x01\xff\x9d\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xbe\xff\xbd\xff\xbd\xff{\xfb\xe0\xfc`\xfc \xfb\xe0\xfc@\xfc\x80\xfc@\xfc\x80\xfc\xa0\xfc@\xfc`\xfc\xe0\xfc\xc0\xfc\xc0\xfc\xe0\xfd \xfd\x00\xfc\xc0\xfc`\xfd\x00\xfd\x00\xfd@\xfd`\xfd`\xfd \xfd@\xfd \xfd`\xfd`\xfd\xa0\xfd\x80\xfd`\xfd\xa0\xfd\x80\xfd`\xfd\xa0\xfd\xa0\xfd\x80\xfd\xc0\xfd\xe0\xfe\x00\x83\xfe \x82\xfe`\x04\xfe@\xfe@\xfe \xfe \xfe`\x82\xfe@\x83\xfe \x0e\xfe@\xfe@\xfe\x00\xff\x10\xff\xdd\xff\xbc\xff\xde\xff\xff\xff\xfe\xff\xfe\xff\xff\xf76\xe5\xa3\xff\xdd\xff\xbd\x83\xff\xde\n\xf7\xdd\xff\xde\xff\xfe\xd6\xf0\xa6\x03\xa6\x03\xe7T\xe74\xbe(\xbe\x08\xd6*\x85\xff\xde\x00\xff\xff\x87\xff\xde\x01\xff\xdf\xff\xdf\x83\xff\xde\x03\xf7\xde\xff\xde\xf7\xde\xf7\xbe\x8a\xff\xde\x00\xff\xfe\x85\xff\xde\x01\xff\xdf\xff\xdf\x87\xff\xde\x05\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xff\xff\xde\xff\xff\xff\xff\x82\xff\xde\x05\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xdf\x84\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xdf\x8c\xff\xde\x01\xff\xff\xff\xdf\x87\xff\xde\x01\xff\xdf\xff\xdf\x89\xff\xde\x03\xff\xdf\xff\xde\xff\xff\xff\xff\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x07\xff\xff\xff\xde\xff\xde\xff\xff\xff\x9d\xff\xde\xff\xdf\xff\xdf\x85\xff\xde\x00\xff\xff\x84\xff\xde\x86\xff\xff\x83\xff\xde\x03\xff\xbe\xff\xde\xff\xde\xff\xff\x83\xff\xde\x08\xff|\xff\xbe\xff\xde\xff\xde\xff\x9d\xff\xde\xf64\xfe\xd8\xfe\xf9\x83\xff\xde\x05\xff\xbd\xff\xff\xf4J\xfa\xa0\xfa\xc0\xfd\xb1\x83\xff\xde\n\xff\x19\xff\x9c\xff\xbe\xf5N\xfb`\xfc\x00\xfb\xe0\xfb\xc0\xfc\x00\xfb\xc0\xfc \x82\xfc@\x15\xfc\x80\xfc\xa0\xfc`\xfc\xa0\xfd\x00\xfd\x00\xfd \xfd@\xfd@\xfd \xfd@\xfd\x00\xfd`\xfd@\xfd@\xfd \xfd\x00\xfd`\xfd\x80\xfd\xa0\xfd`\xfd@\x83\xfd\xa0\x06\xfd\x80\xfd\x80\xfd\xe0\xfe\x00\xfd\xc0\xfd\xe0\xfd\xe0\x82\xfe \x82\xfe@\x82\xfe\x00\x0b\xfe@\xfe \xfe \xfe@\xfe@\xfe \xfe \xed\x80\xfe\x00\xfe \xfe\xaa\xff\xbc\x83\xff\xde\x06\xff\xff\xff\xde\xff\xde\xff\xbc\xffU\xff\xff\xff\xfe\x84\xff\xde\n\xf7\xdd\xd6\xab\xae\x01\xae!\xa6"\x95\xe2\xa6%\xce\xcd\xbe+\xff\xde\xff\xfe\x87\xff\xde\x82\xff\xff\x8a\xff\xde\x00\xff\xdf\x8c\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\x87\xff\xde\x01\xff\xff\xff\xdf\x8b\xff\xde\x00\xff\xff\x86\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x8b\xff\xde\x01\xff\xdf\xff\xff\x8a\xff\xde\x00\xff\xdf\x82\xff\xde\x05\xf66\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xff\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xff\xff\xdf\x83\xff\xde\x02\xff\xff\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xde\x06\xff\xdf\xf6\xfa\xff\xde\xff\xbe\xff\xde\xff\xff\xff\xff\x82\xff\xde\x18\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xfe\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xbe\xff\x9d\xff\xde\xff\x9d\xfdN\xff|\xff\xbe\xff\xde\xff\xbd\x84\xff\xde\x04\xf3\xa6\xfcG\xfc\x89\xf4\'\xff\xbd\x84\xff\xde2\xf3\xa5\xfb\x00\xfc&\xff|\xff\xbd\xff\xbd\xff\x9c\xff{\xff\x9c\xff\xbd\xf3\xe4\xfb\x80\xfb`\xfb`\xfb\x80\xfc\x00\xfc \xfc@\xfc \xfc`\xfc@\xfc\x80\xfc`\xfc\x80\xfc\xa0\xfc\x80\xfc\xe0\xfd\x00\xfd@\xfd`\xfd@\xfd`\xfd\x80\xfd`\xfc\xe0\xfd@\xfd\x00\xfd@\xfd`\xfd\xc0\xfd\x80\xfd\x80\xfd`\xfd\x80\xfd`\xfd@\xfd@\xfd`\xfd\x80\xfd\x80\xfd\xa0\x82\xfd\xe0\x82\xfe\x00\x02\xfe \xfe@\xfe \x82\xfe@\x04\xfe \xfe \xfe@\xfe`\xfe@\x82\xfe \x1d\xfe\x00\xf6\x00\xff3\xff\xbd\xff\xdd\xff\xde\xff\xfe\xff\xde\xff\xdd\xff\xbb\xff\xbc\xff\xde\xff\xff\xff\xff\xff\xfe\xff\xde\xff\xfe\xff\xdd\xff\xde\xff\xde\xe6\xf0\xad\xe0\xb6!\xb6B\xa6"\x9d\xe2\x9e$\xa6(\xf7\xdd\xff\xdf\x85\xff\xde\x0b\xff\xdf\xf7\xbe\xff\xde\xff\xde\xff\xdf\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xfe\xff\xfe\x83\xff\xde\x00\xf7\xbe\x84\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xfe\x82\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xff\xa9\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x83\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xff\xff[\x8a\xff\xde\x01\xff\xdf\xff\xdf\x84\xff\xde\x01\xff\xff\xff\xdf\x8a\xff\xde\x00\xff\xbe\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xbe\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xff\x9d\xff\xdf\x89\xff\xde\x03\xff\xbe\xff[\xf2a\xf3\xa6\x87\xff\xde\x05\xfc\xcc\xfbc\xfbB\xfb\x01\xf3d\xfe\xb6\x83\xff\xde%\xff[\xfd\xcf\xfb\xe1\xfc"\xfcd\xfeQ\xfd\x8d\xf5L\xff\x9c\xff{\xfb\x01\xfb@\xfb`\xfb`\xfc\x00\xfc\x00\xfb\xe0\xfc \xfc@\xfc@\xfc \xfc\x80\xfc`\xfc\x80\xfc\x80\xfc\xa0\xfc\xe0\xfc\xe0\xfd@\xfd`\xfd@\xfd@\xfd \xfd\x80\xfd@\xfd \xfd \xfd\x00\x83\xfd`\n\xfd\x80\xfd`\xfd`\xfd@\xfd@\xfd`\xfd\x80\xfd\x80\xfd\xa0\xfd\xc0\xfd\xa0\x82\xfd\xc0,\xfd\xe0\xfe\x00\xfe \xfe \xfe\x00\xfe \xfe \xfe@\xfe@\xfe`\xfe`\xfe@\xfe \xfe\x00\xfe \xfe \xfeA\xffu\xff4\xff2\xff\xbb\xff\x99\xf6i\xed\xc1\xed\xe1\xf75\xff\xfe\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xbd\xff\xdd\xd6\x88\xae\x00\xb6!\xaeB\xa6#\x9e\x03\x85\xe4\xe7V\xff\xde\xf7\xde\x84\xff\xde\t\xff\xfe\xf7\xde\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xfe\xef8\xe6\xb4\x85\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xe7\x9e\xd7\x9d\x84\xff\xde\x03\xff\xff\xff\xde\xff\xff\xff\xdf\x85\xff\xde\x00\xff\xdf\x83\xff\xde\x0b\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xdf\xff\xff\xff\xdf\xff\xdf\x85\xff\xde\r\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xff\x90\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xff\x88\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x05\xff\xff\xff\xff\xff\xde\xff\xde\xf7\x1b\xff\xbe\x86\xff\xde\x00\xff\xbe\x82\xff\xde\x02\xff}\xff\xde\xff\xdf\x82\xff\xde\t\xff\xdf\xff\xde\xff\xde\xff\\\xff\xde\xff\xfe\xff\xbe\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x03\xff\xbe\xff\xde\xff\xdf\xff\x9d\x82\xff\xde\x02\xff\xfe\xff\xdf\xff\xbe\x83\xff\xde\x10\xfe5\xfbd\xfe4\xff\xde\xff\xde\xff\x9d\xff|\xff;\xfe\x97\xfd.\xfbB\xfa\xe0\xfa\xe0\xfb\x00\xfb\x00\xfb@\xfet\x82\xff\xde$\xfe\x94\xfc\xe8\xfb\x80\xfb\x80\xfb@\xfb`\xfb\x80\xfb\x00\xfb\x00\xfb\xe2\xfb\x00\xfb@\xfb\x00\xfb@\xfc \xfc \xfb\xe0\xfc\x00\xfc\x00\xfb\xe0\xfc@\xfc@\xfc \xfc\x00\xfc`\xfc\xc0\xfc\xa0\xfc\xa0\xfd\x00\xfd \xfd \xfd@\xfd@\xfd\x80\xfd`\xfd@\xfd\x00\x82\xfc\xe0\x01\xfd@\xfd\x80\x83\xfd`\x0c\xfd@\xfd\x80\xfd\xa0\xfd`\xfd\xa0\xfd\xc0\xfd\xc0\xfd\xe0\xfd\xc0\xfd\xc0\xfe\x00\xfe \xfe \x82\xfe\x00\x82\xfe@"\xfe`\xfe`\xfe@\xfe@\xfe \xfe@\xfe \xfe \xfeA\xfe \xfe\x87\xee#\xee\x01\xe6#\xed\xc0\xf7\x11\xff\xde\xff\xff\xff\xfe\xff\xde\xff\xde\xff\xdd\xf7\xbc\xde\xf3\xe7w\xefU\xc6B\xae!\xaeA\xaeB\xa6#\x85\xe4}\xa5\xf7\xbd\xf7\xde\x8d\xff\xde\x07\xb5\x8f\xd5\xce\xff\xdd\xff\xff\xff\xde\xff\xde\xe7\x9c\xef\x9d\x85\xff\xde\x05\xff\xff\xdf\xbe\r\xf8\x15\xd7\xd7}\xff\xdf\x82\xff\xde\x00\xff\xff\x84\xff\xde\x03\xff\xdf\xff\xdf\xff\xfe\xff\xff\x83\xff\xde\x00\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xfe\x83\xff\xde\x00\xff\xfe\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x92\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x83\xff\xde\x04\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x06\xff\xff\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xdf\xff\xdf\x85\xff\xde\x00\xff\xbe\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x13\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\xff\x9d\xff\xbe\xff\xde\xff\xbe\xff\xfe\xff\xde\xff\xff\xff\xde\xff\xdf\xff}\xff\xde\xff|\xff\xdf\xff\xff\xff\xff\x82\xff\xbe5\xff\xff\xff\xde\xff\xde\xff\xbe\xf5P\xfe\xb7\xfd\x8f\xfbB\xfb\x01\xf4\x08\xfeU\xfc&\xfb!\xfa\xa0\xfa\xc0\xfb \xfb`\xfb@\xfb\xa2\xffZ\xff\xbd\xf5\xf2\xfb\x82\xfb\x80\xfb\xa0\xfb\x00\xfb \xfb`\xfb\xa0\xfb`\xfb`\xfb\x80\xfb`\xfb@\xfb\x00\xfb\x80\xfb\xc0\xfb\xe0\xfb\xc0\xfb\xa0\xfc\x00\xfc \xfc \xfc\x00\xfb\xe0\xfb\xc0\xfc\x80\xfc\xc0\xfc\xc0\xfc\xe0\xfc\xe0\xfd\x00\xfc\x80\xfd\x00\x82\xfd@\x10\xfd \xfd\x00\xfc\xc0\xfd\x00\xfc\xe0\xfd \xfd\x00\xfd`\xfd@\xfd\x00\xfd \xfd\x00\xfd \xfd`\xfd`\xfd\x80\xfd`\x82\xfd\xc0\x00\xfd\xe0\x82\xfe\x00\x06\xfe \xfe \xfe\x00\xfe \xfe@\xfe@\xfe \x84\xfe@\x1b\xfe \xfe@\xfe@\xf6 \xf6 \xf6@\xf6\x85\xee\xaa\xee\x03\xff\xbb\xff\xde\xff\xfe\xff\xde\xff\xdd\xff\xde\xf7\xbc\xefX\xe7U\xf7\x99\xc6e\xae"\xaeB\xa6"\xa6\x01\x95\xe2\x8e\x05\xaem\xf7\xdd\x84\xff\xde\x02\xf7\xde\xff\xde\xff\xdf\x82\xff\xde\x0b\xff\xff\xff\xde\xff\xde\xff\xff\xff\xbc\xff\xde\xff\xff\xff\xde\xff\xde\xef\x9d\x964\xce\xf9\x86\xff\xde\x04\xbf}\x1d\xf8\x15\xd7\xe7\xbe\xff\xff\x86\xff\xde\x02\xff\xdf\xff\xff\xff\xff\x84\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xfe\xff\xdf\x82\xff\xde\n\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xff\x8d\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x8e\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x8b\xff\xde\x04\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x8b\xff\xde\x06\xff\xdf\xeb\x8c\xf5\xf5\xff\xde\xff\xde\xff\xff\xff\xdf\x84\xff\xde\x08\xff\xbe\xff\xdf\xff\xde\xff\xfe\xf6\xda\xe1\xc5\xe9c\xf5\x11\xff\xbe\x86\xff\xde\x00\xff\xff\x82\xff\xde!\xff\\\xf2\x84\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xbd\xfeu\xfb\x80\xfb\xa0\xfb\x80\xfb \xfbA\xfbb\xfb\x00\xfa\xe0\xfa\xe0\xfb \xfb@\xfb\x80\xfb\xa0\xfc\x84\xffY\xfe\x12\xfb`\xfb@\xfb\x00\xfa\xc0\xfb@\xfb`\xfb\x80\xfb\xa0\x82\xfb@\x13\xfb`\xfb@\xfb`\xfb`\xfb\xe0\xfb\xc0\xfb\x80\xfb\xe0\xfc\x00\xfc@\xfc\x00\xfb\xe0\xfc\x00\xfc@\xfc\xa0\xfc`\xfc\xc0\xfc\xa0\xfc\xc0\xfc\xe0\x82\xfd\x00\n\xfc\xe0\xfc\x80\xfc\xe0\xfc\x80\xfd\x00\xfc\xe0\xfc\xe0\xfd\x00\xfd\x00\xfc\xe0\xfd \x82\xfd\x00\x03\xfd@\xfd@\xfd`\xfd\xa0\x83\xfd\xc0\x02\xfd\xa0\xfd\xc0\xfe\x00\x82\xfe \x00\xfe@\x83\xfe\x00\x00\xfe \x83\xfe@\x1a\xfe \xf6@\xf6@\xf6 \xf6b\xff\xdb\xff\xbd\xff\xbc\xff\xde\xff\xde\xff\xdd\xf7\xbd\xff\xdd\xff\xde\xf7\xdd\xe7\x14\xefx\xd6\xef\xaeC\xa6#\xa6"\xa6B\x95\xc1}\xa2\x8d\xe5\xef\x9a\xf7\xbd\x86\xff\xde\x03\xff\xff\xff\xfe\xff\xde\xff\xff\x84\xff\xde\n\xff\xff\xff\xde\xff\xde\xff\xfe\xf7\xbd\xdf\x19\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\x82\xff\xde\x05\xf7\xde\xd7}\xef\xbe\xff\xde\xff\xde\xff\xfe\x85\xff\xde\x00\xff\xdf\x85\xff\xde\x02\xff\xff\xff\xff\xff\xfe\x8c\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x82\xff\xde\x01\xff\xff\xff\xff\x87\xff\xde\x00\xff\xff\x84\xff\xde\x04\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x83\xff\xde\t\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xff\x83\xff\xde\x05\xff\xfe\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x8e\xff\xde\x08\xff\xbe\xff\xbe\xff\xbd\xe9\x84\xf1\xa4\xf1\xc4\xf1\xa3\xf2\xa6\xff\x1b\x83\xff\xde\x02\xff\xff\xff\xde\xff\xff\x82\xff\xde\x05\xff\xdf\xf6\x98\xff\x9d\xfeW\xff\xde\xff\xbd\x82\xff\xde\x06\xff\x19\xfb\xe1\xfb\xc0\xfb\x80\xfb@\xfb \xfb\x00\x82\xfa\xe0\x08\xfb@\xfb@\xfb`\xfb\xa0\xfb`\xfc"\xfc\xa5\xfb\x80\xfb@\x82\xfb\x00\x17\xfb`\xfb@\xfb\x80\xfb\xa0\xfb@\xfb`\xfb\xa0\xfb@\xfb \xfb`\xfb`\xfb@\xfb\xe0\xfc\x00\xfc \xfc@\xfc \xfb\xe0\xfc`\xfc@\xfc\x80\xfc\x80\xfc\xa0\xfc\xa0\x82\xfc\xc0\x05\xfc\xa0\xfc`\xfc@\xfc\x80\xfc\xa0\xfc\xe0\x84\xfd\x00\x82\xfd \r\xfd\x00\xfd \xfd@\xfd@\xfd\x80\xfd\xa0\xfd\xa0\xfd\xc0\xfd\xa0\xfd\x80\xfd\xc0\xfd\xa0\xfd\xa0\xfe\x00\x83\xfe \x02\xfd\xe0\xfe\x00\xfe\x00\x82\xfe \x1b\xfe@\xfe@\xf6 \xf6@\xf6@\xf6 \xee@\xf6\xef\xf7\x12\xff\xde\xff\xde\xff\xdd\xefy\xff\xdd\xff\xde\xefy\xf7\x9b\xefx\xd6\xce\xb6f\xa6D\xaeC\xa6"\xa6#\x96\x02\x85\xc4\xef\x9a\xf7\xdd\x84\xff\xde\n\xf7\xde\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xfe\xff\xdf\xff\xde\xff\xde\xff\xdf\x8c\xff\xde\x07\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x8a\xff\xde\x08\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\x82\xff\xde\n\xff\xdf\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xff\x89\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x88\xff\xde\x00\xff\xfe\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xdf\x87\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xbe\x87\xff\xde\x02\xff\xdf\xff\xdf\xf7\x9d\x83\xff\xde\n\xf6\xb9\xf1d\xf1\xa3\xf1\xe3\xf1\xe3\xf1\xc3\xe9\xc4\xff\xbe\xff\xde\xff\xde\xff\xbe\x82\xff\xde\x01\xff\xbe\xff\x9d\x83\xff\xbe\r\xf5Q\xff;\xf3e\xff\xbd\xff\xde\xff\xde\xf5p\xfc\x04\xfb\xa1\xfb\xa1\xfb`\xfb \xfa\xe0\xfa\xc0\x82\xfa\xe0\x0b\xfb \xfb`\xfb\xa0\xfb\xc0\xfb\xe0\xfb\xc0\xfb`\xfb@\xfb\x00\xfa\xc0\xfa\xc0\xfb \x84\xfb@\t\xfb`\xfb\x00\xfb\x00\xfb@\xfb`\xfb\xe0\xfb\xc0\xfb\xe0\xfb\xe0\xfc`\x82\xfc@\x0c\xfc \xfc`\xfc`\xfc@\xfc\x80\xfc \xfb\xe0\xfa\xe0\xfb@\xfb@\xfb \xfc \xfc`\x82\xfc\xa0\n\xfd\x00\xfd \xfd \xfd@\xfd \xfd`\xfd@\xfd@\xfd`\xfd`\xfd\x80\x84\xfd\xc0\x05\xfd\xe0\xfd\xe0\xfd\xc0\xfe\x00\xfe \xfe@\x83\xfe \x1e\xfe\x00\xfe@\xfe@\xfe`\xfe`\xf6 \xf6`\xf6@\xf6 \xf6@\xee@\xf6@\xee!\xff\x99\xff\xde\xf7\xbd\xf7\xbd\xff\xde\xe76\xad\xe5\xf7\x99\xc6\x8a\x9d\xe2\xa6#\xa6D\x9e#\xa6#\x9e\x03\x85\xa3\xd7\x14\xf7\xde\x84\xff\xde\x00\xf7\xbe\x83\xff\xff\x8f\xff\xde\x01\xff\xdf\xff\xff\x84\xff\xde\x01\xff\xdf\xff\xfe\x84\xff\xde\x00\xff\xff\x82\xff\xde\x01\xff\xff\xff\xff\x8b\xff\xde\x03\xff\xdf\xff\xde\xff\xdf\xff\xfe\x84\xff\xde\x01\xff\xfe\xff\xff\x85\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xfe\x8c\xff\xde\x02\xff\xdf\xff\xde\xff\xfe\x8a\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x88\xff\xde\x01\xff\xdf\xff\xdf\x87\xff\xde\x00\xff\xfe\x84\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x84\xff\xde\x01\xff\xdf\xff\xdf\x84\xff\xde\x01\xff\xbe\xff\xdf\x84\xff\xde\n\xf5\xf6\xf1\x85\xf9\xc4\xf9\xe4\xf1\xe3\xf1\xc3\xf1\x82\xf5Q\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x06\xff\x1b\xf5R\xf6\x16\xff}\xff\xde\xff\xde\xff\xbe\x83\xff\xde(\xff|\xfd\x90\xfd\x90\xfdm\xfb\x00\xfb \xfb \xfa\xe0\xfa\xa0\xfa\xc0\xfa\xc0\xfa\xe0\xfb\x00\xfb`\xfb\xc0\xfb\xc0\xfb\xa0\xfb\x80\xfb`\xfb@\xfa\xc0\xfa\xe0\xfa\xe0\xfb \xfb`\xfb`\xfb@\xfb \xfb\x00\xfb\x00\xfa\xa0\xfb\x00\xfb\x80\xfb\xc0\xfb\xe0\xfb\xa0\xfb\xc0\xfb\xe0\xfb\xe0\xfc@\xfc@\x84\xfc\x00A\xfb\xa0\xfb\xe0\xfb@\xfb\xa0\xfb\xa0\xfb\x80\xfc\xa0\xfc\xa0\xfc`\xfc\x80\xfc\xa0\xfc\xe0\xfc\xe0\xfd\x00\xfd\x00\xfd \xfd@\xfd`\xfd\x80\xfd\x80\xfd`\xfd`\xfd\x80\xfd\xa0\xfd\xa0\xfd\xc0\xfd\xe0\xfd\xc0\xfd\xe0\xfd\xe0\xfe \xfe@\xfe@\xfe \xfe \xfe@\xfe \xfe \xfe@\xfe`\xf6 \xf6@\xf6\x00\xee\x00\xf6@\xee@\xee@\xee`\xee \xee\x88\xff\xde\xff\xde\xff\xdd\xf7\xdd\xff\xdd\xf7\x9c\xf7\xbc\xe7S\xa6\x03\xa6#\xa6#\x9e$\x9eD\xa6$\xd6\xef\xf7\xbc\x82\xff\xde\x03\xff\xff\xff\xde\xf7\xde\xf7\xde\x85\xff\xde\x03\xff\xff\xff\xff\xff\xde\xff\xfe\x84\xff\xde\x03\xf7\xde\xff\xde\xff\xde\xf7\xbe\x8f\xff\xde\x00\xff\xfe\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xde\x82\xff\xff\x02\xff\xde\xff\xde\xff\xdf\x87\xff\xde\x07\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xfe\xff\xde\xff\xfe\x82\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x95\xff\xde\x03\xff\xdf\xff\xff\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x84\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x08\xf6\x99\xe9\x84\xf1\x83\xfa\x04\xfa\x03\xf2\x04\xf1\xa3\xfb\xa9\xff\xbe\x85\xff\xde!\xff\xbe\xff\xde\xff\xbe\xff\xbe\xff\xde\xff\xff\xff\xbe\xff\xde\xff\x9d\xff\x9d\xff\xbe\xff\xbe\xff\x1a\xff\\\xfdn\xfa\xe0\xfb\x00\xfb\x00\xfa\xe0\xfb \xfa\xe0\xfa\xc0\xfb \xfa\xe0\xfa\xe0\xfb \xfb\x00\xfb\x00\xfb \xfb`\xfb`\xfa\xe0\xfb \xfb \x82\xfb\x00\x0e\xfa\xe0\xfa\xe0\xfb\x00\xfa\xc0\xfa\xc0\xfb@\xfb\x80\xfb\xc0\xfb\xc0\xfb\x80\xfb\xa0\xfc\x00\xfc \xfb\xa0\xfb\xa0\x85\xfb\xc0\x0b\xfb\xa0\xfb\x00\xfb\x80\xfb\xc0\xfb\xa0\xfc\xa0\xfc\xc0\xfc`\xfc\xc0\xfd\x00\xfc\xe0\xfc\xe0\x82\xfd \x0c\xfd\x80\xfd`\xfd\x80\xfd\xa0\xfd@\xfd`\xfd\x80\xfd\xa0\xfd\xa0\xfd\x80\xfd\xa0\xfd\xc0\xfd\xc0\x82\xfe\x00\x1f\xfe \xfe\x00\xfe \xfe@\xfe@\xf6@\xf6@\xf6`\xf6@\xf6@\xf6`\xf6@\xee \xee@\xe6@\xee\x82\xf6\x83\xff\x97\xff\xbe\xff\xbd\xef3\xef4\xff\xdc\xf7\x98\xef\x10\xbe$\xb6C\xb6c\xaeD\x9e$\x9e&\xff\xdd\x82\xf7\xde\x03\xff\xde\xff\xde\xc7\x18\xae\xd6\x85\xff\xde\x00\xff\xfe\x85\xff\xde\x04\xff\xff\xff\xde\xff\xde\xdf|\xf7\xde\x82\xff\xde\x01\xf7}\xf7\xde\x84\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x03\xff\xdf\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xff\xdf\xff\xff\x87\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xdf\x9a\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x8b\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\x9e\xf6W\xff\xde\xff\xff\x82\xff\xde\x00\xff\xdf\x85\xff\xde\n\xff\xdf\xff\xdf\xff\xde\xff\xbe\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xde\xff}\x82\xff\xde\x00\xff\xff\x83\xff\xde\x11\xff\xfe\xeb+\xf1c\xf1\xc3\xf1\xe3\xfa$\xf2\x04\xfa\x85\xfd\xd4\xff\xde\xff\xbe\xff\xde\xff\xbe\xfe\xfa\xff|\xff\xde\xff\xde\xff\xbe\x82\xff\xde\x01\xff\xbe\xff\xde\x83\xff\xbe\x1a\xff\x9d\xfe5\xfbD\xfb\x01\xfb\x00\xfb \xfb \xfb\x00\xfa\x80\xfa`\xfa\xc0\xfa\x80\xfa`\xfa\xc0\xfa\xe0\xfa\xc0\xfa\xe0\xfb`\xfb \xfb\x00\xfb\x80\xfb\xe0\xfb \xfb \xfb\x00\xfb\x00\xfa\x80\x83\xfa\xc0\t\xfb\xa0\xfb\xc0\xfb\xc0\xfb@\xfb`\xfb@\xfb\x80\xfb \xfb\xa0\xfb\xc0\x82\xfb\xa0\n\xfb\xc0\xfb\xa0\xfb\xc0\xfb@\xfb@\xfb`\xfb\xa0\xfc\xa0\xfc\xe0\xfc\xa0\xfc\x80\x82\xfc\xe0\x02\xfd@\xfd`\xfd \x83\xfd`2\xfd\x80\xfd\x80\xfd`\xfd\x80\xfd\x80\xfd`\xfd \xfd\x80\xfd\xc0\xfd\xe0\xfe\x00\xfe\x00\xfd\xe0\xfe \xfe@\xfe@\xf6\x00\xee \xee \xf6`\xf6\x81\xf6\xa1\xee\x81\xee\x81\xee\x80\xf6\xa1\xee\x81\xee\x82\xeeb\xf7u\xf75\xdd\xc4\xd5\xa0\xcd\xe3\xd5\xc3\xd5\xc1\xc5\xe1\xbeB\xbeC\xb6c\xa6C\x96$\xe7W\xef\x9b\xdfY\xc7\x16\xef\xbd\xf7\xbd\xf7\xde\xae\xf7\xae\xd7\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xde\x08\xf7\xde\xf7\xde\xff\xdf\xff\xde\x9e\xfa\x1d3\x867\xbe\x99\xff\xbe\x84\xff\xde\n\xf7\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xdf\xff\xde\xe7}\xf7\xde\xff\xfe\xff\xff\x8e\xff\xde\x00\xff\xdf\x97\xff\xde\x02\xff\xff\xff\xde\xff\xfe\x89\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xde\x04\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xff\x85\xff\xde\x82\xff\xff\x92\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x84\xff\xde\x07\xff\xdf\xff\xff\xff\x9e\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\x90\xff\xde\x04\xff\xdf\xff\xde\xff\xbe\xff\xdf\xff\xdf\x82\xff\xde\n\xff\xff\xff\xff\xff\xdf\xf4\x90\xe9\xc4\xf1\x83\xf9\xe4\xf1\xe4\xf1\xc4\xf2e\xf5r\x82\xff\xbe\x07\xf4.\xf4\x8e\xff\xde\xff;\xff\xde\xff\xbe\xff\xde\xff\xbe\x82\xff\xde\n\xff|\xf3\xea\xff\x9d\xfe\xd8\xfe\x97\xf2!\xf2 \xfa\x80\xfa\xc0\xfa\xc0\xfa\x80\x83\xfa`\x03\xfa@\xfa\xa0\xfa\xe0\xfb\x00\x82\xfb@\x1f\xfb\x80\xfb\xe0\xfc \xfb\xa0\xfa\xe0\xfa\xc0\xfb\x00\xfa\xc0\xfa\xa0\xfa\xe0\xfb\x00\xfb@\xfb\xc0\xfb\xe0\xfb\xc0\xfb\x00\xfb`\xfb`\xfb@\xfb \xfb\x80\xfb\xa0\xfb\xa0\xfb\xc0\xfb\xa0\xfb\xe0\xfb\xa0\xfb@\xfb\x80\xfb`\xfb@\xfc@\x83\xfc\x80\r\xfc\xc0\xfd \xfc\xe0\xfd \xfd@\xfc\xe0\xfd\x00\xfd@\xfd \xfd`\xfd\x80\xfd`\xfd\x80\xfd`\x82\xfd\x80\x00\xfd\xc0\x82\xfd\xe0\'\xfe\x00\xfe \xfe@\xfe`\xf6@\xf6 \xee \xf6@\xf6\xa1\xf6\xc2\xf6\xa2\xf6\xc2\xee\x81\xee\xa2\xf6\xc2\xee\x82\xe6a\xee\xc9\xee\x88\xd5A\xd5 \xcd`\xc5`\xc5`\xc5\xa0\xc5\xc0\xbe\x00\xbe!\xa6"\x95\xe2\x85\xa2\xf7\xbc\xf7\xbd\xe7{\xd7X\xf7\xde\xe7{\xf7\xbd\xf7\xde\xff\xff\x84\xff\xde\x05\xff\xff\xd7}fX\xf7\xbe\xff\xde\xff\xff\x83\xff\xde\x0f\xdf\x9d\xe7\x9e\xdf\x9dVX\x05\x94\x053\r\x13\xa6\xba\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\xae\xfb\xf7\xbe\xff\xdf\x83\xff\xde\x05\xff\xfe\xf7\xde\xff\xfe\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x01\xff\xff\xff\xff\x84\xff\xde\x03\xff\xff\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x93\xff\xde\x02\xff\xff\xff\xde\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x82\xff\xdf\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x93\xff\xde\x06\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xff\xff\xdf\x83\xff\xde\x08\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\x82\xff\xde\x07\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xbe\x83\xff\xde%\xff\xbe\xff|\xff\xde\xff\xde\xff\xbe\xf5T\xea&\xf2\x04\xf1\xc3\xf2%\xf2\xc6\xff;\xff\x9d\xff\xbe\xff\x9d\xff\xbe\xff\x9d\xff}\xf6\xb9\xff\xbe\xff\x9d\xff\xbe\xff\x9d\xff\xbe\xfe5\xfb\xa7\xfe\xd8\xff\xbe\xff|\xf6\xd9\xf4\x8d\xfa@\xfa\x81\xfa\x80\xfa@\xfa@\xfa`\xfa\x80\x82\xfa@\x82\xfa`+\xfa\xe0\xfb\x00\xfb`\xfb\x80\xfb\xc0\xfc\x00\xfb\xe0\xfa\xe0\xfa\xe0\xfa\xc0\xfa\xe0\xfa\xa0\xfa\xe0\xfb \xfb@\xfb`\xfb\xe0\xfb`\xfb \xfb \xfb@\xfb \xfb\x00\xfb@\xfb@\xfb\xa0\xfb@\xfb`\xfb\x80\xfb\xa0\xfb\xa0\xfb`\xfb \xfb`\xfc\xc0\xfc\x80\xfc\xa0\xfc\x80\xfc\x80\xfc\xc0\xfd \xfd`\xfd@\xfd@\x82\xfd`\x0e\xfd@\xfd`\xfd`\xfd\xa0\xfd\xa0\xfd`\xfd`\xfd\xa0\xfd\xc0\xfd\xc0\xfd\xe0\xfd\xe0\xf5\xe0\xfe\x00\xfe\x00\x82\xf6 \x05\xee\x00\xee@\xee\x80\xf6\xc2\xf6\xa2\xf6\xc2\x82\xf6\xc3"\xee\xa2\xe6b\xf7\x0f\xf7V\xe6\x06\xdd`\xd5\x80\xcd\x80\xc5\x80\xbd\xa0\xbd\xc0\xbd\xe0\xb6\x00\xad\xe0\x9d\xe2\x96\x02}\xc3\xf7\xbb\xf7\xbc\xf7\xde\xff\xde\xff\xde\xf7\xde\xb6\xf8\xff\xde\xff\xde\xef\xbd\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xc7<N7\xf7\xde\x85\xff\xde\x06\xf7\xde\xef\xbe\x15u\x05\x95\x05t\x05S\x1dT\x86\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x87\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x8f\xff\xde\x07\xff\xff\xff\xdf\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xff\x87\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xff\x83\xff\xde\x03\xff\xdf\xff\xde\xff\xff\xff\xff\x89\xff\xde\x82\xff\xdf\x91\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x91\xff\xde\x05\xff\xbe\xff}\xff\xde\xff\xde\xff\xbe\xff\xdf\x85\xff\xde\x82\xff\xbe4\xf6\x99\xfdR\xfbi\xf3\x07\xfew\xf5\xb4\xff<\xff}\xf4n\xff\x1b\xff\xbe\xff\xde\xf6V\xfe6\xfe5\xff|\xff\x9d\xfa\xc3\xfcj\xff\xbe\xff|\xf7\x1a\xff\x9d\xfaA\xfa\x81\xfa \xfa@\xfa \xfa@\xfa\xa0\xfa@\xfa \xfa@\xfa \xf9\xe0\xfa\x00\xfa@\xfa\xc0\xfa\xe0\xfb \xfb@\xfb\x80\xfb@\xfa\xc0\xfa\xa0\xfa\x80\xfa\x80\xfa\xa0\xfa\xe0\xfb\x00\xfb \xfb \xfb`\x82\xfb\x00\x00\xfa\xe0\x82\xfb\x00\x18\xfb@\xfb\x80\xfb \xfb\x00\xfb`\xfb\x80\xfb`\xfb\x80\xfb`\xfc@\xfc\xc0\xfc\xa0\xfc\xc0\xfc\xa0\xfc\xa0\xfc\xe0\xfd\x00\xfd \xfd \xfd@\xfd`\xfd\x80\xfd`\xfd \xfd \x83\xfd`2\xfd@\xfd\x80\xfd\x80\xfd\xc0\xfd\xc0\xf5\xe0\xdd\xe0\xde \xcd\xe0\xc5\xe0\xce\x00\xde \xd6\x00\xee`\xf6\xa2\xf6\xe3\xf6\xe4\xf6\xc3\xf6\xc3\xee\xc2\xde\x82\xdeA\xde!\xf7U\xf7V\xe6&\xd5\xc1\xcd\xc0\xbd\xc0\xbd\xc0\xb5\xc0\xad\xa0\xa5\xc0\xae\x00\xa5\xc0\x9e\x01\x95\xe2}\xc3\xef\x9a\xef\x9b\xff\xde\xf7\xde\xf7\xde\xff\xde\xef\xbd\xf7\xbd\xef\xbd\x8eu\xff\xde\xff\xde\xff\xfe\x82\xff\xde\x00\xff\xfe\x84\xff\xde\x08\xf7\xde\xff\xde\xff\xdeN8\x05\xb5\x05\x95\x05T\x05t~\x99\x88\xff\xde\x00\xff\xff\x93\xff\xde\x05\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x8a\xff\xde\x00\xff\xfe\x97\xff\xde\x00\xff\xdf\x88\xff\xde\x04\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xff\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x88\xff\xde\x02\xf7\xde\xff\xdf\xff\xdf\x86\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8e\xff\xde#\xff\xff\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xde\xf5\x11\xf2\xc6\xf2e\xfe6\xff\\\xfe\xb9\xe9a\xf3(\xebJ\xf2D\xf5\xd4\xfdQ\xfa\xa3\xfa\xa3\xf3\xea\xf5P\xfab\xfck\xff\x1a\xff\x9d\xfc\xcd\xfaa\xf2\x00\xfa`\xfa`\xfa@\xfa \xfa \xfa\x00\xfa\x00\x84\xfa \x0e\xfa`\xfa\x80\xfa\xc0\xfb\x00\xfa\xa0\xfa\xe0\xfa`\xfa`\xfa@\xfa`\xfa\x80\xfa\xe0\xfa\xe0\xfb\x00\xfa\xe0\x83\xfb\x00\x08\xfb \xfb\x00\xfb@\xfb`\xfb\x80\xfb`\xfb \xfa\xe0\xfa\xe0\x82\xfb`\n\xfb\x80\xfc \xfc\x80\xfc\xc0\xfc\x80\xfc\x80\xfc`\xfc\xa0\xfd\x00\xfd \xfd@\x82\xfd\x80\x01\xfd`\xfd@\x83\xfd`(\xfd\x80\xfd@\xfd\x80\xfd`\xfd\x80\xfd\xa0\xf5\xc0\xdd\xe0\xce\x00\xbe\x00\xad\xc0\xb5\xc0\xb6\x00\xd6\x00\xeeA\xf6\xc3\xee\xc3\xee\xa2\xee\xa2\xd6A\xce@\xce \xc5\xe0\xce\x00\xe6\xc9\xde%\xcd\xe1\xc6\x00\xbd\xe0\xbe\x00\xb5\xe0\xb5\xe0\xb5\xc0\xad\xe0\xad\xe0\x9d\xc0\x9e\x01\x8d\xe1\x8e\x04\xae\x8e\xf7\xbd\x82\xff\xde\x04\xdfZ\xe7\x9c\xff\xde\xff\xde\xf7\xde\x8c\xff\xde\x07\xc7\\6\x15\x05\xb4\x05\xd5\x05\xd5\x05\xb5E\xf7\xf7\xde\x83\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x89\xff\xde\x01\xff\xff\xff\xdf\x86\xff\xde\x01\xff\xfe\xff\xdf\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x02\xff\xff\xff\xff\xff\xdf\x92\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x89\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x86\xff\xde\x05\xff\xdf\xff\xde\xff\x1c\xea\xc9\xebk\xff\x9d\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x8a\xff\xde\x00\xff\xbe\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x1c\xff\x9d\xff\xbe\xeb)\xf1\xc3\xf2\xa7\xfe\xb8\xff\x1b\xf2#\xfa\x03\xfa#\xfa\x02\xf1\xa1\xfd\xb3\xfdP\xfb\x04\xfa\xc3\xfbE\xfa\xe3\xf2!\xf2\x83\xfdq\xf2\x01\xfa\x00\xfa \xfa \xfa`\xfa \xfa\x00\xf9\xe0\x82\xfa\x00\x06\xf9\xe0\xfa\x00\xfa \xfa`\xfa@\xfa \xfa@\x82\xfa`\x02\xfa\x80\xfa@\xfa\x00\x82\xfa\xa0\x15\xfa\xe0\xfb\x00\xfa\xc0\xfa\xc0\xfa\xe0\xfa\xc0\xfb \xfb@\xfb \xfb\x80\xfb\x80\xfb\xa0\xfb`\xfb`\xfa\xe0\xfa\xa0\xfa\xe0\xfb\x00\xfb@\xfb`\xfc \xfc`\x82\xfc\xa0\x01\xfc`\xfc\xa0\x82\xfd\x00\x02\xfd \xfd`\xfd\x80\x82\xfd`\x04\xfd@\xfd \xfd@\xfd \xfd`\x82\xfd\x80\x1a\xfd\xc0\xed\xe0\xd6\x00\xc6\x00\xc6\x01\xb5\xe0\xb5\xe0\xad\xe0\xad\xc0\xbd\x80\xee\xa2\xee\xa2\xe6\xa2\xd6a\xc6 \xc6\x00\xc6\x00\xc5\xe0\xc6\x00\xc6 \xc6 \xc6!\xbe\x00\xbe \xc6 \xc6A\xbe\x00\x82\xad\xe0\x0b\x9d\xc0\x95\xc1\x96\x02\x86\x03m\xc4\xdfX\xf7\xde\xf7\xde\xf7\xbe\xf7\xbd\xf7\xbd\xf7\xde\x8c\xff\xde\t\xff\xdf\xcf\\\r\xb4\x05\x94\x05\xf5\x15\xf6^x\xa6\xfb\xff\xde\xff\xdf\x90\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xff\x8f\xff\xde\x01\xff\xff\xff\xdf\x88\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x8f\xff\xde\x01\xff\xff\xff\xff\x92\xff\xde\x00\xff\xdf\x94\xff\xde\x04\xff\xff\xea\x89\xf1\xe6\xfa%\xf4N\x94\xff\xde\x00\xff\xdf\x85\xff\xde\x18\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\xf3\x8b\xfae\xf2c\xf4\xcf\xfa#\xf9\xe2\xfaC\xfaC\xfa\x02\xf1\xa1\xff\x1a\xfd\xb2\xfc\x08\xfb\x03\xfa\xa2\xfab\xfaA\xfa\x01\xf9\xe0\xfa@\x87\xfa\x00\x82\xf9\xe0\x1c\xfa \xf9\xe0\xfa\x00\xfa\x00\xf9\xc0\xf9\xc0\xf9\xe0\xfa\x00\xfa \xfa\x00\xfa\x00\xfa@\xfa\x80\xfa\xc0\xfa\xe0\xfb\x00\xfa\xc0\xfa\xa0\xfa\xa0\xfb\x00\xfb@\xfb \xfb \xfb\x80\xfb\xa0\xfb\x80\xfb`\xfb \xfb\x00\x82\xfa\xe0\x02\xfb@\xfc\x00\xfc`\x82\xfc\x80:\xfc\xa0\xfc\x80\xfc\x80\xfc\xc0\xfd\x00\xfd \xfd@\xfd@\xfd`\xfd@\xfd \xfd`\xfd@\xfd@\xfd \xfc\xe0\xfd\x00\xfd@\xfd`\xfd\x80\xfd\xc0\xf6\x00\xc6\x00\xc6!\xbe\x00\xad\xe0\xad\xe0\xa5\xe1\xad\xc0\xe6 \xe6@\xe6\x81\xd6b\xc6!\xbe\x00\xbd\xe0\xc6\x00\xc6!\xbe\x00\xc6 \xc6 \xc6A\xc6A\xbe \xc6@\xbe \xb5\xe0\x9d`\x9d\xa0\xad\xe0\xa5\xe0\x9e\x01\x8d\xe2\x85\xe3u\xc4\xdfV\xf7\xde\xff\xde\xf7\xbd\x85\xff\xde\x03\xf7\xde\xff\xfe\xf7\xde\xf7\xde\x84\xff\xde\x08\xff\xff\xc7|\x1d\xd5\r\x93\x1d\xb5\x86\xba\xf7\xde\xff\xde\xf7\xde\x88\xff\xde\x04\xff\xfe\xff\xde\xff\xde\xff\xdf\xff\xff\x84\xff\xde\x00\xff\xfe\x84\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xfe\x86\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xff\xff\x82\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x03\xff\xdf\xff\xff\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\x97\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x87\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xff\x84\xff\xde\x03\xf3l\xf2\x06\xfa\x05\xfb\x8a\x89\xff\xde\x03\xfdS\xf5\x12\xff\xdf\xff\xdf\x86\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x83\xff\xde$\xff\xbe\xf6\x99\xfe\xfa\xff<\xff;\xf2%\xf2C\xf2\x02\xf2\x02\xfaC\xfaB\xfac\xfa"\xf9\xe1\xfbg\xfeV\xfb\xa8\xfa\x82\xfa\x83\xfab\xfa"\xf1\xc1\xf1\xc0\xfa \xfa!\xfa\x00\xfa\x00\xfa \xfa\x00\xfa \xfa\x00\xfa\x00\xf9\xe0\xf9\xa0\xf9\xe0\xfa\x00\xf9\xe0\x82\xfa\x00\x15\xf9\xa0\xf9\xa0\xfa\x00\xfa@\xfa \xf9\xe0\xfa@\xfa`\xfa\xa0\xfa\xe0\xfb\x00\xfa\xe0\xfb\x00\xfa\xe0\xfb\x00\xfb`\xfb \xfb \xfb@\xfb\x80\xfb`\xfb`\x82\xfb \r\xfb\x00\xfa\xe0\xfb@\xfc\x00\xfc\xa0\xfc`\xfc`\xfc\x80\xfc\x80\xfc\xa0\xfc\x80\xfc\xa0\xfc\xe0\xfd\x00\x84\xfd@\x1b\xfd`\xfd@\xfd@\xfd\x00\xfd \xfd\x00\xfd \xfd`\xfd\xa0\xed\xe0\xe6 \xad\xc0\xbd\xc0\xbd\xe0\xb5\xe0\xad\xe0\xa5\xe0\x9d\xe1\xc6\x00\xe6`\xe6\x81\xd6b\xceA\xc6A\xc6!\xbe!\xbe \xc6 \x83\xbe\x00\x10\xbe \xb6\x00\xb6\x00\xad\xe0\xa5\xc0\xad\xe0\xb6\x00\xad\xe0\x9e\x01\x8d\xe2\x8e\x03u\xe3\x86\x08\xae\x92\xff\xde\xf7\xde\xf7\xde\x82\xf7\xbd\x13\xf7\xde\xff\xff\xff\xfe\xef\xbeN\x14\xe7\x9d\xf7\xde\xff\xde\xff\xde\xf7\xde\xff\xde\xbf<\x05\x94^x\xef\xde\xf7\xde\xf7\xde\xff\xfe\xff\xde\xf7\xde\x87\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x86\xff\xde\t\xff\xfe\xff\xde\xff\xde\xe7\\\xf7\x9d\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\x85\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xfe\x84\xff\xde\x00\xff\xff\x84\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x98\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x89\xff\xde\x02\xff\xbe\xff\xbe\xff\xdf\x84\xff\xde\x0c\xff\xbe\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff}\xf3k\xf2\xc8\xfd\x93\xff\xde\xff\xbe\x86\xff\xde\x05\xff\x1b\xf1\xc3\xf1\xa3\xf5s\xff\xbe\xff\xdf\x86\xff\xde"\xff\xdf\xf4\xb0\xf4o\xff\xde\xff\x9e\xff\xde\xff\xbe\xff\xbe\xff\x9d\xff\x1b\xff\x1b\xff\xdf\xf3\x08\xfaD\xfaB\xfa\xa3\xfa\xc3\xfa\xa3\xfa\x83\xfac\xfaC\xfac\xfa\x83\xfa\xa2\xfa\x82\xf2\x01\xfa!\xfa\x01\xf1\xe1\xfa\x01\xf9\xe1\xfa\x02\xfa!\xfa!\xfa \x84\xfa\x00\x11\xf9\xa0\xfa\x00\xfa\x00\xf9\xe0\xfa\x00\xf9\xe0\xfa\x00\xf9\xc0\xf9\xc0\xfa@\xf9\xe0\xf9\xc0\xfa \xfa@\xfa`\xfa`\xfa\xa0\xfa\xc0\x82\xfa\xe0\x0c\xfb\x00\xfb \xfb\x00\xfb`\xfb`\xfb\x80\xfb@\xfb@\xfb\x00\xfb \xfb@\xfb \xfb\x80\x82\xfc *\xfc`\xfc \xfc\x80\xfc\xa0\xfc`\xfc`\xfc\x80\xfc\xc0\xfc\xe0\xfd\x00\xfd \xfd \xfd@\xfd \xfd@\xfd`\xfd \xfd@\xfd@\xfd`\xf5`\xf5\x80\xe5\xe0\xc5\xc0\xbd\xc0\xbd\xc0\xbd\xa0\xbd\xa0\xbd\xe0\xb5\xe0\xad\xc0\xa5\xe0\xad\xe0\xde@\xe6\x81\xde\x81\xde\xa2\xceA\xc6A\xc6b\xbe \xbe\x00\xbe\x00\x82\xb5\xe0\x19\xb6\x00\xb6\x00\xa5\xe1\xa5\xe1\xa6\x01\xa5\xe0\xa6\x01\x9e\x01\x8d\xe2\x85\xe2\x8e\x03\x86\x04m\xa4\xbe\xd1\xf7\xbe\xff\xde\xf7\xde\xef\xbd\xef\x9c\xf7\xbd\xef\xbd\xd7Z\xff\xde\xff\xde\xd7|\xf7\xde\x82\xff\xde\x05\xe7|\xe7\xbe\x1d\xf4nw\xff\xdf\xf7\xde\x9d\xff\xde\x00\xff\xfe\x88\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xff\x83\xff\xde\x07\xff\xff\xff\xde\xff\xdf\xff\xfe\xff\xff\xff\xde\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\x8e\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xff\xfe\xff\xff\x83\xff\xde\x03\xff\xfe\xff\xde\xff}\xf7<\x89\xff\xde\x05\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xf7\xdf\x8a\xff\xde\x06\xf3\t\xf2$\xf4\xd0\xff\xbe\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x06\xf6\x17\xea\xc8\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xbe\x83\xff\xde\x15\xea\xa7\xf1\xe3\xf2\x03\xfa\x83\xfa\xe3\xfa\xc3\xfac\xf1\xe2\xfa#\xfaC\xfa#\xfab\xfab\xf1\xe1\xfa\x01\xf1\xe1\xfa\x01\xf1\xc1\xfa\x01\xf9\xe1\xfa\x01\xf9\xe0\x82\xfa\x00\x82\xf9\xc0\x1a\xf9\x80\xf9\xe0\xf9\xa0\xf9\xe0\xf9\xe0\xf9\xc0\xf9\xe0\xf9\xe0\xfa\x00\xfa \xfa \xf9\xe0\xfa \xfa`\xfa\x80\xfa`\xfa\xa0\xfa\xa0\xfb\x00\xfb\x00\xfa\xc0\xfa\xe0\xfa\xe0\xfb \xfb@\xfb\x80\xfb\x80\x82\xfb@\x04\xfb`\xfa\xc0\xfb \xfb\xe0\xfc\x00\x83\xfc \x04\xfc`\xfc\xa0\xfc\xc0\xfc\xa0\xfc\xa0\x83\xfc\xe0\r\xfd \xfd@\xfd\x80\xfd`\xfd@\xfd\x00\xfd@\xfd`\xfd@\xf5@\xbd\xa0\xb5\xe0\xb5\xc0\xbd\xe0\x82\xbd\xc0*\xb5\xc0\xb5\xe0\xb5\xe0\xad\xe0\xa5\xe0\xce \xd6@\xde\x81\xde\xa2\xd6b\xc6A\xbe\x00\xbe\x00\xc6 \xb5\xe0\xb5\xe0\xad\xe0\xad\xe0\xa5\xe0\xae\x01\x95\xc1\x95\xc1\x9e\x01\x85\xa2}\xc2\x85\xe2u\xa2}\xc3u\xc4}\xe5}\xc7\xef\xbc\xf7\xbd\xef\xbd\xef\x9d\xf7\xbd\xef\x9c\xf7\xbd\xb7\x17\x9e\xd6\xff\xde\xff\xde\xf7\xbe\x82\xff\xde\x03\xf7\xde\x96\xd9\x15\xd3\x8e\xd9\x82\xf7\xde\x95\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x83\xff\xde\x04\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xff\x87\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x82\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x02\xff\x9d\xff\xde\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xf5\x94\xff<\x83\xff\xde\x03\xff\xbd\xff\xde\xff\\\xff\xbe\x85\xff\xde\x00\xff\xbe\x82\xff\xde\x0b\xff\x9d\xfe7\xff\xde\xff\xde\xff\xbe\xff\x9d\xff\xbe\xff|\xfe\xb9\xf67\xf1\x82\xf2#\x82\xfa\x83\x05\xf1\xe2\xe9b\xf1\xe3\xf1\xe2\xfa\x02\xfa\x02\x82\xfa"\'\xfa\x01\xf9\xc2\xf1\xa1\xfa\x01\xf1\xc0\xfa!\xfa \xfa`\xfa`\xfa\x00\xf9\xa0\xf9\xa0\xf9\xc0\xf9\x80\xf9\xc0\xf9\x80\xf9\xa0\xf9\xc0\xf9\xc0\xf9\xa0\xf9\xc0\xf9\xe0\xf9\xa0\xfa\x00\xfa \xfa \xfa@\xfa\x80\xfa`\xfa\xa0\xfa\xc0\xfa\xe0\xfa\xe0\xfa\xa0\xfa\xc0\xfa\xa0\xfa\xe0\xfb\x00\xfb \xfb\x80\x82\xfb@\x13\xfb \xfa\xc0\xfb\x00\xfb\xe0\xfc\x00\xfb\xe0\xfc\x00\xfc \xfc@\xfc \xfc@\xfc\xa0\xfc\xc0\xfc\xe0\xfc\xc0\xfc\xe0\xfd\x00\xfd \xfd@\xfd@\x82\xfd`>\xfd \xf5@\xf5@\xf5`\xed@\xbd\xe0\xad\xe0\xad\xc0\xb5\xe0\xbd\xe0\xbd\xc0\xbd\xc0\xb5\xc0\xbe\x00\xb5\xe0\xa5\xc0\xa5\xe0\xb5\xe0\xceA\xd6\x81\xd6\x82\xc6A\xc6 \xbd\xe0\xc5\xe0\xbd\xe0\xad\xa0\xa5\xc0\x9d\xc1\x95\xc1\x9d\xe1\x8d\xa1\x85\xc2}\xa2u\xa2m\xa3e\xa3e\xa45D=D]\x84\xe7y\xff\xde\xf7\xbd\xf7\xbe\xef\xbd\xf7\xbd\xef\xbd\xef\x9d\xf7\xde\xd7{\xe7{\xf7\xde\xff\xdf\xf7\xde\xff\xde\xf7\xde\xaf\x196\x13\r\x91\xcf|\xf7\xde\xf7\xbe\x9a\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xfe\xff\xff\xff\xdf\x84\xff\xde\x01\xff\xdf\xff\xff\x85\xff\xde\x08\xff\xfe\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xff\x84\xff\xde\x01\xff\xff\xff\xff\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x8a\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x94\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\x9d\xf5\xf6\x85\xff\xde\x00\xff\xbe\x86\xff\xde\x01\xff}\xfe\xb9\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xbe\x83\xff\xde\x0e\xff\xbe\xff\xbe\xff\x9d\xff\xde\xff\xde\xff\x1b\xec\xb0\xfc\xf1\xfe\x99\xff\x9d\xff}\xf6\x16\xfe6\xf1\xc3\xf1\xe3\x82\xfaCC\xf2\x03\xe9\x82\xe9\x82\xf1\xa2\xf1\xc2\xf9\xc2\xfa\x02\xf1\xc1\xf9\xe2\xf1\xa1\xf9\xc1\xf1\xc1\xf1\xa0\xf9\xe1\xfa\x01\xfa@\xfa`\xfa \xf9\xe0\xf9\xc0\xf9\xe0\xf9\xc0\xf9\xe0\xf9\xc0\xf9\xa0\xf9\xe0\xf9\xa0\xf9\xc0\xf9\xa0\xf9\xa0\xf9\x80\xf9\xe0\xf9\xa0\xf9\xe0\xfa \xfa@\xfa@\xfa\x80\xfa\x80\xfa\xe0\xfa\xc0\xfa\xe0\xfa\x80\xfa\xa0\xfa`\xfa\x80\xfa\xa0\xfa\xc0\xfa\xe0\xfa\xc0\xfa\xe0\xfb\x00\xfb\x00\xfb \xfb@\xfb\xe0\xfc \xfc\x00\xfc\x00\xfc \xfc \xfc\x00\xfc \xfc@\xfc\x80\xfc\xc0\xfc\xe0\xfd \x82\xfd@@\xf5`\xdd\x80\xe5@\xf5@\xf5@\xf5`\xf5@\xed`\xe5@\xbd\xc0\xa5\xc0\xad\xc1\xad\xc0\xbd\xe0\xbd\xe0\xb5\xc0\xb5\xc0\xb5\xe0\xb5\xe0\xad\xe1\xa5\xe0\xa5\xe0\xbe!\xceb\xc6B\xc6b\xbe\x00\xb5\xe0\xbe\x00\xbe\x00\xb6\x01\x8d\xc2u\x82\x85\xc3u\x82}\xa3u\x82m\x83m\xa4m\xc4]\xa4U\xa5M\xa5=e\xc7\x14\xf7\xbc\xe7{\xef\x9c\xe7\x9c\xe7{\xf7\xbd\xb6\xd5^\x0f-\xcd\r\x8c-\xce^\x11V\x11\xcf{\xe7\xbd-\xb0\x05\xaf^t\xaf:\xf7\xde\x83\xf7\xbe\x02\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x07\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xff\x8a\xff\xde\x00\xff\xfe\x8b\xff\xde\x00\xff\xff\x96\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xff\x8a\xff\xde\x00\xff\xff\x86\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x06\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xdf\x8d\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x88\xff\xde\x08\xff\xdf\xff\x9d\xff\\\xff\xdf\xff\xde\xff\xbe\xff\xbe\xff\xde\xff\xbe\x88\xff\xde\x02\xff\xbe\xff\xde\xff\xde\x82\xff\xbe\x1c\xfe\x99\xfd\xb4\xfb)\xf5R\xff\x9d\xff;\xf5\x11\xf1\xc3\xf1\xe2\xfa#\xfa#\xf1\xe2\xf1\xc3\xe1"\xe9B\xf1\xa2\xf9\xe2\xf9\xe2\xfa"\xfa"\xf9\xe1\xf9\xc1\xf9\xe1\xf9\xc1\xf1\xa1\xf9\xc1\xf9\xe0\xfa \xfa \x83\xf9\xc0\x10\xf9\xa0\xf9\xe0\xf9\xc0\xf9\xe0\xf9\xe0\xf9\x80\xf9\xa0\xf9\xc0\xf9\x80\xf9\x80\xf9\xc0\xf9\xe0\xf9\xc0\xfa\x00\xfa\x00\xfa \xfa@\x82\xfa\x80\x00\xfa\xa0\x82\xfa\x80\x0f\xfa`\xfa\x80\xfa\xa0\xfb\x00\xfb\x00\xfb \xfb`\xfb`\xfb\x80\xfb\xa0\xfb\xa0\xfc\x00\xfc \xfc\x00\xfc \xfc\x00\x82\xfc \x0b\xfc`\xfc\x80\xfc\xc0\xfd\x00\xfd \xfd\x00\xed`\xd5\x80\xcd`\xdd`\xed@\xed\x00\x82\xed@6\xed`\xb5\xa0\xad\xe0\xb5\xe1\xad\xc0\xb5\xe0\xb5\xe0\xb5\xc0\xb5\xc0\xad\xc0\xad\xc0\xa5\xc0\x9d\xc0\xa5\xe1\xbeA\xbeA\xbeB\xb6"\xa5\xe1\xb6"\xb6B\xb6B}\xc3]cm\xa3m\x84m\xa4m\xa4e\xa4Ud]\x84]\xa5]\xc5U\xa5M\x86Ef\xf7\xbc\xef\x9c\xef\x9c\xe7z\xb6\xf5\xb6\xf5\xc785\xab%\xab5\xcb\x05\x8b\x05\x8c\x05\xac\x05\x8c\x05\x8c\r\x8d\x05\x8d\x05\x8d\xb79\x82\xf7\xde\x02\xdf}\xef\xbe\xf7\xde\x83\xff\xde\x01\xcf|\xbf\x1b\x8b\xff\xde\x03\xff\xfe\xa6\xfb\x86\x9a\xf7\xde\x85\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x83\xff\xde\x04\xff\xfe\xff\xfe\xff\xde\xff\xde\xff\xdf\x87\xff\xde\x00\xff\xfe\x82\xff\xde\t\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xa7\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xff\xbe\x82\xff\xde\x06\xfe\x99\xeb\xcd\xf5T\xff\x9d\xff\xde\xff\xde\xff\xbe\x83\xff\xde\x03\xff\x9e\xff\xde\xff\xde\xff\xbe\x82\xff\xde\x19\xec\x91\xfe\xda\xff\x9e\xf4\xd1\xf2\x05\xf2\x05\xf1\xe4\xf1\xe4\xfd\xf5\xf5\x93\xea\x86\xf1\xa3\xfa#\xf2\x03\xf1\xe2\xf1\xc3\xe9\x82\xe9\x82\xf1\xa3\xf1\xc2\xf9\xc2\xfa"\xfaB\xfa\x01\xfa\x01\xf9\xe1\x83\xfa\x01\x07\xf9\xc0\xf9\xc0\xf9\xe0\xf9\xc0\xf9\xa0\xf9\xa0\xf9\xc0\xf9\xa0\x84\xf9\xc08\xf9\xa0\xf9\xc0\xf9\xa0\xf9\xc0\xf9\xe0\xf9\xc0\xf9\xc0\xf9\x80\xf9\xc0\xf9\xc0\xfa\x00\xfa`\xfa`\xfa\x80\xfa\x80\xfa`\xfa@\xfa`\xfa@\xfa\x80\xfa\x80\xfa\xc0\xfa\xc0\xfb \xfb`\xfb`\xfb\x80\xfb\xe0\xfb\xc0\xfb\xc0\xfb\xe0\xfc\x00\xfc \xfc\x00\xfc`\xfc`\xfc@\xfc@\xfc`\xfc@\xfd\x00\xfd \xf5@\xc5`\xcd`\xd5\x80\xe5@\xe5 \xdc\xe0\xe5 \xed`\xed`\xe5\xa0\xb5\xc0\xb5\xc0\xad\xa0\xad\xc0\x82\xb5\xe0\x14\xb6\x00\xad\xe0\xad\xe0\xa5\xe0\xa5\xe1\xae\x01\xbeA\xbeB\xb6C\xb6C\xa6\x02\xae#\xb6D\x8d\xe4]\x84e\x84]\x84UD]\x84e\x84]\x84\x82]\xa5\x16U\xa5M\xa6=FM\x88\xcf\x15\xbe\xf4~.5h-h%\x88%\x89-\xa9E\xeb\x1d\xaa\r\x8a\x05\x8bFO%\xee\x05\x8c\x05\xae\x05l\rK\xf7\xbe\x83\xf7\xde\x85\xff\xde\x01\xa7\x1b\xdf\x9d\x8b\xff\xde\x06\xef\xbe\r\xb8N:\xff\xdf\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x02\xff\xdf\xff\xdf\xff\xff\x82\xff\xde\x01\xff\xff\xff\xff\x8a\xff\xde\x02\xff\xff\xff\xde\xff\xff\x8c\xff\xde\x00\xff\xdf\x8e\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x97\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xff\xdf\x85\xff\xde\x0f\xff\xdf\xff\xde\xff\xde\xf6\xba\xf3\t\xf1\x84\xf5\x12\xff\x9d\xff\xde\xff\xde\xff\xbe\xff}\xff\xbe\xff\xbe\xff\xde\xff\xbe\x83\xff\xde\x16\xff\x1b\xf5S\xff\xbe\xea\x06\xf2\x05\xf2\x05\xf1\xe4\xf2\x04\xf2$\xf3\xaa\xf3\t\xf1\x82\xf2\x03\xfa\x03\xf1\xe2\xf1\xa2\xe9b\xe9b\xf1\xa2\xf1\xc1\xfa\x02\xf9\xe1\xfa\x01\x82\xfaA\x12\xf9\xe0\xfa\x01\xfa!\xfa\x01\xf9\xc1\xf1B\xf9\x81\xf9\xa1\xf9\x80\xf9\xa0\xf9`\xf9`\xf9\xa0\xf9\x80\xf9`\xf9\x80\xf9\xc0\xf9\xa0\xf9\xc0\x83\xf9\xe0\x1d\xf9\xc0\xf9\xa0\xf9\xa0\xf9\xc0\xf9\xe0\xfa \xfa \xfa@\xfa`\xfa\x80\xfa\xa0\xfa@\xfa@\xfa`\xfa\xc0\xfa\xe0\xfa\xe0\xfb \xfb`\xfb`\xfb\x80\xfb`\xfb\x80\xfb \xfb\x80\xfb\xc0\xfb\xe0\xfb\xe0\xfc`\xfc@\x82\xfc \x11\xfc`\xfd\x00\xfd\x00\xdd@\xbd@\xcd@\xdd@\xdd\x00\xe5 \xe5 \xe5@\xed`\xed`\xc5\xa0\xb5\xa0\xad`\xb5\x80\xb5\xc0\x82\xb5\xe0.\xa5\xe0\xa6\x01\xa5\xe1\xa6\x01\xa5\xe1\xae!\xbeA\xbeB\xbec\xbed\xb6C\xaeC\xa6#m\x84Ud]dMDUdUdUeU\x85U\xa5U\x85M\x85M\xa6E\x86=g5g\x1d&-g-g-\x885\xa8-\xa9%\x89\x1di%\xaa\x15\xaa\x15\x8a\x15\xab-\xed%\xed\r\xad\x05\xad\x05l\x05K\xcf[\x83\xf7\xde\x82\xff\xde\x00\xf7\xde\x90\xff\xde\x02\xcf]\xf7\xde\xff\xff\x94\xff\xde\x01\xff\xff\xff\xdf\x86\xff\xde\n\xff\xff\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x83\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x87\xff\xde\x01\xff\xdf\xff\xdf\x99\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x02\xff\xbe\xff\xde\xff\xff\x86\xff\xde\x00\xff\xdf\x8b\xff\xde\x0e\xff\xbe\xff\xbe\xff\xde\xf5t\xf2\xe8\xf3)\xf4\xf2\xff\x9d\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xbe\x82\xff\xde\x16\xff\xbe\xff}\xfd\xf6\xe9C\xe9\x84\xf1\xc4\xf1\xe4\xf1\xe4\xf2\x05\xe9\xc4\xe9c\xe9\x82\xf1\xa2\xf1\xe2\xf1\xe2\xf1\xc2\xf1\xa2\xf1\x82\xf9\xe2\xf9\xe2\xfa\x01\xfa!\xfa!\x83\xfaa\x12\xfa!\xfa!\xfaB\xf1b\xf1$\xf9#\xf9#\xf9a\xf9`\xf9`\xf1`\xf9\x80\xf9\xa0\xf9@\xf9\x80\xf9\xa0\xf9\x80\xf9\xa0\xf9\xe0\x83\xf9\xc0\x03\xf9\xa0\xf9\xe0\xf9\xe0\xfa \x82\xfa\x00B\xfa \xfa@\xfa@\xfa\x00\xfa`\xfa\xa0\xfa\x80\xfb\x00\xfb\x00\xfb@\xfb@\xfb \xfb`\xfb \xfa\xe0\xf2\xc0\xf3 \xf3`\xfb\xc0\xfc\x00\xfc@\xfc`\xfc@\xfc@\xfc`\xfc\xe0\xfd`\xfd@\xd5 \xbd \xbd\x00\xcd\x00\xd5\x00\xd5 \xd5 \xdd`\xdd`\xe5`\xc5\xc0\xbd\xe0\xb5\x80\xad`\xb5\xc0\xb5\xc0\xb5\xe0\xad\xe0\xa6\x01\xa6\x01\x9e\x01\xa6\x02\x9d\xe1\xae!\xb6!\xb6B\xbec\xb6C\xa6"\x9e\x02}\xc3]\x84MDMdUeUeMeMeM\x85\x82M\x86\x1fE\x865F=\x875\x875g5\x88=\xa85\x885\xa9-\xa9%\x89\x1d\x89-\xaa%\xaa\x1d\xaa\x1d\xcb\x15\xab\x15\xac\r\xac\x05\x8c\x05\x8c\x05,vT\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xde\xf7\xbe\xf7\xbe\x8a\xff\xde\x00\xf7\xbe\x83\xff\xde\x01\xff\xdf\xff\xdf\x88\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x82\xff\xde\x02\xff\xff\xff\xde\xff\xfe\x82\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8b\xff\xde\x02\xff\xff\xff\xdf\xff\xdf\x86\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\x99\xff\xde\x1f\xff\xbe\xff\xbe\xf7\x1b\xff\x9e\xff\xbe\xff\x9d\xfe\xb9\xfe\x98\xf5\x12\xf52\xff\xbe\xff\xde\xff\xde\xff}\xff\xde\xff\xde\xff\xbd\xff\xde\xff\xde\xff\xbe\xfex\xf3\xac\xe9d\xf1\xa4\xf1\xa4\xe9c\xf1\xe5\xe9\xa4\xe9\x83\xe9\x83\xe9\x82\xf1\xc3\x83\xf1\xc2\x04\xf1\xa2\xf1\xa2\xf9\xc1\xfa\x01\xfa!\x83\xfaa\x19\xfaA\xf9\xc0\xfa!\xfa\x03\xf1C\xf9E\xf1\x04\xf0\xc4\xf0\xc3\xf1\x04\xf1#\xf1\x01\xf9A\xf9`\xf1@\xf9@\xf1@\xf9`\xf9\x80\xfa \xfa \xf9\xe0\xf9\xa0\xf9\xe0\xf9\xe0\xfa\x00\x84\xf9\xe0\x15\xfa\x00\xfa@\xfa \xfa \xfa@\xfa \xfa\xa0\xfa\xe0\xfa\xe0\xfb \xfb\x00\xfa\xe0\xfb\x00\xfa\xe0\xfa\xe0\xf2\xe0\xda\x80\xeb@\xfb\xa0\xfb\xe0\xfc`\xfc`\x82\xfc\x80F\xfc\xe0\xfd \xfd\x00\xd5 \xc5@\xbd \xc5`\xcd@\xcd \xd5 \xe5\x80\xdd\x80\xd5\xa0\xad\xc0\xbd\xe0\xad\xa0\xad\x80\xad\xc0\xad\xc0\xad\xe0\xad\xe1\xa6\x01\xa6\x01\x95\xe1\x9e\x02\x9e\x02\x9e\x01\xae\x01\xb6B\xa6\x02\x95\xe1\x95\xc2\x96\x03m\xa3e\xa4]\x85MDMEMeMeU\xa6MeEfEfM\x86Ef=\x87-g%G%g=\xa85\x88=\xa85\xa9%\x89\x1d\x89\x15i\x1d\x89-\xca%\xab\x1d\xab\x1d\xab\r\x8c\x05\x8c\x05\x8d\x05l\x15n\xbf9\xf7\xde\xef\x9d\xf7\xbe\x84\xff\xde\x01\xef\xbe\xf7\xbe\x90\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x89\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xff\x9a\xff\xde\x02\xff\xdf\xff\xff\xff\xdf\x8d\xff\xde\x03\xff\xff\xff\xff\xff\xde\xff\xdf\x83\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8c\xff\xde\x01\xff\xbe\xff\xbe\x84\xff\xde\x1b\xff\x9d\xff\xbe\xff\xde\xfex\xf3J\xf2\xc8\xfe\x99\xff\xbe\xff\x1b\xff\x9d\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\x9d\xff}\xfex\xf2F\xf2\x04\xf1\xc4\xe9\x84\xe9\x84\xf1\xe5\xf1\xa4\xe9\x83\xf1\x83\xf1\xc3\xe9\x82\x82\xf1\xa2!\xf1\x82\xf1\x82\xf1\xa2\xfa\x01\xfaA\xfa\x82\xfaa\xfa\x81\xfa\xa2\xfa!\xfa\x01\xf9\xe2\xf9\x83\xf1D\xf1\x04\xf1\x04\xf9$\xf1\x04\xf1\x04\xf1%\xf1%\xf1\x04\xf1\x04\xf9$\xf1$\xf1\x03\xf9\x80\xf9\xc0\xf9\xe0\xf9\xc0\xf9\xe0\xf9\xe0\xfa\x00\xf9\xa0\x82\xf9\xc0\x16\xfa\x00\xf9\xc0\xf9\xe0\xfa\x00\xf9\xe0\xfa\x00\xf9\xe0\xfa \xfa@\xfa\x80\xfa\xc0\xfa\xe0\xfb\x00\xfa\xe0\xfb\x00\xfb\x00\xfa\xe0\xf2\xc0\xea\xa0\xc2\xa0\xdb\x00\xfb\xe0\xfc \x83\xfc`\x14\xfc\x80\xfc\xc0\xfd \xf5\x00\xd5 \xc5@\xc5`\xbd\x80\xcd\x80\xdd`\xdd`\xdd\xc0\xc5\xe0\xb5\xc0\xa5\xc0\xa5\xc1\xad\xc0\xa5\xa0\xa5\xc1\xa5\xc0\xa5\xc0\x82\x9d\xe1.\x9e\x02\x9e\x02\x9d\xe1\xa6\x01\x9d\xe0\xa6\x01\x9d\xe1\x9e\x02\x9e#}\xa3u\xa4m\xa4e\xa5]\xa5EEMeMfU\x86M\x85Ef=fE\x87=f5G-G\x1d\'-g-h5\xa8-\x88-\xa9\x15i%\x8a%\xaa\x1d\x89%\xaa%\xcb%\xcb\r\xac\r\xac\x05l\x05\x8d\x05,\x9e\xb7\xf7\xde\xf7\xde\xff\xde\x82\xf7\xde\x04\xff\xde\xff\xde\xf7\xbe\x8e\x99\xef\x9d\x83\xff\xde\x00\xf7\xde\x94\xff\xde\x02\xff\xff\xff\xde\xff\xff\x93\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x84\xff\xde\x05\xff\xff\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\x97\xff\xde\x00\xff\xdf\x95\xff\xde\x00\xff\xbe\x84\xff\xde\x00\xff\xbe\x83\xff\xde\x00\xff\xbe\x82\xff\xde\x00\xff\x9e\x82\xff\xde\x10\xff\xbe\xff\xbe\xfe\xda\xf2\xe9\xe9\xc5\xe9\x85\xe9\x84\xf2\xe9\xf3\x8b\xfe\x98\xff\xbe\xff\xde\xff\x9d\xff\xbe\xfe\xda\xf2\x86\xf2\x04\x82\xf1\xa4\x0e\xe9\x84\xe9c\xe1#\xe9c\xf1\x83\xe9b\xe9c\xe9B\xf1\x83\xf1b\xf1\x82\xf1\xa2\xf1\xc2\xfa!\xfaA\x82\xfa\x82\x12\xfa"\xfa"\xf9\xe2\xf1\x83\xf1$\xf1%\xf9$\xf9$\xf9\x05\xf1\x05\xf1%\xf1%\xf9%\xf0\xe4\xf9$\xf1$\xf1c\xf9\xa0\xf9\xa0\x82\xf9\xc0\x08\xf9\xa0\xf9\xc0\xf9\xa0\xf9\xc0\xf9\xe0\xf9\xe0\xfa\x00\xf9\xe0\xf9\xe0\x83\xfa\x00\x08\xfa \xfa`\xfa\xc0\xfa\xa0\xfa\xe0\xfa\xe0\xfa\xa0\xf2\xc0\xfa\xe0\x82\xf2\xe0P\xda\xe0\xf3`\xf3\xa0\xfc \xfc`\xfc\xa0\xfc\x80\xfc\x80\xfc`\xfc\xa0\xfd \xf4\xe0\xe5@\xcd@\xc5@\xc5\x80\xc5`\xc5\x80\xa5@\xad\xc1\xa5\xe1\xad\xe0\x9d\xc1\x9d\xc1\x95\xa0\xa5\xe1\x9d\xa0\x9d\xa0\x9d\xc1\x95\xc1\x95\xc1\x9d\xe1\x9e\x01\x9d\xe1\xae\x01\xa6\x00\xa5\xe0\xae!\xa6"\x95\xe1\x96\x03\x85\xe3u\xa4e\x84MD=F%\x065&=F-\x05=E=F=F-&=g5G-G\x1d\'%H%h%\x88%h%\x89%\x8a-\xaa\x1d\x8a-\xaa%\xaa%\xaa\x1d\xab\x1d\xac\x05k\r\x8c\x05+E\xd0\xef\xbd\xf7\xbe\xc7<\xd7|\xf7\xbe\xf7\xde\x83\xff\xde\x00\xf7\xbe\x85\xff\xde\x02\xff\xdf\xf7\xde\xef\xbe\x93\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x04\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\x84\xff\xde\x00\xff\xff\x8c\xff\xde\x82\xff\xff\x03\xff\xde\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x8a\xff\xde\x01\xff\xff\xff\xdf\x8b\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x83\xff\xde\x04\xff\xbe\xff\xde\xff\xdf\xff\xde\xff\xdf\x8c\xff\xde\x00\xff\xdf\x86\xff\xdeE\xff\\\xff\xde\xff\xbe\xff\x9d\xff}\xff\xbe\xff\xde\xff\xde\xff\xbe\xf5\xb6\xea\x07\xe9\xc6\xe9\xa5\xf1\xe6\xf2g\xf4\x90\xff\x9d\xf6\x99\xff\x1b\xff}\xf5\xb5\xf2F\xf1\xe4\xf1\xa4\xf1\xa5\xf1\x84\xf1\xa5\xe9d\xe9#\xe9c\xe9c\xf1\x83\xe9c\xf1\x83\xf1\x83\xf9\xa3\xf1\xa2\xf1\x82\xf1\xa2\xf9\xe1\xfaA\xfa\x81\xfaA\xfaB\xfa\x02\xfa\x02\xfa"\xf9c\xf9d\xf9D\xf1\x04\xf9\x04\xf0\xe4\xf0\xc4\xf0\xe5\xf1%\xf1\x05\xf0\xe4\xe8\xa3\xf1\x03\xf9\xa0\xf9\x80\xf9\x80\xf9\xa0\xf9\xc0\xf9\xa0\xf9\x80\xf9\x80\xf9\xa0\xf9\xa0\x85\xf9\xc0\x13\xf9\xe0\xf9\xe0\xfa\x00\xfa \xfa\xa0\xfa\x80\xfa\xa0\xfa\x80\xfa\xc0\xea@\xea\xa0\xea\xc0\xea\xc0\xf2\xe0\xea\xc0\xeb\x00\xf3\x00\xfb\xa0\xfb\xe0\xfc\x00\x82\xfc`6\xfc\x80\xfc\xa0\xfc\xc0\xf4\xc0\xf5 \xed \xc5@\xbd\x80\xb5\xa0\x9d\xc1\x95\xc2\x85\xa1\x85\x81\x8d\xa1\x95\xc1\x8d\xa1\x95\xa1\x95\xc1\x95\x80\x9d\xa0\x9d\xc1\x9d\xc1\x95\xc1\x9d\xe1\xa6\x01\xa5\xe1\xae\x01\xa6\x00\xae\x00\xae!\xa6\x01\x9e\x02\x96\x02\x8e\x03u\xc5Me%\x06\x14\xe6\x0c\xc6\x0c\xa6\x0c\xc6%\x065F-&$\xe6%\x06-\x06%&\x14\xe7\x0c\xe7\x04\xc8\x15(\x15I\x1dI\x15I\x82\x1dj\x1c\x1di%\x8a%\xab%\xab\x1d\xab\x15\x8c\r\x8c\r\x0c\xe7\x9d\xef\xbe\xf7\xdeU\xf6\x86x\xef\xbe\xf7\xbe\xff\xde\xf7\xde\xff\xdf\xff\xde\xf7\xde\xef\xbeM\xf7\x15u\x86\x99\xff\xdf\xff\xde\xff\xde\xe7\xbe\xe7\x9e\x95\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\xa7\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xdf\xff\xdf\x90\xff\xde\x00\xff\xff\x82\xff\xde\x04\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xde\x82\xff\xdf\x82\xff\xde\x06\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xbe\xff\xbe\xff\x9e\x86\xff\xde\x03\xf6\x99\xff|\xff\xdf\xff<\x82\xff\xde\x17\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xed\xb6\xe9\x85\xe1d\xf1\xe6\xe9\xe6\xfd\x12\xf5\xf6\xff\x9d\xff\x9e\xff\x1b\xec\x0e\xe9\x84\xf1\x84\xe9\x84\xe9d\xf1\xa5\xe9d\xe1\x02\x82\xe9c\x16\xf1c\xf1c\xe9c\xf9\xa3\xf1\x83\xf1b\xf1b\xf9\xa2\xf9\xe1\xfa!\xfaA\xfa\x01\xf9\xe2\xfa\x02\xf9\xe2\xfa\x02\xf9\x83\xf9\xa4\xf9D\xf9D\xf9$\xf0\xc4\xf0\xe4\x84\xf0\xc4\x02\xf0\xe2\xf9\x80\xf9\x80\x82\xf9\xa0\x85\xf9\x80\x84\xf9\xc0/\xf9\xe0\xfa\x00\xf9\xe0\xfa\x00\xfa\x80\xfa\x80\xfa\xa0\xfa\xa0\xfa\x80\xf2\xa0\xea\x80\xe2\xa0\xf2\xe0\xea\xc0\xea\x80\xf3\x00\xfb \xfb`\xfb\xa0\xfb\xe0\xfb\xe0\xfc\x00\xfc`\xfc\xa0\xfc\xa0\xf4\xe0\xec\xe0\xdd`\xad`\xad\x80\x9d\xa1\x95\xa1\x8d\xa1\x85\xa2}\x81\x85\xc2\x85\xa1\x85\xa2}\xa2}\x81\x8d\xa1\x8d\xa1\x95\xc1\x95\xc1\x8d\xa1\x8d\xa1\x95\xa0\x9d\xe1\x82\xa5\xe07\xae\x00\xae!\xae!\xa6!\x9e#m\xa5%\x05%\x05\x14\xc6\x14\xc6\x1c\xc6\x1c\xc6$\xe6%\x06%\x07%\x07\x1c\xe6\x1c\xe7\x1d\x07\x1d\x07\x04\x87\x04\xa8\x04\xc8\x04\xc8\x04\xe9\x04\xe9\x05\n\rJ\rJ\x1d\x8b%\x8a\x1d\x8a\x1d\xab\x1d\xab%\xcc\r\x8c\x05l\x1dn\xef\xbd\xef\xbd\xd7\\\xf7\xbe\xef\xbe\xef\xbe\xff\xde\xf7\xbe\xff\xde\xcf}\xf7\xde\xef\xbeE\xd6\x05u\x05v5\xb6\xff\xde\xff\xdf\x82\xff\xde\x00\xf7\xde\x98\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x07\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xff\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x8d\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8c\xff\xde\x04\xf5\x94\xf6\x16\xff\xde\xff\xbe\xff\xbe\x86\xff\xde\x0e\xff\xbe\xff\xbe\xf4\x0f\xe1$\xe1e\xe9e\xf2\x06\xe9\xc5\xd9\x84\xec\x0e\xfe\x17\xf2\xea\xe1D\xe9\x84\xe9\x84\x82\xe9d.\xf1\x84\xe9C\xe9C\xe9c\xe9c\xe9B\xe9c\xf1c\xf1\x83\xf1b\xf1\xa2\xfa\x02\xfa\x01\xfa!\xf9\xe0\xf9\xa1\xf9\xe1\xf9\xa2\xf9\x82\xf9\x82\xf9\xa3\xf9\x83\xf9d\xf9d\xf1\x04\xf0\xe4\xf0\xc4\xf0\xc4\xe8\xa4\xf0\xe4\xf0\xc3\xe8\xa2\xf1!\xf9`\xf9\x80\xf9`\xf9`\xf9\x80\xf9`\xf9`\xf9\x80\xf9\xa0\xf9\x80\xf9\xa0\xf9\xa0\xf9\xc0\xf9\xa0\x83\xf9\xc0\n\xf9\xe0\xfa\x00\xfa@\xfa@\xfa\x80\xfa\xc0\xfa\x80\xea`\xf2\xa0\xe2\xa0\xf2\xe0\x82\xf3\x00\x18\xfb \xf3 \xf3\xa0\xfb\xe0\xfb\xe0\xfc \xfc@\xfc\xa0\xf4\xa0\xf4\xa0\xed\x00\xadae\x01\x8d\x81\x8d\x80\x8d\xa1\x85\x81}\x81\x85\xa1}\x81u\x81u\x82}\xa2\x85\xa2\x85\xa2\x83\x8d\xa2\x01\x8d\xa1\x95\xc1\x82\x9d\xc06\xae\x00\xae\x00\x95\xa0\xaeA\x95\xe2Ud=E-%%\x05$\xe6=%MfMf=&-\x06-\'-\'%\x07\x1c\xe7\x1d\x07\x14\xe8\x0c\xc8\x04\xa8\x04\xc9\x04\xe9\x05\t\x05\n\x04\xea\x05*\x05K\rK\x15\x8b\x1d\x8b%\xab\x15\xac\x15\x8c\x05l\x05l=\xd2\xe7\x9d\xef\xbe\xdf\\\xf7\xde\xe7\x9d\xef\xbe\xf7\xde\xf7\xde\xe7\x9dv\x995\xd7^X>\x17\x05U\x055\xbf<\x94\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\xbf\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x88\xff\xde\x04\xff\xff\xff\xde\xf7<\xdc\x12\xff\x9e\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xdf\xf4\xb1\xfe\xb9\x84\xff\xde\x05\xff\xbe\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\x82\xff\xbe\x83\xff\xde\x82\xff\xbe3\xff\xde\xff}\xff\\\xf5\xb5\xeah\xf2\xa8\xf1\xe5\xe9\xa4\xf1\xc5\xe9\x84\xe9\xa4\xe9D\xe1D\xe1#\xe1$\xe1$\xe1#\xe1C\xe9c\xe9\x84\xe9#\xe9c\xf1\x83\xf1\x84\xf1B\xe9B\xf1B\xf1\x82\xf9\xc2\xfa\x02\xfa\x01\xfa\x01\xf9\xc1\xf9\xa1\xf9\x81\xf1B\xf9b\xf9\x83\xf9\xa3\xf9\x83\xf9\x84\xf9d\xf1$\xf0\xe4\xf0\xc4\xe8\xa4\xe8\xa4\xe8\xc3\xe8\xc3\xe8\xc2\xf1\x01\xf1`\x83\xf9`\x01\xf9@\xf9`\x82\xf9\x80\x83\xf9\xa0\x84\xf9\xc0\x1e\xfa\x00\xfa \xfa`\xfa@\xfa\x80\xf2`\xf2\xa0\xf2\xa0\xf2\xc0\xf2\xe0\xf2\xe0\xfb\x00\xfb \xfb@\xf3@\xfb\xa0\xfb\xe0\xfc\x00\xfc\x00\xf4@\xf4\xc0\xcd\x00\xc4\xe0u\x00e\x01mB}a\x8d\x81\x95\xc1\x8d\xa1}\x82\x83}\xa2\x01\x85\xa2\x8d\xc2\x82\x85\xa2>\x85\x81\x85\x81\x8d\xa1}`\x8d\xa1\x9d\xe1\xae\x00\xae\x00\xae\x01\xa6\x01\x95\xe1\x85\xc3m\xa4Ef5F-\x05EfMfEFEf5&-\x07%\'%\x07\x1d\x07\x1d\x08\x14\xe8\x14\xe8\x0c\xc9\x04\xa9\x04\xa9\x04\xc9\x04\xea\x05\n\x04\xca\x05+\x05K\x05K\rk\r\x8c\x15\xac\x15\xac\r\x8d\x05L=\xd0\xf7\xbe\xef\xbd=\xd4\xcf\\\xf7\xbe\xf7\xbe\xef\xbe\xf7\xde\xdf\x9d\xd7|F\x18\x05U\x05v>\x18\xa6\xfb\xc7]\xf7\xde\xff\xdf\x82\xff\xde\x02\xf7\xbe\xff\xde\xf7\xbe\x85\xff\xde\x00\xff\xfe\x84\xff\xde\x04\xff\xff\xff\xdf\xff\xde\xff\xfe\xff\xdf\x85\xff\xde\x00\xff\xff\x85\xff\xde\x01\xff\xfe\xff\xdf\x83\xff\xde\x01\xff\xff\xff\xff\x82\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x02\xfe\xfb\xdal\xed\x96\x83\xff\xde\x03\xff\xbe\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x05\xf5S\xf4\xd0\xff\xbe\xff\xde\xff\xde\xff\xbe\x82\xff\xde\x02\xff\xbe\xff<\xff\xbe\x82\xff\xde\x01\xff\xbe\xff\x9e\x85\xff\xbe=\xff\xdf\xf68\xfe\xba\xf5T\xff}\xf4O\xe9\x84\xf1\xe5\xe9\xc5\xf1\xe6\xe9\x84\xe9\xa5\xe9\x85\xe1D\xe1D\xe1C\xe9d\xe9C\xe9C\xe9c\xf1c\xf1\x84\xf1c\xf1\x83\xe9C\xf1C\xe8\xe2\xe9"\xf1\x82\xf9\xc2\xf1\xa1\xf1\x81\xf1A\xf1A\xe8\xc2\xf0\xe1\xf9b\xf9\x83\xf9\xa3\xf9\x83\xf9C\xf1$\xf1$\xe8\xc3\xe8\xc4\xe8\xa4\xe8\xa4\xe8\xc3\xf1\x01\xf1 \xe9 \xe9 \xf1@\xf9@\xf9`\xf1@\xf1 \xf9`\xf9`\xf9\x80\xf9`\xf9\x80\x82\xf9\xa0\x83\xf9\xc0\x82\xf9\xe0d\xfa@\xfa@\xfa`\xfa\x80\xfa\xa0\xf2\x80\xfa\xc0\xfa\xe0\xf2\xe0\xfb\x00\xf3\x00\xf3 \xf3 \xfb\xc0\xfb\xe0\xfc\x00\xfc \xcc@\x9d u@e!]!]!mA\x85\x81\x95\xa1\x95\xa0\x95\xc1\x8d\xc1\x8d\xc2\x85\xa1\x85\xa2\x8d\xc2\x8d\xc2\x85\xa2\x85\xa2}\xa2}\x82\x85\xa2\x85\xc2\x85\xc2\x8d\xc1\x85\xc1u\x81\xa6\x01\xa6\x00\xa6\x01]DUd=%Ef-&5&M\x86U\x86M\x86=F\x14\xc7\x1c\xe7\x1d\x07\x1d\x08\x14\xe8\x1d\x08\x15\x08\x0c\xe8\x14\xe9\x0c\xc9\x04\xa9\x04\xc9\x04\xaa\x04\xca\x05\n\r+\x05\x0b\x05\x0b\x05L\x05l\r\x8d\x05m\r\x8d\r\x8d\x05,\x15M\xd7;\xdf|M\xf4\xd7|\xef\xbe\xef\xbe\xf7\xde\xf7\xbe\xe7\x9d\xa7\x1b\x05u\r\x14M\xd7\xf7\xde\xf7\xbe\xff\xde\xf7\xde\xf7\xde\xa1\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xff\x91\xff\xde\x00\xff\xfe\x8d\xff\xde\x00\xff\xff\xa1\xff\xde\x00\xff\xbe\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x82\xff\xde\x00\xff\xbe\x85\xff\xde\x00\xff\xdf\x83\xff\xde\t\xff\xbe\xff\xbe\xff\x9e\xff\xbe\xff]\xff}\xff\x9d\xff\\\xf54\xf5\xd6\x82\xff\xbe4\xfe\x99\xea\x06\xf2\x06\xe9\xc5\xe9\xe5\xf1\xe5\xe9\xa4\xe9\x84\xe1C\xe9d\xf1\xa4\xe9c\xf1\x84\xe9#\xe9C\xe0\xe3\xf1\x84\xe9C\xe9#\xe9#\xe9\x03\xe8\xe3\xf9\x83\xf9\xa2\xe9\x02\xe0\xc3\xe0\xc3\xe8\xc3\xe8\xc3\xe8\xe3\xf1#\xf9c\xf1B\xf9c\xf1#\xf9D\xf9\x04\xe8\xc3\xe8\xa3\xe0\x83\xe0\x82\xe8\xe1\xf1 \xf9`\xf1@\xf1@\xf1 \xf9@\xf9`\xf9`\xf1@\xf9@\xf9`\x83\xf9\x80\x84\xf9\xa0*\xf9\xc0\xf9\xc0\xf9\xe0\xfa \xfa@\xfa@\xfa`\xfa`\xfa\x80\xfa\x80\xfa\xa0\xfa\xc0\xf2\xc0\xf2\xc0\xea\xc0\xf3 \xf3 \xfb\xa0\xfb\xc0\xf3\xc0\xeb\xe0\x8c\xc0]\x00L\xe1M\x01UBebeb\x85\xa1\x9d\xc0\x9d\xc0\x95\xc1\x8d\xc1\x8d\xa1\x85\xa1\x8d\xc2\x8d\xc2\x85\xc2\x85\xa2}\x82u\x82u\x82mb\x82u\x82!ebMCu\x82\x95\xe1MD5%-\x05-&\x1c\xc6\x0c\xc65\'EfEFEF5\'\x14\xe7\x14\xe7\x1d\x08\x15\x08\x0c\xe8\x15\x08\x15\t\x15\t\x0c\xe9\x04\xa9\x04\xa9\x04\xaa\x04i\x04\xca\x04\xcb\x04\xeb\x04\xec\x05,\x05L\x82\x05m\x1d\x05\x8e\x05n\x05M\x1d\xb0V4\xe7|\xe7|\xb7\x1a\xf7\xbe\xef\xbe\xef\xbe\xdf\x9d\xe7\xbeN\x17\x9e\xfa\xef\xde\xf7\xde\xe7\x9e\xae\xdb\xef\x9e\xf7\xde\xf7\xbe\xd7\x9e\xf7\xde\xff\xde\xff\xde\xff\xdf\xff\xde\xf7\xde\xc7=\x83\xff\xde\x01\xff\xfe\xff\xfe\x93\xff\xde\x01\xff\xff\xff\xff\xa7\xff\xde\x08\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x8f\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xf7<\x92\xff\xde\x07\xff\xfe\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xbe\x83\xff\xde\x83\xff\xbe\x00\xff\x9e\x82\xff\xbe\x16\xff\x9d\xff\x9e\xff\xbe\xff\x9d\xff\xbe\xf53\xe9\xc5\xe1d\xf2\x05\xf1\xe5\xf1\xc4\xe9\xa4\xe9c\xe9\x83\xf1\xa4\xf1\xc4\xf1\x84\xe9C\xe9\x03\xe9\x03\xe0\xe3\xe0\xe3\xe8\xe3\x83\xe9\x03\x16\xf1c\xe0\xc3\xe0\xa3\xe0\xa4\xe0\xc4\xe0\xa3\xd8b\xe8\xc3\xf1\x02\xf1"\xf1#\xf1$\xf1$\xf9$\xe8\xc4\xe8\xc4\xe0\x83\xe8\xe0\xe8\xe0\xf1 \xf1@\xf1 \xf1 \x82\xf1@\x01\xf9\x80\xf9`\x83\xf1@\n\xf9\x80\xf9\xa0\xf9\xa0\xf9\xc0\xf9\xc0\xf9\xa0\xf9\xe0\xf9\xc0\xf9\xa0\xfa\x00\xfa@\x82\xfa \x01\xfa@\xf2`\x82\xfa\xa0&\xf2\xc0\xf2\xe0\xea\xe0\xf3\x00\xfb`\xfb\xc0\xf3\xc0\xf3\xc0\xbc@d\xe0L\xe1<\xe1E"E#E"MCMC\x8d\xa0\x95\xc1\x95\xc1\x8d\xa1\x8d\xc1\x8d\xc2\x95\xe3\x8d\xc2}\x82}\x82u\x82ub}\x82u\x82eb]C]C]cE#EDED=E\x82=F\n\x1d\x06\x0c\xc7\x1d\x07\x1d\x07\x14\xe7-\'5\'\x1d\x08\x1d\x08\x1d(\x15)\x83\x15\t+\x0c\xc9\x04\xc9\x04\xaa\x04\xaa\x04\xcb\x04\xab\x04\xcb\x04\xcc\x04\xab\x05-\x05M\x05M\x05\x8e\x05\x8e\x05n\x05\x8e\x05o\x05O\x050\x86\x97\xd7|\xb7\x1a=\xb4\rR\x15\x94^W%\xb5nY\xf7\xde\xff\xde\xf7\xbe\xef\xbe\xc7<\xef\xbe\xf7\xde\xd7\x9e\x05x\xb7\x1c\xff\xde\xff\xde\xf7\xde\xff\xde\xdf\x9e\x8e\xbb\x84\xff\xde\x00\xff\xdf\x87\xff\xde\x04\xff\xff\xff\xde\xff\xff\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xff\x82\xff\xde\x01\xff\xfe\xff\xdf\xb2\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xff\x9c\xff\xde\x06\xff\xbe\xff\xde\xff\xbe\xff}\xf6\xba\xff\xbe\xff\xde\x82\xff\xbe*\xff\x9d\xff\x9d\xff\xbe\xff<\xf4\xf2\xe1\x84\xe9\xa4\xf2&\xf2\x05\xf1\xc4\xe9\x83\xf1\xe4\xf1\xa4\xe9\x83\xe9\x83\xf1\xa4\xe9D\xe9\x03\xf1D\xe9$\xe8\xe3\xe8\xe3\xe9\x03\xe9\x03\xe8\xe3\xe8\xe3\xf1$\xe0\xc4\xd8c\xd8\x83\xe0\xa4\xd8\x83\xe0\xa3\xf1\x04\xf1\x03\xf1#\xf9$\xf1\x03\xf1\x04\xf1\x04\xe8\xc4\xe8\xc3\xe8\xe0\x82\xe9\x00\x03\xf1@\xf1 \xf1@\xe9 \x84\xf1@\x03\xf9@\xf1@\xf1@\xf9`\x82\xf9\x80\x05\xf9\xa0\xf9\xa0\xf9\xc0\xf9\xc0\xf9\xe0\xf9\xe0\x82\xfa\x00\x00\xfa \x82\xfa`\x13\xfa\x80\xf2\x80\xfa\xc0\xf2\xc0\xf2\xe0\xf3\x00\xfb`\xfb\x80\xf3\xa0\xeb\xc0\xb4`T\xe0<\xe1E\x02E"=#5\x035#ECUc\x84\x85\xa1\x07\x85\xc2\x8d\xc2\x85\xc2}\xa2\x85\xa2}\xa2mbm\x83\x82]c\x0eMDMdMD=$=E=F=F-&%\x07\x14\xc7\x04\xa7\x04\x87\x04\xa7\x0c\xc7%(\x82\x1d(\x11\x1d)\r\t\x15*\r\t\x15\t\x0c\xc9\x04\xa9\x04\xaa\x04\xab\x04\xcb\x04\x8b\x04\xac\x04\xcc\x04\xcc\x05\r\x05.\x05\r\x05N\x83\x05o\x0c\x05O\x05O\x05p\x1d\xb2\x15Q\x05Q\x05r\x05s\x1d\xd5\xbf<\xf7\xde\xff\xde\xff\xde\x85\xf7\xde\x04\xa7\x1c\xff\xde\xff\xde\xf7\xbe\xf7\xde\x86\xff\xde\x01\xcf~\xe7\xbe\x8d\xff\xde\x00\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x83\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xff\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\x9d\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xbe\x83\xff\xde\x00\xff\xbe\x8a\xff\xde3\xff}\xf6x\xff\x1b\xff}\xff\xde\xfe\xfb\xf6\x99\xff\xbe\xf6\x99\xf6\xb9\xff}\xf2\xe9\xe1\x84\xe9\xa4\xe9\xa4\xf1\xc4\xe9\xa4\xe9\xa4\xf1\xa4\xf1\xa4\xe9\x83\xf1\xa4\xe9c\xe0\xe3\xe1\x04\xe9$\xe9$\xe9\x04\xe8\xe3\xe8\xe3\xe9\x04\xf1\x04\xe8\xe3\xe8\xc3\xe0\xc4\xd8d\xd8\x84\xe0\xa4\xe0\x83\xe8\xa3\xe8\xc4\xe8\xa3\xf0\xe3\xf0\xe3\xf1\x03\xf0\xe3\xe8\xc3\xf1\x04\xf1\x02\xf1 \xf9@\xf1 \x84\xf1@\x16\xe9 \xe9 \xe9@\xf1`\xf9`\xf9`\xf9@\xf1@\xf9`\xf9\x80\xf9`\xf9\x80\xf9\x80\xf1`\xf9\x80\xf9\xa0\xf9\xc0\xf9\xc0\xe9\x80\xe9\xc0\xf2\x00\xfa@\xfa@\x82\xf2@\x00\xf2`\x82\xf2\xc0\x1b\xf2\xe0\xfb`\xf3@\xf3`\xeb\xa0\xcb\xc0\x8c`\\\xa1L\xc1E\x02=#5$-\x045$-\x04ECmb}\xa2}\x81\x85\xa2}\xa2}\xa2u\x81}\xa1}\xa2e\x82]cMC\x82MD&EDMDMDEE5%5&-&\x1d\x06\x1c\xe7\x0c\xc7\x0c\xa8\x04\xa8\x04\xa8\x15\x08%H%H\x1d)%I\x15)\x15\t\r\t\r\t\r\n\x0c\xea\x04\xca\x04\xaa\x04\xab\x04\xac\x04\xac\x04\x8c\x04\x8c\x04\xed\x04\xed\x05.\x05.\x05O\x05p\x05o\x05\x90\x82\x05p\x14\x05\xb1\x05\x91\x05q\x05r\x05r\x05\x93^V\xe7\x9d\xf7\xde\xf7\xde\xff\xde\xf7\xde\xf7\xde\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xde\xff\xde\xf7\xbe\xf7\xde\x86\xff\xde\x03\xbf]\x05y\r8\xf7\xde\x82\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xde\x82\xff\xdf\x98\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xfe\x8f\xff\xde\x01\xff\xdf\xff\xff\x8b\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x8d\xff\xde\x04\xff\xbe\xff\xde\xff\xde\xff\xdf\xff\xdf\x85\xff\xde\x05\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xdf\xff\x9d\x82\xff\xbe\x1d\xff\xde\xff\xde\xff\xbe\xf5\xd6\xeaF\xf2\x04\xf1\xc4\xe1c\xeb\xcd\xea\xea\xe1\xa5\xec\xb1\xff]\xf6\xda\xeb\x8c\xe1\xc5\xe9\xc5\xe9\xc5\xe9\xa4\xf1\xc4\xe9\xa4\xe9\xa4\xe9\x84\xf1\xa4\xe9\x83\xf1\xa4\xf1\xa5\xe9$\xe9\x05\xe8\xe5\x86\xe8\xe4\x07\xe8\xc4\xe8\xa4\xd8c\xd8c\xe8\xa4\xe0\xa3\xe8\xa3\xe8\xc3\x82\xe8\xa3\x04\xe8\xc3\xf0\xe3\xe8\xe3\xe8\xc3\xf1\x01\x82\xf1 \x02\xf1@\xf1@\xe9 \x82\xe1\x00V\xe9@\xe9@\xf1`\xf1`\xf1@\xf9`\xe9 \xf9`\xf9\x80\xf9`\xf9`\xf9\x80\xf1@\xf1`\xf1`\xf9\xe0\xfa\x00\xf1\xc0\xf1\xe0\xe1\xc0\xe1\xa0\xf2 \xfa@\xf2\x00\xf2@\xf2`\xea`\xf2\x80\xf2\xc0\xf2\xe0\xf3\x00\xf3 \xf3`\xeb\x80\xd3\xa0\xc3\xc0\xa4\x00\x84\x00|\x00,\xc3\x1c\xe4%\x05%%%%5%EDe\x83}\x81}\xa2u\x82m\x82u\x82m\x82E\x02=#=#=$5\x04=$E$E$EDEEEE5%5&\x1d\x06\x0c\xc7\x0c\xc7\x04\xa7\x04\xa8\x04\xc8\x04\xa8\x15\x08\x1d(\x1d(\x1d)\x1dJ\x15*\r\n\r\n\x04\xea\x04\xea\x04\xca\x04\xca\x04\xab\x04\xac\x82\x04\x8c\x13\x04\xad\x04\xad\x04\xcd\x04\xcd\x05.\x05.\x05O\x05p\x05\x90\x05p\x05P\x05P\x05\x91\x05\x91\x05\x92\x05r\x05\x92\r\x93~\xb8\xef\xbe\x82\xf7\xde\x00\xf7\xbe\x82\xf7\xde\x8b\xff\xde\x03\xf7\xdeV;\x05X5x\x95\xff\xde\x04\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xff\x86\xff\xde\x00\xff\xdf\xac\xff\xde\x00\xff\xdf\x8f\xff\xde\x01\xff\xdf\xff\xbe\x8b\xff\xde\x00\xff\xbe\x87\xff\xde(\xfe\xfb\xe9\x83\xfe\xda\xff]\xff\x9d\xff\xbe\xff}\xff}\xe2\x05\xea\x04\xf2%\xf2%\xf2\x05\xe9\xc5\xe9\xc5\xe1\xc5\xe1\xc5\xea\x06\xea\x06\xe1\xa5\xe1\x84\xe9\xa5\xe1\x84\xe1d\xe9\xc5\xe9\xa4\xe9\x84\xe9\xa4\xe9\xa4\xe9\x84\xf1\xa4\xf1\xa5\xe1\x04\xd8\xc5\xd8\xc5\xd0\x84\xe0\xc4\xe0\xa4\xe0\xc4\xe8\xe4\xe8\xe4\x82\xe8\xc4\x13\xe0\xa3\xe0\xa4\xe8\xc4\xe0\xa3\xe8\xc3\xe0\xa3\xe8\xc3\xe8\xc3\xf0\xc3\xe8\xc3\xe8\xc3\xf0\xe3\xe8\xc3\xf0\xe1\xf9 \xf1\x00\xf1 \xe1\x00\xe9 \xd8\xe0\x82\xe1 \x06\xe9`\xe9@\xe9@\xe9 \xf1`\xe9@\xe9@\x84\xf1`\n\xe9@\xe9@\xf1`\xf9\xa0\xf9\xe0\xf1\xe0\xf1\xe0\xe9\xe0\xe1\xe0\xd1\xe0\xda\x00\x82\xea \x1e\xea@\xf2\xa0\xf2\xc0\xf3\x00\xf2\xc0\xf2\xe0\xeb \xe3`\xd3\xa0\xd3\xc0\xcb\xe0\xc3\xc0\xbb\x80t\x01\x1c\xe4\x1d\x05%%%%5E-\x04EDm\x82m\x82ebUCE#E#=\x035\x03=$ED\x83=$\x07=E5%-\x05\x1c\xe6\x0c\xc7\x0c\xe7\x04\xc8\x0c\xc8\x82\x04\xa8\x00\x0c\xc9\x82%I\x13\x1dI\x15*\r*\x04\xca\x04\xca\x04\xea\x04\xca\x04\xcb\x04\xcb\x04\xcc\x04\xcc\x04\xac\x04\x8c\x04\x8c\x04\x8d\x04\xcd\x04\xee\x05/\x05\x0f\x05/\x82\x05p\x02\x05P\x05P\x050\x82\x05\x91\t\x05\x92\x05\xb2\x05\x93\x05\x93\x8e\xb9\xd7\\\xf7\xbe\xf7\xde\xe7\x9e\xdf}\x85\xff\xde\x00\xf7\xbe\x85\xff\xde\x04\xf7\xde\xff\xde\xe7\x9e\xb7\x1d\xff\xdf\x8e\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xff\xff\xff\xff\x97\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x95\xff\xde\x04\xf6\xfb\xff\xbe\xff\xde\xff\xde\xff\xdf\x8e\xff\xde\x15\xff\xbe\xff\xde\xff\xde\xf6x\xf7;\xff\xde\xff\xbe\xff\xbe\xff\x9e\xf5\xd6\xeaf\xf2%\xf2\x86\xf2%\xea\x05\xe9\xe5\xf2&\xe9\xc5\xe1\x84\xe1\x84\xe9\xc5\xe1\x84\x82\xe1d\x10\xe1\x84\xe1\x84\xe1C\xe9\x84\xe9\xa5\xe9\xa5\xf1\xa5\xe9\x84\xe9e\xe1\x05\xd8\xa5\xd0\x85\xd0\xa5\xd8\xa5\xe0\xc4\xd8\xa4\xd8\x83\x82\xe0\xa4\x06\xe8\xc4\xe8\xc4\xe8\xe4\xe8\xc3\xe0\xa3\xf0\xe3\xe8\xa3\x82\xe8\xc3\x16\xe8\xa2\xe8\xc3\xe8\xa2\xe8\xc2\xe8\xc2\xf0\xe0\xe8\xe0\xe8\xe0\xe0\xe0\xe1\x00\xe1 \xe9 \xf1`\xf1\x80\xf1`\xf1\x80\xe9 \xe1 \xe9 \xd9\x00\xd9\x00\xd8\xe0\xe1\x00\x82\xe9@8\xe9 \xf1@\xf1\x80\xf1\x80\xf1\xc0\xf1\xc0\xf1\xe0\xf1\xe0\xe1\xc0\xc9\xa0\xc9\xc0\xc9\xe0\xda\x00\xe2 \xda\x00\xea\x80\xf2\xa0\xea\xc0\xe2\xc0\xeb\x00\xcb@\xab\xa0\xa3\x80\xc3\xa0\xcb\xa0\xd3\xa0\xd3\xa0\x9b\xc0,b\x04\xa4\x14\xe5%\x05%\x05\x14\xc5$\xe5=$=\x035\x04=$=$5\x035\x04=\x04=$MD=%-\x05$\xe5-\x055%%\x06%\x06\x0c\xc7\x0c\xc8\x04\xc8\x04\xa8\x04\xc8\x82\x04\xa8\x1c\x04\xc9\x1d)\x1d)%J%J\x1d*\r+\x04\xca\x04\xca\x04\xeb\x04\xeb\x04\xcb\x04\xcc\x04\xed\x04\xcd\x04\xac\x04l\x04\xae\x04\xad\x04\xad\x04\xee\x04\xee\x050\x05P\x050\x05P\x05P\x050\x05\x10\x82\x05q\x0b\x05\x92\x05\xb3\x05\xd3\x05\xb3\x05sfW\xff\xde\xf7\xde\xff\xde\xf7\xde\xef\xbe\xf7\xde\x82\xff\xde\x01\xf7\xbe\xf7\xde\x87\xff\xde\x00\xf7\xde\x85\xff\xde\t\xff\xff\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xff\x88\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xfe\x92\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x8e\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x98\xff\xde\x03\xff\xbe\xff\xbe\xff\xde\xff\xde\x82\xff\xbe\n\xff\xde\xff\xbe\xfe\x99\xeb\x8b\xeaE\xf2f\xf2%\xea\x05\xea\x05\xea%\xe9\xe6\x83\xe1\xa5\x19\xe9\xc5\xe1\x84\xe1\x85\xe1\x85\xe1d\xd9\x04\xd9%\xe1E\xe9\xa6\xe1E\xe1\x05\xe1&\xd0\xa5\xd0\xa6\xd8\xa6\xd0\x85\xd0\x84\xd8\x84\xd8\xa4\xe0\xa4\xe0\xa4\xd8\x83\xe0\x83\xe0\xc4\xe8\xe4\xe8\xe4\x82\xe8\xc4\x05\xf0\xe4\xe8\xc3\xe8\xe4\xe8\xa3\xe0\xa3\xe8\xe3\x82\xe8\xc3\x0e\xe8\xc2\xe0\xa1\xe8\xe0\xe8\xe0\xe1\x00\xf1@\xf1@\xf1`\xf1\x80\xf9\xa0\xf9\xc0\xf1\x80\xe1 \xd9 \xd1\x01\x82\xc8\xe1:\xd1\x00\xd9\x00\xe1@\xe1@\xe9@\xf1`\xe9`\xf1\x80\xf1\xc0\xf1\xc0\xf2\x00\xe9\xe0\xe1\xa0\xd1\xa0\xc1\xa0\xe2\x00\xe2 \xda\x00\xea`\xea\x80\xe2\xa0\xca\xc0\xbb\x00\x8b@S`[`\x9b\x80\xc3\x80\xd3\x80\xd3\xc0\xc3\xa0\x8b\xc0,c\x04\x85\x0c\xc5\x0c\xc6\x0c\xa5\x1c\xe55%-\x045$-\x04%\x04-\x055\x04=$5\x04,\xe4\x14\xc5\x0c\xa5\x14\xe6\x1c\xe6\x1d\x06\x14\xe6\x14\xe7\x04\xa7\x04\xc8\x04\xc8\x04\xc9\x83\x04\xa9,\x04\x88\x1d)%J-j%j\x15*\x04\xea\x04\xeb\x05\x0b\x05\x0b\x04\xec\x04\xab\x04\xcd\x04\xed\x04\xee\x04\xce\x04m\x04\xae\x04\xce\x04\xae\x04\xef\x05\x0f\x050\x05P\x050\x05P\x05q\x05Q\x05Q\x05\x10\x05Q\x05\x92\x05\xb3\x05\x92\x05\x92\x05\xd3\xa7\x1a\xf7\xde\xef\xbe\xf7\xbe\xf7\xbe\xef\xbe\xef\xbe\xf7\xde\xf7\xde\x85\xff\xde\x00\xf7\xbe\x8e\xff\xde\x01\xf7\xbe\xf7\xbe\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xff\x97\xff\xde\x00\xff\xff\x92\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xbe\x82\xff\xde\x82\xff\xbe\x82\xff\xde\x82\xff\xbe\x1c\xfe\xba\xf52\xf2f\xf2E\xf2F\xe9\xe5\xe9\xe5\xea\x05\xe1\xa5\xd9d\xd9d\xe1\xa5\xe9\xc5\xe9\xc5\xe1\xa5\xe9\xa5\xe1e\xe1e\xe1E\xe1%\xd8\xe5\xd0\xc4\xe1\x05\xd8\xc5\xd8\xa6\xc8\x85\xd0\x85\xc8\x85\xd0\xa5\x82\xd8\xa5\x08\xe0\xc5\xe0\xc5\xe0\xc4\xe0\xa4\xe0\xc4\xe8\xe4\xe8\xe4\xe8\xc4\xe8\xc4\x84\xe8\xe4\x00\xe0\xa3\x82\xe8\xc3\x16\xe0\xa3\xe0\xa3\xe0\xc3\xe0\xc2\xe0\xa1\xe0\xc0\xe9 \xf1@\xf1`\xf1`\xf9\xa0\xf9\xa0\xf1\x80\xe9`\xc0\xc1\xc0\xc2\xb8\xa2\xb0\x81\xb0\x81\xc0\xc1\xd0\xe0\xd9 \xe1 \x82\xe9@\x19\xe9`\xe9\x80\xf1\xe0\xf1\xe0\xf2\x00\xe1\xa0\xd9\x80\xd9\xa0\xe1\xe0\xe2\x00\xe2 \xea@\xe2\x80\xd2\xa0\xba\xc0\xb2\xe0\x9b s c\x80c\x80\x93\xa0\xab\x80\xdb\xc0\xdb\xa0\xa3\xc0<"\x82\x04\x85\x14\x0c\xc5\x0c\xa5$\xe5%\x05-\x05%\x05$\xe5%\x05-\x055%%\x05\x14\xc5\x14\xc6\x0c\xc6\x0c\xc6\x04\xa6\x04\x87\x04\xa7\x04\xa8\x04\xc8\x04\xe9\x82\x04\xc9\x13\x04\xa9\x04\xa9\x04\xca\x0c\xca\x1d*%J%j%K\x15\n\x0c\xeb\x04j\x04\xaa\x04\x8b\x04\x8b\x04\x8c\x04\xac\x04\xee\x04\xce\x04\xcf\x04\xcf\x83\x04\x8e\x00\x04\xef\x82\x05\x10\x82\x05Q\x0f\x051\x051\x05Q\x05\xb3\x05r\x05\x93\x05R\x05rvx\xef\x9d\xf7\xbe\xf7\xde\xd7}\r7\x1dW\xe7\xbe\x82\xff\xde\x05\xf7\xde\xf7\xde\xff\xde\xf7\xbe\xef\x9e\xf7\xbe\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xf7\xbe\x8a\xff\xde\x01\xff\xdf\xff\xfe\x8d\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x91\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xbe\x83\xff\xde;\xff\xbe\xff\xbe\xff\xde\xff;\xff}\xff\xbe\xff\x9e\xff\x9d\xff\xbe\xff\xbe\xff<\xf5S\xea\x05\xea%\xf2F\xea\x05\xe9\xc5\xe9\xe5\xe1\xa5\xe9\xa5\xe1\x84\xe1d\xe9\xa5\xe9\xa5\xe9\x85\xe9\xa5\xe1\x85\xe1e\xe1%\xd8\xe5\xe1&\xe1\x06\xd8\xc5\xd8\xc5\xd0\x86\xd0\xa6\xd0\x86\xc8\x85\xd0\x85\xd8\xc6\xd8\xa5\xd8\xa4\xd8\xa4\xe0\xc4\xd8\x84\xe0\xa4\xd8\x83\xe0\xc4\xe0\xc4\xe8\xe5\xe8\xe4\xe8\xe5\xe8\xc4\xe8\xc4\xe8\xe4\xe9\x04\xe8\xe4\xe8\xc3\xe0\xc3\xe8\xc4\x82\xe0\xc3\x12\xe0\xa2\xe0\xc2\xe0\xc2\xe1\x00\xf1@\xf1`\xf1@\xf9\x80\xf1\x80\xf1`\xe9`\xb8\xc1\xb8\xc3\xc0\xc3\xc0\xc3\xb8\xa2\xc8\xc2\xd1\x01\xd9\x00\x84\xe1@\x18\xe1`\xe1`\xe9\xc0\xe9\xa0\xe1\xa0\xe1\xa0\xe9\xc0\xe1\xe0\xd9\xe0\xda\x00\xda@\xda\x80\xca\xc0\xc2\xe0\xb2\xe0\xaa\xe0\xb3 \x9b`[\x80[\xa0S\xe0\x93\xc0\xc3`\xb3`;\xe1\x82\x0c\x85\x07\x14\xc5\x14\xc5%\x05\x1c\xe5\x14\xe5\x0c\xc5\x0c\xc5\x0c\xc6\x82%\x06\x0b\x14\xe6\x0c\xa6\x14\xe6\x0c\xc7\x04\xa7\x04\xc8\x04\xc8\x04\x88\x04\xa8\x04\xa9\x04\xc9\x04\xa9\x82\x04\xca&\r\n\x15+\r\n\x15+\x1dK\r\x0b\x04\xaa\x04\x8b\x04\x0b\x04\x8c\x04l\x04+\x04l\x04\x8c\x04\xad\x04\xce\x04\xae\x04\x8f\x04N\x04N\x04\x8f\x04\xd0\x04\xd0\x05\x11\x05\x10\x05\x11\x052\x051\x05R\x05\x11\x052\x052\x05s\x05\x93\x05\x93\x05s\x86\x98\xe7\x9d\xef\x9d\x82\xf7\xde\x02~Z\x04\xf6\xb7\x1c\x98\xff\xde\x01\xf7\xbe\xf7\xbe\x83\xff\xde\x82\xff\xff\x83\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x84\xff\xde\x05\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xfe\xa2\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xfe\x8f\xff\xde\x1a\xff\xdf\xff\xde\xff\x9d\xf3\xab\xf4O\xfex\xff\xbe\xff\xbe\xf3j\xea\x05\xff\x9d\xff\xbe\xf7\x1b\xff\x9e\xff\x9d\xff\x9d\xfe\xfa\xeag\xea\x05\xea\x05\xea\x06\xe1\xa5\xe9\xa5\xe9\xc5\xe1\xa5\xe1\x85\xe1e\x82\xe1\x85"\xe1e\xe1e\xe1E\xd9\x05\xd8\xc4\xe1\x05\xe0\xe6\xd8\xc6\xd0\xa6\xc8\x86\xc0e\xc8\xa6\xc8e\xc8e\xd8\xc6\xd0\x85\xd8\xa4\xd8\xc4\xe0\xe4\xe0\xe5\xe0\xc4\xe0\xe5\xe0\xc5\xe0\xc4\xd8\xa4\xe0\xc4\xe0\xc5\xe0\xa4\xe8\xe4\xe0\xc4\xe8\xe4\xe0\xc4\xe0\xa3\xe0\xa4\xe0\xa3\x82\xe0\xc4\x13\xe0\xc3\xe0\xe2\xe0\xc2\xe8\xe1\xf1`\xf9\x80\xf1 \xf1\x80\xe9 \xe1\x00\xd9\x00\xa0b\xb0\xa3\xb8\xc3\xc0\xe3\xc0\xe3\xc8\xe3\xd1\x01\xd9 \xd9 \x82\xe1 \x1c\xe9`\xe1@\xd9`\xd9@\xe1`\xe1\x80\xe1\xa0\xd9`\xd1\xa0\xd1\xc0\xda\x00\xd2@\xca\x80\xc2\xa0\xba\xe0\xba\xc0\xc2\xc0\xbb\x00\xb3@\x83`S\xa03\xe0#\xe1[\x80Sa,"\x14d\x0ce\x0ce\x82\x14\xa5\x07\x0c\xa5\x04\xa5\x0c\xa6\x0c\xc6\x04\xa6\x04\xc7\x0c\xc7\x14\xe7\x82\x04\xc7#\x04\xc8\x04\xa8\x04\xa8\x04\x88\x04\xc9\x04\x89\x04\x89\x04\xaa\x04\xca\x04\xaa\x04\xca\r\x0b\r\x0b\x15+\r\x0b\r\x0b\x05\x0b\x04\x8a\x04\xac\x04l\x02\xe8\x03\xcb\x04l\x04\xad\x04\xcd\x04\xad\x04\xae\x04\xae\x04n\x04.\x04\x0e\x04\x0e\x04\xb0\x04\x90\x04\xd0\x04\xf1\x83\x05\x11\x03\x052\x05S\x05R\x05R\x82\x052\x00E\xd4\x83\xf7\xbe\x04\xf7\xde\xff\xde\xf7\xde\xef\xbe\xf7\xde\x88\xff\xde\x01\xff\xff\xff\xff\x8f\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xdf\x8d\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x87\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x91\xff\xde\x04\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xdf\x8d\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xedS\x83\xff\xde:\xff\xbe\xff\xde\xf5\x12\xf2f\xfb\xec\xf2\x05\xf4\xb1\xff<\xff\x1b\xf4\x90\xff\x9d\xff\xbe\xff\xbe\xff\x9d\xff\x9d\xff\x9e\xf6y\xe1\xc4\xea&\xea\x06\xe9\xe5\xe9\xe6\xe1\xa5\xe1\xa5\xe9\xc6\xe1\x85\xd9D\xe1e\xe9\xa6\xe9\x85\xe9\xa6\xe1e\xe1e\xe1E\xe1\x05\xe1\x05\xe1\x06\xd8\xe6\xc8\x85\xc8\x86\xc8f\xc8\x86\xc8\x86\xc8\xa6\xd8\xe6\xd0\xa5\xd8\xa4\xd8\xc4\xd8\xc4\xe0\xe5\xe0\xe5\xd8\xc4\xe0\xc5\xe0\xc5\xd8\xa4\xd8\xc4\xd8\xa4\xe0\xa4\xe0\xa4\x82\xe0\xc4>\xe0\xa4\xe0\xa4\xd8\xa4\xe0\xc4\xd8\xa4\xe0\xc4\xd8\xa3\xd8\xa2\xd8\xc2\xe0\xe2\xe9\x02\xd8\xc1\xe8\xe0\xe9\x00\xe9\x00\xe1\x00\x98C\xa0\x84\xb0\xa3\xc0\xe4\xc8\xe4\xc0\xc3\xc0\xc3\xc8\xe1\xd1\x00\xd1\x00\xe1@\xe1 \xe1 \xe1`\xe1@\xd9`\xd1 \xd1@\xd9\x80\xd1`\xd1`\xc9`\xc1`\xc9\xc0\xca \xca@\xba\x80\xb2\xa0\xba\xc0\xba\xa0\xba\xe0\xab \x8b@c\x80;\xa0+\xc1#\xe2\x1c\x03\x1c#\x14D\x0cE\x0ce\x14\x85\x0c\xa5\x0c\xa5\x0c\x85\x04\x86\x82\x04\xa6\t\x04\xa7\x04\x87\x04\xa7\x04\x87\x04\x87\x04\xa8\x04\xa8\x04\xc9\x04\xc9\x04\xa9\x84\x04\xaa:\x04\xca\x04\xcb\x05\x0b\r\x0b\x05\x0b\x04\xeb\r\x0b\x04\xcc\x04\xcc\x04\xad\x04\x8d\x04\x8e\x04\xae\x04,\x04m\x04\xae\x04m\x04N\x04.\x04\x0e\x04\x0f\x04/\x04\x0f\x04p\x04\xb0\x04\xd1\x04\xf1\x05\x12\x05\x12\x052\x05\x12\x04\xd1\x05\x12\x05S\x053\x05\x12\x04\xf1U\xf5\xae\xd9\xdf\\\xd7\\\xf7\xde\xf7\xbe\xf7\xde\xef\x9e\xf7\xbe\xff\xde\xf7\xde\xff\xde\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\xff\xde\xf7\xde\xf7\xbef\x1a\xa6\xbb\x97\xff\xde\x00\xff\xff\x8d\xff\xde\x02\xff\xff\xff\xde\xff\xff\x84\xff\xde\x00\xff\xdf\x83\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x8f\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x96\xff\xde\x05\xebl\xf2&\xfc\r\xf3\xcd\xf4p\xff\x9e\x83\xff\xde"\xff}\xff\xbe\xff\x9d\xff<\xeb\x8b\xe2\x05\xea\x06\xe1\xc5\xe1\xc6\xe1\xa5\xd1D\xd9e\xe1\x85\xd9e\xe9\xa6\xe9\xa6\xe9\xc7\xe9\xa6\xe9\xc7\xe9\x86\xe1E\xe1%\xe1&\xe1\x06\xd8\xe5\xd8\xe6\xd0\xa6\xc8\xa6\xc8\x86\xc8\xa6\xd0\xa6\xc8\x86\xc8\x85\xc8\x85\xd8\xa5\x82\xd8\xc5\x03\xd8\xa4\xd8\xc5\xe0\xe5\xd8\xe5\x83\xd8\xa5C\xd8\xa4\xd8\xa4\xe0\xc5\xe0\xe5\xe0\xc4\xd8\xa4\xd8\xc4\xd8\xa4\xd8\xa4\xd8\xa3\xd8\xa3\xd0\xa3\xd8\xc3\xd8\xc3\xd0\x82\xd0\xa2\xd8\xa0\xe0\xe1\xd8\xe1\xd0\xa2\xb8\xa3\xc0\xe4\xc0\xe4\xc9\x04\xc8\xe3\xc0\xe3\xb8\xc3\xb8\xc2\xc8\xe0\xd1\x00\xd0\xe0\xd9 \xe1@\xe1@\xd9 \xd9@\xd1 \xd1 \xc9 \xc9`\xd1\x80\xc9\xa0\xc9\x80\xc9\xa0\xca \xca@\xba@\xba`\xba\x80\xb2\x80\xb2\xa0\xa2\xc0\x83\x00S@;\xc14\x02\x1c\x03\x0c$\x14D\x14E\x0cE\x04E\x04\x05\x04E\x04E\x04f\x0c\x86\x04\x86\x82\x04\x87<\x04\xa8\x04\x88\x04\x88\x04g\x04g\x04\xa9\x04\xa9\x04\x89\x04\xaa\x04\xaa\x04\xcb\x04\xab\x04\xcb\x04\xcb\x04\xab\x04\xcb\x04\xeb\x04\xec\x05\x0c\x04\xcb\x04\xcc\x04\xcc\x04\xcd\x04\xce\x04\xae\x04\xcf\x04\xcf\x04\xae\x04\xcf\x04\xef\x04-\x03\xee\x04\x0e\x04\x0f\x04/\x04\x0f\x03\xef\x04\x0f\x04p\x04\xb1\x04\xf2\x052\x05\x12\x052\x052\x05\x12\x052\x05S\x05S\x04\xd1\x05\x12\x1d\x94\r3\xae\xda\xf7\xbe\xff\xde\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xdf\\\x82\xf7\xbe\x00\xf7\xde\x83\xff\xde\x04\xf7\xbe\xa6\xbb\x158\xbf\x1d\xf7\xde\x89\xff\xde\x04\xf7\xbe\xef\xbe\xff\xde\xff\xde\xff\xff\x83\xff\xde\x00\xff\xff\x85\xff\xde\x02\xff\xdf\xff\xff\xff\xff\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x06\xff\xff\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xff\x9b\xff\xde\x00\xff\xdf\x83\xff\xde\x04\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\x97\xff\xde\x08\xf6\x17\xf2\x87\xfb*\xfb\xcc\xfd\xd5\xff\xde\xff\xbe\xff\xde\xff\xde\x82\xff\xbe\r\xff\\\xfd\xf6\xeag\xea\x06\xe1\xa5\xe1\xc6\xea\x07\xe1\xa6\xd9\x85\xe1\x86\xd9e\xd9E\xe1\x86\xe9\xa7\x82\xe1\x86\x17\xe1f\xe1F\xe1&\xd9\x06\xe1\x06\xe1&\xd8\xe6\xd0\xc6\xd0\xc6\xd0\xa6\xc8\x85\xd0\xa6\xd0\xa6\xc8\x85\xc8e\xc8\x85\xd8\xe6\xc8\x84\xd8\xc5\xd8\xc5\xd8\xe5\xd8\xe6\xd8\xe5\xd8\xe6\x84\xd8\xc5@\xe0\xe5\xd8\xc5\xe0\xc5\xd8\xc5\xd8\xc5\xd8\xa5\xd0\x83\xd0\xa4\xd8\xc4\xd0\x83\xd0\xa3\xc8\x82\xd0\x82\xd0\x83\xd0\xa3\xd0\x82\xd0\xa2\xc8\xa2\xc8\xa3\xd0\xe4\xd1\x04\xd1$\xc9$\xb8\xc3\xb8\xc3\xb8\xc2\xc1\x01\xc0\xc0\xc8\xe0\xd1\x00\xd1 \xd9@\xd1 \xd1\x00\xc9 \xc9\x00\xc1 \xc1 \xc1@\xc1\x80\xc1\x80\xc9\xc0\xc2\x00\xc2@\xba`\xba\x80\xb2\x80\xb2\x80\xb2\xc0\x9a\xc0\x82\xe0[\x003\xa1#\xe2\x0c\x04\x0c\x05\x04\x05\x0c%\x04%\x0c%\x04%\x0cF\x03\xe5\x04F\x04f\x82\x04\x87\x0e\x04g\x04g\x04h\x04h\x04(\x04\'\x04\x89\x04\x89\x04i\x04j\x04j\x04\xab\x04\xab\x04\xcb\x04\xab\x82\x04\x8b\r\x04\xab\x04\xcc\x04\xac\x04\xac\x04\xad\x04\xce\x04\xef\x04\xcf\x04\xcf\x04\xd0\x04\xaf\x04\xaf\x04\xcf\x04O\x82\x03\xce\t\x03\xef\x03\xef\x04P\x040\x04\x10\x04P\x04\xf2\x052\x05\x12\x053\x82\x05\x12\x1e\x05S\x05S\x052\x05\x12\x05S\x05S\x05T\xbf<\xf7\xbe\xf7\xbe\xff\xde\xef\x9d\xf7\xde\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xf7\xbe\xff\xde\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\xef\x9e\xef\xbe\xf7\xde\xf7\xde\xef\x9e\xf7\xbe\xff\xde\xff\xdf\x84\xff\xde\x02\xff\xdf5\xb9~[\x89\xff\xde\x02\xff\xff\xff\xde\xff\xfe\x8d\xff\xde\x00\xff\xff\x8b\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x89\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xa6\xff\xde\x1b\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xdf\xff<\xedt\xf6\x99\xff\\\xff\x9e\xf7\x1c\xff\xde\xff\xde\xff\xbe\xff\x9e\xff\xbe\xebl\xeb\n\xe2\x06\xe1\xe6\xe1\xe6\xea\'\xe1\xe6\xe9\xe7\xe1\xc6\xe1\x86\xe1\xa7\xe1\x87\x82\xd9F\r\xd9&\xe1F\xe1\x06\xd9\x06\xd9\x06\xd8\xe5\xd8\xe6\xd8\xc6\xd8\xa6\xc8\xa6\xc8\x86\xc8\x85\xc8\x86\xc8\xa6\x82\xd0\xa6\x16\xd0\xc6\xd0\xc5\xd0\xa5\xd8\xc5\xd0\xa5\xd8\xc5\xd8\xc5\xd0\xe6\xd0\xc5\xd0\xa5\xc8\x85\xd0\xa5\xd0\xa5\xd8\xa5\xd0\xc5\xd0\xa5\xd8\xc5\xd8\xc5\xd0\xa5\xc8\x84\xc8\x84\xc8\xa3\xc8\xa3\x82\xd0\xa3\x03\xd0\x83\xd0\xa3\xc8\x83\xc8\x83\x82\xc8\xa3\x0b\xc8\xe3\xc8\xe3\xc9\x04\xc1\x03\xb8\xe3\xb0\xc3\xb8\xc2\xc0\xc1\xc0\xe0\xc0\xe0\xc1\x00\xc8\xe0\x82\xc9\x00\x18\xc0\xe0\xb9\x00\xb1\x00\xa9 \xa9 \xb1`\xb1@\xc1\xa0\xb9\xe0\xb2\x00\xb2 \xb2 \xa2`\xa2`\xa2\xa0\x8a\xa0j\xe0S #\x82\x13\xe4\x0b\xc5\x03\xc5\x04\x06\x04&\x04\x06\x82\x04&\x1d\x04\x06\x04G\x04G\x04\x88\x04\x87\x04g\x04G\x04h\x04h\x04I\x04\x08\x04\x08\x04)\x04)\x04\t\x04\t\x04*\x04k\x04J\x04k\x04k\x04\x8b\x04k\x04k\x04l\x04\x8c\x04l\x04m\x04m\x04\x8e\x82\x04\xaf$\x04\xb0\x04O\x04/\x04\x90\x040\x03\xae\x03\xcf\x04\x10\x040\x040\x03\xf0\x03\xf0\x04\x11\x041\x04\xd2\x05\x13\x05\x12\x04\xf2\x04\xb1\x04\xf2\x04\xf2\x05S\x053\x053\x05\x13\x05t\x05\x95\x05t%u\xd7]\xf7\xbe\xf7\xbe\xef\xbe\xf7\xbe\xff\xde\xdf}\xc7<\x82\xf7\xbe\x01\xff\xde\xff\xde\x83\xf7\xbe\x03\xff\xde\xf7\xde\xf7\xbe\xef\x9d\x85\xff\xde\x02\xf7\xde\xff\xde\xdf~\x83\xff\xde\x00\xff\xdf\xa4\xff\xde\x01\xff\xdf\xff\xdf\x93\xff\xde\x04\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\x95\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x85\xff\xde\x01\xff\xbe\xff\xbe\x84\xff\xde\x1a\xff\xbe\xff\xde\xff\xbe\xff\xbe\xf5T\xf5\xf6\xff}\xff\x9d\xff\xbe\xf6X\xe1\xe6\xe1\xe7\xe1\xe7\xe1\xc6\xea(\xea\x08\xe1\xc7\xe1\xc7\xe1\x87\xe1\xa7\xd9g\xd9g\xdb\x0c\xeey\xee\x9a\xee\x9a\xe6\x9a\x82\xee\x9a\x0c\xeez\xeez\xe55\xc8\x85\xc0\x86\xc8\xa6\xc8\x86\xc0\x85\xc0\x85\xc0e\xc0\x85\xc8\xa6\xc8\xc5\x82\xd0\xc5\x07\xd0\xa5\xd0\xc5\xc8\xc5\xd4\x11\xee\x9a\xee\x9a\xee\xba\xee\xba\x84\xee\x9a\x03\xee\xba\xcbN\xb8d\xc0c\x83\xc8\xa3\x82\xc8\x83\x82\xc8\xa3\x08\xc8\xc3\xc8\xc3\xc0\xa3\xc0\xc3\xb8\xa3\xb0\xc3\xa0\x82\xd5\xb6\xe6\x99\x87\xe6y\x02\xde\x17\xa1!\xa1 \x82\xa1@\x02\xb2f\xe6\x99\xee\xb9\x84\xe6\xb9\x1e\xe6\xd9\xde\xd9\xd6\xf9\xd6\xfa\xce\xfa\xbex\x0bf\x03\xc7\x03\xe6\x03\xc6\x03\xc7\x04\'\x04\x07\x04\'\x04\'\x04H\x04h\x04h\x04\x88\x04h\x04i\x04H\x04)\x04\t\x03\xc9\x03\xc8\xb6w\xce\xfa\xce\xfa\xcf\x1a\xce\xfa\x83\xcf\x1a\x12\xce\xfa\xce\xfa\xce\xfb\xce\xfa4\xaf\x04n\x04N\x04O\x04\x90\x04o\x04\x90\x04p\x04/\x96\x17\xd7\\\xd7\\\xd7<\xd7<\xdf<\x83\xd7<\x08\x95\xf8\x04\x11\x04r\x04\xb2\x04\xf2\x04\xf2\x04\xd2\x04\xd2\x05\x13\x83\x053\x18\x05t\x05\x95\x05u\x054\xd7\\\xf7\xbe\xef\x9e\xf7\xbe\xef\x9e\xef\x9d\xd7}\xe7\x9d\xf7\xde\xff\xde\xff\xde\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xf7\xbe\xef\x9e\xf7\xbe\xff\xde\xff\xde\xff\xbe\x8c\xff\xde\x01\xff\xdf\xff\xfe\x8e\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x82\xff\xde\x01\xff\xdf\xff\xdf\x8f\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\xb3\xff\xde\x01\xff\xbe\xff\xbe\x83\xff\xde\r\xff\xbe\xff\xde\xff\xbe\xff\x9e\xf6y\xe2\'\xe1\xe6\xf4\x91\xff\x1c\xec/\xea\x89\xeai\xeaI\xe1\xe7\x82\xe1\xa7\x05\xd9f\xe1\x87\xe1\xa7\xd9G\xd9H\xee\xfb\x88\xff\xde\x0b\xf7\xde\xb9h\xc0\x86\xc8\xa6\xc8\xa6\xc0\xa6\xc0\x85\xc0\x86\xc0\x85\xc8\xa6\xc8\xa6\xc8\xc6\x82\xc8\xa5\x02\xd0\xa5\xc8\xa5\xf7\x9e\x87\xff\xde\x05\xff\xbe\xff\xde\xee\xdb\xb8\x84\xb8c\xc0\x83\x82\xc8\xa3\r\xc8\x83\xc8\x82\xd0\xa3\xc8\xa3\xc0\x83\xd0\xe4\xc8\xa3\xc0\xa3\xb8\xa2\xb8\xa3\xb8\xa3\xb0\xa2\xb2i\xf7\xde\x88\xff\xde\x06\xf7\xde\x9a\'\x99 \x99@\x99`\x89`\xd6\x17\x8c\xff\xde\x06d\x8f\x03\x87\x03\x88\x03\x87\x03\xc8\x03\xc7\x03\xc7\x82\x04(\t\x04I\x04I\x04H\x04H\x04I\x04\x08\x03\xe9\x03\xca\x03\xcaL\x8f\x8c\xff\xde\x04\xcf\x1b\x03\xee\x04.\x04/\x04O\x82\x04P\x01\x04\x10\xf7\xbe\x88\xff\xde!\xff\xff\x0b\xf2\x04r\x04\xb2\x04\xb2\x04\x91\x04\xb2\x04\x92\x04\x92\x04\xf3\x054\x05T\x05T\x05\x95\x05\x96\x05\x96\x054\xcf\\\xf7\xbe\xd7]\xf7\xde\xef\x9d\xef\xbe\xef\x9e\xf7\xde\xf7\xde\xb6\xfb\xd7<\xcf}\xb7<\xef\x9e\xef\xbe\xe7}\xd7]\x83\xf7\xbe\x01\xff\xde\xf7\xbe\x8a\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xfe\x90\xff\xde\x02\xff\xdf\xff\xde\xff\xfe\x8e\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x8d\xff\xde\x00\xff\xdf\x82\xff\xde\x04\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xdf\x8d\xff\xde\x02\xff\xbe\xff\xde\xff\xde\x82\xff\xbe\x13\xff\x9d\xff\xbe\xff\xbe\xf68\xeb\n\xebl\xea\x89\xf2\x89\xea(\xe1\xe7\xe9\xe8\xe1\xc8\xe1\x87\xd9F\xd9F\xd9\x87\xd9g\xd9G\xd1\x07\xef\x1b\x89\xff\xde\x01\xa9H\xb8\x86\x82\xc0\xa6\x03\xc8\xa6\xc8\xc7\xc8\xe7\xc0\xc6\x82\xc0\xa6\x04\xc0e\xc8\xa6\xc8\xa5\xc0\xa5\xee\xbb\x89\xff\xde\x13\xff\xbe\xb8\x84\xc0\xa4\xc8\xa4\xc8\xa3\xc0\x83\xc8\xa3\xc8\xa3\xc8\x83\xc8\x83\xc0\x83\xc0\xa3\xc0\xa3\xc0\x83\xc0\xa3\xb8\x82\xb8\xa2\xb0\xa2\xa8\xa2\xd54\x89\xff\xde\x06\xf7\xbe\x99!\x99@\x99@\x91@\x89`\xdeX\x8c\xff\xde\x0c\xd6\xda\x03H\x03h\x03h\x03\x88\x03\x88\x03h\x03\x88\x04\t\x04)\x04J\x04)\x04)\x82\x04\t\x03\x03\xca\x03\xaa\x03\xab\xb6x\x8c\xff\xde\t\xd7<\x03\xae\x04\x0e\x04\x0e\x04\x0f\x040\x040\x04\x10\x04\x11\xff\xbe\x89\xff\xde\t\x0b\xd2\x04R\x04\x92\x04\x92\x04\xb3\x04\x92\x04\x92\x04\xd3\x05\x14\x05T\x83\x05u\x14\x05U\x055\x05\x14\x1d5\x0c\xd4M\xb7\xbf\x1b\xf7\xbe\xf7\xde\xff\xde\xcf]\xbf\x1c\xbf<\x15\x98\r\xb8\r\x98\r7%\x99\xb6\xfc\xdf]\xf7\xde\x8a\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x90\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x08\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xfe\x88\xff\xde\x01\xff\xff\xff\xdf\x92\xff\xde\x00\xff\xdf\x89\xff\xde\x04\xf6\x9a\xecs\xff\xde\xff\xde\xff\xff\x99\xff\xde\x82\xff\xbe\x08\xf6X\xf5T\xe1\xe7\xe1\xc7\xe1\xa6\xe1\xc7\xe1\xc7\xd9f\xd9F\x82\xd9g\x03\xd9G\xd1\'\xd1(\xee\xfc\x88\xff\xde\x11\xf7\xde\xa1\x06\xb8\xa6\xb8\x86\xc0\xc7\xb8e\xc0\xa6\xc8\xc6\xc8\xe7\xc0\xa6\xb8\x85\xc0\xa6\xb8\x86\xc0\x86\xc8\xa6\xc0\xa5\xc0\xa6\xd4\x92\x89\xff\xde\x13\xff\xbe\xb1\xa7\xc0\x84\xc8\xa4\xc0\x83\xc0\x83\xc8\xc4\xc8\xa4\xc8\xa3\xc0\xa4\xc0\x84\xb8\x83\xc0\xa3\xc0\xa3\xc0\xc4\xb8\xa3\xb0\x83\xa8\x82\xa8\x82\xf7\x1c\x89\xff\xde\x06\xe6\x99\x99 \x99@\x91@\x89`\x81`\xd68\x8d\xff\xde\x01\x12\xe8\x03)\x82\x03I\x03\x03i\x03H\x03\xa9\x03\xc9\x82\x04*\x06\x04+\x04+\x04\x0b\x03\xaa\x03j\x0bJ\xf7\xbe\x8c\xff\xde\t\xd7\x1c\x03\xaf\x04\x0f\x03\xef\x03\xef\x04\x10\x04\x11\x04\x11\x03\xb0\xf7\xbe\x89\xff\xde \x0b\xb1\x04S\x04\x12\x04R\x04R\x04r\x04\xb3\x04\xf4\x054\x05u\x05u\x05\x96\x05u\x05u\x05U\x05u\x055\x04\xd4\x056\x05U\x05V\x8e\x9a\xf7\xbe\xf7\xde\xf7\xbe\xcf]\x05X\x05\x98\r\xb9\r\x98\x057\x05X~\x9b\x82\xf7\xbe\xd4\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xbe\x89\xff\xde\x06\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xbe\x82\xff\xde\x13\xff\xbe\xff\xbe\xff\xde\xff\xbe\xf5\xd6\xfe\xfb\xd1\xe7\xe1\xa7\xe1\xe7\xe1\xa7\xe1\xc8\xe1\xa7\xd9g\xe1\x87\xd9G\xd1&\xd1G\xc9\'\xc9\x07\xef\x1c\x89\xff\xde\x11\xa1\x07\xb8\xa6\xb8\xa6\xb8\x86\xb0e\xc0\xa6\xc0\xa6\xb8e\xc0\xa6\xc0\x86\xb8\x86\xc0\xa6\xc0\xc6\xc8\xa6\xc8\xe7\xc0\xc6\xb9\xe9\xf7\xde\x89\xff\xde\x11\xc41\xb8\x84\xc0\x84\xc0\x84\xc0\x83\xc0\xa4\xc8\xa4\xc0\xc4\xc0\xa4\xb8\xa4\xb8\xa4\xb0\x84\xb8\xa4\xb0\xa4\xb0\x83\xa8\x83\xa8\x82\xa0\xc3\x8a\xff\xde\x06\xb4\x0f\x91@\x91@\x89@\x81@y`\xd68\x8d\xff\xde\x11dO\x03)\x03\t\x03\t\x03I\x03)\x03i\x03\x89\x03\xca\x03\xea\x03\xeb\x04\x0b\x04+\x04\x0b\x03\xcb\x03\x8b\x03jL\x0f\x8d\xff\xde\x02\xd7\x1c\x03o\x03\xaf\x82\x03\xf0\x03\x03\xf1\x04\x11\x03\xb0\xff\xbe\x89\xff\xde\x1c\x0b\x90\x04\x12\x04\x12\x04s\x04s\x04\x93\x04\xb3\x05\x14\x05\x14\x05U\x05U\x05v\x05v\x055\x05U\x05V\x05\x15\x056\x05V\x05V\x05v\x15w\xa6\xbb\xf7\xbe\xd7}-\xf9\r\xb9.\x1a\r\xb9\x82\x05X\x03v{\xef\xbe\xf7\xde\xf7\xde\xa2\xff\xde\x00\xff\xff\x9b\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\xa3\xff\xde\x03\xff\xdf\xff\xde\xff\xbe\xff\xbe\x84\xff\xde\x12\xff\xbe\xff\xbe\xff\x9d\xd9\xc7\xf5\xd7\xff\x1c\xe2\x89\xe2\x08\xe1\xe8\xe1\xc8\xe1\x88\xd9\x88\xd9g\xd9g\xd1G\xd1\'\xd1G\xc0\xe7\xee\xfb\x89\xff\xde\t\x91\x07\xa8e\xb0\x86\xb0\x86\xb8\x86\xb0e\xb8\x86\xb8\x86\xc0\xa7\xb8\x86\x84\xc0\xa6\x02\xc0\x86\xb0\xa5\xf7\xbe\x89\xff\xde\x02\xe6\x9a\xb0\x84\xb8c\x83\xc0\xa4\n\xb0\x84\xa8\x84\xb0\xa5\xa0\x84\xa0\x85\xa8\xa5\xa8\xa4\xa8\x84\xa0\x83\x98\x83\x9aj\x89\xff\xde\x07\xf7\xde\x99\xc4\x91`\x91`\x81`y`y`\xd68\x8d\xff\xde\x06\xce\xba\x03\t\x03\t\x03*\x03j\x03J\x03\x8a\x82\x03\xab\x07\x03\xcb\x03\xeb\x03\xcb\x03\xcc\x03\xac\x03k\x03K\xbey\x8d\xff\xde\t\xd7\x1c\x03o\x03\xcf\x03\xd0\x03\xf1\x03\xd0\x03\xf1\x03\xf1\x03\xd1\xff\xbe\x87\xff\xde\'\xff\xff\xff\xdf\x0bP\x03\xf2\x043\x04S\x04s\x04\xb4\x04\xb4\x04\xf4\x05\x14\x04\xf4\x05\x15\x05U\x05V\x05V\x056\x05V\x05v\x056\x05W\x056\x056\x057\rw=\xd9^9-\xf9\x05x\x05\x99\x05y\x05X\x15x\xaf\x1d\xef\x9e\xef\x9e\xf7\xbe\xff\xde\xff\xde\xff\xdf\x8e\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xdf\x88\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x90\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xdf\x8a\xff\xde\x01\xf4o\xf4\r\x82\xff\xbe\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x14\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xff<\xff\x9d\xff\x9d\xf5\xb5\xe2\x08\xe1\xa8\xe1\xc8\xd9\x88\xd9g\xd9G\xd1\'\xd1\'\xc9\x07\xd1H\xc0\xe7\xee\xfc\x89\xff\xde\x11\x91\x06\xa8f\xa8f\xb0\x86\xb0\x85\xb8\x86\xb8\xa6\xb8\x86\xb8\x86\xb8\xa7\xc0\xa7\xb8\x86\xc0\xa7\xc0\xa6\xb8\xa6\xb8\x86\xb0\x85\xe6y\x8a\xff\xde\x10\xa8c\xb0d\xb8\x83\xc0\xa4\xb8\xa4\xb8\x84\xa0d\xa8\xa5\xa0\x85\x98\x85\x98\x85\xa0\xa5\xa0\x85\x98d\x98c\x90\x84\xcd\x14\x89\xff\xde\x07\xf7\x9d\x91A\x91\x80\x81\x80y`q`y\x80\xd6X\x8d\xff\xde\x11\xf7\xde\n\xa9\x03\n\x03+\x03K\x03K\x03\x8b\x03\xac\x03\xac\x03\x8b\x03j\x03k\x03k\x03\xac\x03\x8c\x03K\x0b\x0b\xf7\xbe\x8d\xff\xde\x02\xd7<\x03O\x03\xaf\x82\x03\xd0\x03\x04\x11\x03\xf1\x03\xb1\xf7\xbe\x89\xff\xde \x0bq\x03\xf2\x04\x13\x04S\x04\x94\x04\xb4\x04\xd5\x05\x15\x04\xf5\x05\x15\x055\x055\x05V\x056\x055\x056\x056\x05W\x056\x057\x05\x16\x05W\x057-\xf9-\xd9vzE\xf9\x058\x15Xn[\xe7\x9e\xef\x9e\xe7}\x85\xff\xde\x00\xe7\x9e\x83\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\xba\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xfe\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x84\xff\xde\x03\xfd\x94\xfcn\xff\x9d\xff\xbe\x89\xff\xde\x13\xff\xbe\xff\xde\xff\xde\xff\xbe\xff}\xff\xbe\xff\x9d\xff<\xec\x10\xd1g\xd9\xa8\xd9\xa8\xd9h\xd1\x07\xc8\xc6\xd1\'\xc9\x07\xc9(\xc0\xe7\xee\xfb\x89\xff\xde\x11\x91\x06\xa8f\xa8f\xb0\x87\xb8\xa7\xb8\xa7\xb8\x86\xb8\x86\xb0\x86\xb0f\xb8\x86\xc0\xa7\xb8\x86\xc0\xc7\xb8\xa7\xb0\x86\xb8\xa7\xbb\x8f\x89\xff\xde\x11\xff\xdf\xa1\xe9\xa8d\xb8\xa4\xb8\xa4\xb0\x84\xa8d\xa8\x85\x98\x85\x90e\x90\x86\x90\x86\x88\x85\x90e\x90d\x88C\x80c\xef<\x89\xff\xde\x07\xd5\xf7\x91a\x91\x80\x89\x80\x81\x80y\x80y\x80\xd6X\x8e\xff\xde\x04[\xcf\x02\xca\x03+\x03k\x03k\x82\x03\xac\x07\x03\x8c\x03k\x03K\x03+\x03+\x03\x0b\x03\x0bT\x10\x8e\xff\xde\x01\xd7\x1c\x03O\x82\x03\xb0\x04\x03\xd1\x03\xd1\x03\xb1\x03\x91\xff\xbe\x89\xff\xde\x1e\x0bQ\x03\xd2\x03\xf2\x04S\x04t\x04\xb4\x04\xd5\x05\x16\x04\xd5\x04\xf5\x05\x16\x056\x056\x05V\x056\x05\x16\x05W\x05W\x057\x057\x05W\x057\x05\x17-\xf9\xd7}\xf7\xbe\xf7\xde\xdf\x9e\xf7\xde\xf7\xbe\xf7\xbe\x86\xff\xde\x01\xf7\xbe\x9e\x9b\x84\xff\xde\x02\xef\xbe\xf7\xbe\xff\xdf\x8c\xff\xde\x01\xff\xff\xff\xfe\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x9b\xff\xde\x00\xff\xdf\x86\xff\xde\x06\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\x95\xff\xde\x02\xff\xbe\xff}\xff\x9d\x87\xff\xde\x82\xff\xbe\x13\xff\xde\xff\xdf\xff\xde\xf6z\xff\x9e\xff\xbe\xff~\xff<\xfeY\xe2k\xe3\xf0\xf69\xeb\xf0\xd1\'\xd9\x89\xd9\x89\xd1H\xc9\x08\xc0\xe7\xef\x1c\x89\xff\xde\x0b\x89\x07\xa0f\xa8f\xb0\xa7\xb8\xa7\xa8f\xb0\x86\xb8\xa7\xb0f\xb8\x87\xb8\x86\xb8\xc7\x82\xb8\xa7\x03\xb0\xa7\xb0\xa7\xa9\x07\xf7\xde\x89\xff\xde\x08\xccR\xa0\x84\xa8\x84\xb0\x84\xb0\x84\xa8e\x98e\x88E\x88e\x82\x80e\x03\x88e\x80d\x80\x85x\xe5\x8a\xff\xde\x07\x9b+\x89`\x89\x80\x89\x80\x81\x80q`i\x81\xd6X\x8e\xff\xde\x04\xc6y\x02\xeb\x02\xeb\x03K\x03+\x83\x03l\x06\x03L\x03L\x03,\x03,\x02\xec\x03,\xc6\x9a\x8e\xff\xde\t\xd7\x1c\x03\x0f\x03/\x03\xb0\x03\xb0\x03\xb1\x03\xd1\x03\x91\x03\x91\xff\xbe\x89\xff\xde\x1e\x030\x03\xb2\x03\xd2\x04T\x04t\x04\xb5\x04\xd5\x04\xf5\x04\xd5\x04\xd5\x05\x16\x056\x05W\x056\x04\xd5\x04\xf6\x056\x056\x057\x05W\x057\x05X\x05\x17\rX\xbf=\xf7\xbe\xef\x9e\xf7\xde\xf7\xbe\xe7}\xf7\xde\x82\xff\xde\x00\xe7}\x88\xff\xde\x02\xef\xbeE\xfa\xae\xfc\x83\xff\xde\x00\xff\xdf\x8d\xff\xde\x01\xff\xdf\xff\xff\x84\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x90\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xfe\x89\xff\xde\x04\xff\xdf\xff\xdf\xff\xde\xff\xdf\xff\xdf\x86\xff\xde\x00\xff\xbe\x92\xff\xde\x00\xff]\x82\xff\xde\x11\xff<\xeaJ\xe2k\xe3\xaf\xeb\x0c\xe2\t\xeb\xf0\xea\xcc\xd1h\xda+\xebo\xd1\xa9\xd1H\xd1h\xc9\x08\xc9\x08\xc0\xc7\xef\x1c\x89\xff\xde\x01\x89\x07\xa0F\x82\xa8f\x08\xa8\x87\xb0\x87\xb0\x87\xb0f\xb8\xa7\xb8\x87\xb8\xa7\xb8\xa7\xb8\xc7\x82\xb0\xa7\x01\xa0\x86\xf7=\x89\xff\xde\x0b\xe6\xbb\x90C\x98d\xa0\x85\xa0d\x90e\x88E\x88E\x80exf\x80\x86\x80e\x82\x80\x85\x00\x8a\xab\x8a\xff\xde\x07y#\x81@\x89`\x89`y`Y@IB\xceX\x8e\xff\xde\x0e\xf7\xbe\n\x8a\x02\xeb\x03+\x03L\x03K\x03L\x03\x8c\x03\x8d\x03L\x03L\x03M\x03M\x02\xec\n\xcb\x8f\xff\xde\t\xd7\x1c\x02\xef\x03O\x03p\x03\x90\x03\xd1\x03\xd1\x03\xb1\x03P\xf7\xbe\x88\xff\xde\x10\xff\xfe\x0b\x11\x03\x92\x03\xd3\x03\xf3\x04T\x04t\x04\xb5\x04\xd6\x04\xf6\x04\xb5\x04\xf6\x04\xf6\x05\x16\x057\x04\xf6\x05\x16\x83\x05W\x12\x05\x17\x05X\x058\x86\x9b\xf7\xbe\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xef}\xf7\xbe\xff\xde\xff\xde\xe7}\x84\xff\xde\x02\xf7\xde\xbf=\xf7\xde\x84\xff\xde\x01\xff\xdf\xff\xdf\x84\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xfe\x82\xff\xde\x02\xff\xdf\xff\xdf\xff\xff\x85\xff\xde\x00\xff\xdf\x94\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\xa0\xff\xde\x00\xff\xdf\x85\xff\xde\x15\xff\xbe\xff\xde\xff\xbe\xff\xde\xe3\r\xe1h\xe1\x88\xe1\x87\xe1\xa8\xe1\xc9\xe1\xc9\xe1\xa8\xe1\xa9\xd9H\xd1\x07\xd9H\xd9\xca\xe2K\xd9\xca\xc9I\xc1\x08\xee\xfc\x88\xff\xde\x13\xf7\xde\x89\x07\xa0g\xa0\x87\xa0g\xa0f\xa0g\xb0\x88\xb0\x87\xb8\xa7\xb0\x87\xb0\x87\xb0\xa7\xb0\x87\xb8\xa7\xb0\xa7\xb0\x87\xb0\xa7\xa8\x87\xcdV\x89\xff\xde\x04\xf7\xbe\x80d\x88E\x90e\x90e\x82\x80E\x07xexexfpex\x85\x80\xa6x\x85\xc5\x14\x89\xff\xde\x04\xef\x1ba\x01q!\x81a\x81\x81\x82IB\x00\xceX\x8f\xff\xde\rS\xaf\x02\xcb\x02\xeb\x03,\x03,\x03L\x03l\x03l\x03,\x03,\x03\x0c\x03\r\x03\rT\x10\x86\xff\xde\x00\xff\xdf\x87\xff\xde\t\xd7\x1c\x03\x0f\x03P\x03p\x03p\x03\xd1\x03\xb1\x03\xb1\x03q\xf7\xbe\x88\xff\xde\x11\xff\xdf\x0b0\x03\xb3\x03\xd3\x03\x92\x04\x13\x04T\x04\xb5\x04\xd6\x05\x17\x04\xf6\x04\xf6\x05\x17\x05\x17\x04\xd6\x05\x17\x057\x05\x17\x82\x057\x12\x05X\x05X\x05y-\xda\xdf~f:\xef\xbe\xff\xde\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\xf7\xbe\x91\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x91\xff\xde\x00\xff\xdf\x91\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x82\xff\xde\x04\xff\xbe\xff}\xf4\x90\xf67\xff\xdf\x83\xff\xde\x13\xff\xbe\xff\xbe\xf6z\xe1g\xd9G\xe1g\xd9&\xe1\xa8\xe1\xa8\xd9\x88\xd9h\xd9\x89\xd9i\xd9\x89\xd9\xaa\xd1i\xd1i\xc9I\xb8\xe8\xef\x1c\x89\xff\xde\x12\x89\x07\x98g\x98g\xa0\x87\xa0g\xa0g\xa8\x88\xb0\xa8\xb0\xa8\xb0\xa7\xb0\xa7\xa8\x87\xb0\x87\xb0\xa7\xb0\xa7\xa8\x87\xa8\x87\xa0g\xa2K\x8a\xff\xde\x06\x81\xa8\x80e\x80E\x80E\x80exEpD\x83pe\x03x\x86p\x85he\xef\x1c\x89\xff\xde\x08\x9c\xd3Q#Y"ibAd\x11\x88)eAc\xceX\x8f\xff\xde\x0e\xc6\x9a\x02\xab\x03,\x03M\x03M\x03,\x03L\x03L\x03-\x03M\x03n\x03\r\x02\xcc\xc6\x9a\xff\xfe\x8e\xff\xde\t\xd7\x1c\x02\xef\x03/\x03p\x03\x91\x03\xd2\x03\xb1\x03\x91\x03P\xff\xbe\x89\xff\xde\x1b\x031\x03\xb3\x03\xb3\x03\x92\x03\xf3\x04U\x04\x96\x04\xd6\x04\xf6\x04\xf7\x04\xd6\x04\x96\x04\xb6\x04\xf7\x04\xd6\x04\xf7\x04\xf6\x04\xd6\x05\x17\x05X\x05\x99\x05\x99\x05y\x05YN;\xe7~\xf7\xde\xf7\xde\x83\xff\xde\x05\xf7\xbe\xf7\xde\xff\xde\xff\xff\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xdf\x87\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x8b\xff\xde\x00\xff\xfe\x8b\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xdf\x84\xff\xde\x04\xf6x\xf4\xf1\xfc\x0e\xf2\xe9\xff\x1c\x83\xff\xde\x82\xff\xbe\x10\xf5\x97\xe1\x88\xd9G\xd9G\xd1G\xd9\x88\xd9\xa9\xd1h\xd1i\xd9i\xd9\x89\xd9\x89\xd1I\xd1i\xc1\x08\xc0\xe8\xef\x1c\x89\xff\xde\x0b\x91\x07\x98f\xa0\x87\xa0\x87\xa8\xa8\xa8\x88\xa8\xa8\xa8\xa8\xb0\xc8\xb0\xc8\xb8\xc8\xb8\xc8\x82\xb0\xa7\x03\xa0g\xa0g\x98g\x88\xa6\x8a\xff\xde\x0e\xac\x11\x80ExE\x80exExepEhehep\x85pepep\x85`\xc5\xf7\xbe\x89\xff\xde\x08Z\'A#1E\t\xeb\x02,\x01\xca\x11\x87!E\xceX\x90\xff\xde\x05\n\x8b\x02\xec\x03\r\x03-\x03-\x02\xec\x82\x03-\x03\x03N\x03-\n\xcc\xf7\xbe\x8f\xff\xde\t\xd7\x1c\x03\x10\x03q\x03P\x03\x91\x03\x91\x03\x92\x03q\x03\x0f\xff\xbe\x88\xff\xde\x13\xff\xff\x0b1\x03\x93\x03\xb3\x03\xd3\x04\x14\x045\x04\x96\x04\xb6\x04\xd6\x04\xb6\x04\xb6\x04\xd7\x04\xb6\x04\xd7\x04\xf7\x04\xf7\x05\x17\x04\xb6\x05X\x82\x05\x99\n\x05Y\x05\x18-\xda\xf7\xde\xff\xdf\xf7\xde\xf7\xde\xff\xde\xff\xdf\xff\xde\xf7\xde\x8f\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\xb0\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x84\xff\xde\x03\xff\xff\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x84\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\x9d\xf68\xff\xde\xff\xff\x86\xff\xde\t\xff\xbe\xff\xde\xff\xdf\xf5\xb6\xebK\xff}\xff<\xff\xde\xff\xde\xff\xbe\x83\xff\xde\x02\xff\xbe\xff}\xd9\xc9\x82\xe1\xc9\x01\xd9\x88\xd9\x89\x82\xd1I\x06\xd1i\xd1)\xc9)\xc0\xe7\xc1\x08\xc0\xc8\xef\x1c\x89\xff\xde\x13\x89\x07\x98g\x98g\xa0\x87\xa0g\xa0\x87\xa0\x88\xa0\x88\xb0\xc9\xb0\xe9\xb9\t\xb8\xe9\xb0\xa8\xb0\xa8\xa0\x88\x98h\x98h\x98g\x90g\xe6\xbb\x89\xff\xde\r\xdez\x80e\x80e\x80\x85\x80epEhep\x85p\x85hep\x86h\x85h\xa6zk\x89\xff\xde\t\xff\xbe9#1$\x11\xa9\x02,\x02-\x01\xec\x01\xaa\t\xca\xceY\x90\xff\xde\x03d\x11\x02\xed\x02\xec\x02\xec\x82\x03\r\x04\x03o\x03N\x03.\x03\x0eT\x10\x90\xff\xde\t\xd7\x1c\x03\x10\x03\x91\x03\xd2\x03\x92\x03\xb2\x03\xb2\x03\x92\x03Q\xff\xbe\x88\xff\xde\x1e\xff\xdf\x0b\x11\x03r\x03\xb3\x03\xf4\x04\x14\x045\x04v\x04u\x04\xb6\x04\xf7\x04\xf7\x04\xb6\x04\xb6\x04\xd7\x04\xf8\x04\xf7\x05\x18\x058\x05\x99\x05\x99\x05y\x05y\r\x99E\xda\xdf\x9e\xff\xde\xff\xdf\xff\xde\xf7\xbe\xf7\xde\x88\xff\xde\x01\xff\xdf\xff\xdf\x8b\xff\xde\x00\xff\xfe\x88\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\xaa\xff\xde\x08\xff\xdf\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xff\x85\xff\xde\x1b\xff\x9e\xff\xbe\xff\xde\xff\xbe\xff\x9e\xff\xbe\xff\x9e\xff\xbe\xff\xde\xff\xbe\xff\xbe\xff\x9e\xec2\xd1h\xe1\xea\xe1\xea\xd9\xa9\xe1\xca\xd9\x8a\xc9\x08\xd9\x89\xd1I\xc9)\xd1i\xc9)\xb8\xe8\xc1\x08\xef\x1c\x89\xff\xde\x13\x89\x07\x98f\x98g\xa0g\xa0g\xa0\xa8\xa0\x88\xa0\x88\xb0\xe9\xb9*\xb9\t\xb0\xe9\xa8\xc9\xa0\x88\x98\x88\x98\x88\x98\xa9\x98\xa8\x90h\xbc\x11\x89\xff\xde\r\xf7\x9ex\x85\x80exexep\x86h\x85p\xa6p\xa6h\xa6h\xa6`\x86X\xa7\xb4\xf4\x89\xff\xde\t\xcey\x19\x88\x11i\x01\xec\x02-\x02.\x01\xec\x01\xeb\x01\xcb\xcez\x90\xff\xde\x05\xd6\xdb\x02\xcd\x02\xac\x02\xcd\x02\xed\x03\x0e\x82\x03.\x02\x03\x0e\x03\x0e\xc6\x9a\x8b\xff\xde\x00\xff\xdf\x83\xff\xde\t\xd7\x1c\x02\xf0\x03q\x03\x92\x03\xb2\x03\xd2\x03\x92\x03\x92\x03Q\xff\xbe\x88\xff\xde\x0e\xff\xff\x0b\x11\x03R\x03r\x03\xf4\x04U\x04V\x04\x96\x04\xb7\x04\xf7\x04\xf7\x04\xf8\x04\xf7\x04\x96\x04\xb6\x82\x04\xf7\x0c\x05X\x05y\x058\x05y\x15\x99\xae\xfc\xf7\xbe\xf7\xde\xff\xde\xff\xde\xef\xbe\xf7\xde\xf7\xbe\x87\xff\xde\x02\xf7\xde\xff\xde\xdf]\x8d\xff\xde\x00\xff\xff\x86\xff\xde\x01\xff\xdf\xff\xff\x95\xff\xde\x02\xff\xff\xff\xde\xff\xff\x89\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xf5v\x86\xff\xde\x00\xff\xbe\x82\xff\xde\x17\xff\xbe\xff<\xed\x14\xff}\xff\xbe\xff}\xff\x9e\xff\xbe\xff]\xd1\x89\xd9\xa9\xe1\xca\xd9\x89\xd9\xca\xd1\x8a\xd9\x8a\xd1j\xd9\x8a\xc9)\xd1j\xc1)\xc1\t\xb0\xa8\xee\xfc\x88\xff\xde\x04\xf7\xde\x89\x07\x98g\x98g\xa0\x87\x83\xa0\x88\x0b\xa8\x88\xb0\xc9\xa8\xc9\xa8\xa8\xa0\xa9\x98\x89\x98\x88\x98\x88\x90h\x90\x88\x90\x88\x91I\x8a\xff\xde\x0cy\x88pehehf`f`\x86`\x86`\xa7X\xa7X\xc7X\xe9H\xc8\xe7\x1c\x89\xff\xde\ts\xd0\t\x8a\x01\xab\x01\xec\x02.\x02N\x02\r\x02\x0c\x01\xec\xcez\x91\xff\xde\n\n\x8c\x02\xac\x02\xee\x02\xee\x03\x0e\x03/\x03\x0e\x03/\x03/\n\xcd\xf7\xbe\x90\xff\xde\t\xd7\x1c\x02\xf0\x03Q\x03\x92\x03\x92\x03\xb2\x03\xb3\x03r\x031\xff\xbe\x89\xff\xde\x1f\x0b\x11\x03R\x03s\x03\xd4\x03\xf4\x04V\x04v\x04\xb7\x04\xf7\x04\xd7\x04\xd7\x04\xf8\x04\xd7\x04\xd7\x04\xb7\x04\xf7\x04\xf7\x05\x18\x05y\x15\x99n{\xe7\x9e\xef\xbe\xf7\xbe\xf7\xbe\xff\xdf\xf7\xde\xdf\x9e\xae\xdc\xf7\xde\xf7\xbe\xf7\xde\x87\xff\xde\x00\xef\xbe\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x04\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xfe\x97\xff\xde\x00\xff\xdf\xb6\xff\xde\x00\xff}\x87\xff\xde\x19\xff\xbe\xff\xde\xff\xbe\xff\x9e\xe3-\xf6\x9a\xff\xbe\xff\xbe\xff\x9e\xff\x9e\xff]\xe2\xad\xd9\x89\xe1\xca\xd9\xca\xd1\x8a\xe2\x0c\xd9\xcb\xd9\xab\xd1\x8a\xc9I\xc0\xe8\xc1)\xb9\t\xb0\xc8\xee\xfc\x88\xff\xde\x03\xf7\xde\x89\x07\x98g\x98g\x82\xa0\x87\x03\xa8\xa8\xa8\xc9\xa8\xc9\xa8\xa9\x82\xa0\xa9\x07\x90h\x90\x88\x90\x89\x90\x89\x90\x88\x90\x88\x90g\xf7]\x89\xff\xde\x0b\x9b\xd0`FXEX\x86P\x86P\xa7P\xc8P\xe9@\xc9@\xea8\xc99\x08\x8a\xff\xde\t!\xea\t\xab\t\xab\x02\r\x02o\x02o\x02.\x02-\x02-\xcez\x91\xff\xde\tl2\x02\xce\x02\xee\x03/\x03\x0f\x03/\x03\x0f\x02\xee\x02\xeeS\xf1\x91\xff\xde\t\xd6\xfc\x02\xd0\x030\x03r\x03\x92\x03\xb3\x03\x92\x03\x92\x03Q\xf7\xbe\x88\xff\xde!\xff\xfe\n\xf1\x03R\x03S\x03\xb4\x03\x94\x045\x04V\x04\x97\x04\xd7\x04\xd7\x04\xb7\x04\xb7\x04\xd7\x04\xb7\x04\x97\x04\xb7\x04\xd7\x04V\x05\x18\xb7\x1d\xcf=\xe7}\xe7\x9e\xf7\xbe\xf7\xbe\xf7\xde\xa6\xdc\x059\x05\x19^\x1a\xf7\xde\xff\xdf\xff\xdf\x8a\xff\xde\x00\xff\xdf\x8b\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x9a\xff\xde\x03\xff\xdf\xff\xdf\xff\xde\xff\xbe\x85\xff\xde\x01\xff\xbe\xff\xde\x83\xff\xbe\x13\xff\xde\xff\xbe\xff\x9e\xff\xbe\xf5\x97\xd9\xaa\xd9\xaa\xd9\xcb\xd9\x8a\xd1j\xd9\xac\xd9\xac\xd1j\xd1j\xc1)\xc1\t\xc1\t\xb9\t\xb0\xc8\xef\x1c\x89\xff\xde\x14\x89\x07\x98g\x98f\x98g\x98\x87\xa0\x87\xa8\x88\xa0h\xa0h\xa0\xa9\xa8\xa9\xa0\xa9\xa0\xa9\x98\xa9\x90\x88\x90\x89\x90\xa9\x90\x89\x88\x88\x90\x88\xcdV\x89\xff\xde\x0b\xd69XfPFHg@\x87@\xa9H\xeaA\x0b8\xeb0\xeb1\x0bb\xae\x89\xff\xde\n\xef\\\x01\xab\x01\xed\x01\xed\x02.\x02O\x02O\x02N\x02.\x02-\xce\x9a\x91\xff\xde\t\xd6\xfb\x02\xae\x03\x0f\x03/\x03\x0f\x03\x0f\x02\xef\x03\x0f\x02\xce\xbez\x91\xff\xde\t\xd7\x1c\x02\xb0\x031\x03\x92\x03\x93\x03\xb3\x03\xb3\x03\x92\x0bQ\xff\xbe\x89\xff\xde\t\n\xd0\x02\xf2\x02\xf2\x03\xb4\x04\x15\x04V\x04v\x04v\x04\xb7\x04\xd7\x82\x04\xd8\x13\x04\xb7\x04\x97\x04\xb8\x04\xb7\x04\xd8\x04\xb7\x14\xf8\xcf=\xf7\xde\xef\x9e\xef\xbe\xef\x9e\xf7\xdf\xc7^\r9~|\xef\xbe\xf7\xbe\xf7\xbe\xf7\xde\x83\xff\xde\x00\xff\xbe\x87\xff\xde\x06\xe7}\xf7\xde\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x98\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xdf\x88\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xdf\x8e\xff\xde\x05\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x91\xff\xde\x17\xff\xbe\xff\xdf\xff\xbe\xff]\xf7\x9e\xff\xbe\xff\xbe\xff\x9e\xda\xad\xd1i\xd1I\xd9\xab\xd1\x8a\xd1k\xc9*\xd1K\xc9J\xd1\x8b\xc1*\xc1\n\xc1\n\xb9\t\xb8\xc9\xee\xfc\x89\xff\xde\x00\x80\xe7\x82\x98g\x10\xa0\xa8\xa0\x88\xa0g\xa0\x88\xa0\x88\x98h\xa8\xa9\xa0\xa9\x98\xa9\x98\x89\x90h\x90\x89\x90\x89\x88\x89\x88\x88\x88\x88\x8al\x89\xff\xde\x0b\xf7\x9e@f8\x870g8\xa98\xca8\xeb9\x0b0\xeb(\xeb \xeb\xad\x15\x89\xff\xde\n\xa56\x01\xcc\x02\x0e\x01\xed\x02/\x02O\x02o\x02O\x02N\x02\r\xcez\x88\xff\xde\x00\xe7<\x88\xff\xde\x08\x12\x8d\x03\x0f\x03\x0f\x030\x03\x0f\x03\x0f\x02\xef\n\xae\xf7\xbe\x87\xff\xde\x00\xce\x9a\x88\xff\xde\x04\xd7\x1c\x02\xd0\x02\xf0\x03R\x03\x93\x82\x03\xb3\x00\x0bQ\x8a\xff\xde\r\n\xd1\x032\x03S\x03\x94\x04\x16\x046\x04\x15\x04V\x04\xb7\x04\xb7\x04\xd8\x04v\x04\x97\x04\x97\x82\x04\xb8\x12\x04\x97\x04\xd8\x046\xbf\x1d\xf7\xbe\xef\xbe\xe7~\xf7\xbf\xd7~\xef\xbe\xe7\x9e\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xf7\xde\x8b\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xff\x87\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xfe\xaa\xff\xde\x02\xff\xbe\xff\xde\xff\xde\x84\xff\xbe\x16\xe3\xb1\xd1\xeb\xd9\xca\xd2+\xedV\xff\x9e\xff\x9e\xe3\x8f\xd1\x8a\xd1\x8a\xd1\x8b\xd1j\xc9J\xc9K\xc9J\xc9J\xc1\n\xc1\t\xc1\n\xb9\n\xb0\xe9\xa8\xa9\xee\xfc\x89\xff\xde\x01\x89\x08\x98\x88\x82\x98g\x10\xa0\x88\xa8\xa9\xa0\x88\xa0\x88\xa0h\xa0\x89\xa0\xa9\xa0\xca\xa0\xaa\x98\xa9\x90\x89\x90\x89\x88\x89\x80\x89\x80\x89h\xa7\xf7\xbe\x89\xff\xde\nIi0\x880\xa98\xca0\xea9\x0c(\xeb)\x0b(\xeb\x18\xeb\xe7<\x89\xff\xde\nB\x8d\x01\xac\x01\xed\x01\xee\x02\x0e\x02\x0e\x02/\x02O\x02\r\x02\r\xce\x9a\x88\xff\xde\x01\xd6\xba\xef}\x87\xff\xde\x07ts\x02\xaf\x02\xcf\x03\x0f\x030\x03\x10\x02\xefK\xb1\x88\xff\xde\x00\x8c\x93\x88\xff\xde\x08\xd7\x1c\x02\xaf\x02\xf0\x03\x11\x03R\x03R\x031\x032\x03\x11\x89\xff\xde\x01\xff\xdf\n\xd1\x82\x03S\x07\x03\xd5\x046\x04V\x04\x16\x04\x97\x04\x97\x04\xb8\x04\xd8\x82\x04\xb8\x16\x04\xf9\x04\xf9\x04\xd8\x05\x1958\xef\x9e\xf7\xbe\x96\x9c\xdf\x9e\xe7\x9e\xdf\x9e\xf7\xbe\xff\xde\xef\x9e\xf7\xde\xf7\xbe\xef\x9e\xef\xbe\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xde\x83\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x91\xff\xde\x00\xff\xdf\x89\xff\xde\x01\xff\xff\xff\xff\x84\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xff\x92\xff\xde\x0e\xff]\xd1\xab\xe1\xeb\xd9\x8a\xe1\xaa\xd9\x8a\xeaL\xed\x97\xff~\xf6\xdb\xd1\xaa\xc9J\xc9j\xc1\t\xc9K\x82\xc9*\x06\xc9J\xc1\n\xc1*\xb9\n\xb0\xea\xa8\xa9\xef\x1c\x89\xff\xde\x15\x81\x07\x90g\x98g\x98g\xa0\x88\xa8\x88\xa8\xa9\xa8\xa8\xa8\xa9\xa0\x88\x98h\x98\x89\x98\x89\x98\xa9\x90\x89\x90\xaa\x88\x89\x80i\x80\x89x\x89ph\xe6\xbb\x89\xff\xde\t{\x900\xa90\xca8\xeb1\x0b)\x0b)\x0c),)-\x19\x0b\x89\xff\xde\x0b\xf7\xbe\t\x8b\x01\xac\x01\xcd\x01\xee\x02\x0e\x01\xee\x02/\x02O\x02\x0e\x02\x0e\xcez\x88\xff\xde\x01\xe7\x1c\x9d6\x87\xff\xde\x07\xdf<\x02\x8e\x02\xcf\x02\xef\x030\x03\x10\x02\xcf\xbe9\x87\xff\xde\x01\xd6\xdb\x84\xd5\x88\xff\xde\t\xd7\x1c\x02o\x02\xb0\x02\xd1\x02\x8f\x02\xd0\x03\x12\x03s\x03\x11\xff\xbe\x89\xff\xde\x03\n\xd1\x033\x03t\x03\x94\x82\x046 \x04w\x04v\x04\x97\x04w\x04\x97\x04\xb8\x04\x98\x04w\x04\xd8\x04\xf9\x04\xd9\x04\xd8\x04w\x96{\xf7\xbe\x9e\xbc\xcf^\xcf=\xf7\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\xef\xbe\xf7\xde\xf7\xbe\xff\xde\xf7\xde\xc7^v|\xf7\xde\xff\xde\xf7\xde\x82\xff\xde\x00\xf7\xbe\x85\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xdf\x90\xff\xde\x04\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\xa0\xff\xde\x82\xff\xdf\x85\xff\xde\x01\xff\xdf\xff\xdf\x8a\xff\xde\x05\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xe43\x82\xe1\xec\x0b\xe2\x0c\xe2M\xe2\xae\xeb\xd1\xec\x94\xecs\xc9j\xd1j\xd1j\xd1k\xc9J\xc9J\x83\xc1\n\x04\xc1*\xb9\n\xa8\xc9\xa0\x89\xee\xfc\x89\xff\xde\x15\x80\xe7\x90g\x90g\x98\x88\x98h\xa0\x88\xa0\x88\xa8\xa8\xa0\x88\x98h\x98\x88\x98\x89\x98\xa9\x90\x89\x88h\x90\xa9\x88\xaa\x80\xaax\x89x\x89pi\xa42\x89\xff\xde\t\xce90\xca1\x0c0\xeb1\x0c)\x0c!\x0b!\x0c\x19\x0cJo\x89\xff\xde\x03\xcez\x01\xac\x01\xac\x01\xcd\x82\x01\xee\x04\x02\x0e\x02/\x02\x0e\x01\xed\xcez\x88\xff\xde\x01\xe7\x1b*l\x88\xff\xde\x05\x1a\x8d\x02\xae\x02\xcf\x02\xef\x02\xcf\nn\x88\xff\xde\x01l3\x84\xd4\x88\xff\xde\t\xd7\x1c\x02\xb0\x03\x12\x03\x12\x02\xd1\x02\xd1\x03\x12\x03\x12\x02\xd1\xff\xbe\x89\xff\xde\x05\x02\xd1\x03T\x03\x94\x03\xb5\x03\xf6\x047\x82\x04W\x1c\x04w\x04w\x04\x98\x04\xb8\x04\xb8\x04w\x04\xd9\x04\xd9\x04\xf9\x04\xf9\x04\xb8\x86[\xf7\xbe\xf7\xbe\xf7\xdf\xf7\xdf\xef\xbe\xdf~\xff\xdf\xf7\xbe\xf7\xbe\xf7\xde\xff\xdf\xff\xde\xff\xde\xef\xbe=\xfaf[\xf7\xde\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8a\xff\xde\x01\xff\xff\xff\xdf\x83\xff\xde\x00\xff\xfe\x83\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x84\xff\xde\x1e\xff\xbe\xff\xde\xff\xde\xf6\xfb\xff\xde\xff\xbe\xe4\xd5\xd9\xab\xe2-\xd9\xcb\xd9\xcc\xda\x0c\xe2\xae\xeb\x0f\xebP\xda,\xd9\xec\xd1\xab\xd1\x8b\xc9J\xc9\t\xc9*\xc1\n\xc1\n\xc9K\xc9K\xb9\n\xa8\xc9\xa8\xca\xa8\xc9\xef\x1c\x89\xff\xde\x15\x88\xe8\x80&\x90g\x98\x88\xa0\x88\xa0\xa9\xa8\xa9\xa0\x88\xa0\xa9\x98h\x90h\x90\x89\x98\x89\x90\x89\x88\x89\x80\x89\x80\xaa\x80\x8ax\x8ap\x8a`iaI\x89\xff\xde\t\xf7\xbe \x88(\xcb(\xeb(\xeb \xeb!\x0c!-\x19-\x9c\xd5\x89\xff\xde\x0bk\xb1\x01\xad\x01\xce\x01\xce\x01\xee\x01\xce\x02\x0f\x02/\x02\x0f\x01\xee\x01\xcd\xcez\x88\xff\xde\x02\xe7\x1c\x01\xec\xef\x9d\x87\xff\xde\x05|\xd5\x02\xae\x02\xaf\x02\xcf\x02\xcfK\x91\x88\xff\xde\x01\x12n\x84\xd4\x88\xff\xde\t\xd7\x1c\x02\xb0\x03\x12\x03\x12\x02\xf1\x02\xd1\x02\xd1\x033\x02\xd1\xff\xbe\x89\xff\xde\x0b\x02\xf2\x03T\x03\x95\x03\xb5\x03\xf6\x04\x17\x047\x03\xf6\x033\x03\x94\x03\xf6\x04W\x82\x04\x98\x82\x04\xd9\x03\x05:\x04\xd9\x15\x19\xc7=\x82\xf7\xbe\x02\xef\xbe\xf7\xde\xf7\xbe\x8e\xff\xde\x00\xff\xdf\x9b\xff\xde\x02\xff\xff\xff\xde\xff\xdf\xa0\xff\xde\x00\xff\xdf\x89\xff\xde\x01\xff\xfe\xff\xdf\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x1e\xff\xbe\xf7}\xf7\x9e\xf6\xfb\xff\xde\xff\xde\xff\xbe\xe3\x91\xe2-\xd9\xec\xd9\xcc\xe2m\xe2\xaf\xe2n\xe2\x8e\xd1\xec\xda\x0c\xd9\xcc\xd1\xac\xd1K\xc0\xe9\xc9\n\xc9k\xc9+\xc1+\xc1+\xb8\xea\xb0\xea\xa8\xea\xa8\xa9\xef\x1c\x88\xff\xde\x17\xf7\xde\x81\x08\x90g\x90g\x98h\x98\x88\xa0\x88\xa8\xa9\xa0\xa9\xa0\x88\x98\x88\x98\xa9\x98\x89\x98\xca\x90\x89\x88\x89\x88\xaa\x88\xaax\x89x\x8apjh\x8aPh\xf7\x9e\x89\xff\xde\x089\x8b(\xec)\r!\x0c!-!\r\x19-\x10\xec\xe7\x1c\x89\xff\xde\x0b\x19\xac\x01\x8c\x01\x8d\x01\xce\x01\xee\x02\x0f\x020\x02\x0f\x02/\x02\x0e\x02\x0e\xcez\x88\xff\xde\x02\xdf\x1c\x02\x0c\x9dV\x87\xff\xde\x05\xe7<\x02\x8e\x02\xaf\x02\xaf\x02\xcf\xbeZ\x87\xff\xde\x02\xce\x9a\x02o\x84\xd5\x88\xff\xde\t\xd7\x1c\x02\xb0\x02\xd1\x02\xf2\x02\xd2\x02\xf2\x02\xd1\x03\x13\x02\xb1\xff\xbe\x88\xff\xde\r\xff\xdf\x02\xf2\x033\x03\x95\x03\xb5\x03\xd6\x03\xf6\x04\x17\x03\xd6\x03\xb6\x03\xb5\x03\xf6\x04W\x04X\x82\x04\xb9\x00\x04\xd9\x82\x04\xf9\x05\x04\xd8\x04\xf9=\x9af;\xdf}\xae\xdc\x82\xf7\xbe\x00\xf7\xde\x85\xff\xde\x00\xf7\xde\x8e\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x8b\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xdf\x8c\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x94\xff\xde\x02\xff\xdf\xff\xff\xff\xdf\x85\xff\xde\x00\xff\xff\x8e\xff\xde\x1e\xff\x9e\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xbe\xff]\xec\x94\xd9\xab\xd9\xab\xe2\xce\xe2\x8e\xda-\xe2n\xd1\xac\xd9\xed\xd9\xac\xd9\xac\xc9K\xd1k\xc9K\xc9K\xc1+\xc1+\xb9\x0b\xb9\x0b\xb0\xea\xb1\x0b\xa0\xa9\xee\xfc\x89\xff\xde\x16\x81\x08\x90G\x90h\x98h\x98h\xa0\x88\xa0\x89\xa8\xa9\xa0\x88\x98\x88\x98\x89\x90\x89\x90\xaa\x90\xaa\x88\x8a\x88\x8a\x80\x8a\x80\xabx\xabp\xabh\x8a`\x8a\xc5\xd8\x89\xff\xde\x07sq \xec)\r \xed\x19\r\x19\r\x11\r\x10\xea\x89\xff\xde\x0c\xef]\x01l\x01\xad\x01\xae\x01\xce\x02\x0f\x01\xce\x02\x0f\x02/\x02\x0f\x02\x0e\x01\xee\xcez\x88\xff\xde\x02\xe7\x1c\x02\r*\xad\x88\xff\xde\x04"\xce\x02\xaf\x02\xaf\nm\xf7\xbe\x87\xff\xde\x02[\xf2\x02\x8f\x84\xd5\x88\xff\xde\x00\xd6\xfc\x82\x02\xd1\x05\x02\xf2\x02\xd1\x03\x13\x033\n\xb1\xff\xbe\x89\xff\xde\x11\x02\xd2\x03T\x03\x95\x03\xb5\x03\xf6\x03\xd6\x03\xf7\x03\xd6\x03\xb5\x03\xb5\x047\x04\xb9\x04\x98\x04x\x04\x98\x04\x98\x04\xb9\x04\xf9\x82\x05\x19\x0b\x04\xd9\x04\xd9%\x9a\xdf~\xf7\xbe\xff\xdf\xf7\xbe\xff\xdf\xf7\xde\xf7\xbe\xf7\xde\xef\xbe\x82\xff\xde\x01\xf7\xbe\xe7\x9e\x93\xff\xde\x01\xff\xdf\xff\xdf\x8d\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xff\x87\xff\xde\x02\xff\xff\xff\xdf\xff\xff\x83\xff\xde\x00\xff\xdf\x9a\xff\xde\x00\xff\xdf\x82\xff\xde\x05\xff\xff\xff\xde\xff\xde\xff\xff\xff\xde\xff\xdf\x8f\xff\xde\x08\xff\xbe\xff\xbe\xff\x9e\xff\x9e\xf6{\xf6Z\xff\xbe\xff\x1c\xec\xb5\x82\xd9\xcc\r\xd9\xcd\xd9\xac\xd9\xac\xd9\xcd\xd1k\xc9k\xc1+\xc1+\xb9\x0b\xb0\xeb\xa8\xca\xa8\xca\xa8\xea\xee\xfc\x89\xff\xde\x16\x81\x08\x90h\x90h\x98\x88\xa0\x88\xa0\x89\xa8\xa9\xa0\xa9\x98\x88\x90h\x98\xaa\x88i\x88\x8a\x88\x89\x88\x8a\x88\x8a\x80\x8a\x80\xcbx\xabp\xabh\xab`\x8az\xce\x89\xff\xde\x07\xc6\x18!\x0c!.\x19-\x19\x0c\x19\r\x11-Bo\x89\xff\xde\x0c\xa56\x01\x8d\x01\x8d\x01\xae\x01\xce\x01\xcf\x02\x10\x020\x02\x0f\x01\xee\x01\xee\x01\xcd\xce\x9a\x88\xff\xde\x03\xe7\x1c\x02-\x02,\xef}\x87\xff\xde\x03\x84\xd4\x02\xaf\x02\x8eKp\x87\xff\xde\x03\xf7\xde\nN\x02\x8f|\xd5\x88\xff\xde\t\xd7\x1c\x02\x90\x02\xf2\x02\xf2\x02\xd2\x02\xf2\x03\x13\x02\xf2\n\xd1\xf7\xbe\x89\xff\xde!\x02\xd2\x03T\x03\x95\x03\xd6\x03\xd6\x03\xf6\x03\xf7\x03\xf7\x04\x17\x04\x17\x04X\x04x\x04\xb9\x04\x98\x04\x99\x04\xb9\x04\x99\x04\xf9\x05:\x05\x19\x05\x1a\x05\x19\x04\xd9\x04\xd9-\x9a\xd7~\xf7\xde\xff\xdf\xf7\xde\xff\xde\x8e[\x14\xf9\x04\xb8\xae\xfd\x82\xff\xde\x00\xf7\xde\x83\xff\xde\x00\xf7\xbe\x84\xff\xde\x00\xff\xdf\x8e\xff\xde\x01\xff\xdf\xff\xff\xa7\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x01\xff\xdf\xff\xdf\x8a\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x08\xff\xdf\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xff\x9e\x82\xff\xbe\x82\xff\x9e\x0e\xff\xbe\xff\x9e\xff~\xec\xb5\xd1\xac\xd9\xcd\xda\x0e\xd9\xed\xda\r\xd9\xed\xd1\xcd\xd1l\xc9l\xc9L\xc1,\x82\xb0\xeb\x02\xa8\xea\xa8\xca\xee\xfc\x89\xff\xde\n\x81\x08\x80hxG\x80h\x98\x89\x98\x89\xa0\xa9\x98\x89\x90\x89\x90\x8a\x90\xaa\x83\x88\x8a\x07\x88\xab\x80\xab\x80\xccp\x8bp\xabh\xccX\xabP\xc9\x89\xff\xde\x07\xf7\xbe\x18\xec!\r\x19-\x19.\x19.\x11.\x9c\xd5\x89\xff\xde\x06B\xae\x01\x8d\x01\xad\x01\xae\x01\xae\x01\xef\x02\x10\x82\x02\x0f\x02\x01\xce\x01\xee\xce\x9a\x88\xff\xde\x03\xe7\x1c\x02\r\x02M\x95\x15\x87\xff\xde\x03\xe7]\x02n\x02\x8f\xbeY\x86\xff\xde\x04\xff\xdf\xc6z\x02o\x02\x8f\x84\xd5\x88\xff\xde\x03\xd7\x1c\x02\x90\x02\x90\x02\xf2\x82\x03\x13\x02\x033\x02\xf2\xf7\xde\x89\xff\xde!\n\xf2\x03t\x03\xb5\x03\x95\x03\xd6\x03\x95\x03\x96\x03\xf7\x04\x17\x04\x17\x04X\x04\x98\x04\x98\x04\xb9\x04\xd9\x04\xd9\x04\x99\x04\x98\x04\xb9\x04\xfa\x05Z\x05Z\x05\x1a\x04\xb9\x04\xd9\x159\xe7\x9e\xf7\xde\xe7\x9e\x8e\xbc\x04\xb9\x04\xb8\x04\xf9My\x89\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xff\x87\xff\xde\x00\xff\xdf\x8b\xff\xde\x03\xff\xdf\xff\xff\xff\xde\xff\xfe\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x8e\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff}\x82\xff\xde\x00\xff\x9e\x82\xff\xbe\x16\xff\x9e\xff\xbe\xff}\xff\x9e\xff~\xe3\x92\xc9\xad\xc9\xad\xd1\x8c\xc9k\xc9\x8c\xd1\x8c\xc9l\xd1\xad\xb9,\xc1L\xb9L\xb1\x0b\xb0\xeb\xb0\xeb\xa0\xcb\xa8\xcb\xee\xfc\x89\xff\xde\x17q\x08hGphx\x89\x80\x89\x88\x89\x80H\x88\x8a\x88\xaa\x90\xab\x90\xcb\x88\xaa\x80\x8a\x80\xab\x80\xabx\xabx\xabx\xccp\xabh\xcc`\xacX\xabH\x8a\xe6\xfc\x89\xff\xde\x061l!\r\x19-\x19.\x11\x0e\x11\r\xe7\x1c\x88\xff\xde\r\xf7\xde\tk\x01\x8d\x01\x8d\x01\xae\x01\xef\x01\xef\x01\xf0\x02\x0f\x01\xef\x02\x0f\x01\xee\x01\xce\xcez\x88\xff\xde\x04\xdf\x1c\x01\xed\x02-"\x8e\xff\xdf\x87\xff\xde\x02"\xaf\nN\xf7\xbe\x87\xff\xde\x03S\xb2\x02\xaf\x02\xaf|\xd5\x88\xff\xde\t\xd7\x1c\x02\x90\x02\xf2\x02\xf2\x03\x13\x034\x034\x033\n\xf2\xff\xbe\x88\xff\xde\n\xff\xdf\n\xd2\x03T\x03\x95\x03\xb6\x03\x95\x03\x96\x03\xd6\x03\xb6\x03\xf7\x047\x82\x04x\x14\x04\x99\x04\xb9\x04\xd9\x04\xd9\x04\xb9\x04x\x04\x98\x04\xd9\x05Z\x04\xd9\x04\xb9\x0c\xf9v;\xf7\xbe\xff\xdf\xf7\xbe\xf7\xdfUy\x1c\xd9U\xda\xf7\xbe\x84\xff\xde\x01\xf7\xde\xf7\xbe\x86\xff\xde\x01\xff\xff\xff\xff\x94\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xff\xdf\xa4\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8b\xff\xde\x04\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xbe\x82\xff\xde\x1a\xff\x9e\xff\xbe\xff~\xff\x9e\xff\xbe\xff\xbe\xf7=\xff]\xf7\x1d\xcaO\xc1L\xc9\x8d\xc9L\xc1+\xc1+\xc9\x8d\xc1m\xc1L\xb9,\xb9\x0c\xb1\x0c\xb1\x0c\xb0\xeb\xa8\xeb\xa0\xcb\xa0\xaa\xee\xfc\x89\xff\xde\x17q\x08pHpix\x89x\x8ax\x89\x80\x8a\x80\x8a\x90\xec\x90\xcc\x88\xab\x90\xcc\x80\xab\x80\xacx\xacp\xcch\xach\xcch\xach\xac`\xacP\x8b@i\x9cs\x88\xff\xde\x06\xff\xbes\x91\x19\r\x19\r\x19.\x19.\x19-\x89\xff\xde\r\xd6\xbb\x01\x8d\x01\xad\x01\xce\x01\xcf\x01\xcf\x01\xf0\x01\xef\x02\x10\x02\x0f\x02\x0f\x01\xee\x02\x0e\xcez\x88\xff\xde\x04\xdf\x1c\x02\r\x02.\x02-\xe7=\x87\xff\xde\x01\x8d\x16S\xb2\x88\xff\xde\x03\x02N\x02\x8f\x02\x90|\xd5\x88\xff\xde\t\xd7\x1c\x02\x90\x02\xb1\x02\xf2\x02\xf2\x034\x03T\x03T\n\xf2\xff\xbe\x89\xff\xde\x01\x02\xd2\x034\x82\x03u\x18\x03\x95\x03\xd6\x03\xf6\x04\x17\x04W\x04x\x04\x98\x04x\x04\xb9\x04\xd9\x04\xb9\x04\xd9\x04\x98\x04\x99\x04\xb9\x04\xd9\x04\xfa\x04\xf95z\xdf\x9e\xf7\xbe\xff\xdf\xff\xde\xf7\xde\xf7\xbe\x88\xff\xde\x06\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x84\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\xab\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x02\xff}\xda\xae\xf6z\x8a\xff\xde\x02\xff\xbe\xff\xde\xff\xde\x82\xff\xbe\x17\xf7\x1d\xff}\xff~\xf7~\xff\x9e\xff\xbe\xff~\xd2\xd0\xe3\x92\xdb1\xdaP\xd2O\xb9\x0b\xb9,\xb9-\xb1\x0c\xb1\x0c\xa8\xeb\xb1\x0c\xb1\x0c\xa8\xeb\xa0\xcb\xa0\xaa\xef\x1c\x88\xff\xde\x08\xf7\xdeq\tphpip\x8ax\x8a\x80\x8a\x80\xab\x88\xcb\x82\x88\xab\x0c\x80\xac\x80\xedp\xccp\xed`\x8bh\xcc`\xcch\xcd`\xacX\xacPj8iQ\xab\x89\xff\xde\x05\xc69\x19\r\x19-\x19.\x19.R\xd0\x89\xff\xde\r|\x13\x01\xae\x01\xce\x01\xef\x01\xcf\x01\xef\x01\xef\x01\xcf\x01\xef\x02\x10\x02\x10\x02\x0f\x02\x0f\xcez\x88\xff\xde\x04\xe7\x1c\x02\r\x02.\x02n\x84\xb4\x90\xff\xde\x05\xff\xdf\xbe9\x02\x8f\x02\x8f\x02\x90|\xd5\x88\xff\xde\t\xd7\x1c\x02\x90\x02\xd2\x02\xf3\x03\x13\x034\x03T\x03T\x03\x13\xf7\xbe\x88\xff\xde\x0f\xff\xdf\x02\xd2\x034\x03u\x03\x95\x03\xb6\x03\xd6\x03\xd6\x047\x047\x04X\x04X\x04\x98\x04\xb9\x04\xb9\x04\xd9\x84\x04\xb9\t\x04\xd9\x04\xd9\x86\x9c\xe7\x9e\xef\x9e\xe7~\xef\xbe\xf7\xde\xf7\xde\xef\x9e\x83\xff\xde\x03\xff\xdf\xff\xde\xf7\xbe\xf7\xbe\x98\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\xa7\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x87\xff\xde\x00\xff\xdf\x83\xff\xde\t\xff\xdf\xff\xde\xf5\x97\xf7\x1c\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xbe\xff\xdf\x86\xff\xde\x03\xff\xbe\xff\xbe\xff\xde\xff\xbe\x82\xff\x9e\x0e\xff~\xff\xbe\xff}\xff\xbe\xed\xb9\xd3s\xf6\xbc\xf6\xdc\xdb\x93\xb1,\xb0\xeb\xb1,\xa8\xec\xb1\x0c\xb9-\x82\xb1\x0c\x02\xa8\xec\xa8\xcb\xee\xfb\x89\xff\xde\x10i\tpipIpi\x80\xab\x80\xaa\x88\xab\x90\xcc\x90\xec\x88\xcc\x80\xcc\x80\xedx\xcdp\xedh\xcdh\xed`\xcd\x82h\xcd\x04X\x8bP\x8b@\x8a8\xaa\xf7}\x88\xff\xde\x05\xf7\x9e!\r\x19\r\x19.\x19.\xa56\x89\xff\xde\x02!\xee\x01\xcf\x01\xae\x84\x01\xf0\x05\x02\x10\x02\x10\x01\xef\x02\x0f\x01\xee\xce\x9a\x88\xff\xde\x04\xe7\x1c\x02.\x02N\x02n\x1aN\x91\xff\xde\x04Kq\x02o\x02o\x02\x90\x84\xf6\x88\xff\xde\t\xd7\x1c\x02\xb1\x02\xd2\x02\xf3\x03\x13\x03\x13\x034\x034\x02\xd2\xf7\xbe\x89\xff\xde \x02\xd2\x03t\x03u\x03\x95\x03\x95\x03\xd6\x04X\x047\x04x\x04x\x04\x99\x04\x99\x04\xd9\x04\xb9\x04\x99\x04y\x04X\x04x\x04\xb9\x04\xb9\r\x19E\xda\xd7=\xc6\xfc\xef\x9ee\xda\xbf\x1d\xc7=\xf7\xdf\xf7\xde\xff\xde\xf7\xbe\xf7\xde\x8a\xff\xde\x04\xbf\x1d\xd7^\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xdf\x8b\xff\xde\x01\xff\xdf\xff\xff\x88\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x8d\xff\xde\x01\xff\xdf\xff\xdf\x9f\xff\xde\x03\xff\xbe\xff\xbe\xe3/\xed\xb8\x82\xff\xbe\x0b\xf7]\xff\x9e\xff\x9e\xff]\xff\x9e\xff~\xff\x9e\xff\x9e\xd3\xd3\xc2\x0f\xdc5\xcaO\x82\xb9M\x08\xb1,\xb1\x0c\xb9-\xb9-\xb1\x0c\xa9\x0c\xa9\x0c\xa8\xec\xee\xfb\x89\xff\xde\x18h\xe9pip\x8ax\x8a\x80\x8a\x88\xab\x88\xcb\x90\xec\x88\xcc\x80\xec\x81\rx\xedh\xadh\xcd`\xac`\xcd`\xcdh\xed`\xcd`\xccX\xacP\x8bH\xccH\xab\xc5\xd8\x89\xff\xde\x049\xce\x19\r\x19\r\x11\r\xe7<\x88\xff\xde\x01\xef}\x01\x8e\x82\x01\xcf\x84\x01\xf0\x04\x02\x10\x01\xef\x02\x0f\x01\xee\xcez\x88\xff\xde\x05\xdf\x1c\x02\x0e\x02o\x02N\x02.\xdf\x1c\x8f\xff\xde\x05\xf7\xbe\x02N\x02\x90\x02\xb0\x02o\x84\xd5\x88\xff\xde\t\xdf\x1c\x02\xb1\x02\xd2\x03\x13\x03\x14\x034\x02\xf3\x02\xf3\x02\xb2\xff\xbe\x88\xff\xde\x1c\xff\xdf\n\xb2\x034\x03u\x03\x96\x03\x96\x04X\x04X\x04\x17\x04x\x04\xb9\x04\xb9\x04\xd9\x04\xb9\x04\x99\x04x\x04X\x048\x048\x04\x99\x04X\x15\x1a\xd7]\xef\x9e\xd7^\xef\xbe\xf7\xdf\xf7\xdf\xf7\xbe\x83\xf7\xde\x89\xff\xde\x05\xf7\xbe\xd7~\x05[\rZ\xe7\x9e\xf7\xde\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x89\xff\xde\x00\xff\xff\x8e\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x8d\xff\xde\x04\xff\xbe\xff\xde\xff\xde\xff\xdf\xff\xdf\x89\xff\xde\x00\xff\xdf\x82\xff\xbe\x1c\xe3\xd1\xe2\xef\xf6\xdb\xff\xbe\xff\x9e\xff\xbe\xff\xbe\xff\x9e\xff\x9e\xf7\x1d\xff=\xff~\xff~\xf7\x1d\xca\xb1\xb9\x8e\xc1\xae\xb9m\xc1\x8e\xb9M\xb1,\xb9M\xb1\x0c\xb9-\xa8\xec\xa9\x0c\xa9\x0c\xa0\xec\xee\xfc\x89\xff\xde\x12i\thip\x8ax\x8a\x80\xab\x88\xab\x88\xab\x88\xcc\x80\xcc\x80\xccx\xedx\xedp\xcdp\xedh\xcdh\xeeh\xcd`\xcdX\xac\x82X\xcc\x02P\xedH\xcc{\x10\x89\xff\xde\x03\x84\x13\x19\r\x19.\x19M\x89\xff\xde\x00\xad\x98\x82\x01\xcf\x83\x02\x10\x06\x01\xef\x01\xf0\x02\x10\x01\xef\x020\x01\xee\xcez\x88\xff\xde\x01\xdf\x1c\x02\r\x82\x02O\x00tt\x8f\xff\xde\x05\xae\x19\x02\x90\x02\xb0\x02\x90\x02\x90\x84\xf5\x88\xff\xde\t\xd7\x1c\x02\xd2\x02\xd2\x03\x13\x034\x03\x13\x034\x02\xf3\x02\xd2\xff\xbe\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x0c\x02\xb2\x034\x03U\x03u\x03v\x03\xb6\x03\xd6\x03\xf6\x04\x98\x04\xb9\x04\x98\x04\xb9\x04\x99\x82\x04X\x0b\x04\x17\x04X\x04\x17\x048\x04X\x9e\x9c\xf7\xdf\xb6\xfc\xef\xbe\xf7\xbe\xf7\xdf\xff\xde\x82\xf7\xbe\x01\xff\xde\xf7\xde\x86\xff\xde\x06\xf7\xde\xe7~\xff\xde\xbf\x1d\r\x1a%z\xf7\xde\x89\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8f\xff\xde\x00\xff\xdf\x85\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xdf\xb5\xff\xde\x1e\xff\xbe\xff\xde\xff\xdf\xf7\x9e\xf6\x19\xf6\xbb\xff\xbe\xff\xbe\xff\x9e\xff~\xedW\xca\x0e\xed\x17\xff^\xed\xf9\xff]\xdcU\xb9M\xc1\xae\xc1\x8e\xb9,\xb9M\xb9-\xb0\xec\xb9-\xb9M\xb1\r\xa9\x0c\xa9\r\xa0\xcb\xee\xfc\x89\xff\xde\x18i\tp\x8ap\x8ax\x8a\x80\xab\x80\xab\x88\xcb\x88\xcb\x80\xcc\x80\xedx\xedx\xeep\xeep\xeeh\xeeh\xcdh\xeeh\xee`\xcdX\xcdX\xeeY\x0eX\xedP\xedI\x0c\x89\xff\xde\x03\xcez\x19-\x19.R\xd0\x89\xff\xde\x00J\xf0\x82\x01\xcf\n\x01\xf0\x01\xf0\x01\xef\x01\xef\x01\xf0\x02\x10\x02\x10\x01\xef\x01\xef\x01\xce\xce\x9a\x88\xff\xde\x05\xe7\x1c\x02O\x02o\x02O\x02o\x12n\x8f\xff\xde\x05;q\x02\xb0\x02\xb0\x02\x90\x02\x90\x84\xf6\x88\xff\xde\t\xd6\xfc\x02\xd1\x02\xf2\x03\x13\x03\x13\x034\x03\x13\x03\x13\x02\xd2\xf7\xbe\x89\xff\xde\r\n\xf3\x03U\x03U\x03u\x03u\x03\x96\x03U\x03U\x03u\x04x\x04x\x047\x04X\x04X\x82\x048\x16\x04y\x048\x04X\x04\x175Y\xbf\x1d\xe7\x9e\xf7\xbe\xff\xde\xf7\xde\x9e{\xf7\xbe\xf7\xde\xa6\xbb\xf7\xbe\xff\xde\xff\xdf\xf7\xde\xf7\xbe\xf7\xbe\xff\xde\xff\xde\xf7\xde\x82\xff\xde\x02\xf7\xde\xf7\xbe\xf7\xde\x8d\xff\xde\x03\xff\xdf\xff\xff\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x94\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x94\xff\xde\x1b\xff\xbe\xff\xbe\xff\xde\xff\xbe\xff~\xff\x9e\xff}\xee\x19\xcao\xdb\xb3\xf7=\xf6{\xf7=\xf7\x1d\xdcu\xc1\xae\xc1\xae\xb9M\xb9-\xb1\r\xb9-\xc1N\xb9-\xb1-\xa8\xec\xa0\xec\xa0\xcb\xee\xfc\x89\xff\xde\x10i\np\x8apjx\xab\x80\x8b\x88\xab\x88\xcb\x88\xcc\x88\xed\x80\xedx\xcdp\xedx\xeeq\x0fh\xeeh\xeei\x0f\x82a\x0f\x05X\xeeY\x0eY\x0eP\xedH\xed\xe7\x1c\x88\xff\xde\x03\xf7\xbe\x19\r\x19-\xb5\x98\x89\xff\xde\x00\t\x8d\x82\x01\xcf\n\x01\xf0\x01\xcf\x021\x021\x01\xf0\x01\xf0\x020\x02\x10\x01\xef\x02\x0f\xce{\x88\xff\xde\x06\xdf\x1c\x02.\x02o\x02O\x02O\x02.\xd6\xbb\x8d\xff\xde\x06\xf7\x9e\x02p\x02\xb1\x02\xb0\x02\x90\x02\x90\x84\xf6\x88\xff\xde\t\xd7\x1c\x02\xd2\x02\xf3\x03\x13\x03\x13\x03T\x03\x13\x02\xf3\x02\xb2\xff\xbe\x89\xff\xde$\n\xf3\x034\x03U\x03v\x03U\x03\x96\x03v\x03U\x03\xb6\x03\xd6\x04X\x047\x047\x04\x17\x04\x17\x04X\x04x\x04y\x04\x99\x04X\x048\xcf^\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xef\xbe\x82\xff\xde\x00\xf7\xde\x8f\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xff\x88\xff\xde\x00\xff\xdf\xa3\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xdf\xff\xdf\x87\xff\xde\x00\xff\xdf\x8a\xff\xde"\xff\x9e\xff\xdf\xff\xde\xff\xde\xff\xbe\xff\xbe\xff\x9e\xff\x9e\xff\xbe\xff\x9e\xff\xbe\xff~\xf6\xfc\xff~\xff~\xf7~\xf6\xfc\xff~\xe5X\xff~\xff]\xf6\xdc\xb1\x0c\xc1\x8e\xc1\x8e\xb9-\xb9-\xb9N\xb1-\xb9N\xb1-\xb1-\xa9\x0c\x98\xab\xe6\xfc\x88\xff\xde\x1a\xf7\xdeq\nhIx\x8ax\xab\x80\xcb\x88\xcc\x90\xec\x90\xec\x80\xccx\xcdx\xcdx\xeep\xcep\xeeh\xcd`\xeei\x0fa/a\x0fa\x0fX\xeea/Y/H\xedP\xee\xa4\x95\x89\xff\xde\x02:\x0e\x19\r\xef]\x88\xff\xde\x05\xd6\xdb\x01\xae\x01\xcf\x01\xcf\x01\xf0\x02\x11\x82\x021\x06\x02\x10\x021\x02\x10\x020\x020\x02\x0f\xce\x9a\x88\xff\xde\x06\xdf\x1c\x02.\x02o\x02p\x02\x90\x02o[\xd3\x8d\xff\xde\x02\xa5\xb8\x02\x90\x02\x90\x82\x02\xb1\x00\x84\xf6\x88\xff\xde\t\xd7\x1c\x02\xd2\x02\xf3\x03\x13\x02\xf3\x02\xf3\x02\xb2\x02\xd3\x02\xd2\xf7\xbe\x89\xff\xde\x16\x03\x13\x034\x035\x03U\x03u\x03\x96\x03\x96\x03\xb6\x03\x95\x048\x04\x17\x04\x17\x03\xf7\x03u\x03\xf7\x048\x04\x18\x04X\x04x\x048\x047\xbf\x1d\xff\xdf\x82\xf7\xbe\x06\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xff\xde\x82\xf7\xbe\x04\xf7\xde\xff\xde\xff\xde\xf7\xde\xf7\xbe\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x92\xff\xde\x00\xff\xff\x85\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x07\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x9a\xff\xde\x00\xff\xdf\x86\xff\xde\x03\xff\x9e\xff\xde\xff\xbe\xff\xde\x82\xff\xbe\x1b\xff\xde\xff\xde\xff\xbe\xff\xbe\xff~\xf7]\xff\x9e\xff~\xff\x9e\xee\x19\xff=\xf6{\xf6\xbb\xff=\xee:\xb9,\xc1m\xc1m\xc1n\xb1-\xb9N\xb1\r\xb1-\xb1-\xa9\r\xa0\xec\xa1\r\xe6\xfc\x89\xff\xde\x15q\np\x8ax\x8a\x80\xab\x80\xab\x88\xcb\x88\xec\x80\xcc\x80\xcdx\xcdx\xedp\xcdy\x0eh\xeeq\x0eh\xee`\xeea\x0fa\x0fX\xeeP\xeeY\x0f\x82Q\x0e\x00Q\xee\x89\xff\xde\x01\x94\x95!L\x89\xff\xde\x0f|3\x01\xae\x01\xaf\x01\xaf\x01\xf0\x021\x02R\x021\x02R\x021\x02\x10\x021\x020\x02P\x02\x0f\xce{\x88\xff\xde\x07\xdf\x1c\x02\x0e\x02O\x02p\x02p\x02o\nO\xf7\xbe\x8c\xff\xde\x0631\x02\xd1\x02\xd1\x02\xb1\x02\x90\x02\x91|\xd5\x88\xff\xde\x01\xd7\x1c\x02\xd2\x84\x03\x13\x02\x02\xf3\x02\xb2\xff\xbe\x89\xff\xde\x1b\x02\xd2\x034\x03\x14\x03U\x03u\x03\xb6\x03\xd7\x03\xb6\x03\xf7\x048\x04x\x04x\x048\x03\xf7\x03\xd7\x048\x04X\x04\xb9\x04\xb9\x04\x99\x04X,\xd8\xf7\x9e\xef\x9e\xf7\xbe\xf7\xdf\xf7\xbe\xf7\xde\x82\xf7\xbe\x03\xf7\xde\xff\xde\xf7\xde\xff\xde\x83\xf7\xbe\x00\xf7\xde\x89\xff\xde\x01\xff\xff\xff\xdf\x83\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x8c\xff\xde\x00\xff\xdf\x86\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xbe\x82\xff\xde\x83\xff\xbe\x06\xff\x9e\xe5W\xff]\xff\xbe\xff\xbe\xff~\xff=\x83\xff\x9e\x11\xff]\xd3\xb3\xd3\xf4\xf7\x1d\xe4\xd6\xc1\x8e\xc1m\xc1n\xb9n\xb9N\xa0\xcd\xa0\xed\x98\xcd\xa9.\xa9.\xa0\xed\xa0\xcc\xe6\xfc\x89\xff\xde\x1aq\npjp\x8ax\xabx\x8b\x80\xab\x80\xcc\x80\xed\x80\xedx\xedp\xcdp\xeep\xeeq\x0fh\xeei\x0fi\x0fX\xeeX\xeeP\xceH\xceH\xceY/YPQ/@\xed\xf7\xbe\x88\xff\xde\x01\xde\xfckq\x89\xff\xde\x0f"\x0e\x01\xae\x01\xaf\x01\xd0\x01\xd0\x021\x02s\x021\x02R\x021\x021\x02Q\x02Q\x020\x01\xef\xce\x9b\x88\xff\xde\x07\xe7\x1c\x02/\x02/\x02p\x02p\x02o\x02P\xce\x9a\x8b\xff\xde\x01\xef\x9d\x02\x90\x82\x02\xb1\x02\x02\x90\x02\xd1|\xf6\x88\xff\xde\t\xd7\x1c\x02\xd2\x02\xf2\x034\x03T\x03T\x02\xf3\x03\x14\x02\xd2\xff\xbd\x89\xff\xde\n\x02\xb2\x03\x14\x035\x035\x03u\x03\xb6\x03\xd7\x03\xd6\x03\xd7\x04\x17\x04\x17\x82\x04X\x18\x04\x17\x03\xf7\x048\x04\x99\x04x\x04\x99\x04\xb9\x04X\x8e[\xcf=\xef\x9e\xef\xbe\xef\xbe]\xba\xef\x9e\xf7\xde\xf7\xde\xff\xde\xf7\xbe\xe7\x9e\xff\xde\xff\xde\xef\x9e\xff\xde\xf7\xde\x88\xff\xde\x00\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x89\xff\xde\x01\xff\xff\xff\xff\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x89\xff\xde\x08\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x89\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xdf\x82\xff\xde\x83\xff\xbe\x00\xff~\x82\xff\xbe\x17\xed\xf9\xc2o\xf7=\xf7=\xf7]\xf7\x9e\xed\xfa\xb1M\xb1\r\xb9n\xb9m\xb9N\xc1\x8e\xc1\x8e\xb9n\xb1O\x98\xcd\x98\xcd\x98\xed\xa0\xed\xa9.\xa1\x0e\x98\xcc\xee\xfc\x89\xff\xde\x11q\npjp\x8ax\x8b\x80\xab\x80\xcc\x80\xccx\xccx\xcdx\xcdp\xcep\xcep\xeeh\xeei\x0fqPi/a/\x82P\xee\x05Q/YPYPQ/I\x0f\xce9\x89\xff\xde\x00\xe7\x1c\x87\xff\xde\x11\xff\xfe\xf7\x9d\x01\x8e\x01\x8e\x01\xb0\x01\xd0\x01\xb0\x01\xf0\x02R\x02s\x02\x93\x02R\x021\x021\x02\x10\x01\xef\x02\x10\xce\x9b\x88\xff\xde\x07\xe7\x1c\x02/\x02O\x02P\x02O\x02p\x02p[\xb2\x8b\xff\xde\x07\x9dw\x02\xf2\x02\xd1\x02\xb1\x02\x91\x02\xb1\x02\xb1\x84\xf6\x88\xff\xde\x01\xd6\xfc\x02\xf2\x83\x034\x03\x03T\x034\x02\xd2\xff\xbe\x89\xff\xde&\x02\xb2\x034\x035\x03\x14\x03U\x03U\x03\x96\x03\xf7\x04\x18\x04\x18\x048\x04y\x04X\x04\x17\x048\x03\xb6\x048\x04x\x04y\x04x\x04y\x04x\x04\xb9%:v\x1b\xf7\xbe\xef\xbe\xd7]\xff\xde\xf7\xde\xff\xde\xf7\xde\xf7\xde\x8e{\xef\xbe\xff\xde\xf7\xde\xff\xde\xf7\xde\x88\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x90\xff\xde\x00\xff\xdf\x84\xff\xde\x02\xff\xdf\xff\xdf\xff\xff\x9f\xff\xde\x01\xff\xdf\xff\xdf\x9b\xff\xde#\xff\xdf\xff\xde\xff\xbe\xee9\xff\xdf\xff\xbe\xff\x9e\xff\x9e\xff\xde\xff\x9e\xff\x9e\xf6\xbb\xff^\xf6\xdc\xff\xbe\xee\xbb\xe5\xd9\xd3\xd4\xb9m\xb9M\xb9\x8e\xc1\x8e\xb9N\xb9n\xb9n\xb9N\xb9o\xa0\xed\xa0\xee\xa1\r\xa0\xed\x98\xed\xa9.\xa1.\x98\xac\xee\xfc\x89\xff\xde\x15q\np\x8ap\x8ax\xab\x80\xab\x80\xcc\x80\xccx\xacx\xedx\xeey\x0ep\xeeq\x0fq\x0fh\xeea\x0f`\xefY\x0fP\xeeP\xeeQ\x0fQ\x0f\x82I\x0f\x01@\xees1\x93\xff\xde\x0c\xb5\xb8\x01\xaf\x01\xaf\x01\x8e\x01\xaf\x01\xd0\x01\xd0\x022\x02\x93\x02r\x02R\x021\x021\x82\x02\x10\x00\xcez\x88\xff\xde\x02\xdf<\x020\x02p\x82\x02\x91\x01\x02p\n/\x8b\xff\xde\x03+2\x02\xd1\x02\xb1\x02\xb1\x82\x02p\x00\x84\xd5\x88\xff\xde\t\xd7\x1c\x03\x13\x034\x03\x13\x034\x034\x03T\x034\n\xd2\xff\xbe\x88\xff\xde!\xff\xfe\x02\xb2\x03\x14\x035\x034\x035\x03\x96\x03\xf7\x03\xf8\x04\x18\x04X\x048\x048\x04x\x04y\x048\x04\x17\x048\x04\x99\x04\x99\x04x\x04\xda\x05\x1a\x05:%z\x0c\xd9\xef\x9e\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\x82\xff\xde\x01\xf7\xbe\xf7\xde\x91\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xff\xff\xde\xff\xff\x8e\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x99\xff\xde\x12\xff\xdf\xf7\x1c\xf7}\xff\xde\xff\xff\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\xff\xde\xf7]\xff\xde\xff\xde\xff\xbe\xff\xde\x82\xff\xbe\x18\xee:\xff\x9e\xff\xbe\xff\xbe\xff\x9e\xcbR\xb9M\xb9n\xc9\xcf\xb9n\xc1\x8e\xc1\x8f\xb9N\xb9N\xb9o\xb1.\xa9\x0e\xa1\x0e\xa0\xee\xa9\x0e\xa0\xed\xa9.\xa9\x0e\xa0\xed\xee\xfc\x89\xff\xde\x1ai\np\x8ap\xabp\x8bp\x8bx\xac\x80\xccx\xccp\xcdp\xedq\x0eq/q/h\xeei/`\xeeY\x0fY\x0fQ\x0eP\xeeH\xcdH\xeeH\xefI\x0fI\x0eI\x0f9,\x93\xff\xde\x10S\x11\x01\x8e\x01\xaf\x01\xd0\x01\xd0\x01\xf1\x01\xb0\x01\xb0\x01\xf1\x02\x11\x02R\x02R\x021\x02\x11\x02\x10\x01\xef\xce{\x88\xff\xde\x08\xdf\x1c\x02P\x02p\x02\x91\x02q\x02q\x02Q\x020\xc6z\x89\xff\xde\x02\xef}\x02\xd1\x02\xb0\x83\x02\xb1\x01\x02\x91|\xf6\x88\xff\xde\t\xd7\x1c\x02\xf2\x034\x034\x03\x13\x03T\x03\x13\x03\x13\n\xd2\xf7\xbe\x89\xff\xde\x15\x02\xb2\x03\x14\x02\xf4\x03\x14\x035\x03\xb7\x03\x96\x03\xd7\x048\x048\x04X\x04X\x04x\x04X\x048\x04X\x04X\x04x\x04\xb9\x04\xb9\x04\xd9\x04\xfa\x82\x05\x1a\x03~<\xf7\xbe\xf7\xde\xff\xde\x82\xf7\xbe\x08\xe7\x9e\xf7\xbe\xff\xde\xf7\xbe\xff\xde\xff\xde\xf7\xbev;\xdf}\x8f\xff\xde\x82\xff\xff\x02\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xff\x89\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\xa5\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x02\xff\x9e\xff\x9e\xf7\x9e\x82\xff\xbe\x16\xff~\xff~\xf6:\xd1\xef\xc1\xae\xb9M\xc1n\xc1\x8e\xc1n\xc1n\xc1\xaf\xc1\xaf\xb9\x8f\xa9.\xa1\x0e\xa1\x0e\xa0\xed\xb1O\xa9/\xb1O\xa9\x0e\xa8\xed\xee\xfc\x89\xff\xde\x01i\np\x8a\x82x\xab\x0bx\xccx\xccx\xcdx\xcdx\xeeq\x0eq/q\x0fh\xee`\xeei\x0fa\x0f\x82P\xee\x07Q\x0fH\xeeI\x0fI\x0fA\x0f@\xee0\xcd\xe7\x1c\x92\xff\xde\x10\t\x8d\x01\xaf\x01\x8f\x01\xb0\x01\xd0\x01\xb0\x01\xd1\x01\xd1\x01\xf1\x02s\x02s\x02R\x022\x021\x02\x10\x02\x10\xce\x9b\x88\xff\xde\x02\xdf\x1c\x02\x0f\x02q\x82\x02\x91\x02\x02q\x02pS\xb2\x89\xff\xde\x08\x95W\x02\xb1\x02\x90\x02\xb1\x02\xb1\x02\x91\x02\xd2\x02\xd2|\xf6\x88\xff\xde\t\xd7\x1c\x02\xf2\x03\x14\x03T\x034\x034\x03\x14\x034\x02\xb2\xff\xbe\x89\xff\xde\r\n\xd3\x02\xb3\x02\xd3\x035\x03U\x03v\x03\x96\x03\xb7\x04\x17\x03\xf7\x04\x18\x04\x17\x048\x04\x17\x83\x04X\t\x04x\x04\xb9\x04\xd9\x04\xda\x04\xfa\x04\xfa\x05\x1aU\xfb\xe7~\xef\xbe\x84\xf7\xbe\x82\xff\xde\x03\xef\x9e\xdf]\xf7\xde\xf7\xbe\x87\xff\xde\x00\xff\xbe\x91\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x8d\xff\xde\x01\xff\xdf\xff\xff\x8e\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x9c\xff\xde\t\xff\xbe\xff\xde\xff\xbe\xff\x9e\xee\x19\xff~\xff\xbe\xe4\x14\xc9\xad\xc9\xae\x82\xc1\x8e\x08\xc1n\xc1N\xc1\x8f\xb9\x90\xb1/\xa9.\xa9O\xa0\xee\xa8\xed\x83\xb1o\x01\xa0\xed\xee\xfc\x89\xff\xde\x8f\xde\xdb\x04\xd6ZI-P\xeeH\xeeQ/\x82I0\x03A\x0f9\x0e8\xee\x9c\xb5\x91\xff\xde\x03\xde\xdb\x01\x8f\x01\x8f\x01o\x82\x01\xd0\n\x01\xb0\x01\xd1\x01\xf1\x02S\x022\x02s\x02R\x021\x02\x11\x021\xce\x9b\x88\xff\xde\x08\xdf\x1c\x020\x02P\x02q\x02\xb2\x02\x92\x02\x92\x02\x91\n/\x89\xff\xde\x08"\xf1\x02\xb1\x02\x91\x02\xd2\x02\xd2\x02p\x02\xb2\x02\xb2|\xf6\x88\xff\xde\t\xd7\x1c\x02\xb2\x02\xf3\x03T\x03u\x03T\x03T\x02\xf3\n\xd2\xf7\xbe\x89\xff\xde\x00\xdf\x1c\x87\xdf<\x82\xdf=\x01\xdf]\xdf=\x82\xdf]\x04eY\x04x\x04\x99\x04\xb9\x04\x99\x82\x04\xda\n\x1dZ5\xbb\xdf~\xf7\xde\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\x86\xff\xde\x02\xf7\xbe\xf7\xbe\xff\xdf\x8c\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x02\xff\xff\xff\xde\xff\xff\x90\xff\xde\x00\xff\xdf\x9a\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xff\xff\xdf\x91\xff\xde\x04\xff\xdf\xff\xff\xff\xdf\xff\xde\xff\xbe\x84\xff\xde\x13\xff\xbe\xff\xde\xff\xbe\xff\xbe\xff\xde\xff\xbe\xff\x9e\xff\x9e\xff~\xe4T\xd1m\xc9\xad\xc9\x8e\xc9\xaf\xc9\xcf\xc1N\xc1N\xb9.\xb9N\xb1.\x83\xa9\x0e\x06\xb1.\xb1.\xb1N\xa9\x0e\xa9.\xa0\xcd\xee\xfc\x9a\xff\xde\x03\x944H\xceH\xeeI\x0f\x82A\x0f\x038\xef9\x0f0\xeeI\xee\x91\xff\xde\x01|U\x01\xaf\x82\x01\xb0\x05\x01\xd1\x01\xf1\x01\xd1\x01\xd1\x01\xf1\x01\xf1\x82\x022\x03\x02R\x02Q\x021\xce\x9b\x88\xff\xde\x04\xe7\x1c\x021\x02Q\x02Q\x02r\x82\x02\x92\x01\x02q\xc6Z\x87\xff\xde\t\xe7<\x02\xb1\x02\xb1\x02\xd2\x02\xd1\x02\xb1\x02\xb1\x02\xd2\x02\xb2|\xf6\x88\xff\xde\t\xd7\x1d\x02\xd2\x03\x13\x03T\x03U\x03u\x034\x03\x14\x02\xd2\xf7\xbe\x8b\xff\xde\x00\xff\xdf\x86\xff\xde\x82\xff\xdf\x13\xff\xde\xff\xde\xff\xdf\xff\xdf\xdf}\x04X\x04x\x04x\x04\xb9\x04\xb9\x04\xda\x04\xda\x04\xd9\x04\xda\x1d:\x86|\xe7\x9e\xef\x9e\xf7\xbe\xff\xbe\x97\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\x99\xff\xde\x00\xff\xdf\xa4\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xff\xbe\xff\xde\x82\xff\xbe\x17\xf6\xbc\xe4\x14\xd1\xac\xc9\x8d\xc9\xae\xd1\xcf\xc9\xcf\xc9\xaf\xc1\x8f\xb9o\xb9N\xb1.\xb1\x0e\xa9\x0e\xa9\x0e\xa8\xee\xa9\x0e\xb1.\xb1O\xb9\x8f\xb1O\xa9\x0e\xa8\xed\xee\xfc\x9a\xff\xde\x0b\x9cTH\xeeH\xefA\x0fA\x0fA/901\x0f1\x0f1\x0e1\r\xf7\xbd\x90\xff\xde\x11*\x0e\x01\xaf\x01\xb0\x01\xd1\x01\xb0\x01\xd1\x01\xf1\x01\xd1\x01\xf2\x01\xf2\x02\x12\x02S\x02S\x022\x02\x11\x02\x10\x021\xce\x9b\x88\xff\xde\x15\xe7\x1c\x020\x02r\x02R\x02Q\x02r\x02Q\x02\x92\x02\x92*\xd2\xf7\xbe\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xde\xff\xff\xff\xdeT\x14\x02\xd2\x02\xd2\x02\xb1\x82\x02\xf2\x02\x02\xd2\x03\x13}\x16\x88\xff\xde\t\xd7\x1c\x02\xf3\x034\x03T\x03T\x03u\x034\x03\x13\x02\xd2\xf7\xbe\x99\xff\xde\x06\xf7\xde\xdf]\x047\x04x\x04\xb9\x04\xda\x04\xda\x82\x04\xb9\x07\x04\x99\x04\xb9\x04\x99\x14\xd9f<\xcf]\xf7\xde\xf7\xde\x8c\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x8b\xff\xde\x01\xff\xff\xff\xff\x9e\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x91\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xdf\x89\xff\xde\x1e\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\x9e\xf7]\xff~\xe3\x92\xe3\x92\xd1\xac\xd1\xad\xd1\xce\xd2\x0f\xc9\xcf\xb9-\xb0\xec\xb1-\xb9o\xb1\x0e\xb1\x0e\xb9O\xb9o\xa9\x0e\xb1\x0e\xb1.\xb1N\xb1.\xb1N\xa9\x0e\xb1\x0e\xee\xfc\x9a\xff\xde\x0b\x9cTH\xefI\x0fA\x0fA0A090901\x0f(\xee0\xef\xc5\xf9\x8f\xff\xde\x12\xef\x9d\x01n\x01\x90\x01\x8f\x01\x90\x01\xb0\x01\xd1\x01\xf2\x01\xd1\x01\xf1\x01\xf2\x02s\x02s\x02R\x022\x02R\x02\x11\x021\xce\x9b\x88\xff\xde\x04\xe7\x1c\x02q\x02r\x02\x92\x02r\x82\x02\xb3\x13\x02\xb2\x02\x92\x02q\x02\x0f\x01\xef\x02\x0f\x02\x0f\x02P\x02\x91\x02\x91\x02\xb2\x02\xb1\x02\xf2\x033\x03\x12\x033\x03\x13\x033\x03\x13}\x17\x88\xff\xde\t\xd7\x1c\x02\xd2\x034\x034\x03U\x03U\x03\x14\x03\x14\x02\xb2\xff\xbe\x9a\xff\xde\x06\xdf]\x047\x04x\x04\x99\x04\xda\x04\xda\x04X\x82\x04\xda\x06\x04y\x04\xb9\x04\xb9\x05\x1a\r\x1a^\x1b\xc7>\x91\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\xa0\xff\xde\x01\xff\xfe\xff\xdf\x83\xff\xde\x00\xff\xff\x8b\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x84\xff\xde!\xff~\xee{\xff\xbe\xff\x9e\xff\xbe\xff\xde\xff\xde\xff\xbe\xff~\xf6{\xd1\xcd\xd1\x8c\xd1\x8c\xd1\xad\xc9\x8d\xd1\xce\xc9\xcf\xc1n\xb9.\xb9.\xb9N\xb1\x0e\xb1.\xb9O\xb9.\xb9N\xb9O\xb9o\xb1.\xb1N\xb1.\xb1.\xb1\r\xee\xfc\x9a\xff\xde\x00\x94T\x82@\xee\x029\x0f909\x0f\x8210\x011/k2\x8f\xff\xde\x03\xad\xb8\x01o\x01\x8f\x01\x8f\x82\x01\xb0\x82\x01\xf1\x08\x02\x12\x02s\x02t\x02R\x02\x11\x02R\x021\x02\x11\xce\x9b\x88\xff\xde\x1b\xdf\x1c\x021\x02\x92\x02\x93\x02\x93\x02\xd4\x02\xb3\x02\x93\x02\xd3\x02\xb3\x02\x92\x02q\x021\x02Q\x02Q\x02q\x02\xb2\x03\x13\x02\xd2\x03\x13\x033\x033\x03S\x03\x13\x033\x033\x03\x13\x85\x17\x88\xff\xde\t\xd7\x1c\x02\xb2\x034\x03U\x03u\x034\x03\x14\x03\x14\x02\xd2\xf7\xde\x99\xff\xde\x12\xff\xbe\xdf]\x04X\x04\x99\x04\x99\x04\xb9\x04\xfa\x04\xda\x04\xda\x04\xfa\x04\xda\x04\x99\x04\xd9\x04\xda\x05\x1a\x05:\x05\x1a\x04\xf9\xbf]\x87\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xfe\x84\xff\xde\x03\xff\xff\xff\xff\xff\xde\xff\xdf\x9d\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x89\xff\xde\x01\xff\xff\xff\xdf\x8b\xff\xde\x12\xff\xbe\xdb\x11\xe2O\xd2/\xff\xbe\xff\xde\xff\xde\xff\xdf\xf7=\xf6\xbb\xff\x9e\xff]\xed\x98\xda-\xc9l\xc9l\xc1m\xc1\xaf\xc1\x8e\x82\xb9N\r\xb9o\xb9O\xb9.\xb9N\xb9.\xb9.\xb9N\xb9o\xb9o\xb9N\xb9o\xa8\xed\xee\xfc\xff\xdf\x99\xff\xde\x06\x944@\xee@\xef@\xefA/9\x0f9P\x8310\x001N\x8f\xff\xde\x06J\xf1\x01\x8f\x01\x8f\x01\xd1\x01\xd1\x01\xb1\x01\xd1\x82\x02\x12\x08\x023\x02S\x02s\x022\x022\x02R\x022\x02\x11\xce\x9b\x88\xff\xde\x0b\xe7\x1c\x021\x02\x93\x02\x93\x02\xb4\x02\xd4\x02\xd4\x02\xf4\x02\xd3\x02\xb3\x02\x93\x02\x92\x82\x02r\x0c\x02\xd3\x02\xf3\x03\x13\x03\x13\x033\x033\x03S\x03S\x033\x03\x13\x02\xf2\x03\x13\x85\x17\x88\xff\xde\t\xd7\x1c\x02\xd2\x03\x14\x03\x13\x03U\x034\x02\xf3\x02\xf3\n\xb2\xff\xbe\x99\xff\xde\x04\xf7\xbe\xdf}\x047\x04W\x04x\x82\x04\xb9\x82\x04\xfa\x0b\x0c\xb9~;5\x9a\x05Z\x04\xf9\x04\xf9\x04\xb9\x86;\xff\xdf\xff\xde\xff\xde\xf7\xbe\xa4\xff\xde\x00\xff\xdf\x95\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x9f\xff\xde\x00\xff\xdf\x84\xff\xde"\xf7\x1c\xe2\xb1\xe2p\xd9\xce\xe5\xf9\xff\xbe\xff\xde\xff\x9e\xf6\xfc\xff\xbe\xff\xbe\xff\xde\xff\xdf\xff\x1d\xca.\xb9+\xb8\xeb\xc1n\xc1\x8f\xc1n\xc1n\xb1.\xb9N\xb9N\xc1n\xc1o\xb9N\xb1\r\xb9o\xc1\x8f\xb9N\xb1.\xb1.\xa8\xed\xee\xfc\x9a\xff\xde\x0c\x9448\xee8\xeeA\x0fAP9/909P101P)\x10)\x0f\xe7\x1c\x8e\xff\xde\x02\tm\x01o\x01\x8f\x82\x01\xd1\x0c\x02\x12\x02\x13\x023\x022\x02t\x02t\x02s\x02s\x02R\x022\x022\x01\xf0\xce\x9b\x88\xff\xde\x1b\xdf\x1c\x02R\x02\x93\x02\x93\x02\xb4\x02\xf4\x02\xf5\x02\xf4\x02\xd4\x02\xd3\x02\xd4\x02\x93\x02\xd3\x02\x93\x02\x92\x02\xf3\x02\xf2\x033\x03T\x03T\x03S\x03\xb5\x03\x95\x03t\x03T\x03T\x034}\x17\x88\xff\xde\x08\xd6\xfc\x02\xb3\x02\xf4\x034\x03U\x03\x14\x03\x14\x02\xf3\n\xb2\x9a\xff\xde\x05\xf7\xbe\xdf}\x04\x17\x04x\x04\x98\x04\xb9\x84\x04\xd9\x07\x8e;\xf7\xde\xf7\xbe\xa6\xdd\x05Z\x05:\x05\x1a\xc7]\x82\xff\xde\x02\xef\xbe\xff\xde\xf7\xbe\xa0\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xff\x94\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x8d\xff\xde\n\xff\xbe\xff\xbe\xff\xde\xe3R\xda\x0f\xd1\xce\xf7}\xff\xde\xff\xbe\xff\xde\xff\xdf\x82\xff\xde\x82\xff\xbe\x13\xee\xbb\xee\x1a\xb9m\xc1-\xc1n\xc1M\xb9N\xc1\x8f\xc1\x8f\xc9\xaf\xc9\xd0\xc1\x8f\xb9n\xb9N\xb9N\xb9.\xb1.\xb9.\xb1\x0e\xee\xdc\x9a\xff\xde\x0c\x944A\x0f8\xee9\x0fA/909Q9q101P1Q)\x0f\x94\x96\x8d\xff\xde\n\xce\x9b\x01o\x01o\x01\x90\x01\xb0\x01\xd1\x01\xd1\x02\x12\x023\x02S\x023\x84\x02S\x03\x02R\x02\x11\x02\x11\xce\x9b\x88\xff\xde\x08\xdf<\x02s\x02\x93\x02\x93\x02\xb4\x02\xd4\x02\xf5\x02\xf5\x03\x15\x83\x02\xf4\x0e\x02\xd4\x02r\x02\xf3\x03\x94\x03\x94\x03t\x03T\x03\x94\x03\xb5\x03t\x03\x95\x03\x95\x034\x033}\x17\x88\xff\xde\x08\xdf\x1d\x02\xf3\x02\xf4\x034\x035\x03\x15\x034\x02\xf4\x02\xd3\x9a\xff\xde\x13\xf7\xde\xdf~\x047\x04x\x04x\x04\x98\x04\x99\x04\xfa\x05\x1a\x04\xfa\x04\xda\xb6\xdc\xf7\xde\xf7\xbe\xf7\xbev\\\xae\xfd\xcf]\xf7\xbe\xf7\xbe\x84\xff\xde\x00\xff\xdf\x8c\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\xb2\xff\xde\x00\xff\xdf\x93\xff\xde\x06\xff\xbe\xf6\xfc\xff\xbe\xff\xdf\xff\xde\xff\xbe\xff\xbe\x83\xff\xde\x16\xff\xdf\xff\xde\xf7}\xf7]\xff\xbe\xeeZ\xc1\xae\xc9\xef\xd1\xef\xc1\x8e\xc1N\xc1n\xc1\x8f\xb9n\xc1o\xb9.\xb9N\xb1\r\xb9.\xb9o\xb1.\xb0\xed\xee\xfc\x9a\xff\xde\x0c\x9448\xee8\xef8\xee9\x0f909P101P)0)01P9\xcf\x8d\xff\xde\x13|\x14\x01\x90\x01\x90\x01\xb1\x01\xb1\x01\xd2\x02\x13\x02T\x02T\x02t\x02\x94\x02S\x02S\x02s\x022\x022\x02\x12\x02\x11\x01\xf1\xd6\xbb\x88\xff\xde\x02\xdf\x1c\x02s\x02\x94\x82\x02\xb4\x01\x02\xd4\x02\xf5\x82\x03\x15\x82\x02\xf4\r\x02\xf3\x03t\x03\xb5\x03\x94\x03\x94\x03\x95\x03t\x03\x95\x03t\x03t\x03T\x03T\x034}\x17\x88\xff\xde\t\xd7\x1c\x02\xd3\x03\x14\x03\x14\x03\x15\x035\x03U\x035\x02\xf4\xf7\xbe\x99\xff\xde\x0f\xf7\xde\xdf}\x04W\x04\xb9\x14\xf959\x04\xb9\x04\x99\x04\xd9M\xbb\xbf\x1d\xef~\xd7=\xf7\xbe\xef\xbe\xf7\xbe\x8b\xff\xde\x01\xc7^\xdf\x9e\x8e\xff\xde\x02\xff\xff\xff\xdf\xff\xdf\xaa\xff\xde\x00\xff\xff\x9a\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde!\xff\xbe\xff\xbe\xff\x9e\xff\xde\xff\xbe\xf7\x9e\xff\xbe\xf7~\xd32\xc1m\xc9\xae\xc1N\xc1n\xc1\x8e\xc1\x8f\xb9N\xb9n\xb9n\xb9.\xb9N\xb9o\xb1.\xb1.\xd5\xd9\xff\xdf\xff\xbe\xff\xbf\xff\xbe\xff\xde\xff\xbf\xff\xbf\xff\xdf\xff\xde\xff\xde\x82\xff\xbe\x05\xff\xde\xf7\xde\xff\xbe\xff\xbe\xff\xbf\xff\xbe\x83\xff\xde\x11\xff\xbe\xff\xbe\xff\xde\xf7\xbes\x12A\x0fA0A09\x0f1\x0f9Q9Q1Q1q)Q)q!\x0f\xe7=\x87\xff\xde\x00\xff\xdf\x83\xff\xde"\x19\xaf\x01p\x01\x90\x01\xb1\x01\xd2\x02\x13\x01\xf2\x02t\x02T\x02t\x02t\x02\x95\x02\x94\x02\x94\x02\x12\x022\x02\x11\x02\x12\x01\xf1\xa5x\xff\xde\xf7\xbe\xf7\xde\xff\xde\xff\xde\xf7\xde\xff\xde\xff\xde\xff\xbe\xb5\xfa\x02\x93\x02s\x02s\x02\xb4\x02\x94\x82\x02\xf5\x08\x03\x15\x035\x03\x15\x02\xd3\x03\x15\x03\x14\x03t\x03t\x03S\x82\x03t\x06\x03T\x03\x95\x03t\x034\x02\xf3\x034K\xf4\x88\xff\xde\x01\xa5\xda\x03\x14\x82\x035\x04\x03U\x03u\x03U\x02\xf4\xdf\x1c\x8d\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\r\xff\xdf\xff\xde\xff\xde\xff\xdf\xae{\x04x\x0c\xb9\xc7=\xff\xde\xef\xbe\xe7\x9e\xc7\x1d\xf7\xbe\xf7\xde\x82\xf7\xbe\x01\xff\xde\xf7\xde\x8b\xff\xde\x04n|\r\xbb\xdf~\xff\xdf\xff\xdf\x91\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\x9b\xff\xde\x00\xff\xff\x87\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xdf\x8e\xff\xde\x15\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xf7\x9e\xff\xbe\xff\xde\xf7\x9e\xff\xbe\xff\xbe\xff\xde\xf7]\xf7]\xff\x9e\xf7\x9e\xf7=\xc1\xae\xc1m\xc1\x8d\xc1m\xc1n\x82\xc1\x8f\x82\xb9N\x16\xb9O\xb1\x0e\xa8\xed\x98\xcc\xa1\xef\x99\xce\x91\xce\x89\xae\x81\xaey\xady\xaey\xaey\xceq\xcei\x8di\xadi\xada\xadi\xadi\xada\xada\xcda\xad\x83Y\xad\x05Q\xaeQ\xaeI\xaeA\x8e8\xefA\x0f\x82A0\x0b90101Q9\x921q!0!q\x190\x19/:1:0:0\x82:Q\x00:0\x82:P\x1b2/2P\x19\xaf\x01p\x01\x90\x01\x90\x01\xb1\x01\xf2\x024\x02\x13\x02T\x02S\x02T\x02T\x02t\x02t\x02\x94\x023\x02t\x022\x022\x02\x12\x01\xf1*\x922\x912\xb12\xb12\xb2\x832\xd2\x05\x02R\x02s\x02R\x02\x94\x02\x94\x02s\x82\x02\xf5 \x02\xd4\x02\xf4\x03\x15\x02\xd4\x035\x03\x95\x03\xf6\x03\xd6\x03s\x03\xb5\x03\xd6\x03\xb5\x03T\x033\x02\xf3\x03T\x03T\x034\x02\xd3\x12\xb2\x1a\xd2\x12\xb2\x12\xb2\x12\xd2\x12\xb1\x12\xd2\x12\xd3\x12\xf2\x03\x14\x034\x035\x03V\x03v\x82\x03U\x01\x035\x02\xf4\x82\x13\x13\x1c\x12\xf3\x12\xb2\x12\xf3\x13\x13\x13\x14\x13\x13\x1b\x13\x13\x13\x133\x1bt\x1b\xd5\x1b\x95\x13u\x1b\x94\x13t\x13\x95\x1b\x95\x1b\xb5\x13\x94\x13\xb5\x13\xb5\x13\x94\x1b\xd5\x13\xf5\x0c\x98e\xfb,\xd8\xef\xbe\xf7\xde\x82\xf7\xbe\x04\xf7\xde\xf7\xdf\xef\x9e\xf7\xbe\xf7\xbe\x8e\xff\xde\x01\xb7=\xf7\xdf\x87\xff\xde\x00\xff\xdf\x9d\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x99\xff\xde\x01\xff\xff\xff\xdf\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xbe\x85\xff\xde\x08\xff\xdf\xff\xde\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xde\xff\x9e\x83\xff\xbe\x02\xe5\xf9\xed\xd9\xff~\x82\xff\x9eP\xee:\xdc\x14\xe5\x17\xec\xf7\xd32\xc1n\xc1\x8f\xc1\x8f\xc1\xaf\xc1\x8f\xb9\x8f\xb9\x8f\xb1N\xa9\r\xa1\x0e\xa1.\x99.\x91\x0e\x89\x0e\x80\xeex\xcd\x80\xeex\xcdp\xadp\xcdh\xadh\xcd`\xcd`\xad`\xcdX\xadX\xadX\xcdP\x8cP\xadP\xcdP\xcdH\xee@\xcdI\x0e@\xeeA\x0f9\x0fA\x0fAQAPAq9Q109q9\x921\x92!Q\x19Q\x19Q\x19q\x19q\x11P\x11q\x11q\tq\tp\t\x91\t\xb2\x01\x91\t\x91\x01/\x01p\x01p\x01\x90\x01\x91\x01\x91\x01\xb1\x01\xd2\x02\x13\x023\x023\x024\x02T\x02t\x02T\x82\x02S\x00\x02s\x82\x02S\x12\x023\x022\x022\x023\x02S\x02S\x023\x022\x022\x02S\x02t\x02\x94\x02s\x02\x94\x02\xb4\x02\xd5\x02\xf5\x03\x15\x036\x82\x03\x15\x1c\x035\x03u\x034\x03\xb5\x03\xd5\x03\xd5\x03\xf6\x03\xd5\x03\xd6\x03\xd6\x03\x95\x03u\x03\x95\x03u\x03\x14\x02\xd3\x02\xf3\x02\xb3\x02\xf4\x03\x14\x02\xf4\x03\x14\x02\xf4\x03\x14\x03\x14\x035\x03U\x03\x14\x035\x82\x03V!\x03v\x03\x14\x034\x03U\x03U\x035\x035\x03\x14\x035\x02\xf4\x035\x03\x14\x035\x03U\x03U\x03\x96\x03\xf7\x03\x95\x03u\x03u\x03\x96\x03\xd6\x03\x96\x03\xd6\x03\xf7\x04\x17\x03\xf7\x04\x16\x047\x04\x16\x04X\x15\x195z\xef\xbe\x83\xf7\xbe\x00\xbe\xfc\x83\xf7\xbe\x04\xff\xde\xff\xde\xdf\x9e\xff\xde\xf7\xde\x92\xff\xde\x01\xff\xff\xff\xff\x83\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xdf\xaf\xff\xde\x04\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x89\xff\xde\x04\xff\xbe\xff\xde\xff\xbe\xff\x9e\xee\x9b\x82\xff\xbeP\xd3R\xc9\xcf\xc1n\xf7=\xff\xbe\xff\xbe\xff\x9e\xff\xbe\xff~\xf7=\xf6\x9b\xe5X\xb9m\xb9N\xb9o\xc1\xaf\xc1\xaf\xb9N\xb9o\xb1.\xa9\x0e\xa1\x0e\x98\xed\xa1\x0e\x91\x0ex\xadp\xadx\xce\x80\xee\x81\x0ex\xeey\x0eh\xcd`\xac`\xceX\xcdX\xcd`\xce`\xceX\xadP\xadX\xceX\xeeX\xeeP\xeeH\xeeI\x0f@\xefA\x0fA\x0f9\x10APAQAq1Q9\x929q1Q)Q!Q\x19Q\x19Q\x110\x11q\t0\t0\x11r\x11\x92\t\x91\t\xb2\x01\x91\t\x91\x01P\t\x91\x01P\x01\x91\x01\x91\x01p\x01\xb1\x01\xf2\x024\x85\x02T$\x02t\x02t\x02T\x02T\x02\x94\x02S\x02S\x023\x01\xf2\x02S\x022\x02\x12\x02S\x02s\x02\x12\x023\x02S\x02t\x02\x94\x02S\x02S\x02\xb5\x02\xd5\x02\xd5\x03\x16\x03\x15\x03V\x03V\x03\x15\x035\x035\x03\x96\x03\xd6\x046\x04\x16\x04\x16\x03\xf6\x82\x04\x16%\x03\xf6\x03\xb5\x03\x95\x03U\x034\x034\x035\x03\x14\x03\x14\x02\xf4\x03\x14\x035\x03\x14\x03\x14\x035\x035\x03V\x02\xf4\x02\xb3\x03U\x03U\x03V\x03V\x03U\x03U\x03\x96\x03v\x03v\x035\x02\xf4\x03\x15\x02\xd3\x03\x14\x03\x15\x035\x03U\x03u\x03\x96\x82\x03\xb6\x1c\x03\xd6\x03\xd6\x03\xf7\x03\xd6\x03\xf7\x048\x04X\x04X\x04\x17\x04X\x04x\x04\x99\x04\xb9\x04\xfa\x0c\xb8~\x1b\xe7}\xf7\xbe\xf7\xdf\xef\xbe\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xbe\xfc\xef\x9e\xf7\xbe\x8c\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x8a\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8e\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xff\x8c\xff\xde\x01\xff\xdf\xff\xdf\x8a\xff\xde\x00\xff\xff\x8a\xff\xde\x04\xff\xdf\xff\xdf\xff\xde\xf7\x1c\xff\xbe\x87\xff\xde\x00\xff\xdf\x84\xff\xde\n\xff\xbe\xff\xdf\xff\xde\xff\xbe\xff\xdf\xff\xbe\xff\x9e\xcaP\xc9\x8e\xdb\x93\xff\xde\x82\xff\xbe\x14\xf7^\xf6\xfc\xf7]\xf7]\xcb\x12\xc1\xaf\xc1\xaf\xb9N\xb9n\xb9o\xb1.\xb1.\xb1N\xa9\x0e\xa9.\xa9O\xa1/\x90\xee\x80\xeex\xcex\xce\x82x\xee\x1fp\xeeh\xeeh\xce`\xeeX\xcdX\xce`\xee`\xee`\xceX\xcdX\xceX\xceX\xeeP\xeeH\xceH\xef@\xef@\xefA0APAQAq9Q9r9q1q)Q)Q\x19Q\x19q\x19q\x19\x92\x83\x11\x92\x0f\t\x92\t\x92\t\xb2\t\x92\x01P\x01q\t\x91\x01p\t\xb2\t\xb2\x01\xb1\x01\x91\x01\xf2\x023\x024\x02\x13\x82\x02T\x17\x02\x13\x023\x02T\x02t\x02\x94\x02\x94\x02\xb5\x02t\x02T\x02\x12\x023\x023\x02S\x02t\x02S\x02t\x02\x12\x02T\x02t\x02\x94\x02\x94\x02S\x02t\x02\x94\x82\x03\x16\x12\x03\x15\x036\x02\xf5\x02\xd4\x03u\x03u\x04\x16\x046\x046\x04\x16\x03\xf6\x03\xd5\x03\xd5\x03\xf6\x04\x16\x03\xf6\x03\x95\x03u\x03U\x82\x035\x82\x03\x15\x08\x03U\x03\x15\x035\x02\xf4\x035\x035\x02\xf4\x03V\x03V\x82\x03v4\x035\x03v\x03\x96\x03v\x03U\x03U\x03V\x035\x035\x03\x15\x03\x15\x035\x03v\x03\x14\x03\xb6\x03\xb6\x03\xd6\x03u\x03\xf7\x04\x17\x048\x04\x17\x04\x17\x03\xf7\x04\x17\x04X\x04X\x04y\x04\x99\x04\xda\x04\xb9\x04\xfa\x04\xd9\x04\xb9e\xfb\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xff\xde\xc7=\x1d\x9a\xc7]\xf7\xbe\xf7\xbe\xef\xbe\xef\x9e\xff\xbe\xf7\xde\xff\xde\xf7\xbe\xdf}\xdf]\x82\xff\xde\x00\xff\xdf\x8a\xff\xde\x82\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xdf\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x82\xff\xde\x82\xff\xdf\x85\xff\xde\x00\xff\xdf\x8b\xff\xde%\xff\x9e\xf7=\xf7=\xff\xbe\xff\xbe\xff\x9e\xff\xbe\xf7]\xee{\xf6\xfc\xf7\x9e\xf7]\xc1\xce\xb9n\xc1\x8f\xb9n\xb1N\xb1N\xb9o\xb9o\xa9\x0e\xb1N\xa9.\xa9o\xa1/\x99\x0f\x88\xce\x80\xce\x80\xee\x81\x0fx\xeey\x0ey\x0ep\xeeh\xee`\xeeX\xee`\xee\x82`\xce\x17`\xeeX\xeeY\x0fX\xeeP\xeeH\xeeH\xeeH\xefA\x0f9\x10A09\x109\x109Q1q1Q9\x92)Q)Q\x19Q!q\x19r\x19\x92\x11Q\x82\x11r\x1a\x11\x92\t\x92\t\xb3\t\x92\x01q\t\x92\t\xd3\t\x91\t\xb2\t\xd2\t\xd2\x01\xb2\n\x13\nT\n4\x02\x13\x024\x024\x02t\x02T\x02T\x02\x13\x02T\x02T\x02\x95\x02\xb5\x02\x94\x84\x02t$\x02\x94\x02\x94\x02\x12\x02S\x02t\x02t\x02\xb5\x02\x94\x02t\x02S\x02\x94\x03\x16\x03\x15\x036\x02\xf5\x03\x15\x03\x15\x035\x03\xd6\x046\x04w\x046\x047\x047\x04\x16\x04\x16\x03\xf6\x03\xf6\x04\x16\x047\x03\xf6\x03\x95\x03U\x03U\x03v\x03U\x03V\x84\x03\x15\x00\x02\xf5\x83\x03\x153\x03\x96\x03v\x03\xb7\x03\x97\x03\xd7\x03\x97\x03\x96\x03\xb7\x03\x97\x03v\x03V\x035\x035\x03V\x03V\x03\x96\x03v\x03\xb7\x04\x17\x04\x17\x03\xf7\x03\xd7\x03\xd6\x04\x17\x047\x04X\x04\x17\x04\x17\x048\x04y\x04\x99\x04\xb9\x04\x99\x04y\x15\x19n|\x05\x1a\x04\xfa\x04\xd9\xc7=\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xff\xde\xc7^\xe7\x9e\xff\xde\xf7\xde\xff\xde\xf7\xbe\xef\x9e\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x8b\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x9f\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x82\xff\xde\n\xff\xbe\xff\xbe\xff\x9e\xff\xde\xff\xde\xff\xbe\xff\xbe\xff\xde\xff\xbe\xff\xde\xf7~\x82\xff\xbe<\xf7\x9e\xf7]\xff\x9e\xf7]\xf7~\xf7~\xf7\x1d\xcap\xb9N\xb9\x8f\xb9N\xb9\x8f\xb9\x8f\xb9\xb0\xb9\xb0\xa9N\xa9N\xa9o\xa9o\xa9p\x99O\x88\xeex\xeep\xcdx\xee\x81/y/y\x0fh\xce`\xce`\xeea\x0f`\xee`\xeei\x0fa\x0f`\xefa\x0fa\x0fP\xeeP\xefQ\x0fQ\x0fI\x0fA\x0f909P9\x109Q9Q1Q9\x929\x921r!Q\x19Q!\x92\x19r!r\x19Q\x19\x92\x83\x11\x92\x16\x11\xf3\t\xb2\x01\xb2\t\xd3\x01\xb3\t\x92\x11\xb2\x12\x14\x12\x14\t\xf3\n\x13\nT\n\x13\x02\x13\x024\x024\x02T\x02u\x02T\x02t\x02T\x02\x95\x02\x95\x82\x02\xb5\t\x02\xf5\x02\x94\x023\x02S\x02\x95\x02t\x023\x02t\x02S\x02t\x82\x02\xb5\x04\x02\x94\x02\xb5\x02\xf5\x02\xd5\x02\xf5\x82\x03\x15 \x03v\x04\x17\x03\xd6\x04W\x046\x04W\x047\x04\x16\x03\xf6\x04\x16\x04W\x04\x17\x04\x17\x03\xf6\x03\xf7\x03\x96\x03U\x03U\x03v\x035\x03V\x03V\x03\x15\x035\x03\x15\x02\xf5\x03\x15\x036\x035\x02\xf4\x03\x96\x03\x96\x03\x97\x82\x03\xd7\x10\x03\xb7\x03\xb7\x03\x97\x03\xb7\x03\x97\x03V\x036\x03v\x03\x96\x03\xb7\x03\xb7\x03\xd7\x03\xb6\x03\xd7\x03\xb6\x03u\x03\xf7\x83\x04x\x14\x04X\x048\x04X\x04xEZ\x8e|M\xdb\xd7=5\x9a\x05\x1a\x04\xd9\x05\x1aM\xdb\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xde\xf7\xbe\x8c\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x94\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x0f\xff\xdf\xff\xde\xff}\xf6\xfc\xff\xde\xff\xbe\xf7]\xff\x9e\xff\xbe\xff\x9e\xff\xbe\xff\xde\xff\xbe\xf7\x9e\xff\xbe\xff\x9e\x82\xff\xbe{\xf7~\xf7=\xf7]\xf7\x1d\xb9\x8e\xb9n\xb9\x8e\xb9n\xb9o\xb9\x8f\xb9\xb0\xb9\x8f\xb1o\xa9o\xa9N\xa9o\xa9O\xa1O\x91/\x89\x0f\x81\x0f\x810\x81Py/q\x0fy0q0i/i\x0fi\x0f`\xefi\x0fa\x0f`\xefX\xefX\xefP\xceP\xceP\xeeQ\x0fI/9\x0fAQAq9Q9q9Q1q9r9\x921r1\x93!Q!\x92!\x92)\xb3!\x93!\xb3\x19\x92\x19\xb3\x11\xb3\x11\x92\x11\xb3\t\xb2\t\xd3\t\xd3\t\xb3\t\xb2\x11\xd3\x12\x13\x11\xf3\t\xf3\x124\x12T\x024\x024\x02u\x02T\x02u\x02T\x02u\x02\x95\x02u\x02t\x02\xb5\x02\xb5\x02\x95\x02\xd5\x02\xd5\x02\xb5\x02t\x02T\x02\x94\x02\x95\x02\xb5\x02\x95\x023\x02t\x02\xb4\x02t\x02\x94\x02\x94\x02\xd5\x02\xd5\x02\xf5\x02\xf5\x03\x15\x036\x02\x93\x02\xf4\x03\x96\x03\xd6\x04W\x046\x03\xd5\x047\x047\x04W\x04\x16\x047\x04\x17\x03\xd6\x03\xf7\x04\x17\x82\x03\xb6\x19\x03v\x03\x96\x03\x96\x03\x97\x03v\x03V\x03v\x03V\x02\xf4\x02\xf4\x03\x15\x035\x03\xb7\x03\xb6\x03\xd7\x04\x18\x04\x18\x03\xd8\x03\xd7\x03\xd7\x03\xf8\x04\x18\x03\xd7\x03\x96\x03V\x03\x97\x84\x03\xb7\x1a\x03\xb6\x03\xd7\x03\xf7\x04\x17\x04x\x04x\x04\x98\x04\x99\x04\xb9\x04\x99\x04X\x04X\xd7=\xf7\x9e\xf7\x9e\xe7~\xb6\xfd\x14\xf9\x05\x1a\x05[\x15z\xcf=\xf7\xde\xf7\xde\xf7\xbe\xf7\xbe\xef\x9e\x82\xf7\xde\x84\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x9b\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x8b\xff\xde\x02\xff\x9e\xec\xb6\xf6\xfc\x85\xff\xde\x06\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xf7\x9e\xff\xde\x82\xf7\x9e\x1f\xf7}\xf7~\xe6Z\xf7\x1d\xf6\xfc\xb9M\xc1\xaf\xc1\xd0\xb9\x8f\xb9\xb0\xc1\xd0\xb9\xb0\xb9\xaf\xb9\xb0\xa9O\xa9\x90\xa1O\xa1o\xa1O\x99p\x89/\x91P\x89p\x81/y/y0h\xefi\x0fa\x0fi0iPi\x0f\x82a\x0fCX\xeea\x0fX\xeeY/YPQqIPI\x92ArAq9q9Q9q9r9\x929\x939\x921r1\xb3!Q)\xb3!\x92\x19r\x19r!\x93\x19\x92\x19\x92\x11r\x11\x92\x11\xd3\x11\xd3\t\xb3\t\xb2\x11\xd3\x11\xd3\x11\xf3\x11\xf3\x124\n4\n4\x02U\x02\x14\x024\x02u\x02T\x02u\x02\x95\x02u\x02\x95\x02\x95\x02t\x02\xd5\x02\xb5\x02\xb5\x02\xf5\x02\xb5\x02S\x02T\x02t\x02t\x02\xb5\x02\x94\x02t\x02t\x022\x02\x12\x02\x12\x02\x94\x83\x02\xd5\x1a\x02\xf5\x03\x16\x02\xf5\x02\xb4\x03\xd6\x047\x04w\x04W\x04\x98\x04\x16\x047\x04w\x047\x04\x17\x04\x17\x03\xf7\x03\xf7\x048\x047\x03\xf7\x03\xd7\x03\xd7\x03\xb6\x03\x96\x03U\x03\x96\x03\xb7\x82\x03\x96\x01\x03\xf7\x03\xf7\x83\x03\xd7\x82\x03\xf8*\x03\xd7\x04\x18\x03\xf8\x048\x03\xf7\x03\xf8\x03\x96\x03v\x03\xd7\x03\xb7\x03\x97\x03\x97\x03\xb7\x03\x96\x03\xd7\x04\x17\x047\x04\x98\x04\x98\x04x\x04\xd9\x04\xd9\x04\xb9\x04x\x1c\xf9\xdf]\xe7\x9e\xe7~\xdf]\xf7\xbe\xf7\xbe\xc7^5\xdb%\xbb\xdf\x9e\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xef\x9e\xf7\xde\xf7\xbe\xf7\xbe\x8a\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x8a\xff\xde\x06\xff\xdf\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xff\x83\xff\xde\x05\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\x98\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x87\xff\xde\n\xff\xdf\xf6{\xda\xd1\xf6\xbb\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xbe\xff\xbe\x82\xff\xde\x83\xff\xbe!\xf7\x9e\xff\xbe\xff\x9e\xff\x9e\xf7]\xff~\xee{\xc1\xef\xc1\xcf\xc1\xcf\xcaQ\xcar\xb9\xd0\xb9\xcf\xb9\xf0\xa9\x90\x99.\xa1\x90\x99O\xa1\xb0\xa1p\x99\x91\x91P\x89P\x91p\x810yPq0qPi0qQqqi0a\x0f\x82`\xef\x07Y\x0fY\x0fa0YPYPY\x92Q\x92I\x92\x82A\x92\n9Q9Q9r9rA\x93A\xb3A\xb3A\xf4!Q!r!\x92\x82!\xb38\x19\x92\x19\x92\x19\xd3!\xf4\x11\xb3\x11\xd3\x19\xf4\x11\xd3\x11\xb3\x11\xf3\x11\xf3\x12\x14\x124\n4\n4\x02\x14\x02u\x02T\x02u\x02u\x02\x95\x02u\x02u\x02\x95\x02\x95\x02\xd5\x02\xf6\x02\xd5\x02\xd5\x02\xb5\x02\xb5\x02\x94\x02s\x02S\x023\x02t\x02\x94\x02\x94\x02t\x01\xf1\x02S\x02S\x02t\x02\xb5\x02\xd5\x02\xf5\x02\xb5\x02\xf5\x02\xf5\x02\xd5\x02\xb4\x03\x15\x03u\x047\x04W\x047\x047\x82\x04\x17D\x03\xf7\x03\xf6\x03\xf7\x03\xd6\x04\x17\x04\x17\x03\xf7\x03\xf7\x03\xd7\x03\xd7\x03\x96\x03\xb7\x03v\x03v\x03V\x03\xb6\x03\xf7\x03\xf7\x048\x03\xf7\x03\x96\x03\xd7\x03\xb7\x03\xd8\x03\xf8\x03\xf8\x03\xb6\x03\xf8\x03\xf8\x04\x18\x03\xb7\x03\x96\x03U\x03\x97\x03\xf8\x03\xd7\x03\xd7\x03\xf7\x03\xd7\x03\x96\x03\xd7\x04X\x04X\x04x\x04\xb9\x04\xfa\x04\xfa%z\r\x1aU\xdb\xcf]\xc7\x1d\x86\x1b\xf7\xbe\xdf]\xef\x9e\xf7\xbe\xf7\xbe\xe7}\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\xf7\xde\xb6\xfc\xff\xde\xf7\xbe\x90\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x95\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x9b\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\x8a\xff\xde\x00\xff\xdf\x84\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\x9e\xff\xdf\x82\xff\xde\x06\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\x86\xff\xbe\x11\xff\xdf\xf7>\xe6;\xcbt\xb9\xaf\xb9o\xb9n\xb1\x8f\xb9\xf1\xb9\xf0\xc2\x11\xb1\xb0\xa1.\xa1O\x99/\x91/\x99\x90\x89P\x82\x810\x01\x89Pq\x10\x82qQ9i0iPiQiPa0a0i0a\x10a\x0fa0P\xefYqY\x92Q\x92Q\x92I\xb39Q9Q9r9\x929\x92A\xb39r9RA\x93A\xb39\x93)\x92)\x93!\x92!\xb3!\xd3!\x92\x19\x92\x19\x92!\xd3!\xf3\x19\xd3\x19\xf4\x1a\x14\x1a\x14\x19\xf3\x11\xf3\x1aU\x12T\x12\x14\n4\x024\x01\xf3\x023\x02u\x02\x95\x02u\x02\xb5\x02\x95\x02\x95\x02t\x02\x95\x83\x02\xb5\x04\x02\xd5\x02\xb5\x02\x94\x02\xb5\x02\xb5\x83\x02\x94\x05\x02t\x02\xb5\x02\x94\x02t\x02\x94\x02s\x82\x02\xd5$\x02\xb4\x02\xf5\x02\xb5\x02t\x03\x15\x03\x96\x03\xd7\x04\x17\x047\x04\x17\x04\x16\x03\xd6\x03\xf6\x04\x17\x048\x03\xf7\x04\x17\x03\xf7\x03\xf7\x048\x03\xf7\x03\xf7\x03\xd7\x03\xb7\x03\xd7\x03\xb7\x03\x96\x03\x96\x03\xf7\x03\xf7\x04\x17\x04\x18\x03\xd7\x03\xb7\x03\xb7\x03v\x03\xd8\x83\x03\xf8\x00\x03\xd8\x82\x03\xf8\x07\x03\x96\x03\x96\x03\xf7\x03\xd7\x04Y\x04Y\x048\x04\x18\x82\x048\x0e\x04\xd9\x04\xfa\x04\xd9\x04\xd9f\x1b\x96|\xd7=\xd7=\xe7~\xe7\x9e\xd7]\xf7\xbe\xef\x9e\xf7\xbe\xef\x9e\x82\xf7\xbe\t\xf7\xde\xf7\xbe\xf7\xde\xf7\xbe\xd7]\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\x93\xff\xde\x00\xff\xff\x88\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x9a\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8d\xff\xde\x01\xff\xdf\xff\xdf\x8a\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xbe\x82\xff\xde\x83\xff\xbe\x1e\xf7]\xff\xbe\xff\xbf\xff\xbe\xb4\xb8\x93\x14\xab\x14\xab\x14\xe5Y\xdc\xb7\xd3\xd5\xb1o\xb1o\xb9\x8f\xb9\xaf\xb9\xb0\xa9o\xb1\x90\xa1p\x99\x90\x81py0y0yQq0q1q0qQqqi0iP\x82iq:q\x92iriQqqi0i0aQa\x92Y\x92Y\xb2IqI\xb2A\x92119r9\x92A\xd3A\xb3A\xd3I\xd3A\xd3A\xb3A\xd49\xd39\xb3)\xb3)\xd4)\xd3!\xb3!\xb3!\xd3\x19\x92!\xb3!\xd4!\xf4"\x14\x1a\x14\x19\xf3\x1a\x14\x1aU\x1aU\x12U\n\x13\x02\x14\x02U\x024\x024\x02T\x02\xb5\x02\x95\x02\xb5\x02\xb6\x02\xb5\x02T\x02\xb5\x02\xb5\x02\xf6\x02\xf6\x02\xb5\x82\x02\xd5\x0b\x02\xb5\x02\xb5\x02\xd5\x02\xf5\x02\xb5\x02\xb4\x02\xd5\x02\xb4\x02t\x02\x94\x02\x94\x02\xb4\x83\x02\xd5\x16\x02\xb5\x02\xf6\x02\xf6\x03\x16\x03\x15\x03\xd7\x03\xf7\x04\x17\x03\xf7\x03\xd6\x03\xd6\x03\xf7\x03\xf7\x04\x17\x04\x17\x03\xf7\x03\xd7\x03\xf7\x03\xb6\x04\x18\x03\xf7\x03\xd7\x03\xf7\x82\x03\xd7\x01\x03\x97\x04\x18\x82\x03\xf7\x0b\x03\xf8\x03\xd8\x03\xb7\x03\x97\x03\xb7\x04\x18\x04Y\x03\xf8\x03\xf8\x03\xd7\x03\xd8\x03\xd8\x82\x03\xd7\x01\x04\x18\x04\x18\x82\x04X\r\x04\x18\x04Y\x04Y\x04\x18\x04\x99\x04\xb9\x04\xb9\x04\xd9\x04\xb9~\x1b\xf7\xbe\xdf]\xef\x9e\xef\x9e\x82\xf7\xbe\x02\xb6\xdc\xef\xbe\xef\x9e\x82\xf7\xbe\x08\xff\xde\xf7\xbe\xf7\xde\xef\xbe\xef\x9e\xff\xde\xf7\xbe\xff\xde\xf7\xde\x9e\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xff\x84\xff\xde\x00\xff\xdf\x99\xff\xde\x00\xff\xfe\x88\xff\xde\x00\xff\xdf\x90\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8c\xff\xde!\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xbe\xf7~\xf7\x9e\xff\xbe\xff\xde\xff\xbe\xef=\xff\xbe\x8a\x93y\xb2q\xb2y\xb2\xf7~\xff\xbe\xff\x9e\xee\xdc\xcb\x94\xb1O\xb9o\xb9\x8f\xb1N\xb9\xd0\xc2R\xa1\xb0\x89Pi0qq\x82i1$qQ\x81\xb2y\xb2qriqiqi\x92iqi\x92i\x92iqiQq\xb3i1qqa\x92Y\xb2I\x92I\xb3I\xd39r9\x929r9\x929\x92I\xd4I\xf4I\xd4A\xb3A\xd3A\xd49\xd39\xd39\xd4)\x931\xd4)\xd3\x83!\xb3\x1d!\xb2!\xf4!\xf4"\x14\x1a\x14\x19\xf3\x1a4\x1au\x1a\x95\x12T\nT\x02U\x024\x02U\x02T\x02T\x02u\x02\xb5\x02\x95\x02\xb5\x02\xb5\x02u\x02\xb5\x02\xb5\x02\xf6\x02\xb5\x02\x94\x02\xd5\x02\xb5\x02\xf5\x82\x02\xf6\x00\x03\x16\x82\x02\xd5,\x02\x94\x02s\x02\x94\x02t\x02\x94\x02\xb4\x02\xb5\x02\xb5\x02\xd5\x02\xb5\x02\xd5\x02\xd5\x03\x16\x02\xf5\x02\xf5\x03\x96\x04\x17\x03\xd6\x048\x03\xf7\x03\xf7\x03\xd7\x03\xf7\x03\xf7\x04\x17\x03\xd7\x03\xf7\x04\x17\x048\x048\x03\xd7\x03\xf7\x03\xf7\x03\xf8\x04\x18\x03\xb7\x03\xd8\x03\xf8\x04\x18\x03\xf8\x03\xd7\x03\xb7\x03\x97\x03\x97\x03\xb7\x82\x048\t\x04\x18\x03\xb7\x04\x18\x03\xf8\x03\xf8\x03\xd8\x03\xd7\x03\x96\x03V\x04\x18\x82\x048\x18\x04\x18\x048\x048\x04X\x04\xb9\x04\xd9\x04\xb9\x04\xb9\x86\\\xef\x9e\xe7}\xf7\xbe\xef\x9e\xdf~\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\x82\xff\xde\x01\xef\x9e\xef\xbe\x86\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x01\xff\xff\xff\xff\x8f\xff\xde\x04\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xdf\xad\xff\xde\x01\xff\xff\xff\xff\x8b\xff\xde\x00\xff\xdf\x91\xff\xde\x1b\xff\xbe\xff\xde\xff\xbe\xf7\x9e\xff\xde\xff\xde\xff\xbe\xef=\xd5\xfaq\xb2y\xf3z\x13\x8a\x94\xff\xbe\xff\xbe\xff~\xf6\xfd\xd4\x96\xdc\xf8\xdc\x97\xcbs\xb1\xd0\xb1\xf1\xa9\xd1\x99\x90\x99\xd2qQiQ\x83aQ<iQiqiri\x92iQi\x92aqi\xb2i\xb3iqiriQq\x92iQa\x92I\x92A\x92A\xb39\x929r9\x929\xb39\x929\xb39\x929\x93A\xd4A\xb39\xb39\xb39\xf49\xf4)\x921\xd4)\xb3)\xd4)\xd3!\x92\x19r!\xb3!\xd3\x19\xd3!\xf4\x19\xd3\x19\xf4\x1a\x14\x1aU\x1au\x1a\x95\x1a\xb5\x12u\n\x95\x02u\x02u\x02\x13\nu\n\x95\x02\xb5\x02\x95\x02\xd6\x02t\x82\x02\xb5:\x02\xd6\x02\xd5\x02\xd5\x02\xf6\x02\xf5\x02\xf6\x036\x03\x16\x02\xf5\x03\x16\x02\xd5\x02\xf5\x02\xd5\x02\xd5\x02\x94\x02\x94\x02\xd5\x02\xd5\x02\xf5\x02\xd5\x02\xb4\x02\xb5\x02\xd5\x02\xd5\x02\xb4\x02\xf5\x03\x15\x035\x035\x03\xd7\x04\x17\x047\x03\xd6\x03\xb6\x03\xd6\x03\xf7\x03\x96\x03\xb6\x03T\x03\xd7\x03\xf7\x04\x18\x04\x18\x048\x03\xf7\x03\xf8\x03\xd7\x03\xf8\x03\xd8\x048\x04\x18\x03\xf8\x03\xd7\x04\x18\x03\x97\x03\x15\x036\x035\x048\x82\x04Y\x19\x04\x18\x04\x18\x04Y\x03\xf8\x03\xf8\x03\xb7\x03V\x03\x97\x03\x97\x03\xf8\x03\xf8\x04y\x04y\x04Y\x04Y\x04y\x04\xda\x04\xfa-\xbb\x04\xda\x9e\x9c\xef\x9e\xf7\xbe\xf7\xbe\xe7\x9en;\x82\xf7\xbe\x02\xe7~\xd7]\xf7\xde\x83\xff\xde\x06\xf7\xde\xff\xde\xf7\xbe\xc7=\x04X\x04y\x85\xfa\x86\xff\xde\x01\xdf~\xef\xbe\x90\xff\xde\x00\xff\xdf\xa2\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x92\xff\xde\x03\xff\xdf\xff\xde\xff\xff\xff\xdf\x85\xff\xde\x82\xff\xdf\x8b\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xbe\xff\xde\xff\xde\xff\xbe\x82\xff\xde9\xf7\xbe\xef\x1d\x8a\xb4\x82SzS\xde\\\xff\xbe\xf7]\xf7]\xdd\x99\xff~\xf7^\xf6\xfd\xed\xd9\xc3\x13\xa9\xd1\xa9\xf1\xaa2\x9a\x13y\xd3q\xb2aqi\x92aqq\xb2q\xb3i\x92i\x92q\xd3q\xd3i\xb3i\xb3i\x92i\x93aQi\x92q\xb3q\xb3i\x92Y\x92A\x92A\x92A\xb3A\xb3A\xf49\xb39\xb39\xd4A\xd49\x939\x939\xb3A\xd39\xb3A\xd49\xd39\xf4:\x14\x82)\xd3\x18!\x92\x19q!\x92!\xb3!\xb3\x19\xb2\x19\xb2\x19\xb3\x11\xb3\x19\xd3\x11\xd3\x1a4\x1aU\x1au\x1a\xb6\n\x95\x02T\x024\nu\x1au"\xb6\x1a\xb5\x02\xf6\x02\x95\x02u\x82\x02\xb5\x03\x02\xd5\x02\xf6\x02\xd5\x02\xd5\x82\x02\xf5\x08\x02\xd5\x03\x15\x03V\x036\x036\x03V\x036\x02\xd5\x02\xb4\x85\x02\xd5\x07\x03\x16\x02\xf5\x02\xf5\x03\x16\x02\xf5\x03\x15\x02\xd4\x03v\x83\x03\xf7\x1e\x03\xd7\x03\xb6\x03\x14\x03u\x03\x96\x03\xd7\x03\x96\x03\xf7\x04\x18\x04\x18\x03\xb7\x03\xd7\x03\xf8\x03\xf8\x03\xb7\x03\xb7\x03\xf8\x03\xd7\x03\xd7\x03\xf8\x04\x18\x03\xd8\x03\x97\x03v\x03\xf8\x048\x04Y\x049\x049\x04y\x04y\x82\x03\xf8\x1b\x03\xb7\x03\xf8\x03\xb7\x04\x18\x03\xf8\x04y\x04Y\x04Y\x04y\x04y\x04\xda\x05\x1a\x04\xfa\x04\xb9%\x19\xe7}\xef\x9e\xf7\xbf\xf7\xbe\xf7\xbe\xc7=f\x1b\xf7\xde\xf7\xbe\xe7\x9e\xef\xbe\xff\xde\xf7\xde\x83\xff\xde\x04\xf7\xbe\xae\xfd\x04X\x048\x1cx\x86\xff\xde\x01\xf7\xde\xf7\xde\x86\xff\xde\x01\xff\xff\xff\xdf\x83\xff\xde\x05\xff\xdf\xff\xde\xff\xde\xff\xfe\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x84\xff\xde\x06\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xff\x92\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xff\x92\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x84\xff\xde\x02\xff\xdf\xff\xde\xff\xbe\x82\xff\xde\x84\xff\xbe"\xff\xde\xff\xbe\xff\xbe\xf7\x9e\xff\xde\xff\xde\xff\xbe\xf7\x9e\xdd\xfa\xf7~\xff\x9e\xf7=\xf7=\xe5\x99\xc2\xf2\xa9\x8f\xa9\xd0\xa9\xf1\x89\xb1y\xd2q\xf3i\xd3i\xb2i\xb2q\xd3i\xb2i\xb2aqy\xf3q\xd3i\xb2i\xb3ari\xb3ar\x82i\x92\x1bq\xb3i\x92a\xb3I\x92I\xb3A\xb3I\xf4B\x149\xb3B\x14A\xf4A\xf49\xb3A\xd3A\xd3A\xb39\xb39\xd39\xd39\xf42\x141\xf41\xf4)\xd3)\xd3)\xf4)\xf4!\xd3\x82\x19\x92\x1e\x19\xb2\x19\xb3\x11\x92\x11\x92\x1a\x14\x1a4\x1at\x1a\xd6\x12\x95\nT\x02\x14\x12U\x1aT"T"\xb5\n\x95\x024\x02T\x02t\x02\x95\x02\xb5\x02\xf6\x02\xf5\x02\xb5\x02\xb5\x03\x15\x03\x16\x03\x16\x03V\x036\x03v\x82\x03\x97\x00\x035\x82\x02\xd5\x02\x02\xf5\x02\xf5\x03\x15\x84\x03\x16\x1e\x02\xf5\x03\x16\x03\x15\x02\xd5\x02\xb4\x03U\x03\xd7\x03\xd7\x03\xb6\x03\xf7\x03\xd6\x03\xb7\x035\x02\xf4\x02\xd3\x035\x03\x96\x03\xb7\x03\xf8\x03\xd7\x03\xd7\x03\xf7\x03\xf7\x03\xd7\x03\xd7\x04\x18\x03\xf7\x04\x18\x04\x18\x049\x049\x82\x03\xf8\x18\x04\x18\x04\x19\x049\x04Y\x049\x049\x03\xf8\x03\xd7\x03\xd8\x04\x18\x03\xd7\x03\xd7\x03\xf8\x04\x18\x04y\x04y\x04\xda\x04\xda\x04y\x04\xb9\x05\x1a\x05;\x05\x1a\x04\x98e\x9a\x86\xf7\xbe\x05\xe7}\xf7\xde\xff\xde\xff\xde\xef\xbe\xf7\xbe\x83\xff\xde\x03\xf7\xde]\x99\x1c7\x85y\x83\xff\xde\x00\xf7\xde\x8d\xff\xde\x00\xff\xff\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xdf\xff\xff\x8b\xff\xde\x01\xff\xdf\xff\xdf\x8b\xff\xde\x01\xff\xdf\xff\xdf\x9b\xff\xde\x00\xff\xdf\x91\xff\xde\x01\xff\xdf\xff\xbe\x82\xff\xde\x03\xff\xdf\xff\xde\xff\xbe\xf7\x9e\x86\xff\xbe\x00\xf7\x9e\x82\xff\xbe\x13\xf7=\xd5y\xff\xbe\xff\x9e\xf7]\xee\x9b\xcc5\xa9\xf0\xa9\xd0\xb22\xaaSq\x91y\xd3q\xf3i\xd3i\xb3q\xd3q\xd3i\x92i\xb2\x82q\xd3\x03q\xf3i\xb3i\xb3a\x92\x82i\xb3Ci\x92q\xd3q\xd3a\xd3I\xb2I\xd3A\xb3A\xf49\xd39\xb39\x939\xd3A\xd4A\xf4A\xf4A\xd4A\xb3A\xd4A\xf49\xb3:\x14:5252\x142\x14)\xf4*\x14*\x14!\xd3\x19\xb3\x19\xd3\x11\x92\x19\xd3\x19\xd3\x11\xd3\x11\xd3\x1aU\x12\x14\x12T\x1a\x95\x12u\x02T\nu\nT\x1aT"4\x12\x13\nT\x023\x02\x94\x02\x95\x02\x95\x02\x94\x02\x95\x02\x94\x02\xd5\x02\xd5\x036\x036\x03V\x03V\x03v\x03\xb7\x03\xb7\x03V\x035\x035\x02\xb4\x82\x02\xd5\x83\x036\x1c\x03\x16\x03\x16\x02\xd5\x02\xb5\x02s\x02\xd5\x02\xf5\x02\xb4\x02\xf5\x03\x15\x03\x15\x03\xb7\x03\xb6\x03v\x02\xf4\x02\xf5\x02R\x02\x11\x02\xf4\x03v\x03\xd7\x03\xf8\x04\x18\x03\xf8\x03\xd7\x03\xb7\x03\xb7\x03\xf8\x04Y\x83\x04\x18\x0c\x03\xf8\x03\xf8\x03\x97\x03v\x03\xb7\x04\x18\x04Y\x04Y\x04\x19\x03\xd7\x03\xf8\x03\xd7\x03\xf8\x82\x04\x18\x0e\x03\xf8\x049\x04\x99\x04\xb9\x04\xda\x04\xba\x04\xfa\x04\xda\x05\x1a\x05:\x05\x1a\x04\xd9\x04\x99%:\xd7]\x84\xf7\xbe\x07\xef\x9e\xf7\xbe\xff\xde\xff\xdf\xf7\xbe\xcf\x1c\xf7\xde\xf7\xbe\x82\xff\xde\x02\xff\xbe\xf7\xbe\xf7\xbe\x83\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\xa0\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x83\xff\xbe\x00\xff\xde\x84\xff\xbe\x14\xf7~\xf7^\xff\xde\xf7\x1d\xf6\xfd\xf7=\xf7]\xdd\x9a\xa1\xb1\xa2S\x89\xf2i\x91q\xd3ari\x92q\xd3i\xb2r\x14i\xb2z\x14z\x14\x82q\xd3\x01i\xb3i\xb2\x83i\xb3\x1ai\x92q\xf4q\xd3i\xb3Q\xb3I\xd3J\x14J5J4A\xd3B\x149\xb39\xb39\xd39\xd3A\xd49\xb3B\x14B\x149\xf41\xf41\xf4252\x14)\xf4)\xf4*\x14\x83\x19\xb3\x08\x11\x93\x11\xb3\x11\x92\x19\xd3\x19\xf4\x1aU\x12T\n4\x12\x95\x82\x02T4\n4\x11\xf3\x1a\x13\x01\xb1\x024\x02T\x02\xb5\x02\xb5\x02T\x02\x94\x02\xd6\x02\xf6\x02\xd5\x02\xb4\x02\xd5\x03V\x03V\x03\xb7\x03\x96\x03\x97\x03\x97\x03V\x035\x03V\x02\xf5\x02\xf6\x02\xd5\x02\xd5\x03\x16\x03\x16\x036\x036\x03\x16\x02\xf6\x02\xb5\x02\xd5\x02\x94\x02\xd5\x02\xf5\x02\xf5\x03\x16\x02\xf5\x02\xd5\x02\xd5\x03V\x03V\x02\xf4\x035\x03\x15\x02\x93\x02\xf4\x03\x97\x03\xf8\x82\x04\x18\x11\x03\xd7\x03\xb7\x03\xf8\x03\xd7\x03\xd7\x04\x18\x04y\x04Y\x03\xf8\x04\x18\x03\xb7\x03\xb7\x03\xf8\x04\x18\x049\x04Y\x04Y\x03\xf8\x82\x03\xb7\x00\x03\xf8\x82\x049\x1d\x03\xf8\x03\xd7\x0cx]\xbb\x14\xb9\x04\xfa\x04\xfa\x0c\xfa\x04\xda\x05;\x05[\x04\xfa\x04\x99=z\xf7\xbe\xff\xdf\xff\xde\xf7\xde\xef\xbe\xf7\xbe\xef\x9e\xef\x9e\xf7\xde\xe7}\xf7\xde\xf7\xbe\xff\xdf\xff\xde\xf7\xbe\xe7}\x83\xff\xde\x06\xf7\xbe\xff\xde\xff\xde\xf7\xbe\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xdf\x93\xff\xde\x02\xff\xdf\xff\xdf\xff\xfe\x90\xff\xde\x01\xff\xdf\xff\xff\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x8c\xff\xde\x01\xdd7\xf6\xfc\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xbe\x82\xff\xde\x12\xf7\x9e\xff\xde\xf7]\xf7~\xff\xbe\xff\xbe\xf7~\xaaQ\xd4\xd7\xf7=qP\x81\xb2\x8a\x14y\xf3\x824z\x13q\xf4q\xf4y\xf4\x83z\x14\tq\xf3q\xd3i\xb3q\xd3i\xb3i\xd3i\xb3q\xd4q\xf4q\xd3\x83i\xb3\x11Q\x92ArA\xb3A\xd3A\xf4B\x149\xd49\xd39\xd49\xb39\x939\xb39\xd39\xf41\xd31\xd31\xf4)\xd3\x82)\xf4v*\x14!\xf4\x19\xb3\x19\xd3\x19\x93\x19\x93\x19\xd4\x11q\tQ\x19\xf3\x19\xf4\x12u\n4\nu\nT\x02u\x02U\x02T\x02T\x01\xf3\x01\xf3\x024\x02T\x02u\x02\x95\x02\x95\x02t\x02\xd6\x02\xb5\x02\xb5\x02\xd5\x02\xb5\x02\x94\x03V\x03v\x03\xb7\x03U\x03\x96\x03\xb7\x03V\x03w\x03w\x03\x16\x02\xf5\x02\xd5\x02\xd5\x02\xb4\x036\x036\x03\x16\x02\xf6\x02\xb5\x02S\x02s\x02\x94\x02\xf5\x02\xf5\x02\x94\x02\xb4\x02\xd5\x02\xb5\x02\xd4\x02\xd4\x02\xf5\x03\x15\x03V\x02\xd4\x02\xd4\x02\xf5\x03v\x03\xf7\x03\xf8\x03\xf8\x03\xd7\x03\xb7\x03\x97\x03v\x03V\x03\x96\x048\x049\x04Y\x04Y\x049\x049\x04\x19\x03\xf8\x04\x18\x04\x19\x04Y\x04y\x04Y\x049\x049\x04\x18\x03\xf8\x03\xb7\x04\x18\x049\x0cy\x8e\\\x86;\xbf\x1d\xbe\xfd5\x9b\x04\xfa\x1dZ\x04\xda\x05\x1a\x05\x1b\x05\x1a\x04x\x14\x98\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\xf7\xbe\x82\xff\xde\x02\xef\xbe\xf7\xde\xff\xdf\x95\xff\xde\x00\xff\xff\x88\xff\xde\x01\xff\xdf\xff\xdf\x85\xff\xde\x02\xff\xfe\xff\xdf\xff\xfe\x8a\xff\xde\x00\xff\xdf\x82\xff\xde\x03\xff\xfe\xff\xdf\xff\xde\xff\xdf\x83\xff\xde\x00\xff\xdf\x96\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x85\xff\xde\x07\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x90\xff\xde\x05\xff\xbe\xff\xbe\xef=\xcd\xb9\xff\xbe\xff\xde\x82\xff\xbe\x01\xff\xde\xff\xde\x83\xff\xbe7\xee\xdc\xf7=\xbc\xb9y\xd3y\xd3\x8a4\x8aTy\xf3\x824\x825q\xf3z\x14q\xf4q\xf4q\xf3q\xd3q\xf3q\xd3q\xf3i\xb3i\xb3a\x92ari\xb3i\xd3a\x92i\xb3i\xb3q\xf4i\xf4Q\xb3I\x939rA\xb3A\xf39\xd3B\x14B\x149\xb3A\xd49\xb3A\xf49\xd3B5A\xf41\xd31\xf41\xf4)\xd32\x15)\xf4*\x14!\xf4\x19\xb3\x19\xd4\x19\xb3\x82\x19\xd3*\x11\x92\x11\xd3\x11\xf4\t\xf3\n\x14\x024\x02\x95\x02\xb5\x02\xb5\x02t\x02\x95\x02T\x02\x13\x02U\x023\x02u\x02u\x02\xb5\x02\xb5\x02\xd5\x02\xd5\x02\xb5\x02\xd5\x02\xb5\x02\xb5\x03v\x03v\x03\xb7\x03U\x03\xb7\x03v\x035\x036\x03\x15\x02\xf5\x02\xf5\x02\xb4\x02\x94\x03\x16\x03V\x03\x16\x02\xd5\x02\xf6\x82\x02\xd5\t\x02\x94\x02\xb5\x02\xf5\x02\xb4\x02\xb4\x02\xd5\x02\xb4\x02\xd5\x02\xd5\x02\xf5\x82\x02\xb4\x03\x03\x16\x02\xf5\x02\xf5\x03\x96\x82\x03\xf89\x04\x18\x03\xd8\x03\xd7\x03\xd8\x03\xf8\x04\x19\x04\x18\x03\xf8\x03\xd8\x04\x18\x04\x18\x049\x049\x04\x18\x03\xd8\x04\x18\x049\x04z\x049\x03\xf8\x04\x18\x049\x049\x04\x18\x03\xf8%\x1a\xd7~\xef\xbem\xdb\xe7\x9e\xae\xbc\xbe\xfd\xc7\x1d\xc7=\x0c\xd9\x04\xb9=:=Z\x04x~;\xf7\xbe\xf7\x9e\xef~\xef\x9e\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xff\xde\xf7\xbe\xff\xde\xff\xde\xf7\xde\xf7\xde\xff\xde\xf7\xbe\x84\xff\xde\x00\xe7}\x86\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xff\x90\xff\xde\x04\xff\xdf\xff\xff\xff\xff\xff\xdf\xff\xdf\x89\xff\xde\x00\xff\xdf\x97\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x85\xff\xde\x00\xff\xdf\x84\xff\xde\x05\xff\xdf\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xdf\x89\xff\xde\x01\xff\xbe\xff\xdf\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xff\xbe\xee\xfc\x83\xff\xbe\x02\xff\xdf\xff\xbe\xff\xde\x83\xff\xbe6\xf7\x9e\xf7^zTz4z\x14\x824\x8au\x824\x824i\xb2i\xb2q\xf4q\xf3q\xd3q\xd3q\xf3q\xf4y\xf4q\xf3i\xb3a\x92i\xb3i\xb3a\xb3i\xd3a\x92a\xb3i\xb3i\xd4r\x15Q\x92I\xb3Q\xb4A\xd39\xd39\xd39\xf4B\x149\xd49\xb39\xb3A\xf4B\x14B\x14B51\xf41\xd32\x14)\xf4)\xf4*\x14*\x14\x19\xb3\x19\x93\x11\x93\x82\x19\xd3\x06\x19\xf4\x11\xd3\x1a\x14\x11\xd3\n\x14\n4\x02U\x83\x02\x95\x00\x02u\x86\x02\x95\x17\x02\xd5\x02\xb5\x02\x95\x023\x02t\x02t\x02\xf5\x036\x03v\x03\x96\x03v\x03\x96\x03\xb7\x03V\x03\x15\x03\x15\x02\xd5\x02\xd5\x02\xb5\x02\xd5\x02\xf6\x02\xf5\x03\x16\x03\x16\x82\x02\xd5\n\x03\x16\x02\xf5\x02\xb5\x02\xd5\x02\xb4\x02\xb4\x02\xb5\x02s\x02\xd5\x02\xf5\x02\xb4\x82\x02\xd5\t\x02\xf5\x02\xf5\x03\x15\x03\x15\x03\x97\x04\x18\x03\xf8\x03\xd7\x03\xb7\x03\xd8\x82\x03\xb7$\x03\xf8\x03\xf8\x04\x18\x04z\x04Y\x049\x049\x03\xd7\x04\x19\x04Y\x04z\x04y\x04y\x04Y\x04\x18\x04Y\x049\x049\x03\xf8\x04y\x1c\xb9Ez\xdf^\xef\x9e\xf7\xbe\xef\x9e\xef\xbe\xef\x9ee\xfa\xd7~\xf7\xde\xf7\xde\xd7^\x1d\x19M\xdb\xcf=\xff\xde\x84\xf7\xbe\x00\xef\x9e\x82\xf7\xbe\x03\xf7\xde\xff\xde\xff\xde\xf7\xbe\x8a\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x89\xff\xde\x01\xff\xff\xff\xdf\x9b\xff\xde\x00\xff\xbe\x89\xff\xde\x01\xff\xff\xff\xfe\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x8a\xff\xde\x01\xff\xdf\xff\xdf\x8e\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xf7\x9e\xff\xde\x82\xff\xbe\x03\xff\xdf\xff\xde\xff\xde\xf7~\x83\xff\xbe\x15\xee\xdd\x82\x95z\x13zT\x8au\x8a4\x824y\xf3q\xd3q\xd3q\xf3r\x13q\xf3q\xf3q\xd3q\xf4\x82Uz\x14q\xf4i\xb3a\xb3i\xd4\x82a\xd4.a\x93a\xb3i\xd4a\xd3a\xf4Q\xb3Q\xf49\x92A\xd3A\xf49\xf4A\xf4B\x149\xb3A\xf41\xb3A\xf4B\x14B59\xf4:\x14:52525*\x14)\xf4\x19\xb3\x19\xd4\x11\xb3\x11\xd3\x19\xf3\x11\xb3\x19\xd3\x19\xf4\x12\x14\x12\x14\nT\x024\x02t\x02\xb6\x02\x95\x02T\x02T\x02\x95\x02\x95\x02\xb6\x02\x95\x82\x02\xb5\x08\x02\xd5\x02\xd5\x02t\x023\x02t\x02\x94\x02\xf5\x02\xf5\x03V\x83\x03v\x01\x03V\x03V\x82\x03\x15\x82\x02\xb5*\x02\xd5\x037\x02\xf6\x02\xd5\x02\xd5\x02\xf6\x02\xb5\x02\x95\x02\xb5\x02\xb5\x02\xd5\x02\xf5\x02\xf5\x03\x16\x02\xd5\x02\xd5\x036\x02\xf5\x02s\x02\xf5\x02\xd5\x02s\x02\x94\x02\xd5\x02\xd5\x036\x03v\x04\x18\x03\xb7\x03\xb7\x03\x97\x03\x97\x03\xf8\x03\xf8\x04\x18\x049\x049\x04Y\x04Y\x04z\x048\x04Y\x04Y\x82\x049\x0f\x04Y\x04\x18\x049\x04z\x04Y\x04\x18\x03\xb7\x15\x1b\xd7]\xef\xbe\xf7\xbe\xef\x9e\xef\x9e\xef\xbe\xf7\xdf\xef\x9e\x84\xf7\xde\t\xdf~\x96|-:\xcf=\xf7\xde\xf7\xbe\xef\x9e\xcf=\xff\xde\xf7\xbe\x8b\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x85\xff\xde\x02\xff\xff\xff\xff\xff\xfe\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\xa7\xff\xde\x00\xff\xff\x83\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x85\xff\xde=\xff\xdf\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\x9e\xff\xde\xff\xdf\xff\xbe\xff\xbe\xcdzz\x13\x82t\x8a\xd6q\xd3y\xf3q\xb2q\xd3iqz3\x82\x94i\xf2\xb4\x98\x9b\x96r\x13q\xf3i\xd3q\xf3i\xd3a\xd3a\xd4a\xd3a\xb3a\xb3a\xd4a\xd3Y\xb3a\xd4a\xf4a\xf4b\x14Q\xd3I\xd3A\xf49\xb2A\xf3B\x149\xf4BUB\x15B5J5B\x14B\x15:\x14:5\x832\x14\x15*\x14"\x14\x19\xd3\x19\xd3\x11\xd3\x11\xd3\x11\xb3\tr\x11\xd3\x12\x14\n\x14\x02T\x02u\x02\xd6\x02\x95\x02\x95\x02u\x02u\x02\xb5\x02\xb6\x02\xf6\x02\xd6\x83\x02\xb5\x06\x02\x94\x02t\x02t\x02\x94\x02\xb5\x02\xf5\x03V\x84\x03v\x0c\x03\x15\x03\x15\x03V\x036\x02\xd5\x02\xb5\x02\xd5\x02\xf6\x03\x16\x02\xf5\x02\xf6\x02\xb5\x02\xd6\x83\x02\xf6\x02\x02\xb5\x02\xd5\x02\xf5\x82\x03\x16\x01\x02\xf5\x03\x16\x82\x02\xf5\'\x02\xf6\x02\xf5\x02\xb4\x02\xf5\x02\xf5\x02\xd5\x036\x03\x97\x03\xf8\x03v\x03\x97\x03\xb7\x03\xf8\x04\x18\x049\x049\x03\xf8\x03\xf8\x04Y\x04\x9a\x04z\x049\x04\x19\x049\x04Y\x04Y\x04\x19\x049\x049\x04\xba\x04Y\x04Y\x049\x04y={\xe7~\xf7\xdf\xf7\xbe\xf7\xbe\xef\xbe\x82\xf7\xbe\x0e\xe7~\xef\xbe\xdf~\xf7\xbe\xff\xde\xf7\xdf\xef\xbe\xae\xbc\x86\x9c\xf7\xbe\xf7\xbe\xef\x9e\xf7\xbe\xf7\xbe\xf7\xde\x86\xff\xde\x00\xf7\xbe\x89\xff\xde\x01\xff\xdf\xff\xdf\x85\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xdf\xff\xff\xa0\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x96\xff\xde\x00\xff\xdf\x88\xff\xde!\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xee\xfd\xa3vz\x13\x82S\xbc\xf9\xd5\xfbz\x13aqaqz3\xf7=\xe6\xbc\xe6|\xde[\xcd\x9a\xcdZr4j\x14a\xd3a\xb3a\xd3a\xb3a\xd3Y\xb3\x82a\xf4fY\xd4a\xf4Y\xd3Y\xb3Q\xd3Q\xf4I\xb3I\xf4A\xf3B\x14B4B5B\x15B5JvJ5B5B\x14:\x14:52\x14252425:u2u\x19\xd3\x11\xd3\x11\xd3\x11\xf4\x11\xd3\x11\xb2\x11\xb3\x12\x14\nu\x02\x95\x02\xd6\x02\xd6\x02\x95\x02T\x02u\x02\x95\x02\x95\x02\xf6\x02\xd6\x02\xd6\x02\xb5\x02\xd5\x02\xf6\x02\xf6\x02\x95\x02t\x02\xb4\x02\xb4\x02\xd5\x03V\x03\x97\x03\xb7\x03\x97\x03\x96\x03v\x03v\x03V\x036\x03V\x03V\x03\x15\x02\xb5\x02\xf6\x02\xf6\x03\x16\x02\xd5\x02\xd5\x02\xb5\x02\xd5\x02\x94\x03\x16\x02\xb5\x02\xb5\x02\x94\x02\xd5\x03\x16\x02\xd5\x02\xf5\x02\xd5\x02\xf5\x02\xf5\x02\xf6\x03\x16\x02\xf6\x03\x16\x03V\x03V\x02\xf5\x036\x036\x03\x16\x02\xf5\x03\x15\x03\xb7\x03\xd8\x03\xf8\x049\x82\x04Y\x16\x03\xd8\x03\x97\x03\xf8\x049\x04Y\x04Z\x04\x19\x04\x19\x049\x049\x04\x18\x049\x04z\x04\x9a\x04\x9a\x04\xba\x04\xba\x04\x9a\x04y\xcf]\xf7\xbe\xf7\xde\xef\x9e\x83\xf7\xbe\x0f\xef\x9e\xf7\xdf\xae\xdc\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xff\xdf\x15Z5\xbb\xdf~\xf7\xbe\xef\x9e\xff\xde\xff\xde\xf7\xde\x88\xff\xde\x00\xf7\xde\x83\xff\xde\x00\xff\xdf\x8e\xff\xde\x01\xff\xdf\xff\xff\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x8b\xff\xde\x02\xff\xdf\xff\xff\xff\xff\x87\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xbe\x87\xff\xdeP\xf7~\xb4\xb8\xbc\xf9\xff\xbf\xff\xde\xff\xde\xff\xdf\xff\xbe\xff\xbe\xd5\xda\x8a\x94z\x13\xc4\xf9\xf7=\xff\xbe\xff\x9e\xee\xfd\xacW\x9bv\xb4x\xf7^\xe6\xbc\xf7~\xef\x1d\xd6\x1b\xf7]\x93\x96a\xd3a\xf3a\xf4a\xd3Y\xd3a\xd4a\xf4Y\xd4Y\xf4b5b\x15Y\xd4Q\xb3I\x92I\xd4A\xb3A\xd49\xb2JUBUJUBUJUB5B5Jv9\xf3:\x142\x14)\xf4)\xf4252U2u2u*U"\x14\x19\xd3\x11\xf3\x11\xf4\x12\x14\t\xb2\x12\x14\t\xf3\n\x95\x02\xb6\x02\xd6\x02\xd6\x02t\x02\x95\x02\xd5\x02\xd6\x02\xf6\x02\xb5\x82\x02\xf65\x02\xd5\x02\xf6\x02\xf6\x02\xb5\x02\xb4\x02\xf5\x02\xf5\x036\x02\xf5\x03V\x035\x03\x97\x03v\x03\xb7\x03\x97\x03v\x03v\x03V\x03V\x036\x03\x16\x03\x16\x02\xf5\x02\xf5\x02\xd5\x02\xf6\x02\xb5\x02s\x02\xd5\x02\xb5\x02\xf6\x02\xb4\x02\xd5\x02\xd5\x02\xf5\x03\x16\x02\xd5\x02\xd5\x02\xf5\x02\xf5\x02\xd5\x02\xf6\x02\xf5\x03W\x03w\x03\x97\x03W\x03w\x036\x036\x03V\x036\x03v\x049\x83\x04Y\x1e\x04\x18\x04\x19\x049\x049\x04Y\x04z\x04Z\x04\x19\x049\x04\x9a\x04\xba\x04z\x04Y\x04z\x04\x9a\x04\x9a\x04\xdb\x04\xdb\x04\x9a\x04\x9a\xef\x9e\xf7\xbe\xf7\xbe\xef\xbe\xf7\xbe\xf7\xde\xf7\xde\xef\x9e\xf7\xbe\xf7\xbe\xf7\xde\x82\xf7\xbe\t\xef\xbe\xe7\x9e\xb7=\r:\r:\xc7]\xe7\xbe\xf7\xbe\xff\xbe\xff\xdf\x99\xff\xde\x03\xff\xdf\xff\xde\xff\xff\xff\xdf\x87\xff\xde\x04\xff\xff\xff\xdf\xff\xde\xff\xde\xff\xdf\x87\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xff\x86\xff\xde\x01\xff\xff\xff\xff\x85\xff\xde\x03\xff\xfe\xff\xde\xff\xde\xff\xdf\x83\xff\xde\x01\xff\xff\xff\xff\x8c\xff\xde\x00\xff\xff\x8c\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x88\xff\xde\x04\xff\xdf\xdd\x99\xe6:\xff\xbe\xff\xbe\x84\xff\xde\x0f\xff\xdf\xf7^\x9b5\x8a3\xf7]\xff\xbe\xf7\x9e\xff\xbe\xff\x9e\xf7\x1d\xa3\x96\x823\x8a\xb3\xff\xbe\xff\x9e\xd5\xda\x83\xff\xbe7\xef]\xf7^\xe6\xdd\xcd\xba\xe6\xdc\xe6\xbc\xcd\xfaj\x13Y\xb2Y\x92a\xd3Y\xf4Y\xd4Y\xb3Y\xf4b5Q\xf4b5bUb\x14b\x14A\x92A\xd3J5JUA\xf4B5BUB4BUBv:5B5B5BU:5)\xb3!\x92!\xd32U2u2\x952\x95*u"\x14\x11\x92\x19\xf4\x11\xf4\x1a5\x1aU\x124\x12\xb6\n\x95\x02\xb5\x03\x16\x02\xf5\x82\x02\xd51\x02\xf6\x02\xd5\x02\x95\x03\x16\x02\xf6\x02\xf6\x02\xf5\x02\xd5\x02\xd4\x036\x036\x03\x15\x03V\x03\x15\x03\x16\x03\x15\x03\x15\x03\x96\x03v\x03\xb7\x03\xb7\x03\x97\x035\x036\x036\x03\x16\x03\x16\x036\x02\xf5\x03\x16\x02\xf5\x02\xd5\x02\xd5\x02\xb5\x02\xd5\x02\xb5\x02\xd5\x02\xd5\x02\xf5\x036\x03\x16\x03\x15\x02\xf6\x03\x16\x02\xf5\x036\x03\x16\x03\x16\x03V\x02\xb4\x83\x03\x97\x13\x03V\x03V\x036\x03\x15\x03\xd8\x049\x04Y\x04y\x04z\x049\x049\x03\xf8\x049\x04\x19\x049\x04Y\x049\x04z\x04z\x04y\x82\x04\x9a\x0e\x04\x99\x04\xba\x04\xfb\x04\xda\x04\xda\x04\xba\x0c\xb9\xf7\xbe\xef\xbe\xf7\xbe\xd7]\xf7\xbe\x96\xbcv|\xef\xbe\x83\xf7\xbe\x0b\xef\xbe\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xef\xbe5\xbb\x04\xd9\x04\xb9\x0c\x99M\xba\xf7\xde\x9e\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xff\x83\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x89\xff\xde\t\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x98\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x84\xff\xde)\xf7~\xf7^\xff\xdf\xf7~\xff\x9e\xcd:\xa36\x92t\x8au\x8a\x94\xee\xdd\xff\xbe\xf7~\xc4\xd8\xf7\x9e\xff\x9e\xf7~\xf7~\xf7\x9e\xff\xbe\xcd\xdaz\xf4\xef=\xf7\x9e\xe6\xbdY\xb2Y\xb3Y\x92a\xf4Y\xf4Y\xf4Q\xd4Y\xf4Z\x15Z5Z5bUZ\x14bvA\xb39\xd3B\x14\x82JU\rB5Ju:\x14Bv:U:5Bu:V252U*\x14"\x14*U*4\x83*U\x11\x1a\x14\x1a\x14\x1a4\x1a4\x1au\x1a\xb5\x12\xd6\n\xb5\x02\xb5\x02\xf6\x02\xf6\x036\x02\xf6\x03\x16\x02\xf5\x03\x16\x02\xb5\x02\xd5\x82\x02\xb5\x01\x02\xf5\x03\x15\x82\x03v\x0c\x03V\x035\x02\xf5\x03\x15\x036\x03v\x03\x96\x03\xd7\x03\x97\x035\x035\x036\x03\x15\x82\x03\x168\x02\xf6\x03\x16\x03\x16\x02\xf6\x02\xf6\x02\xb5\x02\xd5\x02\x94\x02\xb4\x02\xb4\x036\x03\x15\x036\x02\xf5\x037\x03\x16\x03\x16\x02\xd5\x036\x036\x03W\x02\xf5\x03V\x03\xb8\x03\x97\x03\xd8\x03\xb7\x03\xb8\x03\x97\x03V\x03\xd8\x04Y\x049\x048\x04\x9a\x04z\x049\x04Y\x04\x19\x049\x04y\x04z\x04\xba\x04\xba\x04\x9a\x04Y\x04y\x04\xda\x04\xba\x04y\x04\xba\x04\xda\x04\x9a\x04\xda\x04\xba\x04X\x8e;\x83\xf7\xbe\x12\xdf~n<\xef\xbe\xe7~\xcf=\xf7\xbe\xf7\xde\xff\xden\x1a\xf7\xde\xf7\xde\xf7\xbe\xf7\xbe\xff\xde\x1d\x19\x04\x99\x04\xda\x04\xd9m\xfb\x91\xff\xde\x82\xff\xdf\x02\xff\xde\xff\xde\xff\xdf\x8b\xff\xde\x01\xff\xdf\xff\xdf\x91\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xfe\x95\xff\xde\x00\xff\xdf\x88\xff\xde\x03\xee{\xf7\x9e\xff\xdf\xff\xdf\x92\xff\xde\x06\xdd\xba\xd5\x9a\xb3\xd8\x92\xf6\x8a\x95\x92\xb6\xd5\xbb\x82\xff\xbe\x07\xf7\x9e\xff\xbe\xf7~\xf7\x9e\xff\xbe\xf7]\xe6\xfc\xce\x1b\x82\xe6\xdd5\xbdZb4b\x14Y\xd3b\x14Y\xf4Z5R\x14I\xd3Q\xf4Q\xf4Z5Q\xf4Z\x15R\x149\xb39\xd3B\x14JUBUJvBUBUBu:5Bv:u:U:v2U2v2u2u2\x962u*4*T!\xf3"4"U\x1a\x14"\x96\x1au\x1a\x95\x12\xd6\n\x95\nt\x02T\x02t\x02\xf6\x03W\x036\x036\x03\x16\x82\x02\xb5\x11\x02\xd5\x02\xb4\x03\x15\x03V\x03v\x03\xb6\x03\xb7\x03\x96\x03v\x036\x02\xb4\x03\x15\x03v\x03\x96\x03v\x03\x96\x03\xb7\x03v\x82\x036\x00\x02\xf5\x82\x03\x16\x02\x02\xf6\x02\xf6\x02\x94\x82\x02\xd5\x03\x02\xf5\x02\xb4\x03\x15\x02\xf5\x84\x0364\x03W\x036\x03\x16\x03V\x03W\x03W\x036\x03\x97\x03\xd8\x03\xf8\x04\x18\x04Y\x03\xd8\x03\x97\x03w\x03\xb7\x04z\x04Y\x04\x9a\x04y\x04Y\x04y\x04Y\x04\x9a\x04\x9a\x04\xba\x04\x9a\x04Y\x04\x9a\x04y\x04\xda\x04\xda\x04\xba\x04\xda\x04\xfb\x04\xdb\x04\xda\x04\xba\x04Y\x04\x18\x04\x18Uz\xf7\xbe\xef\xbe\xef\x9e\xef\x9e\xef\xbe\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xf7\xde\xf7\xbe\x83\xff\xde\x06\xf7\xde\xf7\xbe\x1d:\x04\xfa\x04\xb9\x05\x1a\r\x1a\x84\xff\xde\x00\xff\xdf\x89\xff\xde\t\xff\xdf\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\xff\xff\x86\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xff\x86\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x9c\xff\xde\x01\xff\xff\xff\xdf\x8e\xff\xde\x02\xff\xdf\xff\xff\xff\xbe\x87\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x10\xff\xbe\xff\xde\xff\xde\xbb\xd6\xa2u\xa3\x16\xab\xb7\x82\x13\x8at\xb4X\xf7=\xff\xbe\xff\xbe\xf7\x9e\xf7\x9e\xf7\xbe\xf7~\x82\xff\xbeD\xf7\x9e\xff\xbe\xee\xfd\xbdYbtY\xf3b4b4Y\xf3b\x14b4Z4R\x14R4R4I\xf4R\x14ZUQ\xf4R5RUJ5RvB5B\x14JvJ\x96BvBu2\x14:u:U2U2u:\x962U2\x96*5*U*5*T*U*u"U"5"4"U\x1au\x1a\x95\x12\xb5\n\xb5\nt\x02t\x02\xb5\x03\x16\x036\x03V\x03\x16\x02\xf6\x02\xb5\x02\xb5\x02\xd5\x02\xd5\x02\xf5\x03V\x03v\x03\xb6\x03\xd7\x03\xd7\x82\x03\x96\x1c\x03U\x03\x96\x03\xb6\x03\x96\x03\x97\x03\xb7\x03\xb7\x03w\x03\x16\x03\x16\x036\x03\x16\x02\xf5\x036\x036\x02\xf6\x02\xf5\x02\xd5\x02\x94\x02\xd5\x02\xd5\x02\xf5\x03\x15\x03w\x03\x97\x03V\x03w\x036\x03W\x84\x036.\x03W\x03V\x03w\x03\x97\x03\xb7\x03\xb8\x03\xf8\x03\xf8\x04\x19\x04\x19\x03\xd8\x03w\x049\x04y\x04\x9a\x04\x9a\x04Y\x04Y\x04z\x04Y\x04\x9a\x04Y\x049\x04y\x04\x9a\x04\xda\x04\xdb\x14\xd9v<\x8e\x9dE\x9a-{\x14\xd9n\x1bEZ\x04y\x04y$\xd9\xef\x9e\xf7\xde\xf7\x9e\xef\x9e\xf7\xde\xf7\xbe\xf7\xde\xff\xde\xff\xde\x82\xf7\xde\t\xff\xde\xf7\xbe\xf7\xde\xff\xde\xff\xde\xa6\xfd\x0c\xda\x04\xb9\x04\xfa=z\x89\xff\xde\x00\xd7\x1c\x96\xff\xde\x01\xff\xdf\xff\xdf\x9b\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x8a\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x96\xff\xde\n\xff\xdf\xff\xde\xff\xbe\xf7\x1d\x99\xd3\xaaU\x81\xf3\xa3\x16\x8aT\xc4\xf9\xef=\x82\xff\xbe\x01\xf7}\xff\xbe\x82\xf7\x9e\x00\xf7\xbe\x82\xf7~7\xef\x1d\xef\x1dr\xd5j\x95b\x13b\x14b\x14bTZ4Q\xf4ZUZuZuZvR\x14Q\xd4RUJ5RURvJUJvBUBvBvB\x96BvBuB\x962U:v:\x962u2v2u2\x96*U*U*u*\x95*\x95"u*\xb6"u\x1au\x1au\x12\xb5\n\xb5\x02\xd5\x03\x16\x02\xb5\x02\xf6\x036\x03W\x036\x03\x16\x82\x02\xd5\t\x02\xf5\x02\xd5\x03V\x03\x96\x03\xb6\x03\xb6\x03\xd6\x03\xb6\x03u\x03\x96\x82\x03\xb6\t\x03\xb7\x03\xb7\x03v\x03\xb7\x03v\x036\x02\xf6\x02\xf6\x03\x16\x03W\x83\x036\x14\x02\xf6\x02\xf5\x02\xd5\x02\xd5\x02\xb5\x02\xd5\x03V\x03\xd8\x03\xb7\x03\xd8\x03w\x02\xf5\x02\xf5\x03\x16\x03W\x036\x036\x03\x16\x03W\x03\x98\x03\xb8\x83\x03\xd8\x00\x03\xf9\x82\x049(\x04\x19\x04\x18\x04Y\x04y\x04Y\x04z\x04z\x04Y\x04y\x049\x049\x04Y\x04Y\x04z\x04\x9a\x15\x1b\xd7^\xef\x9e\xdf~\xcf\x1d\xcf=\xf7\xbe\xef\x9e\xcf=5\x1a\x04\xba\x05\x1a\x8e\xbd\xcf^\xdf~\x8e\x9ce\xfb\xf7\xbe\xf7\xbe\xd7=\xf7\xbe\xf7\xde\xff\xde\xff\xde\xf7\xbe\xf7\xde\x83\xff\xde\x02\xef\xbe\xa6\xbc\xdf\x9e\x8c\xff\xde\x00\xff\xdf\x83\xff\xde\x03\xff\xff\xff\xde\xff\xdf\xff\xdf\x85\xff\xde\x00\xff\xdf\x8f\xff\xde\x01\xff\xff\xff\xdf\x98\xff\xde\x00\xff\xff\x9d\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x89\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xdf\x8a\xff\xde9\xff\xbe\xff\xde\xf7\x1d\xa1\xf3\xaaU\x9aU\x9a\xd6\xbc\xb8\xff\xbe\xff\xbe\xf7~\xff\xde\xff\xbe\xff\xbe\xf7~\xe6\x9c\xf7~\xf7\x9e\xf7\x9e\xf7~\xf7\x9e\xef^\xe6\xbd\xf7]r\xb4bTQ\xb2I\x92Q\xd2Z\x14j\xb6R\x14ZUZuRURUR\x14I\xf3I\xf4JUJuJUJuJuBUBvB\x96Bu:UB\x96B\x96:vB\xb62u2\x952\x962\x952\x95\x82*u\x08*\xb6"\x95*\xb6"\xd6\x1a\x95"\xd6\x1a\xd6\n\xb6\n\xf6\x82\x03\x16J\x02\xd5\x03\x16\x03\x16\x036\x02\xf6\x02\xf6\x02\xd5\x02\xf5\x03\x16\x03\x15\x03\x96\x03\xb6\x03\xb6\x03\xb7\x03\xb6\x03\x95\x03\xb6\x03\xb6\x03\xd6\x03\xd7\x03\xd6\x03\xd7\x03\x96\x03V\x03v\x03\x15\x03\x15\x02\xd5\x02\xf5\x03\x16\x03\x15\x036\x03W\x03\x16\x036\x03\x16\x02\xf5\x02\xf6\x02\xd5\x03\x16\x03\x16\x03\x97\x03\xd7\x03\xb7\x03\xb7\x036\x03\x15\x036\x02\xf5\x03\x16\x03\x16\x036\x03\x16\x03\xb8\x03W\x03\xb8\x03\xf8\x03\xd8\x04\x19\x03\xf8\x03\xb8\x03\xf8\x04\x19\x049\x049\x04\x19\x04\x19\x04y\x14\xb9-\x1a\x04Y\x04\xdb\x04z\x04Y\x049\x83\x04\x9a\x19\x1d;\x86|\x86\\\xe7\x9e\xef\x9e\xf7\xbe\xef\x9e\xf7\xde\xef\xbe\xf7\xde~\\\x04\xfa\x15[\x04\xda\x048Ez\xcf~\xf7\xde\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xff\xde\xff\xde\xf7\xde\x82\xff\xde\x02\xf7\xde\xff\xde\xf7\xbe\x8d\xff\xde\x04n\x1b$\xf9\xf7\xde\xff\xde\xff\xdf\x88\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xdf\x87\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xff\x9e\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x08\xff\xdf\xcc\xb8\xb2u\xaa\xd5\xcdz\xff\xbf\xf7\xbe\xff\xbe\xff\x9e\x82\xff\xbe$\xf7]\xc5y\xf7\xbe\xff\xde\xe6\xfc\xc5\xb9\xff\x9e\xee\xfd\xd6[\xc5\xba\xde\x9c\xbdz\xe6\xddr\xb4Z\x13\xa48\xcd\xda\xc5\xba\xbd\x9aZuRUJ\x14A\xb39\xb2J\x14JUJuBUBUBuBuJ\xb6B\x96BvB\x96B\xd7B\xb6\x82:\xb6"2\xd62\xb6"U*u2\xd6*\x95"\x95"\xb6\x1a\x95\x1a\xb5"\xd6\x1a\xd6\x12\x95\x12\xf6\x02\xf6\x03\x16\x036\x02\xf6\x02\xf5\x02\xd6\x02\xb5\x02\xd5\x03\x16\x03\x16\x02\xf5\x036\x036\x03V\x03\xb7\x03\xd7\x03\xd7\x03\xf7\x03\xb6\x03\x95\x03\x96\x82\x03u\x0b\x03\xd6\x03\xd6\x03\xd7\x03\x96\x03V\x03\x15\x03V\x03V\x02\xf5\x036\x036\x03V\x83\x03\x16\x0c\x02\xf6\x02\xf6\x02\xf5\x02\xf6\x036\x036\x03V\x03\xb7\x03\x97\x03v\x03w\x03V\x036\x82\x03\x16\x0c\x02\xf5\x036\x03\x97\x03\x97\x03\xb8\x03\xd8\x03\xf8\x03\xd8\x03\xd8\x03\xf8\x049\x049\x04\x19\x82\x04Y\x0f\x04\x18\x04XM\x9b\x86\\\x04\x99\x04Y\x04Y\x04z\x049\x04Y\x04\x9a\x04\xba\x04\xda\x04\xbaM\x9a\xe7\x9e\x82\xf7\xbe\x82\xf7\xde\x0e\xf7\xbe\x8e\x9c\x04\xba\x04\xba\x04\xfa\x04\xda\xcf~\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\x8d\xff\xde\x00\xf7\xbe\x85\xff\xde\x01\xd7~\x96\xbc\x82\xff\xde\x00\xff\xff\x90\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x85\xff\xde\x00\xff\xff\x84\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xff\x86\xff\xde\x00\xff\xff\x93\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x8b\xff\xde\x04\xff\xbe\xff\xbe\xff\xde\xff\x9e\xddz\x83\xff\xbe\x08\xff\xde\xff\xbe\xff\xde\xff\xde\xb4\xf8\xf7^\xff\xbe\xff\xde\xff\xde\x82\xff\xbe\x14\xd6|\x8b\xd6\xef\x1d\xff\xbf\xff\xbe\xff\xbe\xce\x1b\xcd\xda\xef]\xe6\xdc\xef\x1d\xce\x1bRURuJ49\xf3B\x14:\x14:4BUBu\x83:U\x1a:u:\x96B\xd7*42u2\x962\xb62\xd6*\x952\xb6*\x95"\x95*\xb6"\xb6\x12T\nT\nu\nt\x12\x95\x12\xd5\n\xf6\x02\xd5\x036\x03\x16\x03\x16\x02\xd5\x02\xf6\x82\x02\xd53\x03\x16\x02\xf6\x02\x94\x036\x035\x03\x96\x03\xb7\x03\xb7\x03\xb6\x03\xd6\x03\xf7\x03\xd6\x03\xd6\x04\x17\x03\xf6\x03\x95\x03\xf7\x03\xd6\x03\xd6\x03\x96\x03\x96\x03v\x03V\x03v\x03\x97\x03\x97\x03w\x03W\x03V\x02\xf6\x03\x16\x02\xd5\x02\xf6\x02\xf6\x02\xf5\x03\x16\x03\x16\x036\x03\x97\x035\x03V\x03V\x03\x15\x03\x15\x03V\x03w\x03W\x036\x036\x03\xb7\x03\xb8\x03\xd8\x82\x03\xf81\x03\xf9\x03\xf8\x04\x19\x04Y\x049\x04Y\x04\x18\x04Y\x04Y\x049\x04Y\x04\x9a\x1c\xfa\x04\x99\x04Y\x048\x04Y\x04z\x04y\x04\x9a\x04Y\x04\xda\x04\xfb\x04\x99\x04\xd9%\x1a\xe7~\xf7\xdf\xf7\xbe\xf7\xdf\xf7\xbe\xf7\xbe\xef\xbe\x14\xd9\x04\xb9\x04\xfaf\x1b\xef\xbe\xf7\xbe\xff\xde\xf7\xde\xf7\xde\xf7\xbe\xff\xde\xff\xde\xef\x9e\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\x8b\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x87\xff\xde\x01\xff\xdf\xff\xff\x87\xff\xde\x05\xff\xff\xff\xff\xff\xde\xff\xde\xff\xff\xff\xff\x83\xff\xde\x00\xff\xdf\x88\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xff\x90\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x90\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xbe\xf7\x9e\x83\xff\xde\x04\xc4\x97\xf7]\xff\xbe\xff\xde\xff\xde\x8b\xff\xbe\x05\xc5\xdb\x9cxRS\xb59\xf7\x9e\xf7~\x82\xf7\xbe\x06\xe6\xfc\xe6\xfd\xd6|\xf7\x9e\x8c\x17B\x13B4\x82BT\x0bBU1\xf3:T:u:U2\x14:u2u2u:\x952u2u\x822\xb6\x0e*u*\xb6*\xb6*\xd6"\xd6"\xd6\x12\xb5\n\xd6\n\xb5\n\xb5\x02\xb5\x0b\x16\n\xf6\x02\xf6\x02\xf6\x82\x036\x1d\x02\xf5\x02\xf6\x02\xf5\x03\x16\x03\x16\x02\xd5\x02\xf6\x02\xf5\x02\xd5\x03v\x03\x97\x03\x96\x03\xb6\x03\xd7\x04\x17\x04\x17\x047\x047\x04\x17\x047\x04\x17\x03\xb5\x03\xd6\x03\xb6\x03\x96\x03\xb6\x03\x97\x03V\x03v\x03\xb7\x82\x03\x97\x00\x03V\x83\x03\x16\x83\x036\x02\x03v\x03\x97\x03v\x82\x03V\x06\x03v\x03w\x03w\x03\x97\x03V\x03\xf8\x04\x19\x82\x03\xd8\x0b\x03\xf8\x04\x19\x04Y\x04\x19\x04Y\x04\x9a\x04\x9a\x04z\x049\x04Y\x04Y\x048\x82\x04Y\x18\x048\x04y\x04\x9a\x04\x9a\x04y\x03\xd7\x04z\x049\x04\xba\x04\xfa\x04\xfb\x05\x1b\x04\xda%\x1a\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xe7\x9eU\xdbM\xbb\xf7\xde\xef\xbe\x82\xf7\xbe\x05\xff\xdf\xef\x9e\xff\xde\xff\xde\xf7\xbe\xf7\xbe\x8d\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\xb2\xff\xde\x00\xff\xdf\x87\xff\xde\x01\xff\xff\xff\xdf\x88\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x89\xff\xde\x82\xff\xbeX\xff\xdf\xff\xde\xff\xde\xff\xbe\xf7}\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\xbe\xf7\xbe\xff\xde\xff\xbe\xff\xbe\xf7\xbe\xa4\xb8J\x13R\x94s\x96\xf7^\xe6\xfd\xde\xbc\xef^\xf7\x9e\xf7\x9e\xf7~\xef\x1d\xde\xbckUB\x13J\x95J\x95Bt)\xb22\x13:uB\xb6:u:\xb6:u:u2u:\xb62\x952\xb62\xb52\xb6*\xb62\xb6*\x96*\xd6"\xb6"\xb6*\xf7\x1a\xd6#\x16\x1b7\n\xd6\x02\xf6\x02\xd5\x02\xf6\x0b7\x03\x16\x02\xf6\x03\x16\x03\x16\x03V\x036\x036\x03V\x03V\x036\x037\x036\x02\xf5\x02\xd5\x03\x15\x03V\x03\x96\x03\x96\x03\xb7\x03\xd7\x03\xf7\x047\x04\x17\x04\x17\x03\xf6\x04\x16\x03\xf6\x82\x03\xd6\x00\x03\x95\x82\x03v\x00\x03\x96\x83\x03\xb7@\x03\x15\x02\xb4\x02\xd5\x02\xf5\x03\x16\x02\xf5\x03\x15\x036\x03\x97\x03w\x03w\x03v\x03V\x03V\x03v\x03\x97\x03\xb8\x036\x03w\x03w\x049\x049\x03\xd8\x03\xf8\x049\x049\x04Y\x049\x049\x04y\x04\x18\x04y\x04Y\x04z\x04Y\x04Y\x04\x9a\x04\x9a\x04Y\x04\x99\x04\xda\x04\xba\x04\xda-:\x04\xba\x048\x04y\x04Y\x04\xda\x04\xda\x04\xfa\x05\x1a\x04\xda\x04\xfa\x96|\xff\xde\xff\xdf\xf7\xbe\xe7~\xef\x9e\xf7\xde\xff\xde\xf7\xde\xff\xde\xf7\xde\x82\xf7\xbe\x00\xf7\xde\x82\xff\xde\t\xef\x9e\xf7\xde\xf7\xde\xff\xde\xf7\xbe\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\x97\xff\xde\x01\xff\xdf\xff\xdf\x85\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\x8a\xff\xde\x00\xff\xff\x8c\xff\xde\x01\xff\xff\xff\xff\x89\xff\xde\x00\xff\xff\x86\xff\xde\x01\xff\xdf\xff\xdf\x83\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xbe\x88\xff\xdeR\xff\xbe\xff\xbe\xff\xde\xff\xbe\xff\xbe\xf7\x9e\xff\xbe\xf7]\xf7\x9e\xff\xbe\xff\xde\xff\xbesvc\x16J\x95\xc5\xfb\xf7\x9e\xf7~\xef=\xce;\xf7\x9e\xf7\xbe\xf7~\xef^b\xb3B3J\x95c7cWR\xf6Bt1\xf3:u:\x952T:\xb6B\xb62\x95[x2u*u*u:\xf7:\xd6*\xb6*\xb62\xd6"\xd6"\xd6"\xf6\x1a\xf6\x12\xf6\n\xf6\x0b\x16\x02\xf6\x02\xf5\x02\xf6\x02\xf6\x036\x037\x02\xd5\x03\x16\x03V\x03\x97\x03\x97\x03v\x03v\x03V\x02\xf5\x03\x16\x03\x16\x02\xf5\x036\x03\x15\x036\x03\x96\x03\xb6\x03\xb7\x03\xb6\x048\x04X\x047\x04\x17\x84\x03\xf6#\x03\xb5\x03\x96\x02\xf4\x03V\x03\x96\x03\x96\x03\xb7\x03\xf7\x03\xb7\x03\x97\x036\x02\xf5\x036\x03V\x02\xd5\x03\x15\x03w\x03\x97\x03\xb8\x03\xb7\x03\xb7\x03v\x03w\x03V\x03v\x03v\x03\xb7\x03w\x03\xd8\x049\x049\x04y\x04y\x04Y\x04y\x04y\x82\x04\x9a\x02\x04z\x04Y\x04Y\x82\x04\x9a#\x04\x99\x04\xba\x04Y\x04\xba\x04\xda\x04\xfa\x04\xfa5Z]\xfc\x15;\x04X\x04y\x04\x99\x04\xda\x04\xfb\x04\xfa\x05\x1a\x04\xfa\x05\x1a]\xfb\xff\xde\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xef\xbe\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\xdf\x9e\xf7\xbe\xff\xde\xf7\xde\xa1\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x89\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xfe\x86\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x97\xff\xde\x00\xff\xdf\x8b\xff\xde\x01\xff\xdf\xff\xdf\x8e\xff\xde\x00\xff\xbe\x88\xff\xde\x01\xf7]\xff\xbe\x85\xff\xde\x12\xff\xbe\xff\xde\xff\xdf\xff\xde\xff\xbe\xff\xbe\xf7\x9e\xf7~\xf7~\xff\xbe\xff\xde\xf7\x9e\x8c\x17JT\x9c\xb8\xff\xde\xff\xde\xf7\xbe\xf7\x9e\x82\xff\xbe\x1e\xf7^\xb5\x19Z\x12J3BuJ\xd6J\xf6J\xd6J\xd6B\xb5:\x95B\xb6:\x96:\xb6:\xb62\xb6:\xd6C\x16:\xd5:\xf6:\xd62\xb6*\xd6*\xf7*\xf6"\xd6\x1a\xd6\x1b\x16\x12\xf6\n\xd6\x0b7\x82\x03\x16\x01\x037\x03\x16\x84\x036\x01\x03\x97\x03\xd7\x82\x03\xb7\t\x036\x03\x15\x02\xd5\x02\xf5\x036\x03\x15\x03v\x03\x96\x03\xd7\x03\xb6\x82\x04\x17\x82\x047\'\x04\x16\x04\x16\x04\x17\x03\xf6\x03u\x03\xb6\x03\x96\x03\xb6\x03\xd7\x03\xf7\x03\xf7\x03\xd7\x03\x96\x03\xb7\x03\x97\x03V\x03v\x03w\x03V\x03V\x03w\x03w\x03\x97\x03\x97\x03\xb7\x03\x97\x03\x97\x03v\x03v\x03\x15\x03\xb7\x03\xf8\x04\x18\x04\x18\x04y\x04y\x04z\x04Y\x048\x04y\x82\x04Y\x1c\x04y\x04Y\x048\x04Y\x04\x9a\x04\xba\x04\xda\x04\xba\x04\xb9\x05\x1a\x05\x1a\x04\xda\x04\xfaU\xdb\xae\xddE\xbb5z\x04\x99\x04y\x04\xda\x04\xfb\x04\xfa\x04\xfa\x05\x1b\x05\x1b\x1d{\xff\xde\xf7\xde\xf7\xde\x82\xf7\xbe\x84\xf7\xde\x07\xe7\x9e\x04\xfa=\x9a\xff\xde\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\x82\xff\xde\x01\xf7\xde\xf7\xbe\xa7\xff\xde\x01\xff\xff\xff\xdf\x82\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xdf\x9c\xff\xde\x00\xf7\x9e\x84\xff\xde\x02\xf7}\xff\xbe\xff\xbe\x87\xff\xde\x0e\xff\xbe\xd6[\xff\xde\xff\xde\xf7\xbe\xf7\xbe\xf7\x9e\xf7\x9e\xff\xbe\xff\xde\xff\xbe\xff\xbe\xf7\xbe\xff\xde\xff\xde\x82\xf7\xbe&\xff\xbe\xd6|\x9c\xd9\xef]\xa4xj\xb4J\x13J\xb5J\xd6J\xf6J\xd6J\xf6B\xb5B\xd6:u:\xb6:\xd6B\xf72\xf6\xa5z\xd6\x9d\xad\x9a\x9d\x1a*u2\xd6*\xf6\x1a\x95"\xf6\x1a\xf6\x13\x16\x13\x17\x13\x16\n\xf6\x03\x16\x037\x036\x03\x16\x037\x03W\x82\x03w\x12\x036\x03V\x03\xb7\x03\x96\x03\xd7\x03\xd7\x03v\x03v\x03w\x036\x036\x02\xf5\x036\x03\x15\x03\x15\x03\x96\x03\xb6\x03\xf7\x03\xf7\x82\x04\x17\x08\x04\x16\x047\x04\x16\x04\x16\x03\xd6\x03\xb5\x03\xf7\x03\xf7\x03\xb6\x83\x03\xf7\x13\x03\xd7\x03\xd7\x03v\x03\xb7\x03\x96\x03\xb7\x03\xb7\x03v\x03v\x03\x97\x03v\x03v\x03\xd7\x03\xd7\x03\xd8\x03\xb7\x03U\x03V\x03\x96\x04\x18\x82\x04y\x05\x048\x04y\x048\x04\x9a\x04\x99\x04y\x82\x04\x9a\x04\x04\x99\x04\x9a\x04\xba\x04\x99\x04\xba\x82\x04\xda\x13\x04\xfa\x05\x1b\x05\x1a\x05;\x86|-:\xbe\xfd\xdf~\x1c\xfa\x04\x99\x04\xba\x04\xda\x04\xfa\x05\x1b\x04\xd9\x04\xfa-{\xf7\xbe\xf7\xbe\xf7\xde\x82\xf7\xbe\x82\xff\xde\x04\xf7\xde\xf7\xbe\xf7\xbe\x9e\xbc\x96\x9c\x83\xff\xde\x00\xf7\xbe\x88\xff\xde\x00\xf7\xde\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xde\x82\xff\xdf\x88\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xdf\x82\xff\xde\x00\xff\xdf\x8d\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x9d\xff\xde\x00\xff\xdf\x8c\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xff\x82\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xbe\x87\xff\xde\x05\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xbe\xcd\xfa\x82\xff\xdeK\xff\xbe\xff\xdf\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\xff\xbe\xef]\xf7~\xff\xbe\xf7\xbe\xf7\xbe\xf7~\xd6\\\x94\x98\xf7^\xa4\x98I\xd29\xd2BuB\xb5J\xd6J\xd6J\xf6J\xf62T:\xb5:\xb52\xb62\xb6c\xf7\xde\xdd\xe7\x1d\xe7=\x84\xb9;\x17*\xd6*\xf7\x12\xb5\x1b7\x12\xf6\x0b7\x037\x03\x16\x0bW\x03W\x03\x16\x03W\x036\x03\x16\x03w\x03\x97\x03\xb7\x03\xb7\x03w\x03\x96\x03\xf7\x03\xd7\x03\xf7\x03\xd7\x03\x96\x03\xb7\x03\x97\x036\x03\x16\x03\x16\x03\x97\x03v\x03V\x03U\x03\xd7\x03\xd7\x03\xf7\x04\x17\x04W\x83\x047\x1f\x04\x17\x03\xf6\x03\xf6\x04\x17\x03\xf7\x03\xd6\x03\xb6\x03\xf7\x03\xd7\x03\xf7\x03\xd6\x03\xf7\x04\x18\x04\x18\x03\xd7\x03\xf8\x03\xf8\x03\x96\x03\xb7\x03V\x03v\x03\xd7\x03\xb7\x03\xd7\x03\xd7\x03\xb7\x03\xb7\x03\x96\x03\xd7\x048\x04y\x04\x99\x82\x04y\x06\x04\x18\x048\x048\x04\x99\x04y\x04\xba\x04\xba\x83\x04\xda\x14\x04\xba\x04\xfa\x04\xb9\x04\xfa\x04\xfa\x05\x1a\x04\xfa\x05\x1b\xdf\x9e\xdf~\xdf]\xef\xbe\xb6\xfd\x048\x04y\x04\xda\x05\x1a\x04\xfa\x04\xda\x05\x1b\xae\xfd\x82\xf7\xbe\x83\xf7\xde\x05\xf7\xbe\xff\xde\xf7\xbe\xef\xbe\xf7\xde\xff\xde\x82\xf7\xde\x02\xff\xde\xff\xde\xff\xdf\x87\xff\xde\x01\xff\xdf\xef\xbe\x8e\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xff\xff\xa3\xff\xde\x01\xff\xff\xff\xdf\x95\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\x8c\xff\xde\x00\xff\xdf\x89\xff\xde\x03\xddy\xb2\xf3\xaa\xf3\xff\xdf\x86\xff\xde\x03\xff\xdf\xff\xde\xff\xbe\xff\xbe\x83\xff\xde-\xff\xbe\xff\xde\x835{\x15\xf7\x9e\xff\xbe\xf7}\xf7\x9e\xff\xbe\xf7\x9e\xf7}\xff\xde\xff\xbe\xf7\x9e\xff\xbe\xff\xbe\xf7}\xf7\x9e\x8b\xf6J39\xd2J\x95B\x95:tJ\xd6B\xd6B\xd523B\xf62\x952\xb6*\x95\xc6\\\xef~\xe7^\x8c\xf93\x172\xd62\xf6+\x17\x12\xd6\n\xd6\x03\x16\x037\x03W\x03W\x82\x036\t\x03V\x03w\x03w\x03v\x03V\x03\xb7\x03\x97\x03v\x03\xd7\x03\xb7\x82\x03\xd7\n\x03\x96\x03v\x03\xb7\x03\xb7\x03\x15\x036\x03V\x03v\x03v\x03\x96\x03\x96\x82\x03\xb6\x0e\x04\x17\x03\xf6\x047\x047\x04W\x04W\x04\x16\x03\xb5\x047\x04\x17\x03\xf7\x04\x17\x04\x18\x04\x17\x04\x17\x84\x03\xf7\x15\x03\xd7\x03\xf8\x03\xb7\x03\xb7\x03\xf7\x03\x96\x03\x96\x03\xf8\x03\xf7\x03\xd7\x03\xb6\x03\xb7\x03\xb6\x03\xb6\x048\x03\xf8\x04Y\x04Y\x04y\x04\x99\x04Y\x04Y\x82\x04\x99\x1f\x04\xba\x04\x99\x04\xda\x04\xfa\x05\x1b\x04\xba\x04\x99\x04\xb9\x04\xba\x04\xda\x05\x1b\x05\x1a\x04\xfaE\xbb\xd7=\xef\x9e\xef\x9e\xf7\xbe\xf7\xbe^\x1c\x04\xb9\r:\x04\xfa\x05\x1a\x05;\x04\xfan\\\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\x82\xf7\xde\x02\xf7\xbe\xf7\xde\xdf}\x84\xff\xde\x00\xf7\xde\x89\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xf7\xde\xa2\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x89\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xdf\x8d\xff\xde\x04\xf7\xbe\xbb4\xb2\xd4\xa2\x92\xff\xdf\x88\xff\xde\x01\xff\xbe\xf7\x9e\x82\xff\xde\x0c\xff\xbe\xff\xde\xf7^\x8b6\xd6\\\xff\xbe\xff\xde\xff\xbe\xf7\xbe\xff\xbe\xff\xde\xff\xbe\xff\xde\x82\xff\xbe$\xf7~\xf7~\xf7^JTc\x16c\x16cWJ\xb5:TB\xb5J\xf6B\xd6B\xf6:\xb5:\xd6c\xd7\xa5z\xf7\x9e\xf7\x9e\xce|[\xf8"\xb6;\x17373X\x13\x17\n\xf6\x02\xd6\x037\x036\x036\x03\x16\x036\x03W\x036\x036\x03V\x83\x03\x97\x01\x03\xd7\x04\x18\x82\x03\xd7\x05\x03\xf7\x03\xb7\x03v\x03\xb7\x03\xd8\x03\x97\x82\x03\xb7\x11\x03\xd7\x03\xb7\x03\xb7\x03U\x03\xb6\x04\x17\x03\xd6\x03\x95\x03\x96\x04\x17\x04W\x04W\x03\xf6\x03\xf6\x04W\x047\x047\x03\xd6\x82\x04\x17\x82\x048\x03\x03\xf7\x04\x18\x03\xd6\x03\x96\x82\x03\xd71\x03\x96\x03\x96\x04\x18\x03\xf7\x03\xf7\x04\x18\x03\xd7\x03\xf7\x03\xd7\x04Y\x03\xf7\x04X\x04\x99\x04y\x04y\x04\x99\x04\x99\x04\xba\x04\xba\x04\x99\x04\xba\x04\xfa\x04\xba\x04\xb9\x04\xfa\x04y\x04\xb9\x04\xda\x04\xda\x04\xfa\x04\xfa\x04\xda\x0c\xda\xef\xbe\xef\xbe\xf7\xbe\xef\xbe\xf7\xbe\xf7\xbe\xef\x9en<\x1d{=\xdc\x15Z\x1d:\x04\xfaM\xfb\xf7\xde\xf7\xbe\xf7\xbe\x84\xf7\xde\x04\xff\xde\xf7\xbe\xff\xde\xff\xdf\xf7\xde\x82\xff\xde\x82\xf7\xbe\x03\xff\xde\xf7\xbe\xff\xde\xff\xdf\x83\xff\xde\x00\xf7\xbe\x85\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\xa0\xff\xde\x01\xff\xdf\xff\xdf\x9c\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x87\xff\xde\x03\xff\xbe\xc4\x16\xaa\xf4\xdd\xda\x8c\xff\xde\n\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xbe\x83\xff\xde"\xf7~\xf7\xbe\xff\xbe\xf7\x9e\xf7\x9e\x94\x98Buc\x16J\x94[\x16J\x951\xf3B\x95K\x16B\xf6B\xf6SW\xa5Z\xef^\xef~\xef~\xf7\x9e\xf7\xbedy"\xf6ly+7+x\n\xf6\x02\xd6\x037\x036\x03W\x03w\x03w\x82\x03W\n\x036\x036\x03\x15\x03v\x035\x03\xb7\x03\xf7\x048\x03\xd6\x04\x18\x03\xd7\x82\x03\xf7\x0b\x03\x97\x03\xb7\x03\xd7\x03\xb7\x03\xb6\x03\xb7\x04\x18\x04\x17\x03\xb6\x03\x96\x03\xb6\x03\x95\x82\x03\x96\x00\x03u\x82\x047$\x04X\x04X\x047\x048\x04\x17\x03\xf7\x04\x18\x048\x048\x04X\x048\x04\x17\x04\x17\x03\xf7\x03\xb6\x03\xb7\x03\xf7\x03\xf7\x048\x048\x04\x17\x048\x04X\x04X\x048\x03\xb6\x04X\x04y\x048\x03\xf7\x04\xba\x04\xda\x04\xba\x04\x99\x04\xba\x04\xb9\x04y\x82\x04\xda\r\x04\xba\x04\x99\xa6\xddm\xfb\x0c\xb9\x04\xda\x04\xda\x04\xba\x04\xfa\x04\xfaM\xfc\xc7\x1d\xf7\xbe\xef\xbe\x82\xf7\xbe\x11\xef\xbe\xf7\xbe\xdf\x9e\xef\x9e\xf7\xdf\xf7\xbeE\xbb\x04\xfan\x1b\xf7\xbe\xef\xbe\xef\x9e\xff\xde\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xff\xdf\x86\xff\xde\x05\xe7~\xef\x9e\xf7\xbe\xff\xde\xff\xde\xf7\xde\x82\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x90\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x8a\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x82\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xff\x9c\xff\xde\x00\xff\xdf\x95\xff\xde\x00\xff\xdf\x88\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\x85\xff\xde\x02\xff\xbe\xff\xbe\xff\xdf\x84\xff\xde2\xff\xbe\xff\xbe\xd6[\xff\xbe\xff\xbe\xf7\x9e\xef~BTJ\x95:\x13s\xb6\x8cxBuJ\xb4J\xd4B\xf6:\xd6C\x16\xe7\x1d\xf7\x9e\xef^\xdf\x1d\xe7]\xef]\xf7\xbe3\x98T\x18\x8dZL\x18+\xb7l\x99\x85:\x03\x16\x036\x03w\x03\x97\x036\x03W\x03W\x036\x03\x15\x036\x03V\x03w\x03V\x04\x18\x04\x18\x04X\x048\x03\xd6\x04\x17\x82\x03\xd7\x02\x03\xf7\x04\x18\x03\xf8\x83\x03\xd7\x0f\x03\xf7\x03\xb6\x03\xb7\x03\xb6\x03\xd6\x03\xb6\x03\xb7\x03\xd7\x03\xf7\x047\x047\x04\x17\x047\x04W\x04X\x04X\x83\x04\x17\x06\x048\x04\x17\x048\x048\x04\x17\x047\x03\xf7\x82\x04\x17\x13\x04X\x047\x04X\x04x\x04y\x04X\x04X\x048\x047\x04y\x03\xf7\x03\xf7\x04\x99\x04\xba\x04\xba\x04\xb9\x04\x99\x04X\x04\xb9\x04\x99\x82\x04\xba!,\xf9\xf7\xbe\xe7~~<-{%\x9bE\xdb\r:\x05\x1a\xef\xbe\xbe\xfd\xc7\x1d\xf7\xbe\xef\xbe\xf7\xbe\xf7\xbe\xef\xbe\xe7\x9e\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xdeU\xbb\x05\x1a\xcf=\xf7\xbe\xef\xbe\xe7~\xff\xde\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\x96\xff\xde\x00\xf7\xbe\x83\xff\xde\x01\xae\xfd\xf7\xde\x8e\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xff\x91\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xbe\x9a\xff\xde\x01\xff\xff\xff\xdf\xb3\xff\xde\x02\xff\xbe\xff\xde\xff\xbe\x83\xff\xde\x02\xff\xbe\xff\xbe\xef]\x82\xff\xde#\xff\xbe\xff\xdes\x96R\xf6R\xf6:4\xce[\xe7\x1d\xe7\x1d\xf7\xbe\xf7\xbe\xef^[\x96tX\xff\xde\xef~\xbe|\xdf\x1d\xef~\xf7\xbe\xe7>\x12\xf6\xb6<\xff\xde\xff\xdf\xdf\x1d\xde\xdd}:\x03W\x03w\x03w\x02\xd5\x03w\x03\x97\x03W\x036\x82\x03V\r\x03w\x04\x18\x03\xf7\x048\x047\x04x\x04X\x03\xf7\x03\xf7\x04\x17\x048\x03\xf7\x03\xf7\x048\x83\x03\xd7\x08\x03\xb6\x03\xb6\x03\x96\x03\xf7\x03\xd7\x03\xb6\x03\xd7\x03\xd7\x03\xb7\x82\x04\x17\x0b\x047\x04x\x04x\x04X\x03\xf7\x047\x04X\x048\x03\xf7\x03\xf7\x04X\x04X\x82\x048\x16\x04X\x04x\x04\x17\x04X\x04x\x04x\x04X\x04x\x04x\x04X\x047\x04\x98\x04X\x04\x17\x048\x04X\x04\xda\x04\xb9\x04\xda\x04\xfa\x04y\x04X\x04\x99\x82\x04\xda\'\x14\xf9\xe7~\xe7~\xd7^\xef\xbe\xae\xdd\x8e|n<\r:\xae\xdd\xcf=\x96|\xf7\xbe\xf7\xde\xef\x9e\xdf~\xe7~\xe7\x9e\xf7\xdf\xf7\xde\xf7\xbe\xf7\xde\xf7\xbe\xf7\xden<\x8e\xdd\xd7~\xae\xbc\xef\xbe\xef\xbe\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\x87\xff\xde\x02\xf7\xdeM\xda\xf7\xbe\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xd7~\xf7\xde\x88\xff\xde\x01\xff\xff\xff\xdf\x9b\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8b\xff\xde\x00\xff\xdf\xa2\xff\xde\x01\xff\xdf\xff\xdf\x86\xff\xde\x00\xff\xbe\x90\xff\xde\x05\xe6{\xf7]\xff\xde\xff\xde\xf7\x9e\xff\xbe\x83\xff\xde\x00\xf7\x9e\x85\xff\xde5\xff\xbe\xff\xde\xff\xbe\xe7\x1dJuR\xd6[6\x8cx\xf7~\xf7\x9e\xf7\x9e\xe7=\xef~\xf7\xbe\xff\xbe\xf7\x9e\xff\xbe\xff\xbf\xae\x1b\xe7=\xf7\x9e\xe7=\xff\xde\xd6\xdc\xf7\xbe\xef~\xef\x9e;\xf7\x85zu:\x03w\x03\xb8\x03\x97\x03\x97\x03V\x03w\x03W\x03W\x03\xb7\x03w\x036\x03\x97\x03\xd7\x03\xf7\x04X\x04x\x04x\x047\x047\x04x\x04\x98\x04\x98\x04\x18\x04\x18\x82\x03\xf7,\x03\xf8\x03\xf7\x03\xf7\x03\xd7\x03\xf7\x03\xd7\x03\x95\x03\xb6\x03\x96\x03\xb6\x03\xb6\x03\xf7\x047\x047\x04x\x04\x98\x04x\x048\x048\x04X\x048\x04X\x04X\x04W\x04X\x04x\x04X\x047\x04X\x04X\x04x\x04\x99\x04X\x048\x04y\x04\x99\x04X\x047\x04y\x04x\x04\xb9\x04\x98\x04\x17\x04X\x048\x82\x04\xda\x13\x04\x99\x04\x18\x04X\x04\xfa\x05\x1a\x05\x1a\x04\xfa\x1c\xfa\xef\xbe\xef\x9e\xef\x9e\xf7\xdf\xef\xbe\xf7\xbe\xef\xbe\xcf^\x04\xb9\x8e|\xf7\xde\xf7\xde\x83\xf7\xbe\x00\xef\xbe\x84\xf7\xde\x0b\xff\xde\xf7\xde\x15Z\x04\xfa\xc7=\xf7\xde\xf7\xde\xef\x9e\xff\xde\xff\xdf\xf7\xde\xf7\xbe\x8d\xff\xde\x00\xe7\xbe\x86\xff\xde\x00\xff\xdf\x95\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\x9d\xff\xde\x00\xff\xdf\x9e\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x97\xff\xde\x00\xff\xff\x83\xff\xde\x00\xff\xbe\x87\xff\xde\x0b\xf7\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\x8cxcW[\x16s\xb6\xf7\x9e\xf7\xbe\xf7\x9e\x83\xf7\xbe\t\xff\xbe\xf7\xbe\xf7\xbe\x84\xf9\xf7\x9e\xf7\xbe\xe7=\xe7]\xef~\xef~\x82\xf7\xbe\x10\xd7\x1d\x1b\x96\x13\xf8\x03\xd8\x03\xd8\x03\x97\x03w\x036\x036\x03W\x03w\x036\x03V\x03V\x03\xb7\x03\xd7\x048\x82\x04x\r\x047\x047\x04\x99\x04\xb8\x0c\xb9~\x1b\x86<\x1c\xd9\x03\xf7\x03\xd7\x04\x18\x04\x18\x048\x048\x82\x03\xf7\x10\x03\xd7\x03\x96\x03\xd7\x03\xb6\x03\xd7\x04\x17\x04X\x04\x98\x04\x98\x048\x04X\x048\x04X\x047\x04X\x04x\x04x\x82\x04X&\x047\x047\x04x\x04X\x04\x99\x04X\x047\x04\x99\x04X\x04x\x04x\x04X\x04\x99\x04\xb9\x04\xb9\x04\xd9\x14\xd9\x04y\x04X\x04\xb9\x04\xba\x04Y\x04y\x04\xba\x04\xfa\x05\x1b\x05\x1a\x05\x1b\x04\xban\x1b\xcf]]\xfb\xf7\xbe\xd7=\xef\xbe\xf7\xbe\xf7\xdeM\x9a-:\x82\xf7\xde\x06\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xc7^\xe7\x9e\xf7\xbe\x83\xf7\xde\x0e\xbf=\x04\xfa\x04y\xbf\x1d\xf7\xde\xf7\xde\xff\xde\xf7\xde\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xff\xdf\xff\xdf\x8e\xff\xde\x00\xff\xbe\x96\xff\xde\x04\xff\xdf\xff\xdf\xff\xde\xff\xde\xff\xdf\x84\xff\xde\x00\xff\xff\xa4\xff\xde\x00\xff\xff\x92\xff\xde\x01\xff\xdf\xff\xdf\x8a\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x90\xff\xde\x02\xff\xbe\xff\xde\xff\xbe\x83\xff\xde\x04\xff\xbe\xff\xbe\xff\xde\xff\xde\xf7\xbe\x82\xff\xde\r\xff\xbe\xff\xde\xb5\x9aJT\x8cX\xadZ\xe7\x1d\xf7\xbe\xf7\x9e\xff\xdf\xf7\x9e\xf7\xbe\xff\xbe\xff\xde\x82\xf7\x9e\x0e2\xd5\xf7\x9e\xf7\x9e\xef\x9e\xf7\x9e\xff\xdf\xf7\xbe\xf7\xbe\xef\x9e\xf7\xbe\xe7~,\x18\x14\x18\x03\xd8\x03\xb8\x83\x03w5\x03V\x03\xb8\x03\x98\x03w\x03v\x03\xb7\x04\x18\x04X\x04x\x04\x99\x04X\x04X\x047\x04\x98\x04\xb9\x0c\xb9\x8e;\xbe\xdd-9\x04\x98\x03\xf7\x048\x048\x04X\x048\x04X\x04\x17\x04\x17\x03\xf7\x03\xd7\x03\x96\x03\xd7\x04\x17\x04\x17\x04X\x04x\x04X\x04X\x048\x048\x04X\x04X\x04\x99\x04\x99\x04X\x04x\x04x\x04\x17\x04X\x04X\x04x\x04X\x04x\x04\x99\x82\x04x\x02\x04\x99\x04\xd9\x04\x98\x82\x04\xb9\x1bU\xfb\x9e\xbd\x0cX\x04\x17\x03\xf7\x04\x18\x04\x99\x04\x99\x04\xb9\x04\x99\x04\xfa\x05\x1a\x05\x1a\x0c\xda\xe7\x9e\xd7~\x15:\xdf~\xdf}\xef\xbe\xf7\xde\xf7\xde\xf7\xbe\xc7=\xf7\xbe\xff\xde\xff\xdf\xff\xdf\x82\xf7\xde\r^;E\xda\xf7\xbe\xf7\xbe\xff\xdf\xff\xdf\xf7\xbe\xf7\xde-{\x05[\x15:\xf7\xde\xff\xde\xf7\xbe\x82\xff\xde\x02\xf7\xbe\xf7\xbe\xf7\xde\x96\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x87\xff\xde\x01\xff\xff\xff\xff\x86\xff\xde\x00\xff\xdf\x9e\xff\xde\x01\xff\xdf\xff\xdf\x99\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x85\xff\xde\x00\xf7\xbe\x8f\xff\xde\x00\xff\xbe\x82\xff\xde\x02\xff\xbe\xff\xde\xff\xbe\x83\xff\xde\x01\xff\xbe\xff\xdf\x82\xff\xde\x00\xff\xbe\x83\xff\xde\x03\xf7\x9e\xff\xdek\x15\xce\\\x83\xff\xde\x03\xff\xbe\xff\xbe\xf7\xbe\xef}\x83\xf7\xbe\x02\xdf\x1d+V\xef\x9e\x82\xf7\xbe4\xef\x9e\xff\xbe\xf7\xbe\xf7\x9e\xf7\x9e\xd7\x1d\xc6\xddD\xd9\x03v\x03\x97\x03w\x036\x03V\x03w\x03\x97\x03v\x03\xb7\x03\xb7\x03\xd8\x03\xb7\x03\x97\x03\xf7\x04y\x04\x99\x04\x99\x04X\x04\x99\x04\x98\x047\x04X\x14\xb8\x0c\x98\x04x\x04x\x04X\x048\x048\x04X\x04X\x048\x047\x03\xf7\x04\x18\x048\x04\x17\x048\x04X\x047\x047\x04x\x04X\x048\x04x\x82\x04X\x01\x04x\x04x\x82\x04X\x02\x04x\x04x\x04\x98\x82\x04X\x82\x04x\x0e\x04\x98\x04x\x04\xb9\x04\xb9\x04\xfa\x04\xb9\x04\xd9\x15Z\x1dz\x04\xfa\x04X\x04X\x04\x17\x04\xb9\x04\xfa\x83\x04\xda\x16\x04\xfa\x15:\xef\xbe\xf7\xbe\xef\xbe\xef\xbe\xe7\x9e\xf7\xbe\xef\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xef\xbe\xdf\x9e\xe7}\xf7\xbe\x82\xff\xde\x05\xff\xdf\xa6\xfd\x05[\x05;M\xdb\xef\xbe\x85\xff\xde\x03\xf7\x9e\xf7\xbe\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x8c\xff\xde\x01\xff\xdf\xff\xdf\xaf\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xdd\xd9\xf7~\x90\xff\xde\x00\xff\xdf\x89\xff\xde\x10\xe6\xfc\xf7\xbe\xff\xde\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xb5Y\xbd\x9a\xf7\xbe\xff\xde\xff\xbe\xf7\xbe\xff\xde\xff\xde\x82\xff\xbe\x1f\xf7\x9e\xf7\xbe\xff\xdf\xff\xbe\xf7\x9e\xf7\x9e\xf7\xbe\xff\xde\xff\xdf\xf7\x9e\xdf=\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xe7^uz\x13\xf8\x03\xb7\x03\x97\x03\xb8\x036\x036\x03\xb7\x03\x97\x03\xb7\x03\xb8\x03\xb7\x03\x97\x03\x96\x03\xd7\x03\xf7\x82\x04\x99\x83\x04\xb9\x82\x04\x98\x02\x04x\x04\x99\x04x\x82\x04X\x07\x04\x99\x04X\x048\x04\x17\x048\x03\xf7\x04\x17\x04y\x84\x04X(\x047\x04X\x04X\x048\x04X\x04x\x04x\x047\x04X\x04x\x04x\x04\x99\x04x\x04\x98\x04X\x04x\x04x\x04\x98\x04\x98\x04\x99\x04X\x04x\x04\xd9\x04\xd9\x04\xfa\x04\xf9\x05\x1a\x04\xf9\xae\xfd\x9e\xbc%:\x04\x99\x04\xd9\x04\xb9\x04\xda\x04\xb9\x04y\x04\xda\x04\xfa\x04\xda\xdf\x9e\x84\xf7\xbe\x19\xef\x9e\xf7\xde\xf7\xbe\xef\x9e\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xf7\xbe\xf7\xde\xef\xbe\xff\xde~\x9c\x05:\x04\xfa\x05:5\xbb\xc7=\x88\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xdf\x9b\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xff\xdf\xff\xff\x9d\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xdf\x87\xff\xde\x03\xff\xdf\xff\xde\xff\xdf\xff\xdf\x96\xff\xde\x01\xff\xbe\xb5X\x83\xff\xde\x05\xf7\xbe\xff\xde\xff\xde\x84WJs\xef]\x82\xff\xde\x01\xf7\xbe\xff\xbe\x82\xff\xde\x08\xff\xbe\xf7\xbe\xff\xbe\xf7\xbe\xf7\xbe\xff\xde\xff\xbe\xff\xbe\xf7\xbe\x82\xff\xde\x01\xf7\xbe\xe7]\x82\xf7\xbe\x1ee\x1a\x03\xd8\x03\xd8\x03\xf8\x03\xd8\x03v\x03\x97\x03\xb7\x03\xb7\x03\x97\x03\xf8\x03\xd8\x03\xb7\x048\x04y\x048\x048\x04x\x04\xb9\x04\xb9\x04\x99\x04\x98\x04x\x04\xb9\x04\x98\x04\x99\x04X\x04X\x04x\x04X\x048\x82\x04X\x0c\x048\x04x\x04y\x048\x04\x17\x04X\x04X\x047\x04\x98\x04x\x04X\x04\xb9\x04x\x83\x04X\x07\x047\x04W\x04W\x04x\x04\x98\x04\xd9\x04\x98\x047\x83\x04\x99\x1e\x04\xf9\x04\xfa\x047\x04X\x04\x98\x04\xd9\x05\x1a5\xbb%\x9b5z\xd7~\xcf=\xf7\xbeU\xdb\x04\xb9\x04\x98\x04\xd9\x04\xb9\x04\x99\x04\x99\x05\x1an;\xf7\xbe\xef\xbe\xf7\xbe\xf7\xbe\xef\x9e\xf7\xbe\xf7\xde\xf7\xbe\xf7\xdf\x83\xf7\xde\x82\xff\xde\x10\xf7\xde\xef\x9e\xf7\xbe\xff\xde\xf7\xbe\xef\x9e\xef\xbe\xf7\xbe\xcf=\xf7\xbe\xf7\xde%\x9b\x05;\x05\x1a\x05;\x05:\xb6\xfd\x84\xff\xde\x00\xf7\xde\x99\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xff\xa1\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xff\x99\xff\xde\x02\xff\xdf\xff\xff\xff\xdf\xa6\xff\xde\x01\xff\xbe\xde\x1a\x8d\xff\xde\x00\xff\xbe\x83\xff\xde!\xe6\xfd!\xb1\xde\xfd\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xde\xf7\xbe\x9d\x99\xff\xde\xef}\xff\xbe\xff\xde\xff\xde\xf7\x9e\xff\xde\xf7\xbe\xff\xbe\xf7\x9e\xff\xbe\xff\xde\xff\xde\xf7\xbe\xef\x9e\xc6\xbc\xff\xde\xff\xde\xf7\xbe\xb6|\x03w\x03\xf9\x03\xf8\x04\x18\x82\x03\xb73\x03\xd8\x03\xd7\x03\xd8\x04\x18\x03\xf8ez\xc6\xfd\xcf=\xcf=u\xfb\x0cw\x04\x17\x04\x98\x04x\x04\x98\x04\xd9\x04\x98\x04x\x04X\x04\x17\x04X\x04x\x04\x99\x03\xf7\x03\xd6\x04X\x04x\x04\xb9\x04\x99\x04\xb9\x04\x98\x04\xb9\x04\xb9\x04W\x04\x98\x04\xb9\x04\xb9\x04\x99\x04\x98\x04x\x04\x98\x04\x98\x04x\x04\x99\x04\x98\x04\xb9\x04\xd9\x04\xf9\x04\x98\x04\xb9\x04X\x04W\x83\x04\xb9 \x04\xf9\x04X\x04X\x04x\x047\x04\x99\r:M\xfbE\xdbv\\\xef\xbe\xf7\xbe\xf7\xbe\x86|U\xdb\x14\xf9\x04\xb9\x04\x99\x04x\x0c\xb9\xdf\x9e\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xef\xbe\xef\xbe\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xff\xde\xf7\xde\x82\xff\xde\x03\xff\xdf\xff\xde\xf7\xbe\xf7\xde\x82\xff\xde\x0b\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xff\xde\x86\x9c\x05\x1a\x05;\x05\x1a\x05[\x05\x1a\xe7\x9e\x95\xff\xde\x00\xff\xbe\x84\xff\xde\x00\xff\xdf\x90\xff\xde\x01\xff\xdf\xff\xdf\x84\xff\xde\x03\xff\xff\xff\xdf\xff\xdf\xff\xff\x8d\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xdf\x91\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8e\xff\xde\x00\xff\xdf\x97\xff\xde\x00\xff\xbe\x86\xff\xde\x00\xf7}\x86\xff\xde\x03\xff\xdf\xff\xde\xff\xbe\xff\xbe\x85\xff\xde\x04\xff\xbe\xe7]cv\xa59\xff\xbe\x84\xff\xde\x01\xf7\xbe\xf7\xbe\x85\xff\xde\x00\xff\xbe\x82\xf7\xbe\x01\xef\x9e}\xdb\x82\xf7\xbe\x82\xff\xdej\xf7\x9e\xef]\x03\x97\x03\xd8\x03\xf8\x049\x03\xb7\x036\x03\xd8\x04\x18\x03\xf8\x04\x18\x04y\x04Y\xdf]\xe7~\xf7\xbe\xe7~\xf7\xbe\xf7\xbe\xe7~m\xfb\x04\xd8\x04\xf9\x04\xd9\x04\xb8\x04\x98\x0c\xd9\x1dZ\x04\xd9\x04\x99\x04x\x04X\x04\x17\x04X\x048\x04x\x04X\x04\xb9\x04\xd9\x04\xfa\x04\xd9\x04x\x04W\x04x\x04\x98\x04\xb9\x04x\x04x\x04\x98\x04x\x047\x04\x16\x04x\x04\xb9\x04\xf9\x04\xd9\x04\xf9\x04\xd9\x04\xd9\x04\xb9\x04\x98\x04X\x03\xf6\x04\x98\x04\xf9\r:\x96\xbc\xf7\xbem\xda5Z\x04\x995\xdb\x05Z\x15:\xe7\x9e\xf7\xde\xf7\xbe\xff\xdf\xff\xdf\xe7\x9e\xbf=\x0c\xd9\x04\xb9\x14x\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xcf]\x15z\xef\xbe\xf7\xbe\xff\xde\xff\xde\xf7\xde\xf7\xde\xaf\x1d%z\xae\xfd\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\xf7\xde\x83\xff\xde\x08\xff\xdf\xff\xde\xbf]\x05\x1a\x05:\x05[\x05\x1a\x04\xf9\x8e|\x84\xff\xde\x00\xf7\xbe\x84\xff\xde\x00\xff\xbe\x8d\xff\xde\x00\xff\xdf\x9c\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x86\xff\xde\x03\xff\xff\xff\xde\xff\xde\xff\xdf\x94\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xbe\x93\xff\xde\x00\xff\xff\x84\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x89\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xf7\xbe\x87\xff\xde\x06\xa5Y|x|7\xff\xbe\xff\xde\xf7\x9e\xff\xbe\x8b\xff\xde\x07\xff\xbe\xff\xde\xff\xdeuZ$8\xe7~\xf7\xde\xf7\xbe\x83\xff\xde,\xef\x9e\x03\xb8\x03\xf8\x03\xd7\x03\xd7\x03\xb7\x049\x04\x18\x048\x048\x04y\x04Y\x0cX\xc6\xfd\xdf]\xef\x9e\xd7]\xef\x9e\xdf]\xef\xbe\xbf=\x04\xd9\x04\xd9\x04\xb9\x04x\x04\xf9\x0c\xfa-z\x04\x98\x04\xb9\x04\xb9\x04\x99\x04X\x04\x98\x04X\x04x\x04x\x04\x99\x04\x98\x04W\x04\xb9\x04W\x04x\x04w\x04\xb8\x82\x04\x984\x04x\x04\x98\x04\xb9\x04\x98\x04\xb8\x04\xd9\x04\xd9\x04\xb8\x04\xb8\x04\x98\x04x\x04\xd9\x04\x98\x04\xb9\x04x\x04\x98\x04\xf9\rZ\x9e\xbc\xf7\xbe\xff\xde\xf7\xde\x9e\xddv\\\x15Zn;\xef\xbe\xf7\xbe\xc7\x1d\xf7\xbe\xf7\xde\xe7\x9e\xdf]\xe7\x9e\x1c\xf9\x04X\x9e{\xef\x9e\xf7\xbe\xe7\x9e\xf7\xde\xf7\xde\xdf\x9e\xf7\xde\xff\xde\xff\xdf\xff\xff\xf7\xde\xf7\xde\xe7\x9eN\x1b\x9e\xdc\xf7\xbe\x82\xff\xde\x00\xf7\xbe\x86\xff\xde\x07\xf7\xbeM\xdb\x05\x1a\x05\x1a\x04x\x04x\xbf\x1d\xf7\xde\x83\xff\xde\x00\xf7\xbe\x9f\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xff\xdf\xff\xff\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x8f\xff\xde\x01\xff\xdf\xff\xff\xa3\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\xa9\xff\xde\x00\xff\xbe\x83\xff\xde\x03|Wc\x96c\xb7[\x96\x8f\xff\xde \xf7\xbe\xf7\xbe\xff\xde\xf7\x9e\xf7\xbe\xff\xde\xff\xde\xf7\xbe\xff\xde\xff\xde\xff\xdf\xf7\xdemZ\x03\xf8\x03\xd8\x03\xd8\x03\x97\x03\xf8\x048\x04\x18\x03\xd8\x03\xd7\x04\x18\x0494\x99\xe7\x9e\x96;\xb6\xbc\xbe\xfd\xe7~\xef\x9e\xbe\xfc5z\x82\x04\xb9\x0e\x04\xd9\x04\xfa\x04\xd95z\x04\xb9\x04\x98\x04\xf9\x04\xb9\x04\xb9\x04\x99\x04x\x04\x99\x04\xd9\x04\x98\x04\x98\x82\x04\xb8*\x04x\x04\x98\x04\xb8\x04\xb9\x04\xb8\x04\xb8\x04\xb9\x04x\x04\xd9\x04\x98\x04\x98\x04\xd9\x04\xf9\x04\xb8\x04\xb8\x04\xb9\x04\xb8\x04\x98\x04\xf9\x04\xf9\x04\xd9=\x9a%:\x1d9\xd7]\xe7\x9e\xf7\xde\xf7\xde\xf7\xbe\xff\xde\xf7\xde\xf7\xde\xef\x9e\xf7\xdef;\xbf\x1d\xf7\xde\xf7\xde\xe7\x9e\xef\xben\x1b\x04\xb9M\xda\x83\xf7\xbe\x0f\xf7\xde\xf7\xde\xff\xde\xef\xbe\xe7\x9e\xf7\xde\xef\x9e\xae\xfd\xf7\xde\xf7\xbe\xf7\xbe\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\x83\xff\xde\x00\xf7\xde\x82\xff\xde\n\xf7\xde\xb6\xfc=9E\x19\xc7\x1d\xff\xde\xff\xde\xff\xff\xff\xde\xff\xde\xf7\xde\x88\xff\xde\x01\xf7\xde\xf7\xde\x9a\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xff\x86\xff\xde\x02\xff\xfe\xff\xde\xff\xdf\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x84\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\xbd\xff\xde\x00\xff\xdf\x83\xff\xde\x04\xf7\xbek\xf7[\xd7[V\x84X\x89\xff\xde\x00\xf7\xbe\x86\xff\xde\x83\xff\xbe\x00\xff\xdf\x83\xff\xde\x08\xae|\x0cY\x04\x18\x03\xd8\x86\x1b,8]Z\xb6\xddUZ\x82\x03\xf8\x04\x14\x18\xf7\xbe\xf7\xbe\xef\xbe\xef\x9e\x82\xf7\xbe\x0f\xef\x9e%Z\x04\xf9\x04\xf9\x04\xb9\x04\x98\x04\xb9e\xfb\xc7\x1d\x86|\x1c\xd9\x04\x99\x04x\x04\xd9\x04\x99\x04\x98\x82\x04\xb9\x06\x04\x98\x04\xb8\x04\xd9\x04\x98\x04\x98\x04\xb8\x04\xb8\x82\x04\x98\x15\x04\xb9\x04\xb9\x04x\x04\xb9\x04\xd9\x04\xf9\x04\xd9\x04\x98\x05\x1a\x05\x1a\x04\xf9\x04\xf9\x05\x1a\x04\xb9]\xfb\xff\xde\xef\xbe\xe7\x9e\xef\x9e\xef\x9e\xf7\xbe\xf7\xde\x82\xf7\xbe\x1b\xf7\xde\xef\xbe\xf7\xbe\xf7\xde\xef\x9e\xf7\xde\xf7\xde\xf7\xbe\xf7\xbev;\x04\xb9\xe7\x9e\xdf~\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xae\xdc\xf7\xbe\xf7\xde\xdf~\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\x8a\xff\xde\x00\xf7\xbe\x82\xff\xde\x00\xff\xbe\x8f\xff\xde\x01\xb7\x1d\x86[\x8a\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xf7\xbe\x90\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x9e\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xfe\x83\xff\xde\x00\xff\xff\x9e\xff\xde\x04\xf7\x9elWS\xb7SU\xd6\xbc\x86\xff\xde\x03\xff\xdf\xff\xde\xff\xbe\xff\xbe\x86\xff\xde=\xf7\xbe\xff\xde\xf7\xbe\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf,X\x04\x19\x0b\xf8\x9e|\xff\xde\xff\xdf\xf7\xbe\xff\xde\xff\xdfM:\x03\x97\x13\xd7\xc7\x1d\xf7\xbe\xf7\xbe\xef\xbe\xe7~\xff\xdf\xef\x9e\xf7\xde-z\x04\xfa\x04\xf9\x04\xfa\x04\xd9\x04\xfa\x04\xd9m\xfb\xef\xbe\xef\xbe\xd7]5:\x14\xfa\x04\xd9\x04\xd9\x04\x98\x04\xb9\x04\xb9\x04x\x04\x98\x04\xb8\x04\xd9\x04\xb8\x04\x98\x04\xb8\x04\x98\x04\x98\x04\xb9\x04\xd9\x04\xb8\x04\x98M\xbaU\xfb\x82\x04\xf9\x0b\x04\xd9\x05:\x05\x19\x05:\x05\x1a\x05\x1a\x1d\x19\xef\x9e\xf7\xbe\xef\x9e\xae\xbb\xe7~\x83\xf7\xbe\x00\xf7\xdf\x82\xf7\xde\n\xff\xde\xef\x9e\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\xef\x9e\xe7}U\x9aMz\xb6\xdc\x82\xf7\xbe\x0f\xf7\xde\xff\xde\xff\xde\xef\x9e\xf7\xbe\xf7\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xde\xf7\xbe\xef\xbe\xff\xde\xf7\xbe\xff\xdf\xf7\xde\x87\xff\xde\x00\xf7\xde\x93\xff\xde\x00\xff\xfe\x96\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\xc2\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xdf\x9d\xff\xde\x00\xff\xdf\x86\xff\xde\x02\xef^\xce\x9b\xef^\x83\xff\xde\x00\xf7\xbe\x82\xff\xde\x03\xff\xbe\xf7\xbe\xff\xde\xff\xbe\x82\xff\xde\x00\xff\xbe\x83\xff\xde\x00\xf7\xbe\x84\xff\xde\'\xf7\xde\xc6\xfd\x03\x97\x03\xd8\x96\x1b\xf7\xde\xf7\xbe\xf7\xbe\xff\xdf\xff\xdf\xf7\x9e\xdf^\xbe\xdc\xf7\xde\xf7\x9e\xf7\xbe\xf7\xbe\xe7\x9e\xdf}\xef\x9e\xf7\xde\x9e\x9c\x05[\x05\x1a\x05:\x05\x1a\x05\x1a\x04\xb9\x04\xd9=\x9a\xef\xbf\xf7\xbe\xc7\x1d\xe7\x9e\xc7\x1d\x1dZ\x05\x1a\x04\xf9\x04\xb9\x04\xb8\x83\x04\xd9\x1d\x04\xb8\x04\xb8\x04\x98\x04\x98\x04\xb8\x04\xb8\x04\x98\x04\xb9\x04\x98\xbf\x1d\xe7~\xae\xfd\x1d\x19\x05:\x05Z\x05\x19\x05:\x04\xf9\x04\xd9\x04\xd9$\xd8\xf7\xbe\xf7\xbe\xef\xbe\xe7~\xef\xbe\xe7\x9en\x1b\xa6\xdc\xff\xde\x83\xf7\xde\n\xf7\xbe\xef\xbe\xf7\xde\xf7\xde\xf7\xbe\xef\x9e\xf7\xbe\xf7\xde\xc7>\x0c\xd9\xf7\xde\x83\xf7\xbe\x07\xff\xde\xf7\xbe\xff\xde\xff\xde\xf7\xde\xff\xde\xff\xdf\xff\xdf\x85\xff\xde\x00\xf7\xde\xa2\xff\xde\x01\xf7\xde\xf7\xbe\x94\xff\xde\x00\xff\xff\xa1\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x96\xff\xde\x01\xff\xff\xff\xff\x88\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x90\xff\xde\x00\xff\xdf\x89\xff\xde\x01\xf7\xbe\xf7\xbe\x85\xff\xde\x02\xf7\xbe\xbe\x1b\xf7\xbe\x82\xff\xde\x1e\xff\xbe\xff\xde\xff\xde\xf7\xbe\xff\xdf\x9e<L\xfa\x03\x97\x13\xb7\xbe\xfd\xf7\xbe\xf7\xbe\xff\xde\xf7\xbe\xff\xde\xae|\xf7\xbe\xf7\xde\xf7\xbe\xef\x9e\xf7\xde\xdf\x9e-\x1a\xae\xdc\xf7\xbe\xf7\xdeM\xfb\x05[\x05[\x05:\x05:\x83\x05\x1a\n\x8e\x9c\xf7\xbf\xef\xbe\xcf=\xcf^\x1d{\x04\xfa\x05\x1a\x04\xd9\x04\xd9\x04\xf9\x85\x04\xd9\x13\x04\x98\x04\xb8\x04\xb9\x04\x98\x04\xd9\x04\xb9\xc7\x1d\xb6\xdc\xef\xbe\xef\x9e5\xbb\x05:\x059\x05Z\x05\x19\x059\x04\xd9\x1d:\xf7\xde\xdf]\x82\xef\xbe\x0c\xf7\xbe-\x9a5\x9a\xff\xde\xf7\xde\xff\xdf\xff\xde\xf7\xde\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xf7\xbe\x82\xf7\xde\x04\xef\xbe\r\x1a\xcf]\xf7\xbe\xef\xbe\x82\xf7\xde\x02\xff\xdf\xff\xde\xf7\xde\xa8\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xef\xbe\xc7\x1c\x93\xff\xde\x00\xff\xdf\xae\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xff\xdf\x97\xff\xde\x00\xff\xff\x88\xff\xde\x00\xf7\xbe\x86\xff\xde\x00\xff\xdf\x82\xff\xde\x02\xff\xff\xff\xde\xff\xdf\x93\xff\xde\x00\xff\xbe\x83\xff\xde\x00\xf7\xbe\x85\xff\xde\x03\xe7=\xa5Y\xff\xde\xff\xdf\x86\xff\xde\x19\xa6|\x96\x1c\x13\xb8\xe7]\xef\x9e\xff\xde\xff\xde\xf7\xbe\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\xef\x9e\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\xc7\x1d\xf7\xbe\xf7\xde\xf7\xde-Z\x05{\x05:\x05;\x05:\x82\x05\x1a@\x05:\x96\xbc\xa6\xbc\xef\xbe\xe7~\xc7\x1d\x15z\rZ\x05{\x05:\x04\xb9\x04\xb8\x04\xb9\x04\xd9\x05\x1a\x04\xd9\x04\xb8\x04\xd9\x04\xb8\x04\xd9\x04\xb9\x04\x99\x04\xd9f\x1b\xef\xbe\xe7\x9e\xef\x9e\xe7\x9e\xb7\x1d5\xbb=\xdb\x05Z\x05Z\x05:\x04\xd9n;\xf7\xde\xf7\xbe\xf7\xbe\xe7~\xe7\x9e\xef\x9e\xef\xbe\xb7\x1d\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\xf7\xde\xf7\xbe\xef\xben;\xef\xbe\xf7\xde\xff\xde\xff\xde\xef\x9e\xaf\x1d\xc7\x1d\xef\xbe\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\x8f\xff\xde\x00\xf7\xbe\x8d\xff\xde\x00\xd7]\xad\xff\xde\x00\xff\xbe\x8f\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x96\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x8e\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x8f\xff\xde\x00\xff\xbe\x8b\xff\xde\x00\xff\xbe\x8b\xff\xde\x01\xf7\xbe\xff\xbe\x86\xff\xde\r\xf7\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xff\xbe\xff\xde\xff\xde\xae|D7\xf7\xbe\xff\xde\xff\xde\xf7\xbe\x83\xff\xdeP\xf7\xbe\xef~\xff\xde\xff\xde\xf7\xbe\xff\xde\xff\xde\xf7\xde\xf7\xbe\xf7\xden<\x05Z\x05Z\x05:\x05\x1a\r:\x04\xfa\x05\x1aU\xfb\xf7\xbe\xdf^\xf7\xde\xf7\xdf\xb7\x1d~\\\rZ\x05Z5\xfb\x04\xfa\x04\xd9\x04\xf9\x04\xf9\x04\xd9\x04\xf9\x04\xf9\x04\xd9\x04\xf9\x05:\x05\x1a\x04\xf9E\xdb\xdf~\xd7=v|\xdf~\xef\x9e\xff\xde\xcf=\xef\xbe\x1d\x19\x05\x19\x05:\x04\xf9\x86\x9c\xef\x9e\xf7\xbe\xf7\xbe\xe7\x9e\xf7\xbe\xf7\xbe\xef\x9e\xf7\xbe\xf7\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xf7\xbe\xf7\xde\xb6\xfd\x05:\x8e\x9c\xf7\xbe\xff\xde\xff\xde\xf7\xbe\xef\x9e\x9e\x9b\xef\xbe\xef\xbe\xf7\xbe\x8e\xff\xde\x00\xf7\xbe\x90\xff\xde\x00\xef\xbe\xad\xff\xde\x00\xff\xff\x88\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\xd2\xff\xde\x00\xff\xdf\x83\xff\xde\x01\xbc\xb7\xcd\xfa\x85\xff\xde\x00\xff\xdf\x8a\xff\xde\x00\xf7\x9d\x84\xff\xde\x01\xf7\x9e\xf7\x9d\x8c\xff\xde\x03\xff\xbe\xff\xdeDX\xef\x9e\x82\xff\xde\x03\xf7\xbe\xf7\xbe\xff\xde\xff\xde\x82\xf7\xbe%\xf7\xde\xff\xde\xff\xde\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xf7\xde\xdf\x9e%\x9b\x15z\x05:\r{\rZ\x05:-z\xdf~\xf7\xbe\xef\xbe\xf7\xbe\xe7~f\x1b\xcf^\x9e\xdd\x86\x9c\x86\xbc\r:\x04\xf9\x04\xf9\x04\xd9\x05\x19\x04\xf9\x04\xf9\x05\x1a\x05\x19\x05:\x04\xf9\xae\xfd\x82\xf7\xbe&%z%\x9a\xf7\xbe\xf7\xde\x9e\xbc\xef\xbee\xfa\x04\xf9\x05:\x04\xf9%Z\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xf7\xbe\xf7\xbe\xe7\x9e\x1dzf<\xf7\xde\xf7\xde\xff\xde\xf7\xbe\xf7\xde\xdf]\xe7\xbe\xef\xbe\xf7\xde\xf7\xbe\x84\xff\xde\x00\xf7\xde\x86\xff\xde\x02\xbf=\xbf=\xf7\xbe\x8e\xff\xde\x00\xf7\xbe\x83\xff\xde\x00\xff\xdf\xad\xff\xde\x00\xff\xff\xa3\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\xa7\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xff\xdf\xff\xdf\x8a\xff\xde\x00\xff\xbe\x84\xff\xde\x00\xff\xbe\x82\xff\xde\x00\xff\xdf\x8d\xff\xde\x01\xf7\xbe\xf7\xbe\x85\xff\xde\x00\xff\xbe\x83\xff\xde\x05\xff\xbe\xff\xde\xf7\xbe\xff\xde\xdf^\xb6\x9c\x88\xff\xde\x03\xf7\xde\xff\xde\xff\xdf\xf7\xde\x82\xff\xdeJ\xf7\xde\x9e{\xef\x9e\xf7\xbe\x86|\x86|M\xdaf;=\xdb\x96\xbc\xe7\x9e\xf7\xbe\xf7\xbe\x8e[\xef\xbe\xf7\xbe\xf7\xdf\xf7\xbe\xef\x9e\xef\xbe\xef\xbe\xae\xfd%\x9b\x04\xb8\x04\xd9\x05\x1a\x05\x19\x05:\x05:\x05\x1a\x05:\x04\xf9\xdf\x9e\xf7\xbe\xf7\xbe\xf7\xde\xbf\x1d\xbf=\xf7\xbe\xf7\xbe\xf7\xde\xf7\xde\xef\xbeV\x1b\x05Z\x05Z\xa6\xdc\xf7\xbe\xff\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xff\xde\xff\xdf\xf7\xbe\xff\xde\xf7\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xe7\x9e\xf7\xde\xf7\xde\xc7=\xd7]\xf7\xbe\xf7\xde\x8b\xff\xde\x03\xf7\xde\x15\xbb\r\x9a\xf7\xbe\x91\xff\xde\x03\xf7\xbe\xdf\x9eM\xfc\xae\xfd\x9b\xff\xde\x00\xff\xdf\xc6\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x91\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x8d\xff\xde\x02\xcf\x1c\xcf\x1c\xf7\xbe\x8a\xff\xde\x01\xf7\xbe\xf7\xbe\x83\xff\xde\x02\xef\x9eT\xb9\xef\x9e\x86\xff\xde\x00\xf7\xbe\x82\xff\xde$\xf7\xbe\xff\xde\xf7\xbe\xae\xbc\xef\xbe\xef\x9e\xd7]\xf7\xbe\xf7\xde\xf7\xbe\xc6\xfc\xdf~\xef\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xdf~\xf7\xbe\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xf7\xbe\xf7\xde\xef\xbe\xef\xbe%\x9a\x05:\x05\x1a\x05:\x05\x19\x05:\x05\x1a\x05:\x04\xf9\x82\xef\xbe\x02\xff\xde\xf7\xbe\xef\xbe\x82\xf7\xbe!\xef\x9e\xf7\xde\xef\xbe\xaf\x1d\x05Z\xa6\xdc\xef\xbe\xf7\xbe\xf7\xde\xf7\xbe\xef\x9e\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\xf7\xde\xff\xde\xef\xbe\xff\xde\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xf7\xde\xef\xbe\xef\x9e\xf7\xde\xb7\x1d\x15z%y\xdf\x9e\x8c\xff\xde\x01\xbf\x1d\xcf]\x93\xff\xde\x03\xd7~\x05:\x05:\xe7\x9e\x85\xff\xde\x00\xff\xdf\x96\xff\xde\x00\xff\xfe\x85\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xff\x96\xff\xde\x04\xff\xdf\xff\xde\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\xb9\xff\xde\x00\xf7\xbe\x8b\xff\xde\x01\xe7]\xff\xbe\x84\xff\xde\x02\xb6\x9c\xbe\xbd\xef\x9e\x85\xff\xde\x08\xff\xdf\xdf~\x8e;\xff\xde\xff\xde\xf7\xde\xff\xde\xff\xde\xe7}\x82\xef\x9e\r\xff\xdf\xe7\x9e\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xf7\xdf\xf7\xbe\xef\xbe\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\x82\xf7\xde\x04\xf7\xbe\xff\xde\xcf=\xdf~\x8e\x9c\x83\x05:\x16\x05Z\x04\xb8\x04\xf9%9\xf7\xbe\xef\xbe\xf7\xbe\xef\x9e\xc7\x1d\xf7\xde\xf7\xbe\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe%z\xd7~\xef\x9e\xef\x9e\xff\xde\xf7\xde\x82\xf7\xbe\x14\xe7}\xf7\xbe\xff\xde\xff\xde\xf7\xbe\xf7\xde\xff\xde\xf7\xde\xf7\xbe\xf7\xbe\xff\xde\xff\xde\xf7\xde\xf7\xde\xf7\xbe\xe7\x9e\xff\xdf5\xfb\x05{\x05z\x1dZ\x9c\xff\xde\x00\xff\xdf\x85\xff\xde\x01\xae\xfc\x96\x9c\xc0\xff\xde\x00\xff\xdf\x9e\xff\xde\x00\xff\xdf\x8c\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x9c\xff\xde\x00\xff\xdf\x9a\xff\xde\x03\xff\xbe\xff\xde\xff\xde\xff\xbe\x8b\xff\xde\x03\xf7\xde#\x96\xf7\xbe\xf7\xbe\x86\xff\xde\x01\xae\\d\xf8\x84\xff\xde\x82\xf7\xde%\xff\xde\xff\xde\xcf\x1c\xf7\xbe\xf7\xbe\xe7\x9e\xdf}\xff\xde\xf7\xde\xf7\xbe\xef\x9e\xe7\x9e\xf7\xde\xf7\xbe\xf7\xde\xf7\xbe\xff\xde\xff\xde\xf7\xbe\xf7\xde\xc7\x1d\xf7\xbe\xe7\x9e\x1dZ\x05:\x05Z\x05z\x05Z\x05Z\x04\xfa\xbf\x1d\xf7\xde\xf7\xbe\xf7\xbe\xf7\xde\xdf}\xf7\xde\xf7\xbe\x82\xf7\xde\x15\xff\xde\xef\xbe\xf7\xbev|\xdf\x9e\xef\x9e\xf7\xbe\xf7\xde\xff\xde\xf7\xbe\xf7\xde\xd7=\xf7\xde\xff\xde\xf7\xde\xf7\xde\xff\xde\xff\xde\xef\xbe\xf7\xbe\xff\xde\xf7\xbe\x83\xff\xde\x08\xf7\xde\xff\xde\xff\xdf%\x9a\x05z\x05Z\x05:\xa6\xdc\xf7\xde\x83\xff\xde\x00\xf7\xde\x8e\xff\xde\x01\xf7\xde\xff\xff\xaf\xff\xde\x00\xff\xdf\xbd\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x01\xff\xdf\xff\xff\x91\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xe6\xbc\xde;\x94\xff\xde\x07\xff\xbe\xff\xbe\xff\xde\xff\xde\xff\xbe\xff\xde\xf7\xbe\xf7\xbe\x82\xff\xde\x01]\x1a$X\x83\xff\xde\x05\xf7\xbe\xff\xde\xff\xde\xf7\xbe\xff\xde\xff\xbe\x83\xff\xde\x00\xf7\xbe\x82\xff\xde\x83\xf7\xbe\x01\xff\xdf\xef\x9e\x82\xf7\xbe\x08\xdf}\xb6\xdc\xff\xde\xe7\x9e\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xde\x82\xff\xde\x82\xf7\xde\x08V;\x05z\x05Z\x05Z\x05{\x05\x1a\x04\xd9\xc7]\xf7\xbe\x82\xf7\xde\x13\xe7\x9e\xf7\xbe\xf7\xbe\xff\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\xf7\xde\xcf~\xc7]\xf7\xbe\xf7\xbe\xff\xde\xff\xde\xff\xdf\xf7\xde\xef\xbe\xf7\xde\xff\xde\x82\xf7\xde\x04\xff\xde\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\x86\xff\xde\x00\x8e\xbc\x82\x05{\x00\xa6\xdc\x86\xff\xde\x01\xf7\xde\xf7\xde\x83\xff\xde\x00\xff\xdf\x86\xff\xde\x01\xef\xbe\xf7\xde\x8b\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xdf\xa2\xff\xde\x00\xff\xdf\xb5\xff\xde\x00\xff\xdf\x88\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\xa0\xff\xde\x00\xff\xbe\x83\xff\xde\x02\xf7^rr\x8b\xb5\x85\xff\xde\x02\xff\xbe\xff\xde\xff\xbe\x95\xff\xde\x02m\x9b\x0c\x19M\x1a\x89\xff\xde\x00\xf7\xbe\x87\xff\xde\x04\xff\xdf\xff\xdf\xf7\xbe\xff\xdf\xf7\xde\x82\xff\xde\x07\xf7\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xde\xff\xde\xff\xde\xff\xdf\x82\xff\xde&\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\xcf^\x15\x9a\r{\x1d\xbbV\x1b\xdf~\xe7\x9e\xf7\xde\xff\xdf\xf7\xbe\xf7\xde\xf7\xde\xf7\xbe\xf7\xde\xe7\x9e\xff\xde\xf7\xde\xff\xde\xf7\xde\xe7\x9e\xef\xbe\xf7\xde\xcf]\xf7\xbe\xef\xbe\xef\x9e\xf7\xbe\xff\xde\xf7\xde\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\xff\xde\x82\xf7\xde\x01\xf7\xbe\xf7\xde\x83\xff\xde\x06\xf7\xde\xff\xde\xff\xbe\xf7\xde=\xba\rZv{\xb3\xff\xde\x01\xff\xdf\xff\xdf\x8f\xff\xde\x00\xff\xfe\xb9\xff\xde\x08\xff\xdf\xff\xde\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xde\xff\xde\xff\xdf\x9c\xff\xde\x00\xff\xdf\x93\xff\xde\x04\xff\xdf\xff\xde\xf7\x9e\xc5y\xf7~\x86\xff\xde\x00\xff\xdf\x95\xff\xde\x03\xc6\xfd\x14Y\x149\xb6\x9c\x88\xff\xde\x05\xf7\xbe\xef}\xff\xde\xff\xde\xf7\xbe\xf7\xbe\x83\xff\xde\x04\xf7\xbe\xbf\x1d\x15z\xef\xbe\xf7\xde\x86\xff\xde\x00\xf7\xde\x86\xff\xde\r\xf7\xde\xf7\xbe\xf7\xde\xef\x9e\xae\xfc=\xfb^<\xd7]\xe7\x9e\xef\xbe\xef\xbe\xf7\xbe\xef\x9e\xff\xde\x82\xf7\xde\x0e\xf7\xbe\xff\xde\xf7\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\xf7\xde]\xfb\xef\xbe\xf7\xde\xef\x9e\xf7\xde\xff\xde\xf7\xbe\x83\xff\xde\x05\xf7\xbe\xff\xde\xff\xde\xf7\xbe\xff\xde\xe7\x9d\x84\xff\xde\x00\xf7\xbe\x83\xff\xde\x00\xf7\xde\x85\xff\xde\x00\xff\xdf\xa4\xff\xde\x01\xff\xfe\xff\xff\x8d\xff\xde\x00\xff\xff\x86\xff\xde\x00\xff\xdf\x90\xff\xde\x00\xff\xfe\x91\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xfe\x8e\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x84\xff\xde\x01\xff\xdf\xff\xdf\xc3\xff\xde\x00\xf7\xbe\x88\xff\xde\x03\x96<\x03\xb8\x0bV\xe7~\x8d\xff\xde\x00\xff\xbe\x83\xff\xde\x08\xf7\xde]\xfb\r\x1a\xae\xbc\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\x83\xff\xde\x00\xff\xdf\x83\xff\xde \xf7\xde\xe7\xbe=\xba\xf7\xbe\xff\xde\xf7\xde\xc7=\x05{%\x9b\xb6\xfd\xe7\x9e\xf7\xbe\xef\xbe\xf7\xbe\xef\xbe\xff\xde\xff\xde\xf7\xbe\xff\xde\xf7\xde\xff\xde\xf7\xde\xff\xde\xff\xde\xf7\xde\xf7\xbe\xf7\xdev[\xb6\xfc\xf7\xde\xef\x9e\xff\xde\xf7\xde\xd9\xff\xde\x03\xff\xdf\xff\xde\xff\xde\xff\xdf\x89\xff\xde\x00\xff\xff\xb7\xff\xde\x00\xff\xff\x89\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x9b\xff\xde\x02\xff\xbe\xe7=\xff\xdf\x90\xff\xde\x00\xff\xdf\x89\xff\xde\x02\xff\xdf\xf7\x9e\xdf<\x88\xff\xde\x02\xd7=}\xba\xce\xfc\x83\xff\xde\x00\xff\xbe\x8b\xff\xde\t\xf7\xbe\xff\xde\xff\xde\xff\xdf\xb6\xfdU\xfb\xef\xbe\xf7\xde\xf7\x9e\xf7\xbe\x86\xff\xde\r\xf7\xbe\xff\xde\xff\xde\xf7\xde\xf7\xde\xd7]f;\xf7\xde\xff\xde\xf7\xde\xdf~\rzM\xfb\xf7\xbe\x82\xf7\xde\x00\xf7\xbe\x82\xf7\xde\x85\xff\xde\x84\xf7\xbe\x01\xdf^\xf7\xde\x85\xff\xde\x02\xf7\xbe\xf7\xbe\xf7\xde\xd6\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\xa7\xff\xde\x00\xff\xdf\x96\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\xc8\xff\xde\x00\xf7\xbe\x84\xff\xde\x00\xf7\xbe\x86\xff\xde\x00\xf7\xde\x82\xff\xde\r\xf7\xde\xff\xde\xff\xde\xe7}\xe7}\xf7\xbe\xf7\xbe\xf7\xde\xff\xde\xff\xde\xf7\xdf^\x1bM\xfb\xff\xde\x82\xf7\xde\x84\xf7\xbe\x0e\xff\xde\xf7\xde\xf7\xde\xff\xde\xff\xde\xf7\xbe\xff\xde\xf7\xbe\xf7\xbe\xff\xde\xa6\xbc\xef\x9e\xff\xde\xff\xde\xf7\xde\x82\xff\xde\x00\xf7\xde\x83\xff\xde\x00\xf7\xbe\x89\xff\xde\x00\xff\xbe\x83\xff\xde\x01\xe7\x9e\x96{\x84\xff\xde\x00\xf7\xde\xd6\xff\xde\x02\xff\xff\xff\xde\xff\xbe\xff\xff\xde\x8c\xff\xde\x03\xff\xbe\xff\xde\xff\xde\xf7\xbe\x93\xff\xde\x00\xf7\xde\x82\xff\xde\x04\xf7\xde\xff\xde\xff\xde\xcf]\xcf=\x85\xff\xde\x06\xf7\xde\xff\xde\xff\xde\xf7\xbe\xff\xde\x86\x9c\xcf}\x85\xff\xde\x04\xdf~\xdf~\xff\xde\xff\xde\xf7\xde\x86\xff\xde\x02\xf7\xde\xf7\xde\xf7\xbe\x93\xff\xde\x01\xc7=]\xfa\xa9\xff\xde\x00\xff\xdf\x90\xff\xde\x00\xff\xff\x89\xff\xde\x00\xff\xdf\xda\xff\xde\x00\xff\xdf\xc7\xff\xde\x00\xf7\xbe\x98\xff\xde\x00\xef\xbe\x82\xf7\xbe\x02\xff\xde\xff\xde\xf7\xbe\x83\xff\xde\x02\xf7\xbe\xf7\xde\xf7\xbe\x86\xff\xde\x01\xef\xbe\x86[\x8a\xff\xde\x02\xef\xbeM\xfb\xdf\x9e\x92\xff\xde\x01\xf7\xde\xb6\xdc\x90\xff\xde\x01\xc7=\xa6\x9b\x8c\xff\xde\x01\xff\xdf\xff\xfe\x87\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xfe\x8b\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xff\xbc\xff\xde\x00\xff\xdf\x93\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xc6\xdc\x84\xff\xde\x00\xff\xbe\xb8\xff\xde\x02\xf7\xde\xbf\x1d\xf7\xde\x84\xff\xde\x01\xf7\xbe\xf7\xbe\x87\xff\xde\x05\xf7\xbe\xf7\xbe\xff\xde\xe7\xbe\rZ\xa6\xfc\x89\xff\xde\x02\xf7\xbe\x1dz\x86|\xa5\xff\xde\x01\xf7\xde\xf7\xde\xa0\xff\xde\x00\xff\xdf\xae\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xff\xa9\xff\xde\x01\xef~\x95\x99\x9a\xff\xde\x00\xf7\xbe\x9d\xff\xde\x00\xf7\xbe\x84\xff\xde\x01\x86{\xe7\x9e\x84\xff\xde\x00\xf7\xde\x8a\xff\xde\x04\xf7\xden\\\x05:\x15Z\xf7\xbe\x89\xff\xde\x02\xef\xbe\xf7\xde\xff\xdf\x90\xff\xde\x00\xff\xbe\x8f\xff\xde\x00\xff\xfe\x96\xff\xde\x00\xff\xfe\x8d\xff\xde\x00\xff\xdf\xa0\xff\xde\x01\xff\xff\xff\xdf\x95\xff\xde\x00\xff\xfe\xb0\xff\xde\x00\xff\xdf\xb0\xff\xde\x00\xef}\x8b\xff\xde\x03\xff\xdf\xff\xde\xc6\xdb\xf7\xbe\x94\xff\xde\x00\xff\xdf\x8a\xff\xde\x03\xf7\xde\xff\xde\x96\xbcM\xfb\x83\xff\xde\x01\xf7\xbe\xf7\xbe\x8b\xff\xde\x03\x8e\x9c\x04\xfa\x0cx\xf7\xde\xa4\xff\xde\x00\xff\xbe\x9f\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\xc3\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xff\xc5\xff\xde\x00\xff\xdf\x8c\xff\xde\x00\xf7\xde\x83\xff\xde\x00\xff\xbe\x83\xff\xde\x00\xff\xdf\x89\xff\xde\x01\xef\x9e\xf7\xde\x9c\xff\xde\x03v;\x05\x1a\xcf~\xff\xdf\x82\xff\xde\x00\xf7\xbe\x88\xff\xde\x00\xff\xbe\x82\xff\xde\x01\x86|\x96\x9c\xad\xff\xde\x00\xff\xdf\x97\xff\xde\x00\xff\xff\x9a\xff\xde\x00\xff\xff\xb4\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xff\x9b\xff\xde\x00\xff\xdf\x92\xff\xde\x00\xff\xdf\xa7\xff\xde\x02\xf7\xde-Z\xcf\x1d\x8c\xff\xde\x00\xff\xdf\x8e\xff\xde\x02\xc7=\x05:\xcf]\xa3\xff\xde\x00\xf7\xbe\xb4\xff\xde\x00\xff\xff\x99\xff\xde\x00\xff\xdf\x9c\xff\xde\x05\xff\xdf\xff\xde\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xff\xde\x84\xff\xde\x01\xcf\x1d\xf7\xbe\x8f\xff\xde\x00\xf7\xde\x8c\xff\xde\x00\xe7\xbe\x85\xff\xde\x00\xf7\xbe\x9d\xff\xde\x00\xef\x9d\xcb\xff\xde\x00\xff\xdf\x8d\xff\xde\x00\xff\xff\xac\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x9e\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\xc8\xff\xde\x01\xdf}\x9e\x9b\x9e\xff\xde\x00\xff\xbe\x92\xff\xde\x00\xf7\xbe\xa2\xff\xde\x01\xff\xfe\xff\xdf\x8c\xff\xde\x00\xff\xdf\xa9\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\xa4\xff\xde\x04\xff\xff\xff\xde\xff\xde\xff\xdf\xff\xdf\x99\xff\xde\x00\xff\xfe\xa5\xff\xde\x00\xff\xdf\xe8\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xdf\x98\xff\xde\x00\xff\xdf\xa5\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x91\xff\xde\x00\xff\xdf\xc2\xff\xde\x00\xff\xff\x85\xff\xde\x00\xff\xff\x93\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\x92\xff\xde\x01\xff\xbe\xff\xbe\xac\xff\xde\x00\xf7\xde\xc7\xff\xde\x00\xff\xdf\xa7\xff\xde\x00\xff\xdf\x86\xff\xde\x00\xff\xff\x8e\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x8c\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xff\x82\xff\xde\x00\xff\xdf\xa0\xff\xde\x00\xff\xdf\xd1\xff\xde\x00\xef\x9d\x92\xff\xde\x01\xf7\xde\xae\xbb\xbe\xff\xde\x00\xf7\xbe\x88\xff\xde\x00\xff\xdf\x83\xff\xde\x00\xff\xdf\xec\xff\xde\x00\xff\xdf\xbd\xff\xde\x00\xff\xdf\x89\xff\xde\x00\xff\xbe\xb7\xff\xde\x00\xf7\xde\x9b\xff\xde\x01\xff\xff\xff\xdf\xbe\xff\xde\x00\xff\xdf\x9b\xff\xde\x02\xff\xdf\xff\xde\xff\xff\x89\xff\xde\x00\xff\xff\xa8\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xff\x8f\xff\xde\x00\xff\xdf\x90\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x99\xff\xde\x00\xf7\xbe\x8e\xff\xde\x00\xff\xbe\xff\xff\xde\x8d\xff\xde\x00\xff\xdf\xcb\xff\xde\x01\xff\xff\xff\xdf\xe3\xff\xde\x00\xff\xdf\xbe\xff\xde\x00\xff\xdf\xcf\xff\xde\x00\xff\xff\xb9\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xdf\xb1\xff\xde\x00\xff\xdf\xad\xff\xde\x00\xff\xff\x91\xff\xde\x00\xff\xdf\xea\xff\xde\x00\xff\xdf\xa9\xff\xde\x00\xff\xdf\x92\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x86\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\x84\xff\xde\x00\xff\xff\x9b\xff\xde\x00\xff\xdf\x93\xff\xde\x02\xff\xff\xff\xde\xff\xff\x96\xff\xde\x00\xff\xdf\x87\xff\xde\x00\xff\xff\x92\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xfe\xe0\xff\xde\x00\xff\xff\x8c\xff\xde\x00\xff\xff\x8d\xff\xde\x00\xff\xdf\xc0\xff\xde\x02\xff\xdf\xff\xde\xff\xdf\x8a\xff\xde\x00\xff\xdf\x8b\xff\xde\x00\xff\xdf\xff\xff\xde\xa2\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\xc0\xff\xde\x01\xff\xdf\xff\xdf\xff\xff\xde\xff\xff\xde\xa4\xff\xde\x00\xff\xdf\x9c\xff\xde\x00\xff\xdf\x8f\xff\xde\x00\xff\xbe\xae\xff\xde\x00\xff\xdf\xff\xff\xde\xc6\xff\xde\x00\xff\xdf\x94\xff\xde\x00\xff\xff\x99\xff\xde\x00\xff\xdf\xcd\xff\xde\x00\xff\xdf\xaa\xff\xde\x00\xff\xff\xc1\xff\xde\x00\xf7\xbe\xff\xff\xde\x86\xff\xde\x00\xff\xdf\xff\xff\xde\x94\xff\xde\x00\xff\xdf\x82\xff\xde\x00\xff\xdf\x9d\xff\xde\x00\xff\xbe\xff\xff\xde\x00\xff\xdf\xd8\xff\xde\x03\xff\xbe\xff\xde\xff\xde\xff\xff\xc2\xff\xde\x00\xff\xdf\xff\xff\xde\x02\xff\xde\xff\xde\xff\xbe\xa0\xff\xde\x00\xff\xdf\x91\xff\xde\x00\xff\xdf\x85\xff\xde\x00\xff\xdf\x8e\xff\xde\x00\xff\xdf\x99\xff\xde\x00\xff\xdf\x9f\xff\xde\x00\xff\xff\xde\xff\xde\x00\xff\xbe\x8b\xff\xde\x00\xff\xfe\xff\xff\xde\x92\xff\xde\x00\xff\xdf\x98\xff\xff\x00\xff\xdf\x83\xff\xff\x00\xff\xdf\x87\xff\xff\x04\xff\xdf\xff\xdf\xff\xff\xff\xff\xff\xdf\x87\xff\xff\x00\xff\xfe\x82\xff\xff\x00\xff\xdf\x89\xff\xff\x00\xff\xdf\x88\xff\xff\x04\xff\xde\xff\xff\xff\xff\xff\xdf\xff\xdf\x87\xff\xff\x00\xff\xdf\x85\xff\xff\x04\xff\xdf\xff\xff\xff\xdf\xff\xff\xff\xdf\x8c\xff\xff\x01\xff\xdf\xff\xdf\x83\xff\xff\x06\xff\xfe\xff\xff\xff\xff\xff\xde\xff\xff\xff\xff\xff\xde\x82\xff\xff\x82\xff\xdf\x82\xff\xff\x00\xff\xde\x84\xff\xff\x00\xff\xdf\x82\xff\xff\x82\xff\xdf\x87\xff\xff\x00\xff\xde\x82\xff\xff\x00\xff\xde\x82\xff\xff\n\xff\xdf\xff\xff\xff\xdf\xff\xff\xff\xff\xff\xdf\xff\xff\xff\xff\xff\xdf\xff\xde\xff\xde\x82\xff\xff\x00\xff\xdf\x8a\xff\xff\x82\xff\xdf\x83\xff\xff\x00\xff\xdf\x8e\xff\xff\x02\xff\xde\xff\xde\xff\xdf\x82\xff\xff\x07\xff\xde\xff\xdf\xff\xff\xff\xff\xff\xdf\xff\xff\xff\xfe\xff\xde\x82\xff\xff\x07\xff\xdf\xff\xff\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xfe\xff\xde\x82\xff\xff\x05\xff\xdf\xff\xde\xff\xff\xff\xdf\xff\xde\xff\xdf\x82\xff\xff\x00\xff\xdf\x86\xff\xff\x00\xff\xde\x82\xff\xff\x03\xff\xdf\xff\xff\xff\xfe\xff\xde\x84\xff\xff\x07\xff\xdf\xff\xdf\xff\xff\xff\xff\xff\xde\xff\xdf\xff\xff\xff\xde\x83\xff\xff\x01\xff\xde\xff\xfe\x85\xff\xff\x00\xff\xdf\x88\xff\xff\x00\xff\xdf\x8d\xff\xff\x00\xff\xdf'
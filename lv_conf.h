@@ -50,6 +50,9 @@
 #define LV_USE_XML 1
 #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS 1
 
+// Keep XML name="..." attributes so lvml.find() can look elements up
+#define LV_USE_OBJ_NAME 1
+
 #define LV_USE_LODEPNG 1
 #define LV_USE_FS_IF        1
 #define LV_FS_IF_LITTLEFS  'S'    // choose the letter you want to use
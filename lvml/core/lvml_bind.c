@@ -0,0 +1,269 @@
+/**
+ * @file lvml_bind.c
+ * @brief Named LVGL subjects for XML data binding with batched updates
+ */
+
+#include "lvml_bind.h"
+#include "utils/lvml_hash.h"
+#include "xml/lvml_xml_scan.h"
+#include "lvgl/src/others/xml/lv_xml.h"
+#include "lvgl/src/misc/lv_ll.h"
+#include "micropython/py/mphal.h"
+#include <stddef.h>
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct lvml_bind_entry {
+    lv_subject_t subject;
+    char name[LVML_BIND_NAME_MAX];
+    lvml_bind_type_t type;
+    char buf[LVML_BIND_STRING_SIZE];
+    char prev_buf[LVML_BIND_STRING_SIZE];
+    struct lvml_bind_entry* next;
+} lvml_bind_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lvml_bind_entry_t* bind_find(const char* name, uint32_t hash);
+static bool bind_scan_cb(lvml_xml_str_t tag, lvml_xml_str_t name, lvml_xml_str_t value, void* user_data);
+static void bind_mark_changed(lv_subject_t* subject);
+static void bind_invalidate_observers(lv_subject_t* subject);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lvml_bind_entry_t* bind_buckets[LVML_BIND_BUCKETS];
+static lvml_bind_stats_t bind_stats;
+
+// Batch state
+static uint32_t batch_depth = 0;
+static bool batch_prev_invalidation = true;
+static lv_subject_t* batch_changed[LVML_BIND_BATCH_MAX];
+static uint32_t batch_changed_cnt = 0;
+static bool batch_overflow = false;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_subject_t* lvml_bind_get_subject(const char* name, lvml_bind_type_t type, bool create) {
+    if (name == NULL || name[0] == '\0' || strlen(name) >= LVML_BIND_NAME_MAX) {
+        return NULL;
+    }
+
+    uint32_t hash = lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, name, strlen(name));
+    lvml_bind_entry_t* entry = bind_find(name, hash);
+    if (entry != NULL) {
+        return &entry->subject;
+    }
+    if (!create) {
+        return NULL;
+    }
+
+    entry = (lvml_bind_entry_t*)lv_malloc(sizeof(lvml_bind_entry_t));
+    if (entry == NULL) {
+        return NULL;
+    }
+    memset(entry, 0, sizeof(lvml_bind_entry_t));
+    strcpy(entry->name, name);
+    entry->type = type;
+
+    if (type == LVML_BIND_STRING) {
+        lv_subject_init_string(&entry->subject, entry->buf, entry->prev_buf, LVML_BIND_STRING_SIZE, "");
+    } else {
+        lv_subject_init_int(&entry->subject, 0);
+    }
+
+    // Global scope so any component can bind to it by name
+    lv_xml_register_subject(NULL, entry->name, &entry->subject);
+
+    lvml_bind_entry_t** bucket = &bind_buckets[hash % LVML_BIND_BUCKETS];
+    entry->next = *bucket;
+    *bucket = entry;
+    bind_stats.subjects++;
+
+    return &entry->subject;
+}
+
+lvml_bind_type_t lvml_bind_get_type(const lv_subject_t* subject) {
+    const lvml_bind_entry_t* entry = (const lvml_bind_entry_t*)((const char*)subject - offsetof(lvml_bind_entry_t, subject));
+    return entry->type;
+}
+
+lvml_error_t lvml_bind_prepare_xml(const char* xml_content) {
+    if (xml_content == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    bool ok = true;
+    lvml_xml_scan_attrs(xml_content, bind_scan_cb, &ok);
+
+    return ok ? LVML_OK : LVML_ERROR_MEMORY;
+}
+
+void lvml_bind_begin(void) {
+    if (batch_depth++ > 0) {
+        return;
+    }
+
+    batch_changed_cnt = 0;
+    batch_overflow = false;
+
+    lv_display_t* disp = lv_display_get_default();
+    if (disp != NULL) {
+        batch_prev_invalidation = lv_display_is_invalidation_enabled(disp);
+        lv_display_enable_invalidation(disp, false);
+    }
+}
+
+bool lvml_bind_set_int(lv_subject_t* subject, int32_t value) {
+    if (subject == NULL) {
+        return false;
+    }
+
+    if (lv_subject_get_int(subject) == value) {
+        bind_stats.skipped++;
+        return false;
+    }
+
+    lv_subject_set_int(subject, value);
+    bind_mark_changed(subject);
+    bind_stats.updates++;
+    return true;
+}
+
+bool lvml_bind_set_string(lv_subject_t* subject, const char* value) {
+    if (subject == NULL || value == NULL) {
+        return false;
+    }
+
+    // Compare against what the subject would hold after truncation
+    const char* current = lv_subject_get_string(subject);
+    size_t len = strlen(value);
+    if (len > LVML_BIND_STRING_SIZE - 1) {
+        len = LVML_BIND_STRING_SIZE - 1;
+    }
+    if (current != NULL && strncmp(current, value, len) == 0 && current[len] == '\0') {
+        bind_stats.skipped++;
+        return false;
+    }
+
+    lv_subject_copy_string(subject, value);
+    bind_mark_changed(subject);
+    bind_stats.updates++;
+    return true;
+}
+
+void lvml_bind_end(void) {
+    if (batch_depth == 0 || --batch_depth > 0) {
+        return;
+    }
+
+    lv_display_t* disp = lv_display_get_default();
+    if (disp != NULL) {
+        lv_display_enable_invalidation(disp, batch_prev_invalidation);
+    }
+
+    // Observers already updated their objects while invalidation was off;
+    // invalidate each bound object once so the next refresh redraws it.
+    if (batch_overflow) {
+        lv_obj_invalidate(lv_screen_active());
+        bind_stats.invalidations++;
+    } else {
+        for (uint32_t i = 0; i < batch_changed_cnt; i++) {
+            bind_invalidate_observers(batch_changed[i]);
+        }
+    }
+
+    batch_changed_cnt = 0;
+    batch_overflow = false;
+    bind_stats.batches++;
+}
+
+void lvml_bind_get_stats(lvml_bind_stats_t* stats) {
+    if (stats != NULL) {
+        *stats = bind_stats;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lvml_bind_entry_t* bind_find(const char* name, uint32_t hash) {
+    for (lvml_bind_entry_t* entry = bind_buckets[hash % LVML_BIND_BUCKETS]; entry != NULL; entry = entry->next) {
+        if (strcmp(entry->name, name) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * bind_text="name" binds a label's text, which works best with string
+ * subjects. Every other binding (bind_value, bind_checked and the
+ * <...-bind_flag_if_*> / <...-bind_state_if_*> elements using subject="name")
+ * compares numbers and needs an integer subject.
+ */
+static bool bind_scan_cb(lvml_xml_str_t tag, lvml_xml_str_t name, lvml_xml_str_t value, void* user_data) {
+    (void)tag;
+    bool* ok = (bool*)user_data;
+    lvml_bind_type_t type;
+
+    if (lvml_xml_str_eq(name, "bind_text")) {
+        type = LVML_BIND_STRING;
+    } else if (lvml_xml_str_starts_with(name, "bind_")) {
+        type = LVML_BIND_INT;
+    } else if (lvml_xml_str_eq(name, "subject")) {
+        type = LVML_BIND_INT;
+    } else {
+        return true;
+    }
+
+    char subject_name[LVML_BIND_NAME_MAX];
+    if (!lvml_xml_str_copy(value, subject_name, sizeof(subject_name))) {
+        mp_printf(&mp_plat_print, "[LVML] Subject name too long: %.*s\n", (int)value.len, value.ptr);
+        return true;
+    }
+
+    if (lvml_bind_get_subject(subject_name, type, true) == NULL) {
+        *ok = false;
+        return false;
+    }
+    return true;
+}
+
+static void bind_mark_changed(lv_subject_t* subject) {
+    if (batch_depth == 0) {
+        // Outside a batch the observers invalidated their objects themselves
+        return;
+    }
+    for (uint32_t i = 0; i < batch_changed_cnt; i++) {
+        if (batch_changed[i] == subject) {
+            return;
+        }
+    }
+    if (batch_changed_cnt < LVML_BIND_BATCH_MAX) {
+        batch_changed[batch_changed_cnt++] = subject;
+    } else {
+        batch_overflow = true;
+    }
+}
+
+static void bind_invalidate_observers(lv_subject_t* subject) {
+    lv_observer_t* observer = (lv_observer_t*)lv_ll_get_head(&subject->subs_ll);
+    while (observer != NULL) {
+        lv_obj_t* obj = lv_observer_get_target_obj(observer);
+        if (obj != NULL) {
+            lv_obj_invalidate(obj);
+            bind_stats.invalidations++;
+        }
+        observer = (lv_observer_t*)lv_ll_get_next(&subject->subs_ll, observer);
+    }
+}
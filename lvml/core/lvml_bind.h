@@ -0,0 +1,119 @@
+/**
+ * @file lvml_bind.h
+ * @brief Named LVGL subjects for XML data binding with batched updates
+ *
+ * XML attributes such as bind_text="temp" refer to subjects by name. LVML
+ * owns those subjects, registers them with the XML loader and updates them
+ * in batches: every value of a batch is applied with invalidation suspended
+ * and each bound object is invalidated once at the end.
+ */
+
+#ifndef LVML_BIND_H
+#define LVML_BIND_H
+
+#include "lvgl/lvgl.h"
+#include "lvml_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_BIND_NAME_MAX 32
+#define LVML_BIND_STRING_SIZE 64
+#define LVML_BIND_BUCKETS 32
+#define LVML_BIND_BATCH_MAX 64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Value type of a bound subject
+ */
+typedef enum {
+    LVML_BIND_INT = 0,
+    LVML_BIND_STRING
+} lvml_bind_type_t;
+
+/**
+ * Binding statistics
+ */
+typedef struct {
+    uint32_t subjects;            // Number of named subjects
+    uint32_t batches;             // Number of completed batches
+    uint32_t updates;             // Values that changed and notified observers
+    uint32_t skipped;             // Values that were equal to the current value
+    uint32_t invalidations;       // Objects invalidated at the end of batches
+} lvml_bind_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Find a named subject, optionally creating and registering it with the XML loader
+ * @param name subject name
+ * @param type value type used if the subject has to be created
+ * @param create create the subject if it does not exist
+ * @return subject or NULL if not found / out of memory
+ */
+lv_subject_t* lvml_bind_get_subject(const char* name, lvml_bind_type_t type, bool create);
+
+/**
+ * Get the value type of a subject created by LVML
+ * @param subject subject returned by lvml_bind_get_subject()
+ * @return value type
+ */
+lvml_bind_type_t lvml_bind_get_type(const lv_subject_t* subject);
+
+/**
+ * Create subjects for every bind_* reference in an XML document so they
+ * exist before the document is instantiated
+ * @param xml_content XML content string
+ * @return LVML_OK on success, error code on failure
+ */
+lvml_error_t lvml_bind_prepare_xml(const char* xml_content);
+
+/**
+ * Start a batch: invalidation of the default display is suspended until
+ * lvml_bind_end() is called
+ */
+void lvml_bind_begin(void);
+
+/**
+ * Set an integer subject inside a batch
+ * @param subject target subject
+ * @param value new value
+ * @return true if the value changed
+ */
+bool lvml_bind_set_int(lv_subject_t* subject, int32_t value);
+
+/**
+ * Set a string subject inside a batch
+ * @param subject target subject
+ * @param value new value (truncated to LVML_BIND_STRING_SIZE - 1 bytes)
+ * @return true if the value changed
+ */
+bool lvml_bind_set_string(lv_subject_t* subject, const char* value);
+
+/**
+ * Finish a batch: restore invalidation and invalidate every object bound to
+ * a subject that changed, once
+ */
+void lvml_bind_end(void);
+
+/**
+ * Get binding statistics
+ * @param stats output statistics
+ */
+void lvml_bind_get_stats(lvml_bind_stats_t* stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_BIND_H*/
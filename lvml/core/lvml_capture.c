@@ -0,0 +1,161 @@
+/**
+ * @file lvml_capture.c
+ * @brief Screenshots read back from the display's render bands
+ */
+
+#include "lvml_capture.h"
+#include "utils/lvml_time.h"
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_display_t* disp;
+    lv_area_t area;
+    lvml_capture_format_t format;
+    lvml_qoi_write_cb_t write;
+    void* user_data;
+    lvml_qoi_encoder_t qoi;
+    lvml_splash_encoder_t splash;
+    int32_t next_row;       // Next row of the area expected from a band
+    uint32_t bytes;
+    uint32_t bands;
+    bool failed;            // Write failed
+    bool out_of_order;      // A band didn't continue where the last one ended
+} capture_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void capture_flush_cb(lv_event_t* e);
+static void capture_row(capture_ctx_t* ctx, const uint16_t* pixels, int32_t count);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_capture(const lv_area_t* area, lvml_capture_format_t format,
+                          lvml_qoi_write_cb_t write, void* user_data, lvml_capture_info_t* info) {
+    lv_display_t* disp = lv_display_get_default();
+    if (disp == NULL) {
+        return LVML_ERROR_INIT;
+    }
+    if (write == NULL || lv_display_get_color_format(disp) != LV_COLOR_FORMAT_RGB565) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    lv_area_t screen = {
+        .x1 = 0,
+        .y1 = 0,
+        .x2 = lv_display_get_horizontal_resolution(disp) - 1,
+        .y2 = lv_display_get_vertical_resolution(disp) - 1,
+    };
+    capture_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    if (area == NULL) {
+        ctx.area = screen;
+    } else if (!lv_area_intersect(&ctx.area, area, &screen)) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    ctx.disp = disp;
+    ctx.format = format;
+    ctx.write = write;
+    ctx.user_data = user_data;
+    ctx.next_row = ctx.area.y1;
+
+    int64_t start_us = lvml_time_us();
+    int32_t width = lv_area_get_width(&ctx.area);
+    int32_t height = lv_area_get_height(&ctx.area);
+    if (format == LVML_CAPTURE_QOI && !lvml_qoi_begin(&ctx.qoi, width, height, write, user_data)) {
+        return LVML_ERROR_MEMORY;
+    }
+    if (format == LVML_CAPTURE_SPLASH &&
+        !lvml_splash_begin(&ctx.splash, (uint16_t)width, (uint16_t)height, write, user_data)) {
+        return LVML_ERROR_MEMORY;
+    }
+
+    // Flush what is already dirty, so the capture area is rendered on its own, top to bottom
+    lv_refr_now(disp);
+    lv_display_add_event_cb(disp, capture_flush_cb, LV_EVENT_FLUSH_START, &ctx);
+    lv_inv_area(disp, &ctx.area);
+    lv_refr_now(disp);
+    lv_display_remove_event_cb_with_user_data(disp, capture_flush_cb, &ctx);
+
+    if (format == LVML_CAPTURE_QOI && !ctx.failed) {
+        ctx.failed = !lvml_qoi_end(&ctx.qoi);
+        ctx.bytes = ctx.qoi.bytes;
+    }
+    if (format == LVML_CAPTURE_SPLASH && !ctx.failed) {
+        ctx.failed = !lvml_splash_end(&ctx.splash);
+        ctx.bytes = ctx.splash.bytes;
+    }
+
+    if (info != NULL) {
+        info->width = width;
+        info->height = height;
+        info->bytes = ctx.bytes;
+        info->bands = ctx.bands;
+        info->time_us = (uint32_t)(lvml_time_us() - start_us);
+    }
+    if (ctx.failed) {
+        return LVML_ERROR_MEMORY;
+    }
+    if (ctx.out_of_order || ctx.next_row != ctx.area.y2 + 1) {
+        return LVML_ERROR_INIT;
+    }
+    return LVML_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * A band is about to be sent to the panel: copy out the rows inside the capture area
+ */
+static void capture_flush_cb(lv_event_t* e) {
+    capture_ctx_t* ctx = (capture_ctx_t*)lv_event_get_user_data(e);
+    const lv_area_t* band = (const lv_area_t*)lv_event_get_param(e);
+    lv_draw_buf_t* buf = lv_display_get_buf_active(ctx->disp);
+    if (band == NULL || buf == NULL || ctx->failed || ctx->out_of_order) {
+        return;
+    }
+
+    lv_area_t rows;
+    if (!lv_area_intersect(&rows, band, &ctx->area)) {
+        return;
+    }
+    if (band->x1 > ctx->area.x1 || band->x2 < ctx->area.x2 || rows.y1 != ctx->next_row) {
+        ctx->out_of_order = true;
+        return;
+    }
+
+    uint32_t stride = buf->header.stride;
+    const uint8_t* first = buf->data + (size_t)(rows.y1 - band->y1) * stride +
+                           (size_t)(ctx->area.x1 - band->x1) * sizeof(uint16_t);
+    for (int32_t y = rows.y1; y <= rows.y2 && !ctx->failed; y++) {
+        capture_row(ctx, (const uint16_t*)(first + (size_t)(y - rows.y1) * stride), lv_area_get_width(&ctx->area));
+    }
+    ctx->next_row = rows.y2 + 1;
+    ctx->bands++;
+}
+
+static void capture_row(capture_ctx_t* ctx, const uint16_t* pixels, int32_t count) {
+    if (ctx->format == LVML_CAPTURE_QOI) {
+        lvml_qoi_push_rgb565(&ctx->qoi, pixels, count);
+        ctx->failed = ctx->qoi.failed;
+        return;
+    }
+    if (ctx->format == LVML_CAPTURE_SPLASH) {
+        lvml_splash_push_rgb565(&ctx->splash, pixels, count);
+        ctx->failed = ctx->splash.failed;
+        return;
+    }
+
+    size_t len = (size_t)count * sizeof(uint16_t);
+    ctx->failed = !ctx->write((const uint8_t*)pixels, len, ctx->user_data);
+    ctx->bytes += len;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file lvml_capture.h
+ * @brief Screenshots read back from the display's render bands
+ *
+ * A capture invalidates the requested area and refreshes the display right
+ * away. The rendered bands are tapped as they are flushed (LV_EVENT_FLUSH_START)
+ * and streamed out row by row, as raw RGB565, QOI or an RLE splash that
+ * lvml_core_show_splash() can show at the next boot, so no full frame is ever
+ * allocated. Only LVGL is used, so captures work the same on a host build.
+ */
+
+#ifndef LVML_CAPTURE_H
+#define LVML_CAPTURE_H
+
+#include "lvgl/lvgl.h"
+#include "utils/lvml_common.h"
+#include "utils/lvml_qoi.h"
+#include "utils/lvml_splash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LVML_CAPTURE_RGB565 = 0,    // Raw pixels, native byte order, row by row
+    LVML_CAPTURE_QOI,
+    LVML_CAPTURE_SPLASH,        // utils/lvml_splash.h, RLE
+} lvml_capture_format_t;
+
+/**
+ * What a capture produced
+ */
+typedef struct {
+    int32_t width;
+    int32_t height;
+    uint32_t bytes;         // Bytes passed to the write callback
+    uint32_t bands;         // Flushed bands that contributed rows
+    uint32_t time_us;       // Render and encode time
+} lvml_capture_info_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Capture an area of the default display
+ * @param area area in display coordinates, NULL for the whole display;
+ *             clipped to the display
+ * @param format output format
+ * @param write receives the output in order; return false to abort
+ * @param user_data user pointer for write
+ * @param info receives the result (may be NULL)
+ * @return LVML_OK on success, LVML_ERROR_INVALID_PARAM if the area is empty,
+ *         LVML_ERROR_MEMORY if write failed, LVML_ERROR_INIT if the
+ *         display didn't render the whole area
+ */
+lvml_error_t lvml_capture(const lv_area_t* area, lvml_capture_format_t format,
+                          lvml_qoi_write_cb_t write, void* user_data, lvml_capture_info_t* info);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_CAPTURE_H*/
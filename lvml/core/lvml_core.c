@@ -4,6 +4,10 @@
  */
 
 #include "lvml_core.h"
+#include "lvml_input.h"
+#include "lvml_replay.h"
+#include "utils/lvml_boot.h"
+#include "utils/lvml_log.h"
 #include "micropython/py/mphal.h"
 #include "lvgl/src/tick/lv_tick.h"
 #include "esp_heap_caps.h"
@@ -13,13 +17,16 @@
 #include "mphalport.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include <string.h>
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static void core_attach_touch(lv_display_t* disp);
 static void custom_delay_ms(uint32_t ms);
 static void lvml_log_callback(lv_log_level_t level, const char * buf);
+static void lvml_invalidate_cb(lv_event_t* e);
 
 /**********************
  *  STATIC VARIABLES
@@ -28,18 +35,25 @@ static void lvml_log_callback(lv_log_level_t level, const char * buf);
 static bool lvml_initialized = false;
 static lv_color_t *display_buf1 = NULL;
 static lv_color_t *display_buf2 = NULL;
+static lvml_refresh_stats_t refresh_stats;
+static bool first_frame_marked = false;
+static bool touch_pending = false;      // Touch is initializing in the background
+static bool touch_ready = false;        // Touch input device is attached
 
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
-lvml_error_t lvml_core_init(void) {
+lvml_error_t lvml_core_init(bool async_touch) {
     if (lvml_initialized) {
         return LVML_OK;
     }
     
+    lvml_boot_mark("lvml_init_start");
+    
     // Initialize LVGL
     lv_init();
+    lvml_boot_mark("lv_init");
 
     lv_log_register_print_cb(lvml_log_callback);
     
@@ -49,9 +63,10 @@ lvml_error_t lvml_core_init(void) {
     // Initialize ESP-IDF LCD driver for ESP32-S3-Box-3
     esp_err_t ret = esp32_s3_box3_lcd_init();
     if (ret != ESP_OK) {
-        mp_printf(&mp_plat_print, "[LVML] LCD initialization failed\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "LCD initialization failed");
         return LVML_ERROR_INIT;
     }
+    lvml_boot_mark("lcd_init");
     
     // Check PSRAM availability
     size_t psram_size = heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
@@ -62,7 +77,7 @@ lvml_error_t lvml_core_init(void) {
     size_t buffer_size = 320 * BUF_ROWS * sizeof(lv_color_t);
 
     if (psram_size == 0) {
-        mp_printf(&mp_plat_print, "[LVML] PSRAM not available\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "PSRAM not available");
         esp32_s3_box3_lcd_deinit();
         return LVML_ERROR_MEMORY;
     }
@@ -77,15 +92,16 @@ lvml_error_t lvml_core_init(void) {
         if (display_buf2) heap_caps_free(display_buf2);
         display_buf1 = NULL;
         display_buf2 = NULL;
-        mp_printf(&mp_plat_print, "[LVML] Failed to allocate display buffers\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "Failed to allocate display buffers");
         esp32_s3_box3_lcd_deinit();
         return LVML_ERROR_MEMORY;
     }
+    lvml_boot_mark("display_buffers");
     
     // Create ESP-IDF LCD display
     lv_display_t *disp = esp32_s3_box3_lcd_create_display(320, 240);
     if (disp == NULL) {
-        mp_printf(&mp_plat_print, "[LVML] LCD display creation failed\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "LCD display creation failed");
         heap_caps_free(display_buf1);
         heap_caps_free(display_buf2);
         display_buf1 = NULL;
@@ -100,29 +116,43 @@ lvml_error_t lvml_core_init(void) {
     // Due to unknown reason in refr_timer, we need to call lv_display_refr_timer in our tick handler manually.
     lv_display_delete_refr_timer(disp);
     
+    // Count what gets invalidated to measure repaint cost
+    lv_display_add_event_cb(disp, lvml_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    
     // Set black background before turning on screen
     lv_obj_set_style_bg_color(lv_screen_active(), lv_color_hex(0x000000), LV_PART_MAIN);
     lv_obj_set_style_bg_opa(lv_screen_active(), LV_OPA_COVER, LV_PART_MAIN);
     
-    // Force a refresh to show black background
-    lv_display_refr_timer(NULL);
-    
-    // Turn on screen after setting black background
-    esp32_s3_box3_lcd_screen_on();
+    // An early splash is already on screen; it stays until the first frame
+    if (!esp32_s3_box3_lcd_splash_shown()) {
+        // Force a refresh to show black background
+        lv_display_refr_timer(NULL);
+        
+        // Turn on screen after setting black background
+        esp32_s3_box3_lcd_screen_on();
+        lvml_boot_mark("first_pixel");
+    }
     
-    mp_printf(&mp_plat_print, "[LVML] Initializing touch controller\n");
-    // Initialize touch controller
-    esp_err_t touch_ret = esp32_s3_box3_touch_init();
-    if (touch_ret != ESP_OK) {
-        mp_printf(&mp_plat_print, "[LVML] Touch initialization failed\n");
-        // Continue without touch - display will still work
+    LVML_LOG_INFO(LVML_LOG_MOD_CORE, "Initializing touch controller");
+    touch_ready = false;
+    if (async_touch) {
+        // The GT911 reset delays run on their own task; lvml_core_touch_ready()
+        // attaches the input device once it is done
+        touch_pending = esp32_s3_box3_touch_init_async() == ESP_OK;
+        if (!touch_pending) {
+            LVML_LOG_WARN(LVML_LOG_MOD_CORE, "Touch initialization failed");
+        }
     } else {
-        // Create touch input device
-        lv_indev_t *touch_indev = esp32_s3_box3_touch_create_indev();
-        if (touch_indev != NULL) {
-            lv_indev_set_display(touch_indev, disp);
-            mp_printf(&mp_plat_print, "[LVML] Touch input device initialized\n");
+        // Initialize touch controller
+        esp_err_t touch_ret = esp32_s3_box3_touch_init();
+        if (touch_ret != ESP_OK) {
+            LVML_LOG_WARN(LVML_LOG_MOD_CORE, "Touch initialization failed");
+            // Continue without touch - display will still work
+        } else {
+            core_attach_touch(disp);
         }
+        
+        lvml_boot_mark("touch_init");
     }
     
     lvml_initialized = true;
@@ -130,6 +160,50 @@ lvml_error_t lvml_core_init(void) {
     return LVML_OK;
 }
 
+lvml_error_t lvml_core_show_splash(const uint8_t* data, size_t len) {
+    if (lvml_initialized) {
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "Splash must be shown before init");
+        return LVML_ERROR_INIT;
+    }
+    
+    esp_err_t ret = esp32_s3_box3_lcd_show_splash(data, len);
+    if (ret == ESP_ERR_INVALID_ARG) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    if (ret == ESP_ERR_NO_MEM) {
+        return LVML_ERROR_MEMORY;
+    }
+    if (!esp32_s3_box3_lcd_splash_shown()) {
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "LCD initialization failed");
+        return LVML_ERROR_INIT;
+    }
+    lvml_boot_mark("splash");
+    
+    // Corrupt pixel data: the panel shows what could be expanded
+    if (ret != ESP_OK) {
+        LVML_LOG_WARN(LVML_LOG_MOD_CORE, "Splash data is truncated");
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    return LVML_OK;
+}
+
+lvml_ready_t lvml_core_touch_ready(void) {
+    if (touch_pending) {
+        esp_err_t status = esp32_s3_box3_touch_init_status();
+        if (status == ESP_ERR_NOT_FINISHED) {
+            return LVML_READY_PENDING;
+        }
+        touch_pending = false;
+        if (status == ESP_OK) {
+            core_attach_touch(lv_display_get_default());
+        } else {
+            LVML_LOG_WARN(LVML_LOG_MOD_CORE, "Touch initialization failed");
+        }
+        lvml_boot_mark("touch_init");
+    }
+    return touch_ready ? LVML_READY_DONE : LVML_READY_FAILED;
+}
+
 bool lvml_core_is_initialized(void) {
     return lvml_initialized;
 }
@@ -178,13 +252,13 @@ lvml_error_t lvml_core_print_memory_info(void) {
 
 lvml_error_t lvml_core_set_rotation(int rotation) {
     if (!lvml_initialized) {
-        mp_printf(&mp_plat_print, "[LVML] Core system not initialized\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "Core system not initialized");
         return LVML_ERROR_INIT;
     }
     
     // Validate rotation value (0, 1, 2, 3 for 0°, 90°, 180°, 270°)
     if (rotation < 0 || rotation > 3) {
-        mp_printf(&mp_plat_print, "[LVML] Invalid rotation value: %d\n", rotation);
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "Invalid rotation value: %d", rotation);
         return LVML_ERROR_INVALID_PARAM;
     }
     
@@ -200,11 +274,14 @@ lvml_error_t lvml_core_set_rotation(int rotation) {
     
     esp_err_t ret = esp32_s3_box3_lcd_set_rotation(lv_rotation);
     if (ret != ESP_OK) {
-        mp_printf(&mp_plat_print, "[LVML] Failed to set display rotation\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "Failed to set display rotation");
         return LVML_ERROR_INVALID_PARAM;
     }
     
-    mp_printf(&mp_plat_print, "[LVML] Display rotation set to %d degrees\n", rotation * 90);
+    // The panel boots in rotation 3, which is what the touch mapping matches
+    esp32_s3_box3_touch_set_rotation((rotation + 1) & 3);
+    
+    LVML_LOG_INFO(LVML_LOG_MOD_CORE, "Display rotation set to %d degrees", rotation * 90);
     
     return LVML_OK;
 }
@@ -224,8 +301,14 @@ lvml_error_t lvml_core_deinit(void) {
         display_buf2 = NULL;
     }
     
-    // Deinitialize touch driver
+    // Give the input back to the touch device before it goes away
+    lvml_replay_stop();
+    lvml_replay_record_stop(NULL);
+
+    // Deinitialize touch driver; waits for a background init to finish
     esp32_s3_box3_touch_deinit();
+    touch_pending = false;
+    touch_ready = false;
     
     // Deinitialize ESP-IDF LCD driver
     esp32_s3_box3_lcd_deinit();
@@ -240,12 +323,31 @@ lvml_error_t lvml_core_tick(void) {
         return LVML_ERROR_INIT;
     }
     
+    // Attach touch once its background init is done
+    if (touch_pending) {
+        lvml_core_touch_ready();
+    }
+    
     // Process LVGL tick and timer handler
     lv_tick_inc(1);
 
     lv_timer_handler();
 
+    // Gestures recognized by the touch sampling task since the last tick;
+    // while a replay owns the input, real touches are dropped
+    lvml_gesture_event_t gesture;
+    while (esp32_s3_box3_touch_pop_gesture(&gesture)) {
+        if (!lvml_replay_is_playing()) {
+            lvml_input_send_gesture(&gesture);
+        }
+    }
+    lvml_replay_tick();
+
     lv_display_refr_timer(NULL);
+    if (!first_frame_marked) {
+        lvml_boot_mark("first_frame");
+        first_frame_marked = true;
+    }
 
     return LVML_OK;
 }
@@ -267,6 +369,15 @@ lvml_error_t lvml_core_print_refresh_info(void) {
     return LVML_OK;
 }
 
+void lvml_core_get_refresh_stats(lvml_refresh_stats_t* stats, bool reset) {
+    if (stats != NULL) {
+        *stats = refresh_stats;
+    }
+    if (reset) {
+        memset(&refresh_stats, 0, sizeof(refresh_stats));
+    }
+}
+
 lvml_error_t lvml_core_screen_on(void) {
     if (!lvml_initialized) {
         return LVML_ERROR_INIT;
@@ -289,6 +400,24 @@ lvml_error_t lvml_core_screen_off(void) {
  *   STATIC FUNCTIONS
  **********************/
 
+static void core_attach_touch(lv_display_t* disp) {
+    // Create touch input device
+    lv_indev_t *touch_indev = esp32_s3_box3_touch_create_indev();
+    if (touch_indev != NULL) {
+        lv_indev_set_display(touch_indev, disp);
+        touch_ready = true;
+        LVML_LOG_INFO(LVML_LOG_MOD_CORE, "Touch input device initialized");
+    }
+}
+
+
+static void lvml_invalidate_cb(lv_event_t* e) {
+    const lv_area_t* area = (const lv_area_t*)lv_event_get_param(e);
+    if (area != NULL) {
+        refresh_stats.invalidations++;
+        refresh_stats.invalidated_px += lv_area_get_size(area);
+    }
+}
 
 /**
  * Custom delay function that uses MicroPython's delay instead of LVGL's tick-based delay
@@ -298,15 +427,20 @@ static void custom_delay_ms(uint32_t ms) {
     mp_hal_delay_ms(ms);
 }
 
+/**
+ * LVGL may log from inside rendering, so its lines are only copied into the
+ * log ring here and printed when the ring is drained
+ */
 static void lvml_log_callback(lv_log_level_t level, const char * buf) {
-    const char* level_str;
+    uint8_t log_level;
     switch(level) {
-        case LV_LOG_LEVEL_TRACE: level_str = "TRACE"; break;  // Most detailed
-        case LV_LOG_LEVEL_INFO:  level_str = "INFO";  break;  // Important events
-        case LV_LOG_LEVEL_WARN:  level_str = "WARN";  break;  // Something wrong but not critical
-        case LV_LOG_LEVEL_ERROR: level_str = "ERROR"; break;  // Critical problems
-        case LV_LOG_LEVEL_USER:  level_str = "USER";  break;  // Your custom messages
-        default: level_str = "UNKNOWN"; break;
-    }
-    mp_printf(&mp_plat_print, "[LVGL-%s] %s", level_str, buf);
+        case LV_LOG_LEVEL_TRACE: log_level = LVML_LOG_LEVEL_TRACE; break;
+        case LV_LOG_LEVEL_INFO:  log_level = LVML_LOG_LEVEL_INFO;  break;
+        case LV_LOG_LEVEL_WARN:  log_level = LVML_LOG_LEVEL_WARN;  break;
+        case LV_LOG_LEVEL_ERROR: log_level = LVML_LOG_LEVEL_ERROR; break;
+        default:                 log_level = LVML_LOG_LEVEL_INFO;  break;  // LV_LOG_LEVEL_USER
+    }
+    if (lvml_log_enabled(LVML_LOG_MOD_LVGL, log_level)) {
+        lvml_log_text(LVML_LOG_MOD_LVGL, log_level, buf, strlen(buf));
+    }
 }
\ No newline at end of file
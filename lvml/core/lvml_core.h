@@ -8,6 +8,7 @@
 
 #include "micropython/py/runtime.h"
 #include "lvgl/lvgl.h"
+#include "utils/lvml_common.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,8 +19,6 @@ extern "C" {
  *********************/
 
 #define LVML_VERSION "1.0.0"
-#define LVML_MAX_URL_LENGTH 512
-#define LVML_MAX_XML_SIZE (1024 * 1024) // 1MB max XML size
 
 /**********************
  *      TYPEDEFS
@@ -37,17 +36,21 @@ typedef struct {
 } lvml_ui_t;
 
 /**
- * LVML error codes
+ * Display invalidation statistics, a measure of how much gets repainted
+ */
+typedef struct {
+    uint32_t invalidations;       // Areas marked for redraw
+    uint64_t invalidated_px;      // Sum of their sizes in pixels
+} lvml_refresh_stats_t;
+
+/**
+ * State of a part initialized in the background
  */
 typedef enum {
-    LVML_OK = 0,
-    LVML_ERROR_INIT = -1,
-    LVML_ERROR_MEMORY = -2,
-    LVML_ERROR_NETWORK = -3,
-    LVML_ERROR_XML_PARSE = -4,
-    LVML_ERROR_MP_EXEC = -5,
-    LVML_ERROR_INVALID_PARAM = -6
-} lvml_error_t;
+    LVML_READY_PENDING = 0,
+    LVML_READY_DONE,
+    LVML_READY_FAILED,
+} lvml_ready_t;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -55,9 +58,30 @@ typedef enum {
 
 /**
  * Initialize LVML core system
+ * @param async_touch initialize the touch controller on a background task and
+ *        return once the display is usable; see lvml_core_touch_ready()
  * @return LVML_OK on success, error code on failure
  */
-lvml_error_t lvml_core_init(void);
+lvml_error_t lvml_core_init(bool async_touch);
+
+/**
+ * Check whether touch input is up, attaching the input device if its
+ * background initialization just finished; call from the LVGL thread
+ * (lvml_core_tick() does it too)
+ * @return LVML_READY_PENDING while initializing, LVML_READY_DONE once touch
+ *         works, LVML_READY_FAILED if it failed or LVML isn't initialized
+ */
+lvml_ready_t lvml_core_touch_ready(void);
+
+/**
+ * Show a splash before lvml_core_init(), without LVGL; the splash stays on
+ * the panel until LVGL's first frame draws over it
+ * @param data splash from scripts/make_splash.py (see utils/lvml_splash.h)
+ * @param len number of bytes
+ * @return LVML_OK on success, LVML_ERROR_INIT if LVML is already running,
+ *         LVML_ERROR_INVALID_PARAM if data isn't a splash that fits the panel
+ */
+lvml_error_t lvml_core_show_splash(const uint8_t* data, size_t len);
 
 // Unified initializer performs full display and memory setup
 // (previously lvml_core_init_with_display)
@@ -105,6 +129,13 @@ lvml_error_t lvml_core_tick(void);
  */
 lvml_error_t lvml_core_print_refresh_info(void);
 
+/**
+ * Get display invalidation statistics since init or the last reset
+ * @param stats output statistics
+ * @param reset clear the counters after reading them
+ */
+void lvml_core_get_refresh_stats(lvml_refresh_stats_t* stats, bool reset);
+
 /**
  * Turn screen on (enable backlight)
  * @return LVML_OK on success, error code on failure
@@ -0,0 +1,100 @@
+/**
+ * @file lvml_input.c
+ * @brief Delivery of recognized gestures to LVGL objects
+ */
+
+#include "lvml_input.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_obj_t* input_hit_test(lv_obj_t* obj, const lv_point_t* point);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lv_event_code_t input_codes[LVML_GESTURE_TYPE_COUNT];
+static lvml_gesture_event_t input_last[LVML_GESTURE_TYPE_COUNT];
+static bool input_seen[LVML_GESTURE_TYPE_COUNT];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_event_code_t lvml_input_gesture_code(uint8_t type) {
+    if (type >= LVML_GESTURE_TYPE_COUNT) {
+        return LV_EVENT_ALL;
+    }
+    if (input_codes[type] == 0) {
+        // Register all types together so their codes are consecutive
+        for (uint8_t i = 0; i < LVML_GESTURE_TYPE_COUNT; i++) {
+            input_codes[i] = (lv_event_code_t)lv_event_register_id();
+        }
+    }
+    return input_codes[type];
+}
+
+void lvml_input_send_gesture(const lvml_gesture_event_t* event) {
+    if (event->type >= LVML_GESTURE_TYPE_COUNT) {
+        return;
+    }
+    input_last[event->type] = *event;
+    input_seen[event->type] = true;
+
+    lv_point_t point = { event->x, event->y };
+    lv_obj_t* target = input_hit_test(lv_layer_top(), &point);
+    if (target == NULL || target == lv_layer_top()) {
+        target = input_hit_test(lv_screen_active(), &point);
+    }
+
+    lv_event_code_t code = lvml_input_gesture_code(event->type);
+    lv_obj_t* obj = target;
+    while (obj != NULL) {
+        // The parameter is only valid during the call
+        if (lv_obj_send_event(obj, code, (void*)&input_last[event->type]) != LV_RESULT_OK) {
+            break;  // Deleted by a handler
+        }
+        // LVGL already passed it on to the parents of objects that bubble events
+        while (obj != NULL && lv_obj_has_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE)) {
+            obj = lv_obj_get_parent(obj);
+        }
+        if (obj != NULL) {
+            obj = lv_obj_get_parent(obj);
+        }
+    }
+}
+
+const lvml_gesture_event_t* lvml_input_last_gesture(uint8_t type) {
+    if (type >= LVML_GESTURE_TYPE_COUNT || !input_seen[type]) {
+        return NULL;
+    }
+    return &input_last[type];
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Topmost visible object containing the point; unlike lv_indev_search_obj()
+ * it doesn't require CLICKABLE, so images and labels can receive gestures
+ */
+static lv_obj_t* input_hit_test(lv_obj_t* obj, const lv_point_t* point) {
+    if (obj == NULL || lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+        return NULL;
+    }
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    if (!lv_area_is_point_on(&coords, point, 0)) {
+        return NULL;
+    }
+    for (int32_t i = (int32_t)lv_obj_get_child_count(obj) - 1; i >= 0; i--) {
+        lv_obj_t* hit = input_hit_test(lv_obj_get_child(obj, i), point);
+        if (hit != NULL) {
+            return hit;
+        }
+    }
+    return obj;
+}
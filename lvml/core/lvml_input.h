@@ -0,0 +1,50 @@
+/**
+ * @file lvml_input.h
+ * @brief Delivery of recognized gestures to LVGL objects
+ *
+ * Each gesture type has its own LVGL event code, registered with
+ * lv_event_register_id() on first use. A gesture is sent to the topmost
+ * visible object under it (the centroid for two fingers) and then to each
+ * of its parents, with the lvml_gesture_event_t as the event parameter.
+ * The latest gesture of each type is kept for lvml.gesture().
+ */
+
+#ifndef LVML_INPUT_H
+#define LVML_INPUT_H
+
+#include "lvgl/lvgl.h"
+#include "utils/lvml_gesture.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * LVGL event code of a gesture type
+ * @param type lvml_gesture_type_t
+ * @return event code, registered on first use
+ */
+lv_event_code_t lvml_input_gesture_code(uint8_t type);
+
+/**
+ * Send a gesture to the objects under it
+ * @param event recognized gesture
+ */
+void lvml_input_send_gesture(const lvml_gesture_event_t* event);
+
+/**
+ * Latest gesture of a type
+ * @param type lvml_gesture_type_t
+ * @return the gesture, or NULL if there was none yet
+ */
+const lvml_gesture_event_t* lvml_input_last_gesture(uint8_t type);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_INPUT_H*/
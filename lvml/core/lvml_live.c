@@ -0,0 +1,480 @@
+/**
+ * @file lvml_live.c
+ * @brief Apply pushed updates to the live widget tree once per frame
+ */
+
+#include "lvml_live.h"
+#include "lvml_bind.h"
+#include "lvml_core.h"
+#include "lvml_state.h"
+#include "lvml_ui.h"
+#include "network/lvml_push.h"
+#include "utils/lvml_hash.h"
+#include "utils/lvml_snapshot.h"
+#include <stdio.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LIVE_CHANGED 1
+#define LIVE_UNCHANGED 0
+#define LIVE_FAILED (-1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_obj_t* obj;                  // NULL: empty
+    char name[LVML_PATCH_NAME_MAX];
+} live_cache_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool live_apply(const uint8_t* data, size_t len, void* user_data);
+static lv_obj_t* live_root(void);
+static lv_obj_t* live_find(const char* name, size_t len);
+static void live_cache_clear(void);
+static int live_cmd(const lvml_patch_cmd_t* cmd);
+static int live_set(lv_obj_t* obj, const lvml_patch_cmd_t* cmd);
+static int live_set_text(lv_obj_t* obj, const char* str, size_t len);
+static int live_set_value(lv_obj_t* obj, int32_t value);
+static int live_set_flag(lv_obj_t* obj, lv_obj_flag_t flag, bool on);
+static int live_set_state(lv_obj_t* obj, lv_state_t state, bool on);
+static int live_insert(const lvml_patch_cmd_t* cmd);
+static int live_remove(const lvml_patch_cmd_t* cmd);
+static int live_bind(const lvml_patch_cmd_t* cmd);
+static const char* live_cstr(const char* str, size_t len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lvml_live_stats_t live_stats;
+static live_cache_entry_t live_cache[LVML_LIVE_CACHE_SIZE];
+static bool live_batch = false;         // A binding batch was started for this poll
+static char* live_text = NULL;          // NUL-terminated copy of an update string
+static size_t live_text_size = 0;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lvml_live_poll(void) {
+    if (!lvml_core_is_initialized()) {
+        return 0;
+    }
+
+    // Objects may have been deleted since the last frame
+    live_cache_clear();
+    uint32_t applied = lvml_push_poll(live_apply, NULL, LVML_LIVE_BUDGET_US);
+    if (live_batch) {
+        live_batch = false;
+        lvml_bind_end();
+    }
+    return applied;
+}
+
+void lvml_live_get_stats(lvml_live_stats_t* stats, bool reset) {
+    if (stats != NULL) {
+        *stats = live_stats;
+    }
+    if (reset) {
+        memset(&live_stats, 0, sizeof(live_stats));
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Apply one update (a lvml_push_apply_cb_t); the first update of a poll
+ * starts the binding batch
+ * @return false if the update is corrupt
+ */
+static bool live_apply(const uint8_t* data, size_t len, void* user_data) {
+    (void)user_data;
+    if (!live_batch) {
+        live_batch = true;
+        lvml_bind_begin();
+    }
+
+    // The batch holds back invalidation for binding observers; objects
+    // changed directly invalidate their own areas as usual
+    lv_display_t* disp = lv_display_get_default();
+    lvml_patch_reader_t r;
+    lvml_patch_cmd_t cmd;
+    lvml_patch_open(&r, data, len);
+    while (lvml_patch_next(&r, &cmd)) {
+        bool object_cmd = cmd.op != LVML_PATCH_BIND_INT && cmd.op != LVML_PATCH_BIND_STRING;
+        if (object_cmd) {
+            lv_display_enable_invalidation(disp, true);
+        }
+        int result = live_cmd(&cmd);
+        if (object_cmd) {
+            lv_display_enable_invalidation(disp, false);
+        }
+
+        live_stats.cmds++;
+        if (result == LIVE_UNCHANGED) {
+            live_stats.unchanged++;
+        } else if (result == LIVE_FAILED) {
+            live_stats.failed++;
+        }
+    }
+    return !r.error;
+}
+
+static lv_obj_t* live_root(void) {
+    lv_obj_t* root = lvml_ui_get_xml_root();
+    return root != NULL ? root : lv_screen_active();
+}
+
+/**
+ * Find an object by name under the XML root; an empty name is the root
+ */
+static lv_obj_t* live_find(const char* name, size_t len) {
+    if (len == 0) {
+        return live_root();
+    }
+    char key[LVML_PATCH_NAME_MAX];
+    if (!lvml_patch_copy_name(key, name, len)) {
+        return NULL;
+    }
+
+    live_cache_entry_t* entry = &live_cache[lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, key, len) % LVML_LIVE_CACHE_SIZE];
+    if (entry->obj != NULL && strcmp(entry->name, key) == 0) {
+        return entry->obj;
+    }
+    live_stats.lookups++;
+    lv_obj_t* obj = lv_obj_find_by_name(live_root(), key);
+    if (obj != NULL) {
+        entry->obj = obj;
+        memcpy(entry->name, key, len + 1);
+    }
+    return obj;
+}
+
+static void live_cache_clear(void) {
+    memset(live_cache, 0, sizeof(live_cache));
+}
+
+static int live_cmd(const lvml_patch_cmd_t* cmd) {
+    switch (cmd->op) {
+        case LVML_PATCH_SET: {
+            live_stats.sets++;
+            lv_obj_t* obj = live_find(cmd->target, cmd->target_len);
+            return obj != NULL ? live_set(obj, cmd) : LIVE_FAILED;
+        }
+        case LVML_PATCH_INSERT:
+            live_stats.inserts++;
+            return live_insert(cmd);
+        case LVML_PATCH_REMOVE:
+            live_stats.removes++;
+            return live_remove(cmd);
+        default:
+            live_stats.binds++;
+            return live_bind(cmd);
+    }
+}
+
+static int live_set(lv_obj_t* obj, const lvml_patch_cmd_t* cmd) {
+    int32_t v = cmd->value;
+    switch (cmd->prop) {
+        case LVML_PATCH_PROP_TEXT:
+            return live_set_text(obj, cmd->str, cmd->str_len);
+        case LVML_PATCH_PROP_X:
+            if (lv_obj_get_style_x(obj, LV_PART_MAIN) == v) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_x(obj, v);
+            return LIVE_CHANGED;
+        case LVML_PATCH_PROP_Y:
+            if (lv_obj_get_style_y(obj, LV_PART_MAIN) == v) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_y(obj, v);
+            return LIVE_CHANGED;
+        case LVML_PATCH_PROP_WIDTH:
+            v = v < 0 ? LV_SIZE_CONTENT : v;
+            if (lv_obj_get_style_width(obj, LV_PART_MAIN) == v) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_width(obj, v);
+            return LIVE_CHANGED;
+        case LVML_PATCH_PROP_HEIGHT:
+            v = v < 0 ? LV_SIZE_CONTENT : v;
+            if (lv_obj_get_style_height(obj, LV_PART_MAIN) == v) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_height(obj, v);
+            return LIVE_CHANGED;
+        case LVML_PATCH_PROP_VALUE:
+            return live_set_value(obj, v);
+        case LVML_PATCH_PROP_HIDDEN:
+            return live_set_flag(obj, LV_OBJ_FLAG_HIDDEN, v != 0);
+        case LVML_PATCH_PROP_CHECKED:
+            return live_set_state(obj, LV_STATE_CHECKED, v != 0);
+        case LVML_PATCH_PROP_DISABLED:
+            return live_set_state(obj, LV_STATE_DISABLED, v != 0);
+        case LVML_PATCH_PROP_BG_COLOR: {
+            // Local styles override the shared (interned) one for this object only
+            lv_color_t color = lv_color_hex((uint32_t)v & 0xFFFFFF);
+            if (lv_color_eq(lv_obj_get_style_bg_color(obj, LV_PART_MAIN), color)) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_style_bg_color(obj, color, LV_PART_MAIN);
+            return LIVE_CHANGED;
+        }
+        case LVML_PATCH_PROP_BG_OPA: {
+            lv_opa_t opa = (lv_opa_t)LV_CLAMP(0, v, 255);
+            if (lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) == opa) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_style_bg_opa(obj, opa, LV_PART_MAIN);
+            return LIVE_CHANGED;
+        }
+        case LVML_PATCH_PROP_BORDER_COLOR: {
+            lv_color_t color = lv_color_hex((uint32_t)v & 0xFFFFFF);
+            if (lv_color_eq(lv_obj_get_style_border_color(obj, LV_PART_MAIN), color)) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_style_border_color(obj, color, LV_PART_MAIN);
+            return LIVE_CHANGED;
+        }
+        case LVML_PATCH_PROP_BORDER_WIDTH:
+            if (lv_obj_get_style_border_width(obj, LV_PART_MAIN) == v) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_style_border_width(obj, v, LV_PART_MAIN);
+            return LIVE_CHANGED;
+        case LVML_PATCH_PROP_TEXT_COLOR: {
+            lv_color_t color = lv_color_hex((uint32_t)v & 0xFFFFFF);
+            if (lv_color_eq(lv_obj_get_style_text_color(obj, LV_PART_MAIN), color)) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_style_text_color(obj, color, LV_PART_MAIN);
+            return LIVE_CHANGED;
+        }
+        case LVML_PATCH_PROP_RADIUS:
+            if (lv_obj_get_style_radius(obj, LV_PART_MAIN) == v) {
+                return LIVE_UNCHANGED;
+            }
+            lv_obj_set_style_radius(obj, v, LV_PART_MAIN);
+            return LIVE_CHANGED;
+        default:
+            return LIVE_FAILED;
+    }
+}
+
+/**
+ * Labels, text areas and checkboxes hold their own text; buttons hold it
+ * in a child label
+ */
+static int live_set_text(lv_obj_t* obj, const char* str, size_t len) {
+    lv_obj_t* target = obj;
+    if (!lv_obj_check_type(obj, &lv_label_class) && !lv_obj_check_type(obj, &lv_textarea_class) &&
+        !lv_obj_check_type(obj, &lv_checkbox_class)) {
+        target = lv_obj_get_child(obj, 0);
+        if (target == NULL || !lv_obj_check_type(target, &lv_label_class)) {
+            return LIVE_FAILED;
+        }
+    }
+
+    const char* current;
+    if (lv_obj_check_type(target, &lv_textarea_class)) {
+        current = lv_textarea_get_text(target);
+    } else if (lv_obj_check_type(target, &lv_checkbox_class)) {
+        current = lv_checkbox_get_text(target);
+    } else {
+        current = lv_label_get_text(target);
+    }
+    if (current != NULL && strlen(current) == len && (len == 0 || memcmp(current, str, len) == 0)) {
+        return LIVE_UNCHANGED;
+    }
+
+    const char* text = live_cstr(str, len);
+    if (text == NULL) {
+        return LIVE_FAILED;
+    }
+    if (lv_obj_check_type(target, &lv_textarea_class)) {
+        lv_textarea_set_text(target, text);
+    } else if (lv_obj_check_type(target, &lv_checkbox_class)) {
+        lv_checkbox_set_text(target, text);
+    } else {
+        lv_label_set_text(target, text);
+    }
+    return LIVE_CHANGED;
+}
+
+static int live_set_value(lv_obj_t* obj, int32_t value) {
+    if (lv_obj_check_type(obj, &lv_slider_class)) {
+        if (lv_slider_get_value(obj) == value) {
+            return LIVE_UNCHANGED;
+        }
+        lv_slider_set_value(obj, value, LV_ANIM_OFF);
+    } else if (lv_obj_check_type(obj, &lv_bar_class)) {
+        if (lv_bar_get_value(obj) == value) {
+            return LIVE_UNCHANGED;
+        }
+        lv_bar_set_value(obj, value, LV_ANIM_OFF);
+    } else if (lv_obj_check_type(obj, &lv_arc_class)) {
+        if (lv_arc_get_value(obj) == value) {
+            return LIVE_UNCHANGED;
+        }
+        lv_arc_set_value(obj, value);
+    } else if (lv_obj_check_type(obj, &lv_dropdown_class)) {
+        if (value < 0 || (uint32_t)value >= lv_dropdown_get_option_count(obj)) {
+            return LIVE_FAILED;
+        }
+        if (lv_dropdown_get_selected(obj) == (uint32_t)value) {
+            return LIVE_UNCHANGED;
+        }
+        lv_dropdown_set_selected(obj, (uint32_t)value);
+    } else if (lv_obj_check_type(obj, &lv_switch_class) || lv_obj_check_type(obj, &lv_checkbox_class)) {
+        return live_set_state(obj, LV_STATE_CHECKED, value != 0);
+    } else {
+        return LIVE_FAILED;
+    }
+    return LIVE_CHANGED;
+}
+
+static int live_set_flag(lv_obj_t* obj, lv_obj_flag_t flag, bool on) {
+    if (lv_obj_has_flag(obj, flag) == on) {
+        return LIVE_UNCHANGED;
+    }
+    if (on) {
+        lv_obj_add_flag(obj, flag);
+    } else {
+        lv_obj_remove_flag(obj, flag);
+    }
+    return LIVE_CHANGED;
+}
+
+static int live_set_state(lv_obj_t* obj, lv_state_t state, bool on) {
+    if (lv_obj_has_state(obj, state) == on) {
+        return LIVE_UNCHANGED;
+    }
+    if (on) {
+        lv_obj_add_state(obj, state);
+    } else {
+        lv_obj_remove_state(obj, state);
+    }
+    return LIVE_CHANGED;
+}
+
+/**
+ * Create an object the way a snapshot restore does; value widgets get a
+ * 0..100 range until the server sets a value
+ */
+static int live_insert(const lvml_patch_cmd_t* cmd) {
+    lv_obj_t* parent = live_find(cmd->target, cmd->target_len);
+    char name[LVML_PATCH_NAME_MAX];
+    if (parent == NULL || !lvml_patch_copy_name(name, cmd->name, cmd->name_len)) {
+        return LIVE_FAILED;
+    }
+
+    lvml_snapshot_node_t node;
+    memset(&node, 0, sizeof(node));
+    node.type = cmd->type;
+    node.x = cmd->x;
+    node.y = cmd->y;
+    node.width = cmd->width;
+    node.height = cmd->height;
+    if (cmd->width < 0) {
+        node.flags |= LVML_SNAPSHOT_FLAG_W_CONTENT;
+    }
+    if (cmd->height < 0) {
+        node.flags |= LVML_SNAPSHOT_FLAG_H_CONTENT;
+    }
+    if (cmd->type == LVML_SNAPSHOT_SLIDER || cmd->type == LVML_SNAPSHOT_BAR || cmd->type == LVML_SNAPSHOT_ARC) {
+        node.flags |= LVML_SNAPSHOT_FLAG_VALUE;
+        node.max = 100;
+    }
+    node.name = cmd->name_len > 0 ? name : NULL;
+    node.name_len = cmd->name_len;
+    node.text = cmd->str;
+    node.text_len = cmd->str_len;
+
+    lv_obj_t* obj = lvml_state_create(parent, &node);
+    if (obj == NULL) {
+        return LIVE_FAILED;
+    }
+    if (cmd->value >= 0 && (uint32_t)cmd->value < lv_obj_get_child_count(parent) - 1) {
+        lv_obj_move_to_index(obj, cmd->value);
+    }
+    return LIVE_CHANGED;
+}
+
+static int live_remove(const lvml_patch_cmd_t* cmd) {
+    lv_obj_t* obj = live_find(cmd->target, cmd->target_len);
+    if (obj == NULL || obj == lv_screen_active()) {
+        return LIVE_FAILED;
+    }
+    if (obj == lvml_ui_get_xml_root()) {
+        lvml_ui_set_xml_root(NULL);
+    }
+    // Cached lookups may point into the deleted subtree
+    live_cache_clear();
+    lv_obj_delete(obj);
+    return LIVE_CHANGED;
+}
+
+/**
+ * Set a bound subject; unknown names get a subject of the value's type so
+ * that XML loaded later can bind to it
+ */
+static int live_bind(const lvml_patch_cmd_t* cmd) {
+    char name[LVML_PATCH_NAME_MAX];
+    if (!lvml_patch_copy_name(name, cmd->target, cmd->target_len)) {
+        return LIVE_FAILED;
+    }
+    bool is_int = cmd->op == LVML_PATCH_BIND_INT;
+    lv_subject_t* subject = lvml_bind_get_subject(name, is_int ? LVML_BIND_INT : LVML_BIND_STRING, true);
+    if (subject == NULL) {
+        return LIVE_FAILED;
+    }
+
+    bool changed;
+    if (lvml_bind_get_type(subject) == LVML_BIND_INT) {
+        if (!is_int) {
+            return LIVE_FAILED;
+        }
+        changed = lvml_bind_set_int(subject, cmd->value);
+    } else if (is_int) {
+        char text[12];
+        snprintf(text, sizeof(text), "%ld", (long)cmd->value);
+        changed = lvml_bind_set_string(subject, text);
+    } else {
+        const char* text = live_cstr(cmd->str, cmd->str_len);
+        if (text == NULL) {
+            return LIVE_FAILED;
+        }
+        changed = lvml_bind_set_string(subject, text);
+    }
+    return changed ? LIVE_CHANGED : LIVE_UNCHANGED;
+}
+
+/**
+ * NUL-terminated copy of an update string, valid until the next call
+ */
+static const char* live_cstr(const char* str, size_t len) {
+    if (len + 1 > live_text_size) {
+        char* buf = (char*)lv_realloc(live_text, len + 1);
+        if (buf == NULL) {
+            return NULL;
+        }
+        live_text = buf;
+        live_text_size = len + 1;
+    }
+    if (len > 0) {
+        memcpy(live_text, str, len);
+    }
+    live_text[len] = '\0';
+    return live_text;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file lvml_live.h
+ * @brief Apply pushed updates to the live widget tree once per frame
+ *
+ * lvml_live_poll() runs from lvml.tick(). Every update the push channel
+ * (network/lvml_push.h) has received since the last frame is applied in
+ * one data binding batch, so a bound object is invalidated once per frame
+ * however many of its values changed, and the time spent is capped at
+ * LVML_LIVE_BUDGET_US; what doesn't fit waits for the next frame.
+ * Objects are looked up by name under the XML root and the lookups are
+ * cached while a batch runs. Commands that fail (an unknown object, a
+ * property the object doesn't have) are counted and skipped; a corrupt
+ * update is applied up to where the corruption starts.
+ */
+
+#ifndef LVML_LIVE_H
+#define LVML_LIVE_H
+
+#include "lvgl/lvgl.h"
+#include "utils/lvml_common.h"
+#include "utils/lvml_patch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_LIVE_BUDGET_US 8000        // Longest a frame spends applying updates
+#define LVML_LIVE_CACHE_SIZE 8          // Object lookups remembered during a batch
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Statistics of applied commands
+ */
+typedef struct {
+    uint32_t cmds;                  // Commands applied
+    uint32_t sets;
+    uint32_t inserts;
+    uint32_t removes;
+    uint32_t binds;
+    uint32_t unchanged;             // Values equal to the current one
+    uint32_t failed;                // Unknown objects, properties an object doesn't have
+    uint32_t lookups;               // Name lookups that walked the tree
+} lvml_live_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Apply the updates received since the last call; call once per frame
+ * @return number of updates applied
+ */
+uint32_t lvml_live_poll(void);
+
+/**
+ * Get statistics of applied commands
+ * @param stats output statistics
+ * @param reset clear the counters afterwards
+ */
+void lvml_live_get_stats(lvml_live_stats_t* stats, bool reset);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_LIVE_H*/
@@ -0,0 +1,288 @@
+/**
+ * @file lvml_replay.c
+ * @brief Record touch input and replay it for repeatable benchmarks
+ */
+
+#include "lvml_replay.h"
+#include "lvml_input.h"
+#include "driver/esp32_s3_box3_touch.h"
+#include "utils/lvml_log.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_time.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define REPLAY_GESTURE_QUEUE 16
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_indev_t* replay_find_touch(void);
+static void replay_record_read(lv_indev_t* indev, lv_indev_data_t* data);
+static void replay_read(lv_indev_t* indev, lv_indev_data_t* data);
+static uint32_t replay_now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+// Recording: the touch device's own read callback is called first
+static lvml_recorder_t record;
+static bool record_active = false;
+static bool record_error = false;
+static lv_indev_t* record_indev = NULL;
+static lv_indev_read_cb_t record_orig_cb = NULL;
+
+// Replay: owns a copy of the recording
+static uint8_t* replay_data = NULL;
+static lvml_player_t replay_player;
+static lv_indev_t* replay_indev = NULL;
+static lv_indev_t* replay_touch = NULL;    // Disabled while replaying
+static lvml_record_t replay_state;
+static bool replay_finished = false;
+static uint32_t replay_elapsed_ms = 0;
+static uint32_t replay_gesture_count = 0;
+
+// Gestures found in the read callback, sent by lvml_replay_tick()
+static lvml_gesture_t replay_gestures;
+static lvml_gesture_event_t replay_events[REPLAY_GESTURE_QUEUE];
+static uint8_t replay_event_count = 0;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_replay_record_start(void) {
+    if (record_active) {
+        lvml_replay_record_stop(NULL);
+    }
+    lv_indev_t* touch = replay_find_touch();
+    if (touch == NULL || replay_indev != NULL) {
+        return LVML_ERROR_INIT;
+    }
+
+    lv_display_t* disp = lv_indev_get_display(touch);
+    if (disp == NULL) {
+        disp = lv_display_get_default();
+    }
+    lvml_recorder_free(&record);
+    lvml_error_t result = lvml_recorder_init(&record,
+                                             (uint16_t)lv_display_get_horizontal_resolution(disp),
+                                             (uint16_t)lv_display_get_vertical_resolution(disp));
+    if (result != LVML_OK) {
+        return result;
+    }
+
+    record_indev = touch;
+    record_orig_cb = lv_indev_get_read_cb(touch);
+    record_error = false;
+    record_active = true;
+    lv_indev_set_read_cb(touch, replay_record_read);
+    return LVML_OK;
+}
+
+const uint8_t* lvml_replay_record_stop(size_t* len) {
+    if (record_active) {
+        lv_indev_set_read_cb(record_indev, record_orig_cb);
+        record_active = false;
+        record_indev = NULL;
+        LVML_LOG_INFO(LVML_LOG_MOD_CORE, "Recorded %d input states, %d bytes",
+                      (int)record.records, (int)record.len);
+    }
+    if (len != NULL) {
+        *len = record.records > 0 ? record.len : 0;
+    }
+    return record.records > 0 ? record.data : NULL;
+}
+
+lvml_error_t lvml_replay_start(const uint8_t* data, size_t len, uint16_t speed_pct) {
+    if (record_active) {
+        return LVML_ERROR_INIT;
+    }
+    lvml_replay_stop();
+
+    replay_data = lvml_mem_alloc_large(len > 0 ? len : 1);
+    if (replay_data == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+    memcpy(replay_data, data, len);
+    if (lvml_player_open(&replay_player, replay_data, len, speed_pct) != LVML_OK) {
+        lvml_mem_free_large(replay_data);
+        replay_data = NULL;
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    replay_touch = replay_find_touch();
+    lv_display_t* disp = replay_touch != NULL ? lv_indev_get_display(replay_touch) : NULL;
+    if (disp == NULL) {
+        disp = lv_display_get_default();
+    }
+    if (disp != NULL && (lv_display_get_horizontal_resolution(disp) != replay_player.width ||
+                         lv_display_get_vertical_resolution(disp) != replay_player.height)) {
+        LVML_LOG_WARN(LVML_LOG_MOD_CORE, "Replaying a %dx%d recording on a %dx%d display",
+                      replay_player.width, replay_player.height,
+                      (int)lv_display_get_horizontal_resolution(disp),
+                      (int)lv_display_get_vertical_resolution(disp));
+    }
+
+    replay_indev = lv_indev_create();
+    if (replay_indev == NULL) {
+        lvml_mem_free_large(replay_data);
+        replay_data = NULL;
+        return LVML_ERROR_MEMORY;
+    }
+    lv_indev_set_type(replay_indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(replay_indev, replay_read);
+    if (disp != NULL) {
+        lv_indev_set_display(replay_indev, disp);
+    }
+    if (replay_touch != NULL) {
+        lv_indev_enable(replay_touch, false);
+    }
+
+    memset(&replay_state, 0, sizeof(replay_state));
+    lvml_gesture_init(&replay_gestures, NULL);
+    replay_event_count = 0;
+    replay_gesture_count = 0;
+    replay_elapsed_ms = 0;
+    replay_finished = false;
+    return LVML_OK;
+}
+
+void lvml_replay_stop(void) {
+    if (replay_indev == NULL) {
+        return;
+    }
+    replay_elapsed_ms = replay_player.started ? replay_now_ms() - replay_player.start_ms : 0;
+    lv_indev_delete(replay_indev);
+    replay_indev = NULL;
+    if (replay_touch != NULL) {
+        lv_indev_enable(replay_touch, true);
+        replay_touch = NULL;
+    }
+    // The player keeps its counters for lvml_replay_get_status()
+    lvml_mem_free_large(replay_data);
+    replay_data = NULL;
+    replay_player.data = NULL;
+    replay_player.len = 0;
+    replay_event_count = 0;
+}
+
+void lvml_replay_tick(void) {
+    if (replay_indev == NULL) {
+        return;
+    }
+    for (uint8_t i = 0; i < replay_event_count; i++) {
+        lvml_input_send_gesture(&replay_events[i]);
+    }
+    replay_event_count = 0;
+
+    // The indev can't be deleted from its own read callback
+    if (replay_finished) {
+        LVML_LOG_INFO(LVML_LOG_MOD_CORE, "Replayed %d input states", (int)replay_player.played);
+        lvml_replay_stop();
+    }
+}
+
+bool lvml_replay_is_playing(void) {
+    return replay_indev != NULL;
+}
+
+void lvml_replay_get_status(lvml_replay_status_t* status) {
+    memset(status, 0, sizeof(*status));
+    status->recording = record_active;
+    status->playing = replay_indev != NULL;
+    status->records = record.records;
+    status->bytes = record.records > 0 ? (uint32_t)record.len : 0;
+    status->duration_ms = record.records > 0 ? record.last.time_ms - record.start_ms : 0;
+    status->played = replay_player.played;
+    if (status->playing) {
+        status->elapsed_ms = replay_player.started ? replay_now_ms() - replay_player.start_ms : 0;
+    } else {
+        status->elapsed_ms = replay_elapsed_ms;
+    }
+    status->gestures = replay_gesture_count;
+    status->error = record_error || replay_player.error;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * First pointer device that isn't the replay's own
+ */
+static lv_indev_t* replay_find_touch(void) {
+    lv_indev_t* indev = lv_indev_get_next(NULL);
+    while (indev != NULL) {
+        if (indev != replay_indev && lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER) {
+            return indev;
+        }
+        indev = lv_indev_get_next(indev);
+    }
+    return NULL;
+}
+
+/**
+ * Touch device read callback while recording: read as usual, then store
+ * what LVGL was given together with every finger behind it
+ */
+static void replay_record_read(lv_indev_t* indev, lv_indev_data_t* data) {
+    record_orig_cb(indev, data);
+    if (record_error) {
+        return;
+    }
+
+    lvml_record_t state;
+    state.time_ms = replay_now_ms();
+    state.pressed = data->state == LV_INDEV_STATE_PRESSED;
+    state.x = data->point.x;
+    state.y = data->point.y;
+    state.count = state.pressed ? esp32_s3_box3_touch_get_contacts(state.contacts) : 0;
+    if (lvml_recorder_add(&record, &state) != LVML_OK) {
+        record_error = true;
+        LVML_LOG_ERROR(LVML_LOG_MOD_CORE, "Input recording full after %d states", (int)record.records);
+    }
+}
+
+/**
+ * Replay device read callback: the latest due record, and all records that
+ * are due when replaying faster than they were recorded
+ */
+static void replay_read(lv_indev_t* indev, lv_indev_data_t* data) {
+    LV_UNUSED(indev);
+    uint32_t now = replay_now_ms();
+
+    lvml_record_t state;
+    if (lvml_player_poll(&replay_player, now, &state)) {
+        replay_state = state;
+        // Recording time, not replay time, so gestures match at any speed
+        lvml_gesture_event_t events[LVML_GESTURE_MAX_EVENTS];
+        size_t n = lvml_gesture_update(&replay_gestures, state.time_ms, state.contacts,
+                                       state.pressed ? state.count : 0, events);
+        for (size_t i = 0; i < n && replay_event_count < REPLAY_GESTURE_QUEUE; i++) {
+            replay_events[replay_event_count++] = events[i];
+            replay_gesture_count++;
+        }
+    } else if (lvml_player_done(&replay_player)) {
+        // Every record was read: never leave the pointer pressed
+        replay_state.pressed = false;
+        replay_finished = true;
+    }
+
+    data->point.x = replay_state.x;
+    data->point.y = replay_state.y;
+    data->state = replay_state.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    // Stop early rather than drop gestures; the rest waits for the next tick
+    data->continue_reading = replay_player.speed_pct != LVML_RECORD_SPEED_STEP &&
+                             lvml_player_due(&replay_player, now) &&
+                             replay_event_count + LVML_GESTURE_MAX_EVENTS <= REPLAY_GESTURE_QUEUE;
+}
+
+static uint32_t replay_now_ms(void) {
+    return (uint32_t)(lvml_time_us() / 1000);
+}
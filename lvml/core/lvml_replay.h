@@ -0,0 +1,99 @@
+/**
+ * @file lvml_replay.h
+ * @brief Record touch input and replay it for repeatable benchmarks
+ *
+ * Recording wraps the read callback of the touch input device: whatever
+ * the driver returns to LVGL is stored together with all fingers down
+ * (lvml_record.h). A replay disables the touch device and adds a pointer
+ * device that returns the recorded states at their original times, scaled
+ * by a speed factor, or one per read in step mode. Gestures are recognized
+ * again from the recorded fingers with the recording's own timestamps, so
+ * a replay produces the same events at any speed.
+ */
+
+#ifndef LVML_REPLAY_H
+#define LVML_REPLAY_H
+
+#include "lvgl/lvgl.h"
+#include "utils/lvml_common.h"
+#include "utils/lvml_record.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Recorder and player state
+ */
+typedef struct {
+    bool recording;
+    bool playing;
+    uint32_t records;           // Records in the last recording
+    uint32_t bytes;             // Its size with the header
+    uint32_t duration_ms;       // First to last record
+    uint32_t played;            // Records replayed so far
+    uint32_t elapsed_ms;        // Since the replay started
+    uint32_t gestures;          // Gestures the replay produced
+    bool error;                 // Recording ran out of memory, or replay hit a corrupt record
+} lvml_replay_status_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start recording the touch input device; drops the previous recording
+ * @return LVML_OK, LVML_ERROR_INIT if there is no touch device or a replay
+ *         is running, LVML_ERROR_MEMORY
+ */
+lvml_error_t lvml_replay_record_start(void);
+
+/**
+ * Stop recording; the recording is kept until the next one starts
+ * @param len receives its size in bytes
+ * @return recording bytes, or NULL if nothing was recorded
+ */
+const uint8_t* lvml_replay_record_stop(size_t* len);
+
+/**
+ * Replay a recording in place of the touch input device
+ * @param data recording, copied
+ * @param len its size
+ * @param speed_pct 100 for real time, LVML_RECORD_SPEED_STEP for one record per read
+ * @return LVML_OK, LVML_ERROR_INVALID_PARAM if data isn't a recording,
+ *         LVML_ERROR_INIT while recording, LVML_ERROR_MEMORY
+ */
+lvml_error_t lvml_replay_start(const uint8_t* data, size_t len, uint16_t speed_pct);
+
+/**
+ * Stop a replay and give input back to the touch device
+ */
+void lvml_replay_stop(void);
+
+/**
+ * Send the gestures of the replay and finish it once everything was read;
+ * called once per tick by lvml_core_tick()
+ */
+void lvml_replay_tick(void);
+
+/**
+ * Check whether a replay owns the input
+ * @return true while replaying
+ */
+bool lvml_replay_is_playing(void);
+
+/**
+ * Get the recorder and player state
+ * @param status receives the state
+ */
+void lvml_replay_get_status(lvml_replay_status_t* status);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_REPLAY_H*/
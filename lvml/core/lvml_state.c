@@ -0,0 +1,505 @@
+/**
+ * @file lvml_state.c
+ * @brief Save the live widget tree and recreate it without XML or scripts
+ */
+
+#include "lvml_state.h"
+#include "lvml_core.h"
+#include "lvml_style.h"
+#include "lvml_ui.h"
+#include "utils/lvml_boot.h"
+#include "utils/lvml_log.h"
+#include "utils/lvml_time.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define STATE_STYLE_ALL (LVML_STYLE_PROP_BG_COLOR | LVML_STYLE_PROP_BG_OPA | LVML_STYLE_PROP_BORDER_COLOR | \
+                         LVML_STYLE_PROP_BORDER_WIDTH | LVML_STYLE_PROP_BORDER_OPA | LVML_STYLE_PROP_TEXT_COLOR | \
+                         LVML_STYLE_PROP_RADIUS)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Widget class of each lvml_snapshot_type_t, in enum order
+ */
+typedef struct {
+    const lv_obj_class_t* cls;
+    lv_obj_t* (*create)(lv_obj_t* parent);
+    bool children;          // Children are user objects (not parts of the widget)
+} state_class_t;
+
+typedef struct {
+    lvml_snapshot_writer_t* w;
+    lv_obj_t* xml_root;
+    lv_obj_t* ref_screen;   // Holds a fresh widget per type to diff styles against
+    lv_obj_t* refs[LVML_SNAPSHOT_TYPE_COUNT];
+    uint32_t nodes;
+    uint32_t skipped;
+} state_save_t;
+
+typedef struct {
+    char* buf;              // NUL-terminated copies of snapshot strings
+    size_t buf_size;
+} state_load_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static int state_type_of(const lv_obj_t* obj);
+static void state_save_children(state_save_t* ctx, lv_obj_t* obj, uint16_t parent);
+static bool state_save_node(state_save_t* ctx, lv_obj_t* obj, int type, lvml_snapshot_node_t* node);
+static uint16_t state_save_style(state_save_t* ctx, lv_obj_t* obj, int type);
+static void state_read_style(lv_obj_t* obj, lvml_snapshot_style_t* style);
+static lv_obj_t* state_create(state_load_t* ctx, lv_obj_t* parent, const lvml_snapshot_node_t* node,
+                              const lvml_snapshot_style_t* style);
+static void state_apply_style(lv_obj_t* obj, const lvml_snapshot_style_t* style);
+static const char* state_cstr(state_load_t* ctx, const char* str, size_t len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const state_class_t state_classes[LVML_SNAPSHOT_TYPE_COUNT] = {
+    [LVML_SNAPSHOT_OBJ]      = { &lv_obj_class, lv_obj_create, true },
+    [LVML_SNAPSHOT_BUTTON]   = { &lv_button_class, lv_button_create, true },
+    [LVML_SNAPSHOT_LABEL]    = { &lv_label_class, lv_label_create, false },
+    [LVML_SNAPSHOT_IMAGE]    = { &lv_image_class, lv_image_create, false },
+    [LVML_SNAPSHOT_TEXTAREA] = { &lv_textarea_class, lv_textarea_create, false },
+    [LVML_SNAPSHOT_SLIDER]   = { &lv_slider_class, lv_slider_create, false },
+    [LVML_SNAPSHOT_BAR]      = { &lv_bar_class, lv_bar_create, false },
+    [LVML_SNAPSHOT_ARC]      = { &lv_arc_class, lv_arc_create, false },
+    [LVML_SNAPSHOT_SWITCH]   = { &lv_switch_class, lv_switch_create, false },
+    [LVML_SNAPSHOT_CHECKBOX] = { &lv_checkbox_class, lv_checkbox_create, false },
+    [LVML_SNAPSHOT_DROPDOWN] = { &lv_dropdown_class, lv_dropdown_create, false },
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_state_snapshot(lvml_snapshot_writer_t* w, lvml_state_info_t* info) {
+    if (!lvml_core_is_initialized()) {
+        return LVML_ERROR_INIT;
+    }
+
+    int64_t start_us = lvml_time_us();
+    lv_display_t* disp = lv_display_get_default();
+    lvml_error_t result = lvml_snapshot_begin(w, (uint16_t)lv_display_get_horizontal_resolution(disp),
+                                              (uint16_t)lv_display_get_vertical_resolution(disp));
+    if (result != LVML_OK) {
+        return result;
+    }
+
+    state_save_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.w = w;
+    ctx.xml_root = lvml_ui_get_xml_root();
+    // Reference widgets live on a screen that is never loaded, so nothing is redrawn
+    ctx.ref_screen = lv_obj_create(NULL);
+    if (ctx.ref_screen == NULL) {
+        lvml_snapshot_free(w);
+        return LVML_ERROR_MEMORY;
+    }
+
+    // The screen keeps its background; everything else is theme default
+    lv_obj_t* screen = lv_screen_active();
+    lvml_snapshot_style_t screen_style;
+    state_read_style(screen, &screen_style);
+    screen_style.set = LVML_STYLE_PROP_BG_COLOR | LVML_STYLE_PROP_BG_OPA;
+    uint16_t screen_ref = lvml_snapshot_add_style(w, &screen_style);
+
+    state_save_children(&ctx, screen, 0);
+    lv_obj_delete(ctx.ref_screen);
+
+    result = lvml_snapshot_end(w, screen_ref);
+    if (result != LVML_OK) {
+        lvml_snapshot_free(w);
+        return result;
+    }
+    if (ctx.skipped > 0 || w->styles_dropped > 0) {
+        LVML_LOG_WARN(LVML_LOG_MOD_UI, "Snapshot left out %u objects and %u styles",
+                      (unsigned)ctx.skipped, (unsigned)w->styles_dropped);
+    }
+    if (info != NULL) {
+        info->nodes = ctx.nodes;
+        info->skipped = ctx.skipped;
+        info->bytes = (uint32_t)w->len;
+        info->time_us = (uint32_t)(lvml_time_us() - start_us);
+    }
+    return LVML_OK;
+}
+
+lvml_error_t lvml_state_restore(const uint8_t* data, size_t len, lvml_state_info_t* info) {
+    if (!lvml_core_is_initialized()) {
+        return LVML_ERROR_INIT;
+    }
+
+    int64_t start_us = lvml_time_us();
+    lvml_snapshot_reader_t r;
+    lv_display_t* disp = lv_display_get_default();
+    if (lvml_snapshot_open(&r, data, len) != LVML_OK ||
+        r.width != lv_display_get_horizontal_resolution(disp) ||
+        r.height != lv_display_get_vertical_resolution(disp)) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    // Created objects by node index, to find each node's parent
+    lv_obj_t** objs = NULL;
+    if (r.nodes > 0) {
+        objs = (lv_obj_t**)lv_malloc(r.nodes * sizeof(lv_obj_t*));
+        if (objs == NULL) {
+            return LVML_ERROR_MEMORY;
+        }
+    }
+
+    lv_obj_t* screen = lv_screen_active();
+    lv_obj_clean(screen);
+    lvml_ui_set_xml_root(NULL);
+    state_apply_style(screen, lvml_snapshot_get_style(&r, r.screen_style));
+
+    state_load_t ctx = { .buf = NULL, .buf_size = 0 };
+    uint32_t created = 0;
+    uint32_t skipped = 0;
+    lvml_snapshot_node_t node;
+    while (lvml_snapshot_next(&r, &node)) {
+        lv_obj_t* parent = node.parent == 0 ? screen : objs[node.parent - 1];
+        lv_obj_t* obj = parent != NULL ?
+                        state_create(&ctx, parent, &node, lvml_snapshot_get_style(&r, node.style)) : NULL;
+        objs[r.node_index - 1] = obj;
+        if (obj != NULL) {
+            created++;
+        } else {
+            skipped++;
+        }
+    }
+    lv_free(ctx.buf);
+    lv_free(objs);
+
+    // A partial UI would look right but miss controls; leave the screen to the caller
+    if (r.error) {
+        lv_obj_clean(screen);
+        lvml_ui_set_xml_root(NULL);
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    lvml_boot_mark("state_restored");
+
+    if (info != NULL) {
+        info->nodes = created;
+        info->skipped = skipped;
+        info->bytes = (uint32_t)len;
+        info->time_us = (uint32_t)(lvml_time_us() - start_us);
+    }
+    return LVML_OK;
+}
+
+lv_obj_t* lvml_state_create(lv_obj_t* parent, const lvml_snapshot_node_t* node) {
+    if (parent == NULL || node == NULL || node->type >= LVML_SNAPSHOT_TYPE_COUNT) {
+        return NULL;
+    }
+    state_load_t ctx = { .buf = NULL, .buf_size = 0 };
+    lv_obj_t* obj = state_create(&ctx, parent, node, NULL);
+    lv_free(ctx.buf);
+    return obj;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Snapshot type of an object, or -1 for classes that can't be restored
+ */
+static int state_type_of(const lv_obj_t* obj) {
+    const lv_obj_class_t* cls = lv_obj_get_class(obj);
+    for (int i = 0; i < LVML_SNAPSHOT_TYPE_COUNT; i++) {
+        if (state_classes[i].cls == cls) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Store the children of obj, depth first, so parents precede their children
+ */
+static void state_save_children(state_save_t* ctx, lv_obj_t* obj, uint16_t parent) {
+    uint32_t count = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < count && !ctx->w->failed; i++) {
+        lv_obj_t* child = lv_obj_get_child(obj, (int32_t)i);
+        int type = state_type_of(child);
+        lvml_snapshot_node_t node;
+        if (type < 0 || !state_save_node(ctx, child, type, &node)) {
+            ctx->skipped++;
+            continue;
+        }
+        node.parent = parent;
+        uint16_t index = lvml_snapshot_add(ctx->w, &node);
+        if (index == 0) {
+            return;
+        }
+        ctx->nodes++;
+        if (state_classes[type].children) {
+            state_save_children(ctx, child, index);
+        }
+    }
+}
+
+/**
+ * Fill a node from an object
+ * @return false if the object can't be restored (an image that isn't registered)
+ */
+static bool state_save_node(state_save_t* ctx, lv_obj_t* obj, int type, lvml_snapshot_node_t* node) {
+    memset(node, 0, sizeof(*node));
+    node->type = (uint8_t)type;
+
+    switch (type) {
+        case LVML_SNAPSHOT_LABEL:
+            node->text = lv_label_get_text(obj);
+            break;
+        case LVML_SNAPSHOT_IMAGE: {
+            const void* src = lv_image_get_src(obj);
+            node->text = src != NULL && lv_image_src_get_type(src) == LV_IMAGE_SRC_VARIABLE ?
+                         lvml_ui_find_image_name(src) : NULL;
+            if (node->text == NULL) {
+                return false;
+            }
+            break;
+        }
+        case LVML_SNAPSHOT_TEXTAREA:
+            node->text = lv_textarea_get_text(obj);
+            node->extra = lv_textarea_get_placeholder_text(obj);
+            break;
+        case LVML_SNAPSHOT_CHECKBOX:
+            node->text = lv_checkbox_get_text(obj);
+            break;
+        case LVML_SNAPSHOT_DROPDOWN:
+            node->extra = lv_dropdown_get_options(obj);
+            node->flags |= LVML_SNAPSHOT_FLAG_VALUE;
+            node->value = (int32_t)lv_dropdown_get_selected(obj);
+            break;
+        case LVML_SNAPSHOT_SLIDER:
+            node->flags |= LVML_SNAPSHOT_FLAG_VALUE;
+            node->value = lv_slider_get_value(obj);
+            node->min = lv_slider_get_min_value(obj);
+            node->max = lv_slider_get_max_value(obj);
+            break;
+        case LVML_SNAPSHOT_BAR:
+            node->flags |= LVML_SNAPSHOT_FLAG_VALUE;
+            node->value = lv_bar_get_value(obj);
+            node->min = lv_bar_get_min_value(obj);
+            node->max = lv_bar_get_max_value(obj);
+            break;
+        case LVML_SNAPSHOT_ARC:
+            node->flags |= LVML_SNAPSHOT_FLAG_VALUE;
+            node->value = lv_arc_get_value(obj);
+            node->min = lv_arc_get_min_value(obj);
+            node->max = lv_arc_get_max_value(obj);
+            break;
+        default:
+            break;
+    }
+    node->name = lv_obj_get_name(obj);
+    node->name_len = node->name != NULL ? strlen(node->name) : 0;
+    node->text_len = node->text != NULL ? strlen(node->text) : 0;
+    node->extra_len = node->extra != NULL ? strlen(node->extra) : 0;
+
+    // Positions as the layout left them, so restored objects need no layout pass
+    node->x = lv_obj_get_x(obj);
+    node->y = lv_obj_get_y(obj);
+    node->width = lv_obj_get_width(obj);
+    node->height = lv_obj_get_height(obj);
+    if (lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT) {
+        node->flags |= LVML_SNAPSHOT_FLAG_W_CONTENT;
+    }
+    if (lv_obj_get_style_height(obj, LV_PART_MAIN) == LV_SIZE_CONTENT) {
+        node->flags |= LVML_SNAPSHOT_FLAG_H_CONTENT;
+    }
+
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+        node->flags |= LVML_SNAPSHOT_FLAG_HIDDEN;
+    }
+    if (lv_obj_has_state(obj, LV_STATE_CHECKED)) {
+        node->flags |= LVML_SNAPSHOT_FLAG_CHECKED;
+    }
+    if (lv_obj_has_state(obj, LV_STATE_DISABLED)) {
+        node->flags |= LVML_SNAPSHOT_FLAG_DISABLED;
+    }
+    if (obj == ctx->xml_root) {
+        node->flags |= LVML_SNAPSHOT_FLAG_XML_ROOT;
+    }
+    node->style = state_save_style(ctx, obj, type);
+    return true;
+}
+
+/**
+ * Store the style properties that differ from a fresh widget of the same type
+ */
+static uint16_t state_save_style(state_save_t* ctx, lv_obj_t* obj, int type) {
+    if (ctx->refs[type] == NULL) {
+        ctx->refs[type] = state_classes[type].create(ctx->ref_screen);
+    }
+
+    lvml_snapshot_style_t style;
+    state_read_style(obj, &style);
+    if (ctx->refs[type] != NULL) {
+        lvml_snapshot_style_t ref;
+        state_read_style(ctx->refs[type], &ref);
+        if (style.bg_color == ref.bg_color) style.set &= ~LVML_STYLE_PROP_BG_COLOR;
+        if (style.bg_opa == ref.bg_opa) style.set &= ~LVML_STYLE_PROP_BG_OPA;
+        if (style.border_color == ref.border_color) style.set &= ~LVML_STYLE_PROP_BORDER_COLOR;
+        if (style.border_width == ref.border_width) style.set &= ~LVML_STYLE_PROP_BORDER_WIDTH;
+        if (style.border_opa == ref.border_opa) style.set &= ~LVML_STYLE_PROP_BORDER_OPA;
+        if (style.text_color == ref.text_color) style.set &= ~LVML_STYLE_PROP_TEXT_COLOR;
+        if (style.radius == ref.radius) style.set &= ~LVML_STYLE_PROP_RADIUS;
+        if ((ref.set & LVML_STYLE_PROP_PAD_ALL) && style.pad_all == ref.pad_all) {
+            style.set &= ~LVML_STYLE_PROP_PAD_ALL;
+        }
+    }
+    return lvml_snapshot_add_style(ctx->w, &style);
+}
+
+/**
+ * Read the resolved main-part values of the LVML style properties; padding
+ * only counts when it is the same on all sides
+ */
+static void state_read_style(lv_obj_t* obj, lvml_snapshot_style_t* style) {
+    memset(style, 0, sizeof(*style));
+    style->set = STATE_STYLE_ALL;
+    style->bg_color = lv_color_to_u32(lv_obj_get_style_bg_color(obj, LV_PART_MAIN)) & 0xFFFFFF;
+    style->bg_opa = lv_obj_get_style_bg_opa(obj, LV_PART_MAIN);
+    style->border_color = lv_color_to_u32(lv_obj_get_style_border_color(obj, LV_PART_MAIN)) & 0xFFFFFF;
+    style->border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    style->border_opa = lv_obj_get_style_border_opa(obj, LV_PART_MAIN);
+    style->text_color = lv_color_to_u32(lv_obj_get_style_text_color(obj, LV_PART_MAIN)) & 0xFFFFFF;
+    style->radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+
+    int32_t pad = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    if (lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN) == pad &&
+        lv_obj_get_style_pad_left(obj, LV_PART_MAIN) == pad &&
+        lv_obj_get_style_pad_right(obj, LV_PART_MAIN) == pad) {
+        style->set |= LVML_STYLE_PROP_PAD_ALL;
+        style->pad_all = pad;
+    }
+}
+
+/**
+ * Create the object of a node
+ * @return object, or NULL if it couldn't be created (an image no longer registered)
+ */
+static lv_obj_t* state_create(state_load_t* ctx, lv_obj_t* parent, const lvml_snapshot_node_t* node,
+                              const lvml_snapshot_style_t* style) {
+    const void* image = NULL;
+    if (node->type == LVML_SNAPSHOT_IMAGE) {
+        image = node->text != NULL ? lvml_ui_find_image(node->text, node->text_len) : NULL;
+        if (image == NULL) {
+            return NULL;
+        }
+    }
+
+    lv_obj_t* obj = state_classes[node->type].create(parent);
+    if (obj == NULL) {
+        return NULL;
+    }
+
+    switch (node->type) {
+        case LVML_SNAPSHOT_LABEL:
+            lv_label_set_text(obj, state_cstr(ctx, node->text, node->text_len));
+            break;
+        case LVML_SNAPSHOT_IMAGE:
+            lv_image_set_src(obj, image);
+            break;
+        case LVML_SNAPSHOT_TEXTAREA:
+            lv_textarea_set_text(obj, state_cstr(ctx, node->text, node->text_len));
+            lv_textarea_set_placeholder_text(obj, state_cstr(ctx, node->extra, node->extra_len));
+            break;
+        case LVML_SNAPSHOT_CHECKBOX:
+            lv_checkbox_set_text(obj, state_cstr(ctx, node->text, node->text_len));
+            break;
+        case LVML_SNAPSHOT_DROPDOWN:
+            lv_dropdown_set_options(obj, state_cstr(ctx, node->extra, node->extra_len));
+            lv_dropdown_set_selected(obj, (uint32_t)node->value);
+            break;
+        case LVML_SNAPSHOT_SLIDER:
+            lv_slider_set_range(obj, node->min, node->max);
+            lv_slider_set_value(obj, node->value, LV_ANIM_OFF);
+            break;
+        case LVML_SNAPSHOT_BAR:
+            lv_bar_set_range(obj, node->min, node->max);
+            lv_bar_set_value(obj, node->value, LV_ANIM_OFF);
+            break;
+        case LVML_SNAPSHOT_ARC:
+            lv_arc_set_range(obj, node->min, node->max);
+            lv_arc_set_value(obj, node->value);
+            break;
+        default:
+            break;
+    }
+
+    lv_obj_set_pos(obj, node->x, node->y);
+    lv_obj_set_size(obj, (node->flags & LVML_SNAPSHOT_FLAG_W_CONTENT) ? LV_SIZE_CONTENT : node->width,
+                    (node->flags & LVML_SNAPSHOT_FLAG_H_CONTENT) ? LV_SIZE_CONTENT : node->height);
+    if (node->flags & LVML_SNAPSHOT_FLAG_HIDDEN) {
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (node->flags & LVML_SNAPSHOT_FLAG_CHECKED) {
+        lv_obj_add_state(obj, LV_STATE_CHECKED);
+    }
+    if (node->flags & LVML_SNAPSHOT_FLAG_DISABLED) {
+        lv_obj_add_state(obj, LV_STATE_DISABLED);
+    }
+    state_apply_style(obj, style);
+    if (node->name != NULL) {
+        lv_obj_set_name(obj, state_cstr(ctx, node->name, node->name_len));
+    }
+    if (node->flags & LVML_SNAPSHOT_FLAG_XML_ROOT) {
+        lvml_ui_set_xml_root(obj);
+    }
+    return obj;
+}
+
+/**
+ * Apply snapshot style properties as an interned style
+ */
+static void state_apply_style(lv_obj_t* obj, const lvml_snapshot_style_t* style) {
+    if (style == NULL) {
+        return;
+    }
+    lvml_style_props_t props;
+    lvml_style_props_init(&props);
+    props.set = style->set;
+    props.bg_color = style->bg_color;
+    props.border_color = style->border_color;
+    props.text_color = style->text_color;
+    props.border_width = style->border_width;
+    props.pad_all = style->pad_all;
+    props.radius = style->radius;
+    props.bg_opa = style->bg_opa;
+    props.border_opa = style->border_opa;
+    lvml_style_apply(obj, &props);
+}
+
+/**
+ * NUL-terminated copy of a snapshot string, valid until the next call
+ */
+static const char* state_cstr(state_load_t* ctx, const char* str, size_t len) {
+    if (str == NULL) {
+        return "";
+    }
+    if (len + 1 > ctx->buf_size) {
+        char* buf = (char*)lv_realloc(ctx->buf, len + 1);
+        if (buf == NULL) {
+            return "";
+        }
+        ctx->buf = buf;
+        ctx->buf_size = len + 1;
+    }
+    memcpy(ctx->buf, str, len);
+    ctx->buf[len] = '\0';
+    return ctx->buf;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file lvml_state.h
+ * @brief Save the live widget tree and recreate it without XML or scripts
+ *
+ * The active screen is walked into a snapshot (utils/lvml_snapshot.h):
+ * containers, buttons, labels, registered images, text areas, sliders,
+ * bars, arcs, switches, checkboxes and dropdowns with their position,
+ * size, state, text, value, name and the LVML style properties that
+ * differ from a fresh widget's theme. Layouts are frozen at their current
+ * positions. Restoring recreates the objects directly, which is much
+ * faster than parsing XML and running the scripts that built the UI, e.g.
+ * when waking from deep sleep. Event handlers, bindings and other styles
+ * are not part of a snapshot; the application attaches them again by
+ * object name.
+ */
+
+#ifndef LVML_STATE_H
+#define LVML_STATE_H
+
+#include "lvgl/lvgl.h"
+#include "utils/lvml_common.h"
+#include "utils/lvml_snapshot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * What a snapshot or restore did
+ */
+typedef struct {
+    uint32_t nodes;         // Objects stored or created
+    uint32_t skipped;       // Objects of unsupported types, stored or created without their children
+    uint32_t bytes;         // Snapshot size
+    uint32_t time_us;
+} lvml_state_info_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Snapshot the active screen
+ * @param w receives the snapshot in w->data and w->len; free it with
+ *          lvml_snapshot_free()
+ * @param info receives the result (may be NULL)
+ * @return LVML_OK, LVML_ERROR_INIT if LVML isn't initialized or
+ *         LVML_ERROR_MEMORY
+ */
+lvml_error_t lvml_state_snapshot(lvml_snapshot_writer_t* w, lvml_state_info_t* info);
+
+/**
+ * Replace the active screen's content with the objects of a snapshot
+ * @param data snapshot bytes
+ * @param len number of bytes
+ * @param info receives the result (may be NULL)
+ * @return LVML_OK, LVML_ERROR_INIT if LVML isn't initialized,
+ *         LVML_ERROR_INVALID_PARAM if data isn't a snapshot of a display
+ *         this size or is corrupt (the screen is left empty), or
+ *         LVML_ERROR_MEMORY
+ */
+lvml_error_t lvml_state_restore(const uint8_t* data, size_t len, lvml_state_info_t* info);
+
+/**
+ * Create one object the way a restore does, e.g. for a pushed update
+ * @param parent parent object
+ * @param node node; parent and style are ignored, strings are copied
+ * @return object, or NULL for an image that isn't registered or when out
+ *         of memory
+ */
+lv_obj_t* lvml_state_create(lv_obj_t* parent, const lvml_snapshot_node_t* node);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_STATE_H*/
@@ -0,0 +1,231 @@
+/**
+ * @file lvml_style.c
+ * @brief Interned, shared LVGL styles for LVML UI objects
+ */
+
+#include "lvml_style.h"
+#include "utils/lvml_hash.h"
+#include <stddef.h>
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct lvml_style_entry {
+    lvml_style_props_t props;
+    uint32_t hash;
+    uint32_t refs;
+    lv_style_t style;
+    struct lvml_style_entry* next;
+} lvml_style_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static uint32_t style_props_hash(const lvml_style_props_t* props);
+static bool style_props_equal(const lvml_style_props_t* a, const lvml_style_props_t* b);
+static uint32_t style_prop_count(const lvml_style_props_t* props);
+static size_t style_local_cost(const lvml_style_props_t* props);
+static void style_build(lv_style_t* style, const lvml_style_props_t* props);
+static lvml_style_entry_t* style_entry(lv_style_t* style);
+static void style_delete_cb(lv_event_t* e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lvml_style_entry_t* style_buckets[LVML_STYLE_BUCKETS];
+static lvml_style_stats_t style_stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_style_props_init(lvml_style_props_t* props) {
+    memset(props, 0, sizeof(*props));
+}
+
+lv_style_t* lvml_style_intern(const lvml_style_props_t* props) {
+    if (props == NULL) {
+        return NULL;
+    }
+
+    uint32_t hash = style_props_hash(props);
+    lvml_style_entry_t** bucket = &style_buckets[hash % LVML_STYLE_BUCKETS];
+
+    for (lvml_style_entry_t* entry = *bucket; entry != NULL; entry = entry->next) {
+        if (entry->hash == hash && style_props_equal(&entry->props, props)) {
+            // Each reuse replaces what would have been a local style on the object
+            entry->refs++;
+            style_stats.refs++;
+            style_stats.bytes_saved += style_local_cost(props);
+            return &entry->style;
+        }
+    }
+
+    lvml_style_entry_t* entry = (lvml_style_entry_t*)lv_malloc(sizeof(lvml_style_entry_t));
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    entry->props = *props;
+    entry->hash = hash;
+    entry->refs = 1;
+    style_build(&entry->style, props);
+    entry->next = *bucket;
+    *bucket = entry;
+
+    style_stats.unique++;
+    style_stats.refs++;
+    style_stats.bytes_used += sizeof(lvml_style_entry_t) + style_local_cost(props) - sizeof(lv_style_t);
+
+    return &entry->style;
+}
+
+lvml_error_t lvml_style_apply(lv_obj_t* obj, const lvml_style_props_t* props) {
+    if (obj == NULL || props == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    lv_style_t* style = lvml_style_intern(props);
+    if (style == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+
+    lv_obj_add_style(obj, style, LV_PART_MAIN);
+    lv_obj_add_event_cb(obj, style_delete_cb, LV_EVENT_DELETE, style);
+
+    return LVML_OK;
+}
+
+void lvml_style_release(lv_style_t* style) {
+    if (style == NULL) {
+        return;
+    }
+
+    lvml_style_entry_t* entry = style_entry(style);
+    style_stats.refs--;
+    if (--entry->refs > 0) {
+        style_stats.bytes_saved -= style_local_cost(&entry->props);
+        return;
+    }
+
+    lvml_style_entry_t** link = &style_buckets[entry->hash % LVML_STYLE_BUCKETS];
+    while (*link != entry) {
+        link = &(*link)->next;
+    }
+    *link = entry->next;
+
+    style_stats.unique--;
+    style_stats.bytes_used -= sizeof(lvml_style_entry_t) + style_local_cost(&entry->props) - sizeof(lv_style_t);
+    lv_style_reset(&entry->style);
+    lv_free(entry);
+}
+
+void lvml_style_get_stats(lvml_style_stats_t* stats) {
+    if (stats != NULL) {
+        *stats = style_stats;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t style_props_hash(const lvml_style_props_t* props) {
+    // Hash field by field so struct padding never takes part
+    uint32_t hash = LVML_HASH_FNV1A_INIT;
+    hash = lvml_hash_fnv1a_u32(hash, props->set);
+    if (props->set & LVML_STYLE_PROP_BG_COLOR) hash = lvml_hash_fnv1a_u32(hash, props->bg_color);
+    if (props->set & LVML_STYLE_PROP_BG_OPA) hash = lvml_hash_fnv1a_u32(hash, props->bg_opa);
+    if (props->set & LVML_STYLE_PROP_BORDER_COLOR) hash = lvml_hash_fnv1a_u32(hash, props->border_color);
+    if (props->set & LVML_STYLE_PROP_BORDER_WIDTH) hash = lvml_hash_fnv1a_u32(hash, (uint32_t)props->border_width);
+    if (props->set & LVML_STYLE_PROP_BORDER_OPA) hash = lvml_hash_fnv1a_u32(hash, props->border_opa);
+    if (props->set & LVML_STYLE_PROP_TEXT_COLOR) hash = lvml_hash_fnv1a_u32(hash, props->text_color);
+    if (props->set & LVML_STYLE_PROP_PAD_ALL) hash = lvml_hash_fnv1a_u32(hash, (uint32_t)props->pad_all);
+    if (props->set & LVML_STYLE_PROP_RADIUS) hash = lvml_hash_fnv1a_u32(hash, (uint32_t)props->radius);
+    return hash;
+}
+
+static bool style_props_equal(const lvml_style_props_t* a, const lvml_style_props_t* b) {
+    if (a->set != b->set) return false;
+    uint32_t set = a->set;
+    if ((set & LVML_STYLE_PROP_BG_COLOR) && a->bg_color != b->bg_color) return false;
+    if ((set & LVML_STYLE_PROP_BG_OPA) && a->bg_opa != b->bg_opa) return false;
+    if ((set & LVML_STYLE_PROP_BORDER_COLOR) && a->border_color != b->border_color) return false;
+    if ((set & LVML_STYLE_PROP_BORDER_WIDTH) && a->border_width != b->border_width) return false;
+    if ((set & LVML_STYLE_PROP_BORDER_OPA) && a->border_opa != b->border_opa) return false;
+    if ((set & LVML_STYLE_PROP_TEXT_COLOR) && a->text_color != b->text_color) return false;
+    if ((set & LVML_STYLE_PROP_PAD_ALL) && a->pad_all != b->pad_all) return false;
+    if ((set & LVML_STYLE_PROP_RADIUS) && a->radius != b->radius) return false;
+    return true;
+}
+
+static uint32_t style_prop_count(const lvml_style_props_t* props) {
+    uint32_t count = 0;
+    for (uint32_t set = props->set; set != 0; set &= set - 1) {
+        count++;
+    }
+    // pad_all expands to four LVGL properties (top, bottom, left, right)
+    if (props->set & LVML_STYLE_PROP_PAD_ALL) {
+        count += 3;
+    }
+    return count;
+}
+
+/**
+ * Memory an equivalent local style would take on one object:
+ * the lv_style_t itself plus one value and one property id per property
+ */
+static size_t style_local_cost(const lvml_style_props_t* props) {
+    return sizeof(lv_style_t) + style_prop_count(props) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+}
+
+static lvml_style_entry_t* style_entry(lv_style_t* style) {
+    return (lvml_style_entry_t*)((uint8_t*)style - offsetof(lvml_style_entry_t, style));
+}
+
+/**
+ * Release the shared style of an object being deleted. When it is the last
+ * user the style is detached first, so the object never points at freed
+ * memory while LVGL finishes deleting it.
+ */
+static void style_delete_cb(lv_event_t* e) {
+    lv_style_t* style = (lv_style_t*)lv_event_get_user_data(e);
+    lvml_style_entry_t* entry = style_entry(style);
+    if (entry->refs == 1) {
+        lv_obj_remove_style((lv_obj_t*)lv_event_get_target(e), style, LV_PART_MAIN);
+    }
+    lvml_style_release(style);
+}
+
+static void style_build(lv_style_t* style, const lvml_style_props_t* props) {
+    lv_style_init(style);
+
+    if (props->set & LVML_STYLE_PROP_BG_COLOR) {
+        lv_style_set_bg_color(style, lv_color_hex(props->bg_color));
+    }
+    if (props->set & LVML_STYLE_PROP_BG_OPA) {
+        lv_style_set_bg_opa(style, props->bg_opa);
+    }
+    if (props->set & LVML_STYLE_PROP_BORDER_COLOR) {
+        lv_style_set_border_color(style, lv_color_hex(props->border_color));
+    }
+    if (props->set & LVML_STYLE_PROP_BORDER_WIDTH) {
+        lv_style_set_border_width(style, props->border_width);
+    }
+    if (props->set & LVML_STYLE_PROP_BORDER_OPA) {
+        lv_style_set_border_opa(style, props->border_opa);
+    }
+    if (props->set & LVML_STYLE_PROP_TEXT_COLOR) {
+        lv_style_set_text_color(style, lv_color_hex(props->text_color));
+    }
+    if (props->set & LVML_STYLE_PROP_PAD_ALL) {
+        lv_style_set_pad_all(style, props->pad_all);
+    }
+    if (props->set & LVML_STYLE_PROP_RADIUS) {
+        lv_style_set_radius(style, props->radius);
+    }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file lvml_style.h
+ * @brief Interned, shared LVGL styles for LVML UI objects
+ *
+ * Objects created through the LVML API describe their look with a small
+ * property set. Identical property sets resolve to one shared lv_style_t
+ * instead of a local style per object. Styles are reference counted and
+ * freed when the last object using them is deleted.
+ */
+
+#ifndef LVML_STYLE_H
+#define LVML_STYLE_H
+
+#include "lvgl/lvgl.h"
+#include "lvml_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_STYLE_BUCKETS 64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Properties that can be part of an interned style
+ */
+typedef enum {
+    LVML_STYLE_PROP_BG_COLOR     = (1 << 0),
+    LVML_STYLE_PROP_BG_OPA       = (1 << 1),
+    LVML_STYLE_PROP_BORDER_COLOR = (1 << 2),
+    LVML_STYLE_PROP_BORDER_WIDTH = (1 << 3),
+    LVML_STYLE_PROP_BORDER_OPA   = (1 << 4),
+    LVML_STYLE_PROP_TEXT_COLOR   = (1 << 5),
+    LVML_STYLE_PROP_PAD_ALL      = (1 << 6),
+    LVML_STYLE_PROP_RADIUS       = (1 << 7),
+} lvml_style_prop_t;
+
+/**
+ * Property set describing one style (only fields flagged in `set` are used)
+ */
+typedef struct {
+    uint32_t set;                 // Bitmask of lvml_style_prop_t
+    uint32_t bg_color;            // 0xRRGGBB
+    uint32_t border_color;        // 0xRRGGBB
+    uint32_t text_color;          // 0xRRGGBB
+    int32_t border_width;
+    int32_t pad_all;
+    int32_t radius;
+    lv_opa_t bg_opa;
+    lv_opa_t border_opa;
+} lvml_style_props_t;
+
+/**
+ * Style interning statistics
+ */
+typedef struct {
+    uint32_t unique;              // Distinct styles currently allocated
+    uint32_t refs;                // Live objects using an interned style
+    size_t bytes_used;            // Memory held by the interned styles
+    size_t bytes_saved;           // Local style memory the live objects avoid by sharing
+} lvml_style_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Reset a property set to "no properties"
+ * @param props property set to clear
+ */
+void lvml_style_props_init(lvml_style_props_t* props);
+
+/**
+ * Get the shared style for a property set, creating it on first use, and
+ * take a reference to it
+ * @param props property set
+ * @return shared style or NULL when out of memory; release it with
+ *         lvml_style_release()
+ */
+lv_style_t* lvml_style_intern(const lvml_style_props_t* props);
+
+/**
+ * Drop a reference taken by lvml_style_intern(); the style is freed with
+ * the last one, so it must no longer be attached to any object
+ * @param style shared style
+ */
+void lvml_style_release(lv_style_t* style);
+
+/**
+ * Attach the shared style for a property set to an object's main part; the
+ * reference is released when the object is deleted
+ * @param obj target object
+ * @param props property set
+ * @return LVML_OK on success, error code on failure
+ */
+lvml_error_t lvml_style_apply(lv_obj_t* obj, const lvml_style_props_t* props);
+
+/**
+ * Get style interning statistics
+ * @param stats output statistics
+ */
+void lvml_style_get_stats(lvml_style_stats_t* stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_STYLE_H*/
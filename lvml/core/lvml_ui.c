@@ -5,7 +5,12 @@
 
 #include "lvml_ui.h"
 #include "lvml_core.h"
-#include "micropython/py/mphal.h"
+#include "lvml_style.h"
+#include "lvml_bind.h"
+#include "utils/lvml_hash.h"
+#include "utils/lvml_log.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_time.h"
 #include "lvgl/src/draw/lv_image_dsc.h"
 #include "lvgl/src/others/xml/lv_xml.h"
 #include "lvgl/src/others/xml/lv_xml_component.h"
@@ -13,11 +18,43 @@
 #include <string.h>
 
 
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_obj_t* ui_parent(void);
+static void ui_image_delete_cb(lv_event_t* e);
+static int ui_image_find(const char* name, size_t len);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
 
-// No static variables needed for background
+// Copy of the XML currently registered as the "wifi_settings" component;
+// the length and hash only spare the compare when the source changed
+static char* xml_registered = NULL;
+static size_t xml_registered_len = 0;
+static uint32_t xml_registered_hash = 0;
+
+// Root object of the last XML load, removed by lvml_ui_unload_xml()
+static lv_obj_t* xml_root = NULL;
+
+// Images registered with lvml_ui_register_image(); names are kept so
+// snapshots (lvml_state) can refer to images by name
+typedef struct {
+    uint32_t hash;
+    const lv_image_dsc_t* dsc;
+    char* name;
+} ui_image_t;
+
+static ui_image_t images[LVML_UI_IMAGES_MAX];
+static uint32_t images_cnt = 0;
+
+// Batch state: parent looked up once, union of the created objects' areas
+static bool batch_active = false;
+static lv_obj_t* batch_parent = NULL;
+static lv_area_t batch_area;
+static uint32_t batch_count = 0;
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -37,7 +74,7 @@ lvml_error_t lvml_ui_set_background(uint32_t color_hex) {
     // Set background color directly on the active screen
     lv_obj_t *current_screen = lv_screen_active();
     if (current_screen == NULL) {
-        mp_printf(&mp_plat_print, "Error: No active screen\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_UI, "No active screen");
         return LVML_ERROR_INVALID_PARAM;
     }
     lv_obj_set_style_bg_color(current_screen, lv_color, 0);
@@ -86,7 +123,7 @@ lvml_error_t lvml_ui_parse_color(const char* color_str, int color_int, uint32_t*
     return LVML_OK;
 }
 
-lvml_error_t lvml_ui_rect(int x, int y, int width, int height, uint32_t color_hex, uint32_t border_color_hex, int border_width) {
+lvml_error_t lvml_ui_rect(int x, int y, int width, int height, uint32_t color_hex, uint32_t border_color_hex, int border_width, lv_obj_t** out) {
     if (!lvml_core_is_initialized()) {
         return LVML_ERROR_INIT;
     }
@@ -101,7 +138,7 @@ lvml_error_t lvml_ui_rect(int x, int y, int width, int height, uint32_t color_he
     }
     
     // Create rectangle object
-    lv_obj_t* rect = lv_obj_create(lv_screen_active());
+    lv_obj_t* rect = lv_obj_create(ui_parent());
     if (rect == NULL) {
         return LVML_ERROR_MEMORY;
     }
@@ -110,37 +147,39 @@ lvml_error_t lvml_ui_rect(int x, int y, int width, int height, uint32_t color_he
     lv_obj_set_pos(rect, x, y);
     lv_obj_set_size(rect, width, height);
     
-    // Set fill color
-    uint8_t r = (color_hex >> 16) & 0xFF;
-    uint8_t g = (color_hex >> 8) & 0xFF;
-    uint8_t b = color_hex & 0xFF;
-    lv_color_t fill_color = lv_color_make(r, g, b);
-    lv_obj_set_style_bg_color(rect, fill_color, 0);
-    lv_obj_set_style_bg_opa(rect, LV_OPA_COVER, 0);
+    // Fill, border and padding come from one shared style per unique combination
+    lvml_style_props_t props;
+    lvml_style_props_init(&props);
+    props.set = LVML_STYLE_PROP_BG_COLOR | LVML_STYLE_PROP_BG_OPA |
+                LVML_STYLE_PROP_BORDER_WIDTH | LVML_STYLE_PROP_PAD_ALL | LVML_STYLE_PROP_RADIUS;
+    props.bg_color = color_hex & 0xFFFFFF;
+    props.bg_opa = LV_OPA_COVER;
+    props.pad_all = 0;  // Remove default padding and make it a simple rectangle
+    props.radius = 0;   // Square corners
     
     // Set border if specified
     if (border_width > 0 && border_color_hex != 0) {
-        uint8_t br = (border_color_hex >> 16) & 0xFF;
-        uint8_t bg = (border_color_hex >> 8) & 0xFF;
-        uint8_t bb = border_color_hex & 0xFF;
-        lv_color_t border_color = lv_color_make(br, bg, bb);
-        
-        lv_obj_set_style_border_color(rect, border_color, 0);
-        lv_obj_set_style_border_width(rect, border_width, 0);
-        lv_obj_set_style_border_opa(rect, LV_OPA_COVER, 0);
+        props.set |= LVML_STYLE_PROP_BORDER_COLOR | LVML_STYLE_PROP_BORDER_OPA;
+        props.border_color = border_color_hex & 0xFFFFFF;
+        props.border_width = border_width;
+        props.border_opa = LV_OPA_COVER;
     } else {
         // No border
-        lv_obj_set_style_border_width(rect, 0, 0);
+        props.border_width = 0;
     }
     
-    // Remove default padding and make it a simple rectangle
-    lv_obj_set_style_pad_all(rect, 0, 0);
-    lv_obj_set_style_radius(rect, 0, 0); // Square corners
+    if (lvml_style_apply(rect, &props) != LVML_OK) {
+        lv_obj_delete(rect);
+        return LVML_ERROR_MEMORY;
+    }
     
+    if (out != NULL) {
+        *out = rect;
+    }
     return LVML_OK;
 }
 
-lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* text, uint32_t bg_color_hex, uint32_t text_color_hex) {
+lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* text, uint32_t bg_color_hex, uint32_t text_color_hex, lv_obj_t** out) {
     if (!lvml_core_is_initialized()) {
         return LVML_ERROR_INIT;
     }
@@ -155,7 +194,7 @@ lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* tex
     }
     
     // Create button object
-    lv_obj_t* btn = lv_button_create(lv_screen_active());
+    lv_obj_t* btn = lv_button_create(ui_parent());
     if (btn == NULL) {
         return LVML_ERROR_MEMORY;
     }
@@ -165,12 +204,15 @@ lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* tex
     lv_obj_set_size(btn, width, height);
     
     // Set background color
-    uint8_t r = (bg_color_hex >> 16) & 0xFF;
-    uint8_t g = (bg_color_hex >> 8) & 0xFF;
-    uint8_t b = bg_color_hex & 0xFF;
-    lv_color_t bg_color = lv_color_make(r, g, b);
-    lv_obj_set_style_bg_color(btn, bg_color, 0);
-    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    lvml_style_props_t props;
+    lvml_style_props_init(&props);
+    props.set = LVML_STYLE_PROP_BG_COLOR | LVML_STYLE_PROP_BG_OPA;
+    props.bg_color = bg_color_hex & 0xFFFFFF;
+    props.bg_opa = LV_OPA_COVER;
+    if (lvml_style_apply(btn, &props) != LVML_OK) {
+        lv_obj_delete(btn);
+        return LVML_ERROR_MEMORY;
+    }
     
     // Add text label
     lv_obj_t* label = lv_label_create(btn);
@@ -183,16 +225,21 @@ lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* tex
     lv_obj_center(label);
     
     // Set text color
-    uint8_t tr = (text_color_hex >> 16) & 0xFF;
-    uint8_t tg = (text_color_hex >> 8) & 0xFF;
-    uint8_t tb = text_color_hex & 0xFF;
-    lv_color_t text_color = lv_color_make(tr, tg, tb);
-    lv_obj_set_style_text_color(label, text_color, 0);
+    lvml_style_props_init(&props);
+    props.set = LVML_STYLE_PROP_TEXT_COLOR;
+    props.text_color = text_color_hex & 0xFFFFFF;
+    if (lvml_style_apply(label, &props) != LVML_OK) {
+        lv_obj_delete(btn);
+        return LVML_ERROR_MEMORY;
+    }
     
+    if (out != NULL) {
+        *out = btn;
+    }
     return LVML_OK;
 }
 
-lvml_error_t lvml_ui_textarea(int x, int y, int width, int height, const char* placeholder, uint32_t bg_color_hex, uint32_t text_color_hex) {
+lvml_error_t lvml_ui_textarea(int x, int y, int width, int height, const char* placeholder, uint32_t bg_color_hex, uint32_t text_color_hex, lv_obj_t** out) {
     if (!lvml_core_is_initialized()) {
         return LVML_ERROR_INIT;
     }
@@ -203,7 +250,7 @@ lvml_error_t lvml_ui_textarea(int x, int y, int width, int height, const char* p
     }
     
     // Create text area object
-    lv_obj_t* ta = lv_textarea_create(lv_screen_active());
+    lv_obj_t* ta = lv_textarea_create(ui_parent());
     if (ta == NULL) {
         return LVML_ERROR_MEMORY;
     }
@@ -212,20 +259,17 @@ lvml_error_t lvml_ui_textarea(int x, int y, int width, int height, const char* p
     lv_obj_set_pos(ta, x, y);
     lv_obj_set_size(ta, width, height);
     
-    // Set background color
-    uint8_t r = (bg_color_hex >> 16) & 0xFF;
-    uint8_t g = (bg_color_hex >> 8) & 0xFF;
-    uint8_t b = bg_color_hex & 0xFF;
-    lv_color_t bg_color = lv_color_make(r, g, b);
-    lv_obj_set_style_bg_color(ta, bg_color, 0);
-    lv_obj_set_style_bg_opa(ta, LV_OPA_COVER, 0);
-    
-    // Set text color
-    uint8_t tr = (text_color_hex >> 16) & 0xFF;
-    uint8_t tg = (text_color_hex >> 8) & 0xFF;
-    uint8_t tb = text_color_hex & 0xFF;
-    lv_color_t text_color = lv_color_make(tr, tg, tb);
-    lv_obj_set_style_text_color(ta, text_color, 0);
+    // Set background and text color
+    lvml_style_props_t props;
+    lvml_style_props_init(&props);
+    props.set = LVML_STYLE_PROP_BG_COLOR | LVML_STYLE_PROP_BG_OPA | LVML_STYLE_PROP_TEXT_COLOR;
+    props.bg_color = bg_color_hex & 0xFFFFFF;
+    props.bg_opa = LV_OPA_COVER;
+    props.text_color = text_color_hex & 0xFFFFFF;
+    if (lvml_style_apply(ta, &props) != LVML_OK) {
+        lv_obj_delete(ta);
+        return LVML_ERROR_MEMORY;
+    }
     
     // Set placeholder text if provided
     if (placeholder != NULL) {
@@ -235,10 +279,13 @@ lvml_error_t lvml_ui_textarea(int x, int y, int width, int height, const char* p
     // Enable text input
     lv_obj_add_state(ta, LV_STATE_FOCUSED);
     
+    if (out != NULL) {
+        *out = ta;
+    }
     return LVML_OK;
 }
 
-lvml_error_t lvml_ui_show_image_data(const uint8_t* png_data, size_t data_size, int x, int y) {
+lvml_error_t lvml_ui_show_image_data(const uint8_t* png_data, size_t data_size, int x, int y, lv_obj_t** out) {
     if (!lvml_core_is_initialized()) {
         return LVML_ERROR_INIT;
     }
@@ -247,24 +294,26 @@ lvml_error_t lvml_ui_show_image_data(const uint8_t* png_data, size_t data_size,
         return LVML_ERROR_INVALID_PARAM;
     }
     
-    // Create image object
-    lv_obj_t* img = lv_image_create(lv_screen_active());
-    if (img == NULL) {
-        return LVML_ERROR_MEMORY;
-    }
-    
-    // Create a proper image descriptor for PNG data
-    lv_image_dsc_t *imgDesc = (lv_image_dsc_t*)malloc(sizeof(lv_image_dsc_t));
+    // The image decodes from its data whenever it is drawn, so it owns a
+    // copy, right behind the descriptor, until the object is deleted
+    lv_image_dsc_t *imgDesc = (lv_image_dsc_t*)lvml_mem_alloc_large(sizeof(lv_image_dsc_t) + data_size);
     if (!imgDesc) {
-        mp_printf(&mp_plat_print, "Failed to allocate memory for image descriptor");
+        LVML_LOG_ERROR(LVML_LOG_MOD_UI, "Failed to allocate memory for image data");
         return LVML_ERROR_MEMORY;
     }
-    
-    // Initialize the descriptor with PNG data
     memset(imgDesc, 0, sizeof(lv_image_dsc_t));
-    imgDesc->data = png_data;
+    memcpy(imgDesc + 1, png_data, data_size);
+    imgDesc->data = (const uint8_t*)(imgDesc + 1);
     imgDesc->data_size = data_size;
     
+    // Create image object
+    lv_obj_t* img = lv_image_create(lv_screen_active());
+    if (img == NULL) {
+        lvml_mem_free_large(imgDesc);
+        return LVML_ERROR_MEMORY;
+    }
+    lv_obj_add_event_cb(img, ui_image_delete_cb, LV_EVENT_DELETE, imgDesc);
+    
     // Set the image source - this will be detected as LV_IMAGE_SRC_VARIABLE
     lv_image_set_src(img, imgDesc);
     
@@ -276,10 +325,152 @@ lvml_error_t lvml_ui_show_image_data(const uint8_t* png_data, size_t data_size,
         lv_obj_set_pos(img, x, y);
     }
 
+    if (out != NULL) {
+        *out = img;
+    }
+    return LVML_OK;
+}
+
+lvml_error_t lvml_ui_batch_begin(void) {
+    if (!lvml_core_is_initialized()) {
+        return LVML_ERROR_INIT;
+    }
+    if (batch_active) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    
+    batch_parent = lv_screen_active();
+    batch_count = 0;
+    batch_active = true;
+    
+    // Objects invalidate themselves as they are created and styled; collect
+    // their areas instead and invalidate the union once in lvml_ui_batch_end()
+    lv_display_enable_invalidation(lv_obj_get_display(batch_parent), false);
+    return LVML_OK;
+}
+
+lvml_error_t lvml_ui_batch_create(const lvml_ui_cmd_t* cmd, lv_obj_t** out) {
+    if (cmd == NULL || !batch_active) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    
+    lvml_error_t result;
+    switch (cmd->op) {
+        case LVML_UI_CMD_RECT:
+            result = lvml_ui_rect(cmd->x, cmd->y, cmd->width, cmd->height,
+                                  cmd->color, cmd->color2, cmd->border_width, out);
+            break;
+        case LVML_UI_CMD_BUTTON:
+            result = lvml_ui_button(cmd->x, cmd->y, cmd->width, cmd->height,
+                                    cmd->text != NULL ? cmd->text : "", cmd->color, cmd->color2, out);
+            break;
+        case LVML_UI_CMD_TEXTAREA:
+            result = lvml_ui_textarea(cmd->x, cmd->y, cmd->width, cmd->height,
+                                      cmd->text, cmd->color, cmd->color2, out);
+            break;
+        default:
+            return LVML_ERROR_INVALID_PARAM;
+    }
+    if (result != LVML_OK) {
+        return result;
+    }
+    
+    lv_area_t area = {
+        .x1 = cmd->x,
+        .y1 = cmd->y,
+        .x2 = cmd->x + cmd->width - 1,
+        .y2 = cmd->y + cmd->height - 1,
+    };
+    if (batch_count == 0) {
+        batch_area = area;
+    } else {
+        lv_area_join(&batch_area, &batch_area, &area);
+    }
+    batch_count++;
     return LVML_OK;
 }
 
+void lvml_ui_batch_end(void) {
+    if (!batch_active) {
+        return;
+    }
+    
+    batch_active = false;
+    lv_obj_t* parent = batch_parent;
+    batch_parent = NULL;
+    lv_display_enable_invalidation(lv_obj_get_display(parent), true);
+    if (batch_count > 0) {
+        // Areas are relative to the screen, which covers the display
+        lv_obj_invalidate_area(parent, &batch_area);
+    }
+}
+
+lvml_error_t lvml_ui_register_image(const char* name, const uint8_t* png_data, size_t data_size) {
+    if (!lvml_core_is_initialized()) {
+        return LVML_ERROR_INIT;
+    }
+    
+    if (name == NULL || png_data == NULL || data_size == 0) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    
+    size_t name_len = strlen(name);
+    if (ui_image_find(name, name_len) >= 0) {
+        return LVML_OK;
+    }
+    if (images_cnt == LVML_UI_IMAGES_MAX) {
+        return LVML_ERROR_MEMORY;
+    }
+    
+    // Registered images stay alive for the rest of the session
+    uint8_t* data = (uint8_t*)lvml_mem_alloc_large(data_size);
+    lv_image_dsc_t* dsc = (lv_image_dsc_t*)malloc(sizeof(lv_image_dsc_t));
+    char* name_copy = (char*)malloc(name_len + 1);
+    if (data == NULL || dsc == NULL || name_copy == NULL) {
+        lvml_mem_free_large(data);
+        free(dsc);
+        free(name_copy);
+        return LVML_ERROR_MEMORY;
+    }
+    memcpy(data, png_data, data_size);
+    memset(dsc, 0, sizeof(lv_image_dsc_t));
+    dsc->data = data;
+    dsc->data_size = data_size;
+    memcpy(name_copy, name, name_len + 1);
+    
+    if (lv_xml_register_image(NULL, name, dsc) != LV_RESULT_OK) {
+        lvml_mem_free_large(data);
+        free(dsc);
+        free(name_copy);
+        return LVML_ERROR_MEMORY;
+    }
+    images[images_cnt].hash = lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, name, name_len);
+    images[images_cnt].dsc = dsc;
+    images[images_cnt].name = name_copy;
+    images_cnt++;
+    
+    return LVML_OK;
+}
+
+const char* lvml_ui_find_image_name(const void* src) {
+    for (uint32_t i = 0; i < images_cnt; i++) {
+        if (images[i].dsc == src) {
+            return images[i].name;
+        }
+    }
+    return NULL;
+}
+
+const void* lvml_ui_find_image(const char* name, size_t len) {
+    int index = ui_image_find(name, len);
+    return index >= 0 ? images[index].dsc : NULL;
+}
+
 lvml_error_t lvml_ui_load_xml(const char* xml_content) {
+    return lvml_ui_load_xml_profile(xml_content, NULL);
+}
+
+lvml_error_t lvml_ui_load_xml_profile(const char* xml_content, lvml_xml_profile_t* profile) {
     if (!lvml_core_is_initialized()) {
         return LVML_ERROR_INIT;
     }
@@ -295,22 +486,137 @@ lvml_error_t lvml_ui_load_xml(const char* xml_content) {
         xml_initialized = true;
     }
     
-    // Register the XML component from data
-    lv_result_t result = lv_xml_component_register_from_data("wifi_settings", xml_content);
-    if (result != LV_RESULT_OK) {
-        mp_printf(&mp_plat_print, "Failed to register XML component: %d\n", result);
-        return LVML_ERROR_XML_PARSE;
+    if (profile != NULL) {
+        lvml_error_t begin_result = lvml_xml_profile_begin(profile);
+        if (begin_result != LVML_OK) {
+            return begin_result;
+        }
+    }
+    
+    // Subjects referenced by bind_* attributes must exist before the
+    // component is instantiated, otherwise the bindings are dropped
+    int64_t start_us = lvml_time_us();
+    lvml_error_t bind_result = lvml_bind_prepare_xml(xml_content);
+    if (profile != NULL) {
+        profile->bind_us = (uint32_t)(lvml_time_us() - start_us);
+    }
+    if (bind_result != LVML_OK) {
+        lvml_xml_profile_end(profile, NULL);
+        return bind_result;
+    }
+    
+    // Register the XML component from data. Re-registering identical XML would
+    // build a fresh copy of every <styles> entry, so reuse the registered
+    // component (and its shared styles) when the content has not changed.
+    size_t xml_len = strlen(xml_content);
+    uint32_t xml_hash = lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, xml_content, xml_len);
+    bool unchanged = xml_registered != NULL && xml_len == xml_registered_len && xml_hash == xml_registered_hash &&
+                     memcmp(xml_registered, xml_content, xml_len) == 0;
+    if (!unchanged) {
+        // Whatever LVGL holds after a failed registration isn't this copy
+        lvml_mem_free_large(xml_registered);
+        xml_registered = NULL;
+        
+        int32_t start_mem = profile != NULL ? lvml_xml_profile_mem_used() : 0;
+        start_us = lvml_time_us();
+        lv_result_t result = lv_xml_component_register_from_data("wifi_settings", xml_content);
+        if (profile != NULL) {
+            profile->parse_us = (uint32_t)(lvml_time_us() - start_us);
+            profile->parse_bytes = lvml_xml_profile_mem_used() - start_mem;
+        }
+        if (result != LV_RESULT_OK) {
+            LVML_LOG_ERROR(LVML_LOG_MOD_UI, "Failed to register XML component: %d", result);
+            lvml_xml_profile_end(profile, NULL);
+            return LVML_ERROR_XML_PARSE;
+        }
+        // Without a copy the next load simply registers again
+        xml_registered = (char*)lvml_mem_alloc_large(xml_len);
+        if (xml_registered != NULL) {
+            memcpy(xml_registered, xml_content, xml_len);
+            xml_registered_len = xml_len;
+            xml_registered_hash = xml_hash;
+        }
+    } else if (profile != NULL) {
+        profile->parse_cached = true;
     }
     
     // Create the component on the active screen
+    int32_t start_mem = profile != NULL ? lvml_xml_profile_mem_used() : 0;
+    start_us = lvml_time_us();
     lv_obj_t* obj = (lv_obj_t*)lv_xml_create(lv_screen_active(), "wifi_settings", NULL);
+    if (profile != NULL) {
+        profile->create_us = (uint32_t)(lvml_time_us() - start_us);
+        profile->create_bytes = lvml_xml_profile_mem_used() - start_mem;
+    }
+    lvml_xml_profile_end(profile, obj);
     if (obj == NULL) {
-        mp_printf(&mp_plat_print, "Failed to create XML component\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_UI, "Failed to create XML component");
         return LVML_ERROR_MEMORY;
     }
     
     // Center the component on screen
     lv_obj_center(obj);
+    xml_root = obj;
+    
+    return LVML_OK;
+}
+
+void lvml_ui_set_xml_root(lv_obj_t* obj) {
+    xml_root = obj;
+}
+
+lv_obj_t* lvml_ui_get_xml_root(void) {
+    // The root may already have been deleted by the application
+    if (xml_root != NULL && !lv_obj_is_valid(xml_root)) {
+        xml_root = NULL;
+    }
+    return xml_root;
+}
+
+lvml_error_t lvml_ui_unload_xml(void) {
+    if (!lvml_core_is_initialized()) {
+        return LVML_ERROR_INIT;
+    }
+    
+    // The root may already have been deleted by the application
+    if (xml_root != NULL && lv_obj_is_valid(xml_root)) {
+        lv_obj_delete(xml_root);
+    }
+    xml_root = NULL;
     
     return LVML_OK;
 }
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Parent for new objects: the active screen, looked up once per batch
+ */
+static lv_obj_t* ui_parent(void) {
+    return batch_active ? batch_parent : lv_screen_active();
+}
+
+/**
+ * An image from lvml_ui_show_image_data() is deleted: free its copy of the data
+ */
+static void ui_image_delete_cb(lv_event_t* e) {
+    lv_image_dsc_t* dsc = (lv_image_dsc_t*)lv_event_get_user_data(e);
+    // Decoded pixels are cached by source; the next image may reuse the address
+    lv_image_cache_drop(dsc);
+    lvml_mem_free_large(dsc);
+}
+
+/**
+ * Index of a registered image; the hash only skips the string compare
+ */
+static int ui_image_find(const char* name, size_t len) {
+    uint32_t hash = lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, name, len);
+    for (uint32_t i = 0; i < images_cnt; i++) {
+        if (images[i].hash == hash && strncmp(images[i].name, name, len) == 0 && images[i].name[len] == '\0') {
+            return (int)i;
+        }
+    }
+    return -1;
+}
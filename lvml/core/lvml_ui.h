@@ -9,11 +9,50 @@
 #include "micropython/py/runtime.h"
 #include "lvgl/lvgl.h"
 #include "lvml_core.h"
+#include "xml/lvml_xml_profile.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_UI_IMAGES_MAX 32   // Images registered with lvml_ui_register_image()
+
+// Packed batch command: LVML_UI_CMD_WORDS little-endian int32 words per object,
+// op, x, y, width, height, color, color2, arg (see lvml_ui_cmd_t)
+#define LVML_UI_CMD_WORDS 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Objects lvml_ui_batch_create() can create
+ */
+typedef enum {
+    LVML_UI_CMD_RECT = 0,
+    LVML_UI_CMD_BUTTON,
+    LVML_UI_CMD_TEXTAREA,
+} lvml_ui_cmd_op_t;
+
+/**
+ * One object of a batch
+ */
+typedef struct {
+    lvml_ui_cmd_op_t op;
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+    uint32_t color;         // Fill / background color (0xRRGGBB)
+    uint32_t color2;        // Border color for rects, text color otherwise
+    int32_t border_width;   // Rects only
+    const char* text;       // Button text or text area placeholder, may be NULL
+} lvml_ui_cmd_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -43,9 +82,10 @@ lvml_error_t lvml_ui_parse_color(const char* color_str, int color_int, uint32_t*
  * @param color_hex fill color (0xRRGGBB format)
  * @param border_color_hex border color (0xRRGGBB format), 0 for no border
  * @param border_width border width, 0 for no border
+ * @param out receives the created object (may be NULL)
  * @return LVML_OK on success, error code on failure
  */
-lvml_error_t lvml_ui_rect(int x, int y, int width, int height, uint32_t color_hex, uint32_t border_color_hex, int border_width);
+lvml_error_t lvml_ui_rect(int x, int y, int width, int height, uint32_t color_hex, uint32_t border_color_hex, int border_width, lv_obj_t** out);
 
 /**
  * Create a button object
@@ -56,9 +96,10 @@ lvml_error_t lvml_ui_rect(int x, int y, int width, int height, uint32_t color_he
  * @param text button text
  * @param bg_color_hex background color (0xRRGGBB format)
  * @param text_color_hex text color (0xRRGGBB format)
+ * @param out receives the created button (may be NULL)
  * @return LVML_OK on success, error code on failure
  */
-lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* text, uint32_t bg_color_hex, uint32_t text_color_hex);
+lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* text, uint32_t bg_color_hex, uint32_t text_color_hex, lv_obj_t** out);
 
 /**
  * Create a text area object
@@ -69,19 +110,67 @@ lvml_error_t lvml_ui_button(int x, int y, int width, int height, const char* tex
  * @param placeholder placeholder text
  * @param bg_color_hex background color (0xRRGGBB format)
  * @param text_color_hex text color (0xRRGGBB format)
+ * @param out receives the created text area (may be NULL)
  * @return LVML_OK on success, error code on failure
  */
-lvml_error_t lvml_ui_textarea(int x, int y, int width, int height, const char* placeholder, uint32_t bg_color_hex, uint32_t text_color_hex);
+lvml_error_t lvml_ui_textarea(int x, int y, int width, int height, const char* placeholder, uint32_t bg_color_hex, uint32_t text_color_hex, lv_obj_t** out);
 
 /**
- * Display an image from raw PNG data
+ * Display an image from raw PNG data; the image keeps a copy of the data
+ * until it is deleted
  * @param png_data raw PNG data bytes
  * @param data_size size of PNG data
  * @param x x position (optional, -1 for center)
  * @param y y position (optional, -1 for center)
+ * @param out receives the created image (may be NULL)
  * @return LVML_OK on success, error code on failure
  */
-lvml_error_t lvml_ui_show_image_data(const uint8_t* png_data, size_t data_size, int x, int y);
+lvml_error_t lvml_ui_show_image_data(const uint8_t* png_data, size_t data_size, int x, int y, lv_obj_t** out);
+
+/**
+ * Start a batch: until lvml_ui_batch_end() the active screen is looked up
+ * once and display invalidation is suspended
+ * @return LVML_OK on success, LVML_ERROR_INVALID_PARAM if a batch is already active
+ */
+lvml_error_t lvml_ui_batch_begin(void);
+
+/**
+ * Create one object of the current batch
+ * @param cmd object to create
+ * @param out receives the created object (may be NULL)
+ * @return LVML_OK on success, error code on failure
+ */
+lvml_error_t lvml_ui_batch_create(const lvml_ui_cmd_t* cmd, lv_obj_t** out);
+
+/**
+ * End the batch and invalidate the area covered by its objects once
+ */
+void lvml_ui_batch_end(void);
+
+/**
+ * Register PNG data as a named image for XML documents (<image src="name">).
+ * The data is copied; names that are already registered are kept.
+ * @param name image name
+ * @param png_data raw PNG data bytes
+ * @param data_size size of PNG data
+ * @return LVML_OK on success, error code on failure
+ */
+lvml_error_t lvml_ui_register_image(const char* name, const uint8_t* png_data, size_t data_size);
+
+/**
+ * Look up the name an image was registered under
+ * @param src image source (lv_image_get_src())
+ * @return name, or NULL if src isn't a registered image
+ */
+const char* lvml_ui_find_image_name(const void* src);
+
+/**
+ * Look up a registered image
+ * @param name image name, need not be NUL-terminated
+ * @param len length of name
+ * @return image descriptor, or NULL if no image has that name
+ */
+const void* lvml_ui_find_image(const char* name, size_t len);
 
 /**
  * Clean up an image object and free its PSRAM memory
@@ -97,6 +186,35 @@ lvml_error_t lvml_ui_cleanup_image(lv_obj_t* img);
  */
 lvml_error_t lvml_ui_load_xml(const char* xml_content);
 
+/**
+ * Load and render UI from XML content, recording parse, per-element
+ * instantiation time and LVGL heap usage
+ * @param xml_content XML content string
+ * @param profile profile to fill (NULL to load without profiling);
+ *                release with lvml_xml_profile_free()
+ * @return LVML_OK on success, error code on failure
+ */
+lvml_error_t lvml_ui_load_xml_profile(const char* xml_content, lvml_xml_profile_t* profile);
+
+/**
+ * Adopt an object as the XML root, e.g. one recreated from a snapshot, so
+ * lvml_ui_unload_xml() and name lookups use it
+ * @param obj root object (NULL to forget the current one)
+ */
+void lvml_ui_set_xml_root(lv_obj_t* obj);
+
+/**
+ * Get the root object of the last XML load
+ * @return root object, or NULL if nothing is loaded
+ */
+lv_obj_t* lvml_ui_get_xml_root(void);
+
+/**
+ * Delete the UI created by the last XML load
+ * @return LVML_OK on success, error code on failure
+ */
+lvml_error_t lvml_ui_unload_xml(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
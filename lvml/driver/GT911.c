@@ -10,21 +10,32 @@
  */
 
 #include "GT911.h"
-#include "driver/i2c.h"
+#include "utils/lvml_boot.h"
+#include "driver/i2c_master.h"
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "string.h"
 
 static const char *TAG = "GT911";
 
 // Static variables for interrupt handling
 static volatile bool gt911_irq = false;
+static volatile int64_t gt911_irq_time_us = 0;
+static TaskHandle_t gt911_irq_task = NULL;
 static gpio_num_t int_pin = GPIO_NUM_NC;
 static gpio_num_t rst_pin = GPIO_NUM_NC;
 static uint8_t i2c_addr = GT911_I2C_ADDR_BA;
 static i2c_port_t i2c_port = I2C_NUM_0;
+static i2c_master_bus_handle_t i2c_bus = NULL;
+static i2c_master_dev_handle_t i2c_dev = NULL;
+static volatile uint32_t i2c_errors = 0;
+
+// Clearing the status register is queued and not waited for, so the
+// buffer has to outlive the call
+static const uint8_t clear_status_cmd[3] = { GT911_REG_COORD_ADDR >> 8, GT911_REG_COORD_ADDR & 0xFF, 0 };
 
 // GT911 instance data
 static bool config_loaded = false;
@@ -32,27 +43,38 @@ static GTConfig gt_config;
 static GTInfo gt_info;
 static GTPoint gt_points[GT911_MAX_CONTACTS];
 static GT911_Rotate_t rotation = GT911_ROTATE_0;
+static uint32_t transfer_count = 0;
 
 // Forward declarations
 static void gt911_reset(void);
-static esp_err_t gt911_i2c_start(uint16_t reg);
-static esp_err_t gt911_write(uint16_t reg, uint8_t data);
+static bool gt911_trans_done(i2c_master_dev_handle_t dev, const i2c_master_event_data_t *evt, void *arg);
+static esp_err_t gt911_wait(void);
 static uint8_t gt911_read(uint16_t reg);
 static esp_err_t gt911_write_bytes(uint16_t reg, uint8_t *data, uint16_t size);
 static esp_err_t gt911_read_bytes(uint16_t reg, uint8_t *data, uint16_t size);
 static uint8_t gt911_calc_checksum(uint8_t *buf, uint8_t len);
 static uint8_t gt911_read_checksum(void);
 static int8_t gt911_read_touches(void);
-static bool gt911_read_touch_points(void);
+static void gt911_bus_delete(void);
 
 /**
  * @brief IRQ handler for GT911 interrupt pin
  * 
  * This function is called when the GT911 interrupt pin triggers.
- * It sets the global interrupt flag that can be checked by the main code.
+ * It sets the global interrupt flag that can be checked by the main code,
+ * records when it happened and wakes the task registered with
+ * gt911_set_irq_task(), if any.
  */
 static void IRAM_ATTR gt911_irq_handler(void *arg) {
     gt911_irq = true;
+    gt911_irq_time_us = esp_timer_get_time();
+    
+    TaskHandle_t task = gt911_irq_task;
+    if (task != NULL) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
 }
 
 /**
@@ -104,39 +126,28 @@ static void gt911_reset(void) {
 }
 
 /**
- * @brief Start I2C transmission to a specific register
+ * @brief Transaction completion callback, runs in the I2C interrupt
  * 
- * @param reg Register address to write to
- * @return esp_err_t ESP_OK on success, error code on failure
+ * The bus runs asynchronously, so a NACK or timeout is only known here.
  */
-static esp_err_t gt911_i2c_start(uint16_t reg) {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (i2c_addr << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg >> 8, true);
-    i2c_master_write_byte(cmd, reg & 0xFF, true);
-    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, 1000 / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
-    return ret;
+static bool IRAM_ATTR gt911_trans_done(i2c_master_dev_handle_t dev, const i2c_master_event_data_t *evt, void *arg) {
+    if (evt->event != I2C_EVENT_DONE) {
+        i2c_errors++;
+    }
+    return false;
 }
 
 /**
- * @brief Write a single byte to a GT911 register
+ * @brief Wait for all queued transactions to finish
  * 
- * @param reg Register address
- * @param data Data to write
- * @return esp_err_t ESP_OK on success, error code on failure
+ * @return esp_err_t ESP_OK if they finished without a NACK or timeout
  */
-static esp_err_t gt911_write(uint16_t reg, uint8_t data) {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (i2c_addr << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg >> 8, true);
-    i2c_master_write_byte(cmd, reg & 0xFF, true);
-    i2c_master_write_byte(cmd, data, true);
-    i2c_master_stop(cmd);
-    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, 1000 / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
+static esp_err_t gt911_wait(void) {
+    uint32_t errors = i2c_errors;
+    esp_err_t ret = i2c_master_bus_wait_all_done(i2c_bus, GT911_I2C_TIMEOUT_MS);
+    if (ret == ESP_OK && i2c_errors != errors) {
+        ret = ESP_FAIL;
+    }
     return ret;
 }
 
@@ -147,27 +158,12 @@ static esp_err_t gt911_write(uint16_t reg, uint8_t data) {
  * @return uint8_t Read value, 0 on error
  */
 static uint8_t gt911_read(uint16_t reg) {
-    // Start transmission to set register
-    esp_err_t ret = gt911_i2c_start(reg);
-    if (ret != ESP_OK) {
-        return 0;
-    }
-    
-    // Read from register
     uint8_t data = 0;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (i2c_addr << 1) | I2C_MASTER_READ, true);
-    i2c_master_read_byte(cmd, &data, I2C_MASTER_NACK);
-    i2c_master_stop(cmd);
-    ret = i2c_master_cmd_begin(i2c_port, cmd, 1000 / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
-    
-    return (ret == ESP_OK) ? data : 0;
+    return (gt911_read_bytes(reg, &data, 1) == ESP_OK) ? data : 0;
 }
 
 /**
- * @brief Write multiple bytes to GT911 registers
+ * @brief Write multiple bytes to GT911 registers and wait for the write
  * 
  * @param reg Starting register address
  * @param data Data buffer to write
@@ -175,47 +171,36 @@ static uint8_t gt911_read(uint16_t reg) {
  * @return esp_err_t ESP_OK on success, error code on failure
  */
 static esp_err_t gt911_write_bytes(uint16_t reg, uint8_t *data, uint16_t size) {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (i2c_addr << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg >> 8, true);
-    i2c_master_write_byte(cmd, reg & 0xFF, true);
-    
-    for (uint16_t i = 0; i < size; i++) {
-        i2c_master_write_byte(cmd, data[i], true);
+    uint8_t buf[2 + sizeof(GTConfig)];
+    if (size > sizeof(buf) - 2) {
+        return ESP_ERR_INVALID_SIZE;
     }
+    buf[0] = reg >> 8;
+    buf[1] = reg & 0xFF;
+    memcpy(buf + 2, data, size);
     
-    i2c_master_stop(cmd);
-    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, 1000 / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
-    return ret;
+    transfer_count++;
+    esp_err_t ret = i2c_master_transmit(i2c_dev, buf, size + 2, GT911_I2C_TIMEOUT_MS);
+    return ret == ESP_OK ? gt911_wait() : ret;
 }
 
 /**
  * @brief Read multiple bytes from GT911 registers
  * 
+ * The register address write and the read are one transaction with a
+ * repeated start.
+ * 
  * @param reg Starting register address
  * @param data Data buffer to read into
  * @param size Number of bytes to read
  * @return esp_err_t ESP_OK on success, error code on failure
  */
 static esp_err_t gt911_read_bytes(uint16_t reg, uint8_t *data, uint16_t size) {
-    // Start transmission to set register
-    esp_err_t ret = gt911_i2c_start(reg);
-    if (ret != ESP_OK) {
-        return ret;
-    }
+    uint8_t addr[2] = { reg >> 8, reg & 0xFF };
     
-    // Read data
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (i2c_addr << 1) | I2C_MASTER_READ, true);
-    i2c_master_read(cmd, data, size, I2C_MASTER_LAST_NACK);
-    i2c_master_stop(cmd);
-    ret = i2c_master_cmd_begin(i2c_port, cmd, 1000 / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
-    
-    return ret;
+    transfer_count++;
+    esp_err_t ret = i2c_master_transmit_receive(i2c_dev, addr, sizeof(addr), data, size, GT911_I2C_TIMEOUT_MS);
+    return ret == ESP_OK ? gt911_wait() : ret;
 }
 
 /**
@@ -243,21 +228,20 @@ static uint8_t gt911_read_checksum(void) {
 }
 
 /**
- * @brief Read touch count from GT911 status register
+ * @brief Wait for a touch frame and read it
  * 
- * This function polls the GT911 status register to check for valid touch data.
- * It waits for the touch flag to be set and validates the touch count.
+ * Polls the status register for up to 20 ms, reading the status and the
+ * points in one burst each time.
  * 
- * @return int8_t Number of touches (0-5), -1 on error
+ * @return int8_t Number of touches (0-5), 0 if no frame arrived
  */
 static int8_t gt911_read_touches(void) {
     uint32_t timeout = xTaskGetTickCount() + pdMS_TO_TICKS(20);
     
     do {
-        uint8_t flag = gt911_read(GT911_REG_COORD_ADDR);
-        if ((flag & 0x80) && ((flag & 0x0F) < GT911_MAX_CONTACTS)) {
-            gt911_write(GT911_REG_COORD_ADDR, 0); // Clear status register
-            return flag & 0x0F;
+        int8_t contacts = gt911_read_frame(gt_points);
+        if (contacts >= 0) {
+            return contacts;
         }
         vTaskDelay(pdMS_TO_TICKS(1));
     } while (xTaskGetTickCount() < timeout);
@@ -265,30 +249,6 @@ static int8_t gt911_read_touches(void) {
     return 0;
 }
 
-/**
- * @brief Read touch point data from GT911
- * 
- * Reads the actual touch coordinate data from the GT911 controller.
- * Applies rotation if configured.
- * 
- * @return bool true on success, false on failure
- */
-static bool gt911_read_touch_points(void) {
-    bool result = (gt911_read_bytes(GT911_REG_COORD_ADDR + 1, (uint8_t*)gt_points, 
-                                   sizeof(GTPoint) * GT911_MAX_CONTACTS) == ESP_OK);
-    
-    if (result && rotation != GT911_ROTATE_0) {
-        for (uint8_t i = 0; i < GT911_MAX_CONTACTS; i++) {
-            if (rotation == GT911_ROTATE_180) {
-                gt_points[i].x = gt_info.xResolution - gt_points[i].x;
-                gt_points[i].y = gt_info.yResolution - gt_points[i].y;
-            }
-        }
-    }
-    
-    return result;
-}
-
 // Public API functions
 
 /**
@@ -313,33 +273,46 @@ bool gt911_begin(gpio_num_t int_pin_num, gpio_num_t rst_pin_num, uint8_t addr,
     
     ESP_LOGI(TAG, "Initializing GT911 on I2C port %d, address 0x%02X", i2c_port, i2c_addr);
     
-    // Configure I2C
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
+    // Create the bus; a transaction queue makes it asynchronous, so writes
+    // nobody waits for (clearing the status register) don't block the caller
+    i2c_master_bus_config_t bus_conf = {
+        .i2c_port = i2c_port,
         .sda_io_num = sda_pin,
         .scl_io_num = scl_pin,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = clk_freq,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .trans_queue_depth = GT911_I2C_QUEUE_DEPTH,
+        .flags.enable_internal_pullup = true,
     };
-    
-    esp_err_t ret = i2c_param_config(i2c_port, &conf);
+    esp_err_t ret = i2c_new_master_bus(&bus_conf, &i2c_bus);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "I2C param config failed: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "I2C bus creation failed: %s", esp_err_to_name(ret));
         return false;
     }
     
-    ret = i2c_driver_install(i2c_port, conf.mode, 0, 0, 0);
+    i2c_device_config_t dev_conf = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = i2c_addr,
+        .scl_speed_hz = clk_freq,
+    };
+    ret = i2c_master_bus_add_device(i2c_bus, &dev_conf, &i2c_dev);
+    if (ret == ESP_OK) {
+        i2c_master_event_callbacks_t cbs = { .on_trans_done = gt911_trans_done };
+        ret = i2c_master_register_event_callbacks(i2c_dev, &cbs, NULL);
+    }
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "I2C driver install failed: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "I2C device setup failed: %s", esp_err_to_name(ret));
+        gt911_bus_delete();
         return false;
     }
+    lvml_boot_mark("gt911_bus");
     
     // Reset if reset pin is valid
     if (rst_pin != GPIO_NUM_NC) {
         vTaskDelay(pdMS_TO_TICKS(300));
         gt911_reset();
         vTaskDelay(pdMS_TO_TICKS(200));
+        lvml_boot_mark("gt911_reset");
     }
     
     // Configure interrupt pin if valid
@@ -357,18 +330,16 @@ bool gt911_begin(gpio_num_t int_pin_num, gpio_num_t rst_pin_num, uint8_t addr,
     }
     
     // Test I2C communication
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (i2c_addr << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_stop(cmd);
-    ret = i2c_master_cmd_begin(i2c_port, cmd, 1000 / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
-    
+    ret = i2c_master_probe(i2c_bus, i2c_addr, GT911_I2C_TIMEOUT_MS);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "I2C communication test failed: %s", esp_err_to_name(ret));
-        i2c_driver_delete(i2c_port);
+        if (int_pin != GPIO_NUM_NC) {
+            gpio_isr_handler_remove(int_pin);
+        }
+        gt911_bus_delete();
         return false;
     }
+    lvml_boot_mark("gt911_probe");
     
     // Read device info
     gt911_read_info();
@@ -457,16 +428,73 @@ uint8_t gt911_touched(uint8_t mode) {
         irq = true;
     }
     
-    uint8_t contacts = 0;
-    if (irq) {
-        contacts = gt911_read_touches();
-        
-        if (contacts > 0) {
-            gt911_read_touch_points();
+    return irq ? gt911_read_touches() : 0;
+}
+
+/**
+ * @brief Read one touch frame without waiting
+ * 
+ * Reads the status register and all touch points in one I2C transaction.
+ * If the controller has a new frame, clearing the status register is
+ * queued on the bus and the points are copied out with rotation applied.
+ * 
+ * @param points Output array of GT911_MAX_CONTACTS points
+ * @return int8_t Number of touches (0-5), -1 if no new frame or on error
+ */
+int8_t gt911_read_frame(GTPoint *points) {
+    uint8_t buf[1 + sizeof(GTPoint) * GT911_MAX_CONTACTS];
+    if (gt911_read_bytes(GT911_REG_COORD_ADDR, buf, sizeof(buf)) != ESP_OK) {
+        return -1;
+    }
+    
+    uint8_t flag = buf[0];
+    if (!(flag & 0x80) || (flag & 0x0F) > GT911_MAX_CONTACTS) {
+        return -1;
+    }
+    
+    // Clear the status register without waiting; the next read queues behind it
+    transfer_count++;
+    i2c_master_transmit(i2c_dev, clear_status_cmd, sizeof(clear_status_cmd), GT911_I2C_TIMEOUT_MS);
+    
+    memcpy(points, buf + 1, sizeof(GTPoint) * GT911_MAX_CONTACTS);
+    if (rotation == GT911_ROTATE_180) {
+        for (uint8_t i = 0; i < GT911_MAX_CONTACTS; i++) {
+            points[i].x = gt_info.xResolution - points[i].x;
+            points[i].y = gt_info.yResolution - points[i].y;
         }
     }
     
-    return contacts;
+    return flag & 0x0F;
+}
+
+/**
+ * @brief Set the task woken by the interrupt pin
+ * 
+ * The task is notified with vTaskNotifyGiveFromISR() on every interrupt,
+ * so it can block in ulTaskNotifyTake() instead of polling.
+ * 
+ * @param task Task to notify, NULL to stop notifying
+ */
+void gt911_set_irq_task(TaskHandle_t task) {
+    gt911_irq_task = task;
+}
+
+/**
+ * @brief Get the time of the last interrupt
+ * 
+ * @return int64_t esp_timer time of the last interrupt in microseconds
+ */
+int64_t gt911_get_irq_time_us(void) {
+    return gt911_irq_time_us;
+}
+
+/**
+ * @brief Get the number of I2C transactions issued so far
+ * 
+ * @return uint32_t Transaction count, wraps around
+ */
+uint32_t gt911_get_transfer_count(void) {
+    return transfer_count;
 }
 
 /**
@@ -507,9 +535,25 @@ void gt911_set_rotation(GT911_Rotate_t rot) {
  * Cleans up resources and removes interrupt handlers.
  */
 void gt911_deinit(void) {
+    gt911_irq_task = NULL;
     if (int_pin != GPIO_NUM_NC) {
         gpio_isr_handler_remove(int_pin);
     }
-    i2c_driver_delete(i2c_port);
+    gt911_bus_delete();
     ESP_LOGI(TAG, "GT911 deinitialized");
 }
+
+/**
+ * @brief Remove the device and delete the bus, after queued transactions finish
+ */
+static void gt911_bus_delete(void) {
+    if (i2c_dev != NULL) {
+        i2c_master_bus_wait_all_done(i2c_bus, GT911_I2C_TIMEOUT_MS);
+        i2c_master_bus_rm_device(i2c_dev);
+        i2c_dev = NULL;
+    }
+    if (i2c_bus != NULL) {
+        i2c_del_master_bus(i2c_bus);
+        i2c_bus = NULL;
+    }
+}
@@ -10,7 +10,7 @@
 #define GT911_H
 
 #include "esp_err.h"
-#include "driver/i2c.h"
+#include "driver/i2c_master.h"
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -28,6 +28,10 @@ extern "C" {
 // Maximum number of touch contacts
 #define GT911_MAX_CONTACTS 5
 
+// I2C transaction timeout and the depth of the asynchronous transaction queue
+#define GT911_I2C_TIMEOUT_MS  50
+#define GT911_I2C_QUEUE_DEPTH 4
+
 // Register addresses
 #define GT911_REG_CFG        0x8047
 #define GT911_REG_CHECKSUM   0x80FF
@@ -223,6 +227,40 @@ GTInfo* gt911_read_info(void);
  */
 uint8_t gt911_touched(uint8_t mode);
 
+/**
+ * @brief Read one touch frame without waiting
+ * 
+ * Reads the status register and all points in one I2C transaction. If a
+ * new frame was ready, clearing the status register is queued on the bus
+ * and not waited for. Unlike gt911_touched(), it never waits for the
+ * controller.
+ * 
+ * @param points Output array of GT911_MAX_CONTACTS points
+ * @return int8_t Number of touches (0-5), -1 if no new frame or on error
+ */
+int8_t gt911_read_frame(GTPoint *points);
+
+/**
+ * @brief Set the task woken by the interrupt pin
+ * 
+ * @param task Task notified on every interrupt, NULL to stop notifying
+ */
+void gt911_set_irq_task(TaskHandle_t task);
+
+/**
+ * @brief Get the time of the last interrupt
+ * 
+ * @return int64_t esp_timer time of the last interrupt in microseconds
+ */
+int64_t gt911_get_irq_time_us(void);
+
+/**
+ * @brief Get the number of I2C transactions issued so far
+ * 
+ * @return uint32_t Transaction count, wraps around
+ */
+uint32_t gt911_get_transfer_count(void);
+
 /**
  * @brief Get a specific touch point
  * 
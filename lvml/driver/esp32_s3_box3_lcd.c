@@ -6,10 +6,17 @@
 #include "lvgl/src/tick/lv_tick.h"
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "utils/lvml_splash.h"
+#include "network/lvml_mirror.h"
+#include <string.h>
 
 // Global variables
 static bool lcd_initialized = false;
 static spi_device_handle_t spi_device = NULL;
+static bool lcd_splash_shown = false;   // The panel is already on, showing a splash
+static bool lcd_keep_image = false;     // LVGL is initializing a panel that shows a splash
+static int32_t lcd_area[4];             // Window of the next RAMWR from CASET/PASET: x1, x2, y1, y2
 
 
 
@@ -25,6 +32,19 @@ static spi_device_handle_t spi_device = NULL;
 #define LCD_H_RES 320
 #define LCD_V_RES 240
 
+// Splash streaming: rows per DMA band, two bands in flight
+#define LCD_SPLASH_ROWS 16
+
+// ILI9341 commands used before LVGL takes over
+#define ILI9341_SWRESET 0x01
+#define ILI9341_SLPOUT  0x11
+#define ILI9341_DISPOFF 0x28
+#define ILI9341_DISPON  0x29
+#define ILI9341_CASET   0x2A
+#define ILI9341_PASET   0x2B
+#define ILI9341_RAMWR   0x2C
+#define ILI9341_COLMOD  0x3A
+
 // Helper function to send command to ILI9341
 static void ili9341_send_cmd(uint8_t cmd) {
     if (spi_device == NULL) return;
@@ -54,6 +74,21 @@ static void ili9341_send_cmd_cb(lv_display_t * disp, const uint8_t * cmd, size_t
                                const uint8_t * param, size_t param_size) {
     if (spi_device == NULL) return;
     
+    // Taking over a panel that shows the splash: a reset or display-off
+    // would blank it until LVGL's first frame
+    if (lcd_keep_image && cmd_size > 0 &&
+        (cmd[0] == ILI9341_SWRESET || cmd[0] == ILI9341_DISPOFF)) {
+        return;
+    }
+    
+    // Remember the window, so a mirrored flush knows where its pixels go
+    if (cmd_size > 0 && param && param_size == 4 &&
+        (cmd[0] == ILI9341_CASET || cmd[0] == ILI9341_PASET)) {
+        int i = cmd[0] == ILI9341_CASET ? 0 : 2;
+        lcd_area[i] = (param[0] << 8) | param[1];
+        lcd_area[i + 1] = (param[2] << 8) | param[3];
+    }
+    
     // Send command
     if (cmd_size > 0) {
         ili9341_send_cmd(cmd[0]);
@@ -100,6 +135,10 @@ static void ili9341_send_color_cb(lv_display_t * disp, const uint8_t * cmd, size
             data_ptr += chunk_size;
             remaining -= chunk_size;
         }
+        
+        // Copy the area for a remote viewer; no-op unless mirroring
+        lvml_mirror_flush(lcd_area[0], lcd_area[2], lcd_area[1], lcd_area[3],
+                          param, param_size, lv_display_flush_is_last(disp));
     }
     
     // Tell LVGL that the flush is complete
@@ -184,6 +223,96 @@ void esp32_s3_box3_lcd_deinit(void) {
     }
     spi_bus_free(SPI2_HOST);
     lcd_initialized = false;
+    lcd_splash_shown = false;
+    lcd_keep_image = false;
+}
+
+// Show a splash (see utils/lvml_splash.h) without LVGL: bring the panel out
+// of reset and stream the pixels, expanded band by band into two DMA buffers
+// so expanding one band overlaps sending the other
+esp_err_t esp32_s3_box3_lcd_show_splash(const uint8_t *data, size_t len) {
+    lvml_splash_t splash;
+    if (lvml_splash_open(&splash, data, len) != LVML_OK ||
+        splash.width == 0 || splash.height == 0 ||
+        splash.width > LCD_H_RES || splash.height > LCD_V_RES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    esp_err_t ret = esp32_s3_box3_lcd_init();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    // The splash is usually frozen in flash, which DMA can't read
+    size_t band_pixels = (size_t)splash.width * LCD_SPLASH_ROWS;
+    uint8_t *band[2];
+    band[0] = heap_caps_malloc(band_pixels * 2, MALLOC_CAP_DMA);
+    band[1] = heap_caps_malloc(band_pixels * 2, MALLOC_CAP_DMA);
+    if (band[0] == NULL || band[1] == NULL) {
+        heap_caps_free(band[0]);
+        heap_caps_free(band[1]);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    // Sleep out, 16-bit pixels and the orientation LVGL will use
+    ili9341_send_cmd(ILI9341_SLPOUT);
+    mp_hal_delay_ms(5);
+    uint8_t colmod = 0x55;
+    ili9341_send_cmd(ILI9341_COLMOD);
+    ili9341_send_data(&colmod, 1);
+    esp32_s3_box3_lcd_set_rotation(LV_DISPLAY_ROTATION_270);
+    
+    // Centered window
+    uint16_t x0 = (LCD_H_RES - splash.width) / 2;
+    uint16_t y0 = (LCD_V_RES - splash.height) / 2;
+    uint16_t x1 = x0 + splash.width - 1;
+    uint16_t y1 = y0 + splash.height - 1;
+    uint8_t caset[4] = {x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF};
+    uint8_t paset[4] = {y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF};
+    ili9341_send_cmd(ILI9341_CASET);
+    ili9341_send_data(caset, sizeof(caset));
+    ili9341_send_cmd(ILI9341_PASET);
+    ili9341_send_data(paset, sizeof(paset));
+    ili9341_send_cmd(ILI9341_RAMWR);
+    gpio_set_level(LCD_PIN_NUM_DC, 1); // Data mode for the whole image
+    
+    spi_transaction_t trans[2];
+    int in_flight = 0;
+    int next = 0;
+    size_t sent = 0;
+    size_t total = (size_t)splash.width * splash.height;
+    while (sent < total) {
+        // Reuse a band only once its previous transfer is done
+        if (in_flight == 2) {
+            spi_transaction_t *done;
+            spi_device_get_trans_result(spi_device, &done, portMAX_DELAY);
+            in_flight--;
+        }
+        size_t n = lvml_splash_read(&splash, band[next], band_pixels);
+        if (n == 0) {
+            break; // Corrupt data; show what was sent
+        }
+        memset(&trans[next], 0, sizeof(trans[next]));
+        trans[next].length = n * 16;
+        trans[next].tx_buffer = band[next];
+        spi_device_queue_trans(spi_device, &trans[next], portMAX_DELAY);
+        in_flight++;
+        sent += n;
+        next ^= 1;
+    }
+    while (in_flight > 0) {
+        spi_transaction_t *done;
+        spi_device_get_trans_result(spi_device, &done, portMAX_DELAY);
+        in_flight--;
+    }
+    heap_caps_free(band[0]);
+    heap_caps_free(band[1]);
+    
+    ili9341_send_cmd(ILI9341_DISPON);
+    gpio_set_level(LCD_PIN_NUM_BCKL, 1);
+    lcd_splash_shown = true;
+    
+    return sent == total ? ESP_OK : ESP_ERR_INVALID_SIZE;
 }
 
 // Turn screen on (enable backlight)
@@ -200,6 +329,11 @@ void esp32_s3_box3_lcd_screen_off(void) {
     }
 }
 
+// Whether the panel is on, showing a splash from esp32_s3_box3_lcd_show_splash()
+bool esp32_s3_box3_lcd_splash_shown(void) {
+    return lcd_splash_shown;
+}
+
 // Set display rotation
 esp_err_t esp32_s3_box3_lcd_set_rotation(lv_display_rotation_t rotation) {
     if (!lcd_initialized || spi_device == NULL) {
@@ -247,9 +381,11 @@ esp_err_t esp32_s3_box3_lcd_set_rotation(lv_display_rotation_t rotation) {
 
 // Create LVGL display with ESP32-S3-Box-3 LCD driver
 lv_display_t * esp32_s3_box3_lcd_create_display(uint32_t width, uint32_t height) {
-    // Create ILI9341 display
+    // Create ILI9341 display; a splash stays up until LVGL draws over it
+    lcd_keep_image = lcd_splash_shown;
     lv_display_t *disp = lv_ili9341_create(width, height, LV_LCD_FLAG_NONE, 
                             ili9341_send_cmd_cb, ili9341_send_color_cb);
+    lcd_keep_image = false;
     if (disp == NULL) {
         return NULL;
     }
@@ -257,5 +393,8 @@ lv_display_t * esp32_s3_box3_lcd_create_display(uint32_t width, uint32_t height)
     // Set default rotation
     esp32_s3_box3_lcd_set_rotation(LV_DISPLAY_ROTATION_270);
     
+    // Rotation is done by the panel (MADCTL), so the mirrored size stays the same
+    lvml_mirror_resize(width, height);
+    
     return disp;
 }
@@ -12,6 +12,10 @@ esp_err_t esp32_s3_box3_lcd_set_rotation(lv_display_rotation_t rotation);
 // Screen control functions
 void esp32_s3_box3_lcd_screen_on(void);
 void esp32_s3_box3_lcd_screen_off(void);
+bool esp32_s3_box3_lcd_splash_shown(void);
+
+// Early splash: initializes the panel and shows an LVML splash, before LVGL
+esp_err_t esp32_s3_box3_lcd_show_splash(const uint8_t *data, size_t len);
 
 // Display creation
 lv_display_t * esp32_s3_box3_lcd_create_display(uint32_t width, uint32_t height);
@@ -9,7 +9,16 @@
 
 #include "esp32_s3_box3_touch.h"
 #include "GT911.h"
-#include "micropython/py/mphal.h"
+#include "utils/lvml_affine.h"
+#include "utils/lvml_boot.h"
+#include "utils/lvml_gesture.h"
+#include "utils/lvml_log.h"
+#include "utils/lvml_spsc.h"
+#include "utils/lvml_time.h"
+#include "esp_cpu.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
 
 // GT911 Configuration for ESP32-S3-Box-3
 #define GT911_I2C_ADDR 0x5D  // Default I2C address
@@ -18,18 +27,280 @@
 #define GT911_SCL_PIN 18     // From board config
 #define GT911_INT_PIN 3      // Interrupt pin
 #define GT911_RST_PIN 48     // Reset pin
-#define GT911_I2C_FREQ 100000 // 100kHz
+#define GT911_I2C_FREQ 400000 // 400kHz fast mode
+
+// Display size in the boot orientation
+#define TOUCH_DISPLAY_WIDTH 320
+#define TOUCH_DISPLAY_HEIGHT 240
+#define TOUCH_DEFAULT_RESOLUTION 1024  // Used if the controller reports none
+
+// Sampling task and point queue
+#define TOUCH_QUEUE_SIZE 16          // Power of two
+#define TOUCH_GESTURE_QUEUE_SIZE 16  // Power of two
+#define TOUCH_TASK_STACK 3072
+#define TOUCH_TASK_PRIORITY 5
+#define TOUCH_RELEASE_TIMEOUT_MS 50  // No interrupt for this long while pressed: check for a lost release
+
+// Background initialization
+#define TOUCH_INIT_TASK_STACK 4096
+#define TOUCH_INIT_TASK_PRIORITY 4
+
+// One touch sample, produced by the sampling task and consumed by LVGL
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t raw_x;           // Controller coordinates, before the transform
+    int32_t raw_y;
+    bool pressed;
+    uint8_t count;           // Fingers down, all of them in contacts
+    int64_t irq_us;          // When the controller raised the interrupt
+    lvml_gesture_contact_t contacts[GT911_MAX_CONTACTS];
+} touch_sample_t;
 
 // Static variables
 static bool touch_initialized = false;
 static lv_indev_t *touch_indev = NULL;
 
+// Lock-free rings filled by the sampling task. Samples are drained by the
+// LVGL read callback, gestures by lvml_core_tick().
+static touch_sample_t touch_queue[TOUCH_QUEUE_SIZE];
+static lvml_spsc_t touch_queue_idx;
+static lvml_gesture_event_t gesture_queue[TOUCH_GESTURE_QUEUE_SIZE];
+static lvml_spsc_t gesture_queue_idx;
+static lvml_gesture_t touch_gestures;   // Used by the sampling task only
+
+// Controller to display transform: scale (or calibration), then rotation.
+// Built when something changes, read by the sampling task under xform_lock.
+static int32_t touch_res_x = TOUCH_DEFAULT_RESOLUTION;
+static int32_t touch_res_y = TOUCH_DEFAULT_RESOLUTION;
+static int touch_rotation = 0;
+static bool touch_calibrated = false;
+static lvml_affine_t touch_calibration;
+static lvml_affine_t touch_xform;
+static int32_t touch_max_x = TOUCH_DISPLAY_WIDTH - 1;
+static int32_t touch_max_y = TOUCH_DISPLAY_HEIGHT - 1;
+static portMUX_TYPE xform_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static touch_sample_t touch_last = { .x = TOUCH_DISPLAY_WIDTH / 2, .y = TOUCH_DISPLAY_HEIGHT / 2 };
+static TaskHandle_t touch_task = NULL;
+static volatile bool touch_task_running = false;
+static esp32_s3_box3_touch_stats_t touch_stats;
+static uint64_t latency_total_us = 0;
+static uint64_t i2c_total_us = 0;
+static uint32_t i2c_reads = 0;
+static bool first_touch_seen = false;
+static volatile esp_err_t touch_init_result = ESP_ERR_INVALID_STATE;  // ESP_ERR_NOT_FINISHED while running
+static SemaphoreHandle_t touch_init_done = NULL;  // Given by the init task as it exits
+
+/**
+ * @brief Push a sample into the queue (sampling task only)
+ * 
+ * @param sample Sample to push
+ * @return bool true if queued, false if the queue is full
+ */
+static bool touch_queue_push(const touch_sample_t *sample) {
+    int32_t slot = lvml_spsc_reserve(&touch_queue_idx, TOUCH_QUEUE_SIZE);
+    if (slot < 0) {
+        return false;
+    }
+    touch_queue[slot] = *sample;
+    lvml_spsc_publish(&touch_queue_idx);
+    return true;
+}
+
+/**
+ * @brief Pop a sample from the queue (LVGL read callback only)
+ * 
+ * @param sample Output sample
+ * @param more Set to true if more samples remain after this one
+ * @return bool true if a sample was popped, false if the queue is empty
+ */
+static bool touch_queue_pop(touch_sample_t *sample, bool *more) {
+    int32_t slot = lvml_spsc_peek(&touch_queue_idx, TOUCH_QUEUE_SIZE);
+    if (slot < 0) {
+        return false;
+    }
+    *sample = touch_queue[slot];
+    lvml_spsc_release(&touch_queue_idx);
+    *more = lvml_spsc_count(&touch_queue_idx) > 0;
+    return true;
+}
+
+/**
+ * @brief Run the gesture recognizer on a frame and queue what it finds
+ * 
+ * @param time_ms Frame time
+ * @param contacts Fingers down, in display coordinates
+ * @param count Number of fingers, 0 when all are lifted
+ */
+static void touch_recognize(uint32_t time_ms, const lvml_gesture_contact_t *contacts, uint8_t count) {
+    lvml_gesture_event_t events[LVML_GESTURE_MAX_EVENTS];
+    size_t n = lvml_gesture_update(&touch_gestures, time_ms, contacts, count, events);
+    for (size_t i = 0; i < n; i++) {
+        int32_t slot = lvml_spsc_reserve(&gesture_queue_idx, TOUCH_GESTURE_QUEUE_SIZE);
+        if (slot < 0) {
+            touch_stats.gestures_dropped++;
+            continue;
+        }
+        gesture_queue[slot] = events[i];
+        lvml_spsc_publish(&gesture_queue_idx);
+        touch_stats.gestures++;
+    }
+}
+
+/**
+ * @brief Rebuild the controller to display transform
+ * 
+ * Called when the rotation or calibration changes, never per sample.
+ */
+static void touch_update_xform(void) {
+    lvml_affine_t xform;
+    if (touch_calibrated) {
+        xform = touch_calibration;
+    } else {
+        lvml_affine_scale(&xform, touch_res_x, touch_res_y, TOUCH_DISPLAY_WIDTH, TOUCH_DISPLAY_HEIGHT);
+    }
+    lvml_affine_t rotate;
+    lvml_affine_rotate(&rotate, TOUCH_DISPLAY_WIDTH, TOUCH_DISPLAY_HEIGHT, touch_rotation);
+    lvml_affine_multiply(&xform, &xform, &rotate);
+    
+    bool swapped = (touch_rotation & 1) != 0;
+    taskENTER_CRITICAL(&xform_lock);
+    touch_xform = xform;
+    touch_max_x = (swapped ? TOUCH_DISPLAY_HEIGHT : TOUCH_DISPLAY_WIDTH) - 1;
+    touch_max_y = (swapped ? TOUCH_DISPLAY_WIDTH : TOUCH_DISPLAY_HEIGHT) - 1;
+    taskEXIT_CRITICAL(&xform_lock);
+}
+
+/**
+ * @brief Map controller points to display coordinates
+ * 
+ * @param points Points in controller coordinates
+ * @param count Number of points
+ * @param contacts Output contacts in display coordinates, with their track ids
+ */
+static void touch_map_points(const GTPoint *points, uint8_t count, lvml_gesture_contact_t *contacts) {
+    taskENTER_CRITICAL(&xform_lock);
+    lvml_affine_t xform = touch_xform;
+    int32_t max_x = touch_max_x;
+    int32_t max_y = touch_max_y;
+    taskEXIT_CRITICAL(&xform_lock);
+    
+    for (uint8_t i = 0; i < count; i++) {
+        lvml_gesture_contact_t *c = &contacts[i];
+        c->id = points[i].trackId;
+        lvml_affine_apply(&xform, points[i].x, points[i].y, &c->x, &c->y);
+        
+        // Clamp coordinates to display bounds
+        if (c->x < 0) c->x = 0;
+        if (c->y < 0) c->y = 0;
+        if (c->x > max_x) c->x = max_x;
+        if (c->y > max_y) c->y = max_y;
+    }
+}
+
+/**
+ * @brief Touch sampling task
+ * 
+ * Sleeps until the GT911 interrupt wakes it, reads the frame in one I2C
+ * burst, queues the first finger as a sample for LVGL and feeds all of them
+ * to the gesture recognizer. While a finger is down it also wakes
+ * after TOUCH_RELEASE_TIMEOUT_MS without an interrupt, so a lost release
+ * interrupt can't leave the pointer pressed. A release that finds the queue
+ * full is retried on every wake and queued before any later sample, so LVGL
+ * always sees it between two touches.
+ * 
+ * @param arg Unused
+ */
+static void touch_sample_task(void *arg) {
+    GTPoint points[GT911_MAX_CONTACTS];
+    lvml_gesture_contact_t contacts[GT911_MAX_CONTACTS];
+    touch_sample_t last = touch_last;
+    touch_sample_t pending_release = last;
+    bool release_pending = false;  // Release that didn't fit in a full queue
+    
+    while (touch_task_running) {
+        bool poll = last.pressed || release_pending;
+        uint32_t irqs = ulTaskNotifyTake(pdTRUE, poll ? pdMS_TO_TICKS(TOUCH_RELEASE_TIMEOUT_MS) : portMAX_DELAY);
+        if (!touch_task_running) {
+            break;
+        }
+        touch_stats.irqs += irqs;
+        if (release_pending && touch_queue_push(&pending_release)) {
+            touch_stats.samples++;
+            release_pending = false;
+        }
+        
+        uint32_t transfers = gt911_get_transfer_count();
+        int64_t read_start = lvml_time_us();
+        int8_t count = gt911_read_frame(points);
+        touch_stats.bus_transfers += gt911_get_transfer_count() - transfers;
+        uint32_t read_us = (uint32_t)(lvml_time_us() - read_start);
+        touch_stats.i2c_last_us = read_us;
+        i2c_total_us += read_us;
+        i2c_reads++;
+        if (read_us > touch_stats.i2c_max_us) {
+            touch_stats.i2c_max_us = read_us;
+        }
+        
+        if (count < 0) {
+            if (irqs > 0 || !last.pressed) {
+                continue;
+            }
+            // Timed out while pressed and the controller has nothing new: released
+            count = 0;
+        }
+        touch_stats.frames++;
+        
+        touch_sample_t sample = last;
+        sample.irq_us = irqs > 0 ? gt911_get_irq_time_us() : read_start;
+        sample.pressed = count > 0;
+        sample.count = (uint8_t)count;
+        if (!sample.pressed && !last.pressed) {
+            continue;  // Repeated release
+        }
+        if (sample.pressed) {
+            uint32_t cycles = esp_cpu_get_cycle_count();
+            touch_map_points(points, count, contacts);
+            cycles = esp_cpu_get_cycle_count() - cycles;
+            if (cycles > touch_stats.xform_max_cycles) {
+                touch_stats.xform_max_cycles = cycles;
+            }
+            // LVGL's pointer follows the first finger
+            sample.x = contacts[0].x;
+            sample.y = contacts[0].y;
+            sample.raw_x = points[0].x;
+            sample.raw_y = points[0].y;
+            memcpy(sample.contacts, contacts, count * sizeof(contacts[0]));
+        }
+        LVML_LOG_TRACE(LVML_LOG_MOD_TOUCH, "Frame: %d contacts, first at %d,%d", count, sample.x, sample.y);
+        last = sample;
+        touch_recognize((uint32_t)(sample.irq_us / 1000), contacts, count);
+        
+        // Nothing overtakes a waiting release
+        if (!release_pending && touch_queue_push(&sample)) {
+            touch_stats.samples++;
+        } else if (!sample.pressed) {
+            // Never lose a release; it's pushed as soon as a slot frees up
+            pending_release = sample;
+            release_pending = true;
+        } else {
+            touch_stats.dropped++;
+            LVML_LOG_WARN(LVML_LOG_MOD_TOUCH, "Sample queue full, %u dropped", (unsigned)touch_stats.dropped);
+        }
+    }
+    
+    touch_task = NULL;
+    vTaskDelete(NULL);
+}
+
 /**
  * @brief Initialize the GT911 touch controller for ESP32-S3-Box-3
  * 
  * This function initializes the GT911 touch controller using the dedicated GT911 driver.
  * It configures the I2C communication, GPIO pins, and performs the necessary reset
- * sequence for the ESP32-S3-Box-3 hardware.
+ * sequence for the ESP32-S3-Box-3 hardware, then starts the task that samples
+ * touches when the controller raises its interrupt.
  * 
  * @return esp_err_t ESP_OK on success, error code on failure
  */
@@ -38,7 +309,7 @@ esp_err_t esp32_s3_box3_touch_init(void) {
         return ESP_OK;
     }
     
-    mp_printf(&mp_plat_print, "[GT911] Initializing GT911 touch controller\n");
+    LVML_LOG_INFO(LVML_LOG_MOD_TOUCH, "Initializing GT911 touch controller");
     
     // Initialize GT911 driver
     bool success = gt911_begin(
@@ -52,91 +323,148 @@ esp_err_t esp32_s3_box3_touch_init(void) {
     );
     
     if (!success) {
-        mp_printf(&mp_plat_print, "[GT911] Failed to initialize GT911\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_TOUCH, "Failed to initialize GT911");
         return ESP_FAIL;
     }
     
-    // Read device info for debugging
+    // Read device info once; the resolution is cached for the transform
     GTInfo* info = gt911_read_info();
     if (info != NULL) {
-        mp_printf(&mp_plat_print, "[GT911] Product ID: %.4s, Resolution: %dx%d\n", 
-                  info->productId, info->xResolution, info->yResolution);
+        if (lvml_log_enabled(LVML_LOG_MOD_TOUCH, LVML_LOG_LEVEL_INFO)) {
+            char product[24];
+            int len = snprintf(product, sizeof(product), "Product ID: %.4s", info->productId);
+            lvml_log_text(LVML_LOG_MOD_TOUCH, LVML_LOG_LEVEL_INFO, product, (size_t)len);
+        }
+        LVML_LOG_INFO(LVML_LOG_MOD_TOUCH, "Resolution: %dx%d", info->xResolution, info->yResolution);
+        if (info->xResolution > 0 && info->yResolution > 0) {
+            touch_res_x = info->xResolution;
+            touch_res_y = info->yResolution;
+        }
     }
     
+    // Rotation is applied by the transform, not by the GT911 driver
+    gt911_set_rotation(GT911_ROTATE_0);
+    touch_update_xform();
+    
+    // Start the sampling task; the interrupt handler wakes it
+    lvml_spsc_reset(&touch_queue_idx);
+    lvml_spsc_reset(&gesture_queue_idx);
+    lvml_gesture_init(&touch_gestures, NULL);
+    touch_task_running = true;
+    if (xTaskCreate(touch_sample_task, "touch", TOUCH_TASK_STACK, NULL, TOUCH_TASK_PRIORITY, &touch_task) != pdPASS) {
+        LVML_LOG_ERROR(LVML_LOG_MOD_TOUCH, "Failed to create touch sampling task");
+        touch_task_running = false;
+        touch_task = NULL;
+        gt911_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+    gt911_set_irq_task(touch_task);
+    
     touch_initialized = true;
-    mp_printf(&mp_plat_print, "[GT911] Touch controller initialized successfully\n");
+    LVML_LOG_INFO(LVML_LOG_MOD_TOUCH, "Touch controller initialized successfully");
     
     return ESP_OK;
 }
 
+/**
+ * @brief Background initialization task
+ * 
+ * Runs esp32_s3_box3_touch_init(), whose GT911 reset delays take over half a
+ * second, then publishes the result, wakes a waiting deinit and exits.
+ * 
+ * @param arg Unused
+ */
+static void touch_init_task_fn(void *arg) {
+    esp_err_t ret = esp32_s3_box3_touch_init();
+    __atomic_store_n(&touch_init_result, ret, __ATOMIC_RELEASE);
+    xSemaphoreGive(touch_init_done);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Start initializing the GT911 touch controller on a background task
+ * 
+ * Returns at once; esp32_s3_box3_touch_init_status() reports when the
+ * controller is up. The input device is created afterwards, from the LVGL
+ * thread, with esp32_s3_box3_touch_create_indev().
+ * 
+ * @return esp_err_t ESP_OK if started (or already initialized), ESP_ERR_NO_MEM if the task can't be created
+ */
+esp_err_t esp32_s3_box3_touch_init_async(void) {
+    if (touch_initialized || esp32_s3_box3_touch_init_status() == ESP_ERR_NOT_FINISHED) {
+        return ESP_OK;
+    }
+    
+    if (touch_init_done == NULL) {
+        touch_init_done = xSemaphoreCreateBinary();
+        if (touch_init_done == NULL) {
+            LVML_LOG_ERROR(LVML_LOG_MOD_TOUCH, "Failed to create touch init semaphore");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    xSemaphoreTake(touch_init_done, 0);  // Drop the give of a previous run nobody waited for
+    
+    touch_init_result = ESP_ERR_NOT_FINISHED;
+    if (xTaskCreate(touch_init_task_fn, "touch_init", TOUCH_INIT_TASK_STACK, NULL, TOUCH_INIT_TASK_PRIORITY,
+                    NULL) != pdPASS) {
+        LVML_LOG_ERROR(LVML_LOG_MOD_TOUCH, "Failed to create touch init task");
+        touch_init_result = ESP_ERR_NO_MEM;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Result of esp32_s3_box3_touch_init_async()
+ * 
+ * @return esp_err_t ESP_ERR_NOT_FINISHED while initializing, then the result of
+ *         esp32_s3_box3_touch_init(); ESP_ERR_INVALID_STATE if it was never started
+ */
+esp_err_t esp32_s3_box3_touch_init_status(void) {
+    return __atomic_load_n(&touch_init_result, __ATOMIC_ACQUIRE);
+}
+
 /**
  * @brief LVGL input device read callback for touch input
  * 
- * This function is called by LVGL when it needs to read touch input data. It uses
- * the GT911 driver to check for touch events and converts the touch data into
- * LVGL's input format. The function maintains the last touch position to provide
- * proper touch release events when the user lifts their finger from the screen.
+ * This function is called by LVGL when it needs to read touch input data. It never
+ * touches the bus: it takes the next sample queued by the sampling task, or repeats
+ * the last one if nothing new arrived. When more samples are waiting it asks LVGL to
+ * read again, so a quick tap between two reads still produces a press and a release.
  * 
  * @param indev Pointer to the LVGL input device (unused)
  * @param data Pointer to LVGL input data structure to fill with touch information
  */
 static void touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
-    static GTPoint last_touch = {0};
-    static bool last_touch_valid = false;
-    
-    // Check for touch events using polling mode
-    uint8_t touch_count = gt911_touched(GT911_MODE_POLLING);
+    int64_t start = lvml_time_us();
     
-    if (touch_count > 0) {
-        // Get the first touch point (we only handle single touch for now)
-        GTPoint current_touch = gt911_get_point(0);
-        
-        // Scale coordinates to display resolution (320x240)
-        // GT911 typically reports coordinates in its native resolution
-        GTInfo* info = gt911_read_info();
-        if (info != NULL && info->xResolution > 0 && info->yResolution > 0) {
-            data->point.x = (current_touch.x * 320) / info->xResolution;
-            data->point.y = (current_touch.y * 240) / info->yResolution;
-        } else {
-            // Fallback scaling if info is not available
-            data->point.x = (current_touch.x * 320) / 1024;
-            data->point.y = (current_touch.y * 240) / 1024;
+    touch_sample_t sample;
+    bool more = false;
+    if (touch_queue_pop(&sample, &more)) {
+        touch_last = sample;
+        if (!first_touch_seen && sample.pressed) {
+            first_touch_seen = true;
+            lvml_boot_mark("first_touch");
         }
         
-        // Clamp coordinates to display bounds
-        if (data->point.x >= 320) data->point.x = 319;
-        if (data->point.y >= 240) data->point.y = 239;
-        
-        data->state = LV_INDEV_STATE_PRESSED;
-        last_touch = current_touch;
-        last_touch_valid = true;
-        
-        mp_printf(&mp_plat_print, "[TOUCH] Pressed: x=%d, y=%d, id=%d\n", 
-                  data->point.x, data->point.y, current_touch.trackId);
-    } else {
-        // No touch detected
-        if (last_touch_valid) {
-            // Use last known position for release event
-            GTInfo* info = gt911_read_info();
-            if (info != NULL && info->xResolution > 0 && info->yResolution > 0) {
-                data->point.x = (last_touch.x * 320) / info->xResolution;
-                data->point.y = (last_touch.y * 240) / info->yResolution;
-            } else {
-                data->point.x = (last_touch.x * 320) / 1024;
-                data->point.y = (last_touch.y * 240) / 1024;
-            }
-            
-            // Clamp coordinates to display bounds
-            if (data->point.x >= 320) data->point.x = 319;
-            if (data->point.y >= 240) data->point.y = 239;
-        } else {
-            // No previous touch, use center
-            data->point.x = 160;
-            data->point.y = 120;
+        uint32_t latency_us = (uint32_t)(start - sample.irq_us);
+        touch_stats.delivered++;
+        touch_stats.last_latency_us = latency_us;
+        latency_total_us += latency_us;
+        if (latency_us > touch_stats.max_latency_us) {
+            touch_stats.max_latency_us = latency_us;
         }
-        
-        data->state = LV_INDEV_STATE_RELEASED;
-        last_touch_valid = false;
+    }
+    
+    data->point.x = touch_last.x;
+    data->point.y = touch_last.y;
+    data->state = touch_last.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->continue_reading = more;
+    
+    touch_stats.reads++;
+    uint32_t read_us = (uint32_t)(lvml_time_us() - start);
+    if (read_us > touch_stats.read_max_us) {
+        touch_stats.read_max_us = read_us;
     }
 }
 
@@ -151,13 +479,13 @@ static void touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
  */
 lv_indev_t *esp32_s3_box3_touch_create_indev(void) {
     if (!touch_initialized) {
-        mp_printf(&mp_plat_print, "[GT911] Touch controller not initialized\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_TOUCH, "Touch controller not initialized");
         return NULL;
     }
     
     touch_indev = lv_indev_create();
     if (touch_indev == NULL) {
-        mp_printf(&mp_plat_print, "[GT911] Failed to create LVGL input device\n");
+        LVML_LOG_ERROR(LVML_LOG_MOD_TOUCH, "Failed to create LVGL input device");
         return NULL;
     }
     
@@ -165,7 +493,7 @@ lv_indev_t *esp32_s3_box3_touch_create_indev(void) {
     lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(touch_indev, touchpad_read);
     
-    mp_printf(&mp_plat_print, "[GT911] LVGL input device created successfully\n");
+    LVML_LOG_INFO(LVML_LOG_MOD_TOUCH, "LVGL input device created successfully");
     
     return touch_indev;
 }
@@ -191,6 +519,12 @@ bool esp32_s3_box3_touch_is_initialized(void) {
  * the touch functionality is no longer needed.
  */
 void esp32_s3_box3_touch_deinit(void) {
+    // Let a background init finish before taking the controller down
+    if (esp32_s3_box3_touch_init_status() == ESP_ERR_NOT_FINISHED) {
+        xSemaphoreTake(touch_init_done, portMAX_DELAY);
+    }
+    touch_init_result = ESP_ERR_INVALID_STATE;
+    
     if (!touch_initialized) {
         return;
     }
@@ -201,9 +535,135 @@ void esp32_s3_box3_touch_deinit(void) {
         touch_indev = NULL;
     }
     
+    // Stop the sampling task and wait for it to leave the bus
+    gt911_set_irq_task(NULL);
+    if (touch_task != NULL) {
+        touch_task_running = false;
+        xTaskNotifyGive(touch_task);
+        for (int i = 0; i < 100 && touch_task != NULL; i++) {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+    }
+    
     // Deinitialize GT911 driver
     gt911_deinit();
     
     touch_initialized = false;
-    mp_printf(&mp_plat_print, "[GT911] Touch controller deinitialized\n");
-}
\ No newline at end of file
+    LVML_LOG_INFO(LVML_LOG_MOD_TOUCH, "Touch controller deinitialized");
+}
+
+/**
+ * @brief Get touch sampling statistics
+ * 
+ * @param stats Output statistics
+ * @param reset Clear the counters after reading them
+ */
+void esp32_s3_box3_touch_get_stats(esp32_s3_box3_touch_stats_t *stats, bool reset) {
+    if (stats != NULL) {
+        *stats = touch_stats;
+        stats->avg_latency_us = touch_stats.delivered > 0 ?
+                                (uint32_t)(latency_total_us / touch_stats.delivered) : 0;
+        stats->i2c_avg_us = i2c_reads > 0 ? (uint32_t)(i2c_total_us / i2c_reads) : 0;
+    }
+    if (reset) {
+        memset(&touch_stats, 0, sizeof(touch_stats));
+        latency_total_us = 0;
+        i2c_total_us = 0;
+        i2c_reads = 0;
+    }
+}
+
+/**
+ * @brief Set the touch rotation relative to the boot orientation
+ * 
+ * @param quarter_turns Clockwise quarter turns (0-3)
+ */
+void esp32_s3_box3_touch_set_rotation(int quarter_turns) {
+    touch_rotation = quarter_turns & 3;
+    touch_update_xform();
+}
+
+/**
+ * @brief Calibrate the touch mapping from three reference points
+ * 
+ * @param raw Controller coordinates of the three touches (x0, y0, x1, y1, x2, y2)
+ * @param screen Display coordinates of the three targets in the current rotation,
+ *               or NULL (with raw NULL) to go back to plain scaling
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if the points are on one line
+ */
+esp_err_t esp32_s3_box3_touch_set_calibration(const int32_t raw[6], const int32_t screen[6]) {
+    if (raw == NULL || screen == NULL) {
+        touch_calibrated = false;
+        touch_update_xform();
+        return ESP_OK;
+    }
+    
+    // Bring the targets back to the boot orientation; rotation is applied after calibration
+    bool swapped = (touch_rotation & 1) != 0;
+    lvml_affine_t unrotate;
+    lvml_affine_rotate(&unrotate, swapped ? TOUCH_DISPLAY_HEIGHT : TOUCH_DISPLAY_WIDTH,
+                       swapped ? TOUCH_DISPLAY_WIDTH : TOUCH_DISPLAY_HEIGHT, 4 - touch_rotation);
+    int32_t targets[6];
+    for (int i = 0; i < 3; i++) {
+        lvml_affine_apply(&unrotate, screen[2 * i], screen[2 * i + 1], &targets[2 * i], &targets[2 * i + 1]);
+    }
+    
+    lvml_affine_t calibration;
+    if (!lvml_affine_from_points(&calibration, raw, targets)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    touch_calibration = calibration;
+    touch_calibrated = true;
+    touch_update_xform();
+    return ESP_OK;
+}
+
+/**
+ * @brief Get the last touch sample delivered to LVGL
+ * 
+ * @param x Output display x
+ * @param y Output display y
+ * @param raw_x Output controller x, may be NULL
+ * @param raw_y Output controller y, may be NULL
+ * @return bool true if the screen was being touched
+ */
+bool esp32_s3_box3_touch_get_point(int32_t *x, int32_t *y, int32_t *raw_x, int32_t *raw_y) {
+    touch_sample_t last = touch_last;
+    *x = last.x;
+    *y = last.y;
+    if (raw_x != NULL) {
+        *raw_x = last.raw_x;
+    }
+    if (raw_y != NULL) {
+        *raw_y = last.raw_y;
+    }
+    return last.pressed;
+}
+
+/**
+ * @brief Take the next recognized gesture
+ * 
+ * @param event Output gesture
+ * @return bool true if a gesture was taken, false if none is waiting
+ */
+bool esp32_s3_box3_touch_pop_gesture(lvml_gesture_event_t *event) {
+    int32_t slot = lvml_spsc_peek(&gesture_queue_idx, TOUCH_GESTURE_QUEUE_SIZE);
+    if (slot < 0) {
+        return false;
+    }
+    *event = gesture_queue[slot];
+    lvml_spsc_release(&gesture_queue_idx);
+    return true;
+}
+
+/**
+ * @brief Get every finger of the last touch sample delivered to LVGL
+ * 
+ * @param contacts Output, room for LVML_GESTURE_MAX_CONTACTS
+ * @return uint8_t Number of fingers down
+ */
+uint8_t esp32_s3_box3_touch_get_contacts(lvml_gesture_contact_t *contacts) {
+    uint8_t count = touch_last.pressed ? touch_last.count : 0;
+    memcpy(contacts, touch_last.contacts, count * sizeof(contacts[0]));
+    return count;
+}
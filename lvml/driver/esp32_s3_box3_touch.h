@@ -3,6 +3,28 @@
 
 #include "esp_err.h"
 #include "lvgl/lvgl.h"
+#include "utils/lvml_gesture.h"
+
+// Touch sampling statistics
+typedef struct {
+    uint32_t irqs;              // Interrupts from the controller
+    uint32_t frames;            // Touch frames read by the sampling task
+    uint32_t samples;           // Samples queued for LVGL
+    uint32_t dropped;           // Samples dropped because the queue was full
+    uint32_t delivered;         // Samples taken by LVGL
+    uint32_t gestures;          // Gestures recognized and queued
+    uint32_t gestures_dropped;  // Gestures lost because nobody took them
+    uint32_t reads;             // LVGL read callbacks
+    uint32_t i2c_last_us;       // Bus time of the last frame read
+    uint32_t i2c_avg_us;        // Bus time per frame read, average
+    uint32_t i2c_max_us;        // Longest frame read on the bus
+    uint32_t bus_transfers;     // I2C transactions issued by the sampling task
+    uint32_t xform_max_cycles;  // Longest coordinate transform, CPU cycles
+    uint32_t read_max_us;       // Longest LVGL read callback
+    uint32_t last_latency_us;   // Interrupt to LVGL read, last sample
+    uint32_t avg_latency_us;    // Interrupt to LVGL read, average
+    uint32_t max_latency_us;    // Interrupt to LVGL read, worst case
+} esp32_s3_box3_touch_stats_t;
 
 // Function declarations for ESP32-S3-Box-3 GT911 Touch driver
 
@@ -18,12 +40,32 @@
  */
 esp_err_t esp32_s3_box3_touch_init(void);
 
+/**
+ * @brief Start initializing the GT911 touch controller on a background task
+ * 
+ * Runs esp32_s3_box3_touch_init() on its own task so its reset delays overlap
+ * whatever the caller does next. Poll esp32_s3_box3_touch_init_status(), then
+ * create the input device from the LVGL thread.
+ * 
+ * @return esp_err_t ESP_OK if started or already initialized, ESP_ERR_NO_MEM on failure
+ */
+esp_err_t esp32_s3_box3_touch_init_async(void);
+
+/**
+ * @brief Get the result of esp32_s3_box3_touch_init_async()
+ * 
+ * @return esp_err_t ESP_ERR_NOT_FINISHED while initializing, the result of
+ *         esp32_s3_box3_touch_init() once done, ESP_ERR_INVALID_STATE if not started
+ */
+esp_err_t esp32_s3_box3_touch_init_status(void);
+
 /**
  * @brief Deinitialize the GT911 touch controller
  * 
  * This function cleans up resources used by the touch controller, including deleting
  * the LVGL input device and uninstalling the I2C driver. It should be called when
- * the touch functionality is no longer needed.
+ * the touch functionality is no longer needed. A running
+ * esp32_s3_box3_touch_init_async() is waited for first.
  */
 void esp32_s3_box3_touch_deinit(void);
 
@@ -49,4 +91,74 @@ lv_indev_t *esp32_s3_box3_touch_create_indev(void);
  */
 bool esp32_s3_box3_touch_is_initialized(void);
 
+/**
+ * @brief Get touch sampling statistics
+ * 
+ * Touches are read by a task woken by the GT911 interrupt and queued for
+ * LVGL, so the input read callback never waits on I2C. These counters show
+ * how long the bus reads and the LVGL callback took, and how long a sample
+ * waited between the interrupt and LVGL reading it.
+ * 
+ * @param stats Output statistics
+ * @param reset Clear the counters after reading them
+ */
+void esp32_s3_box3_touch_get_stats(esp32_s3_box3_touch_stats_t *stats, bool reset);
+
+/**
+ * @brief Set the touch rotation relative to the boot orientation
+ * 
+ * Keeps touch coordinates in line with the display after it is rotated.
+ * The transform is rebuilt once here, not per sample.
+ * 
+ * @param quarter_turns Clockwise quarter turns (0-3)
+ */
+void esp32_s3_box3_touch_set_rotation(int quarter_turns);
+
+/**
+ * @brief Calibrate the touch mapping from three reference points
+ * 
+ * Solves the affine transform that maps the three controller points onto
+ * the three display targets, which corrects offset, scale, skew and a
+ * slightly rotated panel. Pass NULL for both to remove the calibration.
+ * 
+ * @param raw Controller coordinates of the three touches (x0, y0, x1, y1, x2, y2)
+ * @param screen Display coordinates of the three targets in the current rotation
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if the points are on one line
+ */
+esp_err_t esp32_s3_box3_touch_set_calibration(const int32_t raw[6], const int32_t screen[6]);
+
+/**
+ * @brief Get the last touch sample delivered to LVGL
+ * 
+ * @param x Output display x
+ * @param y Output display y
+ * @param raw_x Output controller x, may be NULL
+ * @param raw_y Output controller y, may be NULL
+ * @return bool true if the screen was being touched
+ */
+bool esp32_s3_box3_touch_get_point(int32_t *x, int32_t *y, int32_t *raw_x, int32_t *raw_y);
+
+/**
+ * @brief Get every finger of the last touch sample delivered to LVGL
+ * 
+ * Call from the LVGL thread, e.g. right after the input read callback, to
+ * see the fingers behind the pointer position LVGL was given.
+ * 
+ * @param contacts Output, room for LVML_GESTURE_MAX_CONTACTS, display coordinates
+ * @return uint8_t Number of fingers down
+ */
+uint8_t esp32_s3_box3_touch_get_contacts(lvml_gesture_contact_t *contacts);
+
+/**
+ * @brief Take the next recognized gesture
+ * 
+ * The sampling task runs every frame of all five contacts through the
+ * gesture recognizer (lvml_gesture.h) and queues the results here; the
+ * core takes them once per tick and sends them to LVGL objects.
+ * 
+ * @param event Output gesture
+ * @return bool true if a gesture was taken, false if none is waiting
+ */
+bool esp32_s3_box3_touch_pop_gesture(lvml_gesture_event_t *event);
+
 #endif /* ESP32_S3_BOX3_TOUCH_H */
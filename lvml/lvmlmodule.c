@@ -1,41 +1,224 @@
 // lvml MicroPython user C module
-// Core: lvml.init() - Initialize LVML system
+// Core: lvml.splash(src) - Show a make_splash.py or screenshot splash before init(), without LVGL
+//      lvml.init(async_touch=False) - Initialize LVML system (touch in the background)
+//      lvml.wait_ready(part='touch', timeout_ms=-1) - Wait for a part init() left running
 //      lvml.set_bg() - Set background color  
 //      lvml.rect() - Draw rectangles
 //      lvml.button() - Create buttons
 //      lvml.textarea() - Create text areas
+//          (these and show_image() return a Widget handle: .text .pos .bg .hidden .delete() .on())
+//      lvml.batch(commands) - Create many rects/buttons/text areas in one call
+//      lvml.canvas(x, y, w, h, fmt='RGB565') - Canvas with a writable pixel buffer
+//      lvml.screenshot(out=None, fmt='qoi', area=None) - Capture the screen in bands (qoi/rgb565/splash)
+//      lvml.snapshot_state(path=None) - Save the widget tree (bytes, or to a file)
+//      lvml.restore_state(src) - Recreate a saved widget tree without XML or scripts
+//      lvml.find(name) - Widget handle for a named XML element
+//      lvml.handle_stats() - Widget handle statistics
+//      lvml.event_stats(reset=False) - Event queue, coalescing and dispatch latency
+//      lvml.refresh_stats(reset=False) - Invalidated areas and pixels
+//      lvml.touch_stats(reset=False) - Touch sampling, bus time and latency
+//      lvml.touch_point(raw=False) - Last touch point (x, y, pressed)
+//      lvml.touch_calibrate(screen, raw) - 3-point touch calibration
+//      lvml.gesture(name) - Latest tap/double_tap/long_press/swipe/pinch/rotate/pan
+//      lvml.input_record() / input_save(path) - Record touch input to a file
+//      lvml.input_replay(src, speed=1.0) - Replay a recording (speed 0: one state per read)
+//      lvml.input_replay_stop() / input_status() - Stop a replay, recorder and replay state
 //      lvml.tick() - Process LVGL timers (call periodically)
+//      lvml.log_level(module, level=None) - Runtime log level per module
+//      lvml.log_flush() - Print buffered log records now
+//      lvml.log_stats(reset=False) - Log records written, dropped and drained
+//      lvml.mark(stage) - Timestamp the end of a boot stage
+//      lvml.boot_report() - Boot stages, time to first pixel, first frame and first touch
 //      lvml.debug() - Debug system and test display
-//          lvml.load_from_url() - Load UI from URL
+//      lvml.style_stats() - Shared style interning statistics
+//      lvml.set_many() - Update bound XML subjects in one batch
+//      lvml.bind_stats() - Data binding statistics
+//      lvml.load_xml(xml, profile=True) - Load XML and report build cost
+//      lvml.run_script() - Run a script through the bytecode cache
+//      lvml.script_stats() - Script cache statistics
+//      lvml.load_from_url() - Load UI from URL (cached, revalidated in background)
+//      lvml.fetch_stats() - HTTP cache statistics
+//      lvml.prefetch_stats() - Navigation latency and prefetch hit rate
+//      lvml.wifi(ssid=None, password=None) - Connect WiFi from C and keep it connected; WiFi state
+//      lvml.net_get(url, priority=NET_NORMAL, into=None, name=None) - Queue a GET on the network task
+//      lvml.net_readinto(id, buf) - Read streamed body bytes (None: nothing yet, 0: end of body)
+//      lvml.net_result(id) - Status and timing of a finished request (None until then)
+//      lvml.net_cancel(id) - Drop a request
+//      lvml.net_stats() - Network manager statistics
+//      lvml.push_connect(host, port=8765) - Keep a push channel open; tick() applies its updates
+//      lvml.push_close() - Close the push channel
+//      lvml.push_stats(reset=False) - Push updates, bytes, apply time and latency
+//      lvml.mirror_start(host, port=8766, fps=10, fmt='splash') - Stream changed screen areas to a viewer
+//      lvml.mirror_stop() - Stop mirroring
+//      lvml.mirror_stats(reset=False) - Mirrored frames, merged refreshes, bytes and flush cost
+//      lvml.load_bundle() - Load UI, scripts and images from one bundle file
 //          lvml.load_from_xml() - Load UI from XML data
 // Info: lvml.is_ready() - Check if LVML is ready
 //       lvml.get_version() - Get LVML version
 
 #include "micropython/py/runtime.h"
 #include "micropython/py/mphal.h"
+#include "micropython/py/mperrno.h"
 #include "core/lvml_core.h"
+#include "core/lvml_style.h"
+#include "core/lvml_bind.h"
+#include "core/lvml_capture.h"
+#include "core/lvml_input.h"
+#include "core/lvml_live.h"
+#include "core/lvml_replay.h"
+#include "core/lvml_state.h"
+#include "micropython/lvml_canvas.h"
+#include "micropython/lvml_events.h"
+#include "micropython/lvml_handle.h"
+#include "micropython/lvml_script.h"
+#include "micropython/lvml_vfs.h"
+#include "network/lvml_fetch.h"
+#include "network/lvml_net.h"
+#include "network/lvml_prefetch.h"
+#include "network/lvml_mirror.h"
+#include "network/lvml_push.h"
+#include "utils/lvml_boot.h"
+#include "utils/lvml_bundle.h"
+#include "utils/lvml_log.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_time.h"
 #include "driver/esp32_s3_box3_lcd.h"
 #include "driver/esp32_s3_box3_touch.h"
+#include <string.h>
 
 static bool lvgl_initialized = false;
 
+// URL of the UI shown by lvml.load_from_url(), reloaded when it changes
+static char current_url[LVML_MAX_URL_LENGTH];
 
-static mp_obj_t lvml_init(void) {
+static bool log_drain_scheduled = false;
+
+// Print one drained log line
+static void lvml_log_print(const char* line, size_t len, void* user) {
+    (void)user;
+    mp_print_strn(&mp_plat_print, line, len, 0, 0, 0);
+    mp_print_str(&mp_plat_print, "\n");
+}
+
+// Runs from the scheduler after lvml.tick() returns, off the render path
+static mp_obj_t lvml_log_drain_sched(mp_obj_t arg) {
+    (void)arg;
+    log_drain_scheduled = false;
+    lvml_log_drain(lvml_log_print, NULL, 0);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_log_drain_obj, lvml_log_drain_sched);
+
+static void lvml_log_schedule_drain(void) {
+    if (log_drain_scheduled || !lvml_log_pending()) {
+        return;
+    }
+#if MICROPY_ENABLE_SCHEDULER
+    log_drain_scheduled = mp_sched_schedule(MP_OBJ_FROM_PTR(&lvml_log_drain_obj), mp_const_none);
+#endif
+    if (!log_drain_scheduled) {
+        lvml_log_drain(lvml_log_print, NULL, 0);
+    }
+}
+
+
+// init(async_touch=False): with async_touch, returns once the display is
+// usable while the touch controller comes up on its own task
+static mp_obj_t lvml_init(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_async_touch };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_async_touch, MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
     if (lvgl_initialized) {
         return mp_const_none;
     }
     
     // Use unified core init (includes display setup)
-    lvml_error_t result = lvml_core_init();
+    lvml_error_t result = lvml_core_init(args[ARG_async_touch].u_bool);
+    // Show why init failed, or what it found, before returning
+    lvml_log_drain(lvml_log_print, NULL, 0);
     if (result != LVML_OK) {
         mp_raise_msg(&mp_type_RuntimeError, "Failed to initialize LVML");
     }
     
+    // Keep the HTTP cache in the VFS
+    lvml_fetch_set_store(&lvml_vfs_fetch_store);
+    
     lvgl_initialized = true;
     
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_0(lvml_init_obj, lvml_init);
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_init_obj, 0, lvml_init);
+
+// Wait for a part of init(async_touch=True): wait_ready(part='touch', timeout_ms=-1)
+// -> True when ready, False on timeout (timeout_ms=0 polls); OSError if it failed
+static mp_obj_t lvml_wait_ready_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_part, ARG_timeout_ms };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_part, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_touch)} },
+        { MP_QSTR_timeout_ms, MP_ARG_INT, {.u_int = -1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    // The display is up when init() returns
+    qstr part = mp_obj_str_get_qstr(args[ARG_part].u_obj);
+    if (part == MP_QSTR_display) {
+        return mp_const_true;
+    }
+    if (part != MP_QSTR_touch) {
+        mp_raise_msg(&mp_type_ValueError, "part must be 'display' or 'touch'");
+    }
+    
+    mp_int_t timeout_ms = args[ARG_timeout_ms].u_int;
+    mp_uint_t start = mp_hal_ticks_ms();
+    lvml_ready_t state;
+    while ((state = lvml_core_touch_ready()) == LVML_READY_PENDING) {
+        if (timeout_ms >= 0 && (mp_int_t)(mp_hal_ticks_ms() - start) >= timeout_ms) {
+            return mp_const_false;
+        }
+        mp_hal_delay_ms(1);
+    }
+    lvml_log_drain(lvml_log_print, NULL, 0);
+    if (state == LVML_READY_FAILED) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_true;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_wait_ready_obj, 0, lvml_wait_ready_mp);
+
+// Early splash: splash(src) streams a scripts/make_splash.py image, or a
+// screenshot(fmt='splash'), to the panel before init(). src is a path or the
+// splash bytes, which are read in place, so frozen bytes stay in flash.
+static mp_obj_t lvml_splash_mp(mp_obj_t data_in) {
+    if (mp_obj_is_str(data_in)) {
+        data_in = lvml_vfs_read(mp_obj_str_get_str(data_in));
+        if (data_in == MP_OBJ_NULL) {
+            mp_raise_OSError(MP_ENOENT);
+        }
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    
+    lvml_error_t result = lvml_core_show_splash((const uint8_t*)bufinfo.buf, bufinfo.len);
+    lvml_log_drain(lvml_log_print, NULL, 0);
+    if (result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid splash data");
+    } else if (result == LVML_ERROR_MEMORY) {
+        mp_raise_msg(&mp_type_MemoryError, "No DMA memory for the splash");
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "Failed to show splash");
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_splash_obj, lvml_splash_mp);
 
 static mp_obj_t lvml_set_bg(mp_obj_t color_obj) {
     if (!lvgl_initialized) {
@@ -76,17 +259,112 @@ static mp_obj_t lvml_is_initialized(void) {
 static MP_DEFINE_CONST_FUN_OBJ_0(lvml_is_initialized_obj, lvml_is_initialized);
 
 
+// Background fetch finished: reload the current UI on updates, warm up
+// prefetched screens (their assets) and images (LVGL image registry)
+static bool lvml_fetch_event_cb(lvml_fetch_event_t event, const char* url, const char* ref,
+                                const uint8_t* data, size_t len, void* user_data) {
+    (void)user_data;
+    if (event == LVML_FETCH_PREFETCHED) {
+        if (len > 8 && memcmp(data, "\x89PNG", 4) == 0) {
+            return lvml_ui_register_image(ref, data, len) == LVML_OK;
+        }
+        const char* p = (const char*)data;
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+            p++;
+        }
+        if (*p != '<') {
+            // Scripts and other assets only need to be in the HTTP cache
+            return true;
+        }
+        lvml_prefetch_links(p, url, false);
+        return false;
+    }
+    
+    if (strcmp(url, current_url) != 0) {
+        return false;
+    }
+    lvml_ui_unload_xml();
+    if (lvml_ui_load_xml((const char*)data) != LVML_OK) {
+        mp_printf(&mp_plat_print, "[LVML] Failed to reload %s\n", url);
+    }
+    return false;
+}
+
+// net_get(into='xml'/'image') requests: the body is collected outside the
+// MicroPython heap and handed to the XML loader or image registry by tick()
+#define LVML_NET_INTO_MAX 8
+#define LVML_NET_NAME_MAX 128
+
+typedef struct {
+    uint32_t id;                        // 0: free
+    bool image;
+    volatile bool cancelled;            // Finished by tick() without using the body
+    char name[LVML_NET_NAME_MAX];       // Image name
+    lvml_net_buffer_t body;             // Written by the network task until the request finishes
+} lvml_net_into_t;
+
+static lvml_net_into_t lvml_net_into[LVML_NET_INTO_MAX];
+
+// Runs on the network task
+static bool lvml_net_into_append(const uint8_t* data, size_t len, void* user_data) {
+    lvml_net_into_t* into = (lvml_net_into_t*)user_data;
+    return !into->cancelled && lvml_net_buffer_append(data, len, &into->body);
+}
+
+static void lvml_net_into_poll(void) {
+    for (uint32_t i = 0; i < LVML_NET_INTO_MAX; i++) {
+        lvml_net_into_t* into = &lvml_net_into[i];
+        lvml_net_result_t r;
+        if (into->id == 0 || !lvml_net_finish(into->id, &r)) {
+            continue;
+        }
+        
+        lvml_error_t result = LVML_ERROR_NETWORK;
+        if (into->cancelled) {
+            result = LVML_OK;
+        } else if (r.result == LVML_OK && r.status == 200 && into->body.len > 0) {
+            if (into->image) {
+                result = lvml_ui_register_image(into->name, into->body.data, into->body.len);
+            } else {
+                lvml_ui_unload_xml();
+                result = lvml_ui_load_xml((const char*)into->body.data);
+                current_url[0] = '\0';
+            }
+        }
+        if (result != LVML_OK) {
+            mp_printf(&mp_plat_print, "[LVML] net_get %u failed (status %d)\n", (unsigned)into->id, r.status);
+        }
+        lvml_net_buffer_free(&into->body);
+        into->id = 0;
+    }
+}
+
 static mp_obj_t lvml_tick(void) {
     if (!lvgl_initialized) {
         mp_raise_msg(&mp_type_RuntimeError, "LVGL not initialized. Call lvml.init() first.");
     }
     
+    // Pushed updates go in before the frame is rendered
+    lvml_live_poll();
+    
     // Use core function to process tick
     lvml_error_t result = lvml_core_tick();
     if (result != LVML_OK) {
         mp_raise_msg(&mp_type_RuntimeError, "Failed to process LVGL tick");
     }
     
+    // Commit background revalidations and prefetches (the cache lives in the VFS)
+    lvml_fetch_poll(lvml_fetch_event_cb, NULL);
+    
+    // Show or register bodies the network task finished collecting
+    lvml_net_into_poll();
+    
+    // Event callbacks normally run from the scheduler once this returns
+    lvml_events_poll();
+    
+    // Log records are formatted and printed after the frame, not while rendering
+    lvml_log_schedule_drain();
+    
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_0(lvml_tick_obj, lvml_tick);
@@ -117,6 +395,9 @@ static mp_obj_t lvml_deinit(void) {
         return mp_const_none;
     }
     
+    // The LVGL objects outlive lvml, their Python callbacks shouldn't
+    lvml_events_reset();
+
     // Use core function to deinitialize
     lvml_error_t result = lvml_core_deinit();
     if (result != LVML_OK) {
@@ -191,7 +472,8 @@ static mp_obj_t lvml_rect_mp(size_t n_args, const mp_obj_t *args) {
     }
     
     // Create rectangle
-    result = lvml_ui_rect(x, y, width, height, color_hex, border_color_hex, border_width);
+    lv_obj_t* obj;
+    result = lvml_ui_rect(x, y, width, height, color_hex, border_color_hex, border_width, &obj);
     if (result != LVML_OK) {
         if (result == LVML_ERROR_INVALID_PARAM) {
             mp_raise_msg(&mp_type_ValueError, "Invalid rectangle parameters");
@@ -200,7 +482,7 @@ static mp_obj_t lvml_rect_mp(size_t n_args, const mp_obj_t *args) {
         }
     }
     
-    return mp_const_none;
+    return lvml_handle_new(obj, MP_OBJ_NULL);
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_rect_obj, 7, 7, lvml_rect_mp);
 
@@ -259,7 +541,8 @@ static mp_obj_t lvml_button_mp(size_t n_args, const mp_obj_t *args) {
     }
     
     // Create button
-    result = lvml_ui_button(x, y, width, height, text, bg_color_hex, text_color_hex);
+    lv_obj_t* obj;
+    result = lvml_ui_button(x, y, width, height, text, bg_color_hex, text_color_hex, &obj);
     if (result != LVML_OK) {
         if (result == LVML_ERROR_INVALID_PARAM) {
             mp_raise_msg(&mp_type_ValueError, "Invalid button parameters");
@@ -268,7 +551,7 @@ static mp_obj_t lvml_button_mp(size_t n_args, const mp_obj_t *args) {
         }
     }
     
-    return mp_const_none;
+    return lvml_handle_new(obj, MP_OBJ_NULL);
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_button_obj, 7, 7, lvml_button_mp);
 
@@ -327,7 +610,8 @@ static mp_obj_t lvml_textarea_mp(size_t n_args, const mp_obj_t *args) {
     }
     
     // Create text area
-    result = lvml_ui_textarea(x, y, width, height, placeholder, bg_color_hex, text_color_hex);
+    lv_obj_t* obj;
+    result = lvml_ui_textarea(x, y, width, height, placeholder, bg_color_hex, text_color_hex, &obj);
     if (result != LVML_OK) {
         if (result == LVML_ERROR_INVALID_PARAM) {
             mp_raise_msg(&mp_type_ValueError, "Invalid text area parameters");
@@ -336,7 +620,7 @@ static mp_obj_t lvml_textarea_mp(size_t n_args, const mp_obj_t *args) {
         }
     }
     
-    return mp_const_none;
+    return lvml_handle_new(obj, MP_OBJ_NULL);
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_textarea_obj, 7, 7, lvml_textarea_mp);
 
@@ -366,7 +650,8 @@ static mp_obj_t lvml_show_image_mp(size_t n_args, const mp_obj_t *args) {
     }
     
     // Show image from raw data (let LVGL handle size automatically)
-    lvml_error_t result = lvml_ui_show_image_data((const uint8_t*)bufinfo.buf, bufinfo.len, x, y);
+    lv_obj_t* obj;
+    lvml_error_t result = lvml_ui_show_image_data((const uint8_t*)bufinfo.buf, bufinfo.len, x, y, &obj);
     
     if (result != LVML_OK) {
         if (result == LVML_ERROR_INVALID_PARAM) {
@@ -376,10 +661,365 @@ static mp_obj_t lvml_show_image_mp(size_t n_args, const mp_obj_t *args) {
         }
     }
     
-    return mp_const_none;
+    // The image decodes from its own copy of the data
+    return lvml_handle_new(obj, MP_OBJ_NULL);
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_show_image_obj, 1, 3, lvml_show_image_mp);
 
+// Last color string parsed for a batch field; runs of the same color object skip the parse
+typedef struct {
+    mp_obj_t obj;
+    uint32_t hex;
+} lvml_batch_color_t;
+
+static uint32_t lvml_batch_color(mp_obj_t obj, lvml_batch_color_t* cache) {
+    if (mp_obj_is_int(obj)) {
+        return (uint32_t)mp_obj_get_int(obj) & 0xFFFFFF;
+    }
+    if (obj == cache->obj) {
+        return cache->hex;
+    }
+    if (!mp_obj_is_str(obj)) {
+        mp_raise_msg(&mp_type_ValueError, "Color must be a string (hex or name) or integer");
+    }
+    
+    uint32_t hex;
+    if (lvml_ui_parse_color(mp_obj_str_get_str(obj), 0, &hex) != LVML_OK) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid color format");
+    }
+    cache->obj = obj;
+    cache->hex = hex & 0xFFFFFF;
+    return cache->hex;
+}
+
+// (op, x, y, width, height, color, color2, border_width or text) -> command
+static void lvml_batch_parse_tuple(mp_obj_t item, lvml_ui_cmd_t* cmd, lvml_batch_color_t* colors) {
+    size_t len;
+    mp_obj_t* fields;
+    mp_obj_get_array(item, &len, &fields);
+    if (len != LVML_UI_CMD_WORDS) {
+        mp_raise_msg(&mp_type_TypeError, "batch command must have 8 fields");
+    }
+    
+    if (mp_obj_is_int(fields[0])) {
+        cmd->op = (lvml_ui_cmd_op_t)mp_obj_get_int(fields[0]);
+    } else {
+        const char* op = mp_obj_str_get_str(fields[0]);
+        if (strcmp(op, "rect") == 0) {
+            cmd->op = LVML_UI_CMD_RECT;
+        } else if (strcmp(op, "button") == 0) {
+            cmd->op = LVML_UI_CMD_BUTTON;
+        } else if (strcmp(op, "textarea") == 0) {
+            cmd->op = LVML_UI_CMD_TEXTAREA;
+        } else {
+            mp_raise_msg(&mp_type_ValueError, "Unknown batch command");
+        }
+    }
+    cmd->x = mp_obj_get_int(fields[1]);
+    cmd->y = mp_obj_get_int(fields[2]);
+    cmd->width = mp_obj_get_int(fields[3]);
+    cmd->height = mp_obj_get_int(fields[4]);
+    cmd->color = lvml_batch_color(fields[5], &colors[0]);
+    cmd->color2 = lvml_batch_color(fields[6], &colors[1]);
+    cmd->border_width = 0;
+    cmd->text = NULL;
+    if (cmd->op == LVML_UI_CMD_RECT) {
+        cmd->border_width = mp_obj_get_int(fields[7]);
+    } else if (fields[7] != mp_const_none) {
+        cmd->text = mp_obj_str_get_str(fields[7]);
+    }
+}
+
+// Packed record of LVML_UI_CMD_WORDS native int32 words; arg indexes texts for buttons and text areas
+static void lvml_batch_parse_packed(const uint8_t* record, size_t n_texts, const mp_obj_t* texts, lvml_ui_cmd_t* cmd) {
+    int32_t words[LVML_UI_CMD_WORDS];
+    memcpy(words, record, sizeof(words));
+    
+    cmd->op = (lvml_ui_cmd_op_t)words[0];
+    cmd->x = words[1];
+    cmd->y = words[2];
+    cmd->width = words[3];
+    cmd->height = words[4];
+    cmd->color = (uint32_t)words[5] & 0xFFFFFF;
+    cmd->color2 = (uint32_t)words[6] & 0xFFFFFF;
+    cmd->border_width = 0;
+    cmd->text = NULL;
+    if (cmd->op == LVML_UI_CMD_RECT) {
+        cmd->border_width = words[7];
+    } else if (words[7] >= 0) {
+        if ((size_t)words[7] >= n_texts) {
+            mp_raise_msg(&mp_type_IndexError, "batch text index out of range");
+        }
+        cmd->text = mp_obj_str_get_str(texts[words[7]]);
+    }
+}
+
+// Create many rects, buttons and text areas in one call:
+// batch(commands, *, texts=None, handles=False)
+static mp_obj_t lvml_batch_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_commands, ARG_texts, ARG_handles };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_commands, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_texts, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_handles, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    mp_obj_t commands = args[ARG_commands].u_obj;
+    size_t count;
+    mp_obj_t* items = NULL;
+    mp_buffer_info_t bufinfo;
+    size_t n_texts = 0;
+    mp_obj_t* texts = NULL;
+    
+    if (mp_obj_is_type(commands, &mp_type_list) || mp_obj_is_type(commands, &mp_type_tuple)) {
+        mp_obj_get_array(commands, &count, &items);
+    } else if (!mp_obj_is_str(commands) && mp_get_buffer(commands, &bufinfo, MP_BUFFER_READ)) {
+        const size_t record_size = LVML_UI_CMD_WORDS * sizeof(int32_t);
+        if (bufinfo.len % record_size != 0) {
+            mp_raise_msg(&mp_type_ValueError, "Command buffer length must be a multiple of 32 bytes");
+        }
+        count = bufinfo.len / record_size;
+        if (args[ARG_texts].u_obj != mp_const_none) {
+            mp_obj_get_array(args[ARG_texts].u_obj, &n_texts, &texts);
+        }
+    } else {
+        mp_raise_msg(&mp_type_TypeError, "commands must be a list of tuples or a buffer");
+    }
+    
+    mp_obj_t handles = args[ARG_handles].u_bool ? mp_obj_new_list(0, NULL) : MP_OBJ_NULL;
+    
+    lvml_error_t result = lvml_ui_batch_begin();
+    if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "Failed to start batch");
+    }
+    
+    // The batch must end even if a command is rejected halfway
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        lvml_batch_color_t colors[2] = { { MP_OBJ_NULL, 0 }, { MP_OBJ_NULL, 0 } };
+        for (size_t i = 0; i < count; i++) {
+            lvml_ui_cmd_t cmd;
+            if (items != NULL) {
+                lvml_batch_parse_tuple(items[i], &cmd, colors);
+            } else {
+                lvml_batch_parse_packed((const uint8_t*)bufinfo.buf + i * LVML_UI_CMD_WORDS * sizeof(int32_t),
+                                        n_texts, texts, &cmd);
+            }
+            
+            lv_obj_t* obj;
+            result = lvml_ui_batch_create(&cmd, &obj);
+            if (result == LVML_ERROR_INVALID_PARAM) {
+                mp_raise_msg(&mp_type_ValueError, "Invalid batch command parameters");
+            } else if (result != LVML_OK) {
+                mp_raise_msg(&mp_type_RuntimeError, "Failed to create batch object");
+            }
+            if (handles != MP_OBJ_NULL) {
+                mp_obj_list_append(handles, lvml_handle_new(obj, MP_OBJ_NULL));
+            }
+        }
+        nlr_pop();
+    } else {
+        lvml_ui_batch_end();
+        nlr_jump(nlr.ret_val);
+    }
+    lvml_ui_batch_end();
+    
+    return handles != MP_OBJ_NULL ? handles : mp_obj_new_int_from_uint(count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_batch_obj, 1, lvml_batch_mp);
+
+// Canvas with a writable pixel buffer: canvas(x, y, w, h, fmt='RGB565')
+static mp_obj_t lvml_canvas_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_x, ARG_y, ARG_w, ARG_h, ARG_fmt };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_w, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_h, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_fmt, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_RGB565)} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    return lvml_canvas_new(args[ARG_x].u_int, args[ARG_y].u_int, args[ARG_w].u_int, args[ARG_h].u_int,
+                           mp_obj_str_get_qstr(args[ARG_fmt].u_obj));
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_canvas_obj, 4, lvml_canvas_mp);
+
+// Screenshot output: appended to a buffer, or passed to out.write()
+typedef struct {
+    vstr_t* vstr;
+    mp_obj_t write[2];
+    mp_obj_t error;
+} lvml_screenshot_out_t;
+
+// Called while the display renders; exceptions must not unwind through LVGL
+static bool lvml_screenshot_write(const uint8_t* data, size_t len, void* user_data) {
+    lvml_screenshot_out_t* out = (lvml_screenshot_out_t*)user_data;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        if (out->vstr != NULL) {
+            vstr_add_strn(out->vstr, (const char*)data, len);
+        } else {
+            mp_obj_t args[3] = { out->write[0], out->write[1], mp_obj_new_bytes(data, len) };
+            mp_call_method_n_kw(1, 0, args);
+        }
+        nlr_pop();
+        return true;
+    }
+    out->error = MP_OBJ_FROM_PTR(nlr.ret_val);
+    return false;
+}
+
+// Capture the screen: screenshot(out=None, *, fmt='qoi', area=None)
+// Returns the image as bytes, or the number of bytes written to out;
+// fmt='splash' makes an image for splash() at the next boot
+static mp_obj_t lvml_screenshot_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_out, ARG_fmt, ARG_area };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_out, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_fmt, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_qoi)} },
+        { MP_QSTR_area, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    qstr fmt = mp_obj_str_get_qstr(args[ARG_fmt].u_obj);
+    lvml_capture_format_t format;
+    if (fmt == MP_QSTR_qoi) {
+        format = LVML_CAPTURE_QOI;
+    } else if (fmt == MP_QSTR_rgb565) {
+        format = LVML_CAPTURE_RGB565;
+    } else if (fmt == MP_QSTR_splash) {
+        format = LVML_CAPTURE_SPLASH;
+    } else {
+        mp_raise_msg(&mp_type_ValueError, "fmt must be 'qoi', 'rgb565' or 'splash'");
+    }
+    
+    // area=(x, y, w, h)
+    lv_area_t area;
+    lv_area_t* area_ptr = NULL;
+    if (args[ARG_area].u_obj != mp_const_none) {
+        mp_obj_t* xywh;
+        mp_obj_get_array_fixed_n(args[ARG_area].u_obj, 4, &xywh);
+        area.x1 = mp_obj_get_int(xywh[0]);
+        area.y1 = mp_obj_get_int(xywh[1]);
+        area.x2 = area.x1 + mp_obj_get_int(xywh[2]) - 1;
+        area.y2 = area.y1 + mp_obj_get_int(xywh[3]) - 1;
+        area_ptr = &area;
+    }
+    
+    lvml_screenshot_out_t out = { NULL, { MP_OBJ_NULL, MP_OBJ_NULL }, MP_OBJ_NULL };
+    vstr_t vstr;
+    if (args[ARG_out].u_obj == mp_const_none) {
+        vstr_init(&vstr, 4096);
+        out.vstr = &vstr;
+    } else {
+        mp_load_method(args[ARG_out].u_obj, MP_QSTR_write, out.write);
+    }
+    
+    lvml_capture_info_t info;
+    lvml_error_t result = lvml_capture(area_ptr, format, lvml_screenshot_write, &out, &info);
+    if (out.error != MP_OBJ_NULL) {
+        if (out.vstr != NULL) {
+            vstr_clear(out.vstr);
+        }
+        nlr_raise(out.error);
+    }
+    if (result != LVML_OK) {
+        if (out.vstr != NULL) {
+            vstr_clear(out.vstr);
+        }
+        if (result == LVML_ERROR_INVALID_PARAM) {
+            mp_raise_msg(&mp_type_ValueError, "Invalid screenshot area");
+        }
+        mp_raise_msg(&mp_type_RuntimeError, "Failed to capture screen");
+    }
+    
+    if (out.vstr != NULL) {
+        return mp_obj_new_bytes_from_vstr(out.vstr);
+    }
+    return mp_obj_new_int_from_uint(info.bytes);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_screenshot_obj, 0, lvml_screenshot_mp);
+
+// Save the widget tree: snapshot_state(path=None) -> bytes, or bytes written
+// to path. Snapshots are small enough for RTC memory (machine.RTC().memory())
+static mp_obj_t lvml_snapshot_state_mp(size_t n_args, const mp_obj_t *args) {
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized");
+    }
+
+    // Static, so a snapshot left behind by a raise below is freed by the next call
+    static lvml_snapshot_writer_t w;
+    lvml_snapshot_free(&w);
+    if (lvml_state_snapshot(&w, NULL) != LVML_OK) {
+        mp_raise_msg(&mp_type_MemoryError, "Out of memory for the snapshot");
+    }
+
+    mp_obj_t ret;
+    if (n_args > 0 && args[0] != mp_const_none) {
+        if (!lvml_vfs_write(mp_obj_str_get_str(args[0]), w.data, w.len)) {
+            mp_raise_OSError(MP_EIO);
+        }
+        ret = mp_obj_new_int_from_uint(w.len);
+    } else {
+        ret = mp_obj_new_bytes(w.data, w.len);
+    }
+    lvml_snapshot_free(&w);
+    return ret;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_snapshot_state_obj, 0, 1, lvml_snapshot_state_mp);
+
+// Recreate a saved widget tree on the active screen, replacing its content:
+// restore_state(src) -> {'nodes', 'skipped', 'bytes', 'time_us'}
+// src is a path or the snapshot bytes. Re-attach handlers with find(name).
+static mp_obj_t lvml_restore_state_mp(mp_obj_t src_in) {
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized");
+    }
+    if (mp_obj_is_str(src_in)) {
+        src_in = lvml_vfs_read(mp_obj_str_get_str(src_in));
+        if (src_in == MP_OBJ_NULL) {
+            mp_raise_OSError(MP_ENOENT);
+        }
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(src_in, &bufinfo, MP_BUFFER_READ);
+
+    lvml_state_info_t info;
+    lvml_error_t result = lvml_state_restore((const uint8_t*)bufinfo.buf, bufinfo.len, &info);
+    if (result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid snapshot, or made for another display size");
+    } else if (result == LVML_ERROR_MEMORY) {
+        mp_raise_msg(&mp_type_MemoryError, "Out of memory restoring the snapshot");
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "Failed to restore the snapshot");
+    }
+
+    mp_obj_t dict = mp_obj_new_dict(4);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_nodes), mp_obj_new_int_from_uint(info.nodes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_skipped), mp_obj_new_int_from_uint(info.skipped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes), mp_obj_new_int_from_uint(info.bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_time_us), mp_obj_new_int_from_uint(info.time_us));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_restore_state_obj, lvml_restore_state_mp);
+
 // Consolidated debug function
 static mp_obj_t lvml_debug_mp(size_t n_args, const mp_obj_t *args) {
     if (!lvgl_initialized) {
@@ -401,17 +1041,17 @@ static mp_obj_t lvml_debug_mp(size_t n_args, const mp_obj_t *args) {
         }
         
         // Create test rectangles
-        result = lvml_ui_rect(50, 50, 100, 100, 0xFF0000, 0x000000, 0);  // Red
+        result = lvml_ui_rect(50, 50, 100, 100, 0xFF0000, 0x000000, 0, NULL);  // Red
         if (result != LVML_OK) {
             mp_printf(&mp_plat_print, "Failed to create red rectangle\n");
         }
         
-        result = lvml_ui_rect(200, 50, 100, 100, 0x0000FF, 0x000000, 0);  // Blue
+        result = lvml_ui_rect(200, 50, 100, 100, 0x0000FF, 0x000000, 0, NULL);  // Blue
         if (result != LVML_OK) {
             mp_printf(&mp_plat_print, "Failed to create blue rectangle\n");
         }
         
-        result = lvml_ui_rect(50, 200, 100, 100, 0x00FF00, 0x000000, 0);  // Green
+        result = lvml_ui_rect(50, 200, 100, 100, 0x00FF00, 0x000000, 0, NULL);  // Green
         if (result != LVML_OK) {
             mp_printf(&mp_plat_print, "Failed to create green rectangle\n");
         }
@@ -421,18 +1061,214 @@ static mp_obj_t lvml_debug_mp(size_t n_args, const mp_obj_t *args) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_debug_obj, 0, 1, lvml_debug_mp);
 
+// Look up an element of the loaded XML by its name="..." attribute
+static mp_obj_t lvml_find_mp(mp_obj_t name_obj) {
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    const char* name = mp_obj_str_get_str(name_obj);
+    lv_obj_t* root = lvml_ui_get_xml_root();
+    lv_obj_t* obj = lv_obj_find_by_name(root != NULL ? root : lv_screen_active(), name);
+    if (obj == NULL) {
+        return mp_const_none;
+    }
+    return lvml_handle_new(obj, MP_OBJ_NULL);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_find_obj, lvml_find_mp);
+
+// Widget handle statistics
+static mp_obj_t lvml_handle_stats_mp(void) {
+    lvml_handle_stats_t stats;
+    lvml_handle_get_stats(&stats);
+    
+    mp_obj_t dict = mp_obj_new_dict(5);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_created), mp_obj_new_int_from_uint(stats.created));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_live), mp_obj_new_int_from_uint(stats.live));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_deleted), mp_obj_new_int_from_uint(stats.deleted));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_updates), mp_obj_new_int_from_uint(stats.updates));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_unchanged), mp_obj_new_int_from_uint(stats.unchanged));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_handle_stats_obj, lvml_handle_stats_mp);
+
+// Event bridge statistics: event_stats(reset=False)
+static mp_obj_t lvml_event_stats_mp(size_t n_args, const mp_obj_t *args) {
+    lvml_events_stats_t stats;
+    lvml_events_get_stats(&stats, n_args > 0 && mp_obj_is_true(args[0]));
+    
+    mp_obj_t dict = mp_obj_new_dict(9);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_received), mp_obj_new_int_from_uint(stats.received));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_coalesced), mp_obj_new_int_from_uint(stats.coalesced));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dropped), mp_obj_new_int_from_uint(stats.dropped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dispatched), mp_obj_new_int_from_uint(stats.dispatched));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dispatches), mp_obj_new_int_from_uint(stats.dispatches));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_errors), mp_obj_new_int_from_uint(stats.errors));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_last_latency_us), mp_obj_new_int_from_uint(stats.last_latency_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_avg_latency_us), mp_obj_new_int_from_uint(stats.avg_latency_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_max_latency_us), mp_obj_new_int_from_uint(stats.max_latency_us));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_event_stats_obj, 0, 1, lvml_event_stats_mp);
+
+// Display invalidation statistics: refresh_stats(reset=False)
+static mp_obj_t lvml_refresh_stats_mp(size_t n_args, const mp_obj_t *args) {
+    lvml_refresh_stats_t stats;
+    lvml_core_get_refresh_stats(&stats, n_args > 0 && mp_obj_is_true(args[0]));
+    
+    mp_obj_t dict = mp_obj_new_dict(2);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_invalidations), mp_obj_new_int_from_uint(stats.invalidations));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_invalidated_px), mp_obj_new_int_from_ull(stats.invalidated_px));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_refresh_stats_obj, 0, 1, lvml_refresh_stats_mp);
+
+// Style interning statistics
+static mp_obj_t lvml_style_stats_mp(void) {
+    lvml_style_stats_t stats;
+    lvml_style_get_stats(&stats);
+    
+    mp_obj_t dict = mp_obj_new_dict(4);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_unique), mp_obj_new_int_from_uint(stats.unique));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_refs), mp_obj_new_int_from_uint(stats.refs));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_used), mp_obj_new_int_from_uint(stats.bytes_used));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_saved), mp_obj_new_int_from_uint(stats.bytes_saved));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_style_stats_obj, lvml_style_stats_mp);
+
+// Update bound subjects from a dict in one batch: {'temp': 21.5, 'status': 'ok'}
+static mp_obj_t lvml_set_many_mp(mp_obj_t values_obj) {
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    if (!mp_obj_is_type(values_obj, &mp_type_dict)) {
+        mp_raise_msg(&mp_type_TypeError, "set_many() expects a dict");
+    }
+    
+    mp_map_t *map = mp_obj_dict_get_map(values_obj);
+    mp_uint_t changed = 0;
+    
+    // Apply every value inside one batch; invalidation is resumed even if a value raises
+    lvml_bind_begin();
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        for (size_t i = 0; i < map->alloc; i++) {
+            if (!mp_map_slot_is_filled(map, i)) {
+                continue;
+            }
+            const char *name = mp_obj_str_get_str(map->table[i].key);
+            mp_obj_t value = map->table[i].value;
+            
+            // Unknown names get a subject typed after the value so later XML can bind to it
+            lvml_bind_type_t type = (mp_obj_is_int(value) || mp_obj_is_bool(value)) ? LVML_BIND_INT : LVML_BIND_STRING;
+            lv_subject_t *subject = lvml_bind_get_subject(name, type, true);
+            if (subject == NULL) {
+                mp_raise_msg(&mp_type_ValueError, "Invalid subject name or out of memory");
+            }
+            
+            bool did_change;
+            if (lvml_bind_get_type(subject) == LVML_BIND_INT) {
+                mp_int_t int_value;
+                if (mp_obj_is_float(value)) {
+                    mp_float_t f = mp_obj_get_float(value);
+                    int_value = (mp_int_t)(f < 0 ? f - 0.5 : f + 0.5);
+                } else {
+                    int_value = mp_obj_get_int(value);
+                }
+                did_change = lvml_bind_set_int(subject, (int32_t)int_value);
+            } else {
+                mp_obj_t str_obj = mp_obj_is_str(value) ? value : mp_call_function_1(MP_OBJ_FROM_PTR(&mp_type_str), value);
+                did_change = lvml_bind_set_string(subject, mp_obj_str_get_str(str_obj));
+            }
+            if (did_change) {
+                changed++;
+            }
+        }
+        nlr_pop();
+    } else {
+        // Always resume invalidation, then re-raise
+        lvml_bind_end();
+        nlr_jump(nlr.ret_val);
+    }
+    lvml_bind_end();
+    
+    return mp_obj_new_int_from_uint(changed);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_set_many_obj, lvml_set_many_mp);
+
+// Data binding statistics
+static mp_obj_t lvml_bind_stats_mp(void) {
+    lvml_bind_stats_t stats;
+    lvml_bind_get_stats(&stats);
+    
+    mp_obj_t dict = mp_obj_new_dict(5);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_subjects), mp_obj_new_int_from_uint(stats.subjects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_batches), mp_obj_new_int_from_uint(stats.batches));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_updates), mp_obj_new_int_from_uint(stats.updates));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_skipped), mp_obj_new_int_from_uint(stats.skipped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_invalidations), mp_obj_new_int_from_uint(stats.invalidations));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_bind_stats_obj, lvml_bind_stats_mp);
+
+// Build the dict returned by lvml.load_xml(..., profile=True)
+static mp_obj_t lvml_profile_to_dict(const lvml_xml_profile_t* profile) {
+    // Elements in document order; depth gives the tree shape
+    mp_obj_t elements = mp_obj_new_list(0, NULL);
+    for (uint32_t i = 0; i < profile->elem_cnt; i++) {
+        const lvml_xml_profile_elem_t* e = &profile->elems[i];
+        mp_obj_t item[6] = {
+            mp_obj_new_int_from_uint(e->depth),
+            mp_obj_new_str(e->tag, strlen(e->tag)),
+            mp_obj_new_int_from_uint(e->self_us),
+            mp_obj_new_int_from_uint(e->subtree_us),
+            mp_obj_new_int(e->subtree_bytes),
+            mp_obj_new_int_from_uint(e->subtree_objs),
+        };
+        mp_obj_list_append(elements, mp_obj_new_tuple(6, item));
+    }
+    
+    mp_obj_t dict = mp_obj_new_dict(9);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bind_us), mp_obj_new_int_from_uint(profile->bind_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_parse_us), mp_obj_new_int_from_uint(profile->parse_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_parse_bytes), mp_obj_new_int(profile->parse_bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_parse_cached), mp_obj_new_bool(profile->parse_cached));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_create_us), mp_obj_new_int_from_uint(profile->create_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_create_bytes), mp_obj_new_int(profile->create_bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_objects), mp_obj_new_int_from_uint(profile->objects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_elements), elements);
+    return dict;
+}
+
 // New function to load XML UI
-static mp_obj_t lvml_load_xml_mp(mp_obj_t xml_content_obj) {
+static mp_obj_t lvml_load_xml_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_xml, ARG_profile, ARG_base };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_xml, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_profile, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_base, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
     if (!lvgl_initialized) {
         mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
     }
     
     // Get XML content string
-    const char* xml_content = mp_obj_str_get_str(xml_content_obj);
+    const char* xml_content = mp_obj_str_get_str(args[ARG_xml].u_obj);
+    bool profiling = args[ARG_profile].u_bool;
+    const char* base_dir = args[ARG_base].u_obj != MP_OBJ_NULL ? mp_obj_str_get_str(args[ARG_base].u_obj) : "/web";
     
-    // Load XML UI
-    lvml_error_t result = lvml_ui_load_xml(xml_content);
+    // Load XML UI; the profile may be freed before it was ever started
+    lvml_xml_profile_t profile = { 0 };
+    lvml_error_t result = lvml_ui_load_xml_profile(xml_content, profiling ? &profile : NULL);
     if (result != LVML_OK) {
+        if (profiling) {
+            lvml_xml_profile_free(&profile);
+        }
         if (result == LVML_ERROR_XML_PARSE) {
             mp_raise_msg(&mp_type_ValueError, "Invalid XML content");
         } else if (result == LVML_ERROR_MEMORY) {
@@ -442,9 +1278,612 @@ static mp_obj_t lvml_load_xml_mp(mp_obj_t xml_content_obj) {
         }
     }
     
+    // Run <micropython src="..."> scripts once the UI exists; script errors
+    // are printed and don't undo the load
+    lvml_script_run_xml(xml_content, base_dir);
+    
+    if (!profiling) {
+        return mp_const_none;
+    }
+    
+    // The profile lives in the LVGL heap; free it even if building the
+    // result runs out of MicroPython heap
+    mp_obj_t dict;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        dict = lvml_profile_to_dict(&profile);
+        nlr_pop();
+    } else {
+        lvml_xml_profile_free(&profile);
+        nlr_jump(nlr.ret_val);
+    }
+    lvml_xml_profile_free(&profile);
+    
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_load_xml_obj, 1, lvml_load_xml_mp);
+
+// Run a script file through the bytecode cache
+static mp_obj_t lvml_run_script_mp(mp_obj_t path_obj) {
+    const char* path = mp_obj_str_get_str(path_obj);
+    
+    lvml_error_t result = lvml_script_run_file(path);
+    if (result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_OSError(MP_ENOENT);
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "Script failed");
+    }
+    
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_run_script_obj, lvml_run_script_mp);
+
+// Script cache statistics, one dict per script
+static mp_obj_t lvml_script_stats_mp(void) {
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    const lvml_script_stats_t* stats;
+    for (uint32_t i = 0; (stats = lvml_script_get_stats(i)) != NULL; i++) {
+        mp_obj_t dict = mp_obj_new_dict(7);
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_path), mp_obj_new_str(stats->path, strlen(stats->path)));
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_hits), mp_obj_new_int_from_uint(stats->hits));
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_misses), mp_obj_new_int_from_uint(stats->misses));
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_compile_us), mp_obj_new_int_from_uint(stats->compile_us));
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_load_us), mp_obj_new_int_from_uint(stats->load_us));
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_source_bytes), mp_obj_new_int_from_uint(stats->source_bytes));
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_mpy_bytes), mp_obj_new_int_from_uint(stats->mpy_bytes));
+        mp_obj_list_append(list, dict);
+    }
+    return list;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_script_stats_obj, lvml_script_stats_mp);
+
+// Load UI from a URL through the HTTP cache
+static mp_obj_t lvml_load_from_url_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_url, ARG_revalidate, ARG_prefetch };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_url, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_revalidate, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_prefetch, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    const char* url = mp_obj_str_get_str(args[ARG_url].u_obj);
+    int64_t start_us = lvml_time_us();
+    
+    lvml_fetch_result_t fetched;
+    lvml_error_t result = lvml_fetch_get(url, args[ARG_revalidate].u_bool, &fetched);
+    if (result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid URL (only http:// is supported)");
+    } else if (result == LVML_ERROR_MEMORY) {
+        mp_raise_msg(&mp_type_MemoryError, "Response too large");
+    } else if (result != LVML_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    
+    lvml_ui_unload_xml();
+    result = lvml_ui_load_xml((const char*)fetched.data);
+    if (result != LVML_OK) {
+        lvml_fetch_free(&fetched);
+        current_url[0] = '\0';
+        mp_raise_msg(&mp_type_ValueError, "Invalid XML content");
+    }
+    strcpy(current_url, url);
+    lvml_prefetch_record_navigation((uint32_t)(lvml_time_us() - start_us), fetched.prefetched);
+    
+    // Fetch where the user can go next while they look at this screen
+    if (args[ARG_prefetch].u_bool) {
+        lvml_prefetch_links((const char*)fetched.data, url, true);
+    }
+    lvml_fetch_free(&fetched);
+    
+    return mp_obj_new_bool(fetched.from_cache);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_load_from_url_obj, 1, lvml_load_from_url_mp);
+
+// HTTP cache statistics
+static mp_obj_t lvml_fetch_stats_mp(void) {
+    lvml_fetch_stats_t stats;
+    lvml_fetch_get_stats(&stats);
+    
+    mp_obj_t dict = mp_obj_new_dict(15);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_requests), mp_obj_new_int_from_uint(stats.requests));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_cache_hits), mp_obj_new_int_from_uint(stats.cache_hits));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_cache_misses), mp_obj_new_int_from_uint(stats.cache_misses));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_revalidations), mp_obj_new_int_from_uint(stats.revalidations));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_not_modified), mp_obj_new_int_from_uint(stats.not_modified));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_updated), mp_obj_new_int_from_uint(stats.updated));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_errors), mp_obj_new_int_from_uint(stats.errors));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_prefetch_queued), mp_obj_new_int_from_uint(stats.prefetch_queued));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_prefetch_done), mp_obj_new_int_from_uint(stats.prefetch_done));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_prefetch_hits), mp_obj_new_int_from_uint(stats.prefetch_hits));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_prefetch_dropped), mp_obj_new_int_from_uint(stats.prefetch_dropped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_prefetch_bytes), mp_obj_new_int_from_uint(stats.prefetch_bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_received), mp_obj_new_int_from_uint(stats.bytes_received));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_decoded), mp_obj_new_int_from_uint(stats.bytes_decoded));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_saved), mp_obj_new_int_from_uint(stats.bytes_saved));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_fetch_stats_obj, lvml_fetch_stats_mp);
+
+// Navigation latency and prefetch hit rate of lvml.load_from_url()
+static mp_obj_t lvml_prefetch_stats_mp(void) {
+    lvml_prefetch_stats_t stats;
+    lvml_prefetch_get_stats(&stats);
+    
+    mp_obj_t dict = mp_obj_new_dict(6);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_navigations), mp_obj_new_int_from_uint(stats.navigations));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_prefetched), mp_obj_new_int_from_uint(stats.prefetched));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_links), mp_obj_new_int_from_uint(stats.links));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_last_us), mp_obj_new_int_from_uint(stats.last_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_avg_us), mp_obj_new_int_from_uint(stats.avg_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_max_us), mp_obj_new_int_from_uint(stats.max_us));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_prefetch_stats_obj, lvml_prefetch_stats_mp);
+
+// WiFi through the network manager: wifi(ssid, password) starts associating
+// and keeps the station connected; wifi() returns 'off', 'connecting',
+// 'connected' or 'disconnected'. The driver is MicroPython's, so
+// network.WLAN(network.STA_IF).active(True) must come first.
+static mp_obj_t lvml_wifi_mp(size_t n_args, const mp_obj_t *args) {
+    if (n_args > 0 && args[0] != mp_const_none) {
+        const char* password = n_args > 1 ? mp_obj_str_get_str(args[1]) : "";
+        lvml_error_t result = lvml_net_wifi_connect(mp_obj_str_get_str(args[0]), password);
+        if (result == LVML_ERROR_INIT) {
+            mp_raise_msg(&mp_type_RuntimeError, "WiFi not initialized; activate network.WLAN(network.STA_IF) first");
+        } else if (result == LVML_ERROR_INVALID_PARAM) {
+            mp_raise_msg(&mp_type_ValueError, "Invalid SSID or password");
+        } else if (result != LVML_OK) {
+            mp_raise_OSError(MP_EIO);
+        }
+    }
+    
+    static const qstr states[] = { MP_QSTR_off, MP_QSTR_connecting, MP_QSTR_connected, MP_QSTR_disconnected };
+    return MP_OBJ_NEW_QSTR(states[lvml_net_wifi_state()]);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_wifi_obj, 0, 2, lvml_wifi_mp);
+
+// Queue a GET on the network task: net_get(url, priority=NET_NORMAL,
+// into=None, name=None) -> id. Without into the body is streamed: read it
+// with net_readinto() and collect the outcome with net_result(). into='xml'
+// loads the body as the UI, into='image' registers it as an image called
+// name (default: the URL), both from tick() once it has arrived.
+static mp_obj_t lvml_net_get_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_url, ARG_priority, ARG_into, ARG_name };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_url, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_priority, MP_ARG_INT, {.u_int = LVML_NET_PRIORITY_NORMAL} },
+        { MP_QSTR_into, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_name, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (args[ARG_priority].u_int < 0 || args[ARG_priority].u_int >= LVML_NET_PRIORITY_COUNT) {
+        mp_raise_msg(&mp_type_ValueError, "priority must be NET_HIGH, NET_NORMAL or NET_LOW");
+    }
+    lvml_net_request_t req = {
+        .url = mp_obj_str_get_str(args[ARG_url].u_obj),
+        .priority = (lvml_net_priority_t)args[ARG_priority].u_int,
+    };
+    
+    lvml_net_into_t* into = NULL;
+    if (args[ARG_into].u_obj != mp_const_none) {
+        qstr kind = mp_obj_str_get_qstr(args[ARG_into].u_obj);
+        if (kind != MP_QSTR_xml && kind != MP_QSTR_image) {
+            mp_raise_msg(&mp_type_ValueError, "into must be 'xml' or 'image'");
+        }
+        if (kind == MP_QSTR_xml && !lvgl_initialized) {
+            mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+        }
+        for (uint32_t i = 0; i < LVML_NET_INTO_MAX && into == NULL; i++) {
+            if (lvml_net_into[i].id == 0) {
+                into = &lvml_net_into[i];
+            }
+        }
+        if (into == NULL) {
+            mp_raise_msg(&mp_type_RuntimeError, "Too many requests waiting for tick()");
+        }
+        
+        const char* name = args[ARG_name].u_obj != mp_const_none ? mp_obj_str_get_str(args[ARG_name].u_obj) : req.url;
+        if (strlen(name) >= LVML_NET_NAME_MAX) {
+            mp_raise_msg(&mp_type_ValueError, "Image name too long");
+        }
+        memset(into, 0, sizeof(lvml_net_into_t));
+        into->image = kind == MP_QSTR_image;
+        strcpy(into->name, name);
+        req.on_body = lvml_net_into_append;
+        req.user_data = into;
+    }
+    
+    uint32_t id = lvml_net_get(&req);
+    if (id == 0) {
+        mp_raise_msg(&mp_type_RuntimeError, "Request not queued (invalid URL or queue full)");
+    }
+    if (into != NULL) {
+        into->id = id;
+    }
+    return mp_obj_new_int_from_uint(id);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_net_get_obj, 1, lvml_net_get_mp);
+
+// Read streamed body bytes into buf: returns the count, None if nothing
+// has arrived yet and 0 once the body has ended. ValueError for into=
+// requests and ids that don't exist (or were released by net_result())
+static mp_obj_t lvml_net_readinto_mp(mp_obj_t id_in, mp_obj_t buf_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    
+    int n = lvml_net_read(mp_obj_get_int(id_in), (uint8_t*)bufinfo.buf, bufinfo.len);
+    if (n == -2) {
+        mp_raise_msg(&mp_type_ValueError, "Unknown request or not streamed");
+    }
+    if (n == 0 && bufinfo.len > 0) {
+        return mp_const_none;
+    }
+    return MP_OBJ_NEW_SMALL_INT(n < 0 ? 0 : n);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(lvml_net_readinto_obj, lvml_net_readinto_mp);
+
+static mp_obj_t lvml_net_timing_to_dict(mp_obj_t dict, const lvml_net_timing_t* t) {
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_queued_us), mp_obj_new_int_from_uint(t->queued_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dns_us), mp_obj_new_int_from_uint(t->dns_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_connect_us), mp_obj_new_int_from_uint(t->connect_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_first_byte_us), mp_obj_new_int_from_uint(t->first_byte_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_transfer_us), mp_obj_new_int_from_uint(t->transfer_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_total_us), mp_obj_new_int_from_uint(t->total_us));
+    return dict;
+}
+
+// Outcome of a streamed request, once: None while it runs, then
+// {'ok', 'status', 'bytes', 'reused', 'queued_us', 'dns_us', 'connect_us',
+// 'first_byte_us', 'transfer_us', 'total_us'}; the id is released
+static mp_obj_t lvml_net_result_mp(mp_obj_t id_in) {
+    uint32_t id = mp_obj_get_int(id_in);
+    for (uint32_t i = 0; i < LVML_NET_INTO_MAX; i++) {
+        if (lvml_net_into[i].id == id) {
+            // Finished by tick(), which needs the result
+            return mp_const_none;
+        }
+    }
+    
+    lvml_net_result_t r;
+    if (!lvml_net_finish(id, &r)) {
+        return mp_const_none;
+    }
+    if (r.result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_msg(&mp_type_ValueError, "Unknown request");
+    }
+    
+    mp_obj_t dict = mp_obj_new_dict(10);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_ok), mp_obj_new_bool(r.result == LVML_OK));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_status), MP_OBJ_NEW_SMALL_INT(r.status));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes), mp_obj_new_int_from_uint(r.bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_reused), mp_obj_new_bool(r.reused));
+    return lvml_net_timing_to_dict(dict, &r.timing);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_net_result_obj, lvml_net_result_mp);
+
+static mp_obj_t lvml_net_cancel_mp(mp_obj_t id_in) {
+    uint32_t id = mp_obj_get_int(id_in);
+    
+    // The network task may be writing the body of an into= request, so
+    // that one stops at its next piece and is released by tick()
+    for (uint32_t i = 0; i < LVML_NET_INTO_MAX; i++) {
+        if (lvml_net_into[i].id == id) {
+            lvml_net_into[i].cancelled = true;
+        }
+    }
+    lvml_net_cancel(id);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_net_cancel_obj, lvml_net_cancel_mp);
+
+// Network manager statistics; 'last' is the timing of the last finished request
+static mp_obj_t lvml_net_stats_mp(void) {
+    lvml_net_stats_t stats;
+    lvml_net_get_stats(&stats);
+    
+    mp_obj_t dict = mp_obj_new_dict(11);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_requests), mp_obj_new_int_from_uint(stats.requests));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_completed), mp_obj_new_int_from_uint(stats.completed));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_failed), mp_obj_new_int_from_uint(stats.failed));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_cancelled), mp_obj_new_int_from_uint(stats.cancelled));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_connections), mp_obj_new_int_from_uint(stats.connections));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_reused), mp_obj_new_int_from_uint(stats.reused));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes), mp_obj_new_int_from_uint(stats.bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_queue_max), mp_obj_new_int_from_uint(stats.queue_max));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_wifi_connects), mp_obj_new_int_from_uint(stats.wifi_connects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_wifi_disconnects), mp_obj_new_int_from_uint(stats.wifi_disconnects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_last), lvml_net_timing_to_dict(mp_obj_new_dict(6), &stats.last));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_net_stats_obj, lvml_net_stats_mp);
+
+// Connect the push channel: push_connect(host, port=8765). The channel
+// task reconnects by itself; updates are applied from tick().
+static mp_obj_t lvml_push_connect_mp(size_t n_args, const mp_obj_t *args) {
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    mp_int_t port = n_args > 1 ? mp_obj_get_int(args[1]) : LVML_PUSH_PORT;
+    if (port <= 0 || port > 65535) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid port");
+    }
+    lvml_error_t result = lvml_push_connect(mp_obj_str_get_str(args[0]), (uint16_t)port);
+    if (result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid host");
+    } else if (result == LVML_ERROR_MEMORY) {
+        mp_raise_OSError(MP_ENOMEM);
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "Failed to start the push channel");
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_push_connect_obj, 1, 2, lvml_push_connect_mp);
+
+static mp_obj_t lvml_push_close_mp(void) {
+    lvml_push_close();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_push_close_obj, lvml_push_close_mp);
+
+// Push channel and applied command statistics: push_stats(reset=False)
+static mp_obj_t lvml_push_stats_mp(size_t n_args, const mp_obj_t *args) {
+    bool reset = n_args > 0 && mp_obj_is_true(args[0]);
+    lvml_push_stats_t stats;
+    lvml_live_stats_t live;
+    lvml_push_get_stats(&stats, reset);
+    lvml_live_get_stats(&live, reset);
+    
+    mp_obj_t dict = mp_obj_new_dict(23);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_connected), mp_obj_new_bool(stats.connected));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_connects), mp_obj_new_int_from_uint(stats.connects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_disconnects), mp_obj_new_int_from_uint(stats.disconnects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_updates), mp_obj_new_int_from_uint(stats.updates));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_errors), mp_obj_new_int_from_uint(stats.errors));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes), mp_obj_new_int_from_uint(stats.bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_acks), mp_obj_new_int_from_uint(stats.acks));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_full_waits), mp_obj_new_int_from_uint(stats.full_waits));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_queue_max), mp_obj_new_int_from_uint(stats.queue_max));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_batches), mp_obj_new_int_from_uint(stats.batches));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_batch_max_us), mp_obj_new_int_from_uint(stats.batch_max_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_apply_us), mp_obj_new_int_from_uint(stats.apply_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_last_latency_us), mp_obj_new_int_from_uint(stats.last_latency_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_avg_latency_us), mp_obj_new_int_from_uint(stats.avg_latency_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_max_latency_us), mp_obj_new_int_from_uint(stats.max_latency_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_cmds), mp_obj_new_int_from_uint(live.cmds));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_sets), mp_obj_new_int_from_uint(live.sets));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_inserts), mp_obj_new_int_from_uint(live.inserts));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_removes), mp_obj_new_int_from_uint(live.removes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_binds), mp_obj_new_int_from_uint(live.binds));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_unchanged), mp_obj_new_int_from_uint(live.unchanged));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_failed), mp_obj_new_int_from_uint(live.failed));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_lookups), mp_obj_new_int_from_uint(live.lookups));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_push_stats_obj, 0, 1, lvml_push_stats_mp);
+
+// Mirror the screen: mirror_start(host, port=8766, *, fps=10, fmt='splash')
+// Changed areas are sent as RLE splash ('splash') or QOI ('qoi') images
+static mp_obj_t lvml_mirror_start_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_host, ARG_port, ARG_fps, ARG_fmt };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_host, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_port, MP_ARG_INT, {.u_int = LVML_MIRROR_PORT} },
+        { MP_QSTR_fps, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = LVML_MIRROR_FPS} },
+        { MP_QSTR_fmt, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_splash)} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    qstr fmt = mp_obj_str_get_qstr(args[ARG_fmt].u_obj);
+    lvml_mirror_codec_t codec;
+    if (fmt == MP_QSTR_splash) {
+        codec = LVML_MIRROR_RLE;
+    } else if (fmt == MP_QSTR_qoi) {
+        codec = LVML_MIRROR_QOI;
+    } else {
+        mp_raise_msg(&mp_type_ValueError, "fmt must be 'splash' or 'qoi'");
+    }
+    mp_int_t port = args[ARG_port].u_int;
+    mp_int_t fps = args[ARG_fps].u_int;
+    if (port <= 0 || port > 65535) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid port");
+    }
+    if (fps <= 0 || fps > LVML_MIRROR_FPS_MAX) {
+        mp_raise_msg(&mp_type_ValueError, "fps must be 1..60");
+    }
+    
+    lvml_error_t result = lvml_mirror_start(mp_obj_str_get_str(args[ARG_host].u_obj), (uint16_t)port,
+                                            codec, (uint32_t)fps);
+    if (result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid host");
+    } else if (result == LVML_ERROR_MEMORY) {
+        mp_raise_OSError(MP_ENOMEM);
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "Failed to start mirroring");
+    }
+    
+    // Redraw everything once so the shadow frame holds the whole screen
+    lv_obj_invalidate(lv_screen_active());
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_mirror_start_obj, 1, lvml_mirror_start_mp);
+
+static mp_obj_t lvml_mirror_stop_mp(void) {
+    lvml_mirror_stop();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_mirror_stop_obj, lvml_mirror_stop_mp);
+
+// Mirroring statistics: mirror_stats(reset=False)
+static mp_obj_t lvml_mirror_stats_mp(size_t n_args, const mp_obj_t *args) {
+    bool reset = n_args > 0 && mp_obj_is_true(args[0]);
+    lvml_mirror_stats_t stats;
+    lvml_mirror_get_stats(&stats, reset);
+    
+    mp_obj_t dict = mp_obj_new_dict(13);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_connected), mp_obj_new_bool(stats.connected));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_connects), mp_obj_new_int_from_uint(stats.connects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_disconnects), mp_obj_new_int_from_uint(stats.disconnects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_flushes), mp_obj_new_int_from_uint(stats.flushes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_flush_max_us), mp_obj_new_int_from_uint(stats.flush_max_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_display_frames), mp_obj_new_int_from_uint(stats.display_frames));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_frames), mp_obj_new_int_from_uint(stats.frames));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_merged), mp_obj_new_int_from_uint(stats.merged));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_rects), mp_obj_new_int_from_uint(stats.rects));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_overflows), mp_obj_new_int_from_uint(stats.overflows));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_pixels), mp_obj_new_int_from_uint(stats.pixels));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes), mp_obj_new_int_from_uint(stats.bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_encode_us), mp_obj_new_int_from_uint(stats.encode_us));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_mirror_stats_obj, 0, 1, lvml_mirror_stats_mp);
+
+// Register a bundle's images, then show its screen and run its scripts;
+// what was read from the bundle is freed even if Python raises
+static lvml_error_t lvml_bundle_show(const lvml_bundle_t* bundle, const char* screen) {
+    lvml_bundle_entry_t entry;
+    lvml_bundle_entry_t xml_entry;
+    bool have_xml = screen != NULL && lvml_bundle_find(bundle, screen, &xml_entry);
+    
+    for (uint32_t i = 0; lvml_bundle_entry(bundle, i, &entry); i++) {
+        if (screen == NULL && !have_xml && lvml_bundle_name_ends_with(&entry, ".xml")) {
+            xml_entry = entry;
+            have_xml = true;
+        }
+        if (!lvml_bundle_name_ends_with(&entry, ".png")) {
+            continue;
+        }
+        
+        char name[LVML_FETCH_REF_MAX];
+        uint8_t* data;
+        if (entry.name_len >= sizeof(name) || lvml_bundle_read(bundle, &entry, &data) != LVML_OK) {
+            return LVML_ERROR_INVALID_PARAM;
+        }
+        memcpy(name, entry.name, entry.name_len);
+        name[entry.name_len] = '\0';
+        lvml_error_t result;
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            result = lvml_ui_register_image(name, data, entry.size);
+            nlr_pop();
+        } else {
+            lvml_mem_free_large(data);
+            nlr_jump(nlr.ret_val);
+        }
+        lvml_mem_free_large(data);
+        if (result != LVML_OK) {
+            return result;
+        }
+    }
+    if (!have_xml) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    
+    uint8_t* xml;
+    lvml_error_t result = lvml_bundle_read(bundle, &xml_entry, &xml);
+    if (result != LVML_OK) {
+        return result;
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        lvml_ui_unload_xml();
+        result = lvml_ui_load_xml((const char*)xml);
+        if (result == LVML_OK) {
+            // Script errors are printed and don't undo the load
+            lvml_script_run_xml_bundle((const char*)xml, bundle);
+        }
+        nlr_pop();
+    } else {
+        lvml_mem_free_large(xml);
+        nlr_jump(nlr.ret_val);
+    }
+    lvml_mem_free_large(xml);
+    return result;
+}
+
+// Load UI from a bundle file or URL (one open or one request)
+static mp_obj_t lvml_load_bundle_mp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_source, ARG_screen, ARG_revalidate };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_screen, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_revalidate, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    
+    if (!lvgl_initialized) {
+        mp_raise_msg(&mp_type_RuntimeError, "LVML not initialized. Call lvml.init() first.");
+    }
+    
+    const char* source = mp_obj_str_get_str(args[ARG_source].u_obj);
+    const char* screen = args[ARG_screen].u_obj != mp_const_none ? mp_obj_str_get_str(args[ARG_screen].u_obj) : NULL;
+    
+    // URLs go through the HTTP cache, paths are read from the VFS
+    lvml_fetch_result_t fetched = { 0 };
+    mp_obj_t file = MP_OBJ_NULL;
+    const uint8_t* data;
+    size_t len;
+    if (strncmp(source, "http://", 7) == 0) {
+        lvml_error_t result = lvml_fetch_get(source, args[ARG_revalidate].u_bool, &fetched);
+        if (result == LVML_ERROR_MEMORY) {
+            mp_raise_msg(&mp_type_MemoryError, "Bundle too large");
+        } else if (result != LVML_OK) {
+            mp_raise_OSError(MP_EIO);
+        }
+        data = fetched.data;
+        len = fetched.len;
+    } else {
+        file = lvml_vfs_read(source);
+        if (file == MP_OBJ_NULL) {
+            mp_raise_OSError(MP_ENOENT);
+        }
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(file, &bufinfo, MP_BUFFER_READ);
+        data = (const uint8_t*)bufinfo.buf;
+        len = bufinfo.len;
+    }
+    
+    lvml_bundle_t bundle;
+    lvml_error_t result = lvml_bundle_open(&bundle, data, len);
+    if (result == LVML_OK) {
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            result = lvml_bundle_show(&bundle, screen);
+            nlr_pop();
+        } else {
+            lvml_fetch_free(&fetched);
+            nlr_jump(nlr.ret_val);
+        }
+    }
+    lvml_fetch_free(&fetched);
+    
+    // A bundle is not a document lvml_fetch_event_cb() could reload
+    current_url[0] = '\0';
+    if (result == LVML_ERROR_MEMORY) {
+        mp_raise_msg(&mp_type_MemoryError, "Out of memory loading bundle");
+    } else if (result == LVML_ERROR_XML_PARSE) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid XML content");
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid bundle");
+    }
+    
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_1(lvml_load_xml_obj, lvml_load_xml_mp);
+static MP_DEFINE_CONST_FUN_OBJ_KW(lvml_load_bundle_obj, 1, lvml_load_bundle_mp);
 
 // Touch functions
 static mp_obj_t lvml_touch_enabled(void) {
@@ -452,9 +1891,321 @@ static mp_obj_t lvml_touch_enabled(void) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_0(lvml_touch_enabled_obj, lvml_touch_enabled);
 
+// Touch sampling statistics: touch_stats(reset=False)
+static mp_obj_t lvml_touch_stats_mp(size_t n_args, const mp_obj_t *args) {
+    esp32_s3_box3_touch_stats_t stats;
+    esp32_s3_box3_touch_get_stats(&stats, n_args > 0 && mp_obj_is_true(args[0]));
+    
+    mp_obj_t dict = mp_obj_new_dict(17);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_irqs), mp_obj_new_int_from_uint(stats.irqs));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_frames), mp_obj_new_int_from_uint(stats.frames));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_samples), mp_obj_new_int_from_uint(stats.samples));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dropped), mp_obj_new_int_from_uint(stats.dropped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_delivered), mp_obj_new_int_from_uint(stats.delivered));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_gestures), mp_obj_new_int_from_uint(stats.gestures));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_gestures_dropped), mp_obj_new_int_from_uint(stats.gestures_dropped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_reads), mp_obj_new_int_from_uint(stats.reads));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_i2c_last_us), mp_obj_new_int_from_uint(stats.i2c_last_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_i2c_avg_us), mp_obj_new_int_from_uint(stats.i2c_avg_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_i2c_max_us), mp_obj_new_int_from_uint(stats.i2c_max_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bus_transfers), mp_obj_new_int_from_uint(stats.bus_transfers));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_xform_max_cycles), mp_obj_new_int_from_uint(stats.xform_max_cycles));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_read_max_us), mp_obj_new_int_from_uint(stats.read_max_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_last_latency_us), mp_obj_new_int_from_uint(stats.last_latency_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_avg_latency_us), mp_obj_new_int_from_uint(stats.avg_latency_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_max_latency_us), mp_obj_new_int_from_uint(stats.max_latency_us));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_touch_stats_obj, 0, 1, lvml_touch_stats_mp);
+
+// Last touch point: touch_point(raw=False) -> (x, y, pressed)
+static mp_obj_t lvml_touch_point_mp(size_t n_args, const mp_obj_t *args) {
+    int32_t x, y, raw_x, raw_y;
+    bool pressed = esp32_s3_box3_touch_get_point(&x, &y, &raw_x, &raw_y);
+    bool raw = n_args > 0 && mp_obj_is_true(args[0]);
+    
+    mp_obj_t items[3] = {
+        mp_obj_new_int(raw ? raw_x : x),
+        mp_obj_new_int(raw ? raw_y : y),
+        mp_obj_new_bool(pressed),
+    };
+    return mp_obj_new_tuple(3, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_touch_point_obj, 0, 1, lvml_touch_point_mp);
+
+// Read three (x, y) pairs into a flat array
+static void lvml_touch_get_points(mp_obj_t points_in, int32_t out[6]) {
+    mp_obj_t* points;
+    mp_obj_get_array_fixed_n(points_in, 3, &points);
+    for (int i = 0; i < 3; i++) {
+        mp_obj_t* xy;
+        mp_obj_get_array_fixed_n(points[i], 2, &xy);
+        out[2 * i] = mp_obj_get_int(xy[0]);
+        out[2 * i + 1] = mp_obj_get_int(xy[1]);
+    }
+}
+
+// Touch calibration: touch_calibrate(screen, raw) with three (x, y) points each,
+// touch_calibrate() to go back to plain scaling
+static mp_obj_t lvml_touch_calibrate_mp(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        esp32_s3_box3_touch_set_calibration(NULL, NULL);
+        return mp_const_none;
+    }
+    if (n_args != 2) {
+        mp_raise_msg(&mp_type_TypeError, "touch_calibrate() takes screen and raw points, or nothing");
+    }
+    
+    int32_t screen[6];
+    int32_t raw[6];
+    lvml_touch_get_points(args[0], screen);
+    lvml_touch_get_points(args[1], raw);
+    if (esp32_s3_box3_touch_set_calibration(raw, screen) != ESP_OK) {
+        mp_raise_msg(&mp_type_ValueError, "Calibration points must not be on one line");
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_touch_calibrate_obj, 0, 2, lvml_touch_calibrate_mp);
+
+// Latest gesture of a type: gesture("pinch") -> dict, or None if there was none yet
+static mp_obj_t lvml_gesture_mp(mp_obj_t name_in) {
+    const char* name = mp_obj_str_get_str(name_in);
+    uint8_t type = 0;
+    while (type < LVML_GESTURE_TYPE_COUNT && strcmp(lvml_gesture_name(type), name) != 0) {
+        type++;
+    }
+    if (type == LVML_GESTURE_TYPE_COUNT) {
+        mp_raise_msg(&mp_type_ValueError, "Unknown gesture");
+    }
+    const lvml_gesture_event_t* g = lvml_input_last_gesture(type);
+    if (g == NULL) {
+        return mp_const_none;
+    }
+    
+    mp_obj_t dict = mp_obj_new_dict(12);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_type), name_in);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_fingers), MP_OBJ_NEW_SMALL_INT(g->fingers));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dir), MP_OBJ_NEW_SMALL_INT(g->dir));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_time_ms), mp_obj_new_int_from_uint(g->time_ms));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_x), mp_obj_new_int(g->x));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_y), mp_obj_new_int(g->y));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dx), mp_obj_new_int(g->dx));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dy), mp_obj_new_int(g->dy));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_vx), mp_obj_new_int(g->vx));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_vy), mp_obj_new_int(g->vy));
+    // Scale and angle stay integers: 65536 = 1.0, centidegrees
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_scale), mp_obj_new_int(g->scale));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_angle), mp_obj_new_int(g->angle));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_gesture_obj, lvml_gesture_mp);
+
+// Start recording touch input: input_record()
+static mp_obj_t lvml_input_record_mp(void) {
+    lvml_error_t result = lvml_replay_record_start();
+    if (result == LVML_ERROR_MEMORY) {
+        mp_raise_msg(&mp_type_MemoryError, "Out of memory for the input recording");
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "No touch input to record, or a replay is running");
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_input_record_obj, lvml_input_record_mp);
+
+// Stop recording and write the recording: input_save(path) -> number of records
+static mp_obj_t lvml_input_save_mp(mp_obj_t path_in) {
+    const char* path = mp_obj_str_get_str(path_in);
+    size_t len;
+    const uint8_t* data = lvml_replay_record_stop(&len);
+    if (data == NULL) {
+        mp_raise_msg(&mp_type_RuntimeError, "Nothing recorded");
+    }
+    if (!lvml_vfs_write(path, data, len)) {
+        mp_raise_OSError(MP_EIO);
+    }
+    lvml_replay_status_t status;
+    lvml_replay_get_status(&status);
+    return mp_obj_new_int_from_uint(status.records);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_input_save_obj, lvml_input_save_mp);
+
+// Replay a recording in place of the touch input: input_replay(src, speed=1.0)
+// src is a path or the recording bytes; speed 0 plays one record per input read
+static mp_obj_t lvml_input_replay_mp(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t file = args[0];
+    if (mp_obj_is_str(args[0])) {
+        file = lvml_vfs_read(mp_obj_str_get_str(args[0]));
+        if (file == MP_OBJ_NULL) {
+            mp_raise_OSError(MP_ENOENT);
+        }
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(file, &bufinfo, MP_BUFFER_READ);
+
+    mp_float_t speed = n_args > 1 ? mp_obj_get_float(args[1]) : (mp_float_t)1.0;
+    if (speed < 0 || speed > 100) {
+        mp_raise_msg(&mp_type_ValueError, "speed must be 0 (step) to 100");
+    }
+    uint16_t speed_pct = (uint16_t)(speed * 100 + (mp_float_t)0.5);
+    if (speed > 0 && speed_pct == 0) {
+        speed_pct = 1;
+    }
+
+    lvml_error_t result = lvml_replay_start((const uint8_t*)bufinfo.buf, bufinfo.len, speed_pct);
+    if (result == LVML_ERROR_INVALID_PARAM) {
+        mp_raise_msg(&mp_type_ValueError, "Not an input recording");
+    } else if (result == LVML_ERROR_MEMORY) {
+        mp_raise_msg(&mp_type_MemoryError, "Out of memory for the replay");
+    } else if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_RuntimeError, "Can't replay while recording");
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_input_replay_obj, 1, 2, lvml_input_replay_mp);
+
+// Stop a replay early: input_replay_stop()
+static mp_obj_t lvml_input_replay_stop_mp(void) {
+    lvml_replay_stop();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_input_replay_stop_obj, lvml_input_replay_stop_mp);
+
+// Recorder and replay state: input_status()
+static mp_obj_t lvml_input_status_mp(void) {
+    lvml_replay_status_t status;
+    lvml_replay_get_status(&status);
+
+    mp_obj_t dict = mp_obj_new_dict(9);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_recording), mp_obj_new_bool(status.recording));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_playing), mp_obj_new_bool(status.playing));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_records), mp_obj_new_int_from_uint(status.records));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes), mp_obj_new_int_from_uint(status.bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_duration_ms), mp_obj_new_int_from_uint(status.duration_ms));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_played), mp_obj_new_int_from_uint(status.played));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_elapsed_ms), mp_obj_new_int_from_uint(status.elapsed_ms));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_gestures), mp_obj_new_int_from_uint(status.gestures));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_error), mp_obj_new_bool(status.error));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_input_status_obj, lvml_input_status_mp);
+
+// Runtime log level: log_level("touch") -> "info", log_level("touch", "warn"),
+// log_level("all", "error") sets every module
+static mp_obj_t lvml_log_level_mp(size_t n_args, const mp_obj_t *args) {
+    const char* module_name = mp_obj_str_get_str(args[0]);
+    bool all = strcmp(module_name, "all") == 0;
+    int module = all ? 0 : lvml_log_find_module(module_name);
+    if (module < 0) {
+        mp_raise_msg(&mp_type_ValueError, "Unknown log module");
+    }
+    if (n_args == 1) {
+        const char* name = lvml_log_level_name(lvml_log_get_level(module));
+        return mp_obj_new_str(name, strlen(name));
+    }
+    
+    int level = lvml_log_find_level(mp_obj_str_get_str(args[1]));
+    if (level < 0) {
+        mp_raise_msg(&mp_type_ValueError, "Log level must be trace, debug, info, warn, error or none");
+    }
+    if (level < LVML_LOG_LEVEL_MIN) {
+        mp_raise_msg(&mp_type_ValueError, "Log level is compiled out");
+    }
+    if (all) {
+        for (int i = 0; i < LVML_LOG_MOD_COUNT; i++) {
+            lvml_log_set_level(i, level);
+        }
+    } else {
+        lvml_log_set_level(module, level);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_log_level_obj, 1, 2, lvml_log_level_mp);
+
+// Print buffered log records now: log_flush() -> number printed
+static mp_obj_t lvml_log_flush_mp(void) {
+    return mp_obj_new_int_from_uint(lvml_log_drain(lvml_log_print, NULL, 0));
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_log_flush_obj, lvml_log_flush_mp);
+
+// Log ring statistics: log_stats(reset=False)
+static mp_obj_t lvml_log_stats_mp(size_t n_args, const mp_obj_t *args) {
+    lvml_log_stats_t stats;
+    lvml_log_get_stats(&stats, n_args > 0 && mp_obj_is_true(args[0]));
+    
+    mp_obj_t dict = mp_obj_new_dict(4);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_written), mp_obj_new_int_from_uint(stats.written));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dropped), mp_obj_new_int_from_uint(stats.dropped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_drained), mp_obj_new_int_from_uint(stats.drained));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_pending), mp_obj_new_int_from_uint(stats.pending));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lvml_log_stats_obj, 0, 1, lvml_log_stats_mp);
+
+// Mark the end of a boot stage: mark("wifi")
+static mp_obj_t lvml_mark_mp(mp_obj_t name_in) {
+    lvml_boot_mark(mp_obj_str_get_str(name_in));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(lvml_mark_obj, lvml_mark_mp);
+
+// Boot timeline: boot_report() -> {"stages": [(name, time_us, delta_us), ...],
+// "first_pixel_us", "first_frame_us", "first_touch_us" (None until they
+// happen), "splash_saving_us" (how much sooner an early splash showed than
+// LVGL's first frame, None without one), "dropped"}
+static mp_obj_t lvml_boot_report_mp(void) {
+    size_t count;
+    const lvml_boot_mark_t* marks = lvml_boot_get_marks(&count);
+    mp_obj_t stages = mp_obj_new_list(0, NULL);
+    int64_t prev_us = 0;
+    for (size_t i = 0; i < count; i++) {
+        mp_obj_t item[3] = {
+            mp_obj_new_str(marks[i].name, strlen(marks[i].name)),
+            mp_obj_new_int_from_ll(marks[i].time_us),
+            mp_obj_new_int_from_ll(marks[i].time_us - prev_us),
+        };
+        mp_obj_list_append(stages, mp_obj_new_tuple(3, item));
+        prev_us = marks[i].time_us;
+    }
+    
+    // With an early splash the first pixel is the splash, not LVGL's black screen
+    int64_t splash = lvml_boot_find("splash");
+    int64_t first_pixel = splash >= 0 ? splash : lvml_boot_find("first_pixel");
+    int64_t first_frame = lvml_boot_find("first_frame");
+    int64_t first_touch = lvml_boot_find("first_touch");
+    mp_obj_t dict = mp_obj_new_dict(6);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_stages), stages);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_first_pixel_us),
+                      first_pixel >= 0 ? mp_obj_new_int_from_ll(first_pixel) : mp_const_none);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_first_frame_us),
+                      first_frame >= 0 ? mp_obj_new_int_from_ll(first_frame) : mp_const_none);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_splash_saving_us),
+                      splash >= 0 && first_frame >= 0 ? mp_obj_new_int_from_ll(first_frame - splash)
+                                                      : mp_const_none);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_first_touch_us),
+                      first_touch >= 0 ? mp_obj_new_int_from_ll(first_touch) : mp_const_none);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dropped), mp_obj_new_int_from_uint(lvml_boot_dropped()));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_boot_report_obj, lvml_boot_report_mp);
+
+#if MICROPY_MODULE_BUILTIN_INIT
+// Called on the first import after boot and after every soft reset
+static mp_obj_t lvml_module_init(void) {
+    // A soft reset keeps the screen but drops the event callbacks' objects
+    lvml_events_reset();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(lvml_module_init_obj, lvml_module_init);
+#endif
+
 static const mp_rom_map_elem_t lvml_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_lvml) },
+#if MICROPY_MODULE_BUILTIN_INIT
+    { MP_ROM_QSTR(MP_QSTR___init__), MP_ROM_PTR(&lvml_module_init_obj) },
+#endif
+    { MP_ROM_QSTR(MP_QSTR_splash), MP_ROM_PTR(&lvml_splash_obj) },
     { MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&lvml_init_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait_ready), MP_ROM_PTR(&lvml_wait_ready_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&lvml_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_bg), MP_ROM_PTR(&lvml_set_bg_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_rotation), MP_ROM_PTR(&lvml_set_rotation_obj) },
@@ -465,9 +2216,61 @@ static const mp_rom_map_elem_t lvml_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_button), MP_ROM_PTR(&lvml_button_obj) },
     { MP_ROM_QSTR(MP_QSTR_textarea), MP_ROM_PTR(&lvml_textarea_obj) },
     { MP_ROM_QSTR(MP_QSTR_show_image), MP_ROM_PTR(&lvml_show_image_obj) },
+    { MP_ROM_QSTR(MP_QSTR_batch), MP_ROM_PTR(&lvml_batch_obj) },
+    { MP_ROM_QSTR(MP_QSTR_canvas), MP_ROM_PTR(&lvml_canvas_obj) },
+    { MP_ROM_QSTR(MP_QSTR_screenshot), MP_ROM_PTR(&lvml_screenshot_obj) },
+    { MP_ROM_QSTR(MP_QSTR_snapshot_state), MP_ROM_PTR(&lvml_snapshot_state_obj) },
+    { MP_ROM_QSTR(MP_QSTR_restore_state), MP_ROM_PTR(&lvml_restore_state_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Canvas), MP_ROM_PTR(&lvml_canvas_type) },
+    { MP_ROM_QSTR(MP_QSTR_RECT), MP_ROM_INT(LVML_UI_CMD_RECT) },
+    { MP_ROM_QSTR(MP_QSTR_BUTTON), MP_ROM_INT(LVML_UI_CMD_BUTTON) },
+    { MP_ROM_QSTR(MP_QSTR_TEXTAREA), MP_ROM_INT(LVML_UI_CMD_TEXTAREA) },
     { MP_ROM_QSTR(MP_QSTR_debug), MP_ROM_PTR(&lvml_debug_obj) },
+    { MP_ROM_QSTR(MP_QSTR_find), MP_ROM_PTR(&lvml_find_obj) },
+    { MP_ROM_QSTR(MP_QSTR_handle_stats), MP_ROM_PTR(&lvml_handle_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_stats), MP_ROM_PTR(&lvml_refresh_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_event_stats), MP_ROM_PTR(&lvml_event_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Widget), MP_ROM_PTR(&lvml_handle_type) },
+    { MP_ROM_QSTR(MP_QSTR_style_stats), MP_ROM_PTR(&lvml_style_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_many), MP_ROM_PTR(&lvml_set_many_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bind_stats), MP_ROM_PTR(&lvml_bind_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_load_xml), MP_ROM_PTR(&lvml_load_xml_obj) },
+    { MP_ROM_QSTR(MP_QSTR_run_script), MP_ROM_PTR(&lvml_run_script_obj) },
+    { MP_ROM_QSTR(MP_QSTR_script_stats), MP_ROM_PTR(&lvml_script_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_load_from_url), MP_ROM_PTR(&lvml_load_from_url_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fetch_stats), MP_ROM_PTR(&lvml_fetch_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_prefetch_stats), MP_ROM_PTR(&lvml_prefetch_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wifi), MP_ROM_PTR(&lvml_wifi_obj) },
+    { MP_ROM_QSTR(MP_QSTR_net_get), MP_ROM_PTR(&lvml_net_get_obj) },
+    { MP_ROM_QSTR(MP_QSTR_net_readinto), MP_ROM_PTR(&lvml_net_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_net_result), MP_ROM_PTR(&lvml_net_result_obj) },
+    { MP_ROM_QSTR(MP_QSTR_net_cancel), MP_ROM_PTR(&lvml_net_cancel_obj) },
+    { MP_ROM_QSTR(MP_QSTR_net_stats), MP_ROM_PTR(&lvml_net_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_NET_HIGH), MP_ROM_INT(LVML_NET_PRIORITY_HIGH) },
+    { MP_ROM_QSTR(MP_QSTR_NET_NORMAL), MP_ROM_INT(LVML_NET_PRIORITY_NORMAL) },
+    { MP_ROM_QSTR(MP_QSTR_NET_LOW), MP_ROM_INT(LVML_NET_PRIORITY_LOW) },
+    { MP_ROM_QSTR(MP_QSTR_push_connect), MP_ROM_PTR(&lvml_push_connect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_push_close), MP_ROM_PTR(&lvml_push_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR_push_stats), MP_ROM_PTR(&lvml_push_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mirror_start), MP_ROM_PTR(&lvml_mirror_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mirror_stop), MP_ROM_PTR(&lvml_mirror_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mirror_stats), MP_ROM_PTR(&lvml_mirror_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_load_bundle), MP_ROM_PTR(&lvml_load_bundle_obj) },
     { MP_ROM_QSTR(MP_QSTR_touch_enabled), MP_ROM_PTR(&lvml_touch_enabled_obj) },
+    { MP_ROM_QSTR(MP_QSTR_touch_stats), MP_ROM_PTR(&lvml_touch_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_touch_point), MP_ROM_PTR(&lvml_touch_point_obj) },
+    { MP_ROM_QSTR(MP_QSTR_touch_calibrate), MP_ROM_PTR(&lvml_touch_calibrate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gesture), MP_ROM_PTR(&lvml_gesture_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_record), MP_ROM_PTR(&lvml_input_record_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_save), MP_ROM_PTR(&lvml_input_save_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_replay), MP_ROM_PTR(&lvml_input_replay_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_replay_stop), MP_ROM_PTR(&lvml_input_replay_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_status), MP_ROM_PTR(&lvml_input_status_obj) },
+    { MP_ROM_QSTR(MP_QSTR_log_level), MP_ROM_PTR(&lvml_log_level_obj) },
+    { MP_ROM_QSTR(MP_QSTR_log_flush), MP_ROM_PTR(&lvml_log_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_log_stats), MP_ROM_PTR(&lvml_log_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mark), MP_ROM_PTR(&lvml_mark_obj) },
+    { MP_ROM_QSTR(MP_QSTR_boot_report), MP_ROM_PTR(&lvml_boot_report_obj) },
 };
 static MP_DEFINE_CONST_DICT(lvml_module_globals, lvml_module_globals_table);
 
@@ -27,6 +27,38 @@ target_sources(usermod_lvml INTERFACE
     ${DRIVER_SOURCES}
 )
 
+# Add XML helper source files
+file(GLOB XML_SOURCES 
+    "${CMAKE_CURRENT_LIST_DIR}/xml/*.c"
+)
+target_sources(usermod_lvml INTERFACE
+    ${XML_SOURCES}
+)
+
+# Add network source files
+file(GLOB NETWORK_SOURCES 
+    "${CMAKE_CURRENT_LIST_DIR}/network/*.c"
+)
+target_sources(usermod_lvml INTERFACE
+    ${NETWORK_SOURCES}
+)
+
+# Add utility source files
+file(GLOB UTILS_SOURCES 
+    "${CMAKE_CURRENT_LIST_DIR}/utils/*.c"
+)
+target_sources(usermod_lvml INTERFACE
+    ${UTILS_SOURCES}
+)
+
+# Add MicroPython integration source files
+file(GLOB MICROPYTHON_SOURCES 
+    "${CMAKE_CURRENT_LIST_DIR}/micropython/*.c"
+)
+target_sources(usermod_lvml INTERFACE
+    ${MICROPYTHON_SOURCES}
+)
+
 # Add include directories
 target_include_directories(usermod_lvml INTERFACE
     ${CMAKE_CURRENT_LIST_DIR}
@@ -0,0 +1,291 @@
+/**
+ * @file lvml_canvas.c
+ * @brief lvml.canvas(): an LVGL canvas whose pixels Python can write directly
+ */
+
+#include "lvml_canvas.h"
+#include "core/lvml_ui.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_raster.h"
+#include "micropython/py/runtime.h"
+#include "lvgl/lvgl.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+// Shared by the LVGL object and the Python object; freed by whichever goes last
+typedef struct {
+    lv_obj_t* obj;          // NULL once LVGL deleted the canvas
+    uint8_t* pixels;
+    uint32_t exports;       // Buffers handed out; a memoryview can outlive both owners
+    bool owner_alive;       // The Python object hasn't been finalised
+} canvas_state_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    canvas_state_t* state;
+    lvml_raster_t raster;
+} lvml_canvas_obj_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void canvas_delete_cb(lv_event_t* e);
+static void canvas_state_release(canvas_state_t* state);
+static void canvas_invalidate_area(lvml_canvas_obj_t* self, const lvml_raster_area_t* area);
+static uint32_t canvas_pixel(lvml_canvas_obj_t* self, mp_obj_t color);
+static mp_int_t canvas_get_buffer(mp_obj_t self_in, mp_buffer_info_t* bufinfo, mp_uint_t flags);
+static void canvas_attr(mp_obj_t self_in, qstr attr, mp_obj_t* dest);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+mp_obj_t lvml_canvas_new(int x, int y, int width, int height, qstr format) {
+    lv_color_format_t cf;
+    if (format == MP_QSTR_RGB565) {
+        cf = LV_COLOR_FORMAT_RGB565;
+    } else if (format == MP_QSTR_ARGB8888) {
+        cf = LV_COLOR_FORMAT_ARGB8888;
+    } else {
+        mp_raise_msg(&mp_type_ValueError, "Canvas format must be 'RGB565' or 'ARGB8888'");
+    }
+    if (width <= 0 || height <= 0) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid canvas parameters");
+    }
+
+    // The Python object comes first: once the C side is allocated nothing may raise
+    lvml_canvas_obj_t* self = mp_obj_malloc_with_finaliser(lvml_canvas_obj_t, &lvml_canvas_type);
+    self->state = NULL;
+
+    uint32_t stride = lv_draw_buf_width_to_stride(width, cf);
+    size_t size = (size_t)stride * height;
+    canvas_state_t* state = (canvas_state_t*)malloc(sizeof(canvas_state_t));
+    uint8_t* pixels = (uint8_t*)lvml_mem_alloc_large(size);
+    lv_obj_t* obj = pixels != NULL ? lv_canvas_create(lv_screen_active()) : NULL;
+    if (state == NULL || obj == NULL) {
+        free(state);
+        lvml_mem_free_large(pixels);
+        mp_raise_msg(&mp_type_MemoryError, "Failed to allocate canvas");
+    }
+    memset(pixels, 0, size);
+    if (cf == LV_COLOR_FORMAT_ARGB8888) {
+        lvml_raster_t raster = { pixels, width, height, stride, 4 };
+        lvml_raster_fill(&raster, 0, 0, width, height, lvml_raster_pixel(4, 0x000000));
+    }
+
+    lv_canvas_set_buffer(obj, pixels, width, height, cf);
+    lv_obj_set_pos(obj, x, y);
+
+    state->obj = obj;
+    state->pixels = pixels;
+    state->exports = 0;
+    state->owner_alive = true;
+    lv_obj_add_event_cb(obj, canvas_delete_cb, LV_EVENT_DELETE, state);
+
+    self->state = state;
+    self->raster.data = pixels;
+    self->raster.width = width;
+    self->raster.height = height;
+    self->raster.stride = stride;
+    self->raster.bpp = cf == LV_COLOR_FORMAT_RGB565 ? 2 : 4;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void canvas_delete_cb(lv_event_t* e) {
+    canvas_state_t* state = (canvas_state_t*)lv_event_get_user_data(e);
+    state->obj = NULL;
+    if (!state->owner_alive) {
+        canvas_state_release(state);
+    }
+}
+
+static void canvas_state_release(canvas_state_t* state) {
+    // Python can't tell us when the last memoryview of the pixels is gone,
+    // so a buffer that was ever exported stays allocated
+    if (state->exports == 0) {
+        lvml_mem_free_large(state->pixels);
+    }
+    free(state);
+}
+
+/**
+ * Redraw part of the canvas; area is in canvas coordinates
+ */
+static void canvas_invalidate_area(lvml_canvas_obj_t* self, const lvml_raster_area_t* area) {
+    lv_obj_t* obj = self->state->obj;
+    if (obj == NULL || lvml_raster_area_empty(area)) {
+        return;
+    }
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_area_t dirty = {
+        .x1 = coords.x1 + area->x1,
+        .y1 = coords.y1 + area->y1,
+        .x2 = coords.x1 + area->x2,
+        .y2 = coords.y1 + area->y2,
+    };
+    lv_obj_invalidate_area(obj, &dirty);
+}
+
+static uint32_t canvas_pixel(lvml_canvas_obj_t* self, mp_obj_t color) {
+    uint32_t color_hex;
+    lvml_error_t result;
+    if (mp_obj_is_str(color)) {
+        result = lvml_ui_parse_color(mp_obj_str_get_str(color), 0, &color_hex);
+    } else if (mp_obj_is_int(color)) {
+        result = lvml_ui_parse_color(NULL, mp_obj_get_int(color), &color_hex);
+    } else {
+        mp_raise_msg(&mp_type_ValueError, "Color must be a string (hex or name) or integer");
+    }
+    if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid color format");
+    }
+    return lvml_raster_pixel(self->raster.bpp, color_hex);
+}
+
+static mp_int_t canvas_get_buffer(mp_obj_t self_in, mp_buffer_info_t* bufinfo, mp_uint_t flags) {
+    (void)flags;
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(self_in);
+    self->state->exports++;
+    bufinfo->buf = self->raster.data;
+    bufinfo->len = (size_t)self->raster.stride * self->raster.height;
+    // One item per pixel, so memoryview(canvas)[y * stride_px + x] = value works
+    bufinfo->typecode = self->raster.bpp == 2 ? 'H' : 'I';
+    return 0;
+}
+
+static void canvas_attr(mp_obj_t self_in, qstr attr, mp_obj_t* dest) {
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(self_in);
+    if (dest[0] != MP_OBJ_NULL) {
+        return;
+    }
+
+    if (attr == MP_QSTR_width) {
+        dest[0] = MP_OBJ_NEW_SMALL_INT(self->raster.width);
+    } else if (attr == MP_QSTR_height) {
+        dest[0] = MP_OBJ_NEW_SMALL_INT(self->raster.height);
+    } else if (attr == MP_QSTR_stride) {
+        // In pixels, to index a memoryview of the canvas
+        dest[0] = MP_OBJ_NEW_SMALL_INT(self->raster.stride / self->raster.bpp);
+    } else if (attr == MP_QSTR_valid) {
+        dest[0] = mp_obj_new_bool(self->state->obj != NULL);
+    } else {
+        // Methods are looked up in the locals dict
+        dest[1] = MP_OBJ_SENTINEL;
+    }
+}
+
+// canvas.invalidate(x=0, y=0, w=width, h=height): redraw after writing through the buffer
+static mp_obj_t canvas_invalidate(size_t n_args, const mp_obj_t* args) {
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(args[0]);
+    int32_t x = n_args > 1 ? mp_obj_get_int(args[1]) : 0;
+    int32_t y = n_args > 2 ? mp_obj_get_int(args[2]) : 0;
+    int32_t w = n_args > 3 ? mp_obj_get_int(args[3]) : self->raster.width - x;
+    int32_t h = n_args > 4 ? mp_obj_get_int(args[4]) : self->raster.height - y;
+    lvml_raster_area_t area = lvml_raster_clip(&self->raster, x, y, w, h);
+    canvas_invalidate_area(self, &area);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(canvas_invalidate_obj, 1, 5, canvas_invalidate);
+
+// canvas.fill(color, x=0, y=0, w=width, h=height)
+static mp_obj_t canvas_fill(size_t n_args, const mp_obj_t* args) {
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(args[0]);
+    uint32_t pixel = canvas_pixel(self, args[1]);
+    int32_t x = n_args > 2 ? mp_obj_get_int(args[2]) : 0;
+    int32_t y = n_args > 3 ? mp_obj_get_int(args[3]) : 0;
+    int32_t w = n_args > 4 ? mp_obj_get_int(args[4]) : self->raster.width - x;
+    int32_t h = n_args > 5 ? mp_obj_get_int(args[5]) : self->raster.height - y;
+    lvml_raster_area_t area = lvml_raster_fill(&self->raster, x, y, w, h, pixel);
+    canvas_invalidate_area(self, &area);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(canvas_fill_obj, 2, 6, canvas_fill);
+
+// canvas.line(x0, y0, x1, y1, color)
+static mp_obj_t canvas_line(size_t n_args, const mp_obj_t* args) {
+    (void)n_args;
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(args[0]);
+    uint32_t pixel = canvas_pixel(self, args[5]);
+    lvml_raster_area_t area = lvml_raster_line(&self->raster, mp_obj_get_int(args[1]), mp_obj_get_int(args[2]),
+                                               mp_obj_get_int(args[3]), mp_obj_get_int(args[4]), pixel);
+    canvas_invalidate_area(self, &area);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(canvas_line_obj, 6, 6, canvas_line);
+
+// canvas.blit(src, x, y, w): copy rows of w pixels in the canvas format
+static mp_obj_t canvas_blit(size_t n_args, const mp_obj_t* args) {
+    (void)n_args;
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t src;
+    mp_get_buffer_raise(args[1], &src, MP_BUFFER_READ);
+    int32_t x = mp_obj_get_int(args[2]);
+    int32_t y = mp_obj_get_int(args[3]);
+    int32_t w = mp_obj_get_int(args[4]);
+    uint32_t src_stride = (uint32_t)w * self->raster.bpp;
+    if (w <= 0 || src.len % src_stride != 0) {
+        mp_raise_msg(&mp_type_ValueError, "Source length must be a multiple of the row size");
+    }
+
+    lvml_raster_area_t area = lvml_raster_blit(&self->raster, x, y, (const uint8_t*)src.buf,
+                                               w, src.len / src_stride, src_stride);
+    canvas_invalidate_area(self, &area);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(canvas_blit_obj, 5, 5, canvas_blit);
+
+// canvas.delete(): remove the canvas from the screen; the buffer stays valid
+static mp_obj_t canvas_delete(mp_obj_t self_in) {
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(self_in);
+    if (self->state->obj != NULL) {
+        lv_obj_delete(self->state->obj);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(canvas_delete_obj, canvas_delete);
+
+// Finaliser: the canvas may stay on screen, so the buffer is only freed if LVGL is done with it
+static mp_obj_t canvas_del(mp_obj_t self_in) {
+    lvml_canvas_obj_t* self = MP_OBJ_TO_PTR(self_in);
+    canvas_state_t* state = self->state;
+    if (state == NULL) {
+        return mp_const_none;
+    }
+    self->state = NULL;
+    state->owner_alive = false;
+    if (state->obj == NULL) {
+        canvas_state_release(state);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(canvas_del_obj, canvas_del);
+
+static const mp_rom_map_elem_t canvas_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_invalidate), MP_ROM_PTR(&canvas_invalidate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&canvas_fill_obj) },
+    { MP_ROM_QSTR(MP_QSTR_line), MP_ROM_PTR(&canvas_line_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&canvas_blit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delete), MP_ROM_PTR(&canvas_delete_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&canvas_del_obj) },
+};
+static MP_DEFINE_CONST_DICT(canvas_locals_dict, canvas_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    lvml_canvas_type,
+    MP_QSTR_Canvas,
+    MP_TYPE_FLAG_NONE,
+    attr, canvas_attr,
+    buffer, canvas_get_buffer,
+    locals_dict, &canvas_locals_dict
+);
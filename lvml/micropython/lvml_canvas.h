@@ -0,0 +1,52 @@
+/**
+ * @file lvml_canvas.h
+ * @brief lvml.canvas(): an LVGL canvas whose pixels Python can write directly
+ *
+ * The pixel buffer is allocated in PSRAM and exposed through the buffer
+ * protocol, so memoryview(canvas) (or viper/native code) writes straight
+ * into what LVGL draws. Direct writes need canvas.invalidate() for the area
+ * they changed; the fill(), line() and blit() helpers invalidate what they
+ * touch themselves.
+ *
+ * The buffer lives until both the LVGL object and the Python object are
+ * gone, so neither can see freed memory. A memoryview doesn't keep the
+ * canvas alive and Python can't report when the last one goes away, so
+ * once the buffer has been exported it is never freed; create canvases
+ * that are written through memoryviews once and reuse them.
+ */
+
+#ifndef LVML_CANVAS_H
+#define LVML_CANVAS_H
+
+#include "micropython/py/obj.h"
+#include "utils/lvml_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Canvas type, exposed to Python as lvml.Canvas
+ */
+extern const mp_obj_type_t lvml_canvas_type;
+
+/**
+ * Create a canvas on the active screen, cleared to black
+ * @param x x position
+ * @param y y position
+ * @param width width in pixels
+ * @param height height in pixels
+ * @param format MP_QSTR_RGB565 or MP_QSTR_ARGB8888
+ * @return new canvas object; raises on invalid parameters or out of memory
+ */
+mp_obj_t lvml_canvas_new(int x, int y, int width, int height, qstr format);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_CANVAS_H*/
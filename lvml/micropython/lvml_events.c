@@ -0,0 +1,308 @@
+/**
+ * @file lvml_events.c
+ * @brief Bridge from LVGL events to Python callbacks
+ */
+
+#include "lvml_events.h"
+#include "core/lvml_input.h"
+#include "utils/lvml_time.h"
+#include "micropython/py/runtime.h"
+#include "micropython/py/mpstate.h"
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_event_code_t code;
+    qstr name;
+    bool coalesce;          // High-rate: only the latest queued event is kept
+    int8_t gesture;         // lvml_gesture_type_t whose code replaces `code`, or -1
+} events_name_t;
+
+typedef struct {
+    lv_obj_t* obj;          // NULL when the slot is free
+    uint8_t name;           // Index into events_names
+    uint16_t gen;           // Bumped on release so stale queued events are skipped
+    int16_t queued;         // Ring position of its coalescable event, -1 if none
+} events_slot_t;
+
+typedef struct {
+    uint8_t slot;
+    uint16_t gen;
+    int64_t stamp_us;       // When the (latest) LVGL event arrived
+} events_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static int events_find_name(qstr event);
+static lv_event_code_t events_code(const events_name_t* name);
+static void events_lv_cb(lv_event_t* e);
+static void events_delete_cb(lv_event_t* e);
+static void events_slot_remove(uint32_t index);
+static void events_slot_release(uint32_t index);
+static void events_schedule(void);
+static void events_run(void);
+static mp_obj_t events_dispatch_cb(mp_obj_t arg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const events_name_t events_names[] = {
+    { LV_EVENT_CLICKED, MP_QSTR_clicked, false, -1 },
+    { LV_EVENT_PRESSED, MP_QSTR_pressed, false, -1 },
+    { LV_EVENT_PRESSING, MP_QSTR_pressing, true, -1 },
+    { LV_EVENT_RELEASED, MP_QSTR_released, false, -1 },
+    { LV_EVENT_LONG_PRESSED, MP_QSTR_long_pressed, false, -1 },
+    { LV_EVENT_VALUE_CHANGED, MP_QSTR_value_changed, true, -1 },
+    { LV_EVENT_SCROLL, MP_QSTR_scroll, true, -1 },
+    { LV_EVENT_FOCUSED, MP_QSTR_focused, false, -1 },
+    { LV_EVENT_DEFOCUSED, MP_QSTR_defocused, false, -1 },
+    // Gestures from the touch recognizer (lvml_input.h)
+    { LV_EVENT_ALL, MP_QSTR_tap, false, LVML_GESTURE_TAP },
+    { LV_EVENT_ALL, MP_QSTR_double_tap, false, LVML_GESTURE_DOUBLE_TAP },
+    { LV_EVENT_ALL, MP_QSTR_long_press, false, LVML_GESTURE_LONG_PRESS },
+    { LV_EVENT_ALL, MP_QSTR_swipe, false, LVML_GESTURE_SWIPE },
+    { LV_EVENT_ALL, MP_QSTR_pinch, true, LVML_GESTURE_PINCH },
+    { LV_EVENT_ALL, MP_QSTR_rotate, true, LVML_GESTURE_ROTATE },
+    { LV_EVENT_ALL, MP_QSTR_pan, true, LVML_GESTURE_PAN },
+};
+
+static events_slot_t events_slots[LVML_EVENTS_SLOTS];
+static events_entry_t events_ring[LVML_EVENTS_QUEUE_MAX];
+static uint32_t events_head = 0;
+static uint32_t events_count = 0;
+static bool events_dispatch_scheduled = false;
+
+static lvml_events_stats_t events_stats;
+static uint64_t events_latency_total_us = 0;
+
+static MP_DEFINE_CONST_FUN_OBJ_1(events_dispatch_obj, events_dispatch_cb);
+
+// Handle and callback of each slot, at [2 * slot] and [2 * slot + 1]
+MP_REGISTER_ROOT_POINTER(mp_obj_t lvml_events_objs[LVML_EVENTS_SLOTS * 2]);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lvml_events_register(lv_obj_t* obj, mp_obj_t handle, qstr event, mp_obj_t callback) {
+    int name = events_find_name(event);
+    if (name < 0) {
+        return false;
+    }
+
+    // Registering the same event again replaces the callback
+    int free_index = -1;
+    for (uint32_t i = 0; i < LVML_EVENTS_SLOTS; i++) {
+        if (events_slots[i].obj == obj && events_slots[i].name == name) {
+            MP_STATE_VM(lvml_events_objs)[2 * i] = handle;
+            MP_STATE_VM(lvml_events_objs)[2 * i + 1] = callback;
+            return true;
+        }
+        if (events_slots[i].obj == NULL && free_index < 0) {
+            free_index = i;
+        }
+    }
+    if (free_index < 0) {
+        mp_raise_msg(&mp_type_RuntimeError, "Too many event callbacks");
+    }
+
+    events_slot_t* slot = &events_slots[free_index];
+    slot->obj = obj;
+    slot->name = (uint8_t)name;
+    slot->queued = -1;
+    MP_STATE_VM(lvml_events_objs)[2 * free_index] = handle;
+    MP_STATE_VM(lvml_events_objs)[2 * free_index + 1] = callback;
+
+    void* user_data = (void*)(uintptr_t)free_index;
+    lv_obj_add_event_cb(obj, events_lv_cb, events_code(&events_names[name]), user_data);
+    lv_obj_add_event_cb(obj, events_delete_cb, LV_EVENT_DELETE, user_data);
+    return true;
+}
+
+uint32_t lvml_events_unregister(lv_obj_t* obj, qstr event) {
+    uint32_t removed = 0;
+    for (uint32_t i = 0; i < LVML_EVENTS_SLOTS; i++) {
+        events_slot_t* slot = &events_slots[i];
+        if (slot->obj != obj || obj == NULL) {
+            continue;
+        }
+        if (event != MP_QSTRnull && events_names[slot->name].name != event) {
+            continue;
+        }
+
+        events_slot_remove(i);
+        removed++;
+    }
+    return removed;
+}
+
+void lvml_events_reset(void) {
+    for (uint32_t i = 0; i < LVML_EVENTS_SLOTS; i++) {
+        if (events_slots[i].obj != NULL) {
+            events_slot_remove(i);
+        }
+    }
+    events_head = 0;
+    events_count = 0;
+    // A dispatch scheduled before a soft reset never runs
+    events_dispatch_scheduled = false;
+}
+
+void lvml_events_poll(void) {
+    if (!events_dispatch_scheduled && events_count > 0) {
+        events_run();
+    }
+}
+
+void lvml_events_get_stats(lvml_events_stats_t* stats, bool reset) {
+    if (stats != NULL) {
+        *stats = events_stats;
+        stats->avg_latency_us = events_stats.dispatched > 0 ?
+                                (uint32_t)(events_latency_total_us / events_stats.dispatched) : 0;
+    }
+    if (reset) {
+        memset(&events_stats, 0, sizeof(events_stats));
+        events_latency_total_us = 0;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static int events_find_name(qstr event) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(events_names); i++) {
+        if (events_names[i].name == event) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static lv_event_code_t events_code(const events_name_t* name) {
+    return name->gesture >= 0 ? lvml_input_gesture_code((uint8_t)name->gesture) : name->code;
+}
+
+/**
+ * Runs inside lv_timer_handler(): record the event, never call Python here
+ */
+static void events_lv_cb(lv_event_t* e) {
+    uint32_t index = (uint32_t)(uintptr_t)lv_event_get_user_data(e);
+    events_slot_t* slot = &events_slots[index];
+    events_stats.received++;
+
+    if (slot->queued >= 0) {
+        // Only coalescable events are remembered in slot->queued
+        events_ring[slot->queued].stamp_us = lvml_time_us();
+        events_stats.coalesced++;
+        return;
+    }
+    if (events_count == LVML_EVENTS_QUEUE_MAX) {
+        events_stats.dropped++;
+        return;
+    }
+
+    uint32_t pos = (events_head + events_count) % LVML_EVENTS_QUEUE_MAX;
+    events_ring[pos].slot = (uint8_t)index;
+    events_ring[pos].gen = slot->gen;
+    events_ring[pos].stamp_us = lvml_time_us();
+    events_count++;
+    if (events_names[slot->name].coalesce) {
+        slot->queued = (int16_t)pos;
+    }
+    events_schedule();
+}
+
+static void events_delete_cb(lv_event_t* e) {
+    events_slot_release((uint32_t)(uintptr_t)lv_event_get_user_data(e));
+}
+
+/**
+ * Detach a slot from its object and free it
+ */
+static void events_slot_remove(uint32_t index) {
+    void* user_data = (void*)(uintptr_t)index;
+    lv_obj_remove_event_cb_with_user_data(events_slots[index].obj, events_lv_cb, user_data);
+    lv_obj_remove_event_cb_with_user_data(events_slots[index].obj, events_delete_cb, user_data);
+    events_slot_release(index);
+}
+
+static void events_slot_release(uint32_t index) {
+    events_slot_t* slot = &events_slots[index];
+    slot->obj = NULL;
+    slot->gen++;
+    slot->queued = -1;
+    MP_STATE_VM(lvml_events_objs)[2 * index] = MP_OBJ_NULL;
+    MP_STATE_VM(lvml_events_objs)[2 * index + 1] = MP_OBJ_NULL;
+}
+
+/**
+ * Ask for one dispatch after the current frame
+ */
+static void events_schedule(void) {
+    if (events_dispatch_scheduled) {
+        return;
+    }
+#if MICROPY_ENABLE_SCHEDULER
+    // If the scheduler queue is full, lvml_events_poll() dispatches at the end of lvml.tick()
+    events_dispatch_scheduled = mp_sched_schedule(MP_OBJ_FROM_PTR(&events_dispatch_obj), mp_const_none);
+#endif
+}
+
+/**
+ * Drain the events queued so far; events raised by the callbacks wait for the next frame
+ */
+static void events_run(void) {
+    uint32_t count = events_count;
+    events_stats.dispatches++;
+
+    for (uint32_t i = 0; i < count && events_count > 0; i++) {
+        events_entry_t entry = events_ring[events_head];
+        uint32_t pos = events_head;
+        events_head = (events_head + 1) % LVML_EVENTS_QUEUE_MAX;
+        events_count--;
+
+        events_slot_t* slot = &events_slots[entry.slot];
+        if (slot->queued == (int16_t)pos) {
+            slot->queued = -1;
+        }
+        if (slot->obj == NULL || slot->gen != entry.gen) {
+            continue;
+        }
+
+        uint32_t latency_us = (uint32_t)(lvml_time_us() - entry.stamp_us);
+        events_stats.last_latency_us = latency_us;
+        if (latency_us > events_stats.max_latency_us) {
+            events_stats.max_latency_us = latency_us;
+        }
+        events_latency_total_us += latency_us;
+        events_stats.dispatched++;
+
+        // The callback may unregister, so take what it needs first
+        mp_obj_t handle = MP_STATE_VM(lvml_events_objs)[2 * entry.slot];
+        mp_obj_t callback = MP_STATE_VM(lvml_events_objs)[2 * entry.slot + 1];
+        mp_obj_t name = MP_OBJ_NEW_QSTR(events_names[slot->name].name);
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            mp_call_function_2(callback, handle, name);
+            nlr_pop();
+        } else {
+            events_stats.errors++;
+            mp_printf(&mp_plat_print, "[LVML] Event callback failed:\n");
+            mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+        }
+    }
+}
+
+static mp_obj_t events_dispatch_cb(mp_obj_t arg) {
+    (void)arg;
+    events_dispatch_scheduled = false;
+    events_run();
+    return mp_const_none;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file lvml_events.h
+ * @brief Bridge from LVGL events to Python callbacks
+ *
+ * LVGL event callbacks only record the event in a fixed-size ring; they
+ * never enter the interpreter. High-rate events (pressing, scroll,
+ * value_changed, and the pinch, rotate and pan gestures) are coalesced per
+ * object so only the latest one stays queued. The ring is drained by one dispatch per frame, scheduled with
+ * mp_sched_schedule() so the Python callbacks run after lvml.tick()
+ * returns, outside the render loop.
+ */
+
+#ifndef LVML_EVENTS_H
+#define LVML_EVENTS_H
+
+#include "micropython/py/obj.h"
+#include "lvgl/lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_EVENTS_SLOTS 32        // Registered (object, event) callbacks
+#define LVML_EVENTS_QUEUE_MAX 32    // Events waiting for dispatch
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Event bridge statistics
+ */
+typedef struct {
+    uint32_t received;      // LVGL events seen by registered callbacks
+    uint32_t coalesced;     // ... merged into an event that was already queued
+    uint32_t dropped;       // ... lost because the queue was full
+    uint32_t dispatched;    // Python callbacks called
+    uint32_t dispatches;    // Dispatch passes (at most one per frame)
+    uint32_t errors;        // Callbacks that raised
+    uint32_t last_latency_us; // From the (latest) LVGL event to its callback
+    uint32_t avg_latency_us;
+    uint32_t max_latency_us;
+} lvml_events_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Call a Python callback for an event of an object
+ * @param obj LVGL object
+ * @param handle object passed to the callback as its first argument
+ * @param event event name, e.g. MP_QSTR_clicked; passed as the second argument
+ * @param callback callable(handle, event)
+ * @return false if the event name is unknown; raises if all slots are in use
+ */
+bool lvml_events_register(lv_obj_t* obj, mp_obj_t handle, qstr event, mp_obj_t callback);
+
+/**
+ * Remove callbacks of an object
+ * @param obj LVGL object
+ * @param event event name, or MP_QSTRnull for all events
+ * @return number of callbacks removed
+ */
+uint32_t lvml_events_unregister(lv_obj_t* obj, qstr event);
+
+/**
+ * Remove all callbacks, from LVGL too, and drop the queued events; called
+ * by lvml.deinit() and on the first import after a soft reset, which
+ * clears the Python callbacks and the scheduler queue but not the LVGL
+ * objects
+ */
+void lvml_events_reset(void);
+
+/**
+ * Dispatch queued events unless a scheduled dispatch is pending; called by
+ * lvml.tick() after the frame in case the scheduler queue was full
+ */
+void lvml_events_poll(void);
+
+/**
+ * Get event bridge statistics
+ * @param stats output statistics
+ * @param reset clear the counters after reading them
+ */
+void lvml_events_get_stats(lvml_events_stats_t* stats, bool reset);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_EVENTS_H*/
@@ -0,0 +1,284 @@
+/**
+ * @file lvml_handle.c
+ * @brief Python handles wrapping LVGL objects for in-place updates
+ */
+
+#include "lvml_handle.h"
+#include "lvml_events.h"
+#include "core/lvml_ui.h"
+#include "micropython/py/runtime.h"
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    mp_obj_base_t base;
+    lv_obj_t* obj;          // NULL once LVGL deleted the object
+    mp_obj_t data;          // Kept alive for the object (e.g. image source)
+} lvml_handle_obj_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void handle_delete_cb(lv_event_t* e);
+static lv_obj_t* handle_get_obj(mp_obj_t self_in);
+static lv_obj_t* handle_text_target(lv_obj_t* obj);
+static mp_obj_t handle_get_text(lv_obj_t* obj);
+static void handle_set_text(lv_obj_t* obj, mp_obj_t value);
+static void handle_set_pos(lv_obj_t* obj, mp_obj_t value);
+static void handle_set_bg(lv_obj_t* obj, mp_obj_t value);
+static void handle_set_hidden(lv_obj_t* obj, mp_obj_t value);
+static void handle_attr(mp_obj_t self_in, qstr attr, mp_obj_t* dest);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lvml_handle_stats_t handle_stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+mp_obj_t lvml_handle_new(lv_obj_t* obj, mp_obj_t data) {
+    lvml_handle_obj_t* self = mp_obj_malloc_with_finaliser(lvml_handle_obj_t, &lvml_handle_type);
+    self->obj = obj;
+    self->data = data == MP_OBJ_NULL ? mp_const_none : data;
+    lv_obj_add_event_cb(obj, handle_delete_cb, LV_EVENT_DELETE, self);
+
+    handle_stats.created++;
+    handle_stats.live++;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+void lvml_handle_get_stats(lvml_handle_stats_t* stats) {
+    if (stats != NULL) {
+        *stats = handle_stats;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * LVGL deletes the object: forget it so the handle can't touch freed memory
+ */
+static void handle_delete_cb(lv_event_t* e) {
+    lvml_handle_obj_t* self = (lvml_handle_obj_t*)lv_event_get_user_data(e);
+    if (self->obj != NULL) {
+        self->obj = NULL;
+        handle_stats.live--;
+        handle_stats.deleted++;
+    }
+}
+
+static lv_obj_t* handle_get_obj(mp_obj_t self_in) {
+    lvml_handle_obj_t* self = MP_OBJ_TO_PTR(self_in);
+    if (self->obj == NULL) {
+        mp_raise_msg(&mp_type_RuntimeError, "Object has been deleted");
+    }
+    return self->obj;
+}
+
+/**
+ * Labels and text areas hold their own text; buttons hold it in a child label
+ */
+static lv_obj_t* handle_text_target(lv_obj_t* obj) {
+    if (lv_obj_check_type(obj, &lv_label_class) || lv_obj_check_type(obj, &lv_textarea_class)) {
+        return obj;
+    }
+    lv_obj_t* child = lv_obj_get_child(obj, 0);
+    if (child != NULL && lv_obj_check_type(child, &lv_label_class)) {
+        return child;
+    }
+    mp_raise_msg(&mp_type_AttributeError, "Object has no text");
+    return NULL;
+}
+
+static mp_obj_t handle_get_text(lv_obj_t* obj) {
+    lv_obj_t* target = handle_text_target(obj);
+    const char* text = lv_obj_check_type(target, &lv_textarea_class) ?
+                       lv_textarea_get_text(target) : lv_label_get_text(target);
+    return mp_obj_new_str(text, strlen(text));
+}
+
+static void handle_set_text(lv_obj_t* obj, mp_obj_t value) {
+    lv_obj_t* target = handle_text_target(obj);
+    const char* text = mp_obj_str_get_str(value);
+    bool is_textarea = lv_obj_check_type(target, &lv_textarea_class);
+    const char* current = is_textarea ? lv_textarea_get_text(target) : lv_label_get_text(target);
+    if (strcmp(current, text) == 0) {
+        handle_stats.unchanged++;
+        return;
+    }
+
+    if (is_textarea) {
+        lv_textarea_set_text(target, text);
+    } else {
+        lv_label_set_text(target, text);
+    }
+    handle_stats.updates++;
+}
+
+static void handle_set_pos(lv_obj_t* obj, mp_obj_t value) {
+    mp_obj_t* xy;
+    mp_obj_get_array_fixed_n(value, 2, &xy);
+    int32_t x = mp_obj_get_int(xy[0]);
+    int32_t y = mp_obj_get_int(xy[1]);
+    if (lv_obj_get_style_x(obj, LV_PART_MAIN) == x && lv_obj_get_style_y(obj, LV_PART_MAIN) == y) {
+        handle_stats.unchanged++;
+        return;
+    }
+
+    lv_obj_set_pos(obj, x, y);
+    handle_stats.updates++;
+}
+
+static void handle_set_bg(lv_obj_t* obj, mp_obj_t value) {
+    uint32_t color_hex = 0;
+    lvml_error_t result;
+    if (mp_obj_is_str(value)) {
+        result = lvml_ui_parse_color(mp_obj_str_get_str(value), 0, &color_hex);
+    } else if (mp_obj_is_int(value)) {
+        result = lvml_ui_parse_color(NULL, mp_obj_get_int(value), &color_hex);
+    } else {
+        mp_raise_msg(&mp_type_ValueError, "Color must be a string (hex or name) or integer");
+        return;
+    }
+    if (result != LVML_OK) {
+        mp_raise_msg(&mp_type_ValueError, "Invalid color format");
+    }
+
+    lv_color_t color = lv_color_hex(color_hex & 0xFFFFFF);
+    if (lv_color_eq(lv_obj_get_style_bg_color(obj, LV_PART_MAIN), color)) {
+        handle_stats.unchanged++;
+        return;
+    }
+
+    // A local style overrides the shared (interned) one for this object only
+    lv_obj_set_style_bg_color(obj, color, LV_PART_MAIN);
+    handle_stats.updates++;
+}
+
+static void handle_set_hidden(lv_obj_t* obj, mp_obj_t value) {
+    bool hidden = mp_obj_is_true(value);
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == hidden) {
+        handle_stats.unchanged++;
+        return;
+    }
+
+    if (hidden) {
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    handle_stats.updates++;
+}
+
+static void handle_attr(mp_obj_t self_in, qstr attr, mp_obj_t* dest) {
+    lvml_handle_obj_t* self = MP_OBJ_TO_PTR(self_in);
+
+    if (attr == MP_QSTR_valid) {
+        if (dest[0] == MP_OBJ_NULL) {
+            dest[0] = mp_obj_new_bool(self->obj != NULL);
+        }
+        return;
+    }
+    if (attr != MP_QSTR_text && attr != MP_QSTR_pos && attr != MP_QSTR_bg && attr != MP_QSTR_hidden) {
+        // Methods are looked up in the locals dict
+        dest[1] = MP_OBJ_SENTINEL;
+        return;
+    }
+
+    lv_obj_t* obj = handle_get_obj(self_in);
+    if (dest[0] == MP_OBJ_NULL) {
+        // Load
+        if (attr == MP_QSTR_text) {
+            dest[0] = handle_get_text(obj);
+        } else if (attr == MP_QSTR_pos) {
+            lv_obj_update_layout(obj);
+            mp_obj_t xy[2] = { mp_obj_new_int(lv_obj_get_x(obj)), mp_obj_new_int(lv_obj_get_y(obj)) };
+            dest[0] = mp_obj_new_tuple(2, xy);
+        } else if (attr == MP_QSTR_bg) {
+            dest[0] = mp_obj_new_int_from_uint(lv_color_to_u32(lv_obj_get_style_bg_color(obj, LV_PART_MAIN)) & 0xFFFFFF);
+        } else {
+            dest[0] = mp_obj_new_bool(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN));
+        }
+    } else if (dest[1] != MP_OBJ_NULL) {
+        // Store
+        if (attr == MP_QSTR_text) {
+            handle_set_text(obj, dest[1]);
+        } else if (attr == MP_QSTR_pos) {
+            handle_set_pos(obj, dest[1]);
+        } else if (attr == MP_QSTR_bg) {
+            handle_set_bg(obj, dest[1]);
+        } else {
+            handle_set_hidden(obj, dest[1]);
+        }
+        dest[0] = MP_OBJ_NULL;
+    }
+}
+
+// handle.delete(): delete the object; the DELETE callback invalidates the handle
+static mp_obj_t handle_delete(mp_obj_t self_in) {
+    lvml_handle_obj_t* self = MP_OBJ_TO_PTR(self_in);
+    if (self->obj != NULL) {
+        lv_obj_delete(self->obj);
+    }
+    self->data = mp_const_none;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(handle_delete_obj, handle_delete);
+
+// handle.on(event, callback): callback(handle, event) runs after the frame the event happened in
+static mp_obj_t handle_on(mp_obj_t self_in, mp_obj_t event_in, mp_obj_t callback) {
+    lv_obj_t* obj = handle_get_obj(self_in);
+    if (!mp_obj_is_callable(callback)) {
+        mp_raise_msg(&mp_type_TypeError, "callback must be callable");
+    }
+    if (!lvml_events_register(obj, self_in, mp_obj_str_get_qstr(event_in), callback)) {
+        mp_raise_msg(&mp_type_ValueError, "Unknown event");
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(handle_on_obj, handle_on);
+
+// handle.off(event=None): remove one or all callbacks
+static mp_obj_t handle_off(size_t n_args, const mp_obj_t* args) {
+    lv_obj_t* obj = handle_get_obj(args[0]);
+    qstr event = n_args > 1 && args[1] != mp_const_none ? mp_obj_str_get_qstr(args[1]) : MP_QSTRnull;
+    return MP_OBJ_NEW_SMALL_INT(lvml_events_unregister(obj, event));
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(handle_off_obj, 1, 2, handle_off);
+
+// Finaliser: the object may outlive its handle, so drop the callback pointing at it
+static mp_obj_t handle_del(mp_obj_t self_in) {
+    lvml_handle_obj_t* self = MP_OBJ_TO_PTR(self_in);
+    if (self->obj != NULL) {
+        lv_obj_remove_event_cb_with_user_data(self->obj, handle_delete_cb, self);
+        self->obj = NULL;
+        handle_stats.live--;
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(handle_del_obj, handle_del);
+
+static const mp_rom_map_elem_t handle_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_delete), MP_ROM_PTR(&handle_delete_obj) },
+    { MP_ROM_QSTR(MP_QSTR_on), MP_ROM_PTR(&handle_on_obj) },
+    { MP_ROM_QSTR(MP_QSTR_off), MP_ROM_PTR(&handle_off_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&handle_del_obj) },
+};
+static MP_DEFINE_CONST_DICT(handle_locals_dict, handle_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    lvml_handle_type,
+    MP_QSTR_Widget,
+    MP_TYPE_FLAG_NONE,
+    attr, handle_attr,
+    locals_dict, &handle_locals_dict
+);
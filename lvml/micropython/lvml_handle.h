@@ -0,0 +1,66 @@
+/**
+ * @file lvml_handle.h
+ * @brief Python handles wrapping LVGL objects for in-place updates
+ *
+ * A handle holds a pointer to an lv_obj_t and exposes .text, .pos, .bg and
+ * .hidden properties, .delete(), and .on()/.off() for event callbacks (see
+ * lvml_events.h). When LVGL deletes the object (screen cleared, XML
+ * reloaded, parent deleted) the handle is invalidated through an
+ * LV_EVENT_DELETE callback, and any further use raises RuntimeError. Writes
+ * that don't change anything are skipped so they cause no redraw.
+ */
+
+#ifndef LVML_HANDLE_H
+#define LVML_HANDLE_H
+
+#include "micropython/py/obj.h"
+#include "lvgl/lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Handle statistics
+ */
+typedef struct {
+    uint32_t created;       // Handles created
+    uint32_t live;          // Handles whose object still exists
+    uint32_t deleted;       // Objects deleted while a handle referred to them
+    uint32_t updates;       // Property writes that changed the object
+    uint32_t unchanged;     // Property writes skipped because nothing changed
+} lvml_handle_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Handle type, exposed to Python as lvml.Widget
+ */
+extern const mp_obj_type_t lvml_handle_type;
+
+/**
+ * Create a handle for an object
+ * @param obj LVGL object
+ * @param data Python object to keep alive while the handle exists
+ *             (e.g. the PNG buffer of an image), may be MP_OBJ_NULL
+ * @return new handle
+ */
+mp_obj_t lvml_handle_new(lv_obj_t* obj, mp_obj_t data);
+
+/**
+ * Get handle statistics
+ * @param stats output statistics
+ */
+void lvml_handle_get_stats(lvml_handle_stats_t* stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_HANDLE_H*/
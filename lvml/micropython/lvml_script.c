@@ -0,0 +1,340 @@
+/**
+ * @file lvml_script.c
+ * @brief Run <micropython src="..."> scripts with a VFS bytecode cache
+ */
+
+#include "lvml_script.h"
+#include "lvml_vfs.h"
+#include "utils/lvml_hash.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_time.h"
+#include "xml/lvml_xml_scan.h"
+#include "micropython/py/runtime.h"
+#include "micropython/py/mphal.h"
+#include "micropython/py/compile.h"
+#include "micropython/py/persistentcode.h"
+#include <stdio.h>
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const char* base_dir;
+    const lvml_bundle_t* bundle;         // Scripts come from here if set
+    lvml_error_t result;
+} script_xml_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lvml_error_t script_run(const char* path, const char* source, size_t len, int64_t start_us);
+static lvml_error_t script_run_bundled(const lvml_bundle_t* bundle, const char* name);
+static lvml_script_stats_t* script_stats_get(const char* path);
+static bool script_load_cached(const char* cache_path, uint32_t key, mp_compiled_module_t* cm, uint32_t* mpy_bytes);
+static bool script_compile(const char* source, size_t len, const char* path, mp_compiled_module_t* cm);
+static void script_save_cached(const char* cache_path, uint32_t key, mp_compiled_module_t* cm, uint32_t* mpy_bytes);
+static lvml_error_t script_execute(mp_compiled_module_t* cm);
+static bool script_xml_cb(lvml_xml_str_t tag, lvml_xml_str_t name, lvml_xml_str_t value, void* user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lvml_script_stats_t script_stats[LVML_SCRIPT_STATS_MAX];
+static uint32_t script_stats_cnt = 0;
+static lvml_script_stats_t script_stats_overflow;
+static bool script_cache_dir_ready = false;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_script_run_file(const char* path) {
+    if (path == NULL || path[0] == '\0' || strlen(path) >= LVML_SCRIPT_PATH_MAX) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    int64_t start_us = lvml_time_us();
+    mp_obj_t source = lvml_vfs_read(path);
+    if (source == MP_OBJ_NULL) {
+        mp_printf(&mp_plat_print, "[LVML] Script not found: %s\n", path);
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    size_t len;
+    const char* data = mp_obj_str_get_data(source, &len);
+    return script_run(path, data, len, start_us);
+}
+
+lvml_error_t lvml_script_run_source(const char* path, const char* source, size_t len) {
+    if (path == NULL || path[0] == '\0' || strlen(path) >= LVML_SCRIPT_PATH_MAX || source == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    return script_run(path, source, len, lvml_time_us());
+}
+
+lvml_error_t lvml_script_run_xml(const char* xml_content, const char* base_dir) {
+    if (xml_content == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    script_xml_ctx_t ctx = {
+        .base_dir = base_dir != NULL ? base_dir : "",
+        .bundle = NULL,
+        .result = LVML_OK,
+    };
+    lvml_xml_scan_attrs(xml_content, script_xml_cb, &ctx);
+
+    return ctx.result;
+}
+
+lvml_error_t lvml_script_run_xml_bundle(const char* xml_content, const lvml_bundle_t* bundle) {
+    if (xml_content == NULL || bundle == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    script_xml_ctx_t ctx = {
+        .base_dir = "",
+        .bundle = bundle,
+        .result = LVML_OK,
+    };
+    lvml_xml_scan_attrs(xml_content, script_xml_cb, &ctx);
+
+    return ctx.result;
+}
+
+uint32_t lvml_script_cache_key(const char* source, size_t len) {
+    uint32_t key = lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, source, len);
+    key = lvml_hash_fnv1a_u32(key, (uint32_t)len);
+    return lvml_hash_fnv1a_u32(key, (MPY_VERSION << 8) | MPY_SUB_VERSION);
+}
+
+const lvml_script_stats_t* lvml_script_get_stats(uint32_t index) {
+    return index < script_stats_cnt ? &script_stats[index] : NULL;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lvml_error_t script_run(const char* path, const char* source, size_t len, int64_t start_us) {
+    lvml_script_stats_t* stats = script_stats_get(path);
+    uint32_t key = lvml_script_cache_key(source, len);
+    stats->source_bytes = len;
+
+    char cache_path[sizeof(LVML_SCRIPT_CACHE_DIR) + 16];
+    snprintf(cache_path, sizeof(cache_path), "%s/%08lx.mpy", LVML_SCRIPT_CACHE_DIR,
+             (unsigned long)lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, path, strlen(path)));
+
+    // Every script runs as its own __main__ module
+    mp_obj_t globals = mp_obj_new_dict(1);
+    mp_obj_dict_store(globals, MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR___main__));
+    mp_compiled_module_t cm;
+    cm.context = m_new_obj(mp_module_context_t);
+    cm.context->module.globals = MP_OBJ_TO_PTR(globals);
+
+    if (script_load_cached(cache_path, key, &cm, &stats->mpy_bytes)) {
+        stats->load_us = (uint32_t)(lvml_time_us() - start_us);
+        stats->hits++;
+    } else {
+        if (!script_compile(source, len, path, &cm)) {
+            return LVML_ERROR_MP_EXEC;
+        }
+        stats->compile_us = (uint32_t)(lvml_time_us() - start_us);
+        stats->misses++;
+        script_save_cached(cache_path, key, &cm, &stats->mpy_bytes);
+    }
+
+    return script_execute(&cm);
+}
+
+/**
+ * Bundled scripts are cached under their entry name
+ */
+static lvml_error_t script_run_bundled(const lvml_bundle_t* bundle, const char* name) {
+    lvml_bundle_entry_t entry;
+    if (!lvml_bundle_find(bundle, name, &entry)) {
+        mp_printf(&mp_plat_print, "[LVML] Script not in bundle: %s\n", name);
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    uint8_t* source;
+    lvml_error_t result = lvml_bundle_read(bundle, &entry, &source);
+    if (result != LVML_OK) {
+        mp_printf(&mp_plat_print, "[LVML] Corrupt bundle entry: %s\n", name);
+        return result;
+    }
+
+    // The source is outside the GC heap; free it even if the script raises
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        result = lvml_script_run_source(name, (const char*)source, entry.size);
+        nlr_pop();
+    } else {
+        lvml_mem_free_large(source);
+        nlr_jump(nlr.ret_val);
+    }
+    lvml_mem_free_large(source);
+    return result;
+}
+
+static lvml_script_stats_t* script_stats_get(const char* path) {
+    for (uint32_t i = 0; i < script_stats_cnt; i++) {
+        if (strcmp(script_stats[i].path, path) == 0) {
+            return &script_stats[i];
+        }
+    }
+    if (script_stats_cnt == LVML_SCRIPT_STATS_MAX) {
+        return &script_stats_overflow;
+    }
+
+    lvml_script_stats_t* stats = &script_stats[script_stats_cnt++];
+    memset(stats, 0, sizeof(lvml_script_stats_t));
+    strcpy(stats->path, path);
+    return stats;
+}
+
+static bool script_load_cached(const char* cache_path, uint32_t key, mp_compiled_module_t* cm, uint32_t* mpy_bytes) {
+    mp_obj_t data = lvml_vfs_read(cache_path);
+    if (data == MP_OBJ_NULL) {
+        return false;
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    const uint8_t* buf = (const uint8_t*)bufinfo.buf;
+    if (bufinfo.len <= LVML_SCRIPT_CACHE_HEADER_SIZE || memcmp(buf, LVML_SCRIPT_CACHE_MAGIC, 4) != 0) {
+        return false;
+    }
+    uint32_t entry_key = buf[4] | (buf[5] << 8) | (buf[6] << 16) | ((uint32_t)buf[7] << 24);
+    if (entry_key != key) {
+        return false;
+    }
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_raw_code_load_mem(buf + LVML_SCRIPT_CACHE_HEADER_SIZE, bufinfo.len - LVML_SCRIPT_CACHE_HEADER_SIZE, cm);
+        nlr_pop();
+        *mpy_bytes = bufinfo.len - LVML_SCRIPT_CACHE_HEADER_SIZE;
+        return true;
+    }
+
+    // Built by an incompatible mpy-cross or firmware; recompile instead
+    mp_printf(&mp_plat_print, "[LVML] Ignoring incompatible bytecode cache: %s\n", cache_path);
+    return false;
+}
+
+static bool script_compile(const char* source, size_t len, const char* path, mp_compiled_module_t* cm) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        qstr source_name = qstr_from_str(path);
+        mp_lexer_t* lex = mp_lexer_new_from_str_len(source_name, source, len, 0);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compile_to_raw_code(&parse_tree, source_name, false, cm);
+        nlr_pop();
+        return true;
+    }
+
+    mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+    return false;
+}
+
+static void script_save_cached(const char* cache_path, uint32_t key, mp_compiled_module_t* cm, uint32_t* mpy_bytes) {
+#if MICROPY_PERSISTENT_CODE_SAVE
+    if (!script_cache_dir_ready) {
+        lvml_vfs_makedirs(LVML_SCRIPT_CACHE_DIR);
+        script_cache_dir_ready = true;
+    }
+
+    vstr_t vstr;
+    mp_print_t print;
+    vstr_init_print(&vstr, 512, &print);
+
+    uint8_t header[LVML_SCRIPT_CACHE_HEADER_SIZE];
+    memcpy(header, LVML_SCRIPT_CACHE_MAGIC, 4);
+    header[4] = key & 0xFF;
+    header[5] = (key >> 8) & 0xFF;
+    header[6] = (key >> 16) & 0xFF;
+    header[7] = (key >> 24) & 0xFF;
+    vstr_add_strn(&vstr, (const char*)header, sizeof(header));
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_raw_code_save(cm, &print);
+        nlr_pop();
+        if (lvml_vfs_write(cache_path, vstr.buf, vstr.len)) {
+            *mpy_bytes = vstr.len - LVML_SCRIPT_CACHE_HEADER_SIZE;
+        } else {
+            mp_printf(&mp_plat_print, "[LVML] Failed to write bytecode cache: %s\n", cache_path);
+        }
+    }
+    vstr_clear(&vstr);
+#else
+    // Without MICROPY_PERSISTENT_CODE_SAVE only precompiled entries are used
+    (void)cache_path;
+    (void)key;
+    (void)cm;
+    (void)mpy_bytes;
+#endif
+}
+
+static lvml_error_t script_execute(mp_compiled_module_t* cm) {
+    mp_obj_dict_t* volatile old_globals = mp_globals_get();
+    mp_obj_dict_t* volatile old_locals = mp_locals_get();
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_globals_set(cm->context->module.globals);
+        mp_locals_set(cm->context->module.globals);
+        mp_obj_t fun = mp_make_function_from_proto_fun(cm->rc, cm->context, NULL);
+        mp_call_function_0(fun);
+        nlr_pop();
+        mp_globals_set(old_globals);
+        mp_locals_set(old_locals);
+        return LVML_OK;
+    }
+
+    mp_globals_set(old_globals);
+    mp_locals_set(old_locals);
+    mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+    return LVML_ERROR_MP_EXEC;
+}
+
+static bool script_xml_cb(lvml_xml_str_t tag, lvml_xml_str_t name, lvml_xml_str_t value, void* user_data) {
+    script_xml_ctx_t* ctx = (script_xml_ctx_t*)user_data;
+    if (!lvml_xml_str_eq(tag, "micropython") || !lvml_xml_str_eq(name, "src")) {
+        return true;
+    }
+
+    char src[LVML_SCRIPT_PATH_MAX];
+    char path[LVML_SCRIPT_PATH_MAX];
+    bool fits = lvml_xml_str_copy(value, src, sizeof(src));
+    if (fits && ctx->bundle != NULL) {
+        lvml_error_t result = script_run_bundled(ctx->bundle, src);
+        if (result != LVML_OK && ctx->result == LVML_OK) {
+            ctx->result = result;
+        }
+        return true;
+    }
+    if (fits && src[0] == '/') {
+        strcpy(path, src);
+    } else if (fits) {
+        fits = snprintf(path, sizeof(path), "%s/%s", ctx->base_dir, src) < (int)sizeof(path);
+    }
+    if (!fits) {
+        mp_printf(&mp_plat_print, "[LVML] Script path too long: %.*s\n", (int)value.len, value.ptr);
+        if (ctx->result == LVML_OK) {
+            ctx->result = LVML_ERROR_INVALID_PARAM;
+        }
+        return true;
+    }
+
+    lvml_error_t result = lvml_script_run_file(path);
+    if (result != LVML_OK && ctx->result == LVML_OK) {
+        ctx->result = result;
+    }
+    return true;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file lvml_script.h
+ * @brief Run <micropython src="..."> scripts with a VFS bytecode cache
+ *
+ * Scripts are compiled once and stored as .mpy bytecode under
+ * LVML_SCRIPT_CACHE_DIR. A cache entry is valid when its key, a hash of
+ * the script source and the .mpy format version, matches the current
+ * source; otherwise the script is recompiled and the entry rewritten.
+ * Entries can be generated ahead of time with `make precompile-scripts`.
+ */
+
+#ifndef LVML_SCRIPT_H
+#define LVML_SCRIPT_H
+
+#include "core/lvml_core.h"
+#include "utils/lvml_bundle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_SCRIPT_CACHE_DIR "/cache/mpy"
+#define LVML_SCRIPT_PATH_MAX 128
+#define LVML_SCRIPT_STATS_MAX 16
+
+// Cache entry header: magic + little-endian key, followed by the .mpy data
+#define LVML_SCRIPT_CACHE_MAGIC "LVMC"
+#define LVML_SCRIPT_CACHE_HEADER_SIZE 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Load statistics of one script
+ */
+typedef struct {
+    char path[LVML_SCRIPT_PATH_MAX];
+    uint32_t hits;            // Loaded from cached bytecode
+    uint32_t misses;          // Compiled from source
+    uint32_t compile_us;      // Last load from source (read + parse + compile)
+    uint32_t load_us;         // Last load from cache (read + hash + load)
+    uint32_t source_bytes;
+    uint32_t mpy_bytes;
+} lvml_script_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Run a script file, using the bytecode cache when it is up to date.
+ * Exceptions raised by the script are printed.
+ * @param path absolute VFS path of the .py file
+ * @return LVML_OK on success, LVML_ERROR_INVALID_PARAM if the file can't be read,
+ *         LVML_ERROR_MP_EXEC if compiling or running the script failed
+ */
+lvml_error_t lvml_script_run_file(const char* path);
+
+/**
+ * Run a script from memory, using the bytecode cache when it is up to date
+ * @param path name the script is cached, reported and compiled under
+ * @param source script source
+ * @param len source length in bytes
+ * @return LVML_OK on success, LVML_ERROR_INVALID_PARAM for a bad path,
+ *         LVML_ERROR_MP_EXEC if compiling or running the script failed
+ */
+lvml_error_t lvml_script_run_source(const char* path, const char* source, size_t len);
+
+/**
+ * Run every <micropython src="..."> script referenced by an XML document
+ * @param xml_content XML content string
+ * @param base_dir directory relative src paths are resolved against
+ * @return LVML_OK if all scripts ran, otherwise the first error
+ */
+lvml_error_t lvml_script_run_xml(const char* xml_content, const char* base_dir);
+
+/**
+ * Run every <micropython src="..."> script referenced by an XML document,
+ * taking the scripts from a bundle
+ * @param xml_content XML content string
+ * @param bundle bundle holding the scripts under their src names
+ * @return LVML_OK if all scripts ran, otherwise the first error
+ */
+lvml_error_t lvml_script_run_xml_bundle(const char* xml_content, const lvml_bundle_t* bundle);
+
+/**
+ * Cache key of a script source
+ * @param source script source
+ * @param len source length in bytes
+ * @return key stored in the cache entry header
+ */
+uint32_t lvml_script_cache_key(const char* source, size_t len);
+
+/**
+ * Per-script load statistics
+ * @param index script index (in order of first load)
+ * @return statistics, or NULL if index is out of range
+ */
+const lvml_script_stats_t* lvml_script_get_stats(uint32_t index);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_SCRIPT_H*/
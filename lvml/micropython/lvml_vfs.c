@@ -0,0 +1,163 @@
+/**
+ * @file lvml_vfs.c
+ * @brief File access through the MicroPython VFS for LVML's C code
+ */
+
+#include "lvml_vfs.h"
+#include "utils/lvml_mem.h"
+#include "micropython/py/runtime.h"
+#include "micropython/py/builtin.h"
+#include "micropython/py/stream.h"
+#include "micropython/extmod/vfs.h"
+#include <stdio.h>
+#include <string.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static mp_obj_t vfs_open(const char* path, qstr mode);
+static bool vfs_close(mp_obj_t file);
+static bool vfs_fetch_load(const char* name, uint8_t** data, size_t* len);
+static bool vfs_fetch_save(const char* name, const uint8_t* data, size_t len);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lvml_fetch_store_t lvml_vfs_fetch_store = {
+    .load = vfs_fetch_load,
+    .save = vfs_fetch_save,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static bool vfs_fetch_dir_ready = false;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+mp_obj_t lvml_vfs_read(const char* path) {
+    mp_obj_t file = vfs_open(path, MP_QSTR_rb);
+    if (file == MP_OBJ_NULL) {
+        return MP_OBJ_NULL;
+    }
+
+    // The file is closed even if the read raises (e.g. MemoryError)
+    mp_obj_t data = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t dest[2];
+        mp_load_method(file, MP_QSTR_read, dest);
+        data = mp_call_method_n_kw(0, 0, dest);
+        nlr_pop();
+    }
+    vfs_close(file);
+    return data;
+}
+
+bool lvml_vfs_write(const char* path, const void* data, size_t len) {
+    mp_obj_t file = vfs_open(path, MP_QSTR_wb);
+    if (file == MP_OBJ_NULL) {
+        return false;
+    }
+
+    bool written = false;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_stream_write(file, data, len, MP_STREAM_RW_WRITE);
+        written = true;
+        nlr_pop();
+    }
+    // Closing flushes, so it can fail too
+    return vfs_close(file) && written;
+}
+
+void lvml_vfs_makedirs(const char* path) {
+    char dir[128];
+    size_t len = strlen(path);
+    if (len >= sizeof(dir)) {
+        return;
+    }
+
+    // mkdir raises if the directory exists, which is fine
+    for (size_t i = 1; i <= len; i++) {
+        if (path[i] != '/' && path[i] != '\0') {
+            continue;
+        }
+        memcpy(dir, path, i);
+        dir[i] = '\0';
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            mp_vfs_mkdir(mp_obj_new_str(dir, i));
+            nlr_pop();
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Open a file; MP_OBJ_NULL instead of raising
+ */
+static mp_obj_t vfs_open(const char* path, qstr mode) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t args[2] = { mp_obj_new_str(path, strlen(path)), MP_OBJ_NEW_QSTR(mode) };
+        mp_obj_t file = mp_builtin_open(2, args, (mp_map_t*)&mp_const_empty_map);
+        nlr_pop();
+        return file;
+    }
+    return MP_OBJ_NULL;
+}
+
+/**
+ * Close a file; false instead of raising
+ */
+static bool vfs_close(mp_obj_t file) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_stream_close(file);
+        nlr_pop();
+        return true;
+    }
+    return false;
+}
+
+static bool vfs_fetch_load(const char* name, uint8_t** data, size_t* len) {
+    char path[sizeof(LVML_VFS_FETCH_CACHE_DIR) + LVML_FETCH_NAME_MAX + 1];
+    snprintf(path, sizeof(path), "%s/%s", LVML_VFS_FETCH_CACHE_DIR, name);
+
+    mp_obj_t file_data = lvml_vfs_read(path);
+    if (file_data == MP_OBJ_NULL) {
+        return false;
+    }
+
+    // Copy out of the MicroPython heap; results may outlive a GC cycle
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(file_data, &bufinfo, MP_BUFFER_READ);
+    *data = (uint8_t*)lvml_mem_alloc_large(bufinfo.len + 1);
+    if (*data == NULL) {
+        return false;
+    }
+    memcpy(*data, bufinfo.buf, bufinfo.len);
+    (*data)[bufinfo.len] = '\0';
+    *len = bufinfo.len;
+    return true;
+}
+
+static bool vfs_fetch_save(const char* name, const uint8_t* data, size_t len) {
+    if (!vfs_fetch_dir_ready) {
+        lvml_vfs_makedirs(LVML_VFS_FETCH_CACHE_DIR);
+        vfs_fetch_dir_ready = true;
+    }
+
+    char path[sizeof(LVML_VFS_FETCH_CACHE_DIR) + LVML_FETCH_NAME_MAX + 1];
+    snprintf(path, sizeof(path), "%s/%s", LVML_VFS_FETCH_CACHE_DIR, name);
+    return lvml_vfs_write(path, data, len);
+}
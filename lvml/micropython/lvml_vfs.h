@@ -0,0 +1,59 @@
+/**
+ * @file lvml_vfs.h
+ * @brief File access through the MicroPython VFS for LVML's C code
+ *
+ * Must only be called from the MicroPython thread.
+ */
+
+#ifndef LVML_VFS_H
+#define LVML_VFS_H
+
+#include "micropython/py/obj.h"
+#include "network/lvml_fetch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_VFS_FETCH_CACHE_DIR "/cache/http"
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Read a whole file
+ * @param path file path
+ * @return bytes object, or MP_OBJ_NULL if the file can't be read
+ */
+mp_obj_t lvml_vfs_read(const char* path);
+
+/**
+ * Create or replace a file
+ * @param path file path
+ * @param data data to write
+ * @param len data length
+ * @return true on success
+ */
+bool lvml_vfs_write(const char* path, const void* data, size_t len);
+
+/**
+ * Create a directory and its parents; existing directories are fine
+ * @param path absolute directory path
+ */
+void lvml_vfs_makedirs(const char* path);
+
+/**
+ * Fetch cache store keeping entries in LVML_VFS_FETCH_CACHE_DIR
+ */
+extern const lvml_fetch_store_t lvml_vfs_fetch_store;
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_VFS_H*/
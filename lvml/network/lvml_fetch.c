@@ -0,0 +1,906 @@
+/**
+ * @file lvml_fetch.c
+ * @brief Cached HTTP fetcher with conditional requests and stale-while-revalidate
+ */
+
+#include "lvml_fetch.h"
+#include "lvml_http_client.h"
+#include "utils/lvml_hash.h"
+#include "utils/lvml_mem.h"
+#include "micropython/lib/uzlib/uzlib.h"
+#include <sys/stat.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#else
+#include <pthread.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define FETCH_INITIAL_CAP 4096
+#define FETCH_READ_CHUNK 1024
+#define FETCH_GZIP_IN_SIZE 512
+#define FETCH_TASK_STACK 6144
+#define FETCH_TASK_PRIORITY 1
+#define FETCH_PREFETCH_SHARE (LVML_FETCH_PREFETCH_BUDGET / LVML_FETCH_WORKERS)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    int status;
+    uint8_t* data;                       // NUL-terminated body (status 200 only)
+    size_t len;
+    size_t cap;
+    size_t limit;                        // Largest body accepted
+    uint32_t wire_bytes;
+    bool gzip;
+    char etag[LVML_HTTP_ETAG_MAX];
+    char last_modified[LVML_HTTP_DATE_MAX];
+} fetch_response_t;
+
+/**
+ * Connection and decoder state of one download, kept off the stack
+ */
+typedef struct {
+    lvml_http_conn_t conn;
+    uzlib_uncomp_t decomp;
+    uint8_t in[FETCH_GZIP_IN_SIZE];
+    size_t in_pos;
+    size_t in_len;
+} fetch_stream_t;
+
+typedef enum {
+    FETCH_JOB_FREE = 0,
+    FETCH_JOB_PENDING,
+    FETCH_JOB_RUNNING,
+    FETCH_JOB_DONE,
+} fetch_job_state_t;
+
+typedef enum {
+    FETCH_JOB_REVALIDATE = 0,
+    FETCH_JOB_PREFETCH,
+} fetch_job_kind_t;
+
+typedef struct {
+    fetch_job_state_t state;
+    fetch_job_kind_t kind;
+    char url[LVML_MAX_URL_LENGTH];
+    char ref[LVML_FETCH_REF_MAX];
+    size_t reserved;                     // Prefetch budget reserved while downloading
+    char etag[LVML_HTTP_ETAG_MAX];
+    char last_modified[LVML_HTTP_DATE_MAX];
+    size_t cached_len;
+    uint32_t cached_hash;
+    lvml_error_t result;
+    fetch_response_t resp;
+} fetch_job_t;
+
+/**
+ * Prefetched content waiting to be claimed by lvml_fetch_get()
+ */
+typedef struct {
+    char url[LVML_MAX_URL_LENGTH];
+    uint8_t* data;
+    size_t len;
+} fetch_mem_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lvml_error_t fetch_download(const char* url, const char* etag, const char* last_modified, size_t limit, fetch_response_t* resp);
+static lvml_error_t fetch_reserve(fetch_response_t* resp, size_t extra);
+static lvml_error_t fetch_read_identity(fetch_stream_t* s, fetch_response_t* resp);
+static lvml_error_t fetch_read_gzip(fetch_stream_t* s, fetch_response_t* resp);
+static int fetch_gzip_read_cb(void* data);
+static void fetch_entry_name(const char* url, const char* ext, char* name);
+static void fetch_load_meta(const char* url, char* etag, char* last_modified);
+static bool fetch_save_entry(const char* url, const fetch_response_t* resp, bool save_body);
+static void fetch_account(const fetch_response_t* resp);
+static bool fetch_queue_revalidation(const char* url, const uint8_t* data, size_t len);
+static bool fetch_queue_job(fetch_job_t* job, bool* duplicate);
+static fetch_job_t* fetch_take_job(void);
+static void fetch_finish_job(fetch_job_t* job);
+static void fetch_budget_release(size_t bytes);
+static void fetch_commit_revalidation(fetch_job_t* job, lvml_fetch_event_cb_t cb, void* user_data, uint32_t* updated);
+static void fetch_commit_prefetch(fetch_job_t* job, lvml_fetch_event_cb_t cb, void* user_data);
+static fetch_mem_entry_t* fetch_mem_find(const char* url);
+static void fetch_mem_remove(fetch_mem_entry_t* entry);
+static void fetch_worker_run(void);
+static bool fetch_worker_start(void);
+static void fetch_lock(void);
+static void fetch_unlock(void);
+static void fetch_worker_wake(void);
+static void fetch_worker_wait(void);
+static bool fetch_file_load(const char* name, uint8_t** data, size_t* len);
+static bool fetch_file_save(const char* name, const uint8_t* data, size_t len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const lvml_fetch_store_t fetch_file_store = {
+    .load = fetch_file_load,
+    .save = fetch_file_save,
+};
+
+static const lvml_fetch_store_t* fetch_store = &fetch_file_store;
+static lvml_fetch_stats_t fetch_stats;
+
+// Job queue shared with the workers, protected by fetch_lock()
+static fetch_job_t* fetch_jobs[LVML_FETCH_QUEUE_MAX];
+static size_t fetch_prefetch_used = 0;     // Reserved by running prefetches plus fetch_mem
+static bool fetch_worker_started = false;
+
+// Prefetched content, oldest first (main thread only)
+static fetch_mem_entry_t fetch_mem[LVML_FETCH_MEM_CACHE_MAX];
+static uint32_t fetch_mem_cnt = 0;
+static size_t fetch_mem_bytes = 0;
+
+#ifdef ESP_PLATFORM
+static SemaphoreHandle_t fetch_mutex = NULL;
+static SemaphoreHandle_t fetch_wake = NULL;
+#else
+static pthread_mutex_t fetch_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fetch_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t fetch_wake_pending = 0;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_fetch_set_store(const lvml_fetch_store_t* store) {
+    fetch_store = store != NULL ? store : &fetch_file_store;
+}
+
+lvml_error_t lvml_fetch_get(const char* url, bool revalidate, lvml_fetch_result_t* result) {
+    if (url == NULL || result == NULL || strlen(url) >= LVML_MAX_URL_LENGTH) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    memset(result, 0, sizeof(lvml_fetch_result_t));
+    fetch_stats.requests++;
+
+    // Prefetched and not claimed yet: hand the buffer over
+    fetch_mem_entry_t* entry = fetch_mem_find(url);
+    if (entry != NULL) {
+        fetch_stats.cache_hits++;
+        fetch_stats.prefetch_hits++;
+        result->data = entry->data;
+        result->len = entry->len;
+        result->from_cache = true;
+        result->prefetched = true;
+        entry->data = NULL;
+        fetch_mem_remove(entry);
+        fetch_budget_release(result->len);
+        return LVML_OK;
+    }
+
+    // Stale-while-revalidate: answer from the cache right away
+    char name[LVML_FETCH_NAME_MAX];
+    fetch_entry_name(url, "body", name);
+    uint8_t* data;
+    size_t len;
+    if (fetch_store->load(name, &data, &len)) {
+        fetch_stats.cache_hits++;
+        result->data = data;
+        result->len = len;
+        result->from_cache = true;
+        if (revalidate) {
+            result->revalidating = fetch_queue_revalidation(url, data, len);
+        }
+        return LVML_OK;
+    }
+
+    fetch_stats.cache_misses++;
+    fetch_response_t resp;
+    lvml_error_t res = fetch_download(url, NULL, NULL, LVML_MAX_XML_SIZE, &resp);
+    if (res == LVML_OK && resp.status != 200) {
+        lvml_mem_free_large(resp.data);
+        res = LVML_ERROR_NETWORK;
+    }
+    if (res != LVML_OK) {
+        fetch_stats.errors++;
+        return res;
+    }
+
+    fetch_account(&resp);
+    fetch_save_entry(url, &resp, true);
+    result->data = resp.data;
+    result->len = resp.len;
+    return LVML_OK;
+}
+
+bool lvml_fetch_prefetch(const char* url, const char* ref) {
+    if (url == NULL || strlen(url) >= LVML_MAX_URL_LENGTH || strncmp(url, "http://", 7) != 0) {
+        return false;
+    }
+    if (fetch_mem_find(url) != NULL) {
+        return false;
+    }
+
+    // Anything with cache metadata is already on flash
+    char name[LVML_FETCH_NAME_MAX];
+    fetch_entry_name(url, "meta", name);
+    uint8_t* meta;
+    size_t meta_len;
+    if (fetch_store->load(name, &meta, &meta_len)) {
+        lvml_mem_free_large(meta);
+        return false;
+    }
+
+    fetch_job_t* job = (fetch_job_t*)lvml_mem_alloc_large(sizeof(fetch_job_t));
+    if (job == NULL) {
+        return false;
+    }
+    memset(job, 0, sizeof(fetch_job_t));
+    job->kind = FETCH_JOB_PREFETCH;
+    strcpy(job->url, url);
+    if (ref != NULL && strlen(ref) < LVML_FETCH_REF_MAX) {
+        strcpy(job->ref, ref);
+    }
+
+    bool duplicate;
+    if (!fetch_queue_job(job, &duplicate)) {
+        return false;
+    }
+    fetch_stats.prefetch_queued++;
+    return true;
+}
+
+void lvml_fetch_free(lvml_fetch_result_t* result) {
+    if (result != NULL) {
+        lvml_mem_free_large(result->data);
+        result->data = NULL;
+        result->len = 0;
+    }
+}
+
+uint32_t lvml_fetch_poll(lvml_fetch_event_cb_t cb, void* user_data) {
+    if (!fetch_worker_started) {
+        return 0;
+    }
+
+    uint32_t updated = 0;
+    for (uint32_t i = 0; i < LVML_FETCH_QUEUE_MAX; i++) {
+        fetch_lock();
+        fetch_job_t* job = fetch_jobs[i];
+        bool done = job != NULL && job->state == FETCH_JOB_DONE;
+        if (done) {
+            fetch_jobs[i] = NULL;
+        }
+        fetch_unlock();
+        if (!done) {
+            continue;
+        }
+
+        if (job->kind == FETCH_JOB_PREFETCH) {
+            fetch_commit_prefetch(job, cb, user_data);
+        } else {
+            fetch_commit_revalidation(job, cb, user_data, &updated);
+        }
+
+        lvml_mem_free_large(job->resp.data);
+        lvml_mem_free_large(job);
+    }
+
+    return updated;
+}
+
+void lvml_fetch_get_stats(lvml_fetch_stats_t* stats) {
+    if (stats != NULL) {
+        fetch_stats.prefetch_bytes = (uint32_t)fetch_mem_bytes;
+        *stats = fetch_stats;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Blocking GET; safe to call from the worker (doesn't touch the store)
+ */
+static lvml_error_t fetch_download(const char* url, const char* etag, const char* last_modified, size_t limit, fetch_response_t* resp) {
+    memset(resp, 0, sizeof(fetch_response_t));
+    resp->limit = limit;
+
+    fetch_stream_t* s = (fetch_stream_t*)lvml_mem_alloc_large(sizeof(fetch_stream_t));
+    if (s == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+
+    lvml_error_t res = lvml_http_open(&s->conn, url, etag, last_modified);
+    if (res == LVML_OK) {
+        resp->status = s->conn.status;
+        resp->gzip = s->conn.gzip;
+        if (resp->status == 200) {
+            strcpy(resp->etag, s->conn.etag);
+            strcpy(resp->last_modified, s->conn.last_modified);
+            res = s->conn.gzip ? fetch_read_gzip(s, resp) : fetch_read_identity(s, resp);
+        }
+        resp->wire_bytes = s->conn.body_bytes;
+        lvml_http_close(&s->conn);
+    }
+    lvml_mem_free_large(s);
+
+    if (res != LVML_OK) {
+        lvml_mem_free_large(resp->data);
+        resp->data = NULL;
+        resp->len = 0;
+    }
+    return res;
+}
+
+/**
+ * Make room for extra bytes plus the terminating NUL. One byte past the
+ * limit can be read so that an oversized body is noticed.
+ */
+static lvml_error_t fetch_reserve(fetch_response_t* resp, size_t extra) {
+    if (resp->len > resp->limit) {
+        return LVML_ERROR_MEMORY;
+    }
+    size_t room = resp->limit + 1 - resp->len;
+    if (extra > room) {
+        extra = room;
+    }
+
+    size_t needed = resp->len + extra + 1;
+    if (needed <= resp->cap) {
+        return LVML_OK;
+    }
+
+    size_t cap = resp->cap > 0 ? resp->cap : FETCH_INITIAL_CAP;
+    while (cap < needed) {
+        cap *= 2;
+    }
+    if (cap > resp->limit + 2) {
+        cap = resp->limit + 2;
+    }
+
+    uint8_t* data = (uint8_t*)lvml_mem_realloc_large(resp->data, cap);
+    if (data == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+    resp->data = data;
+    resp->cap = cap;
+    return LVML_OK;
+}
+
+static lvml_error_t fetch_read_identity(fetch_stream_t* s, fetch_response_t* resp) {
+    // Size the buffer up front when the length is known
+    size_t first = s->conn.content_length > 0 ? (size_t)s->conn.content_length : FETCH_READ_CHUNK;
+    lvml_error_t res = fetch_reserve(resp, first);
+
+    while (res == LVML_OK) {
+        int n = lvml_http_read(&s->conn, resp->data + resp->len, resp->cap - resp->len - 1);
+        if (n < 0) {
+            res = LVML_ERROR_NETWORK;
+        } else if (n == 0) {
+            break;
+        } else {
+            resp->len += n;
+            res = fetch_reserve(resp, FETCH_READ_CHUNK);
+        }
+    }
+
+    if (res == LVML_OK && resp->len > resp->limit) {
+        res = LVML_ERROR_MEMORY;
+    }
+    if (res == LVML_OK) {
+        resp->data[resp->len] = '\0';
+    }
+    return res;
+}
+
+/**
+ * Inflate the body while it arrives; only the 32KB window and the
+ * decoded output are kept, never the compressed body
+ */
+static lvml_error_t fetch_read_gzip(fetch_stream_t* s, fetch_response_t* resp) {
+    uzlib_uncomp_t* d = &s->decomp;
+    uzlib_uncompress_init(d, NULL, 0);
+    d->source = NULL;
+    d->source_limit = NULL;
+    d->source_read_cb = fetch_gzip_read_cb;
+    d->source_read_data = s;
+    s->in_pos = 0;
+    s->in_len = 0;
+
+    int wbits;
+    if (uzlib_parse_zlib_gzip_header(d, &wbits) != UZLIB_HEADER_GZIP) {
+        return LVML_ERROR_NETWORK;
+    }
+
+    size_t window_size = (size_t)1 << wbits;
+    uint8_t* window = (uint8_t*)lvml_mem_alloc_large(window_size);
+    if (window == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+    uzlib_uncompress_init(d, window, window_size);
+
+    lvml_error_t res;
+    for (;;) {
+        res = fetch_reserve(resp, FETCH_READ_CHUNK);
+        if (res != LVML_OK) {
+            break;
+        }
+        d->dest = resp->data + resp->len;
+        d->dest_limit = resp->data + resp->cap - 1;
+        int st = uzlib_uncompress_chksum(d);
+        resp->len = d->dest - resp->data;
+        if (st == UZLIB_DONE) {
+            break;
+        }
+        if (st < 0) {
+            res = LVML_ERROR_NETWORK;
+            break;
+        }
+    }
+
+    lvml_mem_free_large(window);
+    if (res == LVML_OK && resp->len > resp->limit) {
+        res = LVML_ERROR_MEMORY;
+    }
+    if (res == LVML_OK) {
+        resp->data[resp->len] = '\0';
+    }
+    return res;
+}
+
+static int fetch_gzip_read_cb(void* data) {
+    fetch_stream_t* s = (fetch_stream_t*)data;
+    if (s->in_pos == s->in_len) {
+        int n = lvml_http_read(&s->conn, s->in, sizeof(s->in));
+        if (n <= 0) {
+            return -1;
+        }
+        s->in_pos = 0;
+        s->in_len = n;
+    }
+    return s->in[s->in_pos++];
+}
+
+static void fetch_entry_name(const char* url, const char* ext, char* name) {
+    snprintf(name, LVML_FETCH_NAME_MAX, "%08lx.%s",
+             (unsigned long)lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, url, strlen(url)), ext);
+}
+
+/**
+ * Metadata entries hold the ETag and Last-Modified lines
+ */
+static void fetch_load_meta(const char* url, char* etag, char* last_modified) {
+    etag[0] = '\0';
+    last_modified[0] = '\0';
+
+    char name[LVML_FETCH_NAME_MAX];
+    fetch_entry_name(url, "meta", name);
+    uint8_t* data;
+    size_t len;
+    if (!fetch_store->load(name, &data, &len)) {
+        return;
+    }
+
+    char* line = (char*)data;
+    char* nl = strchr(line, '\n');
+    if (nl != NULL) {
+        *nl = '\0';
+        if (strlen(line) < LVML_HTTP_ETAG_MAX) {
+            strcpy(etag, line);
+        }
+        line = nl + 1;
+        nl = strchr(line, '\n');
+        if (nl != NULL) {
+            *nl = '\0';
+            if (strlen(line) < LVML_HTTP_DATE_MAX) {
+                strcpy(last_modified, line);
+            }
+        }
+    }
+    lvml_mem_free_large(data);
+}
+
+/**
+ * The body is written before the metadata: if the metadata write is lost,
+ * the next revalidation sends the old validators and simply gets a 200
+ */
+static bool fetch_save_entry(const char* url, const fetch_response_t* resp, bool save_body) {
+    char name[LVML_FETCH_NAME_MAX];
+    if (save_body) {
+        fetch_entry_name(url, "body", name);
+        if (!fetch_store->save(name, resp->data, resp->len)) {
+            return false;
+        }
+    }
+
+    char meta[LVML_HTTP_ETAG_MAX + LVML_HTTP_DATE_MAX + 2];
+    int len = snprintf(meta, sizeof(meta), "%s\n%s\n", resp->etag, resp->last_modified);
+    fetch_entry_name(url, "meta", name);
+    return fetch_store->save(name, (const uint8_t*)meta, len);
+}
+
+static void fetch_account(const fetch_response_t* resp) {
+    fetch_stats.bytes_received += resp->wire_bytes;
+    fetch_stats.bytes_decoded += resp->len;
+    if (resp->gzip && resp->len > resp->wire_bytes) {
+        fetch_stats.bytes_saved += resp->len - resp->wire_bytes;
+    }
+}
+
+static bool fetch_queue_revalidation(const char* url, const uint8_t* data, size_t len) {
+    fetch_job_t* job = (fetch_job_t*)lvml_mem_alloc_large(sizeof(fetch_job_t));
+    if (job == NULL) {
+        return false;
+    }
+    memset(job, 0, sizeof(fetch_job_t));
+    job->kind = FETCH_JOB_REVALIDATE;
+    strcpy(job->url, url);
+    fetch_load_meta(url, job->etag, job->last_modified);
+    job->cached_len = len;
+    job->cached_hash = lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, data, len);
+
+    // A revalidation already on its way counts as queued
+    bool duplicate;
+    return fetch_queue_job(job, &duplicate) || duplicate;
+}
+
+/**
+ * Hand a job to the workers; the job is freed if it can't be queued
+ */
+static bool fetch_queue_job(fetch_job_t* job, bool* duplicate) {
+    *duplicate = false;
+    if (!fetch_worker_start()) {
+        lvml_mem_free_large(job);
+        return false;
+    }
+    job->state = FETCH_JOB_PENDING;
+
+    bool queued = false;
+    fetch_lock();
+    for (uint32_t i = 0; i < LVML_FETCH_QUEUE_MAX; i++) {
+        if (fetch_jobs[i] != NULL && fetch_jobs[i]->state != FETCH_JOB_DONE && strcmp(fetch_jobs[i]->url, job->url) == 0) {
+            *duplicate = true;
+        }
+    }
+    for (uint32_t i = 0; i < LVML_FETCH_QUEUE_MAX && !*duplicate; i++) {
+        if (fetch_jobs[i] == NULL) {
+            fetch_jobs[i] = job;
+            queued = true;
+            break;
+        }
+    }
+    fetch_unlock();
+
+    if (!queued) {
+        lvml_mem_free_large(job);
+        return false;
+    }
+    fetch_worker_wake();
+    return true;
+}
+
+/**
+ * Pick the next pending job, revalidations first. Prefetches reserve their
+ * share of the budget here; one that can never fit is finished unrun.
+ */
+static fetch_job_t* fetch_take_job(void) {
+    fetch_job_t* job;
+    fetch_lock();
+    for (;;) {
+        job = NULL;
+        bool prefetching = false;
+        for (uint32_t i = 0; i < LVML_FETCH_QUEUE_MAX; i++) {
+            fetch_job_t* candidate = fetch_jobs[i];
+            if (candidate == NULL) {
+                continue;
+            }
+            if (candidate->kind == FETCH_JOB_PREFETCH && candidate->state == FETCH_JOB_RUNNING) {
+                prefetching = true;
+            }
+            if (candidate->state != FETCH_JOB_PENDING || (job != NULL && job->kind == FETCH_JOB_REVALIDATE)) {
+                continue;
+            }
+            if (job == NULL || candidate->kind == FETCH_JOB_REVALIDATE) {
+                job = candidate;
+            }
+        }
+        if (job == NULL || job->kind == FETCH_JOB_REVALIDATE) {
+            break;
+        }
+
+        // Each download may use its share of the budget
+        size_t room = LVML_FETCH_PREFETCH_BUDGET - fetch_prefetch_used;
+        if (room > FETCH_PREFETCH_SHARE) {
+            room = FETCH_PREFETCH_SHARE;
+        }
+        if (room > 0) {
+            job->reserved = room;
+            fetch_prefetch_used += room;
+            break;
+        }
+        // Running prefetches will return part of the budget; wait for them
+        if (prefetching) {
+            job = NULL;
+            break;
+        }
+        job->result = LVML_ERROR_MEMORY;
+        job->state = FETCH_JOB_DONE;
+    }
+
+    if (job != NULL) {
+        job->state = FETCH_JOB_RUNNING;
+    }
+    fetch_unlock();
+    return job;
+}
+
+/**
+ * Keep only what a finished prefetch actually holds of its reservation
+ */
+static void fetch_finish_job(fetch_job_t* job) {
+    fetch_lock();
+    if (job->kind == FETCH_JOB_PREFETCH) {
+        size_t used = job->result == LVML_OK && job->resp.status == 200 ? job->resp.len : 0;
+        fetch_prefetch_used = fetch_prefetch_used - job->reserved + used;
+        job->reserved = used;
+    }
+    job->state = FETCH_JOB_DONE;
+    fetch_unlock();
+}
+
+static void fetch_budget_release(size_t bytes) {
+    fetch_lock();
+    fetch_prefetch_used -= bytes;
+    fetch_unlock();
+}
+
+static void fetch_commit_revalidation(fetch_job_t* job, lvml_fetch_event_cb_t cb, void* user_data, uint32_t* updated) {
+    fetch_stats.revalidations++;
+    if (job->result != LVML_OK) {
+        fetch_stats.errors++;
+    } else if (job->resp.status == 304) {
+        fetch_stats.not_modified++;
+        fetch_stats.bytes_saved += job->cached_len;
+    } else if (job->resp.status == 200) {
+        fetch_account(&job->resp);
+        bool changed = job->resp.len != job->cached_len ||
+                       lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, job->resp.data, job->resp.len) != job->cached_hash;
+        if (fetch_save_entry(job->url, &job->resp, changed) && changed) {
+            fetch_stats.updated++;
+            (*updated)++;
+            if (cb != NULL) {
+                cb(LVML_FETCH_UPDATED, job->url, "", job->resp.data, job->resp.len, user_data);
+            }
+        }
+    } else {
+        fetch_stats.errors++;
+    }
+}
+
+/**
+ * Store a finished prefetch and keep it in memory unless the callback
+ * consumed it; the oldest unclaimed entry makes room for a new one
+ */
+static void fetch_commit_prefetch(fetch_job_t* job, lvml_fetch_event_cb_t cb, void* user_data) {
+    if (job->result != LVML_OK || job->resp.status != 200) {
+        fetch_stats.prefetch_dropped++;
+        fetch_budget_release(job->reserved);
+        return;
+    }
+
+    fetch_stats.prefetch_done++;
+    fetch_account(&job->resp);
+    fetch_save_entry(job->url, &job->resp, true);
+
+    bool consumed = false;
+    if (cb != NULL) {
+        consumed = cb(LVML_FETCH_PREFETCHED, job->url, job->ref, job->resp.data, job->resp.len, user_data);
+    }
+    if (consumed) {
+        fetch_budget_release(job->reserved);
+        return;
+    }
+
+    if (fetch_mem_cnt == LVML_FETCH_MEM_CACHE_MAX) {
+        fetch_mem_entry_t* oldest = &fetch_mem[0];
+        size_t oldest_len = oldest->len;
+        lvml_mem_free_large(oldest->data);
+        fetch_mem_remove(oldest);
+        fetch_budget_release(oldest_len);
+        fetch_stats.prefetch_dropped++;
+    }
+
+    fetch_mem_entry_t* entry = &fetch_mem[fetch_mem_cnt++];
+    strcpy(entry->url, job->url);
+    entry->data = job->resp.data;
+    entry->len = job->resp.len;
+    fetch_mem_bytes += entry->len;
+    job->resp.data = NULL;
+}
+
+static fetch_mem_entry_t* fetch_mem_find(const char* url) {
+    for (uint32_t i = 0; i < fetch_mem_cnt; i++) {
+        if (strcmp(fetch_mem[i].url, url) == 0) {
+            return &fetch_mem[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Drop an entry from the table; the caller owns (or has freed) its data
+ */
+static void fetch_mem_remove(fetch_mem_entry_t* entry) {
+    uint32_t index = entry - fetch_mem;
+    fetch_mem_bytes -= entry->len;
+    memmove(&fetch_mem[index], &fetch_mem[index + 1], (fetch_mem_cnt - index - 1) * sizeof(fetch_mem_entry_t));
+    fetch_mem_cnt--;
+}
+
+static void fetch_worker_run(void) {
+    for (;;) {
+        fetch_worker_wait();
+
+        fetch_job_t* job;
+        while ((job = fetch_take_job()) != NULL) {
+            size_t limit = job->kind == FETCH_JOB_PREFETCH ? job->reserved : LVML_MAX_XML_SIZE;
+            job->result = fetch_download(job->url, job->etag, job->last_modified, limit, &job->resp);
+            fetch_finish_job(job);
+        }
+    }
+}
+
+#ifdef ESP_PLATFORM
+
+static void fetch_task_entry(void* arg) {
+    (void)arg;
+    fetch_worker_run();
+}
+
+/**
+ * Workers run just above idle so downloads never delay rendering or input
+ */
+static bool fetch_worker_start(void) {
+    if (fetch_worker_started) {
+        return true;
+    }
+    fetch_mutex = xSemaphoreCreateMutex();
+    fetch_wake = xSemaphoreCreateCounting(LVML_FETCH_QUEUE_MAX, 0);
+    if (fetch_mutex == NULL || fetch_wake == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < LVML_FETCH_WORKERS; i++) {
+        if (xTaskCreate(fetch_task_entry, "lvml_fetch", FETCH_TASK_STACK, NULL, tskIDLE_PRIORITY + FETCH_TASK_PRIORITY, NULL) != pdPASS) {
+            // Tasks can't be torn down safely here; keep whatever started
+            if (i == 0) {
+                return false;
+            }
+            break;
+        }
+    }
+    fetch_worker_started = true;
+    return true;
+}
+
+static void fetch_lock(void) {
+    xSemaphoreTake(fetch_mutex, portMAX_DELAY);
+}
+
+static void fetch_unlock(void) {
+    xSemaphoreGive(fetch_mutex);
+}
+
+static void fetch_worker_wake(void) {
+    xSemaphoreGive(fetch_wake);
+}
+
+static void fetch_worker_wait(void) {
+    xSemaphoreTake(fetch_wake, portMAX_DELAY);
+}
+
+#else
+
+static void* fetch_thread_entry(void* arg) {
+    (void)arg;
+    fetch_worker_run();
+    return NULL;
+}
+
+/**
+ * Thread priorities need privileges on Linux, so workers use the default
+ */
+static bool fetch_worker_start(void) {
+    if (fetch_worker_started) {
+        return true;
+    }
+    for (uint32_t i = 0; i < LVML_FETCH_WORKERS; i++) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, fetch_thread_entry, NULL) != 0) {
+            if (i == 0) {
+                return false;
+            }
+            break;
+        }
+        pthread_detach(thread);
+    }
+    fetch_worker_started = true;
+    return true;
+}
+
+static void fetch_lock(void) {
+    pthread_mutex_lock(&fetch_mutex);
+}
+
+static void fetch_unlock(void) {
+    pthread_mutex_unlock(&fetch_mutex);
+}
+
+static void fetch_worker_wake(void) {
+    pthread_mutex_lock(&fetch_mutex);
+    fetch_wake_pending++;
+    pthread_cond_signal(&fetch_cond);
+    pthread_mutex_unlock(&fetch_mutex);
+}
+
+static void fetch_worker_wait(void) {
+    pthread_mutex_lock(&fetch_mutex);
+    while (fetch_wake_pending == 0) {
+        pthread_cond_wait(&fetch_cond, &fetch_mutex);
+    }
+    fetch_wake_pending--;
+    pthread_mutex_unlock(&fetch_mutex);
+}
+
+#endif
+
+static bool fetch_file_load(const char* name, uint8_t** data, size_t* len) {
+    char path[sizeof(LVML_FETCH_HOST_CACHE_DIR) + LVML_FETCH_NAME_MAX + 1];
+    snprintf(path, sizeof(path), "%s/%s", LVML_FETCH_HOST_CACHE_DIR, name);
+
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+
+    bool ok = false;
+    long size = -1;
+    if (fseek(f, 0, SEEK_END) == 0) {
+        size = ftell(f);
+    }
+    if (size >= 0 && size <= LVML_MAX_XML_SIZE && fseek(f, 0, SEEK_SET) == 0) {
+        *data = (uint8_t*)lvml_mem_alloc_large(size + 1);
+        if (*data != NULL && fread(*data, 1, size, f) == (size_t)size) {
+            (*data)[size] = '\0';
+            *len = size;
+            ok = true;
+        } else {
+            lvml_mem_free_large(*data);
+        }
+    }
+
+    fclose(f);
+    return ok;
+}
+
+static bool fetch_file_save(const char* name, const uint8_t* data, size_t len) {
+    char path[sizeof(LVML_FETCH_HOST_CACHE_DIR) + LVML_FETCH_NAME_MAX + 1];
+    snprintf(path, sizeof(path), "%s/%s", LVML_FETCH_HOST_CACHE_DIR, name);
+
+    mkdir(LVML_FETCH_HOST_CACHE_DIR, 0755);
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+    bool ok = fwrite(data, 1, len, f) == len;
+    return fclose(f) == 0 && ok;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file lvml_fetch.h
+ * @brief Cached HTTP fetcher with conditional requests and stale-while-revalidate
+ *
+ * Responses are kept in a cache store together with their ETag and
+ * Last-Modified validators. A cached entry is returned immediately and,
+ * if requested, revalidated by a background worker with a conditional GET.
+ * New content is written to the cache and reported by lvml_fetch_poll(),
+ * which must be called from the thread that owns the store (the MicroPython
+ * thread on the device). gzip responses are decompressed while they stream
+ * in, straight into the result buffer.
+ *
+ * URLs can also be prefetched. Prefetches run on the same low-priority
+ * workers after pending revalidations, and their results are kept in a
+ * small in-memory cache bounded by LVML_FETCH_PREFETCH_BUDGET until
+ * lvml_fetch_get() claims them.
+ */
+
+#ifndef LVML_FETCH_H
+#define LVML_FETCH_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_FETCH_QUEUE_MAX 16
+#define LVML_FETCH_WORKERS 2                       // Concurrent background downloads
+#define LVML_FETCH_NAME_MAX 16
+#define LVML_FETCH_REF_MAX 128
+#define LVML_FETCH_MEM_CACHE_MAX 8
+#define LVML_FETCH_PREFETCH_BUDGET (256 * 1024)    // Prefetched bytes held in memory
+
+// Directory used by the default (stdio) store
+#define LVML_FETCH_HOST_CACHE_DIR "lvml_cache"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Cache storage. Entries are addressed by short file names such as
+ * "1a2b3c4d.body"; the store decides where they live.
+ */
+typedef struct {
+    /**
+     * Read an entry
+     * @param name entry name
+     * @param data receives a NUL-terminated buffer from lvml_mem_alloc_large()
+     * @param len receives the entry size (without the NUL)
+     * @return false if the entry doesn't exist or can't be read
+     */
+    bool (*load)(const char* name, uint8_t** data, size_t* len);
+
+    /**
+     * Write an entry, replacing an existing one
+     * @return false on failure
+     */
+    bool (*save)(const char* name, const uint8_t* data, size_t len);
+} lvml_fetch_store_t;
+
+/**
+ * Result of lvml_fetch_get()
+ */
+typedef struct {
+    uint8_t* data;          // NUL-terminated body, release with lvml_fetch_free()
+    size_t len;
+    bool from_cache;        // Served from the cache without waiting for the network
+    bool prefetched;        // Served from the prefetch memory cache
+    bool revalidating;      // A background conditional request was queued
+} lvml_fetch_result_t;
+
+/**
+ * Background results reported by lvml_fetch_poll()
+ */
+typedef enum {
+    LVML_FETCH_UPDATED = 0, // Revalidation returned new content
+    LVML_FETCH_PREFETCHED,  // Prefetch finished
+} lvml_fetch_event_t;
+
+/**
+ * Fetch statistics
+ */
+typedef struct {
+    uint32_t requests;      // lvml_fetch_get() calls
+    uint32_t cache_hits;    // Served from the cache
+    uint32_t cache_misses;  // Downloaded in the foreground
+    uint32_t revalidations; // Background conditional requests completed
+    uint32_t not_modified;  // ... answered with 304
+    uint32_t updated;       // ... answered with new content
+    uint32_t errors;
+    uint32_t prefetch_queued;
+    uint32_t prefetch_done;
+    uint32_t prefetch_hits;  // Served from prefetched memory
+    uint32_t prefetch_dropped; // Over budget, failed or evicted unused
+    uint32_t prefetch_bytes; // Prefetched bytes held in memory
+    uint32_t bytes_received; // Body bytes on the wire
+    uint32_t bytes_decoded;  // Body bytes after decompression
+    uint32_t bytes_saved;    // Not transferred thanks to 304s and gzip
+} lvml_fetch_stats_t;
+
+/**
+ * Called by lvml_fetch_poll() for finished background work
+ * @param event what finished
+ * @param url fetched URL
+ * @param ref reference passed to lvml_fetch_prefetch() ("" for updates)
+ * @param data NUL-terminated content (only valid during the call)
+ * @param len content length
+ * @param user_data user pointer passed to lvml_fetch_poll()
+ * @return for LVML_FETCH_PREFETCHED: true if the content was consumed and
+ *         doesn't need to stay in the memory cache
+ */
+typedef bool (*lvml_fetch_event_cb_t)(lvml_fetch_event_t event, const char* url, const char* ref,
+                                      const uint8_t* data, size_t len, void* user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Replace the cache store (default: files below LVML_FETCH_HOST_CACHE_DIR)
+ * @param store store to use, NULL for the default one
+ */
+void lvml_fetch_set_store(const lvml_fetch_store_t* store);
+
+/**
+ * Get a URL, from the cache if possible
+ * @param url http:// URL
+ * @param revalidate queue a background conditional request when served from the cache
+ * @param result receives the content
+ * @return LVML_OK on success, LVML_ERROR_NETWORK if the URL is not cached and
+ *         can't be downloaded, LVML_ERROR_MEMORY, LVML_ERROR_INVALID_PARAM
+ */
+lvml_error_t lvml_fetch_get(const char* url, bool revalidate, lvml_fetch_result_t* result);
+
+/**
+ * Download a URL in the background so a later lvml_fetch_get() doesn't wait.
+ * URLs that are already cached, queued or in memory are skipped.
+ * @param url http:// URL
+ * @param ref reference the URL was resolved from (e.g. an image src), may be NULL
+ * @return true if a download was queued
+ */
+bool lvml_fetch_prefetch(const char* url, const char* ref);
+
+/**
+ * Release a result
+ * @param result result from lvml_fetch_get()
+ */
+void lvml_fetch_free(lvml_fetch_result_t* result);
+
+/**
+ * Commit finished background revalidations and prefetches to the cache
+ * @param cb called for new content and finished prefetches (may be NULL)
+ * @param user_data user pointer for cb
+ * @return number of URLs with new content
+ */
+uint32_t lvml_fetch_poll(lvml_fetch_event_cb_t cb, void* user_data);
+
+/**
+ * Get fetch statistics
+ * @param stats output statistics
+ */
+void lvml_fetch_get_stats(lvml_fetch_stats_t* stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_FETCH_H*/
@@ -0,0 +1,507 @@
+/**
+ * @file lvml_http_client.c
+ * @brief Minimal streaming HTTP/1.1 GET client over BSD sockets
+ */
+
+#include "lvml_http_client.h"
+#include "utils/lvml_time.h"
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if LVML_HTTP_TLS
+#include "esp_tls.h"
+#include "esp_crt_bundle.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define HTTP_LINE_MAX 256
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lvml_error_t http_parse_url(const char* url, char* host, uint16_t* port, bool* https, const char** path);
+static lvml_error_t http_exchange(lvml_http_conn_t* conn, const char* url, const char* etag, const char* last_modified, bool gzip, bool keep_alive);
+static bool http_read_headers(lvml_http_conn_t* conn, bool keep_alive);
+static bool http_connect(lvml_http_conn_t* conn);
+static int http_connect_socket(const char* host, uint16_t port, uint32_t* dns_us);
+static bool http_send_all(lvml_http_conn_t* conn, const char* data, size_t len);
+static int http_io_send(lvml_http_conn_t* conn, const char* data, size_t len);
+static int http_io_recv(lvml_http_conn_t* conn, uint8_t* buf, size_t len);
+static int http_recv(lvml_http_conn_t* conn, uint8_t* buf, size_t len);
+static bool http_read_line(lvml_http_conn_t* conn, char* line, size_t size);
+static bool http_header_is(const char* line, const char* name, const char** value);
+static void http_copy_value(char* dst, size_t size, const char* value);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_http_open(lvml_http_conn_t* conn, const char* url, const char* etag, const char* last_modified) {
+    if (conn == NULL || url == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    lvml_http_init(conn);
+    return http_exchange(conn, url, etag, last_modified, true, false);
+}
+
+void lvml_http_init(lvml_http_conn_t* conn) {
+    memset(conn, 0, sizeof(lvml_http_conn_t));
+    conn->sock = -1;
+    conn->content_length = -1;
+}
+
+lvml_error_t lvml_http_request(lvml_http_conn_t* conn, const char* url, const char* etag, const char* last_modified, bool gzip) {
+    if (conn == NULL || url == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    return http_exchange(conn, url, etag, last_modified, gzip, true);
+}
+
+int lvml_http_read(lvml_http_conn_t* conn, uint8_t* buf, size_t len) {
+    if (conn == NULL || conn->sock < 0) {
+        return -1;
+    }
+    if (conn->body_done || len == 0) {
+        return 0;
+    }
+
+    if (conn->chunked) {
+        if (conn->chunk_left == 0) {
+            char line[32];
+            // Every chunk but the first is preceded by the previous chunk's CRLF
+            if (conn->chunk_started && !http_read_line(conn, line, sizeof(line))) {
+                return -1;
+            }
+            if (!http_read_line(conn, line, sizeof(line))) {
+                return -1;
+            }
+            conn->chunk_started = true;
+            conn->chunk_left = strtoul(line, NULL, 16);
+            if (conn->chunk_left == 0) {
+                // Trailers are not used, but are read up to the empty line
+                // so that the connection can carry another request
+                do {
+                    if (!http_read_line(conn, line, sizeof(line))) {
+                        return -1;
+                    }
+                } while (line[0] != '\0');
+                conn->body_done = true;
+                return 0;
+            }
+        }
+        if (len > conn->chunk_left) {
+            len = conn->chunk_left;
+        }
+    } else if (conn->content_length >= 0) {
+        uint32_t left = (uint32_t)conn->content_length - conn->body_bytes;
+        if (left == 0) {
+            conn->body_done = true;
+            return 0;
+        }
+        if (len > left) {
+            len = left;
+        }
+    }
+
+    int n = http_recv(conn, buf, len);
+    if (n < 0) {
+        return -1;
+    }
+    if (n == 0) {
+        // Closing the connection only ends a body of unknown length
+        if (conn->chunked || conn->content_length >= 0) {
+            return -1;
+        }
+        conn->body_done = true;
+        return 0;
+    }
+
+    conn->body_bytes += n;
+    if (conn->chunked) {
+        conn->chunk_left -= n;
+    } else if (conn->content_length >= 0 && conn->body_bytes == (uint32_t)conn->content_length) {
+        conn->body_done = true;
+    }
+    return n;
+}
+
+void lvml_http_close(lvml_http_conn_t* conn) {
+    if (conn == NULL || conn->sock < 0) {
+        return;
+    }
+#if LVML_HTTP_TLS
+    if (conn->tls != NULL) {
+        // Also closes the socket
+        esp_tls_conn_destroy((esp_tls_t*)conn->tls);
+        conn->tls = NULL;
+        conn->sock = -1;
+        return;
+    }
+#endif
+    close(conn->sock);
+    conn->sock = -1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lvml_error_t http_parse_url(const char* url, char* host, uint16_t* port, bool* https, const char** path) {
+    const char* start;
+    if (strncmp(url, "http://", 7) == 0) {
+        start = url + 7;
+        *https = false;
+    } else if (LVML_HTTP_TLS && strncmp(url, "https://", 8) == 0) {
+        start = url + 8;
+        *https = true;
+    } else {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    const char* end = start;
+    while (*end != '\0' && *end != '/' && *end != ':') {
+        end++;
+    }
+    size_t host_len = end - start;
+    if (host_len == 0 || host_len >= LVML_HTTP_HOST_MAX) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    memcpy(host, start, host_len);
+    host[host_len] = '\0';
+
+    *port = *https ? 443 : 80;
+    if (*end == ':') {
+        long value = strtol(end + 1, (char**)&end, 10);
+        if (value <= 0 || value > 65535) {
+            return LVML_ERROR_INVALID_PARAM;
+        }
+        *port = (uint16_t)value;
+    }
+
+    *path = *end == '/' ? end : "/";
+    return strlen(*path) < LVML_MAX_URL_LENGTH ? LVML_OK : LVML_ERROR_INVALID_PARAM;
+}
+
+/**
+ * One GET on conn: reuse the open connection if it allows another request,
+ * otherwise connect first
+ */
+static lvml_error_t http_exchange(lvml_http_conn_t* conn, const char* url, const char* etag, const char* last_modified, bool gzip, bool keep_alive) {
+    char host[LVML_HTTP_HOST_MAX];
+    uint16_t port;
+    bool https;
+    const char* path;
+    lvml_error_t result = http_parse_url(url, host, &port, &https, &path);
+    if (result != LVML_OK) {
+        return result;
+    }
+
+    char request[LVML_MAX_URL_LENGTH + LVML_HTTP_HOST_MAX + LVML_HTTP_ETAG_MAX + LVML_HTTP_DATE_MAX + 192];
+    int len = snprintf(request, sizeof(request),
+                       "GET %s HTTP/1.1\r\n"
+                       "Host: %s\r\n"
+                       "User-Agent: lvml\r\n"
+                       "%s"
+                       "Connection: %s\r\n",
+                       path, host, gzip ? "Accept-Encoding: gzip\r\n" : "", keep_alive ? "keep-alive" : "close");
+    if (etag != NULL && etag[0] != '\0') {
+        len += snprintf(request + len, sizeof(request) - len, "If-None-Match: %s\r\n", etag);
+    }
+    if (last_modified != NULL && last_modified[0] != '\0') {
+        len += snprintf(request + len, sizeof(request) - len, "If-Modified-Since: %s\r\n", last_modified);
+    }
+    len += snprintf(request + len, sizeof(request) - len, "\r\n");
+    if (len >= (int)sizeof(request)) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    // Only a connection whose last body was read to the end is in sync
+    bool reuse = conn->sock >= 0 && conn->keep_alive && conn->body_done && conn->buf_pos == conn->buf_len &&
+                 conn->port == port && conn->https == https && strcmp(conn->host, host) == 0;
+    if (!reuse) {
+        lvml_http_close(conn);
+    }
+    strcpy(conn->host, host);
+    conn->port = port;
+    conn->https = https;
+
+    for (;;) {
+        conn->reused = conn->sock >= 0;
+        if (conn->reused) {
+            conn->dns_us = 0;
+            conn->connect_us = 0;
+        } else if (!http_connect(conn)) {
+            return LVML_ERROR_NETWORK;
+        }
+        if (http_send_all(conn, request, len) && http_read_headers(conn, keep_alive)) {
+            return LVML_OK;
+        }
+
+        // The server may have closed an idle connection; try a new one
+        bool retry = conn->reused;
+        lvml_http_close(conn);
+        if (!retry) {
+            return LVML_ERROR_NETWORK;
+        }
+    }
+}
+
+/**
+ * Read the status line and headers of the next response
+ */
+static bool http_read_headers(lvml_http_conn_t* conn, bool keep_alive) {
+    conn->status = 0;
+    conn->content_length = -1;
+    conn->chunked = false;
+    conn->gzip = false;
+    conn->etag[0] = '\0';
+    conn->last_modified[0] = '\0';
+    conn->body_bytes = 0;
+    conn->buf_pos = 0;
+    conn->buf_len = 0;
+    conn->chunk_left = 0;
+    conn->chunk_started = false;
+    conn->body_done = false;
+    conn->keep_alive = false;
+
+    // Status line: HTTP/1.x NNN reason
+    char line[HTTP_LINE_MAX];
+    if (!http_read_line(conn, line, sizeof(line)) || strncmp(line, "HTTP/1.", 7) != 0 || strlen(line) < 12) {
+        return false;
+    }
+    conn->status = atoi(line + 9);
+
+    // HTTP/1.0 servers close after each response
+    bool persistent = keep_alive && line[7] != '0';
+
+    // Headers up to the empty line
+    for (;;) {
+        if (!http_read_line(conn, line, sizeof(line))) {
+            return false;
+        }
+        if (line[0] == '\0') {
+            break;
+        }
+
+        const char* value;
+        if (http_header_is(line, "content-length", &value)) {
+            conn->content_length = atol(value);
+        } else if (http_header_is(line, "transfer-encoding", &value)) {
+            conn->chunked = strstr(value, "chunked") != NULL;
+        } else if (http_header_is(line, "content-encoding", &value)) {
+            conn->gzip = strstr(value, "gzip") != NULL;
+        } else if (http_header_is(line, "etag", &value)) {
+            http_copy_value(conn->etag, sizeof(conn->etag), value);
+        } else if (http_header_is(line, "last-modified", &value)) {
+            http_copy_value(conn->last_modified, sizeof(conn->last_modified), value);
+        } else if (http_header_is(line, "connection", &value)) {
+            if (strstr(value, "close") != NULL || strstr(value, "Close") != NULL) {
+                persistent = false;
+            }
+        }
+    }
+
+    // These responses never carry a body
+    if (conn->status == 204 || conn->status == 304 || (conn->status >= 100 && conn->status < 200) ||
+        (!conn->chunked && conn->content_length == 0)) {
+        conn->body_done = true;
+    }
+
+    // A body without a length ends when the server closes the connection
+    if (!conn->body_done && !conn->chunked && conn->content_length < 0) {
+        persistent = false;
+    }
+    conn->keep_alive = persistent;
+    return true;
+}
+
+static bool http_connect(lvml_http_conn_t* conn) {
+    int64_t start_us = lvml_time_us();
+    conn->dns_us = 0;
+
+#if LVML_HTTP_TLS
+    if (conn->https) {
+        // esp-tls resolves, connects and verifies against the certificate bundle
+        esp_tls_cfg_t cfg = {
+            .crt_bundle_attach = esp_crt_bundle_attach,
+            .timeout_ms = LVML_HTTP_TIMEOUT_MS,
+        };
+        esp_tls_t* tls = esp_tls_init();
+        if (tls == NULL) {
+            return false;
+        }
+        int fd = -1;
+        if (esp_tls_conn_new_sync(conn->host, strlen(conn->host), conn->port, &cfg, tls) != 1 ||
+            esp_tls_get_conn_sockfd(tls, &fd) != ESP_OK) {
+            esp_tls_conn_destroy(tls);
+            return false;
+        }
+        conn->tls = tls;
+        conn->sock = fd;
+        conn->connect_us = (uint32_t)(lvml_time_us() - start_us);
+        return true;
+    }
+#endif
+
+    conn->sock = http_connect_socket(conn->host, conn->port, &conn->dns_us);
+    conn->connect_us = (uint32_t)(lvml_time_us() - start_us) - conn->dns_us;
+    return conn->sock >= 0;
+}
+
+static int http_connect_socket(const char* host, uint16_t port, uint32_t* dns_us) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    char port_str[8];
+    snprintf(port_str, sizeof(port_str), "%u", port);
+
+    int64_t start_us = lvml_time_us();
+    struct addrinfo* res = NULL;
+    int err = getaddrinfo(host, port_str, &hints, &res);
+    *dns_us = (uint32_t)(lvml_time_us() - start_us);
+    if (err != 0 || res == NULL) {
+        return -1;
+    }
+
+    int sock = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (sock >= 0) {
+        struct timeval tv = {
+            .tv_sec = LVML_HTTP_TIMEOUT_MS / 1000,
+            .tv_usec = (LVML_HTTP_TIMEOUT_MS % 1000) * 1000,
+        };
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        if (connect(sock, res->ai_addr, res->ai_addrlen) != 0) {
+            close(sock);
+            sock = -1;
+        }
+    }
+
+    freeaddrinfo(res);
+    return sock;
+}
+
+static bool http_send_all(lvml_http_conn_t* conn, const char* data, size_t len) {
+    while (len > 0) {
+        int n = http_io_send(conn, data, len);
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+/**
+ * Read from the header buffer first, then straight from the socket
+ */
+static int http_recv(lvml_http_conn_t* conn, uint8_t* buf, size_t len) {
+    if (conn->buf_pos < conn->buf_len) {
+        size_t avail = conn->buf_len - conn->buf_pos;
+        if (len > avail) {
+            len = avail;
+        }
+        memcpy(buf, conn->buf + conn->buf_pos, len);
+        conn->buf_pos += len;
+        return (int)len;
+    }
+
+    return http_io_recv(conn, buf, len);
+}
+
+/**
+ * Socket or TLS session I/O
+ */
+static int http_io_send(lvml_http_conn_t* conn, const char* data, size_t len) {
+    ssize_t n;
+#if LVML_HTTP_TLS
+    if (conn->tls != NULL) {
+        n = esp_tls_conn_write((esp_tls_t*)conn->tls, data, len);
+        return n < 0 ? -1 : (int)n;
+    }
+#endif
+    n = send(conn->sock, data, len, 0);
+    return n < 0 ? -1 : (int)n;
+}
+
+static int http_io_recv(lvml_http_conn_t* conn, uint8_t* buf, size_t len) {
+    ssize_t n;
+#if LVML_HTTP_TLS
+    if (conn->tls != NULL) {
+        n = esp_tls_conn_read((esp_tls_t*)conn->tls, buf, len);
+        return n < 0 ? -1 : (int)n;
+    }
+#endif
+    n = recv(conn->sock, buf, len, 0);
+    return n < 0 ? -1 : (int)n;
+}
+
+/**
+ * Read one CRLF terminated line; overlong lines are truncated
+ */
+static bool http_read_line(lvml_http_conn_t* conn, char* line, size_t size) {
+    size_t len = 0;
+    for (;;) {
+        if (conn->buf_pos == conn->buf_len) {
+            int n = http_io_recv(conn, conn->buf, sizeof(conn->buf));
+            if (n <= 0) {
+                return false;
+            }
+            conn->buf_pos = 0;
+            conn->buf_len = n;
+        }
+
+        char c = (char)conn->buf[conn->buf_pos++];
+        if (c == '\n') {
+            break;
+        }
+        if (c != '\r' && len < size - 1) {
+            line[len++] = c;
+        }
+    }
+    line[len] = '\0';
+    return true;
+}
+
+static bool http_header_is(const char* line, const char* name, const char** value) {
+    size_t name_len = strlen(name);
+    for (size_t i = 0; i < name_len; i++) {
+        if (tolower((unsigned char)line[i]) != name[i]) {
+            return false;
+        }
+    }
+    if (line[name_len] != ':') {
+        return false;
+    }
+
+    const char* v = line + name_len + 1;
+    while (*v == ' ' || *v == '\t') {
+        v++;
+    }
+    *value = v;
+    return true;
+}
+
+static void http_copy_value(char* dst, size_t size, const char* value) {
+    size_t len = strlen(value);
+    if (len >= size) {
+        // A truncated validator would never match; don't keep it
+        dst[0] = '\0';
+        return;
+    }
+    memcpy(dst, value, len + 1);
+}
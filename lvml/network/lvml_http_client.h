@@ -0,0 +1,137 @@
+/**
+ * @file lvml_http_client.h
+ * @brief Minimal streaming HTTP/1.1 GET client over BSD sockets
+ *
+ * Works with lwIP sockets on the ESP32 and POSIX sockets on Linux. The
+ * response body is read in pieces with lvml_http_read(), with chunked
+ * transfer encoding already removed. https:// URLs go through esp-tls with
+ * the certificate bundle and are only available on the ESP32
+ * (LVML_HTTP_TLS).
+ *
+ * lvml_http_open() makes one request per connection. lvml_http_request()
+ * keeps the connection open and sends the next request to the same server
+ * on it, saving the DNS lookup, TCP and TLS handshakes.
+ */
+
+#ifndef LVML_HTTP_CLIENT_H
+#define LVML_HTTP_CLIENT_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_HTTP_HOST_MAX 64
+#define LVML_HTTP_ETAG_MAX 80
+#define LVML_HTTP_DATE_MAX 40
+#define LVML_HTTP_BUF_SIZE 1024
+#define LVML_HTTP_TIMEOUT_MS 10000
+
+#if defined(ESP_PLATFORM) && defined(CONFIG_MBEDTLS_CERTIFICATE_BUNDLE)
+#define LVML_HTTP_TLS 1
+#else
+#define LVML_HTTP_TLS 0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * One HTTP exchange
+ */
+typedef struct {
+    int sock;
+    void* tls;                           // esp-tls session for https://, NULL otherwise
+    int status;                          // HTTP status code
+    int32_t content_length;              // -1 if not sent
+    bool chunked;
+    bool gzip;                           // Content-Encoding: gzip
+    char etag[LVML_HTTP_ETAG_MAX];       // Empty if not sent
+    char last_modified[LVML_HTTP_DATE_MAX];
+    uint32_t body_bytes;                 // Body bytes received so far (still encoded)
+
+    // Receive state
+    uint8_t buf[LVML_HTTP_BUF_SIZE];
+    size_t buf_pos;
+    size_t buf_len;
+    uint32_t chunk_left;
+    bool chunk_started;
+    bool body_done;
+
+    // Connection state for lvml_http_request()
+    char host[LVML_HTTP_HOST_MAX];
+    uint16_t port;
+    bool https;
+    bool keep_alive;                     // Server keeps the connection open after this response
+    bool reused;                         // This request ran on an already open connection
+    uint32_t dns_us;                     // Name lookup (0 if reused; part of connect_us with TLS)
+    uint32_t connect_us;                 // TCP connect and TLS handshake (0 if reused)
+} lvml_http_conn_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Connect, send a GET request and read the response headers.
+ * The request always offers gzip and asks the server to close afterwards.
+ * @param conn connection to initialise
+ * @param url http://host[:port]/path (or https:// with LVML_HTTP_TLS)
+ * @param etag validator for If-None-Match (NULL or empty to omit)
+ * @param last_modified validator for If-Modified-Since (NULL or empty to omit)
+ * @return LVML_OK once headers are read, LVML_ERROR_INVALID_PARAM for bad URLs,
+ *         LVML_ERROR_NETWORK on connection or protocol errors
+ */
+lvml_error_t lvml_http_open(lvml_http_conn_t* conn, const char* url, const char* etag, const char* last_modified);
+
+/**
+ * Prepare a connection for lvml_http_request(); nothing is opened yet
+ * @param conn connection to initialise
+ */
+void lvml_http_init(lvml_http_conn_t* conn);
+
+/**
+ * Send a GET request and read the response headers, keeping the connection
+ * open for the next request. The open connection is reused if it goes to
+ * the same server, the previous body was read to the end and the server
+ * didn't ask to close; otherwise a new one is made. A reused connection
+ * that turns out to be closed by the server is retried once on a new one.
+ * @param conn connection from lvml_http_init(), possibly with an earlier
+ *             exchange on it
+ * @param url http://host[:port]/path (or https:// with LVML_HTTP_TLS)
+ * @param etag validator for If-None-Match (NULL or empty to omit)
+ * @param last_modified validator for If-Modified-Since (NULL or empty to omit)
+ * @param gzip offer gzip (the body is then read still compressed)
+ * @return as lvml_http_open(); the connection is closed on errors
+ */
+lvml_error_t lvml_http_request(lvml_http_conn_t* conn, const char* url, const char* etag, const char* last_modified, bool gzip);
+
+/**
+ * Read response body bytes
+ * @param conn open connection
+ * @param buf output buffer
+ * @param len buffer size
+ * @return number of bytes read, 0 at the end of the body, -1 on error
+ */
+int lvml_http_read(lvml_http_conn_t* conn, uint8_t* buf, size_t len);
+
+/**
+ * Close the connection (also one kept open by lvml_http_request())
+ * @param conn connection to close
+ */
+void lvml_http_close(lvml_http_conn_t* conn);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_HTTP_CLIENT_H*/
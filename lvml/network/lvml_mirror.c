@@ -0,0 +1,721 @@
+/**
+ * @file lvml_mirror.c
+ * @brief Live screen mirroring to a remote viewer, dirty rectangles only
+ */
+
+#include "lvml_mirror.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_qoi.h"
+#include "utils/lvml_splash.h"
+#include "utils/lvml_time.h"
+#include "utils/lvml_varint.h"
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define MIRROR_TASK_STACK 4096
+#define MIRROR_TASK_PRIORITY 1
+#define MIRROR_SEND_TIMEOUT_MS 5000
+#define MIRROR_RETRY_MS 1000                  // First reconnect delay, doubled up to MIRROR_RETRY_MAX_MS
+#define MIRROR_RETRY_MAX_MS 30000
+#define MIRROR_OUT_SIZE 1400                  // Send buffer, about one TCP segment
+#define MIRROR_SOCK_BUF 16384                 // Socket send buffer
+#define MIRROR_ROW_CHUNK 64                   // Pixels converted to native order at once
+#define MIRROR_WAIT_FOREVER UINT32_MAX
+
+#define MIRROR_MSG_SIZE 0
+#define MIRROR_MSG_RECT 1
+#define MIRROR_MSG_FRAME 2
+
+// A viewer that went away must not kill the process (SIGPIPE) on Linux
+#ifdef MSG_NOSIGNAL
+#define MIRROR_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define MIRROR_SEND_FLAGS 0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+} mirror_rect_t;
+
+/**
+ * Mirror task state of one connection; large, so it lives with the shadow frame
+ */
+typedef struct {
+    int sock;
+    uint32_t generation;                 // mirror_generation the connection was made for
+    uint32_t size_generation;            // mirror_size_generation last sent
+    uint32_t frame;
+    bool failed;
+    uint8_t out[MIRROR_OUT_SIZE];
+    size_t out_len;
+    size_t out_bytes;                    // Bytes sent this frame
+    union {
+        lvml_qoi_encoder_t qoi;
+        lvml_splash_encoder_t rle;
+    } enc;
+} mirror_session_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void mirror_task_run(void);
+static int mirror_connect_socket(const char* host, uint16_t port);
+static void mirror_session_run(mirror_session_t* s, lvml_mirror_codec_t codec, uint32_t fps);
+static bool mirror_session_current(mirror_session_t* s);
+static void mirror_send_rect(mirror_session_t* s, lvml_mirror_codec_t codec, const mirror_rect_t* rect,
+                             uint32_t width);
+static bool mirror_chunk_cb(const uint8_t* data, size_t len, void* user_data);
+static void mirror_write(mirror_session_t* s, const uint8_t* data, size_t len);
+static void mirror_write_varint(mirror_session_t* s, uint32_t value);
+static void mirror_write_flush(mirror_session_t* s);
+static void mirror_add_rect(const mirror_rect_t* rect);
+static uint32_t mirror_rect_area(const mirror_rect_t* r);
+static mirror_rect_t mirror_rect_union(const mirror_rect_t* a, const mirror_rect_t* b);
+static bool mirror_rect_overlaps(const mirror_rect_t* a, const mirror_rect_t* b);
+static bool mirror_start_task(void);
+static void mirror_lock(void);
+static void mirror_unlock(void);
+static void mirror_wake(void);
+static void mirror_wait(uint32_t timeout_ms);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+// Viewer, connection state, dirty rectangles and statistics, protected by mirror_lock()
+static char mirror_host[LVML_MIRROR_HOST_MAX];
+static uint16_t mirror_port = 0;
+static lvml_mirror_codec_t mirror_codec = LVML_MIRROR_RLE;
+static uint32_t mirror_fps = LVML_MIRROR_FPS;
+static bool mirror_active = false;
+static uint32_t mirror_generation = 0;       // Bumped by every start and stop
+static uint32_t mirror_size_generation = 0;  // Bumped by every resize
+static mirror_rect_t mirror_dirty[LVML_MIRROR_RECTS];
+static uint32_t mirror_dirty_count = 0;
+static uint32_t mirror_pending_frames = 0;   // Display refreshes since the last frame sent
+static lvml_mirror_stats_t mirror_stats;
+static bool mirror_started = false;
+
+// Screen and shadow frame (big-endian RGB565); written by the flush path,
+// read by the mirror task. Both run without the lock: a rectangle the task
+// reads while it is being drawn is dirty again, so the next frame fixes it.
+static uint32_t mirror_width = 0;
+static uint32_t mirror_height = 0;
+static uint8_t* mirror_shadow = NULL;
+static size_t mirror_shadow_pixels = 0;
+static mirror_session_t* mirror_session = NULL;
+static volatile bool mirror_enabled = false;
+
+#ifdef ESP_PLATFORM
+static SemaphoreHandle_t mirror_mutex = NULL;
+static SemaphoreHandle_t mirror_wake_sem = NULL;
+#else
+static pthread_mutex_t mirror_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mirror_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t mirror_wake_pending = 0;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_mirror_start(const char* host, uint16_t port, lvml_mirror_codec_t codec, uint32_t fps) {
+    if (host == NULL || host[0] == '\0' || strlen(host) >= LVML_MIRROR_HOST_MAX || port == 0 ||
+        (codec != LVML_MIRROR_RLE && codec != LVML_MIRROR_QOI) || fps == 0 || fps > LVML_MIRROR_FPS_MAX) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    if (mirror_width == 0 || mirror_height == 0) {
+        return LVML_ERROR_INIT;
+    }
+    if (mirror_shadow == NULL) {
+        size_t pixels = (size_t)mirror_width * mirror_height;
+        mirror_shadow = (uint8_t*)lvml_mem_alloc_large(pixels * sizeof(uint16_t));
+        mirror_session = (mirror_session_t*)lvml_mem_alloc_large(sizeof(mirror_session_t));
+        if (mirror_shadow == NULL || mirror_session == NULL) {
+            lvml_mem_free_large(mirror_shadow);
+            lvml_mem_free_large(mirror_session);
+            mirror_shadow = NULL;
+            mirror_session = NULL;
+            return LVML_ERROR_MEMORY;
+        }
+        memset(mirror_shadow, 0, pixels * sizeof(uint16_t));
+        mirror_shadow_pixels = pixels;
+    }
+    if (!mirror_start_task()) {
+        return LVML_ERROR_INIT;
+    }
+
+    mirror_lock();
+    strcpy(mirror_host, host);
+    mirror_port = port;
+    mirror_codec = codec;
+    mirror_fps = fps;
+    mirror_active = true;
+    mirror_generation++;
+    mirror_dirty_count = 0;
+    mirror_pending_frames = 0;
+    mirror_unlock();
+    mirror_enabled = true;
+    mirror_wake();
+    return LVML_OK;
+}
+
+void lvml_mirror_stop(void) {
+    mirror_enabled = false;
+    mirror_lock();
+    mirror_active = false;
+    mirror_generation++;
+    mirror_unlock();
+    mirror_wake();
+}
+
+void lvml_mirror_resize(uint32_t width, uint32_t height) {
+    if (width == mirror_width && height == mirror_height) {
+        return;
+    }
+    mirror_lock();
+    mirror_width = width;
+    mirror_height = height;
+    mirror_size_generation++;
+    mirror_dirty_count = 0;
+    mirror_unlock();
+}
+
+void lvml_mirror_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                       const uint8_t* pixels, size_t len, bool last) {
+    if (!mirror_enabled || pixels == NULL) {
+        return;
+    }
+    int64_t start_us = lvml_time_us();
+
+    // Clip to the screen; a screen larger than the shadow frame isn't mirrored
+    int32_t area_w = x2 - x1 + 1;
+    int32_t area_h = y2 - y1 + 1;
+    int32_t width = (int32_t)mirror_width;
+    int32_t height = (int32_t)mirror_height;
+    mirror_rect_t rect = {
+        .x1 = x1 > 0 ? x1 : 0,
+        .y1 = y1 > 0 ? y1 : 0,
+        .x2 = x2 < width - 1 ? x2 : width - 1,
+        .y2 = y2 < height - 1 ? y2 : height - 1,
+    };
+    bool copied = area_w > 0 && area_h > 0 && len >= (size_t)area_w * area_h * sizeof(uint16_t) &&
+                  (size_t)width * height <= mirror_shadow_pixels && rect.x1 <= rect.x2 && rect.y1 <= rect.y2;
+    if (copied) {
+        size_t row_len = (size_t)(rect.x2 - rect.x1 + 1) * sizeof(uint16_t);
+        for (int32_t y = rect.y1; y <= rect.y2; y++) {
+            memcpy(mirror_shadow + ((size_t)y * width + rect.x1) * sizeof(uint16_t),
+                   pixels + ((size_t)(y - y1) * area_w + (rect.x1 - x1)) * sizeof(uint16_t), row_len);
+        }
+    }
+
+    uint32_t flush_us = (uint32_t)(lvml_time_us() - start_us);
+    mirror_lock();
+    if (copied) {
+        mirror_add_rect(&rect);
+    }
+    mirror_stats.flushes++;
+    if (last) {
+        mirror_stats.display_frames++;
+        mirror_pending_frames++;
+    }
+    if (flush_us > mirror_stats.flush_max_us) {
+        mirror_stats.flush_max_us = flush_us;
+    }
+    mirror_unlock();
+}
+
+void lvml_mirror_get_stats(lvml_mirror_stats_t* stats, bool reset) {
+    if (stats == NULL) {
+        return;
+    }
+    mirror_lock();
+    *stats = mirror_stats;
+    if (reset) {
+        bool connected = mirror_stats.connected;
+        memset(&mirror_stats, 0, sizeof(mirror_stats));
+        mirror_stats.connected = connected;
+    }
+    mirror_unlock();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void mirror_task_run(void) {
+    uint32_t retry_ms = MIRROR_RETRY_MS;
+    for (;;) {
+        mirror_lock();
+        bool active = mirror_active;
+        char host[LVML_MIRROR_HOST_MAX];
+        strcpy(host, mirror_host);
+        uint16_t port = mirror_port;
+        lvml_mirror_codec_t codec = mirror_codec;
+        uint32_t fps = mirror_fps;
+        uint32_t generation = mirror_generation;
+        mirror_unlock();
+        if (!active) {
+            retry_ms = MIRROR_RETRY_MS;
+            mirror_wait(MIRROR_WAIT_FOREVER);
+            continue;
+        }
+
+        mirror_session_t* s = mirror_session;
+        memset(s, 0, sizeof(*s));
+        s->sock = mirror_connect_socket(host, port);
+        s->generation = generation;
+        if (s->sock >= 0) {
+            mirror_lock();
+            mirror_stats.connected = true;
+            mirror_stats.connects++;
+            mirror_unlock();
+
+            int64_t connected_us = lvml_time_us();
+            mirror_session_run(s, codec, fps);
+            close(s->sock);
+
+            mirror_lock();
+            mirror_stats.connected = false;
+            mirror_stats.disconnects++;
+            mirror_unlock();
+            // A connection that lasted a while was fine; start over with short delays
+            if (lvml_time_us() - connected_us >= (int64_t)MIRROR_RETRY_MAX_MS * 1000) {
+                retry_ms = MIRROR_RETRY_MS;
+            }
+        }
+
+        // Reconnect after a delay unless start or stop changes the plan meanwhile;
+        // a wake left over from earlier doesn't cut the delay short
+        int64_t retry_us = lvml_time_us() + (int64_t)retry_ms * 1000;
+        for (;;) {
+            mirror_lock();
+            bool changed = mirror_generation != generation;
+            mirror_unlock();
+            if (changed) {
+                retry_ms = MIRROR_RETRY_MS;
+                break;
+            }
+            int64_t left_us = retry_us - lvml_time_us();
+            if (left_us <= 0) {
+                retry_ms = retry_ms * 2 < MIRROR_RETRY_MAX_MS ? retry_ms * 2 : MIRROR_RETRY_MAX_MS;
+                break;
+            }
+            mirror_wait((uint32_t)((left_us + 999) / 1000));
+        }
+    }
+}
+
+static int mirror_connect_socket(const char* host, uint16_t port) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    char port_str[8];
+    snprintf(port_str, sizeof(port_str), "%u", port);
+    struct addrinfo* res = NULL;
+    if (getaddrinfo(host, port_str, &hints, &res) != 0 || res == NULL) {
+        return -1;
+    }
+
+    int sock = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (sock >= 0) {
+        struct timeval snd = {
+            .tv_sec = MIRROR_SEND_TIMEOUT_MS / 1000,
+            .tv_usec = (MIRROR_SEND_TIMEOUT_MS % 1000) * 1000,
+        };
+        int one = 1;
+        int sndbuf = MIRROR_SOCK_BUF;
+        setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &snd, sizeof(snd));
+        // Frames a slow link can't carry should merge in the dirty list, not queue in the socket
+        setsockopt(sock, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+        // Frames are flushed whole; the last segment shouldn't wait for an ack
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        if (connect(sock, res->ai_addr, res->ai_addrlen) != 0) {
+            close(sock);
+            sock = -1;
+        }
+    }
+    freeaddrinfo(res);
+    return sock;
+}
+
+/**
+ * Send frames until the connection fails or mirroring is stopped or restarted
+ */
+static void mirror_session_run(mirror_session_t* s, lvml_mirror_codec_t codec, uint32_t fps) {
+    const uint8_t hello[5] = { 'L', 'V', 'M', LVML_MIRROR_VERSION, (uint8_t)codec };
+    mirror_write(s, hello, sizeof(hello));
+    mirror_write_flush(s);
+    // A new viewer has nothing yet: send the size, then the whole screen
+    s->size_generation = mirror_size_generation - 1;
+
+    int64_t interval_us = 1000000 / fps;
+    int64_t next_us = lvml_time_us();
+    while (!s->failed) {
+        int64_t left_us = next_us - lvml_time_us();
+        if (left_us > 0) {
+            mirror_wait((uint32_t)((left_us + 999) / 1000));
+        }
+        if (!mirror_session_current(s)) {
+            return;
+        }
+        if (lvml_time_us() < next_us) {
+            continue;   // Woken early by a stale wake
+        }
+
+        // Take what is dirty; the flush path starts a new list meanwhile
+        mirror_rect_t rects[LVML_MIRROR_RECTS];
+        mirror_lock();
+        uint32_t width = mirror_width;
+        uint32_t height = mirror_height;
+        bool resized = s->size_generation != mirror_size_generation;
+        if (resized) {
+            s->size_generation = mirror_size_generation;
+            mirror_dirty_count = 0;
+        }
+        uint32_t count = mirror_dirty_count;
+        memcpy(rects, mirror_dirty, sizeof(mirror_rect_t) * count);
+        mirror_dirty_count = 0;
+        uint32_t covered = mirror_pending_frames;
+        mirror_pending_frames = 0;
+        mirror_unlock();
+
+        next_us += interval_us;
+        if (next_us < lvml_time_us()) {
+            next_us = lvml_time_us();     // Fell behind; don't try to catch up
+        }
+        if ((size_t)width * height > mirror_shadow_pixels) {
+            continue;
+        }
+        if (resized) {
+            mirror_write_varint(s, MIRROR_MSG_SIZE);
+            mirror_write_varint(s, width);
+            mirror_write_varint(s, height);
+            rects[0] = (mirror_rect_t){ 0, 0, (int32_t)width - 1, (int32_t)height - 1 };
+            count = 1;
+        }
+        if (count == 0) {
+            continue;
+        }
+
+        int64_t start_us = lvml_time_us();
+        s->out_bytes = 0;
+        uint32_t pixels = 0;
+        for (uint32_t i = 0; i < count && !s->failed; i++) {
+            mirror_send_rect(s, codec, &rects[i], width);
+            pixels += mirror_rect_area(&rects[i]);
+        }
+        mirror_write_varint(s, MIRROR_MSG_FRAME);
+        mirror_write_varint(s, s->frame++);
+        mirror_write_varint(s, covered);
+        mirror_write_flush(s);
+
+        mirror_lock();
+        mirror_stats.frames++;
+        mirror_stats.merged += covered > 1 ? covered - 1 : 0;
+        mirror_stats.rects += count;
+        mirror_stats.pixels += pixels;
+        mirror_stats.bytes += (uint32_t)s->out_bytes;
+        mirror_stats.encode_us += (uint32_t)(lvml_time_us() - start_us);
+        mirror_unlock();
+    }
+}
+
+static bool mirror_session_current(mirror_session_t* s) {
+    mirror_lock();
+    bool current = mirror_active && mirror_generation == s->generation;
+    mirror_unlock();
+    return current;
+}
+
+/**
+ * Compress one rectangle from the shadow frame and write it as chunks
+ */
+static void mirror_send_rect(mirror_session_t* s, lvml_mirror_codec_t codec, const mirror_rect_t* rect,
+                             uint32_t width) {
+    uint32_t rect_w = (uint32_t)(rect->x2 - rect->x1 + 1);
+    uint32_t rect_h = (uint32_t)(rect->y2 - rect->y1 + 1);
+    mirror_write_varint(s, MIRROR_MSG_RECT);
+    mirror_write_varint(s, (uint32_t)rect->x1);
+    mirror_write_varint(s, (uint32_t)rect->y1);
+    mirror_write_varint(s, rect_w);
+    mirror_write_varint(s, rect_h);
+
+    if (codec == LVML_MIRROR_QOI) {
+        lvml_qoi_begin(&s->enc.qoi, rect_w, rect_h, mirror_chunk_cb, s);
+    } else {
+        lvml_splash_begin(&s->enc.rle, (uint16_t)rect_w, (uint16_t)rect_h, mirror_chunk_cb, s);
+    }
+    uint16_t native[MIRROR_ROW_CHUNK];
+    for (int32_t y = rect->y1; y <= rect->y2 && !s->failed; y++) {
+        const uint8_t* row = mirror_shadow + ((size_t)y * width + rect->x1) * sizeof(uint16_t);
+        for (uint32_t x = 0; x < rect_w; x += MIRROR_ROW_CHUNK) {
+            uint32_t n = rect_w - x < MIRROR_ROW_CHUNK ? rect_w - x : MIRROR_ROW_CHUNK;
+            for (uint32_t i = 0; i < n; i++) {
+                const uint8_t* px = row + (x + i) * sizeof(uint16_t);
+                native[i] = (uint16_t)((px[0] << 8) | px[1]);
+            }
+            if (codec == LVML_MIRROR_QOI) {
+                lvml_qoi_push_rgb565(&s->enc.qoi, native, n);
+            } else {
+                lvml_splash_push_rgb565(&s->enc.rle, native, n);
+            }
+        }
+    }
+    if (codec == LVML_MIRROR_QOI) {
+        lvml_qoi_end(&s->enc.qoi);
+    } else {
+        lvml_splash_end(&s->enc.rle);
+    }
+    mirror_write_varint(s, 0);
+}
+
+static bool mirror_chunk_cb(const uint8_t* data, size_t len, void* user_data) {
+    mirror_session_t* s = (mirror_session_t*)user_data;
+    mirror_write_varint(s, (uint32_t)len);
+    mirror_write(s, data, len);
+    return !s->failed;
+}
+
+static void mirror_write(mirror_session_t* s, const uint8_t* data, size_t len) {
+    while (len > 0 && !s->failed) {
+        size_t n = sizeof(s->out) - s->out_len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(s->out + s->out_len, data, n);
+        s->out_len += n;
+        data += n;
+        len -= n;
+        if (s->out_len == sizeof(s->out)) {
+            mirror_write_flush(s);
+        }
+    }
+}
+
+static void mirror_write_varint(mirror_session_t* s, uint32_t value) {
+    uint8_t buf[LVML_VARINT_MAX];
+    mirror_write(s, buf, lvml_varint_put(buf, value));
+}
+
+/**
+ * Send the buffered bytes; a slow viewer blocks only the mirror task
+ */
+static void mirror_write_flush(mirror_session_t* s) {
+    size_t sent = 0;
+    while (sent < s->out_len && !s->failed) {
+        ssize_t n = send(s->sock, s->out + sent, s->out_len - sent, MIRROR_SEND_FLAGS);
+        if (n > 0) {
+            sent += (size_t)n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            s->failed = true;
+        }
+    }
+    s->out_bytes += sent;
+    s->out_len = 0;
+}
+
+/**
+ * Add a dirty rectangle: rectangles it overlaps are merged into it, and when
+ * the list is full it goes into the rectangle that grows the least
+ */
+static void mirror_add_rect(const mirror_rect_t* rect) {
+    mirror_rect_t r = *rect;
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint32_t i = 0; i < mirror_dirty_count; i++) {
+            if (mirror_rect_overlaps(&r, &mirror_dirty[i])) {
+                r = mirror_rect_union(&r, &mirror_dirty[i]);
+                mirror_dirty[i] = mirror_dirty[--mirror_dirty_count];
+                merged = true;
+                break;
+            }
+        }
+    }
+    if (mirror_dirty_count < LVML_MIRROR_RECTS) {
+        mirror_dirty[mirror_dirty_count++] = r;
+        return;
+    }
+
+    uint32_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint32_t i = 0; i < mirror_dirty_count; i++) {
+        mirror_rect_t u = mirror_rect_union(&r, &mirror_dirty[i]);
+        uint32_t growth = mirror_rect_area(&u) - mirror_rect_area(&mirror_dirty[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    // The grown rectangle may overlap others now; add it again to merge them
+    r = mirror_rect_union(&r, &mirror_dirty[best]);
+    mirror_dirty[best] = mirror_dirty[--mirror_dirty_count];
+    mirror_stats.overflows++;
+    mirror_add_rect(&r);
+}
+
+static uint32_t mirror_rect_area(const mirror_rect_t* r) {
+    return (uint32_t)(r->x2 - r->x1 + 1) * (uint32_t)(r->y2 - r->y1 + 1);
+}
+
+static mirror_rect_t mirror_rect_union(const mirror_rect_t* a, const mirror_rect_t* b) {
+    mirror_rect_t u = {
+        .x1 = a->x1 < b->x1 ? a->x1 : b->x1,
+        .y1 = a->y1 < b->y1 ? a->y1 : b->y1,
+        .x2 = a->x2 > b->x2 ? a->x2 : b->x2,
+        .y2 = a->y2 > b->y2 ? a->y2 : b->y2,
+    };
+    return u;
+}
+
+/**
+ * Overlapping, or touching along a whole side, so the union wastes nothing
+ */
+static bool mirror_rect_overlaps(const mirror_rect_t* a, const mirror_rect_t* b) {
+    if (a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2) {
+        return true;
+    }
+    bool same_columns = a->x1 == b->x1 && a->x2 == b->x2;
+    bool same_rows = a->y1 == b->y1 && a->y2 == b->y2;
+    return (same_columns && (a->y2 + 1 == b->y1 || b->y2 + 1 == a->y1)) ||
+           (same_rows && (a->x2 + 1 == b->x1 || b->x2 + 1 == a->x1));
+}
+
+#ifdef ESP_PLATFORM
+
+static void mirror_task_entry(void* arg) {
+    (void)arg;
+    mirror_task_run();
+}
+
+static bool mirror_start_task(void) {
+    if (mirror_started) {
+        return true;
+    }
+    mirror_mutex = xSemaphoreCreateMutex();
+    mirror_wake_sem = xSemaphoreCreateBinary();
+    if (mirror_mutex == NULL || mirror_wake_sem == NULL) {
+        return false;
+    }
+    if (xTaskCreate(mirror_task_entry, "lvml_mirror", MIRROR_TASK_STACK, NULL,
+                    tskIDLE_PRIORITY + MIRROR_TASK_PRIORITY, NULL) != pdPASS) {
+        return false;
+    }
+    mirror_started = true;
+    return true;
+}
+
+static void mirror_lock(void) {
+    if (mirror_mutex != NULL) {
+        xSemaphoreTake(mirror_mutex, portMAX_DELAY);
+    }
+}
+
+static void mirror_unlock(void) {
+    if (mirror_mutex != NULL) {
+        xSemaphoreGive(mirror_mutex);
+    }
+}
+
+static void mirror_wake(void) {
+    xSemaphoreGive(mirror_wake_sem);
+}
+
+static void mirror_wait(uint32_t timeout_ms) {
+    TickType_t ticks = timeout_ms == MIRROR_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms) + 1;
+    xSemaphoreTake(mirror_wake_sem, ticks);
+}
+
+#else
+
+static void* mirror_thread_entry(void* arg) {
+    (void)arg;
+    mirror_task_run();
+    return NULL;
+}
+
+static bool mirror_start_task(void) {
+    if (mirror_started) {
+        return true;
+    }
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, mirror_thread_entry, NULL) != 0) {
+        return false;
+    }
+    pthread_detach(thread);
+    mirror_started = true;
+    return true;
+}
+
+static void mirror_lock(void) {
+    pthread_mutex_lock(&mirror_mutex);
+}
+
+static void mirror_unlock(void) {
+    pthread_mutex_unlock(&mirror_mutex);
+}
+
+static void mirror_wake(void) {
+    pthread_mutex_lock(&mirror_mutex);
+    mirror_wake_pending = 1;
+    pthread_cond_signal(&mirror_cond);
+    pthread_mutex_unlock(&mirror_mutex);
+}
+
+static void mirror_wait(uint32_t timeout_ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&mirror_mutex);
+    int err = 0;
+    while (mirror_wake_pending == 0 && err == 0) {
+        if (timeout_ms == MIRROR_WAIT_FOREVER) {
+            pthread_cond_wait(&mirror_cond, &mirror_mutex);
+        } else {
+            err = pthread_cond_timedwait(&mirror_cond, &mirror_mutex, &deadline);
+        }
+    }
+    mirror_wake_pending = 0;
+    pthread_mutex_unlock(&mirror_mutex);
+}
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file lvml_mirror.h
+ * @brief Live screen mirroring to a remote viewer, dirty rectangles only
+ *
+ * The display driver hands every area it sends to the panel to
+ * lvml_mirror_flush(). That only copies the pixels into a shadow frame
+ * (PSRAM) and adds the area to a short list of dirty rectangles; it never
+ * waits for the network, so mirroring can't stall the panel. A mirror task
+ * (a thread on Linux) connects to the viewer and, at most `fps` times a
+ * second, takes the dirty rectangles, compresses them from the shadow frame
+ * and sends them. Whatever the display draws while the task is waiting
+ * for the rate limit or for a slow link lands in the same rectangles, so
+ * frames the link can't carry are merged into later ones, not queued. A
+ * viewer that connects, or reconnects, gets the whole screen first.
+ *
+ * Protocol, device to viewer, varints as in lvml_snapshot.h:
+ *   on connect   "LVM", u8 version, u8 codec
+ *   size         u8 0, varint width, varint height; the viewer starts over
+ *   rect         u8 1, varint x, y, width, height, then the compressed
+ *                pixels as chunks of varint length and bytes, ending with
+ *                an empty chunk
+ *   frame        u8 2, varint frame number, varint display refreshes it
+ *                covers; the rects before it make one consistent update
+ * A rect is a whole image in the codec's format: an RLE splash
+ * (utils/lvml_splash.h) or QOI (utils/lvml_qoi.h). The viewer sends nothing.
+ */
+
+#ifndef LVML_MIRROR_H
+#define LVML_MIRROR_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_MIRROR_VERSION 1
+#define LVML_MIRROR_PORT 8766                 // Default viewer port
+#define LVML_MIRROR_FPS 10                    // Default frame rate limit
+#define LVML_MIRROR_FPS_MAX 60
+#define LVML_MIRROR_RECTS 8                   // Dirty rectangles kept; more are merged
+#define LVML_MIRROR_HOST_MAX 64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LVML_MIRROR_RLE = 0,        // Cheapest to encode; flat UI compresses well
+    LVML_MIRROR_QOI,            // Smaller for gradients and images
+} lvml_mirror_codec_t;
+
+/**
+ * Mirroring statistics
+ */
+typedef struct {
+    bool connected;
+    uint32_t connects;              // Viewer connections made
+    uint32_t disconnects;
+    uint32_t flushes;               // Areas copied from the flush path
+    uint32_t flush_max_us;          // Longest lvml_mirror_flush() call
+    uint32_t display_frames;        // Display refreshes seen
+    uint32_t frames;                // Frames sent
+    uint32_t merged;                // Display refreshes merged into a later frame
+    uint32_t rects;                 // Rectangles sent
+    uint32_t overflows;             // Rectangles merged because the list was full
+    uint32_t pixels;                // Pixels sent
+    uint32_t bytes;                 // Bytes sent, framing included
+    uint32_t encode_us;             // Time spent compressing and sending
+} lvml_mirror_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start mirroring to a viewer and keep reconnecting to it; the mirror task
+ * and the shadow frame are created on first use, the frame sized for the
+ * screen at that time. Mirroring to another viewer is stopped first. The
+ * caller should redraw the whole screen so the shadow frame fills up.
+ * @param host viewer name or address
+ * @param port viewer port
+ * @param codec compression of the rectangles
+ * @param fps most frames sent per second, 1..LVML_MIRROR_FPS_MAX
+ * @return LVML_OK, LVML_ERROR_INVALID_PARAM, LVML_ERROR_INIT if the screen
+ *         size isn't known or the task can't be started, or
+ *         LVML_ERROR_MEMORY
+ */
+lvml_error_t lvml_mirror_start(const char* host, uint16_t port, lvml_mirror_codec_t codec, uint32_t fps);
+
+/**
+ * Stop mirroring and close the connection
+ */
+void lvml_mirror_stop(void);
+
+/**
+ * Set the screen size; call when the display is created and whenever its
+ * resolution changes. The viewer is sent the new size and then the whole
+ * screen.
+ * @param width screen width in pixels
+ * @param height screen height in pixels
+ */
+void lvml_mirror_resize(uint32_t width, uint32_t height);
+
+/**
+ * Copy an area that is being sent to the panel; cheap and never blocking,
+ * does nothing while mirroring is stopped
+ * @param x1 left column
+ * @param y1 top row
+ * @param x2 right column, inclusive
+ * @param y2 bottom row, inclusive
+ * @param pixels RGB565 in the panel's byte order (big-endian), row by row
+ * @param len number of bytes
+ * @param last the last area of a display refresh
+ */
+void lvml_mirror_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                       const uint8_t* pixels, size_t len, bool last);
+
+/**
+ * Get mirroring statistics
+ * @param stats output statistics
+ * @param reset clear the counters afterwards
+ */
+void lvml_mirror_get_stats(lvml_mirror_stats_t* stats, bool reset);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_MIRROR_H*/
@@ -0,0 +1,827 @@
+/**
+ * @file lvml_net.c
+ * @brief Network manager: WiFi state and prioritised HTTP(S) GETs on one task
+ */
+
+#include "lvml_net.h"
+#include "lvml_http_client.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_spsc.h"
+#include "utils/lvml_time.h"
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_event.h"
+#include "esp_wifi.h"
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LVML_HTTP_TLS
+#define NET_TASK_STACK 8192                   // mbedtls handshakes need the extra room
+#else
+#define NET_TASK_STACK 6144
+#endif
+#define NET_TASK_PRIORITY 1
+#define NET_CHUNK_SIZE 1024                   // Body piece handed to a body callback
+#define NET_SKIP_MAX 4096                     // Error bodies up to this size are read to keep the connection
+#define NET_STREAM_POLL_MS 5                  // How often a full stream is checked for room
+#define NET_WIFI_POLL_MS 500                  // How often held requests are checked while WiFi associates
+#define NET_WIFI_RETRY_MS 1000                // First reconnect delay, doubled up to NET_WIFI_RETRY_MAX_MS
+#define NET_WIFI_RETRY_MAX_MS 30000
+#define NET_BUFFER_INITIAL_CAP 4096
+#define NET_WAIT_FOREVER UINT32_MAX
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    NET_REQ_PENDING = 0,
+    NET_REQ_RUNNING,
+    NET_REQ_DONE,
+} net_req_state_t;
+
+typedef struct {
+    uint16_t len;
+    uint8_t data[LVML_NET_STREAM_BLOCK_SIZE];
+} net_block_t;
+
+typedef struct {
+    uint32_t id;
+    net_req_state_t state;
+    lvml_net_priority_t priority;
+    char url[LVML_MAX_URL_LENGTH];
+    lvml_net_body_cb_t on_body;
+    void* user_data;
+    bool cancelled;                      // Cancelled while running; the network task stops it
+    int64_t queued_at_us;
+    lvml_net_result_t result;
+
+    // Body for lvml_net_read(), filled by the network task and drained by the reader
+    net_block_t* blocks;
+    lvml_spsc_t stream;
+    uint16_t block_pos;                  // Read position in the oldest block
+} net_req_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool net_url_supported(const char* url);
+static int32_t net_find(uint32_t id);
+static void net_req_free(net_req_t* req);
+static bool net_is_cancelled(net_req_t* req);
+static net_req_t* net_take(bool* held);
+static void net_run(net_req_t* req);
+static bool net_read_body(net_req_t* req);
+static int32_t net_stream_reserve(net_req_t* req);
+static void net_skip_body(void);
+static void net_done(net_req_t* req);
+static uint32_t net_task_wait_ms(bool held);
+static void net_task_run(void);
+static bool net_start(void);
+static bool net_wifi_ready(void);
+static uint32_t net_wifi_service(void);
+static void net_lock(void);
+static void net_unlock(void);
+static void net_wake(void);
+static bool net_wait(uint32_t timeout_ms);
+static void net_sleep_ms(uint32_t ms);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+// Requests, statistics and WiFi state, protected by net_lock()
+static net_req_t* net_reqs[LVML_NET_QUEUE_MAX];
+static uint32_t net_next_id = 1;
+static lvml_net_stats_t net_stats;
+static bool net_started = false;
+
+// Network task only: the kept-alive connection and when it was last used
+static lvml_http_conn_t net_conn;
+static int64_t net_conn_used_us = 0;
+static uint8_t net_chunk[NET_CHUNK_SIZE];
+
+#ifdef ESP_PLATFORM
+static lvml_net_wifi_state_t net_wifi = LVML_NET_WIFI_OFF;
+static bool net_wifi_managed = false;      // lvml_net_wifi_connect() keeps the station connected
+static uint32_t net_wifi_retry_ms = NET_WIFI_RETRY_MS;
+static int64_t net_wifi_retry_at_us = 0;   // Next reconnect attempt, 0 if none is due
+static SemaphoreHandle_t net_mutex = NULL;
+static SemaphoreHandle_t net_wake_sem = NULL;
+#else
+static lvml_net_wifi_state_t net_wifi = LVML_NET_WIFI_CONNECTED;
+static pthread_mutex_t net_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t net_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t net_wake_pending = 0;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lvml_net_get(const lvml_net_request_t* req) {
+    if (req == NULL || req->url == NULL || strlen(req->url) >= LVML_MAX_URL_LENGTH ||
+        req->priority >= LVML_NET_PRIORITY_COUNT || !net_url_supported(req->url)) {
+        return 0;
+    }
+    if (!net_start()) {
+        return 0;
+    }
+
+    net_req_t* r = (net_req_t*)lvml_mem_alloc_large(sizeof(net_req_t));
+    if (r == NULL) {
+        return 0;
+    }
+    memset(r, 0, sizeof(net_req_t));
+    strcpy(r->url, req->url);
+    r->priority = req->priority;
+    r->on_body = req->on_body;
+    r->user_data = req->user_data;
+    if (r->on_body == NULL) {
+        r->blocks = (net_block_t*)lvml_mem_alloc_large(sizeof(net_block_t) * LVML_NET_STREAM_BLOCKS);
+        if (r->blocks == NULL) {
+            lvml_mem_free_large(r);
+            return 0;
+        }
+        lvml_spsc_reset(&r->stream);
+    }
+    r->state = NET_REQ_PENDING;
+    r->queued_at_us = lvml_time_us();
+
+    uint32_t id = 0;
+    uint32_t queued = 0;
+    net_lock();
+    for (uint32_t i = 0; i < LVML_NET_QUEUE_MAX; i++) {
+        if (net_reqs[i] == NULL && id == 0) {
+            r->id = net_next_id++;
+            if (net_next_id == 0) {
+                net_next_id = 1;
+            }
+            net_reqs[i] = r;
+            id = r->id;
+        }
+        if (net_reqs[i] != NULL) {
+            queued++;
+        }
+    }
+    if (id != 0) {
+        net_stats.requests++;
+        if (queued > net_stats.queue_max) {
+            net_stats.queue_max = queued;
+        }
+    }
+    net_unlock();
+
+    if (id == 0) {
+        net_req_free(r);
+        return 0;
+    }
+    net_wake();
+    return id;
+}
+
+int lvml_net_read(uint32_t id, uint8_t* buf, size_t len) {
+    net_lock();
+    int32_t index = net_find(id);
+    net_req_t* r = index >= 0 ? net_reqs[index] : NULL;
+    // Everything was published before the request was marked done
+    bool ended = r != NULL && r->state == NET_REQ_DONE;
+    net_unlock();
+    if (r == NULL || r->blocks == NULL) {
+        return -2;
+    }
+
+    size_t total = 0;
+    while (total < len) {
+        int32_t slot = lvml_spsc_peek(&r->stream, LVML_NET_STREAM_BLOCKS);
+        if (slot < 0) {
+            break;
+        }
+        net_block_t* block = &r->blocks[slot];
+        size_t n = block->len - r->block_pos;
+        if (n > len - total) {
+            n = len - total;
+        }
+        memcpy(buf + total, block->data + r->block_pos, n);
+        total += n;
+        r->block_pos += n;
+        if (r->block_pos == block->len) {
+            r->block_pos = 0;
+            lvml_spsc_release(&r->stream);
+        }
+    }
+
+    if (total == 0 && ended) {
+        return -1;
+    }
+    return (int)total;
+}
+
+bool lvml_net_finish(uint32_t id, lvml_net_result_t* result) {
+    net_lock();
+    int32_t index = net_find(id);
+    net_req_t* r = index >= 0 ? net_reqs[index] : NULL;
+    if (r != NULL && r->state != NET_REQ_DONE) {
+        net_unlock();
+        return false;
+    }
+    if (r != NULL) {
+        net_reqs[index] = NULL;
+    }
+    net_unlock();
+
+    if (r == NULL) {
+        memset(result, 0, sizeof(lvml_net_result_t));
+        result->result = LVML_ERROR_INVALID_PARAM;
+        return true;
+    }
+    *result = r->result;
+    net_req_free(r);
+    return true;
+}
+
+void lvml_net_cancel(uint32_t id) {
+    net_lock();
+    int32_t index = net_find(id);
+    net_req_t* r = index >= 0 ? net_reqs[index] : NULL;
+    if (r != NULL) {
+        if (r->state != NET_REQ_DONE && !r->cancelled) {
+            net_stats.cancelled++;
+        }
+        if (r->state == NET_REQ_RUNNING) {
+            // The network task notices between two pieces of body and frees
+            // it. A body callback may run until then, so that request stays
+            // for lvml_net_finish() to tell when its user data is free.
+            r->cancelled = true;
+            if (r->on_body == NULL) {
+                net_reqs[index] = NULL;
+            }
+            r = NULL;
+        } else {
+            net_reqs[index] = NULL;
+        }
+    }
+    net_unlock();
+    net_req_free(r);
+}
+
+lvml_net_wifi_state_t lvml_net_wifi_state(void) {
+    net_lock();
+    lvml_net_wifi_state_t state = net_wifi;
+    net_unlock();
+    return state;
+}
+
+void lvml_net_get_stats(lvml_net_stats_t* stats) {
+    if (stats != NULL) {
+        net_lock();
+        *stats = net_stats;
+        net_unlock();
+    }
+}
+
+bool lvml_net_buffer_append(const uint8_t* data, size_t len, void* user_data) {
+    lvml_net_buffer_t* buf = (lvml_net_buffer_t*)user_data;
+    size_t limit = buf->limit > 0 ? buf->limit : LVML_MAX_XML_SIZE;
+    if (buf->len + len > limit) {
+        return false;
+    }
+
+    size_t needed = buf->len + len + 1;
+    if (needed > buf->cap) {
+        size_t cap = buf->cap > 0 ? buf->cap : NET_BUFFER_INITIAL_CAP;
+        while (cap < needed) {
+            cap *= 2;
+        }
+        uint8_t* data_new = (uint8_t*)lvml_mem_realloc_large(buf->data, cap);
+        if (data_new == NULL) {
+            return false;
+        }
+        buf->data = data_new;
+        buf->cap = cap;
+    }
+
+    memcpy(buf->data + buf->len, data, len);
+    buf->len += len;
+    buf->data[buf->len] = '\0';
+    return true;
+}
+
+void lvml_net_buffer_free(lvml_net_buffer_t* buf) {
+    if (buf != NULL) {
+        lvml_mem_free_large(buf->data);
+        buf->data = NULL;
+        buf->len = 0;
+        buf->cap = 0;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool net_url_supported(const char* url) {
+    return strncmp(url, "http://", 7) == 0 || (LVML_HTTP_TLS && strncmp(url, "https://", 8) == 0);
+}
+
+/**
+ * Table index of a request; called with the lock held
+ */
+static int32_t net_find(uint32_t id) {
+    for (uint32_t i = 0; i < LVML_NET_QUEUE_MAX; i++) {
+        if (id != 0 && net_reqs[i] != NULL && net_reqs[i]->id == id) {
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
+
+static void net_req_free(net_req_t* req) {
+    if (req != NULL) {
+        lvml_mem_free_large(req->blocks);
+        lvml_mem_free_large(req);
+    }
+}
+
+static bool net_is_cancelled(net_req_t* req) {
+    net_lock();
+    bool cancelled = req->cancelled;
+    net_unlock();
+    return cancelled;
+}
+
+/**
+ * Pick the next request: highest priority first, oldest first within a
+ * priority. While WiFi associates nothing runs; requests that waited too
+ * long for it fail.
+ * @param held set if requests are waiting for WiFi
+ */
+static net_req_t* net_take(bool* held) {
+    *held = false;
+    bool wifi_ready = net_wifi_ready();
+    int64_t now_us = lvml_time_us();
+
+    net_req_t* next = NULL;
+    net_lock();
+    for (uint32_t i = 0; i < LVML_NET_QUEUE_MAX; i++) {
+        net_req_t* r = net_reqs[i];
+        if (r == NULL || r->state != NET_REQ_PENDING) {
+            continue;
+        }
+        if (!wifi_ready) {
+            uint32_t waited_us = (uint32_t)(now_us - r->queued_at_us);
+            if (waited_us < (uint32_t)LVML_NET_WIFI_WAIT_MS * 1000) {
+                *held = true;
+                continue;
+            }
+            r->result.result = LVML_ERROR_NETWORK;
+            r->result.timing.queued_us = waited_us;
+            r->result.timing.total_us = waited_us;
+            r->state = NET_REQ_DONE;
+            net_stats.failed++;
+            continue;
+        }
+        if (next == NULL || r->priority < next->priority ||
+            (r->priority == next->priority && (int32_t)(r->id - next->id) < 0)) {
+            next = r;
+        }
+    }
+    if (next != NULL) {
+        next->state = NET_REQ_RUNNING;
+    }
+    net_unlock();
+    return next;
+}
+
+static void net_run(net_req_t* req) {
+    lvml_net_result_t* res = &req->result;
+    int64_t start_us = lvml_time_us();
+    res->timing.queued_us = (uint32_t)(start_us - req->queued_at_us);
+
+    // Bodies are passed on as they are sent, so gzip isn't offered
+    res->result = lvml_http_request(&net_conn, req->url, NULL, NULL, false);
+    int64_t headers_us = lvml_time_us();
+    if (res->result == LVML_OK) {
+        res->status = net_conn.status;
+        res->reused = net_conn.reused;
+        res->timing.dns_us = net_conn.dns_us;
+        res->timing.connect_us = net_conn.connect_us;
+        res->timing.first_byte_us = (uint32_t)(headers_us - start_us) - net_conn.dns_us - net_conn.connect_us;
+
+        if (res->status >= 200 && res->status < 300) {
+            if (!net_read_body(req)) {
+                res->result = LVML_ERROR_NETWORK;
+            }
+        } else {
+            net_skip_body();
+        }
+    }
+
+    // A connection is only kept when the server allows it and the body was read to the end
+    if (res->result != LVML_OK || !net_conn.keep_alive || !net_conn.body_done) {
+        lvml_http_close(&net_conn);
+    }
+
+    int64_t end_us = lvml_time_us();
+    res->timing.transfer_us = (uint32_t)(end_us - headers_us);
+    res->timing.total_us = (uint32_t)(end_us - req->queued_at_us);
+    net_conn_used_us = end_us;
+}
+
+/**
+ * Pass the body on piece by piece
+ * @return false on errors, when the request was cancelled or the consumer
+ *         gave up
+ */
+static bool net_read_body(net_req_t* req) {
+    for (;;) {
+        if (net_is_cancelled(req)) {
+            return false;
+        }
+
+        // Stream requests receive straight into the next free block
+        int32_t slot = -1;
+        uint8_t* dst = net_chunk;
+        size_t room = sizeof(net_chunk);
+        if (req->blocks != NULL) {
+            slot = net_stream_reserve(req);
+            if (slot < 0) {
+                return false;
+            }
+            dst = req->blocks[slot].data;
+            room = LVML_NET_STREAM_BLOCK_SIZE;
+        }
+
+        int n = lvml_http_read(&net_conn, dst, room);
+        if (n < 0) {
+            return false;
+        }
+        if (n == 0) {
+            return true;
+        }
+        req->result.bytes += n;
+
+        if (req->blocks != NULL) {
+            req->blocks[slot].len = (uint16_t)n;
+            lvml_spsc_publish(&req->stream);
+        } else if (!req->on_body(dst, n, req->user_data)) {
+            return false;
+        }
+    }
+}
+
+/**
+ * Wait for room in a stream; gives up when the request is cancelled or
+ * nobody reads it for LVML_NET_STALL_MS
+ */
+static int32_t net_stream_reserve(net_req_t* req) {
+    int64_t since_us = lvml_time_us();
+    for (;;) {
+        int32_t slot = lvml_spsc_reserve(&req->stream, LVML_NET_STREAM_BLOCKS);
+        if (slot >= 0) {
+            return slot;
+        }
+        if (net_is_cancelled(req) || lvml_time_us() - since_us >= (int64_t)LVML_NET_STALL_MS * 1000) {
+            return -1;
+        }
+        net_sleep_ms(NET_STREAM_POLL_MS);
+    }
+}
+
+/**
+ * Read a short error body so that the connection can be reused
+ */
+static void net_skip_body(void) {
+    uint32_t skipped = 0;
+    while (skipped < NET_SKIP_MAX) {
+        int n = lvml_http_read(&net_conn, net_chunk, sizeof(net_chunk));
+        if (n <= 0) {
+            break;
+        }
+        skipped += n;
+    }
+}
+
+static void net_done(net_req_t* req) {
+    net_lock();
+    // Already released by lvml_net_cancel(), unless it has a body callback
+    bool drop = req->cancelled && req->on_body == NULL;
+    if (!req->cancelled) {
+        if (req->result.result == LVML_OK) {
+            net_stats.completed++;
+        } else {
+            net_stats.failed++;
+        }
+    }
+    if (!drop) {
+        req->state = NET_REQ_DONE;
+    }
+    if (req->result.result == LVML_OK || req->result.status != 0) {
+        if (req->result.reused) {
+            net_stats.reused++;
+        } else {
+            net_stats.connections++;
+        }
+    }
+    net_stats.bytes += req->result.bytes;
+    net_stats.last = req->result.timing;
+    net_unlock();
+
+    if (drop) {
+        net_req_free(req);
+    }
+}
+
+/**
+ * How long the idle task may sleep: until a held request should be
+ * checked again, the kept-alive connection expires or WiFi is retried
+ */
+static uint32_t net_task_wait_ms(bool held) {
+    uint32_t wait_ms = net_wifi_service();
+    if (held && wait_ms > NET_WIFI_POLL_MS) {
+        wait_ms = NET_WIFI_POLL_MS;
+    }
+    if (net_conn.sock >= 0) {
+        int64_t idle_ms = (lvml_time_us() - net_conn_used_us) / 1000;
+        if (idle_ms >= LVML_NET_IDLE_MS) {
+            lvml_http_close(&net_conn);
+        } else if ((uint32_t)(LVML_NET_IDLE_MS - idle_ms) < wait_ms) {
+            wait_ms = (uint32_t)(LVML_NET_IDLE_MS - idle_ms);
+        }
+    }
+    return wait_ms;
+}
+
+static void net_task_run(void) {
+    for (;;) {
+        bool held;
+        net_req_t* req = net_take(&held);
+        if (req == NULL) {
+            net_wait(net_task_wait_ms(held));
+            continue;
+        }
+        net_run(req);
+        net_done(req);
+    }
+}
+
+#ifdef ESP_PLATFORM
+
+static void net_task_entry(void* arg) {
+    (void)arg;
+    net_task_run();
+}
+
+/**
+ * Follow the station; a network set with lvml_net_wifi_connect() is
+ * reconnected by the network task with a growing delay
+ */
+static void net_wifi_event(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    (void)arg;
+    (void)data;
+    net_lock();
+    if (base == WIFI_EVENT && id == WIFI_EVENT_STA_DISCONNECTED) {
+        if (net_wifi == LVML_NET_WIFI_CONNECTED) {
+            net_stats.wifi_disconnects++;
+        }
+        net_wifi = LVML_NET_WIFI_DISCONNECTED;
+        if (net_wifi_managed && net_wifi_retry_at_us == 0) {
+            net_wifi_retry_at_us = lvml_time_us() + (int64_t)net_wifi_retry_ms * 1000;
+            net_wifi_retry_ms = net_wifi_retry_ms * 2 < NET_WIFI_RETRY_MAX_MS ? net_wifi_retry_ms * 2 : NET_WIFI_RETRY_MAX_MS;
+        }
+    } else if (base == IP_EVENT && id == IP_EVENT_STA_GOT_IP) {
+        net_wifi = LVML_NET_WIFI_CONNECTED;
+        net_wifi_retry_ms = NET_WIFI_RETRY_MS;
+        net_wifi_retry_at_us = 0;
+        net_stats.wifi_connects++;
+    }
+    net_unlock();
+    net_wake();
+}
+
+lvml_error_t lvml_net_wifi_connect(const char* ssid, const char* password) {
+    wifi_config_t cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    if (ssid == NULL || password == NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    size_t ssid_len = strlen(ssid);
+    size_t password_len = strlen(password);
+    if (ssid_len == 0 || ssid_len > sizeof(cfg.sta.ssid) || password_len >= sizeof(cfg.sta.password)) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    memcpy(cfg.sta.ssid, ssid, ssid_len);
+    memcpy(cfg.sta.password, password, password_len);
+
+    // The driver belongs to MicroPython's network module
+    wifi_mode_t mode;
+    if (esp_wifi_get_mode(&mode) != ESP_OK || !net_start()) {
+        return LVML_ERROR_INIT;
+    }
+    if (mode == WIFI_MODE_NULL && esp_wifi_set_mode(WIFI_MODE_STA) != ESP_OK) {
+        return LVML_ERROR_NETWORK;
+    }
+    if (esp_wifi_start() != ESP_OK) {
+        return LVML_ERROR_NETWORK;
+    }
+    esp_wifi_disconnect();
+
+    net_lock();
+    net_wifi_managed = true;
+    net_wifi = LVML_NET_WIFI_CONNECTING;
+    net_wifi_retry_ms = NET_WIFI_RETRY_MS;
+    net_wifi_retry_at_us = 0;
+    net_unlock();
+
+    if (esp_wifi_set_config(WIFI_IF_STA, &cfg) != ESP_OK || esp_wifi_connect() != ESP_OK) {
+        net_lock();
+        net_wifi = LVML_NET_WIFI_DISCONNECTED;
+        net_unlock();
+        return LVML_ERROR_NETWORK;
+    }
+    return LVML_OK;
+}
+
+/**
+ * Requests run unless the station is (re)associating; without any WiFi
+ * activity they are tried anyway, e.g. over a connection made elsewhere
+ */
+static bool net_wifi_ready(void) {
+    net_lock();
+    bool ready = net_wifi == LVML_NET_WIFI_CONNECTED || net_wifi == LVML_NET_WIFI_OFF;
+    net_unlock();
+    return ready;
+}
+
+/**
+ * Reconnect when the retry delay has passed
+ * @return milliseconds until the next retry, or NET_WAIT_FOREVER
+ */
+static uint32_t net_wifi_service(void) {
+    int64_t now_us = lvml_time_us();
+    net_lock();
+    bool due = net_wifi_retry_at_us != 0 && now_us >= net_wifi_retry_at_us;
+    if (due) {
+        net_wifi_retry_at_us = 0;
+        net_wifi = LVML_NET_WIFI_CONNECTING;
+    }
+    uint32_t wait_ms = net_wifi_retry_at_us != 0 ? (uint32_t)((net_wifi_retry_at_us - now_us) / 1000) + 1 : NET_WAIT_FOREVER;
+    net_unlock();
+
+    if (due) {
+        esp_wifi_connect();
+    }
+    return wait_ms;
+}
+
+static bool net_start(void) {
+    if (net_started) {
+        return true;
+    }
+    net_mutex = xSemaphoreCreateMutex();
+    net_wake_sem = xSemaphoreCreateCounting(LVML_NET_QUEUE_MAX, 0);
+    if (net_mutex == NULL || net_wake_sem == NULL) {
+        return false;
+    }
+
+    // The station may already be up, connected from MicroPython
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK) {
+        net_wifi = LVML_NET_WIFI_CONNECTED;
+    }
+    esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, net_wifi_event, NULL);
+    esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP, net_wifi_event, NULL);
+
+    lvml_http_init(&net_conn);
+    if (xTaskCreate(net_task_entry, "lvml_net", NET_TASK_STACK, NULL, tskIDLE_PRIORITY + NET_TASK_PRIORITY, NULL) != pdPASS) {
+        return false;
+    }
+    net_started = true;
+    return true;
+}
+
+static void net_lock(void) {
+    if (net_mutex != NULL) {
+        xSemaphoreTake(net_mutex, portMAX_DELAY);
+    }
+}
+
+static void net_unlock(void) {
+    if (net_mutex != NULL) {
+        xSemaphoreGive(net_mutex);
+    }
+}
+
+static void net_wake(void) {
+    xSemaphoreGive(net_wake_sem);
+}
+
+static bool net_wait(uint32_t timeout_ms) {
+    TickType_t ticks = timeout_ms == NET_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms) + 1;
+    return xSemaphoreTake(net_wake_sem, ticks) == pdTRUE;
+}
+
+static void net_sleep_ms(uint32_t ms) {
+    TickType_t ticks = pdMS_TO_TICKS(ms);
+    vTaskDelay(ticks > 0 ? ticks : 1);
+}
+
+#else
+
+static void* net_thread_entry(void* arg) {
+    (void)arg;
+    net_task_run();
+    return NULL;
+}
+
+/**
+ * The host's network is used as it is
+ */
+lvml_error_t lvml_net_wifi_connect(const char* ssid, const char* password) {
+    if (ssid == NULL || password == NULL || ssid[0] == '\0') {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    return LVML_OK;
+}
+
+static bool net_wifi_ready(void) {
+    return true;
+}
+
+static uint32_t net_wifi_service(void) {
+    return NET_WAIT_FOREVER;
+}
+
+static bool net_start(void) {
+    if (net_started) {
+        return true;
+    }
+    lvml_http_init(&net_conn);
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, net_thread_entry, NULL) != 0) {
+        return false;
+    }
+    pthread_detach(thread);
+    net_started = true;
+    return true;
+}
+
+static void net_lock(void) {
+    pthread_mutex_lock(&net_mutex);
+}
+
+static void net_unlock(void) {
+    pthread_mutex_unlock(&net_mutex);
+}
+
+static void net_wake(void) {
+    pthread_mutex_lock(&net_mutex);
+    net_wake_pending++;
+    pthread_cond_signal(&net_cond);
+    pthread_mutex_unlock(&net_mutex);
+}
+
+static bool net_wait(uint32_t timeout_ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&net_mutex);
+    int err = 0;
+    while (net_wake_pending == 0 && err == 0) {
+        if (timeout_ms == NET_WAIT_FOREVER) {
+            pthread_cond_wait(&net_cond, &net_mutex);
+        } else {
+            err = pthread_cond_timedwait(&net_cond, &net_mutex, &deadline);
+        }
+    }
+    bool woken = net_wake_pending > 0;
+    if (woken) {
+        net_wake_pending--;
+    }
+    pthread_mutex_unlock(&net_mutex);
+    return woken;
+}
+
+static void net_sleep_ms(uint32_t ms) {
+    usleep(ms * 1000);
+}
+
+#endif
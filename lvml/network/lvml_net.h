@@ -0,0 +1,220 @@
+/**
+ * @file lvml_net.h
+ * @brief Network manager: WiFi state and prioritised HTTP(S) GETs on one task
+ *
+ * Requests are queued with a priority and run one at a time, in priority
+ * order and first come first served within a priority, on a network task
+ * (a thread on Linux). The task keeps the connection of the last request
+ * open and reuses it for the next request to the same server, so a burst
+ * of requests to one host pays for DNS and the TCP/TLS handshakes once.
+ *
+ * Response bodies are never collected by the manager. They are handed on
+ * in pieces as they arrive, either to a callback running on the network
+ * task (C consumers: a decoder, a file, lvml_net_buffer_append()) or to a
+ * small per-request stream that the main thread drains with
+ * lvml_net_read(). A full stream holds the download back until it is read.
+ *
+ * Every request records how long it waited in the queue, the DNS lookup,
+ * connecting, the time to the response headers and the body transfer.
+ * Requests are read, finished and cancelled from one thread (the
+ * MicroPython thread on the device); the network task only fills them.
+ *
+ * On the ESP32 the manager follows the WiFi station through esp_event and
+ * holds requests back while it is still associating. On Linux the host's
+ * network is used as is and WiFi always reads as connected.
+ */
+
+#ifndef LVML_NET_H
+#define LVML_NET_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_NET_QUEUE_MAX 16                 // Requests queued, running or waiting to be finished
+#define LVML_NET_STREAM_BLOCKS 16             // Stream of a request read with lvml_net_read() (power of two)
+#define LVML_NET_STREAM_BLOCK_SIZE 512
+#define LVML_NET_IDLE_MS 15000                // An unused keep-alive connection is closed after this
+#define LVML_NET_STALL_MS 30000               // A stream nobody reads fails the request after this
+#define LVML_NET_WIFI_WAIT_MS 20000           // Longest a request waits for WiFi to associate
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LVML_NET_PRIORITY_HIGH = 0,     // What the user is waiting for, e.g. the next screen
+    LVML_NET_PRIORITY_NORMAL,
+    LVML_NET_PRIORITY_LOW,          // Background work such as prefetches
+    LVML_NET_PRIORITY_COUNT,
+} lvml_net_priority_t;
+
+typedef enum {
+    LVML_NET_WIFI_OFF = 0,          // Not started, or WiFi isn't initialized
+    LVML_NET_WIFI_CONNECTING,
+    LVML_NET_WIFI_CONNECTED,        // Associated and holding an IP address
+    LVML_NET_WIFI_DISCONNECTED,     // Lost; lvml_net_wifi_connect() networks are retried
+} lvml_net_wifi_state_t;
+
+/**
+ * Receives body data on the network task
+ * @param data body bytes, only valid during the call
+ * @param len number of bytes
+ * @param user_data user pointer of the request
+ * @return false to abort the request
+ */
+typedef bool (*lvml_net_body_cb_t)(const uint8_t* data, size_t len, void* user_data);
+
+/**
+ * A GET request
+ */
+typedef struct {
+    const char* url;                // http:// (or https:// on the ESP32), copied
+    lvml_net_priority_t priority;
+    lvml_net_body_cb_t on_body;     // Body of 2xx responses; NULL: read it with lvml_net_read()
+    void* user_data;
+} lvml_net_request_t;
+
+/**
+ * Where the time of one request went, in microseconds
+ */
+typedef struct {
+    uint32_t queued_us;             // Waiting for the network task
+    uint32_t dns_us;                // Name lookup (0 on a reused connection)
+    uint32_t connect_us;            // TCP connect and TLS handshake (0 on a reused connection)
+    uint32_t first_byte_us;         // Sending the request until the headers were read
+    uint32_t transfer_us;           // Body, including time spent in consumers
+    uint32_t total_us;              // Queued until finished
+} lvml_net_timing_t;
+
+/**
+ * Outcome of a request
+ */
+typedef struct {
+    lvml_error_t result;            // LVML_OK if the whole response was received and consumed
+    int status;                     // HTTP status, 0 without a response
+    uint32_t bytes;                 // Body bytes delivered
+    bool reused;                    // Ran on a kept-alive connection
+    lvml_net_timing_t timing;
+} lvml_net_result_t;
+
+/**
+ * Network manager statistics
+ */
+typedef struct {
+    uint32_t requests;              // Queued with lvml_net_get()
+    uint32_t completed;             // Finished with a response
+    uint32_t failed;
+    uint32_t cancelled;
+    uint32_t connections;           // Connections opened
+    uint32_t reused;                // Requests that ran on a kept-alive connection
+    uint32_t bytes;                 // Body bytes delivered
+    uint32_t queue_max;             // Most requests queued at once
+    uint32_t wifi_connects;         // Times WiFi got an IP address
+    uint32_t wifi_disconnects;
+    lvml_net_timing_t last;         // Timing of the last finished request
+} lvml_net_stats_t;
+
+/**
+ * Body collected in memory from lvml_mem_alloc_large() by
+ * lvml_net_buffer_append(), e.g. for the XML loader or the image decoder
+ */
+typedef struct {
+    uint8_t* data;                  // NUL-terminated
+    size_t len;
+    size_t cap;
+    size_t limit;                   // Largest body accepted (0: LVML_MAX_XML_SIZE)
+} lvml_net_buffer_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Queue a GET request; the network task is started on first use
+ * @param req request
+ * @return request id, or 0 if the URL is invalid, the queue is full or
+ *         the task can't be started
+ */
+uint32_t lvml_net_get(const lvml_net_request_t* req);
+
+/**
+ * Read body data of a request without a body callback
+ * @param id request id
+ * @param buf output buffer
+ * @param len buffer size
+ * @return number of bytes read, 0 if nothing has arrived yet, -1 once the
+ *         body has ended (or the request failed), -2 if the request doesn't
+ *         exist or has a body callback
+ */
+int lvml_net_read(uint32_t id, uint8_t* buf, size_t len);
+
+/**
+ * Collect the result of a finished request and release it
+ * @param id request id
+ * @param result receives the result
+ * @return false while the request is queued or running; true once result
+ *         is filled in (LVML_ERROR_INVALID_PARAM for unknown ids)
+ */
+bool lvml_net_finish(uint32_t id, lvml_net_result_t* result);
+
+/**
+ * Drop a request; a running one is aborted before its next piece of body.
+ * A running request with a body callback is only released by
+ * lvml_net_finish(), which returns false until the callback can't be
+ * called any more.
+ * @param id request id
+ */
+void lvml_net_cancel(uint32_t id);
+
+/**
+ * Connect the WiFi station and keep it connected
+ * @param ssid network name
+ * @param password password (empty for open networks)
+ * @return LVML_OK once association has started, LVML_ERROR_INIT if the
+ *         WiFi driver isn't initialized (network.WLAN().active(True)),
+ *         LVML_ERROR_INVALID_PARAM, LVML_ERROR_NETWORK
+ */
+lvml_error_t lvml_net_wifi_connect(const char* ssid, const char* password);
+
+/**
+ * Get the WiFi station state
+ * @return state
+ */
+lvml_net_wifi_state_t lvml_net_wifi_state(void);
+
+/**
+ * Get network manager statistics
+ * @param stats output statistics
+ */
+void lvml_net_get_stats(lvml_net_stats_t* stats);
+
+/**
+ * Body callback collecting the body in a lvml_net_buffer_t
+ * @param data body bytes
+ * @param len number of bytes
+ * @param user_data the lvml_net_buffer_t, zeroed or with a limit set
+ * @return false if the body is over the limit or out of memory
+ */
+bool lvml_net_buffer_append(const uint8_t* data, size_t len, void* user_data);
+
+/**
+ * Release the memory of a lvml_net_buffer_t
+ * @param buf buffer
+ */
+void lvml_net_buffer_free(lvml_net_buffer_t* buf);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_NET_H*/
@@ -0,0 +1,133 @@
+/**
+ * @file lvml_prefetch.c
+ * @brief Prefetch the screens and assets a fetched document links to
+ */
+
+#include "lvml_prefetch.h"
+#include "lvml_fetch.h"
+#include "xml/lvml_xml_scan.h"
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const char* base_url;
+    bool screens;
+    uint32_t queued;
+} prefetch_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool prefetch_attr_cb(lvml_xml_str_t tag, lvml_xml_str_t name, lvml_xml_str_t value, void* user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lvml_prefetch_stats_t prefetch_stats;
+static uint64_t prefetch_total_us = 0;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lvml_prefetch_links(const char* xml, const char* base_url, bool screens) {
+    if (xml == NULL || base_url == NULL) {
+        return 0;
+    }
+
+    prefetch_ctx_t ctx = {
+        .base_url = base_url,
+        .screens = screens,
+        .queued = 0,
+    };
+    lvml_xml_scan_attrs(xml, prefetch_attr_cb, &ctx);
+
+    prefetch_stats.links += ctx.queued;
+    return ctx.queued;
+}
+
+bool lvml_prefetch_resolve(const char* base_url, const char* ref, char* url) {
+    if (strncmp(base_url, "http://", 7) != 0 || ref[0] == '\0' || ref[0] == '#') {
+        return false;
+    }
+    if (strncmp(ref, "http://", 7) == 0) {
+        if (strlen(ref) >= LVML_MAX_URL_LENGTH) {
+            return false;
+        }
+        strcpy(url, ref);
+        return true;
+    }
+    // Other schemes and LVGL drive paths ("A:img.png") are not fetched
+    if (strchr(ref, ':') != NULL) {
+        return false;
+    }
+
+    // Keep the scheme and host for "/path", the directory for "path"
+    const char* host_end = strchr(base_url + 7, '/');
+    size_t keep;
+    if (ref[0] == '/') {
+        keep = host_end != NULL ? (size_t)(host_end - base_url) : strlen(base_url);
+    } else if (host_end != NULL) {
+        keep = strrchr(base_url, '/') - base_url + 1;
+    } else {
+        keep = strlen(base_url);
+    }
+
+    bool slash = ref[0] != '/' && host_end == NULL;
+    size_t ref_len = strlen(ref);
+    if (keep + slash + ref_len >= LVML_MAX_URL_LENGTH) {
+        return false;
+    }
+    memcpy(url, base_url, keep);
+    if (slash) {
+        url[keep++] = '/';
+    }
+    memcpy(url + keep, ref, ref_len + 1);
+    return true;
+}
+
+void lvml_prefetch_record_navigation(uint32_t us, bool prefetched) {
+    prefetch_stats.navigations++;
+    if (prefetched) {
+        prefetch_stats.prefetched++;
+    }
+    prefetch_total_us += us;
+    prefetch_stats.last_us = us;
+    prefetch_stats.avg_us = (uint32_t)(prefetch_total_us / prefetch_stats.navigations);
+    if (us > prefetch_stats.max_us) {
+        prefetch_stats.max_us = us;
+    }
+}
+
+void lvml_prefetch_get_stats(lvml_prefetch_stats_t* stats) {
+    if (stats != NULL) {
+        *stats = prefetch_stats;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool prefetch_attr_cb(lvml_xml_str_t tag, lvml_xml_str_t name, lvml_xml_str_t value, void* user_data) {
+    (void)tag;
+    prefetch_ctx_t* ctx = (prefetch_ctx_t*)user_data;
+    bool asset = lvml_xml_str_eq(name, "src");
+    bool screen = ctx->screens && lvml_xml_str_eq(name, "href");
+    if (!asset && !screen) {
+        return true;
+    }
+
+    char ref[LVML_FETCH_REF_MAX];
+    char url[LVML_MAX_URL_LENGTH];
+    if (lvml_xml_str_copy(value, ref, sizeof(ref)) && lvml_prefetch_resolve(ctx->base_url, ref, url) &&
+        lvml_fetch_prefetch(url, ref)) {
+        ctx->queued++;
+    }
+    return ctx->queued < LVML_PREFETCH_LINKS_MAX;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file lvml_prefetch.h
+ * @brief Prefetch the screens and assets a fetched document links to
+ *
+ * Links are discovered with the XML attribute scanner: href attributes name
+ * screens the user can navigate to, src attributes name images and scripts.
+ * Every link is resolved against the document URL and queued with
+ * lvml_fetch_prefetch(), so the next navigation is served from memory.
+ */
+
+#ifndef LVML_PREFETCH_H
+#define LVML_PREFETCH_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_PREFETCH_LINKS_MAX 16              // Links queued per document
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Navigation statistics
+ */
+typedef struct {
+    uint32_t navigations;   // Documents shown by URL
+    uint32_t prefetched;    // ... that were already prefetched
+    uint32_t links;         // Links queued for prefetching
+    uint32_t last_us;       // Latency of the last navigation
+    uint32_t avg_us;
+    uint32_t max_us;
+} lvml_prefetch_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Queue the links of a document for prefetching
+ * @param xml NUL-terminated XML document
+ * @param base_url URL the document was loaded from
+ * @param screens also queue linked screens (href), not only assets (src)
+ * @return number of links queued
+ */
+uint32_t lvml_prefetch_links(const char* xml, const char* base_url, bool screens);
+
+/**
+ * Resolve a link against the URL of the document containing it
+ * @param base_url document URL
+ * @param ref absolute http:// URL, host-relative path ("/a/b.xml") or relative path
+ * @param url output buffer of LVML_MAX_URL_LENGTH bytes
+ * @return false if the link can't be fetched or is too long
+ */
+bool lvml_prefetch_resolve(const char* base_url, const char* ref, char* url);
+
+/**
+ * Record how long a navigation took, from request to loaded screen
+ * @param us latency in microseconds
+ * @param prefetched the document came from the prefetch cache
+ */
+void lvml_prefetch_record_navigation(uint32_t us, bool prefetched);
+
+/**
+ * Get navigation statistics
+ * @param stats output statistics
+ */
+void lvml_prefetch_get_stats(lvml_prefetch_stats_t* stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_PREFETCH_H*/
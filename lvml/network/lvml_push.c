@@ -0,0 +1,607 @@
+/**
+ * @file lvml_push.c
+ * @brief Persistent server push channel for UI updates
+ */
+
+#include "lvml_push.h"
+#include "utils/lvml_mem.h"
+#include "utils/lvml_spsc.h"
+#include "utils/lvml_time.h"
+#include "utils/lvml_varint.h"
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define PUSH_TASK_STACK 4096
+#define PUSH_TASK_PRIORITY 1
+#define PUSH_POLL_MS 10                       // Receive timeout; acks and close are handled in between
+#define PUSH_FULL_POLL_MS 5                   // How often a full ring is checked for room
+#define PUSH_SEND_TIMEOUT_MS 5000
+#define PUSH_RETRY_MS 1000                    // First reconnect delay, doubled up to PUSH_RETRY_MAX_MS
+#define PUSH_RETRY_MAX_MS 30000
+#define PUSH_SKIP_CHUNK 256
+#define PUSH_WAIT_FOREVER UINT32_MAX
+
+// A server that went away must not kill the process (SIGPIPE) on Linux
+#ifdef MSG_NOSIGNAL
+#define PUSH_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define PUSH_SEND_FLAGS 0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t len;
+    int64_t received_us;
+    uint8_t data[LVML_PUSH_UPDATE_MAX];
+} push_update_t;
+
+/**
+ * Channel task state of one connection
+ */
+typedef struct {
+    int sock;
+    uint32_t generation;                 // push_generation the connection was made for
+    uint32_t acked;                      // Ring tail up to which updates were acknowledged
+    uint32_t skipped;                    // Oversized updates not acknowledged yet
+} push_session_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void push_task_run(void);
+static int push_connect_socket(const char* host, uint16_t port);
+static void push_session_run(push_session_t* s);
+static bool push_service(push_session_t* s);
+static bool push_send_varint(push_session_t* s, uint32_t value);
+static bool push_recv_all(push_session_t* s, uint8_t* buf, size_t len);
+static bool push_recv_varint(push_session_t* s, uint32_t* value, uint32_t* size);
+static bool push_skip(push_session_t* s, uint32_t len);
+static int32_t push_reserve(push_session_t* s);
+static bool push_start(void);
+static void push_lock(void);
+static void push_unlock(void);
+static void push_wake(void);
+static void push_wait(uint32_t timeout_ms);
+static void push_sleep_ms(uint32_t ms);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+// Server, connection state and statistics, protected by push_lock()
+static char push_host[LVML_PUSH_HOST_MAX];
+static uint16_t push_port = 0;
+static bool push_active = false;
+static uint32_t push_generation = 0;     // Bumped by every connect and close
+static lvml_push_stats_t push_stats;
+static uint64_t push_latency_sum_us = 0;
+static bool push_started = false;
+
+// Updates, filled by the channel task and drained by lvml_push_poll()
+static push_update_t* push_updates = NULL;
+static lvml_spsc_t push_ring;
+
+#ifdef ESP_PLATFORM
+static SemaphoreHandle_t push_mutex = NULL;
+static SemaphoreHandle_t push_wake_sem = NULL;
+#else
+static pthread_mutex_t push_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t push_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t push_wake_pending = 0;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_push_connect(const char* host, uint16_t port) {
+    if (host == NULL || host[0] == '\0' || strlen(host) >= LVML_PUSH_HOST_MAX || port == 0) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    if (push_updates == NULL) {
+        push_updates = (push_update_t*)lvml_mem_alloc_large(sizeof(push_update_t) * LVML_PUSH_SLOTS);
+        if (push_updates == NULL) {
+            return LVML_ERROR_MEMORY;
+        }
+        lvml_spsc_reset(&push_ring);
+    }
+    if (!push_start()) {
+        return LVML_ERROR_INIT;
+    }
+
+    push_lock();
+    strcpy(push_host, host);
+    push_port = port;
+    push_active = true;
+    push_generation++;
+    push_unlock();
+    push_wake();
+    return LVML_OK;
+}
+
+void lvml_push_close(void) {
+    push_lock();
+    push_active = false;
+    push_generation++;
+    push_unlock();
+    push_wake();
+}
+
+uint32_t lvml_push_poll(lvml_push_apply_cb_t apply, void* user_data, uint32_t budget_us) {
+    if (push_updates == NULL || apply == NULL) {
+        return 0;
+    }
+
+    int64_t start_us = lvml_time_us();
+    uint32_t applied = 0;
+    uint32_t refused = 0;
+    uint32_t last_latency_us = 0;
+    uint32_t max_latency_us = 0;
+    uint64_t latency_sum_us = 0;
+    int32_t slot;
+    while ((slot = lvml_spsc_peek(&push_ring, LVML_PUSH_SLOTS)) >= 0) {
+        push_update_t* update = &push_updates[slot];
+        if (!apply(update->data, update->len, user_data)) {
+            refused++;
+        }
+        int64_t now_us = lvml_time_us();
+        last_latency_us = (uint32_t)(now_us - update->received_us);
+        latency_sum_us += last_latency_us;
+        if (last_latency_us > max_latency_us) {
+            max_latency_us = last_latency_us;
+        }
+        lvml_spsc_release(&push_ring);
+        applied++;
+        if (now_us - start_us >= (int64_t)budget_us) {
+            break;
+        }
+    }
+    if (applied == 0) {
+        return 0;
+    }
+
+    uint32_t batch_us = (uint32_t)(lvml_time_us() - start_us);
+    push_lock();
+    push_stats.updates += applied - refused;
+    push_stats.errors += refused;
+    push_stats.batches++;
+    push_stats.apply_us += batch_us;
+    if (batch_us > push_stats.batch_max_us) {
+        push_stats.batch_max_us = batch_us;
+    }
+    push_stats.last_latency_us = last_latency_us;
+    if (max_latency_us > push_stats.max_latency_us) {
+        push_stats.max_latency_us = max_latency_us;
+    }
+    push_latency_sum_us += latency_sum_us;
+    push_unlock();
+    return applied;
+}
+
+void lvml_push_get_stats(lvml_push_stats_t* stats, bool reset) {
+    if (stats == NULL) {
+        return;
+    }
+    push_lock();
+    *stats = push_stats;
+    uint32_t count = push_stats.updates + push_stats.errors;
+    stats->avg_latency_us = count > 0 ? (uint32_t)(push_latency_sum_us / count) : 0;
+    if (reset) {
+        bool connected = push_stats.connected;
+        memset(&push_stats, 0, sizeof(push_stats));
+        push_stats.connected = connected;
+        push_latency_sum_us = 0;
+    }
+    push_unlock();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void push_task_run(void) {
+    uint32_t retry_ms = PUSH_RETRY_MS;
+    for (;;) {
+        push_lock();
+        bool active = push_active;
+        char host[LVML_PUSH_HOST_MAX];
+        strcpy(host, push_host);
+        uint16_t port = push_port;
+        uint32_t generation = push_generation;
+        push_unlock();
+        if (!active) {
+            retry_ms = PUSH_RETRY_MS;
+            push_wait(PUSH_WAIT_FOREVER);
+            continue;
+        }
+
+        push_session_t s = {
+            .sock = push_connect_socket(host, port),
+            .generation = generation,
+            // Updates of an earlier connection that are still queued aren't this server's to count
+            .acked = push_ring.head,
+        };
+        if (s.sock >= 0) {
+            push_lock();
+            push_stats.connected = true;
+            push_stats.connects++;
+            push_unlock();
+
+            int64_t connected_us = lvml_time_us();
+            push_session_run(&s);
+            close(s.sock);
+
+            push_lock();
+            push_stats.connected = false;
+            push_stats.disconnects++;
+            push_unlock();
+            // A connection that lasted a while was fine; start over with short delays
+            if (lvml_time_us() - connected_us >= (int64_t)PUSH_RETRY_MAX_MS * 1000) {
+                retry_ms = PUSH_RETRY_MS;
+            }
+        }
+
+        // Reconnect after a delay unless connect() or close() changes the plan meanwhile;
+        // a wake left over from earlier doesn't cut the delay short
+        int64_t retry_us = lvml_time_us() + (int64_t)retry_ms * 1000;
+        for (;;) {
+            push_lock();
+            bool changed = push_generation != generation;
+            push_unlock();
+            if (changed) {
+                retry_ms = PUSH_RETRY_MS;
+                break;
+            }
+            int64_t left_us = retry_us - lvml_time_us();
+            if (left_us <= 0) {
+                retry_ms = retry_ms * 2 < PUSH_RETRY_MAX_MS ? retry_ms * 2 : PUSH_RETRY_MAX_MS;
+                break;
+            }
+            push_wait((uint32_t)((left_us + 999) / 1000));
+        }
+    }
+}
+
+static int push_connect_socket(const char* host, uint16_t port) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    char port_str[8];
+    snprintf(port_str, sizeof(port_str), "%u", port);
+    struct addrinfo* res = NULL;
+    if (getaddrinfo(host, port_str, &hints, &res) != 0 || res == NULL) {
+        return -1;
+    }
+
+    int sock = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (sock >= 0) {
+        // Short receive timeouts let the task send acks and notice close() while idle
+        struct timeval rcv = { .tv_sec = 0, .tv_usec = PUSH_POLL_MS * 1000 };
+        struct timeval snd = {
+            .tv_sec = PUSH_SEND_TIMEOUT_MS / 1000,
+            .tv_usec = (PUSH_SEND_TIMEOUT_MS % 1000) * 1000,
+        };
+        int one = 1;
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &rcv, sizeof(rcv));
+        setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &snd, sizeof(snd));
+        // Acks are a byte or two; don't let Nagle hold them back
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        if (connect(sock, res->ai_addr, res->ai_addrlen) != 0) {
+            close(sock);
+            sock = -1;
+        }
+    }
+    freeaddrinfo(res);
+    return sock;
+}
+
+/**
+ * Receive updates until the connection fails or is closed
+ */
+static void push_session_run(push_session_t* s) {
+    uint8_t hello[4 + 2 * LVML_VARINT_MAX] = { 'L', 'V', 'P', LVML_PUSH_VERSION };
+    size_t len = 4;
+    len += lvml_varint_put(hello + len, LVML_PUSH_SLOTS);
+    len += lvml_varint_put(hello + len, LVML_PUSH_UPDATE_MAX);
+    if (send(s->sock, hello, len, PUSH_SEND_FLAGS) != (ssize_t)len) {
+        return;
+    }
+
+    for (;;) {
+        uint32_t size;
+        uint32_t header;
+        if (!push_recv_varint(s, &size, &header)) {
+            return;
+        }
+        if (size == 0) {
+            continue;
+        }
+        if (size > LVML_PUSH_UPDATE_MAX) {
+            if (!push_skip(s, size)) {
+                return;
+            }
+            push_lock();
+            push_stats.errors++;
+            push_stats.bytes += header + size;
+            push_unlock();
+            s->skipped++;
+            continue;
+        }
+
+        int32_t slot = push_reserve(s);
+        if (slot < 0) {
+            return;
+        }
+        push_update_t* update = &push_updates[slot];
+        if (!push_recv_all(s, update->data, size)) {
+            return;
+        }
+        update->len = size;
+        update->received_us = lvml_time_us();
+        lvml_spsc_publish(&push_ring);
+
+        uint32_t queued = lvml_spsc_count(&push_ring);
+        push_lock();
+        push_stats.bytes += header + size;
+        if (queued > push_stats.queue_max) {
+            push_stats.queue_max = queued;
+        }
+        push_unlock();
+        if (!push_service(s)) {
+            return;
+        }
+    }
+}
+
+/**
+ * Acknowledge updates applied since the last ack
+ * @return false if the connection was closed or replaced, or sending failed
+ */
+static bool push_service(push_session_t* s) {
+    push_lock();
+    bool current = push_active && push_generation == s->generation;
+    push_unlock();
+    if (!current) {
+        return false;
+    }
+
+    uint32_t tail = __atomic_load_n(&push_ring.tail, __ATOMIC_ACQUIRE);
+    int32_t applied = (int32_t)(tail - s->acked);
+    uint32_t count = (applied > 0 ? (uint32_t)applied : 0) + s->skipped;
+    if (count == 0) {
+        return true;
+    }
+    if (!push_send_varint(s, count)) {
+        return false;
+    }
+    if (applied > 0) {
+        s->acked = tail;
+    }
+    s->skipped = 0;
+    push_lock();
+    push_stats.acks++;
+    push_unlock();
+    return true;
+}
+
+static bool push_send_varint(push_session_t* s, uint32_t value) {
+    uint8_t buf[LVML_VARINT_MAX];
+    size_t len = lvml_varint_put(buf, value);
+    return send(s->sock, buf, len, PUSH_SEND_FLAGS) == (ssize_t)len;
+}
+
+/**
+ * Receive exactly len bytes; acks are sent while waiting
+ */
+static bool push_recv_all(push_session_t* s, uint8_t* buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = recv(s->sock, buf, len, 0);
+        if (n > 0) {
+            buf += n;
+            len -= (size_t)n;
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            if (!push_service(s)) {
+                return false;
+            }
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @param size receives the number of bytes the varint took
+ */
+static bool push_recv_varint(push_session_t* s, uint32_t* value, uint32_t* size) {
+    lvml_varint_decoder_t d = { 0 };
+    for (uint32_t n = 1;; n++) {
+        uint8_t b;
+        if (!push_recv_all(s, &b, 1)) {
+            return false;
+        }
+        int res = lvml_varint_feed(&d, b);
+        if (res < 0) {
+            return false;
+        }
+        if (res > 0) {
+            *value = d.value;
+            *size = n;
+            return true;
+        }
+    }
+}
+
+static bool push_skip(push_session_t* s, uint32_t len) {
+    uint8_t buf[PUSH_SKIP_CHUNK];
+    while (len > 0) {
+        uint32_t n = len < sizeof(buf) ? len : sizeof(buf);
+        if (!push_recv_all(s, buf, n)) {
+            return false;
+        }
+        len -= n;
+    }
+    return true;
+}
+
+/**
+ * Wait for a free slot; meanwhile nothing is read, so TCP holds the server back
+ */
+static int32_t push_reserve(push_session_t* s) {
+    int32_t slot = lvml_spsc_reserve(&push_ring, LVML_PUSH_SLOTS);
+    if (slot >= 0) {
+        return slot;
+    }
+    push_lock();
+    push_stats.full_waits++;
+    push_unlock();
+    while ((slot = lvml_spsc_reserve(&push_ring, LVML_PUSH_SLOTS)) < 0) {
+        if (!push_service(s)) {
+            return -1;
+        }
+        push_sleep_ms(PUSH_FULL_POLL_MS);
+    }
+    return slot;
+}
+
+#ifdef ESP_PLATFORM
+
+static void push_task_entry(void* arg) {
+    (void)arg;
+    push_task_run();
+}
+
+static bool push_start(void) {
+    if (push_started) {
+        return true;
+    }
+    push_mutex = xSemaphoreCreateMutex();
+    push_wake_sem = xSemaphoreCreateBinary();
+    if (push_mutex == NULL || push_wake_sem == NULL) {
+        return false;
+    }
+    if (xTaskCreate(push_task_entry, "lvml_push", PUSH_TASK_STACK, NULL, tskIDLE_PRIORITY + PUSH_TASK_PRIORITY, NULL) != pdPASS) {
+        return false;
+    }
+    push_started = true;
+    return true;
+}
+
+static void push_lock(void) {
+    if (push_mutex != NULL) {
+        xSemaphoreTake(push_mutex, portMAX_DELAY);
+    }
+}
+
+static void push_unlock(void) {
+    if (push_mutex != NULL) {
+        xSemaphoreGive(push_mutex);
+    }
+}
+
+static void push_wake(void) {
+    xSemaphoreGive(push_wake_sem);
+}
+
+static void push_wait(uint32_t timeout_ms) {
+    TickType_t ticks = timeout_ms == PUSH_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms) + 1;
+    xSemaphoreTake(push_wake_sem, ticks);
+}
+
+static void push_sleep_ms(uint32_t ms) {
+    TickType_t ticks = pdMS_TO_TICKS(ms);
+    vTaskDelay(ticks > 0 ? ticks : 1);
+}
+
+#else
+
+static void* push_thread_entry(void* arg) {
+    (void)arg;
+    push_task_run();
+    return NULL;
+}
+
+static bool push_start(void) {
+    if (push_started) {
+        return true;
+    }
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, push_thread_entry, NULL) != 0) {
+        return false;
+    }
+    pthread_detach(thread);
+    push_started = true;
+    return true;
+}
+
+static void push_lock(void) {
+    pthread_mutex_lock(&push_mutex);
+}
+
+static void push_unlock(void) {
+    pthread_mutex_unlock(&push_mutex);
+}
+
+static void push_wake(void) {
+    pthread_mutex_lock(&push_mutex);
+    push_wake_pending = 1;
+    pthread_cond_signal(&push_cond);
+    pthread_mutex_unlock(&push_mutex);
+}
+
+static void push_wait(uint32_t timeout_ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&push_mutex);
+    int err = 0;
+    while (push_wake_pending == 0 && err == 0) {
+        if (timeout_ms == PUSH_WAIT_FOREVER) {
+            pthread_cond_wait(&push_cond, &push_mutex);
+        } else {
+            err = pthread_cond_timedwait(&push_cond, &push_mutex, &deadline);
+        }
+    }
+    push_wake_pending = 0;
+    pthread_mutex_unlock(&push_mutex);
+}
+
+static void push_sleep_ms(uint32_t ms) {
+    usleep(ms * 1000);
+}
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file lvml_push.h
+ * @brief Persistent server push channel for UI updates
+ *
+ * Instead of polling for new XML, the device keeps one TCP connection to
+ * a server that pushes small binary updates (utils/lvml_patch.h) whenever
+ * something changes. A channel task (a thread on Linux) receives them into
+ * a ring of LVML_PUSH_SLOTS updates; the main thread applies what has
+ * arrived once per frame with lvml_push_poll(), within a time budget, and
+ * the task acknowledges applied updates. Lost connections are retried
+ * with a growing delay.
+ *
+ * Protocol, varints as in lvml_snapshot.h:
+ *   device, on connect   "LVP", u8 version, varint window, varint largest
+ *                        update the device accepts
+ *   server               updates as varint length and bytes; length 0 is
+ *                        a keep-alive and is ignored
+ *   device               varint n after n more updates were applied
+ * Backpressure is by credit: the server keeps at most `window` updates
+ * unacknowledged, and while it waits it should merge changes (the latest
+ * value of a property wins) instead of queueing them, so a slow display
+ * sees fewer, fresher updates rather than growing latency. A server that
+ * sends more anyway is held back by TCP: the task stops reading while the
+ * ring is full.
+ */
+
+#ifndef LVML_PUSH_H
+#define LVML_PUSH_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_PUSH_VERSION 1
+#define LVML_PUSH_PORT 8765                   // Default server port
+#define LVML_PUSH_SLOTS 16                    // Updates buffered and the server's window (power of two)
+#define LVML_PUSH_UPDATE_MAX 2048             // Larger updates are skipped and count as errors
+#define LVML_PUSH_HOST_MAX 64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Applies one update on the thread calling lvml_push_poll()
+ * @param data update bytes, only valid during the call
+ * @param len number of bytes
+ * @param user_data user pointer passed to lvml_push_poll()
+ * @return false if the update was refused (counted as an error)
+ */
+typedef bool (*lvml_push_apply_cb_t)(const uint8_t* data, size_t len, void* user_data);
+
+/**
+ * Push channel statistics
+ */
+typedef struct {
+    bool connected;
+    uint32_t connects;              // Connections made
+    uint32_t disconnects;
+    uint32_t updates;               // Updates applied
+    uint32_t errors;                // Updates refused or too large
+    uint32_t bytes;                 // Bytes received, framing included
+    uint32_t acks;                  // Acknowledgements sent
+    uint32_t full_waits;            // Times reading paused because the ring was full
+    uint32_t queue_max;             // Most updates waiting at once
+    uint32_t batches;               // lvml_push_poll() calls that applied updates
+    uint32_t batch_max_us;          // Longest batch
+    uint32_t apply_us;              // Time spent applying, all batches
+    uint32_t last_latency_us;       // Received until applied
+    uint32_t avg_latency_us;
+    uint32_t max_latency_us;
+} lvml_push_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Connect to a push server and stay connected; the channel task is
+ * started on first use. A connection to another server is closed first.
+ * @param host server name or address
+ * @param port server port
+ * @return LVML_OK once the task is connecting, LVML_ERROR_INVALID_PARAM,
+ *         LVML_ERROR_MEMORY or LVML_ERROR_INIT if the task can't be started
+ */
+lvml_error_t lvml_push_connect(const char* host, uint16_t port);
+
+/**
+ * Close the connection and stop reconnecting; updates already received
+ * are still applied by lvml_push_poll()
+ */
+void lvml_push_close(void);
+
+/**
+ * Apply received updates, oldest first, until none are left or budget_us
+ * has passed (at least one is applied)
+ * @param apply applies one update
+ * @param user_data passed to apply
+ * @param budget_us time budget
+ * @return number of updates handed to apply
+ */
+uint32_t lvml_push_poll(lvml_push_apply_cb_t apply, void* user_data, uint32_t budget_us);
+
+/**
+ * Get push channel statistics
+ * @param stats output statistics
+ * @param reset clear the counters afterwards
+ */
+void lvml_push_get_stats(lvml_push_stats_t* stats, bool reset);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_PUSH_H*/
@@ -0,0 +1,95 @@
+/**
+ * @file lvml_affine.c
+ * @brief Fixed-point 2D affine transforms for mapping touch coordinates
+ */
+
+#include "lvml_affine.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static int32_t affine_div(int64_t num, int64_t den);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_affine_scale(lvml_affine_t* m, int32_t src_w, int32_t src_h, int32_t dst_w, int32_t dst_h) {
+    m->a = affine_div((int64_t)dst_w * LVML_AFFINE_ONE, src_w);
+    m->b = 0;
+    m->c = 0;
+    m->d = 0;
+    m->e = affine_div((int64_t)dst_h * LVML_AFFINE_ONE, src_h);
+    m->f = 0;
+}
+
+void lvml_affine_rotate(lvml_affine_t* m, int32_t width, int32_t height, int quarter_turns) {
+    const int32_t one = LVML_AFFINE_ONE;
+    switch (quarter_turns & 3) {
+        case 1:     // (x, y) -> (h - 1 - y, x)
+            *m = (lvml_affine_t){ 0, -one, (height - 1) * one, one, 0, 0 };
+            break;
+        case 2:     // (x, y) -> (w - 1 - x, h - 1 - y)
+            *m = (lvml_affine_t){ -one, 0, (width - 1) * one, 0, -one, (height - 1) * one };
+            break;
+        case 3:     // (x, y) -> (y, w - 1 - x)
+            *m = (lvml_affine_t){ 0, one, 0, -one, 0, (width - 1) * one };
+            break;
+        default:
+            *m = (lvml_affine_t){ one, 0, 0, 0, one, 0 };
+            break;
+    }
+}
+
+bool lvml_affine_from_points(lvml_affine_t* m, const int32_t src[6], const int32_t dst[6]) {
+    int64_t x0 = src[0], y0 = src[1], x1 = src[2], y1 = src[3], x2 = src[4], y2 = src[5];
+    int64_t det = (x0 - x2) * (y1 - y2) - (x1 - x2) * (y0 - y2);
+    if (det == 0) {
+        return false;
+    }
+
+    // Cramer's rule, once for the x row and once for the y row
+    for (int row = 0; row < 2; row++) {
+        int64_t t0 = dst[row], t1 = dst[2 + row], t2 = dst[4 + row];
+        int64_t p = (t0 - t2) * (y1 - y2) - (t1 - t2) * (y0 - y2);
+        int64_t q = (x0 - x2) * (t1 - t2) - (x1 - x2) * (t0 - t2);
+        int64_t r = y0 * (x2 * t1 - x1 * t2) + y1 * (x0 * t2 - x2 * t0) + y2 * (x1 * t0 - x0 * t1);
+        int32_t* out = row == 0 ? &m->a : &m->d;
+        out[0] = affine_div(p * LVML_AFFINE_ONE, det);
+        out[1] = affine_div(q * LVML_AFFINE_ONE, det);
+        out[2] = affine_div(r * LVML_AFFINE_ONE, det);
+    }
+    return true;
+}
+
+void lvml_affine_multiply(lvml_affine_t* out, const lvml_affine_t* first, const lvml_affine_t* second) {
+    const lvml_affine_t* f = first;
+    const lvml_affine_t* s = second;
+    lvml_affine_t r;
+    r.a = (int32_t)(((int64_t)s->a * f->a + (int64_t)s->b * f->d) >> LVML_AFFINE_SHIFT);
+    r.b = (int32_t)(((int64_t)s->a * f->b + (int64_t)s->b * f->e) >> LVML_AFFINE_SHIFT);
+    r.c = (int32_t)((((int64_t)s->a * f->c + (int64_t)s->b * f->f) >> LVML_AFFINE_SHIFT) + s->c);
+    r.d = (int32_t)(((int64_t)s->d * f->a + (int64_t)s->e * f->d) >> LVML_AFFINE_SHIFT);
+    r.e = (int32_t)(((int64_t)s->d * f->b + (int64_t)s->e * f->e) >> LVML_AFFINE_SHIFT);
+    r.f = (int32_t)((((int64_t)s->d * f->c + (int64_t)s->e * f->f) >> LVML_AFFINE_SHIFT) + s->f);
+    *out = r;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Division rounded to the nearest integer, for either sign
+ */
+static int32_t affine_div(int64_t num, int64_t den) {
+    if (den < 0) {
+        num = -num;
+        den = -den;
+    }
+    if (num >= 0) {
+        return (int32_t)((num + den / 2) / den);
+    }
+    return (int32_t)(-((-num + den / 2) / den));
+}
@@ -0,0 +1,80 @@
+/**
+ * @file lvml_affine.h
+ * @brief Fixed-point 2D affine transforms for mapping touch coordinates
+ *
+ * A transform is computed once (scaling, quarter-turn rotation, 3-point
+ * calibration) and then applied per sample with integer multiplies only.
+ */
+
+#ifndef LVML_AFFINE_H
+#define LVML_AFFINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_AFFINE_SHIFT 16
+#define LVML_AFFINE_ONE (1 << LVML_AFFINE_SHIFT)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * x' = (a * x + b * y + c) >> 16
+ * y' = (d * x + e * y + f) >> 16
+ */
+typedef struct {
+    int32_t a, b, c;
+    int32_t d, e, f;
+} lvml_affine_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Scale a src_w x src_h space to dst_w x dst_h
+ */
+void lvml_affine_scale(lvml_affine_t* m, int32_t src_w, int32_t src_h, int32_t dst_w, int32_t dst_h);
+
+/**
+ * Rotate a width x height space clockwise by quarter turns; for odd turns
+ * the result is height x width
+ * @param quarter_turns 0-3
+ */
+void lvml_affine_rotate(lvml_affine_t* m, int32_t width, int32_t height, int quarter_turns);
+
+/**
+ * Transform that maps three source points exactly onto three target points
+ * @param src source points x0, y0, x1, y1, x2, y2
+ * @param dst target points, same layout
+ * @return false if the source points are on one line
+ */
+bool lvml_affine_from_points(lvml_affine_t* m, const int32_t src[6], const int32_t dst[6]);
+
+/**
+ * Combine two transforms: out = second(first(p)). out may alias either one.
+ */
+void lvml_affine_multiply(lvml_affine_t* out, const lvml_affine_t* first, const lvml_affine_t* second);
+
+/**
+ * Apply a transform to a point, rounding to the nearest integer
+ */
+static inline void lvml_affine_apply(const lvml_affine_t* m, int32_t x, int32_t y, int32_t* out_x, int32_t* out_y) {
+    *out_x = (int32_t)(((int64_t)m->a * x + (int64_t)m->b * y + m->c + (LVML_AFFINE_ONE >> 1)) >> LVML_AFFINE_SHIFT);
+    *out_y = (int32_t)(((int64_t)m->d * x + (int64_t)m->e * y + m->f + (LVML_AFFINE_ONE >> 1)) >> LVML_AFFINE_SHIFT);
+}
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_AFFINE_H*/
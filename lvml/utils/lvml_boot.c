@@ -0,0 +1,74 @@
+/**
+ * @file lvml_boot.c
+ * @brief Boot stage timestamps, from reset to the first interactive frame
+ */
+
+#include "lvml_boot.h"
+#include "lvml_time.h"
+#include <string.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static size_t boot_count(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lvml_boot_mark_t boot_marks[LVML_BOOT_MAX_MARKS];
+static bool boot_filled[LVML_BOOT_MAX_MARKS];
+static uint32_t boot_reserved = 0;      // Slots claimed, including unfinished ones
+static uint32_t boot_dropped = 0;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_boot_mark(const char* name) {
+    // Claim the slot before reading the clock so slots stay in time order
+    uint32_t slot = __atomic_fetch_add(&boot_reserved, 1, __ATOMIC_RELAXED);
+    int64_t now = lvml_time_us();
+    if (slot >= LVML_BOOT_MAX_MARKS) {
+        __atomic_fetch_add(&boot_dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    lvml_boot_mark_t* mark = &boot_marks[slot];
+    strncpy(mark->name, name, sizeof(mark->name) - 1);
+    mark->name[sizeof(mark->name) - 1] = '\0';
+    mark->time_us = now;
+    __atomic_store_n(&boot_filled[slot], true, __ATOMIC_RELEASE);
+}
+
+const lvml_boot_mark_t* lvml_boot_get_marks(size_t* count) {
+    *count = boot_count();
+    return boot_marks;
+}
+
+int64_t lvml_boot_find(const char* name) {
+    size_t count = boot_count();
+    for (size_t i = 0; i < count; i++) {
+        if (strncmp(boot_marks[i].name, name, sizeof(boot_marks[i].name) - 1) == 0) {
+            return boot_marks[i].time_us;
+        }
+    }
+    return -1;
+}
+
+uint32_t lvml_boot_dropped(void) {
+    return __atomic_load_n(&boot_dropped, __ATOMIC_RELAXED);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+// Marks up to the first slot another task is still filling
+static size_t boot_count(void) {
+    size_t count = 0;
+    while (count < LVML_BOOT_MAX_MARKS && __atomic_load_n(&boot_filled[count], __ATOMIC_ACQUIRE)) {
+        count++;
+    }
+    return count;
+}
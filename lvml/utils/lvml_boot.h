@@ -0,0 +1,77 @@
+/**
+ * @file lvml_boot.h
+ * @brief Boot stage timestamps, from reset to the first interactive frame
+ *
+ * C code and Python (lvml.mark()) put named marks on one timeline as each
+ * boot stage finishes. Times come from lvml_time_us(), which on the ESP32
+ * starts when the application starts, after the second-stage bootloader.
+ * Marks are kept in a fixed table; once it is full further marks are
+ * counted and dropped. Any task may mark: slots are claimed atomically, so
+ * stages initialized in the background land on the same timeline. Marks are
+ * listed up to the first one another task is still writing.
+ */
+
+#ifndef LVML_BOOT_H
+#define LVML_BOOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_BOOT_MAX_MARKS 32
+#define LVML_BOOT_NAME_MAX 20       // Including the terminating NUL
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * One finished stage
+ */
+typedef struct {
+    char name[LVML_BOOT_NAME_MAX];
+    int64_t time_us;            // Since startup
+} lvml_boot_mark_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Record that a stage finished now
+ * @param name stage name, copied and truncated to LVML_BOOT_NAME_MAX - 1
+ */
+void lvml_boot_mark(const char* name);
+
+/**
+ * Get the recorded marks in order
+ * @param count receives the number of marks
+ * @return marks, valid until the next lvml_boot_mark()
+ */
+const lvml_boot_mark_t* lvml_boot_get_marks(size_t* count);
+
+/**
+ * Look up a mark by name
+ * @param name stage name
+ * @return its time in microseconds since startup, or -1 if it wasn't marked
+ */
+int64_t lvml_boot_find(const char* name);
+
+/**
+ * Number of marks dropped because the table was full
+ */
+uint32_t lvml_boot_dropped(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_BOOT_H*/
@@ -0,0 +1,169 @@
+/**
+ * @file lvml_bundle.c
+ * @brief Read LVML bundles: many named files packed into one
+ */
+
+#include "lvml_bundle.h"
+#include "utils/lvml_hash.h"
+#include "utils/lvml_mem.h"
+#include "micropython/lib/uzlib/uzlib.h"
+#include <string.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static uint16_t bundle_u16(const uint8_t* p);
+static uint32_t bundle_u32(const uint8_t* p);
+static lvml_error_t bundle_inflate(const uint8_t* src, size_t src_len, uint8_t* dest, size_t dest_len);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_bundle_open(lvml_bundle_t* bundle, const uint8_t* data, size_t len) {
+    if (bundle == NULL || data == NULL || len < LVML_BUNDLE_HEADER_SIZE ||
+        memcmp(data, LVML_BUNDLE_MAGIC, 4) != 0 || data[4] != LVML_BUNDLE_VERSION) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    bundle->data = data;
+    bundle->len = len;
+    bundle->entry_cnt = bundle_u16(data + 6);
+    bundle->data_offset = bundle_u32(data + 8);
+    if (bundle->data_offset > len) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    // Validate the whole index once so lookups can trust it
+    size_t pos = LVML_BUNDLE_HEADER_SIZE;
+    size_t data_len = len - bundle->data_offset;
+    for (uint32_t i = 0; i < bundle->entry_cnt; i++) {
+        if (pos + LVML_BUNDLE_ENTRY_SIZE > bundle->data_offset) {
+            return LVML_ERROR_INVALID_PARAM;
+        }
+        const uint8_t* e = data + pos;
+        uint32_t offset = bundle_u32(e + 4);
+        uint32_t stored_size = bundle_u32(e + 8);
+        pos += LVML_BUNDLE_ENTRY_SIZE + e[1];
+        if (pos > bundle->data_offset || offset > data_len || stored_size > data_len - offset ||
+            bundle_u32(e + 12) > LVML_MAX_XML_SIZE) {
+            return LVML_ERROR_INVALID_PARAM;
+        }
+    }
+
+    return LVML_OK;
+}
+
+bool lvml_bundle_entry(const lvml_bundle_t* bundle, uint32_t index, lvml_bundle_entry_t* entry) {
+    if (index >= bundle->entry_cnt) {
+        return false;
+    }
+
+    const uint8_t* e = bundle->data + LVML_BUNDLE_HEADER_SIZE;
+    for (uint32_t i = 0; i < index; i++) {
+        e += LVML_BUNDLE_ENTRY_SIZE + e[1];
+    }
+    entry->flags = e[0];
+    entry->name_len = e[1];
+    entry->offset = bundle_u32(e + 4);
+    entry->stored_size = bundle_u32(e + 8);
+    entry->size = bundle_u32(e + 12);
+    entry->hash = bundle_u32(e + 16);
+    entry->name = (const char*)e + LVML_BUNDLE_ENTRY_SIZE;
+    return true;
+}
+
+bool lvml_bundle_find(const lvml_bundle_t* bundle, const char* name, lvml_bundle_entry_t* entry) {
+    size_t name_len = strlen(name);
+    for (uint32_t i = 0; lvml_bundle_entry(bundle, i, entry); i++) {
+        if (entry->name_len == name_len && memcmp(entry->name, name, name_len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool lvml_bundle_name_ends_with(const lvml_bundle_entry_t* entry, const char* suffix) {
+    size_t suffix_len = strlen(suffix);
+    return entry->name_len >= suffix_len &&
+           memcmp(entry->name + entry->name_len - suffix_len, suffix, suffix_len) == 0;
+}
+
+lvml_error_t lvml_bundle_read(const lvml_bundle_t* bundle, const lvml_bundle_entry_t* entry, uint8_t** data) {
+    const uint8_t* src = bundle->data + bundle->data_offset + entry->offset;
+    bool compressed = (entry->flags & LVML_BUNDLE_FLAG_ZLIB) != 0;
+    if (!compressed && entry->stored_size != entry->size) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    uint8_t* out = (uint8_t*)lvml_mem_alloc_large(entry->size + 1);
+    if (out == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+
+    lvml_error_t result = LVML_OK;
+    if (compressed) {
+        result = bundle_inflate(src, entry->stored_size, out, entry->size);
+    } else {
+        memcpy(out, src, entry->size);
+    }
+    if (result == LVML_OK && lvml_hash_fnv1a(LVML_HASH_FNV1A_INIT, out, entry->size) != entry->hash) {
+        result = LVML_ERROR_INVALID_PARAM;
+    }
+    if (result != LVML_OK) {
+        lvml_mem_free_large(out);
+        return result;
+    }
+
+    out[entry->size] = '\0';
+    *data = out;
+    return LVML_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint16_t bundle_u16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t bundle_u32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * Inflate a zlib stream whose decompressed size is known. The packer uses
+ * a small window, so the window buffer stays small too.
+ */
+static lvml_error_t bundle_inflate(const uint8_t* src, size_t src_len, uint8_t* dest, size_t dest_len) {
+    uzlib_uncomp_t d;
+    uzlib_uncompress_init(&d, NULL, 0);
+    d.source = src;
+    d.source_limit = src + src_len;
+    d.source_read_cb = NULL;
+
+    int wbits;
+    if (uzlib_parse_zlib_gzip_header(&d, &wbits) != UZLIB_HEADER_ZLIB) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    size_t window_size = (size_t)1 << wbits;
+    uint8_t* window = (uint8_t*)lvml_mem_alloc_large(window_size);
+    if (window == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+    uzlib_uncompress_init(&d, window, window_size);
+
+    d.dest = dest;
+    d.dest_limit = dest + dest_len;
+    int st = UZLIB_OK;
+    while (st == UZLIB_OK && d.dest < d.dest_limit) {
+        st = uzlib_uncompress_chksum(&d);
+    }
+    lvml_mem_free_large(window);
+
+    bool complete = (st == UZLIB_DONE || st == UZLIB_OK) && d.dest == d.dest_limit;
+    return complete ? LVML_OK : LVML_ERROR_INVALID_PARAM;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file lvml_bundle.h
+ * @brief Read LVML bundles: many named files packed into one
+ *
+ * A bundle holds a screen together with the scripts and images it
+ * references, so loading it takes a single file open or HTTP request.
+ * Bundles are made on the host with scripts/pack_bundle.py.
+ *
+ * Layout (little-endian):
+ *   header   "LVMB", u8 version, u8 reserved, u16 entry count, u32 data offset
+ *   index    per entry: u8 flags, u8 name length, u16 reserved,
+ *            u32 offset (from the data offset), u32 stored size, u32 size,
+ *            u32 FNV-1a hash of the uncompressed content, name bytes
+ *   data     entry contents, zlib streams if LVML_BUNDLE_FLAG_ZLIB is set
+ */
+
+#ifndef LVML_BUNDLE_H
+#define LVML_BUNDLE_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_BUNDLE_MAGIC "LVMB"
+#define LVML_BUNDLE_VERSION 1
+#define LVML_BUNDLE_HEADER_SIZE 12
+#define LVML_BUNDLE_ENTRY_SIZE 20          // Index entry without the name
+#define LVML_BUNDLE_FLAG_ZLIB 0x01
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Opened bundle; borrows the bundle bytes
+ */
+typedef struct {
+    const uint8_t* data;
+    size_t len;
+    uint16_t entry_cnt;
+    uint32_t data_offset;
+} lvml_bundle_t;
+
+/**
+ * Index entry; name points into the bundle and is not NUL-terminated
+ */
+typedef struct {
+    const char* name;
+    uint8_t name_len;
+    uint8_t flags;
+    uint32_t offset;
+    uint32_t stored_size;
+    uint32_t size;
+    uint32_t hash;
+} lvml_bundle_entry_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Check a bundle's header and index
+ * @param bundle receives the opened bundle
+ * @param data bundle bytes, must stay valid while the bundle is used
+ * @param len number of bytes
+ * @return LVML_OK, or LVML_ERROR_INVALID_PARAM if data isn't a valid bundle
+ */
+lvml_error_t lvml_bundle_open(lvml_bundle_t* bundle, const uint8_t* data, size_t len);
+
+/**
+ * Get an index entry by position
+ * @param bundle opened bundle
+ * @param index entry number, 0 .. entry_cnt - 1
+ * @param entry receives the entry
+ * @return false if index is out of range
+ */
+bool lvml_bundle_entry(const lvml_bundle_t* bundle, uint32_t index, lvml_bundle_entry_t* entry);
+
+/**
+ * Look up an entry by name
+ * @param bundle opened bundle
+ * @param name entry name, e.g. the src value that references it
+ * @param entry receives the entry
+ * @return false if there is no such entry
+ */
+bool lvml_bundle_find(const lvml_bundle_t* bundle, const char* name, lvml_bundle_entry_t* entry);
+
+/**
+ * Check whether an entry name ends with a suffix such as ".xml"
+ * @param entry index entry
+ * @param suffix suffix to look for
+ * @return true if the name ends with suffix
+ */
+bool lvml_bundle_name_ends_with(const lvml_bundle_entry_t* entry, const char* suffix);
+
+/**
+ * Decompress an entry and verify its hash
+ * @param bundle opened bundle
+ * @param entry entry to read
+ * @param data receives a NUL-terminated buffer, release with lvml_mem_free_large()
+ * @return LVML_OK, LVML_ERROR_MEMORY, or LVML_ERROR_INVALID_PARAM for corrupt content
+ */
+lvml_error_t lvml_bundle_read(const lvml_bundle_t* bundle, const lvml_bundle_entry_t* entry, uint8_t** data);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_BUNDLE_H*/
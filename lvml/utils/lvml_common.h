@@ -0,0 +1,44 @@
+/**
+ * @file lvml_common.h
+ * @brief Definitions shared by all LVML layers
+ *
+ * Kept free of MicroPython and LVGL includes so platform-independent parts
+ * (network, utils) also build on the host.
+ */
+
+#ifndef LVML_COMMON_H
+#define LVML_COMMON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_MAX_URL_LENGTH 512
+#define LVML_MAX_XML_SIZE (1024 * 1024) // 1MB max XML size
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * LVML error codes
+ */
+typedef enum {
+    LVML_OK = 0,
+    LVML_ERROR_INIT = -1,
+    LVML_ERROR_MEMORY = -2,
+    LVML_ERROR_NETWORK = -3,
+    LVML_ERROR_XML_PARSE = -4,
+    LVML_ERROR_MP_EXEC = -5,
+    LVML_ERROR_INVALID_PARAM = -6
+} lvml_error_t;
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_COMMON_H*/
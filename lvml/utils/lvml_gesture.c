@@ -0,0 +1,344 @@
+/**
+ * @file lvml_gesture.c
+ * @brief Multi-touch gesture recognizer
+ */
+
+#include "lvml_gesture.h"
+#include <string.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static const lvml_gesture_contact_t* gesture_find(const lvml_gesture_contact_t* contacts, uint8_t count, uint8_t id);
+static void gesture_track_velocity(lvml_gesture_t* g, uint32_t time_ms, int32_t x, int32_t y);
+static size_t gesture_release(lvml_gesture_t* g, uint32_t time_ms, lvml_gesture_event_t* events);
+static size_t gesture_two_fingers(lvml_gesture_t* g, uint32_t time_ms,
+                                  const lvml_gesture_contact_t* contacts, uint8_t count,
+                                  lvml_gesture_event_t* events);
+static lvml_gesture_event_t* gesture_emit(lvml_gesture_t* g, lvml_gesture_event_t* event, uint8_t type,
+                                          uint32_t time_ms, uint8_t fingers, int32_t x, int32_t y);
+static uint32_t gesture_isqrt(uint64_t value);
+static int32_t gesture_atan2(int32_t y, int32_t x);
+static int32_t gesture_abs(int32_t value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const lvml_gesture_config_t gesture_defaults = {
+    .slop_px = 10,
+    .tap_max_ms = 300,
+    .double_tap_ms = 300,
+    .long_press_ms = 500,
+    .swipe_min_px = 40,
+    .swipe_min_speed = 400,
+    .pinch_step = 3277,
+    .rotate_step = 500,
+};
+
+static const char* const gesture_names[LVML_GESTURE_TYPE_COUNT] = {
+    "tap", "double_tap", "long_press", "swipe", "pinch", "rotate", "pan",
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_gesture_init(lvml_gesture_t* g, const lvml_gesture_config_t* config) {
+    memset(g, 0, sizeof(*g));
+    g->config = config != NULL ? *config : gesture_defaults;
+}
+
+size_t lvml_gesture_update(lvml_gesture_t* g, uint32_t time_ms,
+                           const lvml_gesture_contact_t* contacts, uint8_t count,
+                           lvml_gesture_event_t* events) {
+    if (count == 0) {
+        return g->down ? gesture_release(g, time_ms, events) : 0;
+    }
+    if (count > LVML_GESTURE_MAX_CONTACTS) {
+        count = LVML_GESTURE_MAX_CONTACTS;
+    }
+
+    if (!g->down) {
+        g->down = true;
+        g->multi = false;
+        g->moved = false;
+        g->long_pressed = false;
+        g->primary = contacts[0].id;
+        g->start_ms = time_ms;
+        g->start_x = g->last_x = contacts[0].x;
+        g->start_y = g->last_y = contacts[0].y;
+        g->last_ms = time_ms;
+        g->vx = 0;
+        g->vy = 0;
+    }
+
+    if (count >= 2) {
+        return gesture_two_fingers(g, time_ms, contacts, count, events);
+    }
+    if (g->multi) {
+        // One finger left of a two-finger gesture: wait for it to lift
+        return 0;
+    }
+
+    const lvml_gesture_contact_t* p = gesture_find(contacts, count, g->primary);
+    if (p == NULL) {
+        return 0;
+    }
+    gesture_track_velocity(g, time_ms, p->x, p->y);
+
+    const lvml_gesture_config_t* c = &g->config;
+    int32_t dx = p->x - g->start_x;
+    int32_t dy = p->y - g->start_y;
+    if (!g->moved && gesture_abs(dx) + gesture_abs(dy) > c->slop_px) {
+        g->moved = true;
+    }
+    if (!g->moved && !g->long_pressed && time_ms - g->start_ms >= c->long_press_ms) {
+        g->long_pressed = true;
+        gesture_emit(g, &events[0], LVML_GESTURE_LONG_PRESS, time_ms, 1, p->x, p->y);
+        return 1;
+    }
+    return 0;
+}
+
+const char* lvml_gesture_name(uint8_t type) {
+    return type < LVML_GESTURE_TYPE_COUNT ? gesture_names[type] : "";
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static const lvml_gesture_contact_t* gesture_find(const lvml_gesture_contact_t* contacts, uint8_t count, uint8_t id) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (contacts[i].id == id) {
+            return &contacts[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Velocity in px/s, averaged with the previous estimate to smooth out
+ * uneven frame timing
+ */
+static void gesture_track_velocity(lvml_gesture_t* g, uint32_t time_ms, int32_t x, int32_t y) {
+    uint32_t dt = time_ms - g->last_ms;
+    if (dt == 0) {
+        return;
+    }
+    int32_t vx = (x - g->last_x) * 1000 / (int32_t)dt;
+    int32_t vy = (y - g->last_y) * 1000 / (int32_t)dt;
+    g->vx = (g->vx + vx) / 2;
+    g->vy = (g->vy + vy) / 2;
+    g->last_ms = time_ms;
+    g->last_x = x;
+    g->last_y = y;
+}
+
+/**
+ * All fingers lifted: a one-finger sequence may end as a tap or a swipe
+ */
+static size_t gesture_release(lvml_gesture_t* g, uint32_t time_ms, lvml_gesture_event_t* events) {
+    const lvml_gesture_config_t* c = &g->config;
+    size_t n = 0;
+    g->down = false;
+    g->pinching = g->rotating = g->panning = false;
+    if (g->multi || g->long_pressed) {
+        g->tap_valid = false;
+        return 0;
+    }
+
+    int32_t x = g->last_x;
+    int32_t y = g->last_y;
+    int32_t dx = x - g->start_x;
+    int32_t dy = y - g->start_y;
+
+    if (!g->moved) {
+        if (time_ms - g->start_ms > c->tap_max_ms) {
+            g->tap_valid = false;
+            return 0;
+        }
+        gesture_emit(g, &events[n++], LVML_GESTURE_TAP, time_ms, 1, x, y);
+
+        bool near = gesture_abs(x - g->tap_x) <= 2 * c->slop_px && gesture_abs(y - g->tap_y) <= 2 * c->slop_px;
+        if (g->tap_valid && time_ms - g->tap_ms <= c->double_tap_ms && near) {
+            gesture_emit(g, &events[n++], LVML_GESTURE_DOUBLE_TAP, time_ms, 1, x, y);
+            g->tap_valid = false;
+        } else {
+            g->tap_valid = true;
+            g->tap_ms = time_ms;
+            g->tap_x = x;
+            g->tap_y = y;
+        }
+        return n;
+    }
+
+    g->tap_valid = false;
+    bool horizontal = gesture_abs(dx) >= gesture_abs(dy);
+    int32_t distance = horizontal ? gesture_abs(dx) : gesture_abs(dy);
+    int32_t speed = horizontal ? gesture_abs(g->vx) : gesture_abs(g->vy);
+    if (distance >= c->swipe_min_px && speed >= c->swipe_min_speed) {
+        lvml_gesture_event_t* e = gesture_emit(g, &events[n++], LVML_GESTURE_SWIPE, time_ms, 1, x, y);
+        if (horizontal) {
+            e->dir = dx < 0 ? LVML_GESTURE_DIR_LEFT : LVML_GESTURE_DIR_RIGHT;
+        } else {
+            e->dir = dy < 0 ? LVML_GESTURE_DIR_TOP : LVML_GESTURE_DIR_BOTTOM;
+        }
+    }
+    return n;
+}
+
+/**
+ * Pinch, rotate and pan from the first two fingers. Each starts once its
+ * threshold is crossed and then reports every change.
+ */
+static size_t gesture_two_fingers(lvml_gesture_t* g, uint32_t time_ms,
+                                  const lvml_gesture_contact_t* contacts, uint8_t count,
+                                  lvml_gesture_event_t* events) {
+    const lvml_gesture_config_t* c = &g->config;
+    const lvml_gesture_contact_t* a = NULL;
+    const lvml_gesture_contact_t* b = NULL;
+    if (g->multi) {
+        a = gesture_find(contacts, count, g->id_a);
+        b = gesture_find(contacts, count, g->id_b);
+    }
+
+    int32_t cx, cy, dist, angle;
+    if (a == NULL || b == NULL) {
+        // New pair (second finger down, or one of the pair was replaced)
+        a = &contacts[0];
+        b = &contacts[1];
+        cx = (a->x + b->x) / 2;
+        cy = (a->y + b->y) / 2;
+        int32_t vx = b->x - a->x;
+        int32_t vy = b->y - a->y;
+        g->multi = true;
+        g->id_a = a->id;
+        g->id_b = b->id;
+        g->base_dist = (int32_t)gesture_isqrt((uint64_t)((int64_t)vx * vx + (int64_t)vy * vy));
+        if (g->base_dist < 1) {
+            g->base_dist = 1;
+        }
+        g->base_angle = gesture_atan2(vy, vx);
+        g->base_cx = cx;
+        g->base_cy = cy;
+        g->last_scale = LVML_GESTURE_SCALE_ONE;
+        g->last_angle = 0;
+        g->pinching = g->rotating = g->panning = false;
+        g->last_ms = time_ms;
+        g->last_x = cx;
+        g->last_y = cy;
+        g->vx = 0;
+        g->vy = 0;
+        return 0;
+    }
+
+    cx = (a->x + b->x) / 2;
+    cy = (a->y + b->y) / 2;
+    int32_t vx = b->x - a->x;
+    int32_t vy = b->y - a->y;
+    dist = (int32_t)gesture_isqrt((uint64_t)((int64_t)vx * vx + (int64_t)vy * vy));
+    angle = gesture_atan2(vy, vx) - g->base_angle;
+    if (angle > 18000) {
+        angle -= 36000;
+    } else if (angle <= -18000) {
+        angle += 36000;
+    }
+    int32_t scale = (int32_t)(((int64_t)dist * LVML_GESTURE_SCALE_ONE) / g->base_dist);
+    int32_t prev_x = g->last_x;
+    int32_t prev_y = g->last_y;
+    gesture_track_velocity(g, time_ms, cx, cy);
+
+    size_t n = 0;
+    if (!g->pinching && gesture_abs(scale - LVML_GESTURE_SCALE_ONE) >= c->pinch_step) {
+        g->pinching = true;
+    }
+    if (g->pinching && scale != g->last_scale) {
+        g->last_scale = scale;
+        gesture_emit(g, &events[n++], LVML_GESTURE_PINCH, time_ms, 2, cx, cy)->scale = scale;
+    }
+
+    if (!g->rotating && gesture_abs(angle) >= c->rotate_step) {
+        g->rotating = true;
+    }
+    if (g->rotating && angle != g->last_angle) {
+        g->last_angle = angle;
+        gesture_emit(g, &events[n++], LVML_GESTURE_ROTATE, time_ms, 2, cx, cy)->angle = angle;
+    }
+
+    if (!g->panning && gesture_abs(cx - g->base_cx) + gesture_abs(cy - g->base_cy) > c->slop_px) {
+        g->panning = true;
+    }
+    if (g->panning && (cx != prev_x || cy != prev_y)) {
+        gesture_emit(g, &events[n++], LVML_GESTURE_PAN, time_ms, 2, cx, cy);
+    }
+    return n;
+}
+
+static lvml_gesture_event_t* gesture_emit(lvml_gesture_t* g, lvml_gesture_event_t* event, uint8_t type,
+                                          uint32_t time_ms, uint8_t fingers, int32_t x, int32_t y) {
+    memset(event, 0, sizeof(*event));
+    event->type = type;
+    event->fingers = fingers;
+    event->time_ms = time_ms;
+    event->x = x;
+    event->y = y;
+    if (fingers >= 2) {
+        event->dx = x - g->base_cx;
+        event->dy = y - g->base_cy;
+    } else {
+        event->dx = x - g->start_x;
+        event->dy = y - g->start_y;
+    }
+    event->vx = g->vx;
+    event->vy = g->vy;
+    event->scale = g->pinching ? g->last_scale : LVML_GESTURE_SCALE_ONE;
+    event->angle = g->rotating ? g->last_angle : 0;
+    return event;
+}
+
+static uint32_t gesture_isqrt(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+/**
+ * Angle of (x, y) in centidegrees, (-18000, 18000], clockwise on screen.
+ * atan(r) ~ 45r + 15.64r(1 - r) degrees for 0 <= r <= 1, within 0.25 degrees.
+ */
+static int32_t gesture_atan2(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) {
+        return 0;
+    }
+    int32_t ax = gesture_abs(x);
+    int32_t ay = gesture_abs(y);
+    bool steep = ay > ax;
+    int64_t r = steep ? ((int64_t)ax << 15) / ay : ((int64_t)ay << 15) / ax;    // Q15, 0..1
+    int32_t angle = (int32_t)((4500 * r + ((1564 * ((r * (32768 - r)) >> 15)))) >> 15);
+    if (steep) {
+        angle = 9000 - angle;
+    }
+    if (x < 0) {
+        angle = 18000 - angle;
+    }
+    return y < 0 ? -angle : angle;
+}
+
+static int32_t gesture_abs(int32_t value) {
+    return value < 0 ? -value : value;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file lvml_gesture.h
+ * @brief Multi-touch gesture recognizer
+ *
+ * Fed one frame of contacts at a time (all fingers the controller reports,
+ * identified by their track id), it produces tap, double tap, long press,
+ * swipe, pinch, rotate and two-finger pan events. Only integer math is
+ * used, so it can run in the touch sampling task, and it has no LVGL or
+ * MicroPython dependency so recorded traces can be replayed on the host.
+ */
+
+#ifndef LVML_GESTURE_H
+#define LVML_GESTURE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_GESTURE_MAX_CONTACTS 5
+#define LVML_GESTURE_MAX_EVENTS 4       // Most events one frame can produce
+#define LVML_GESTURE_SCALE_ONE 65536    // Pinch scale 1.0
+
+// Swipe directions, same values as LV_DIR_*
+#define LVML_GESTURE_DIR_LEFT   (1 << 0)
+#define LVML_GESTURE_DIR_RIGHT  (1 << 1)
+#define LVML_GESTURE_DIR_TOP    (1 << 2)
+#define LVML_GESTURE_DIR_BOTTOM (1 << 3)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LVML_GESTURE_TAP = 0,
+    LVML_GESTURE_DOUBLE_TAP,
+    LVML_GESTURE_LONG_PRESS,
+    LVML_GESTURE_SWIPE,
+    LVML_GESTURE_PINCH,
+    LVML_GESTURE_ROTATE,
+    LVML_GESTURE_PAN,           // Two-finger drag
+    LVML_GESTURE_TYPE_COUNT
+} lvml_gesture_type_t;
+
+/**
+ * One finger in a frame
+ */
+typedef struct {
+    uint8_t id;                 // Controller track id, stable while the finger is down
+    int32_t x;
+    int32_t y;
+} lvml_gesture_contact_t;
+
+/**
+ * Recognized gesture
+ */
+typedef struct {
+    uint8_t type;               // lvml_gesture_type_t
+    uint8_t fingers;
+    uint8_t dir;                // Swipe: LVML_GESTURE_DIR_* of the main axis
+    uint32_t time_ms;
+    int32_t x;                  // One finger: its position; two: their centroid
+    int32_t y;
+    int32_t dx;                 // Movement since the gesture started
+    int32_t dy;
+    int32_t vx;                 // Velocity in px/s
+    int32_t vy;
+    int32_t scale;              // Pinch: finger distance / start distance, 65536 = 1.0
+    int32_t angle;              // Rotate: centidegrees since the start, clockwise
+} lvml_gesture_event_t;
+
+/**
+ * Thresholds; lvml_gesture_init() with NULL uses the defaults shown
+ */
+typedef struct {
+    uint16_t slop_px;           // 10: a tap may move this much
+    uint16_t tap_max_ms;        // 300: longest tap
+    uint16_t double_tap_ms;     // 300: most time between the taps of a double tap
+    uint16_t long_press_ms;     // 500
+    uint16_t swipe_min_px;      // 40: shortest swipe
+    uint16_t swipe_min_speed;   // 400: slowest swipe at release, px/s
+    uint16_t pinch_step;        // 3277: scale change (5%) before pinch events start
+    uint16_t rotate_step;       // 500: angle (5 degrees) before rotate events start
+} lvml_gesture_config_t;
+
+/**
+ * Recognizer state
+ */
+typedef struct {
+    lvml_gesture_config_t config;
+
+    // Current touch sequence (first finger down until all fingers up)
+    bool down;
+    bool multi;                 // Two fingers were down at some point: no tap or swipe
+    bool moved;                 // First finger left the slop circle
+    bool long_pressed;
+    uint8_t primary;            // Track id of the first finger
+    uint32_t start_ms;
+    int32_t start_x, start_y;
+    uint32_t last_ms;
+    int32_t last_x, last_y;
+    int32_t vx, vy;
+
+    // Two-finger gesture
+    uint8_t id_a, id_b;
+    int32_t base_dist, base_angle, base_cx, base_cy;
+    int32_t last_scale, last_angle;
+    bool pinching, rotating, panning;
+
+    // Previous tap, for double taps
+    bool tap_valid;
+    uint32_t tap_ms;
+    int32_t tap_x, tap_y;
+} lvml_gesture_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Reset a recognizer
+ * @param config thresholds, NULL for the defaults
+ */
+void lvml_gesture_init(lvml_gesture_t* g, const lvml_gesture_config_t* config);
+
+/**
+ * Feed one frame
+ * @param time_ms frame time, may wrap
+ * @param contacts fingers currently down, count 0 when all are lifted
+ * @param events output, room for LVML_GESTURE_MAX_EVENTS
+ * @return number of events written
+ */
+size_t lvml_gesture_update(lvml_gesture_t* g, uint32_t time_ms,
+                           const lvml_gesture_contact_t* contacts, uint8_t count,
+                           lvml_gesture_event_t* events);
+
+/**
+ * Name of a gesture type ("tap", "double_tap", "long_press", "swipe",
+ * "pinch", "rotate", "pan")
+ */
+const char* lvml_gesture_name(uint8_t type);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_GESTURE_H*/
@@ -0,0 +1,61 @@
+/**
+ * @file lvml_hash.h
+ * @brief Small non-cryptographic hash helpers shared by LVML modules
+ */
+
+#ifndef LVML_HASH_H
+#define LVML_HASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_HASH_FNV1A_INIT 0x811C9DC5u
+#define LVML_HASH_FNV1A_PRIME 0x01000193u
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Continue a 32-bit FNV-1a hash over a block of bytes
+ * @param hash running hash value (LVML_HASH_FNV1A_INIT to start)
+ * @param data bytes to hash
+ * @param len number of bytes
+ * @return updated hash value
+ */
+static inline uint32_t lvml_hash_fnv1a(uint32_t hash, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+        hash *= LVML_HASH_FNV1A_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * Continue a 32-bit FNV-1a hash with a single 32-bit value (little-endian)
+ * @param hash running hash value
+ * @param value value to mix in
+ * @return updated hash value
+ */
+static inline uint32_t lvml_hash_fnv1a_u32(uint32_t hash, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        hash ^= (value >> (i * 8)) & 0xFF;
+        hash *= LVML_HASH_FNV1A_PRIME;
+    }
+    return hash;
+}
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_HASH_H*/
@@ -0,0 +1,310 @@
+/**
+ * @file lvml_log.c
+ * @brief Deferred logging through a lock-free ring of binary records
+ */
+
+#include "lvml_log.h"
+#include "lvml_time.h"
+#include <stdio.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LOG_SLOT_DATA 28
+#define LOG_RECORD_MAX (sizeof(log_header_t) + LVML_LOG_TEXT_MAX)
+#define LOG_LINE_MAX (LVML_LOG_TEXT_MAX + 48)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * One ring slot. A record is a header and a body copied over one or more
+ * consecutive slots. The sequence number tells whose turn a slot is: it
+ * equals the slot's position when free for that lap, and position + 1 once
+ * written. It is stored minus the slot index so the zeroed ring starts out
+ * free without an init step.
+ */
+typedef struct {
+    uint32_t seq;           // Use log_seq_load() / log_seq_store()
+    uint8_t data[LOG_SLOT_DATA];
+} log_slot_t;
+
+typedef enum {
+    LOG_KIND_FMT = 0,       // Body: format pointer, then int32 arguments
+    LOG_KIND_TEXT,          // Body: characters
+} log_kind_t;
+
+typedef struct {
+    uint32_t time_ms;
+    uint8_t module;
+    uint8_t level;
+    uint8_t kind;
+    uint8_t size;           // Body size in bytes
+} log_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void log_store(const log_header_t* header, const void* body);
+static size_t log_format(const uint8_t* record, char* line, size_t size);
+static inline uint32_t log_seq_load(uint32_t pos);
+static inline void log_seq_store(uint32_t pos, uint32_t seq);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+uint8_t lvml_log_levels[LVML_LOG_MOD_COUNT] = {
+    LVML_LOG_LEVEL_INFO, LVML_LOG_LEVEL_INFO, LVML_LOG_LEVEL_INFO, LVML_LOG_LEVEL_INFO,
+    LVML_LOG_LEVEL_INFO, LVML_LOG_LEVEL_INFO, LVML_LOG_LEVEL_INFO,
+};
+
+static const char* const log_module_names[LVML_LOG_MOD_COUNT] = {
+    "core", "ui", "touch", "lvgl", "net", "script", "events",
+};
+
+static const char* const log_level_names[] = {
+    "trace", "debug", "info", "warn", "error", "none",
+};
+
+static log_slot_t log_slots[LVML_LOG_SLOTS];
+static uint32_t log_head = 0;   // Next position to reserve, advanced by writers
+static uint32_t log_tail = 0;   // Next position to drain, drain only
+static lvml_log_stats_t log_stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_log_fmt(uint8_t module, uint8_t level, const char* fmt, uint8_t nargs, const int32_t* args) {
+    if (nargs > LVML_LOG_MAX_ARGS) {
+        nargs = LVML_LOG_MAX_ARGS;
+    }
+    uint8_t body[sizeof(const char*) + LVML_LOG_MAX_ARGS * sizeof(int32_t)];
+    memcpy(body, &fmt, sizeof(fmt));
+    memcpy(body + sizeof(fmt), args, nargs * sizeof(int32_t));
+
+    log_header_t header = {
+        .time_ms = (uint32_t)(lvml_time_us() / 1000),
+        .module = module,
+        .level = level,
+        .kind = LOG_KIND_FMT,
+        .size = (uint8_t)(sizeof(fmt) + nargs * sizeof(int32_t)),
+    };
+    log_store(&header, body);
+}
+
+void lvml_log_text(uint8_t module, uint8_t level, const char* text, size_t len) {
+    if (len > LVML_LOG_TEXT_MAX) {
+        len = LVML_LOG_TEXT_MAX;
+    }
+    log_header_t header = {
+        .time_ms = (uint32_t)(lvml_time_us() / 1000),
+        .module = module,
+        .level = level,
+        .kind = LOG_KIND_TEXT,
+        .size = (uint8_t)len,
+    };
+    log_store(&header, text);
+}
+
+uint32_t lvml_log_drain(lvml_log_write_cb_t write, void* user, uint32_t max_records) {
+    uint8_t record[LOG_RECORD_MAX];
+    char line[LOG_LINE_MAX];
+    uint32_t count = 0;
+
+    while (max_records == 0 || count < max_records) {
+        log_slot_t* first = &log_slots[log_tail & (LVML_LOG_SLOTS - 1)];
+        if (log_seq_load(log_tail) != log_tail + 1) {
+            break;  // Empty, or the oldest record is still being written
+        }
+        log_header_t header;
+        memcpy(&header, first->data, sizeof(header));
+        size_t total = sizeof(header) + header.size;
+        uint32_t slots = (uint32_t)((total + LOG_SLOT_DATA - 1) / LOG_SLOT_DATA);
+
+        // All slots of the record must be written before it can be read
+        uint32_t last = log_tail + slots - 1;
+        if (log_seq_load(last) != last + 1) {
+            break;
+        }
+        for (uint32_t i = 0; i < slots; i++) {
+            uint32_t pos = log_tail + i;
+            log_slot_t* slot = &log_slots[pos & (LVML_LOG_SLOTS - 1)];
+            size_t offset = i * LOG_SLOT_DATA;
+            size_t chunk = total - offset < LOG_SLOT_DATA ? total - offset : LOG_SLOT_DATA;
+            memcpy(record + offset, slot->data, chunk);
+            // Free the slot for the writer one lap later
+            log_seq_store(pos, pos + LVML_LOG_SLOTS);
+        }
+        log_tail += slots;
+
+        size_t len = log_format(record, line, sizeof(line));
+        if (write != NULL) {
+            write(line, len, user);
+        }
+        log_stats.drained++;
+        count++;
+    }
+    return count;
+}
+
+bool lvml_log_pending(void) {
+    return __atomic_load_n(&log_head, __ATOMIC_ACQUIRE) != log_tail;
+}
+
+void lvml_log_set_level(uint8_t module, uint8_t level) {
+    if (module < LVML_LOG_MOD_COUNT && level <= LVML_LOG_LEVEL_NONE) {
+        lvml_log_levels[module] = level;
+    }
+}
+
+uint8_t lvml_log_get_level(uint8_t module) {
+    return module < LVML_LOG_MOD_COUNT ? lvml_log_levels[module] : LVML_LOG_LEVEL_NONE;
+}
+
+int lvml_log_find_module(const char* name) {
+    for (int i = 0; i < LVML_LOG_MOD_COUNT; i++) {
+        if (strcmp(log_module_names[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int lvml_log_find_level(const char* name) {
+    for (int i = 0; i <= LVML_LOG_LEVEL_NONE; i++) {
+        if (strcmp(log_level_names[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const char* lvml_log_module_name(uint8_t module) {
+    return module < LVML_LOG_MOD_COUNT ? log_module_names[module] : "?";
+}
+
+const char* lvml_log_level_name(uint8_t level) {
+    return level <= LVML_LOG_LEVEL_NONE ? log_level_names[level] : "?";
+}
+
+void lvml_log_get_stats(lvml_log_stats_t* stats, bool reset) {
+    if (stats != NULL) {
+        *stats = log_stats;
+        stats->written = __atomic_load_n(&log_stats.written, __ATOMIC_RELAXED);
+        stats->dropped = __atomic_load_n(&log_stats.dropped, __ATOMIC_RELAXED);
+        stats->pending = __atomic_load_n(&log_head, __ATOMIC_ACQUIRE) - log_tail;
+    }
+    if (reset) {
+        __atomic_store_n(&log_stats.written, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&log_stats.dropped, 0, __ATOMIC_RELAXED);
+        log_stats.drained = 0;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Reserve consecutive slots with a compare-and-swap on the head, then copy
+ * the record in and mark each slot written
+ */
+static void log_store(const log_header_t* header, const void* body) {
+    size_t total = sizeof(*header) + header->size;
+    uint32_t slots = (uint32_t)((total + LOG_SLOT_DATA - 1) / LOG_SLOT_DATA);
+    uint32_t pos = __atomic_load_n(&log_head, __ATOMIC_RELAXED);
+    for (;;) {
+        uint32_t last = pos + slots - 1;
+        uint32_t seq = log_seq_load(last);
+        if ((int32_t)(seq - last) < 0) {
+            // Still holds a record from the previous lap: full
+            __atomic_fetch_add(&log_stats.dropped, 1, __ATOMIC_RELAXED);
+            return;
+        }
+        if (seq == last &&
+            __atomic_compare_exchange_n(&log_head, &pos, pos + slots, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            break;
+        }
+        if (seq != last) {
+            pos = __atomic_load_n(&log_head, __ATOMIC_RELAXED);
+        }
+    }
+
+    const uint8_t* src[2] = { (const uint8_t*)header, (const uint8_t*)body };
+    size_t src_len[2] = { sizeof(*header), header->size };
+    size_t part = 0;
+    size_t part_offset = 0;
+    for (uint32_t i = 0; i < slots; i++) {
+        log_slot_t* slot = &log_slots[(pos + i) & (LVML_LOG_SLOTS - 1)];
+        size_t filled = 0;
+        while (filled < LOG_SLOT_DATA && part < 2) {
+            size_t n = src_len[part] - part_offset;
+            if (n > LOG_SLOT_DATA - filled) {
+                n = LOG_SLOT_DATA - filled;
+            }
+            memcpy(slot->data + filled, src[part] + part_offset, n);
+            filled += n;
+            part_offset += n;
+            if (part_offset == src_len[part]) {
+                part++;
+                part_offset = 0;
+            }
+        }
+        log_seq_store(pos + i, pos + i + 1);
+    }
+    __atomic_fetch_add(&log_stats.written, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * "[time module level] message"
+ */
+static size_t log_format(const uint8_t* record, char* line, size_t size) {
+    log_header_t header;
+    memcpy(&header, record, sizeof(header));
+    const uint8_t* body = record + sizeof(header);
+
+    int len = snprintf(line, size, "[%6u.%03u %s %s] ",
+                       (unsigned)(header.time_ms / 1000), (unsigned)(header.time_ms % 1000),
+                       lvml_log_module_name(header.module), lvml_log_level_name(header.level));
+    if (len < 0 || (size_t)len >= size) {
+        return len < 0 ? 0 : size - 1;
+    }
+
+    if (header.kind == LOG_KIND_TEXT) {
+        size_t n = header.size < size - len - 1 ? header.size : size - len - 1;
+        memcpy(line + len, body, n);
+        len += (int)n;
+        line[len] = '\0';
+    } else {
+        const char* fmt;
+        int32_t args[LVML_LOG_MAX_ARGS] = { 0 };
+        memcpy(&fmt, body, sizeof(fmt));
+        memcpy(args, body + sizeof(fmt), header.size - sizeof(fmt));
+        int n = snprintf(line + len, size - len, fmt, args[0], args[1], args[2], args[3]);
+        if (n > 0) {
+            len += n < (int)(size - len) ? n : (int)(size - len - 1);
+        }
+    }
+
+    // Drop the line break LVGL adds; the writer ends the line
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+        line[--len] = '\0';
+    }
+    return (size_t)len;
+}
+
+static inline uint32_t log_seq_load(uint32_t pos) {
+    uint32_t index = pos & (LVML_LOG_SLOTS - 1);
+    return __atomic_load_n(&log_slots[index].seq, __ATOMIC_ACQUIRE) + index;
+}
+
+static inline void log_seq_store(uint32_t pos, uint32_t seq) {
+    uint32_t index = pos & (LVML_LOG_SLOTS - 1);
+    __atomic_store_n(&log_slots[index].seq, seq - index, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,182 @@
+/**
+ * @file lvml_log.h
+ * @brief Deferred logging through a lock-free ring of binary records
+ *
+ * Logging from a hot path only stores a record: the format string pointer
+ * and up to four integer arguments, or a short copied text. Nothing is
+ * formatted or printed until lvml_log_drain() runs, which LVML schedules
+ * after lvml.tick() or runs on lvml.log_flush(). Any task may log; writers
+ * reserve slots with a compare-and-swap and never block or allocate. When
+ * the ring is full the record is dropped and counted.
+ *
+ * Each module has a runtime level, and calls below LVML_LOG_LEVEL_MIN are
+ * removed at compile time.
+ */
+
+#ifndef LVML_LOG_H
+#define LVML_LOG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_LOG_SLOTS 128          // Ring slots of 32 bytes, power of two
+#define LVML_LOG_MAX_ARGS 4
+#define LVML_LOG_TEXT_MAX 120       // Longer texts are cut
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LVML_LOG_LEVEL_TRACE = 0,
+    LVML_LOG_LEVEL_DEBUG,
+    LVML_LOG_LEVEL_INFO,
+    LVML_LOG_LEVEL_WARN,
+    LVML_LOG_LEVEL_ERROR,
+    LVML_LOG_LEVEL_NONE,            // Only as a module level: log nothing
+} lvml_log_level_t;
+
+typedef enum {
+    LVML_LOG_MOD_CORE = 0,
+    LVML_LOG_MOD_UI,
+    LVML_LOG_MOD_TOUCH,
+    LVML_LOG_MOD_LVGL,
+    LVML_LOG_MOD_NET,
+    LVML_LOG_MOD_SCRIPT,
+    LVML_LOG_MOD_EVENTS,
+    LVML_LOG_MOD_COUNT
+} lvml_log_module_t;
+
+/**
+ * Receives one formatted line, without the trailing newline
+ */
+typedef void (*lvml_log_write_cb_t)(const char* line, size_t len, void* user);
+
+/**
+ * Logging statistics
+ */
+typedef struct {
+    uint32_t written;       // Records stored
+    uint32_t dropped;       // Records lost because the ring was full
+    uint32_t drained;       // Records formatted and written out
+    uint32_t pending;       // Slots waiting to be drained
+} lvml_log_stats_t;
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#ifndef LVML_LOG_LEVEL_MIN
+#define LVML_LOG_LEVEL_MIN LVML_LOG_LEVEL_DEBUG
+#endif
+
+// fmt must be a string literal; its arguments must be integers (%d %u %x %c)
+#define LVML_LOG_AT(level, module, fmt, ...) do {                                         \
+        if (lvml_log_enabled((module), (level))) {                                         \
+            const int32_t lvml_log_args_[] = { 0, __VA_ARGS__ };                           \
+            lvml_log_fmt((module), (level), "" fmt,                                        \
+                         (uint8_t)(sizeof(lvml_log_args_) / sizeof(int32_t) - 1),          \
+                         lvml_log_args_ + 1);                                              \
+        }                                                                                  \
+    } while (0)
+
+#if LVML_LOG_LEVEL_MIN <= LVML_LOG_LEVEL_TRACE
+#define LVML_LOG_TRACE(module, fmt, ...) LVML_LOG_AT(LVML_LOG_LEVEL_TRACE, module, fmt, __VA_ARGS__)
+#else
+#define LVML_LOG_TRACE(module, fmt, ...) do { } while (0)
+#endif
+
+#if LVML_LOG_LEVEL_MIN <= LVML_LOG_LEVEL_DEBUG
+#define LVML_LOG_DEBUG(module, fmt, ...) LVML_LOG_AT(LVML_LOG_LEVEL_DEBUG, module, fmt, __VA_ARGS__)
+#else
+#define LVML_LOG_DEBUG(module, fmt, ...) do { } while (0)
+#endif
+
+#if LVML_LOG_LEVEL_MIN <= LVML_LOG_LEVEL_INFO
+#define LVML_LOG_INFO(module, fmt, ...) LVML_LOG_AT(LVML_LOG_LEVEL_INFO, module, fmt, __VA_ARGS__)
+#else
+#define LVML_LOG_INFO(module, fmt, ...) do { } while (0)
+#endif
+
+#define LVML_LOG_WARN(module, fmt, ...) LVML_LOG_AT(LVML_LOG_LEVEL_WARN, module, fmt, __VA_ARGS__)
+#define LVML_LOG_ERROR(module, fmt, ...) LVML_LOG_AT(LVML_LOG_LEVEL_ERROR, module, fmt, __VA_ARGS__)
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+extern uint8_t lvml_log_levels[LVML_LOG_MOD_COUNT];
+
+/**
+ * Check whether a module logs at a level
+ */
+static inline bool lvml_log_enabled(uint8_t module, uint8_t level) {
+    return module < LVML_LOG_MOD_COUNT && level >= lvml_log_levels[module];
+}
+
+/**
+ * Store a record with a format string and integer arguments; use the
+ * LVML_LOG_* macros rather than calling this directly
+ * @param fmt format string that stays valid forever (a literal)
+ * @param nargs number of arguments, at most LVML_LOG_MAX_ARGS are kept
+ */
+void lvml_log_fmt(uint8_t module, uint8_t level, const char* fmt, uint8_t nargs, const int32_t* args);
+
+/**
+ * Store a record with a copy of a text, e.g. a line LVGL formatted itself
+ * @param len text length, cut to LVML_LOG_TEXT_MAX
+ */
+void lvml_log_text(uint8_t module, uint8_t level, const char* text, size_t len);
+
+/**
+ * Format and write out stored records, oldest first
+ * @param write receives each line
+ * @param max_records stop after this many, 0 for no limit
+ * @return number of records written
+ */
+uint32_t lvml_log_drain(lvml_log_write_cb_t write, void* user, uint32_t max_records);
+
+/**
+ * Check whether records are waiting to be drained
+ */
+bool lvml_log_pending(void);
+
+/**
+ * Set or get a module's runtime level
+ */
+void lvml_log_set_level(uint8_t module, uint8_t level);
+uint8_t lvml_log_get_level(uint8_t module);
+
+/**
+ * Look up a module or level by name ("touch", "warn", ...)
+ * @return the module or level, -1 if unknown
+ */
+int lvml_log_find_module(const char* name);
+int lvml_log_find_level(const char* name);
+
+/**
+ * Name of a module or level
+ */
+const char* lvml_log_module_name(uint8_t module);
+const char* lvml_log_level_name(uint8_t level);
+
+/**
+ * Get logging statistics
+ * @param reset clear the written, dropped and drained counters
+ */
+void lvml_log_get_stats(lvml_log_stats_t* stats, bool reset);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_LOG_H*/
@@ -0,0 +1,66 @@
+/**
+ * @file lvml_mem.h
+ * @brief Allocation of large buffers (PSRAM on the ESP32-S3)
+ */
+
+#ifndef LVML_MEM_H
+#define LVML_MEM_H
+
+#include <stddef.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#else
+#include <stdlib.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Allocate a large buffer, preferring PSRAM
+ * @param size size in bytes
+ * @return buffer, or NULL if out of memory
+ */
+static inline void* lvml_mem_alloc_large(size_t size) {
+#ifdef ESP_PLATFORM
+    void* ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return ptr != NULL ? ptr : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+#else
+    return malloc(size);
+#endif
+}
+
+/**
+ * Resize a buffer from lvml_mem_alloc_large()
+ * @param ptr buffer to resize (may be NULL)
+ * @param size new size in bytes
+ * @return resized buffer, or NULL if out of memory (ptr stays valid)
+ */
+static inline void* lvml_mem_realloc_large(void* ptr, size_t size) {
+#ifdef ESP_PLATFORM
+    void* new_ptr = heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return new_ptr != NULL ? new_ptr : heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);
+#else
+    return realloc(ptr, size);
+#endif
+}
+
+/**
+ * Free a buffer from lvml_mem_alloc_large()
+ * @param ptr buffer to free (may be NULL)
+ */
+static inline void lvml_mem_free_large(void* ptr) {
+#ifdef ESP_PLATFORM
+    heap_caps_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_MEM_H*/
@@ -0,0 +1,101 @@
+/**
+ * @file lvml_patch.c
+ * @brief Binary UI patches pushed by a server
+ */
+
+#include "lvml_patch.h"
+#include "lvml_snapshot.h"
+#include "lvml_varint.h"
+#include <string.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool patch_get_signed(lvml_patch_reader_t* r, int32_t* value);
+static bool patch_get_string(lvml_patch_reader_t* r, const char** str, size_t* len);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_patch_open(lvml_patch_reader_t* r, const uint8_t* data, size_t len) {
+    memset(r, 0, sizeof(*r));
+    r->data = data;
+    r->len = data != NULL ? len : 0;
+}
+
+bool lvml_patch_next(lvml_patch_reader_t* r, lvml_patch_cmd_t* cmd) {
+    if (r->error || r->pos >= r->len) {
+        return false;
+    }
+
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->op = r->data[r->pos++];
+    bool ok = patch_get_string(r, &cmd->target, &cmd->target_len);
+    switch (cmd->op) {
+        case LVML_PATCH_SET:
+            ok = ok && r->pos < r->len;
+            if (ok) {
+                cmd->prop = r->data[r->pos++];
+                ok = cmd->prop < LVML_PATCH_PROP_COUNT &&
+                     (cmd->prop == LVML_PATCH_PROP_TEXT ? patch_get_string(r, &cmd->str, &cmd->str_len) :
+                                                          patch_get_signed(r, &cmd->value));
+            }
+            break;
+        case LVML_PATCH_INSERT:
+            ok = ok && patch_get_signed(r, &cmd->value) && r->pos < r->len;
+            if (ok) {
+                cmd->type = r->data[r->pos++];
+                ok = cmd->type < LVML_SNAPSHOT_TYPE_COUNT &&
+                     patch_get_string(r, &cmd->name, &cmd->name_len) &&
+                     patch_get_string(r, &cmd->str, &cmd->str_len) &&
+                     patch_get_signed(r, &cmd->x) && patch_get_signed(r, &cmd->y) &&
+                     patch_get_signed(r, &cmd->width) && patch_get_signed(r, &cmd->height);
+            }
+            break;
+        case LVML_PATCH_REMOVE:
+            // Removing the root would leave nothing to patch
+            ok = ok && cmd->target_len > 0;
+            break;
+        case LVML_PATCH_BIND_INT:
+            ok = ok && cmd->target_len > 0 && patch_get_signed(r, &cmd->value);
+            break;
+        case LVML_PATCH_BIND_STRING:
+            ok = ok && cmd->target_len > 0 && patch_get_string(r, &cmd->str, &cmd->str_len);
+            break;
+        default:
+            ok = false;
+            break;
+    }
+
+    if (!ok) {
+        r->error = true;
+        return false;
+    }
+    r->cmds++;
+    return true;
+}
+
+bool lvml_patch_copy_name(char* dst, const char* name, size_t len) {
+    if (len >= LVML_PATCH_NAME_MAX || (len > 0 && memchr(name, '\0', len) != NULL)) {
+        return false;
+    }
+    if (len > 0) {
+        memcpy(dst, name, len);
+    }
+    dst[len] = '\0';
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool patch_get_signed(lvml_patch_reader_t* r, int32_t* value) {
+    return lvml_varint_get_signed(r->data, r->len, &r->pos, value);
+}
+
+static bool patch_get_string(lvml_patch_reader_t* r, const char** str, size_t* len) {
+    return lvml_varint_get_string(r->data, r->len, &r->pos, str, len);
+}
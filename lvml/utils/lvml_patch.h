@@ -0,0 +1,147 @@
+/**
+ * @file lvml_patch.h
+ * @brief Binary UI patches pushed by a server (see network/lvml_push.h)
+ *
+ * An update is a list of commands on the live widget tree, applied
+ * together: set a property of an object, insert or remove an object, or
+ * set a bound subject (core/lvml_bind.h). Objects are addressed by their
+ * name="..." and new ones use the widget types of lvml_snapshot, so an
+ * update that changes one value is a dozen bytes. It has no LVGL or
+ * MicroPython dependency; the core applies it (lvml_live).
+ *
+ * Layout of an update, varints as in lvml_varint.h (LEB128, signed
+ * values zigzag) and strings as varint length and bytes:
+ *   SET          u8 op, string target, u8 property (lvml_patch_prop_t),
+ *                string value for LVML_PATCH_PROP_TEXT, zigzag varint
+ *                otherwise (colors 0xRRGGBB)
+ *   INSERT       u8 op, string parent, zigzag varint child index (-1:
+ *                last), u8 type (lvml_snapshot_type_t), string name,
+ *                string text, zigzag varint x, y, width and height
+ *                (negative sizes: size to content)
+ *   REMOVE       u8 op, string target
+ *   BIND_INT     u8 op, string subject, zigzag varint value
+ *   BIND_STRING  u8 op, string subject, string value
+ * An empty target or parent is the root of the loaded XML (or the screen).
+ */
+
+#ifndef LVML_PATCH_H
+#define LVML_PATCH_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_PATCH_NAME_MAX 32          // Longest object or subject name, with the NUL
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Commands of an update
+ */
+typedef enum {
+    LVML_PATCH_SET = 0,
+    LVML_PATCH_INSERT,
+    LVML_PATCH_REMOVE,
+    LVML_PATCH_BIND_INT,
+    LVML_PATCH_BIND_STRING,
+    LVML_PATCH_OP_COUNT,
+} lvml_patch_op_t;
+
+/**
+ * Properties LVML_PATCH_SET can change
+ */
+typedef enum {
+    LVML_PATCH_PROP_TEXT = 0,           // Label, text area, checkbox or a button's label
+    LVML_PATCH_PROP_X,
+    LVML_PATCH_PROP_Y,
+    LVML_PATCH_PROP_WIDTH,
+    LVML_PATCH_PROP_HEIGHT,
+    LVML_PATCH_PROP_VALUE,              // Slider, bar, arc, dropdown selection, switch/checkbox state
+    LVML_PATCH_PROP_HIDDEN,
+    LVML_PATCH_PROP_CHECKED,
+    LVML_PATCH_PROP_DISABLED,
+    LVML_PATCH_PROP_BG_COLOR,
+    LVML_PATCH_PROP_BG_OPA,
+    LVML_PATCH_PROP_BORDER_COLOR,
+    LVML_PATCH_PROP_BORDER_WIDTH,
+    LVML_PATCH_PROP_TEXT_COLOR,
+    LVML_PATCH_PROP_RADIUS,
+    LVML_PATCH_PROP_COUNT,
+} lvml_patch_prop_t;
+
+/**
+ * One command; strings are not NUL-terminated and point into the update
+ */
+typedef struct {
+    uint8_t op;                 // lvml_patch_op_t
+    uint8_t prop;               // SET: lvml_patch_prop_t
+    uint8_t type;               // INSERT: lvml_snapshot_type_t
+    const char* target;         // Object, parent (INSERT) or subject name
+    size_t target_len;
+    const char* name;           // INSERT: name of the new object
+    size_t name_len;
+    const char* str;            // SET text, INSERT text or BIND_STRING value
+    size_t str_len;
+    int32_t value;              // SET / BIND_INT value, INSERT child index
+    int32_t x;                  // INSERT geometry
+    int32_t y;
+    int32_t width;
+    int32_t height;
+} lvml_patch_cmd_t;
+
+/**
+ * Update being read; borrows the update bytes
+ */
+typedef struct {
+    const uint8_t* data;
+    size_t len;
+    size_t pos;
+    uint32_t cmds;              // Commands read so far
+    bool error;                 // Corrupt data was found
+} lvml_patch_reader_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start reading an update
+ * @param r reader state
+ * @param data update bytes
+ * @param len number of bytes
+ */
+void lvml_patch_open(lvml_patch_reader_t* r, const uint8_t* data, size_t len);
+
+/**
+ * Read the next command
+ * @param r reader state
+ * @param cmd receives the command
+ * @return false at the end of the update or on corrupt data (r->error)
+ */
+bool lvml_patch_next(lvml_patch_reader_t* r, lvml_patch_cmd_t* cmd);
+
+/**
+ * Copy a name of a command as a C string
+ * @param dst output buffer of LVML_PATCH_NAME_MAX bytes
+ * @param name name bytes
+ * @param len number of bytes
+ * @return false if the name is too long or contains a NUL
+ */
+bool lvml_patch_copy_name(char* dst, const char* name, size_t len);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_PATCH_H*/
@@ -0,0 +1,147 @@
+/**
+ * @file lvml_qoi.c
+ * @brief Streaming QOI image encoder for RGB565 pixels
+ */
+
+#include "lvml_qoi.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF 0x40
+#define QOI_OP_LUMA 0x80
+#define QOI_OP_RUN 0xC0
+#define QOI_OP_RGB 0xFE
+#define QOI_RUN_MAX 62
+
+#define QOI_R(px) ((uint8_t)((px) >> 24))
+#define QOI_G(px) ((uint8_t)((px) >> 16))
+#define QOI_B(px) ((uint8_t)((px) >> 8))
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void qoi_put(lvml_qoi_encoder_t* enc, uint8_t byte);
+static void qoi_flush(lvml_qoi_encoder_t* enc);
+static void qoi_encode(lvml_qoi_encoder_t* enc, uint32_t px);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lvml_qoi_begin(lvml_qoi_encoder_t* enc, uint32_t width, uint32_t height,
+                    lvml_qoi_write_cb_t write, void* user_data) {
+    memset(enc, 0, sizeof(lvml_qoi_encoder_t));
+    enc->write = write;
+    enc->user_data = user_data;
+    enc->prev = 0x000000FF;
+
+    // "qoif", big-endian width and height, 3 channels, sRGB
+    const uint8_t magic[4] = { 'q', 'o', 'i', 'f' };
+    for (int i = 0; i < 4; i++) {
+        qoi_put(enc, magic[i]);
+    }
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        qoi_put(enc, (uint8_t)(width >> shift));
+    }
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        qoi_put(enc, (uint8_t)(height >> shift));
+    }
+    qoi_put(enc, 3);
+    qoi_put(enc, 0);
+    return !enc->failed;
+}
+
+void lvml_qoi_push_rgb565(lvml_qoi_encoder_t* enc, const uint16_t* pixels, size_t count) {
+    for (size_t i = 0; i < count && !enc->failed; i++) {
+        uint16_t c = pixels[i];
+        uint32_t r = (c >> 11) & 0x1F;
+        uint32_t g = (c >> 5) & 0x3F;
+        uint32_t b = c & 0x1F;
+        // Replicate the high bits so white stays 0xFF
+        r = (r << 3) | (r >> 2);
+        g = (g << 2) | (g >> 4);
+        b = (b << 3) | (b >> 2);
+        qoi_encode(enc, (r << 24) | (g << 16) | (b << 8) | 0xFF);
+    }
+}
+
+bool lvml_qoi_end(lvml_qoi_encoder_t* enc) {
+    if (enc->run > 0) {
+        qoi_put(enc, QOI_OP_RUN | (uint8_t)(enc->run - 1));
+        enc->run = 0;
+    }
+    for (int i = 0; i < 7; i++) {
+        qoi_put(enc, 0);
+    }
+    qoi_put(enc, 1);
+    qoi_flush(enc);
+    return !enc->failed;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void qoi_put(lvml_qoi_encoder_t* enc, uint8_t byte) {
+    enc->buf[enc->len++] = byte;
+    if (enc->len == LVML_QOI_BUF_SIZE) {
+        qoi_flush(enc);
+    }
+}
+
+static void qoi_flush(lvml_qoi_encoder_t* enc) {
+    if (enc->len > 0 && !enc->failed) {
+        enc->failed = !enc->write(enc->buf, enc->len, enc->user_data);
+        enc->bytes += enc->len;
+    }
+    enc->len = 0;
+}
+
+static void qoi_encode(lvml_qoi_encoder_t* enc, uint32_t px) {
+    if (px == enc->prev) {
+        enc->run++;
+        if (enc->run == QOI_RUN_MAX) {
+            qoi_put(enc, QOI_OP_RUN | (uint8_t)(enc->run - 1));
+            enc->run = 0;
+        }
+        return;
+    }
+    if (enc->run > 0) {
+        qoi_put(enc, QOI_OP_RUN | (uint8_t)(enc->run - 1));
+        enc->run = 0;
+    }
+
+    uint8_t r = QOI_R(px);
+    uint8_t g = QOI_G(px);
+    uint8_t b = QOI_B(px);
+    uint32_t hash = (r * 3 + g * 5 + b * 7 + 0xFF * 11) % 64;
+    if (enc->index[hash] == px) {
+        qoi_put(enc, QOI_OP_INDEX | (uint8_t)hash);
+    } else {
+        enc->index[hash] = px;
+
+        // Alpha is always opaque, so the differences are all that matter
+        int8_t vr = (int8_t)(r - QOI_R(enc->prev));
+        int8_t vg = (int8_t)(g - QOI_G(enc->prev));
+        int8_t vb = (int8_t)(b - QOI_B(enc->prev));
+        int8_t vg_r = (int8_t)(vr - vg);
+        int8_t vg_b = (int8_t)(vb - vg);
+        if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+            qoi_put(enc, QOI_OP_DIFF | (uint8_t)((vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+        } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+            qoi_put(enc, QOI_OP_LUMA | (uint8_t)(vg + 32));
+            qoi_put(enc, (uint8_t)((vg_r + 8) << 4 | (vg_b + 8)));
+        } else {
+            qoi_put(enc, QOI_OP_RGB);
+            qoi_put(enc, r);
+            qoi_put(enc, g);
+            qoi_put(enc, b);
+        }
+    }
+    enc->prev = px;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file lvml_qoi.h
+ * @brief Streaming QOI image encoder for RGB565 pixels
+ *
+ * Pixels are pushed row by row and the encoded stream is handed to a write
+ * callback in small chunks, so an image of any size is encoded with a fixed
+ * amount of memory. See https://qoiformat.org for the format.
+ */
+
+#ifndef LVML_QOI_H
+#define LVML_QOI_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_QOI_HEADER_SIZE 14
+#define LVML_QOI_BUF_SIZE 256       // Output is written in chunks of this size
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Receives encoded output
+ * @return false to stop encoding
+ */
+typedef bool (*lvml_qoi_write_cb_t)(const uint8_t* data, size_t len, void* user_data);
+
+/**
+ * Encoder state
+ */
+typedef struct {
+    lvml_qoi_write_cb_t write;
+    void* user_data;
+    uint32_t index[64];     // Recently seen pixels, 0xRRGGBBAA
+    uint32_t prev;
+    uint32_t run;
+    uint8_t buf[LVML_QOI_BUF_SIZE];
+    size_t len;
+    size_t bytes;           // Total bytes written
+    bool failed;            // The write callback returned false
+} lvml_qoi_encoder_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start an image and write its header
+ * @param enc encoder state
+ * @param width image width
+ * @param height image height
+ * @param write output callback
+ * @param user_data user pointer for write
+ * @return false if the header couldn't be written
+ */
+bool lvml_qoi_begin(lvml_qoi_encoder_t* enc, uint32_t width, uint32_t height,
+                    lvml_qoi_write_cb_t write, void* user_data);
+
+/**
+ * Encode pixels, continuing from the previous call
+ * @param enc encoder state
+ * @param pixels RGB565 pixels in native byte order
+ * @param count number of pixels
+ */
+void lvml_qoi_push_rgb565(lvml_qoi_encoder_t* enc, const uint16_t* pixels, size_t count);
+
+/**
+ * Finish the image: write the pending run and the end marker
+ * @param enc encoder state
+ * @return false if any write failed
+ */
+bool lvml_qoi_end(lvml_qoi_encoder_t* enc);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_QOI_H*/
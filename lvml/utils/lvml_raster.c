@@ -0,0 +1,153 @@
+/**
+ * @file lvml_raster.c
+ * @brief Clipped drawing primitives on raw RGB565 / ARGB8888 pixel buffers
+ */
+
+#include "lvml_raster.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define RASTER_EMPTY ((lvml_raster_area_t){ 0, 0, -1, -1 })
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void raster_fill_row(uint8_t* dst, int32_t count, uint8_t bpp, uint32_t pixel);
+static void raster_area_add(lvml_raster_area_t* area, int32_t x, int32_t y);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lvml_raster_pixel(uint8_t bpp, uint32_t color_hex) {
+    if (bpp == 2) {
+        return ((color_hex >> 8) & 0xF800) | ((color_hex >> 5) & 0x07E0) | ((color_hex >> 3) & 0x001F);
+    }
+    return 0xFF000000 | (color_hex & 0xFFFFFF);
+}
+
+lvml_raster_area_t lvml_raster_clip(const lvml_raster_t* raster, int32_t x, int32_t y, int32_t width, int32_t height) {
+    if (width <= 0 || height <= 0) {
+        return RASTER_EMPTY;
+    }
+
+    lvml_raster_area_t area = { x, y, x + width - 1, y + height - 1 };
+    if (area.x1 < 0) {
+        area.x1 = 0;
+    }
+    if (area.y1 < 0) {
+        area.y1 = 0;
+    }
+    if (area.x2 >= raster->width) {
+        area.x2 = raster->width - 1;
+    }
+    if (area.y2 >= raster->height) {
+        area.y2 = raster->height - 1;
+    }
+    return lvml_raster_area_empty(&area) ? RASTER_EMPTY : area;
+}
+
+lvml_raster_area_t lvml_raster_fill(lvml_raster_t* raster, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t pixel) {
+    lvml_raster_area_t area = lvml_raster_clip(raster, x, y, width, height);
+    if (lvml_raster_area_empty(&area)) {
+        return area;
+    }
+
+    // Fill the first row pixel by pixel, then copy it to the other rows
+    size_t row_bytes = (size_t)(area.x2 - area.x1 + 1) * raster->bpp;
+    uint8_t* first = raster->data + (size_t)area.y1 * raster->stride + (size_t)area.x1 * raster->bpp;
+    raster_fill_row(first, area.x2 - area.x1 + 1, raster->bpp, pixel);
+    for (int32_t row = area.y1 + 1; row <= area.y2; row++) {
+        memcpy(first + (size_t)(row - area.y1) * raster->stride, first, row_bytes);
+    }
+    return area;
+}
+
+lvml_raster_area_t lvml_raster_line(lvml_raster_t* raster, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t pixel) {
+    lvml_raster_area_t area = RASTER_EMPTY;
+
+    // Bresenham; points outside the buffer are skipped
+    int32_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int32_t dy = y1 > y0 ? y0 - y1 : y1 - y0;
+    int32_t sx = x0 < x1 ? 1 : -1;
+    int32_t sy = y0 < y1 ? 1 : -1;
+    int32_t err = dx + dy;
+    for (;;) {
+        if (x0 >= 0 && y0 >= 0 && x0 < raster->width && y0 < raster->height) {
+            uint8_t* dst = raster->data + (size_t)y0 * raster->stride + (size_t)x0 * raster->bpp;
+            raster_fill_row(dst, 1, raster->bpp, pixel);
+            raster_area_add(&area, x0, y0);
+        }
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+    return area;
+}
+
+lvml_raster_area_t lvml_raster_blit(lvml_raster_t* raster, int32_t x, int32_t y,
+                                    const uint8_t* src, int32_t width, int32_t height, uint32_t src_stride) {
+    lvml_raster_area_t area = lvml_raster_clip(raster, x, y, width, height);
+    if (lvml_raster_area_empty(&area)) {
+        return area;
+    }
+
+    size_t row_bytes = (size_t)(area.x2 - area.x1 + 1) * raster->bpp;
+    const uint8_t* from = src + (size_t)(area.y1 - y) * src_stride + (size_t)(area.x1 - x) * raster->bpp;
+    uint8_t* to = raster->data + (size_t)area.y1 * raster->stride + (size_t)area.x1 * raster->bpp;
+    for (int32_t row = area.y1; row <= area.y2; row++) {
+        memcpy(to, from, row_bytes);
+        from += src_stride;
+        to += raster->stride;
+    }
+    return area;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void raster_fill_row(uint8_t* dst, int32_t count, uint8_t bpp, uint32_t pixel) {
+    if (bpp == 2) {
+        uint16_t value = (uint16_t)pixel;
+        for (int32_t i = 0; i < count; i++) {
+            memcpy(dst + i * 2, &value, 2);
+        }
+    } else {
+        for (int32_t i = 0; i < count; i++) {
+            memcpy(dst + i * 4, &pixel, 4);
+        }
+    }
+}
+
+static void raster_area_add(lvml_raster_area_t* area, int32_t x, int32_t y) {
+    if (lvml_raster_area_empty(area)) {
+        *area = (lvml_raster_area_t){ x, y, x, y };
+        return;
+    }
+    if (x < area->x1) {
+        area->x1 = x;
+    }
+    if (x > area->x2) {
+        area->x2 = x;
+    }
+    if (y < area->y1) {
+        area->y1 = y;
+    }
+    if (y > area->y2) {
+        area->y2 = y;
+    }
+}
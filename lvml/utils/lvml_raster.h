@@ -0,0 +1,98 @@
+/**
+ * @file lvml_raster.h
+ * @brief Clipped drawing primitives on raw RGB565 / ARGB8888 pixel buffers
+ *
+ * Used by lvml.canvas() to draw straight into the canvas buffer. Every
+ * primitive reports the area it touched so only that area is redrawn.
+ */
+
+#ifndef LVML_RASTER_H
+#define LVML_RASTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Pixel buffer, rows of `stride` bytes with `bpp` bytes per pixel (2 or 4)
+ */
+typedef struct {
+    uint8_t* data;
+    int32_t width;
+    int32_t height;
+    uint32_t stride;
+    uint8_t bpp;
+} lvml_raster_t;
+
+/**
+ * Inclusive area in buffer coordinates; empty when x1 > x2
+ */
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+} lvml_raster_area_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Convert a 0xRRGGBB color to the buffer's pixel value
+ * @param bpp bytes per pixel: 2 for RGB565, 4 for ARGB8888 (opaque)
+ * @param color_hex color (0xRRGGBB format)
+ * @return pixel value
+ */
+uint32_t lvml_raster_pixel(uint8_t bpp, uint32_t color_hex);
+
+/**
+ * Clip a rectangle to the buffer
+ * @return clipped area, empty if nothing is left
+ */
+lvml_raster_area_t lvml_raster_clip(const lvml_raster_t* raster, int32_t x, int32_t y, int32_t width, int32_t height);
+
+/**
+ * Check whether an area is empty
+ */
+static inline bool lvml_raster_area_empty(const lvml_raster_area_t* area) {
+    return area->x1 > area->x2 || area->y1 > area->y2;
+}
+
+/**
+ * Fill a rectangle
+ * @param pixel value from lvml_raster_pixel()
+ * @return area touched
+ */
+lvml_raster_area_t lvml_raster_fill(lvml_raster_t* raster, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t pixel);
+
+/**
+ * Draw a one pixel wide line, both end points included
+ * @param pixel value from lvml_raster_pixel()
+ * @return area touched
+ */
+lvml_raster_area_t lvml_raster_line(lvml_raster_t* raster, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t pixel);
+
+/**
+ * Copy pixels of the same format into the buffer
+ * @param src source pixels, rows of src_stride bytes
+ * @param width source width in pixels
+ * @param height source height in pixels
+ * @return area touched
+ */
+lvml_raster_area_t lvml_raster_blit(lvml_raster_t* raster, int32_t x, int32_t y,
+                                    const uint8_t* src, int32_t width, int32_t height, uint32_t src_stride);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_RASTER_H*/
@@ -0,0 +1,226 @@
+/**
+ * @file lvml_record.c
+ * @brief Compact recordings of pointer input for deterministic replays
+ */
+
+#include "lvml_record.h"
+#include "lvml_mem.h"
+#include "lvml_varint.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define RECORD_INITIAL_CAP 1024
+#define RECORD_FLAG_PRESSED 0x80
+#define RECORD_COUNT_MASK 0x07
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool record_same(const lvml_record_t* a, const lvml_record_t* b);
+static bool record_get_varint(lvml_player_t* player, uint32_t* value);
+static bool record_get_signed(lvml_player_t* player, int32_t* value);
+static void record_decode_next(lvml_player_t* player);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_recorder_init(lvml_recorder_t* rec, uint16_t width, uint16_t height) {
+    memset(rec, 0, sizeof(*rec));
+    rec->data = lvml_mem_alloc_large(RECORD_INITIAL_CAP);
+    if (rec->data == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+    rec->cap = RECORD_INITIAL_CAP;
+
+    uint8_t* h = rec->data;
+    memcpy(h, LVML_RECORD_MAGIC, 4);
+    h[4] = LVML_RECORD_VERSION;
+    h[5] = 0;
+    h[6] = (uint8_t)width;
+    h[7] = (uint8_t)(width >> 8);
+    h[8] = (uint8_t)height;
+    h[9] = (uint8_t)(height >> 8);
+    h[10] = 0;
+    h[11] = 0;
+    rec->len = LVML_RECORD_HEADER_SIZE;
+    return LVML_OK;
+}
+
+lvml_error_t lvml_recorder_add(lvml_recorder_t* rec, const lvml_record_t* state) {
+    uint8_t count = state->count > LVML_GESTURE_MAX_CONTACTS ? LVML_GESTURE_MAX_CONTACTS : state->count;
+    // Idle reads are dropped; repeated presses are kept because the gesture
+    // recognizer's timing (long press) depends on every frame while pressed
+    if (rec->records > 0 && !state->pressed && record_same(&rec->last, state)) {
+        rec->skipped++;
+        return LVML_OK;
+    }
+
+    if (rec->len + LVML_RECORD_MAX_SIZE > rec->cap) {
+        size_t cap = rec->cap * 2;
+        uint8_t* data = lvml_mem_realloc_large(rec->data, cap);
+        if (data == NULL) {
+            return LVML_ERROR_MEMORY;
+        }
+        rec->data = data;
+        rec->cap = cap;
+    }
+
+    // The first record starts the clock; its pointer delta is from 0,0
+    if (rec->records == 0) {
+        rec->start_ms = state->time_ms;
+        rec->last.time_ms = state->time_ms;
+    }
+
+    uint8_t* out = rec->data + rec->len;
+    size_t n = lvml_varint_put(out, state->time_ms - rec->last.time_ms);
+    out[n++] = (uint8_t)((state->pressed ? RECORD_FLAG_PRESSED : 0) | count);
+    n += lvml_varint_put_signed(out + n, state->x - rec->last.x);
+    n += lvml_varint_put_signed(out + n, state->y - rec->last.y);
+    for (uint8_t i = 0; i < count; i++) {
+        const lvml_gesture_contact_t* c = &state->contacts[i];
+        out[n++] = c->id;
+        n += lvml_varint_put_signed(out + n, c->x - state->x);
+        n += lvml_varint_put_signed(out + n, c->y - state->y);
+    }
+    rec->len += n;
+    rec->records++;
+
+    rec->last = *state;
+    rec->last.count = count;
+    return LVML_OK;
+}
+
+void lvml_recorder_free(lvml_recorder_t* rec) {
+    lvml_mem_free_large(rec->data);
+    rec->data = NULL;
+    rec->len = 0;
+    rec->cap = 0;
+}
+
+lvml_error_t lvml_player_open(lvml_player_t* player, const uint8_t* data, size_t len, uint16_t speed_pct) {
+    if (player == NULL || data == NULL || len < LVML_RECORD_HEADER_SIZE ||
+        memcmp(data, LVML_RECORD_MAGIC, 4) != 0 || data[4] != LVML_RECORD_VERSION) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    memset(player, 0, sizeof(*player));
+    player->data = data;
+    player->len = len;
+    player->pos = LVML_RECORD_HEADER_SIZE;
+    player->width = (uint16_t)(data[6] | data[7] << 8);
+    player->height = (uint16_t)(data[8] | data[9] << 8);
+    player->speed_pct = speed_pct;
+    record_decode_next(player);
+    return LVML_OK;
+}
+
+bool lvml_player_due(const lvml_player_t* player, uint32_t now_ms) {
+    if (!player->has_next) {
+        return false;
+    }
+    if (player->speed_pct == LVML_RECORD_SPEED_STEP) {
+        return true;
+    }
+    uint32_t elapsed = player->started ? now_ms - player->start_ms : 0;
+    return (uint64_t)elapsed * player->speed_pct >= (uint64_t)player->next.time_ms * 100;
+}
+
+bool lvml_player_poll(lvml_player_t* player, uint32_t now_ms, lvml_record_t* state) {
+    if (!player->started) {
+        player->started = true;
+        player->start_ms = now_ms;
+    }
+    if (!lvml_player_due(player, now_ms)) {
+        return false;
+    }
+    *state = player->next;
+    player->played++;
+    record_decode_next(player);
+    return true;
+}
+
+bool lvml_player_done(const lvml_player_t* player) {
+    return !player->has_next;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool record_same(const lvml_record_t* a, const lvml_record_t* b) {
+    uint8_t count = b->count > LVML_GESTURE_MAX_CONTACTS ? LVML_GESTURE_MAX_CONTACTS : b->count;
+    if (a->pressed != b->pressed || a->x != b->x || a->y != b->y || a->count != count) {
+        return false;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        const lvml_gesture_contact_t* ca = &a->contacts[i];
+        const lvml_gesture_contact_t* cb = &b->contacts[i];
+        if (ca->id != cb->id || ca->x != cb->x || ca->y != cb->y) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static bool record_get_varint(lvml_player_t* player, uint32_t* value) {
+    return lvml_varint_get(player->data, player->len, &player->pos, value);
+}
+
+static bool record_get_signed(lvml_player_t* player, int32_t* value) {
+    return lvml_varint_get_signed(player->data, player->len, &player->pos, value);
+}
+
+/**
+ * Decode the record after player->next, which holds the previous state the
+ * deltas apply to. Clears has_next at the end of the data and also sets
+ * error if the data ends inside a record
+ */
+static void record_decode_next(lvml_player_t* player) {
+    lvml_record_t* r = &player->next;
+    player->has_next = false;
+    if (player->pos >= player->len) {
+        return;
+    }
+
+    uint32_t dt;
+    int32_t dx, dy;
+    if (!record_get_varint(player, &dt) || player->pos >= player->len) {
+        player->error = true;
+        return;
+    }
+    uint8_t flags = player->data[player->pos++];
+    if (!record_get_signed(player, &dx) || !record_get_signed(player, &dy)) {
+        player->error = true;
+        return;
+    }
+    r->time_ms += dt;
+    r->pressed = (flags & RECORD_FLAG_PRESSED) != 0;
+    r->x += dx;
+    r->y += dy;
+    r->count = flags & RECORD_COUNT_MASK;
+    if (r->count > LVML_GESTURE_MAX_CONTACTS) {
+        player->error = true;
+        return;
+    }
+    for (uint8_t i = 0; i < r->count; i++) {
+        lvml_gesture_contact_t* c = &r->contacts[i];
+        if (player->pos >= player->len) {
+            player->error = true;
+            return;
+        }
+        c->id = player->data[player->pos++];
+        if (!record_get_signed(player, &c->x) || !record_get_signed(player, &c->y)) {
+            player->error = true;
+            return;
+        }
+        c->x += r->x;
+        c->y += r->y;
+    }
+    player->has_next = true;
+}
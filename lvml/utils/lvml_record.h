@@ -0,0 +1,155 @@
+/**
+ * @file lvml_record.h
+ * @brief Compact recordings of pointer input for deterministic replays
+ *
+ * A recording is the sequence of states an input read callback returned:
+ * pointer position, pressed state and every finger the controller reported.
+ * Released reads that repeat the one before are not stored, so idle time
+ * costs nothing; a held finger costs a few bytes per read. It has no LVGL
+ * or MicroPython dependency, so recordings can be made and replayed on the
+ * host too.
+ *
+ * Layout (little-endian):
+ *   header   "LVIR", u8 version, u8 reserved, u16 width, u16 height, u16 reserved
+ *   records  varint ms since the previous record,
+ *            u8 flags (bit 7 pressed, bits 0-2 contact count),
+ *            zigzag varint x and y change of the pointer,
+ *            per contact: u8 track id, zigzag varint x and y from the pointer
+ */
+
+#ifndef LVML_RECORD_H
+#define LVML_RECORD_H
+
+#include "utils/lvml_common.h"
+#include "utils/lvml_gesture.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_RECORD_MAGIC "LVIR"
+#define LVML_RECORD_VERSION 1
+#define LVML_RECORD_HEADER_SIZE 12
+#define LVML_RECORD_MAX_SIZE (1 + 5 + 1 + 2 * 5 + LVML_GESTURE_MAX_CONTACTS * (1 + 2 * 5))
+#define LVML_RECORD_SPEED_STEP 0        // Player speed: one record per poll
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * One input state
+ */
+typedef struct {
+    uint32_t time_ms;           // Recorder: any clock; player: ms since the first record
+    bool pressed;
+    int32_t x;                  // Pointer position reported to LVGL
+    int32_t y;
+    uint8_t count;              // Fingers down
+    lvml_gesture_contact_t contacts[LVML_GESTURE_MAX_CONTACTS];
+} lvml_record_t;
+
+/**
+ * Recording in progress; owns its buffer
+ */
+typedef struct {
+    uint8_t* data;              // Header and records, from lvml_mem_alloc_large()
+    size_t len;
+    size_t cap;
+    uint32_t records;           // Records stored
+    uint32_t skipped;           // Released reads that repeated the previous state
+    uint32_t start_ms;
+    lvml_record_t last;
+} lvml_recorder_t;
+
+/**
+ * Replay of a recording; borrows the recording bytes
+ */
+typedef struct {
+    const uint8_t* data;
+    size_t len;
+    size_t pos;                 // Next record to decode
+    uint16_t width;
+    uint16_t height;
+    uint16_t speed_pct;         // 100 plays in real time, LVML_RECORD_SPEED_STEP one record per poll
+    bool started;
+    bool has_next;
+    bool error;                 // Stopped at a corrupt record
+    uint32_t start_ms;
+    uint32_t played;
+    lvml_record_t next;         // Decoded ahead, so it is known when it is due
+} lvml_player_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start a recording
+ * @param rec recorder to set up
+ * @param width display width the coordinates refer to
+ * @param height display height
+ * @return LVML_OK or LVML_ERROR_MEMORY
+ */
+lvml_error_t lvml_recorder_init(lvml_recorder_t* rec, uint16_t width, uint16_t height);
+
+/**
+ * Store an input state unless it is a release repeating the previous one
+ * @param rec recorder
+ * @param state input state; contacts beyond LVML_GESTURE_MAX_CONTACTS are ignored
+ * @return LVML_OK, or LVML_ERROR_MEMORY if the buffer couldn't grow
+ */
+lvml_error_t lvml_recorder_add(lvml_recorder_t* rec, const lvml_record_t* state);
+
+/**
+ * Release a recorder's buffer
+ * @param rec recorder
+ */
+void lvml_recorder_free(lvml_recorder_t* rec);
+
+/**
+ * Check a recording's header and prepare to replay it
+ * @param player receives the player
+ * @param data recording bytes, must stay valid while the player is used
+ * @param len number of bytes
+ * @param speed_pct playback speed in percent, LVML_RECORD_SPEED_STEP to step
+ * @return LVML_OK, or LVML_ERROR_INVALID_PARAM if data isn't a recording
+ */
+lvml_error_t lvml_player_open(lvml_player_t* player, const uint8_t* data, size_t len, uint16_t speed_pct);
+
+/**
+ * Check whether the next record is due
+ * @param player player
+ * @param now_ms current time; the first poll starts the clock
+ * @return true if lvml_player_poll() would return a record
+ */
+bool lvml_player_due(const lvml_player_t* player, uint32_t now_ms);
+
+/**
+ * Take the next record once it is due
+ * @param player player
+ * @param now_ms current time; the first call starts the clock
+ * @param state receives the record, time_ms relative to the first record
+ * @return true if a record was taken
+ */
+bool lvml_player_poll(lvml_player_t* player, uint32_t now_ms, lvml_record_t* state);
+
+/**
+ * Check whether every record was played
+ * @param player player
+ * @return true at the end of the recording or at a corrupt record
+ */
+bool lvml_player_done(const lvml_player_t* player);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_RECORD_H*/
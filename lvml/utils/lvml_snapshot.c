@@ -0,0 +1,372 @@
+/**
+ * @file lvml_snapshot.c
+ * @brief Compact snapshots of a widget tree for restoring the UI on wake
+ */
+
+#include "lvml_snapshot.h"
+#include "lvml_mem.h"
+#include "lvml_varint.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SNAPSHOT_INITIAL_CAP 1024
+#define SNAPSHOT_VARINT_MAX 5
+#define SNAPSHOT_NODE_MAX (2 + 12 * SNAPSHOT_VARINT_MAX)    // Node without its string bytes
+#define SNAPSHOT_STYLE_MAX (1 + 3 * 3 + 2 + 3 * SNAPSHOT_VARINT_MAX)
+
+// Style property bits, as lvml_style_prop_t
+#define SNAPSHOT_BG_COLOR     (1 << 0)
+#define SNAPSHOT_BG_OPA       (1 << 1)
+#define SNAPSHOT_BORDER_COLOR (1 << 2)
+#define SNAPSHOT_BORDER_WIDTH (1 << 3)
+#define SNAPSHOT_BORDER_OPA   (1 << 4)
+#define SNAPSHOT_TEXT_COLOR   (1 << 5)
+#define SNAPSHOT_PAD_ALL      (1 << 6)
+#define SNAPSHOT_RADIUS       (1 << 7)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool snapshot_reserve(lvml_snapshot_writer_t* w, size_t size);
+static void snapshot_put_varint(lvml_snapshot_writer_t* w, uint32_t value);
+static void snapshot_put_signed(lvml_snapshot_writer_t* w, int32_t value);
+static void snapshot_put_color(lvml_snapshot_writer_t* w, uint32_t color);
+static void snapshot_put_string(lvml_snapshot_writer_t* w, const char* str, size_t len);
+static bool snapshot_same_style(const lvml_snapshot_style_t* a, const lvml_snapshot_style_t* b);
+static bool snapshot_get_varint(lvml_snapshot_reader_t* r, uint32_t* value);
+static bool snapshot_get_signed(lvml_snapshot_reader_t* r, int32_t* value);
+static bool snapshot_get_color(lvml_snapshot_reader_t* r, uint32_t* color);
+static bool snapshot_get_string(lvml_snapshot_reader_t* r, const char** str, size_t* len);
+static bool snapshot_get_style(lvml_snapshot_reader_t* r, lvml_snapshot_style_t* style);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_snapshot_begin(lvml_snapshot_writer_t* w, uint16_t width, uint16_t height) {
+    memset(w, 0, sizeof(*w));
+    w->data = lvml_mem_alloc_large(SNAPSHOT_INITIAL_CAP);
+    if (w->data == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+    w->cap = SNAPSHOT_INITIAL_CAP;
+    w->width = width;
+    w->height = height;
+    // The header is filled in by lvml_snapshot_end() once the counts are known
+    w->len = LVML_SNAPSHOT_HEADER_SIZE;
+    return LVML_OK;
+}
+
+uint16_t lvml_snapshot_add_style(lvml_snapshot_writer_t* w, const lvml_snapshot_style_t* style) {
+    if (style->set == 0) {
+        return 0;
+    }
+    for (uint16_t i = 0; i < w->styles; i++) {
+        if (snapshot_same_style(&w->style_table[i], style)) {
+            return (uint16_t)(i + 1);
+        }
+    }
+    if (w->styles == LVML_SNAPSHOT_STYLES_MAX) {
+        w->styles_dropped++;
+        return 0;
+    }
+    w->style_table[w->styles++] = *style;
+    return w->styles;
+}
+
+uint16_t lvml_snapshot_add(lvml_snapshot_writer_t* w, const lvml_snapshot_node_t* node) {
+    if (w->failed || w->nodes == LVML_SNAPSHOT_NODES_MAX || node->parent > w->nodes ||
+        node->style > w->styles) {
+        w->failed = true;
+        return 0;
+    }
+    if (!snapshot_reserve(w, SNAPSHOT_NODE_MAX + node->name_len + node->text_len + node->extra_len)) {
+        return 0;
+    }
+
+    w->data[w->len++] = node->type;
+    w->data[w->len++] = node->flags;
+    snapshot_put_varint(w, node->parent);
+    snapshot_put_signed(w, node->x);
+    snapshot_put_signed(w, node->y);
+    snapshot_put_signed(w, node->width);
+    snapshot_put_signed(w, node->height);
+    snapshot_put_varint(w, node->style);
+    snapshot_put_string(w, node->name, node->name_len);
+    snapshot_put_string(w, node->text, node->text_len);
+    snapshot_put_string(w, node->extra, node->extra_len);
+    if (node->flags & LVML_SNAPSHOT_FLAG_VALUE) {
+        snapshot_put_signed(w, node->value);
+        snapshot_put_signed(w, node->min);
+        snapshot_put_signed(w, node->max);
+    }
+    return ++w->nodes;
+}
+
+lvml_error_t lvml_snapshot_end(lvml_snapshot_writer_t* w, uint16_t screen_style) {
+    if (w->failed || screen_style > w->styles ||
+        !snapshot_reserve(w, (size_t)w->styles * SNAPSHOT_STYLE_MAX)) {
+        return LVML_ERROR_MEMORY;
+    }
+
+    uint32_t styles_offset = (uint32_t)w->len;
+    for (uint16_t i = 0; i < w->styles; i++) {
+        const lvml_snapshot_style_t* s = &w->style_table[i];
+        w->data[w->len++] = s->set;
+        if (s->set & SNAPSHOT_BG_COLOR) {
+            snapshot_put_color(w, s->bg_color);
+        }
+        if (s->set & SNAPSHOT_BG_OPA) {
+            w->data[w->len++] = s->bg_opa;
+        }
+        if (s->set & SNAPSHOT_BORDER_COLOR) {
+            snapshot_put_color(w, s->border_color);
+        }
+        if (s->set & SNAPSHOT_BORDER_WIDTH) {
+            snapshot_put_signed(w, s->border_width);
+        }
+        if (s->set & SNAPSHOT_BORDER_OPA) {
+            w->data[w->len++] = s->border_opa;
+        }
+        if (s->set & SNAPSHOT_TEXT_COLOR) {
+            snapshot_put_color(w, s->text_color);
+        }
+        if (s->set & SNAPSHOT_PAD_ALL) {
+            snapshot_put_signed(w, s->pad_all);
+        }
+        if (s->set & SNAPSHOT_RADIUS) {
+            snapshot_put_signed(w, s->radius);
+        }
+    }
+
+    uint8_t* h = w->data;
+    memcpy(h, LVML_SNAPSHOT_MAGIC, 4);
+    h[4] = LVML_SNAPSHOT_VERSION;
+    h[5] = 0;
+    h[6] = (uint8_t)w->width;
+    h[7] = (uint8_t)(w->width >> 8);
+    h[8] = (uint8_t)w->height;
+    h[9] = (uint8_t)(w->height >> 8);
+    h[10] = (uint8_t)w->nodes;
+    h[11] = (uint8_t)(w->nodes >> 8);
+    h[12] = (uint8_t)w->styles;
+    h[13] = (uint8_t)(w->styles >> 8);
+    h[14] = (uint8_t)screen_style;
+    h[15] = (uint8_t)(screen_style >> 8);
+    for (int i = 0; i < 4; i++) {
+        h[16 + i] = (uint8_t)(styles_offset >> (8 * i));
+    }
+    return LVML_OK;
+}
+
+void lvml_snapshot_free(lvml_snapshot_writer_t* w) {
+    lvml_mem_free_large(w->data);
+    w->data = NULL;
+    w->len = 0;
+    w->cap = 0;
+}
+
+lvml_error_t lvml_snapshot_open(lvml_snapshot_reader_t* r, const uint8_t* data, size_t len) {
+    if (r == NULL || data == NULL || len < LVML_SNAPSHOT_HEADER_SIZE ||
+        memcmp(data, LVML_SNAPSHOT_MAGIC, 4) != 0 || data[4] != LVML_SNAPSHOT_VERSION) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    memset(r, 0, sizeof(*r));
+    r->data = data;
+    r->len = len;
+    r->width = (uint16_t)(data[6] | data[7] << 8);
+    r->height = (uint16_t)(data[8] | data[9] << 8);
+    r->nodes = (uint16_t)(data[10] | data[11] << 8);
+    r->styles = (uint16_t)(data[12] | data[13] << 8);
+    r->screen_style = (uint16_t)(data[14] | data[15] << 8);
+    uint32_t styles_offset = (uint32_t)data[16] | (uint32_t)data[17] << 8 |
+                             (uint32_t)data[18] << 16 | (uint32_t)data[19] << 24;
+    if (r->styles > LVML_SNAPSHOT_STYLES_MAX || r->screen_style > r->styles ||
+        styles_offset < LVML_SNAPSHOT_HEADER_SIZE || styles_offset > len) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    // Styles are read up front so nodes can refer to them while being restored
+    r->pos = styles_offset;
+    for (uint16_t i = 0; i < r->styles; i++) {
+        if (!snapshot_get_style(r, &r->style_table[i])) {
+            return LVML_ERROR_INVALID_PARAM;
+        }
+    }
+    r->nodes_end = styles_offset;
+    r->pos = LVML_SNAPSHOT_HEADER_SIZE;
+    return LVML_OK;
+}
+
+bool lvml_snapshot_next(lvml_snapshot_reader_t* r, lvml_snapshot_node_t* node) {
+    if (r->error || r->node_index == r->nodes) {
+        return false;
+    }
+
+    // Nodes must not run into the style table
+    size_t len = r->len;
+    r->len = r->nodes_end;
+    memset(node, 0, sizeof(*node));
+    uint32_t parent, style;
+    bool ok = r->len - r->pos >= 2;
+    if (ok) {
+        node->type = r->data[r->pos++];
+        node->flags = r->data[r->pos++];
+        ok = snapshot_get_varint(r, &parent) &&
+             snapshot_get_signed(r, &node->x) && snapshot_get_signed(r, &node->y) &&
+             snapshot_get_signed(r, &node->width) && snapshot_get_signed(r, &node->height) &&
+             snapshot_get_varint(r, &style) &&
+             snapshot_get_string(r, &node->name, &node->name_len) &&
+             snapshot_get_string(r, &node->text, &node->text_len) &&
+             snapshot_get_string(r, &node->extra, &node->extra_len);
+    }
+    if (ok && (node->flags & LVML_SNAPSHOT_FLAG_VALUE)) {
+        ok = snapshot_get_signed(r, &node->value) && snapshot_get_signed(r, &node->min) &&
+             snapshot_get_signed(r, &node->max);
+    }
+    r->len = len;
+
+    // Parents come before their children
+    if (!ok || node->type >= LVML_SNAPSHOT_TYPE_COUNT || parent > r->node_index || style > r->styles) {
+        r->error = true;
+        return false;
+    }
+    node->parent = (uint16_t)parent;
+    node->style = (uint16_t)style;
+    r->node_index++;
+    return true;
+}
+
+const lvml_snapshot_style_t* lvml_snapshot_get_style(const lvml_snapshot_reader_t* r, uint16_t style) {
+    if (style == 0 || style > r->styles) {
+        return NULL;
+    }
+    return &r->style_table[style - 1];
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Make room for size more bytes; sets w->failed when out of memory
+ */
+static bool snapshot_reserve(lvml_snapshot_writer_t* w, size_t size) {
+    if (w->len + size <= w->cap) {
+        return true;
+    }
+    size_t cap = w->cap * 2;
+    while (cap < w->len + size) {
+        cap *= 2;
+    }
+    uint8_t* data = lvml_mem_realloc_large(w->data, cap);
+    if (data == NULL) {
+        w->failed = true;
+        return false;
+    }
+    w->data = data;
+    w->cap = cap;
+    return true;
+}
+
+static void snapshot_put_varint(lvml_snapshot_writer_t* w, uint32_t value) {
+    w->len += lvml_varint_put(w->data + w->len, value);
+}
+
+static void snapshot_put_signed(lvml_snapshot_writer_t* w, int32_t value) {
+    w->len += lvml_varint_put_signed(w->data + w->len, value);
+}
+
+static void snapshot_put_color(lvml_snapshot_writer_t* w, uint32_t color) {
+    w->data[w->len++] = (uint8_t)(color >> 16);
+    w->data[w->len++] = (uint8_t)(color >> 8);
+    w->data[w->len++] = (uint8_t)color;
+}
+
+static void snapshot_put_string(lvml_snapshot_writer_t* w, const char* str, size_t len) {
+    snapshot_put_varint(w, str != NULL ? (uint32_t)len : 0);
+    if (str != NULL && len > 0) {
+        memcpy(w->data + w->len, str, len);
+        w->len += len;
+    }
+}
+
+static bool snapshot_same_style(const lvml_snapshot_style_t* a, const lvml_snapshot_style_t* b) {
+    uint8_t set = a->set;
+    return set == b->set &&
+           (!(set & SNAPSHOT_BG_COLOR) || a->bg_color == b->bg_color) &&
+           (!(set & SNAPSHOT_BG_OPA) || a->bg_opa == b->bg_opa) &&
+           (!(set & SNAPSHOT_BORDER_COLOR) || a->border_color == b->border_color) &&
+           (!(set & SNAPSHOT_BORDER_WIDTH) || a->border_width == b->border_width) &&
+           (!(set & SNAPSHOT_BORDER_OPA) || a->border_opa == b->border_opa) &&
+           (!(set & SNAPSHOT_TEXT_COLOR) || a->text_color == b->text_color) &&
+           (!(set & SNAPSHOT_PAD_ALL) || a->pad_all == b->pad_all) &&
+           (!(set & SNAPSHOT_RADIUS) || a->radius == b->radius);
+}
+
+static bool snapshot_get_varint(lvml_snapshot_reader_t* r, uint32_t* value) {
+    return lvml_varint_get(r->data, r->len, &r->pos, value);
+}
+
+static bool snapshot_get_signed(lvml_snapshot_reader_t* r, int32_t* value) {
+    return lvml_varint_get_signed(r->data, r->len, &r->pos, value);
+}
+
+static bool snapshot_get_color(lvml_snapshot_reader_t* r, uint32_t* color) {
+    if (r->len - r->pos < 3) {
+        return false;
+    }
+    const uint8_t* p = r->data + r->pos;
+    *color = (uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2];
+    r->pos += 3;
+    return true;
+}
+
+static bool snapshot_get_string(lvml_snapshot_reader_t* r, const char** str, size_t* len) {
+    return lvml_varint_get_string(r->data, r->len, &r->pos, str, len);
+}
+
+static bool snapshot_get_style(lvml_snapshot_reader_t* r, lvml_snapshot_style_t* style) {
+    memset(style, 0, sizeof(*style));
+    if (r->pos >= r->len) {
+        return false;
+    }
+    uint8_t set = r->data[r->pos++];
+    style->set = set;
+    if ((set & SNAPSHOT_BG_COLOR) && !snapshot_get_color(r, &style->bg_color)) {
+        return false;
+    }
+    if (set & SNAPSHOT_BG_OPA) {
+        if (r->pos >= r->len) {
+            return false;
+        }
+        style->bg_opa = r->data[r->pos++];
+    }
+    if ((set & SNAPSHOT_BORDER_COLOR) && !snapshot_get_color(r, &style->border_color)) {
+        return false;
+    }
+    if ((set & SNAPSHOT_BORDER_WIDTH) && !snapshot_get_signed(r, &style->border_width)) {
+        return false;
+    }
+    if (set & SNAPSHOT_BORDER_OPA) {
+        if (r->pos >= r->len) {
+            return false;
+        }
+        style->border_opa = r->data[r->pos++];
+    }
+    if ((set & SNAPSHOT_TEXT_COLOR) && !snapshot_get_color(r, &style->text_color)) {
+        return false;
+    }
+    if ((set & SNAPSHOT_PAD_ALL) && !snapshot_get_signed(r, &style->pad_all)) {
+        return false;
+    }
+    if ((set & SNAPSHOT_RADIUS) && !snapshot_get_signed(r, &style->radius)) {
+        return false;
+    }
+    return true;
+}
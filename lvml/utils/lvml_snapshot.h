@@ -0,0 +1,232 @@
+/**
+ * @file lvml_snapshot.h
+ * @brief Compact snapshots of a widget tree for restoring the UI on wake
+ *
+ * A snapshot lists the objects on a screen in creation order (parents
+ * before children) with what is needed to recreate them without parsing
+ * XML or running scripts: widget type, geometry, state flags, text and
+ * value, object name and an index into a table of the style properties
+ * LVML sets (the same set as lvml_style). Identical styles are stored
+ * once. It has no LVGL or MicroPython dependency; the core fills and
+ * reads it (lvml_state).
+ *
+ * Layout (little-endian):
+ *   header   "LVSS", u8 version, u8 reserved, u16 width, u16 height,
+ *            u16 node count, u16 style count, u16 screen style,
+ *            u32 offset of the style table
+ *   nodes    u8 type, u8 flags, varint parent (0 = screen, n = node n - 1),
+ *            zigzag varint x and y (from the parent's content area),
+ *            zigzag varint width and height, varint style (0 = none,
+ *            n = style n - 1), name, text and extra as varint length and
+ *            bytes, and with LVML_SNAPSHOT_FLAG_VALUE zigzag varint value,
+ *            min and max
+ *   styles   u8 property mask (lvml_style_prop_t), then per set property:
+ *            colors as 3 bytes 0xRRGGBB, opacities as u8, others as
+ *            zigzag varint
+ */
+
+#ifndef LVML_SNAPSHOT_H
+#define LVML_SNAPSHOT_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_SNAPSHOT_MAGIC "LVSS"
+#define LVML_SNAPSHOT_VERSION 1
+#define LVML_SNAPSHOT_HEADER_SIZE 20
+#define LVML_SNAPSHOT_STYLES_MAX 64     // Further distinct styles are not stored
+#define LVML_SNAPSHOT_NODES_MAX 0xFFFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Widget types that can be restored
+ */
+typedef enum {
+    LVML_SNAPSHOT_OBJ = 0,
+    LVML_SNAPSHOT_BUTTON,
+    LVML_SNAPSHOT_LABEL,
+    LVML_SNAPSHOT_IMAGE,        // Text is the name of a registered image
+    LVML_SNAPSHOT_TEXTAREA,     // Extra is the placeholder
+    LVML_SNAPSHOT_SLIDER,
+    LVML_SNAPSHOT_BAR,
+    LVML_SNAPSHOT_ARC,
+    LVML_SNAPSHOT_SWITCH,
+    LVML_SNAPSHOT_CHECKBOX,
+    LVML_SNAPSHOT_DROPDOWN,     // Extra is the options, value the selected one
+    LVML_SNAPSHOT_TYPE_COUNT,
+} lvml_snapshot_type_t;
+
+/**
+ * Node flags
+ */
+typedef enum {
+    LVML_SNAPSHOT_FLAG_HIDDEN    = (1 << 0),
+    LVML_SNAPSHOT_FLAG_CHECKED   = (1 << 1),
+    LVML_SNAPSHOT_FLAG_DISABLED  = (1 << 2),
+    LVML_SNAPSHOT_FLAG_W_CONTENT = (1 << 3),    // Width is LV_SIZE_CONTENT
+    LVML_SNAPSHOT_FLAG_H_CONTENT = (1 << 4),    // Height is LV_SIZE_CONTENT
+    LVML_SNAPSHOT_FLAG_XML_ROOT  = (1 << 5),    // Root of the loaded XML UI
+    LVML_SNAPSHOT_FLAG_VALUE     = (1 << 6),    // value, min and max are stored
+} lvml_snapshot_flag_t;
+
+/**
+ * Style properties of a node (mirrors lvml_style_props_t)
+ */
+typedef struct {
+    uint8_t set;                // Bitmask of lvml_style_prop_t
+    uint32_t bg_color;          // 0xRRGGBB
+    uint32_t border_color;
+    uint32_t text_color;
+    int32_t border_width;
+    int32_t pad_all;
+    int32_t radius;
+    uint8_t bg_opa;
+    uint8_t border_opa;
+} lvml_snapshot_style_t;
+
+/**
+ * One object; strings are not NUL-terminated and, when read, point into
+ * the snapshot
+ */
+typedef struct {
+    uint8_t type;               // lvml_snapshot_type_t
+    uint8_t flags;              // Bitmask of lvml_snapshot_flag_t
+    uint16_t parent;            // 0 = screen, n = node n - 1
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+    uint16_t style;             // 0 = none, n = style n - 1
+    const char* name;
+    size_t name_len;
+    const char* text;
+    size_t text_len;
+    const char* extra;
+    size_t extra_len;
+    int32_t value;
+    int32_t min;
+    int32_t max;
+} lvml_snapshot_node_t;
+
+/**
+ * Snapshot being written; owns its buffer
+ */
+typedef struct {
+    uint8_t* data;              // From lvml_mem_alloc_large()
+    size_t len;
+    size_t cap;
+    uint16_t width;
+    uint16_t height;
+    uint16_t nodes;
+    uint16_t styles;
+    uint32_t styles_dropped;    // Nodes stored without their style (table full)
+    bool failed;                // Out of memory or too many nodes
+    lvml_snapshot_style_t style_table[LVML_SNAPSHOT_STYLES_MAX];
+} lvml_snapshot_writer_t;
+
+/**
+ * Snapshot being read; borrows the snapshot bytes
+ */
+typedef struct {
+    const uint8_t* data;
+    size_t len;
+    size_t pos;                 // Next node
+    size_t nodes_end;           // Start of the style table
+    uint16_t width;
+    uint16_t height;
+    uint16_t nodes;
+    uint16_t node_index;        // Nodes read so far
+    uint16_t screen_style;
+    uint16_t styles;
+    bool error;                 // Corrupt data was found
+    lvml_snapshot_style_t style_table[LVML_SNAPSHOT_STYLES_MAX];
+} lvml_snapshot_reader_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start a snapshot
+ * @param w writer state
+ * @param width display width
+ * @param height display height
+ * @return LVML_OK or LVML_ERROR_MEMORY
+ */
+lvml_error_t lvml_snapshot_begin(lvml_snapshot_writer_t* w, uint16_t width, uint16_t height);
+
+/**
+ * Add a style to the table, reusing an identical one
+ * @param w writer state
+ * @param style style properties; an empty set needs no entry
+ * @return style reference for a node (0 = none, also when the table is full)
+ */
+uint16_t lvml_snapshot_add_style(lvml_snapshot_writer_t* w, const lvml_snapshot_style_t* style);
+
+/**
+ * Append a node
+ * @param w writer state
+ * @param node node; its parent must already be added
+ * @return index of the node, to use as the parent of later nodes, or 0 on
+ *         failure (w->failed is set)
+ */
+uint16_t lvml_snapshot_add(lvml_snapshot_writer_t* w, const lvml_snapshot_node_t* node);
+
+/**
+ * Finish the snapshot: write the header and the style table
+ * @param w writer state; on success w->data and w->len hold the snapshot
+ * @param screen_style style reference of the screen itself
+ * @return LVML_OK, or LVML_ERROR_MEMORY if any step ran out of memory or
+ *         the tree was too large
+ */
+lvml_error_t lvml_snapshot_end(lvml_snapshot_writer_t* w, uint16_t screen_style);
+
+/**
+ * Free the writer's buffer
+ * @param w writer state
+ */
+void lvml_snapshot_free(lvml_snapshot_writer_t* w);
+
+/**
+ * Check a snapshot's header and read its style table
+ * @param r receives the opened snapshot
+ * @param data snapshot bytes, must stay valid while it is read
+ * @param len number of bytes
+ * @return LVML_OK, or LVML_ERROR_INVALID_PARAM if data isn't a snapshot
+ */
+lvml_error_t lvml_snapshot_open(lvml_snapshot_reader_t* r, const uint8_t* data, size_t len);
+
+/**
+ * Read the next node
+ * @param r opened snapshot
+ * @param node receives the node
+ * @return false after the last node or at corrupt data (r->error is set)
+ */
+bool lvml_snapshot_next(lvml_snapshot_reader_t* r, lvml_snapshot_node_t* node);
+
+/**
+ * Look up a style reference
+ * @param r opened snapshot
+ * @param style style reference from a node or r->screen_style
+ * @return style, or NULL for none
+ */
+const lvml_snapshot_style_t* lvml_snapshot_get_style(const lvml_snapshot_reader_t* r, uint16_t style);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_SNAPSHOT_H*/
@@ -0,0 +1,193 @@
+/**
+ * @file lvml_splash.c
+ * @brief Pre-converted splash images that stream straight to the panel
+ */
+
+#include "lvml_splash.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SPLASH_RUN_REPEAT 0x80
+#define SPLASH_RUN_COUNT 0x7F
+#define SPLASH_RUN_MIN 3            // Shorter repeats cost no less as literals
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void splash_put(lvml_splash_encoder_t* enc, uint8_t byte);
+static void splash_put_px(lvml_splash_encoder_t* enc, uint16_t px);
+static void splash_flush(lvml_splash_encoder_t* enc);
+static void splash_end_literal(lvml_splash_encoder_t* enc);
+static void splash_end_run(lvml_splash_encoder_t* enc);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_splash_open(lvml_splash_t* splash, const uint8_t* data, size_t len) {
+    if (splash == NULL || data == NULL || len < LVML_SPLASH_HEADER_SIZE ||
+        memcmp(data, LVML_SPLASH_MAGIC, 4) != 0 || data[4] != LVML_SPLASH_VERSION) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    memset(splash, 0, sizeof(*splash));
+    splash->data = data;
+    splash->len = len;
+    splash->pos = LVML_SPLASH_HEADER_SIZE;
+    splash->flags = data[5];
+    splash->width = (uint16_t)(data[6] | data[7] << 8);
+    splash->height = (uint16_t)(data[8] | data[9] << 8);
+    splash->left = (uint32_t)splash->width * splash->height;
+    if (!(splash->flags & LVML_SPLASH_FLAG_RLE) &&
+        len - LVML_SPLASH_HEADER_SIZE < (size_t)splash->left * 2) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+    return LVML_OK;
+}
+
+size_t lvml_splash_read(lvml_splash_t* splash, uint8_t* out, size_t pixels) {
+    if (pixels > splash->left) {
+        pixels = splash->left;
+    }
+
+    // Uncompressed: one copy
+    if (!(splash->flags & LVML_SPLASH_FLAG_RLE)) {
+        memcpy(out, splash->data + splash->pos, pixels * 2);
+        splash->pos += pixels * 2;
+        splash->left -= (uint32_t)pixels;
+        return pixels;
+    }
+
+    size_t done = 0;
+    while (done < pixels) {
+        if (splash->run == 0) {
+            if (splash->pos >= splash->len) {
+                break;
+            }
+            uint8_t c = splash->data[splash->pos++];
+            splash->run_repeat = (c & SPLASH_RUN_REPEAT) != 0;
+            splash->run = (uint8_t)((c & SPLASH_RUN_COUNT) + 1);
+            if (splash->run_repeat) {
+                if (splash->len - splash->pos < 2) {
+                    splash->run = 0;
+                    break;
+                }
+                splash->run_px[0] = splash->data[splash->pos];
+                splash->run_px[1] = splash->data[splash->pos + 1];
+                splash->pos += 2;
+            }
+        }
+
+        size_t n = splash->run < pixels - done ? splash->run : pixels - done;
+        uint8_t* dest = out + done * 2;
+        if (splash->run_repeat) {
+            for (size_t i = 0; i < n; i++) {
+                dest[2 * i] = splash->run_px[0];
+                dest[2 * i + 1] = splash->run_px[1];
+            }
+        } else {
+            if (splash->len - splash->pos < n * 2) {
+                break;
+            }
+            memcpy(dest, splash->data + splash->pos, n * 2);
+            splash->pos += n * 2;
+        }
+        splash->run -= (uint8_t)n;
+        done += n;
+    }
+    splash->left -= (uint32_t)done;
+    return done;
+}
+
+bool lvml_splash_begin(lvml_splash_encoder_t* enc, uint16_t width, uint16_t height,
+                       lvml_splash_write_cb_t write, void* user_data) {
+    memset(enc, 0, sizeof(lvml_splash_encoder_t));
+    enc->write = write;
+    enc->user_data = user_data;
+
+    const uint8_t header[LVML_SPLASH_HEADER_SIZE] = {
+        'L', 'V', 'S', 'P', LVML_SPLASH_VERSION, LVML_SPLASH_FLAG_RLE,
+        (uint8_t)width, (uint8_t)(width >> 8), (uint8_t)height, (uint8_t)(height >> 8), 0, 0,
+    };
+    for (size_t i = 0; i < sizeof(header); i++) {
+        splash_put(enc, header[i]);
+    }
+    return !enc->failed;
+}
+
+void lvml_splash_push_rgb565(lvml_splash_encoder_t* enc, const uint16_t* pixels, size_t count) {
+    for (size_t i = 0; i < count && !enc->failed; i++) {
+        if (enc->run > 0 && pixels[i] == enc->run_px && enc->run < LVML_SPLASH_RUN_MAX) {
+            enc->run++;
+            continue;
+        }
+        splash_end_run(enc);
+        enc->run_px = pixels[i];
+        enc->run = 1;
+    }
+}
+
+bool lvml_splash_end(lvml_splash_encoder_t* enc) {
+    splash_end_run(enc);
+    splash_end_literal(enc);
+    splash_flush(enc);
+    return !enc->failed;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void splash_put(lvml_splash_encoder_t* enc, uint8_t byte) {
+    enc->buf[enc->len++] = byte;
+    if (enc->len == sizeof(enc->buf)) {
+        splash_flush(enc);
+    }
+}
+
+static void splash_put_px(lvml_splash_encoder_t* enc, uint16_t px) {
+    splash_put(enc, (uint8_t)(px >> 8));
+    splash_put(enc, (uint8_t)px);
+}
+
+static void splash_flush(lvml_splash_encoder_t* enc) {
+    if (enc->len > 0 && !enc->failed) {
+        enc->failed = !enc->write(enc->buf, enc->len, enc->user_data);
+        enc->bytes += enc->len;
+    }
+    enc->len = 0;
+}
+
+static void splash_end_literal(lvml_splash_encoder_t* enc) {
+    if (enc->literal_len == 0) {
+        return;
+    }
+    splash_put(enc, (uint8_t)(enc->literal_len - 1));
+    for (uint32_t i = 0; i < enc->literal_len; i++) {
+        splash_put_px(enc, enc->literal[i]);
+    }
+    enc->literal_len = 0;
+}
+
+/**
+ * Write the pending run as a repeat, or add it to the literal if it is short
+ */
+static void splash_end_run(lvml_splash_encoder_t* enc) {
+    if (enc->run >= SPLASH_RUN_MIN) {
+        splash_end_literal(enc);
+        splash_put(enc, (uint8_t)(SPLASH_RUN_REPEAT | (enc->run - 1)));
+        splash_put_px(enc, enc->run_px);
+    } else {
+        for (uint32_t i = 0; i < enc->run; i++) {
+            enc->literal[enc->literal_len++] = enc->run_px;
+            if (enc->literal_len == LVML_SPLASH_RUN_MAX) {
+                splash_end_literal(enc);
+            }
+        }
+    }
+    enc->run = 0;
+}
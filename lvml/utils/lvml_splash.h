@@ -0,0 +1,140 @@
+/**
+ * @file lvml_splash.h
+ * @brief Pre-converted splash images that stream straight to the panel
+ *
+ * A splash is RGB565 in the panel's byte order (big-endian), optionally
+ * run-length encoded, so showing it needs no image decoder and no LVGL:
+ * pixels are expanded band by band into a DMA buffer and sent as they
+ * are. Splashes are made on the host with scripts/make_splash.py, or on
+ * the device from the screen (lvml_capture() with LVML_CAPTURE_SPLASH).
+ *
+ * Layout:
+ *   header   "LVSP", u8 version, u8 flags, u16 width, u16 height, u16 reserved
+ *            (little-endian)
+ *   pixels   raw: width * height big-endian RGB565 values
+ *            RLE: runs in row order, each a control byte c and then
+ *            c & 0x80 set:   one pixel repeated (c & 0x7F) + 1 times
+ *            c & 0x80 clear: c + 1 literal pixels
+ */
+
+#ifndef LVML_SPLASH_H
+#define LVML_SPLASH_H
+
+#include "utils/lvml_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_SPLASH_MAGIC "LVSP"
+#define LVML_SPLASH_VERSION 1
+#define LVML_SPLASH_HEADER_SIZE 12
+#define LVML_SPLASH_FLAG_RLE 0x01
+#define LVML_SPLASH_RUN_MAX 128
+#define LVML_SPLASH_BUF_SIZE 256    // Encoder output is written in chunks of this size
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Splash being read; borrows the splash bytes
+ */
+typedef struct {
+    const uint8_t* data;
+    size_t len;
+    size_t pos;
+    uint16_t width;
+    uint16_t height;
+    uint8_t flags;
+    uint32_t left;              // Pixels not yet read
+    uint8_t run;                // Pixels left in the current run
+    bool run_repeat;            // The current run repeats run_px
+    uint8_t run_px[2];
+} lvml_splash_t;
+
+/**
+ * Receives encoded output
+ * @return false to stop encoding
+ */
+typedef bool (*lvml_splash_write_cb_t)(const uint8_t* data, size_t len, void* user_data);
+
+/**
+ * RLE encoder state; runs are cut the same way as by make_splash.py
+ */
+typedef struct {
+    lvml_splash_write_cb_t write;
+    void* user_data;
+    uint16_t literal[LVML_SPLASH_RUN_MAX];  // Pending literal pixels
+    uint32_t literal_len;
+    uint16_t run_px;                        // Pixel of the pending run
+    uint32_t run;
+    uint8_t buf[LVML_SPLASH_BUF_SIZE];
+    size_t len;
+    size_t bytes;           // Total bytes written
+    bool failed;            // The write callback returned false
+} lvml_splash_encoder_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Check a splash's header
+ * @param splash receives the opened splash
+ * @param data splash bytes, must stay valid while it is read
+ * @param len number of bytes
+ * @return LVML_OK, or LVML_ERROR_INVALID_PARAM if data isn't a splash or
+ *         an uncompressed one is too short
+ */
+lvml_error_t lvml_splash_open(lvml_splash_t* splash, const uint8_t* data, size_t len);
+
+/**
+ * Expand the next pixels in row order
+ * @param splash opened splash
+ * @param out receives big-endian RGB565, 2 bytes per pixel
+ * @param pixels number of pixels wanted
+ * @return pixels written; fewer than wanted only at the end of the image or
+ *         at corrupt data
+ */
+size_t lvml_splash_read(lvml_splash_t* splash, uint8_t* out, size_t pixels);
+
+/**
+ * Start an RLE splash and write its header
+ * @param enc encoder state
+ * @param width image width
+ * @param height image height
+ * @param write output callback
+ * @param user_data user pointer for write
+ * @return false if the header couldn't be written
+ */
+bool lvml_splash_begin(lvml_splash_encoder_t* enc, uint16_t width, uint16_t height,
+                       lvml_splash_write_cb_t write, void* user_data);
+
+/**
+ * Encode pixels, continuing from the previous call
+ * @param enc encoder state
+ * @param pixels RGB565 pixels in native byte order
+ * @param count number of pixels
+ */
+void lvml_splash_push_rgb565(lvml_splash_encoder_t* enc, const uint16_t* pixels, size_t count);
+
+/**
+ * Finish the splash: write the pending runs
+ * @param enc encoder state
+ * @return false if any write failed
+ */
+bool lvml_splash_end(lvml_splash_encoder_t* enc);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_SPLASH_H*/
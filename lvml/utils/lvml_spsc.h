@@ -0,0 +1,93 @@
+/**
+ * @file lvml_spsc.h
+ * @brief Lock-free single-producer single-consumer ring indexes
+ *
+ * Only the indexes live here; the caller owns the element array, whose
+ * size must be a power of two. The producer only writes head and the
+ * consumer only writes tail, so one task can fill the ring while another
+ * drains it without a lock.
+ */
+
+#ifndef LVML_SPSC_H
+#define LVML_SPSC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t head;          // Next slot to fill, written by the producer
+    uint32_t tail;          // Next slot to drain, written by the consumer
+} lvml_spsc_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Empty the ring; only while neither side is using it
+ */
+static inline void lvml_spsc_reset(lvml_spsc_t* q) {
+    q->head = 0;
+    q->tail = 0;
+}
+
+/**
+ * Producer: slot to fill next
+ * @param size number of elements, a power of two
+ * @return slot index, or -1 if the ring is full
+ */
+static inline int32_t lvml_spsc_reserve(lvml_spsc_t* q, uint32_t size) {
+    uint32_t tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+    if (q->head - tail >= size) {
+        return -1;
+    }
+    return (int32_t)(q->head & (size - 1));
+}
+
+/**
+ * Producer: hand the reserved slot to the consumer
+ */
+static inline void lvml_spsc_publish(lvml_spsc_t* q) {
+    __atomic_store_n(&q->head, q->head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Consumer: slot to read next
+ * @param size number of elements, a power of two
+ * @return slot index, or -1 if the ring is empty
+ */
+static inline int32_t lvml_spsc_peek(lvml_spsc_t* q, uint32_t size) {
+    uint32_t head = __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+    if (head == q->tail) {
+        return -1;
+    }
+    return (int32_t)(q->tail & (size - 1));
+}
+
+/**
+ * Consumer: give the slot read with lvml_spsc_peek() back to the producer
+ */
+static inline void lvml_spsc_release(lvml_spsc_t* q) {
+    __atomic_store_n(&q->tail, q->tail + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Number of filled slots, as seen by either side
+ */
+static inline uint32_t lvml_spsc_count(lvml_spsc_t* q) {
+    return __atomic_load_n(&q->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+}
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_SPSC_H*/
@@ -0,0 +1,39 @@
+/**
+ * @file lvml_time.h
+ * @brief Monotonic microsecond clock for LVML measurements
+ */
+
+#ifndef LVML_TIME_H
+#define LVML_TIME_H
+
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#else
+#include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Microseconds since boot (ESP32) or since an arbitrary point (host)
+ * @return monotonic time in microseconds
+ */
+static inline int64_t lvml_time_us(void) {
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_TIME_H*/
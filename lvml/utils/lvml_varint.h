@@ -0,0 +1,168 @@
+/**
+ * @file lvml_varint.h
+ * @brief Bounded LEB128 varints shared by the binary formats of LVML
+ *
+ * Unsigned values are LEB128, 7 bits per byte with the high bit set on all
+ * but the last, at most LVML_VARINT_MAX bytes for 32 bits. Signed values are
+ * zigzag encoded first, so small negative numbers stay short. Strings are a
+ * varint length followed by the bytes. Used by snapshots (lvml_snapshot.h),
+ * input recordings (lvml_record.h), pushed patches (lvml_patch.h) and the
+ * push and mirror protocols.
+ */
+
+#ifndef LVML_VARINT_H
+#define LVML_VARINT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LVML_VARINT_MAX 5           // Bytes of the longest 32-bit varint
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Decoder for varints that arrive one byte at a time, e.g. from a socket;
+ * zero it before the first byte
+ */
+typedef struct {
+    uint32_t value;
+    uint8_t shift;
+} lvml_varint_decoder_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Zigzag encode a signed value: 0, -1, 1, -2... become 0, 1, 2, 3...
+ */
+static inline uint32_t lvml_varint_zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+/**
+ * Undo lvml_varint_zigzag()
+ */
+static inline int32_t lvml_varint_unzigzag(uint32_t raw) {
+    return (int32_t)(raw >> 1) ^ -(int32_t)(raw & 1);
+}
+
+/**
+ * Encode an unsigned value
+ * @param out room for LVML_VARINT_MAX bytes
+ * @param value value
+ * @return number of bytes written
+ */
+static inline size_t lvml_varint_put(uint8_t* out, uint32_t value) {
+    size_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+/**
+ * Encode a signed value (zigzag)
+ * @param out room for LVML_VARINT_MAX bytes
+ * @param value value
+ * @return number of bytes written
+ */
+static inline size_t lvml_varint_put_signed(uint8_t* out, int32_t value) {
+    return lvml_varint_put(out, lvml_varint_zigzag(value));
+}
+
+/**
+ * Feed the next byte of a varint to a decoder. Longer encodings and a fifth
+ * byte with bits beyond 32 are errors rather than silently truncated.
+ * @param d decoder; d->value holds the value once complete
+ * @param b next byte
+ * @return 1 when the varint is complete, 0 if more bytes follow, -1 if it
+ *         doesn't fit 32 bits
+ */
+static inline int lvml_varint_feed(lvml_varint_decoder_t* d, uint8_t b) {
+    if (d->shift == 7 * (LVML_VARINT_MAX - 1) && b > 0x0F) {
+        return -1;
+    }
+    d->value |= (uint32_t)(b & 0x7F) << d->shift;
+    if ((b & 0x80) == 0) {
+        return 1;
+    }
+    d->shift += 7;
+    return 0;
+}
+
+/**
+ * Decode an unsigned value from a buffer
+ * @param data buffer
+ * @param len buffer size
+ * @param pos read position, advanced past the varint
+ * @param value receives the value
+ * @return false if the buffer ends first or the value doesn't fit 32 bits
+ */
+static inline bool lvml_varint_get(const uint8_t* data, size_t len, size_t* pos, uint32_t* value) {
+    lvml_varint_decoder_t d = { 0 };
+    while (*pos < len) {
+        int res = lvml_varint_feed(&d, data[(*pos)++]);
+        if (res < 0) {
+            return false;
+        }
+        if (res > 0) {
+            *value = d.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Decode a signed (zigzag) value from a buffer
+ * @return false if the buffer ends first or the value doesn't fit 32 bits
+ */
+static inline bool lvml_varint_get_signed(const uint8_t* data, size_t len, size_t* pos, int32_t* value) {
+    uint32_t raw;
+    if (!lvml_varint_get(data, len, pos, &raw)) {
+        return false;
+    }
+    *value = lvml_varint_unzigzag(raw);
+    return true;
+}
+
+/**
+ * Decode a varint length and that many bytes from a buffer
+ * @param data buffer
+ * @param len buffer size
+ * @param pos read position, advanced past the string
+ * @param str receives a pointer into data, NULL for an empty string
+ * @param str_len receives the length
+ * @return false if the buffer ends first
+ */
+static inline bool lvml_varint_get_string(const uint8_t* data, size_t len, size_t* pos,
+                                          const char** str, size_t* str_len) {
+    uint32_t n;
+    if (!lvml_varint_get(data, len, pos, &n) || len - *pos < n) {
+        return false;
+    }
+    *str = n > 0 ? (const char*)data + *pos : NULL;
+    *str_len = n;
+    *pos += n;
+    return true;
+}
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_VARINT_H*/
@@ -0,0 +1,257 @@
+/**
+ * @file lvml_xml_profile.c
+ * @brief Per-element build time and memory profiling for XML loads
+ */
+
+#include "lvml_xml_profile.h"
+#include "utils/lvml_time.h"
+#include "lvgl/src/others/xml/lv_xml_widget.h"
+#include "lvgl/src/others/xml/lv_xml_parser.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define PROF_INITIAL_CAP 32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_widget_processor_t* processor;
+    lv_xml_widget_create_cb_t create_cb;
+    lv_xml_widget_apply_cb_t apply_cb;
+} prof_slot_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void* prof_create(uint32_t slot, lv_xml_parser_state_t* state, const char** attrs);
+static void prof_apply(uint32_t slot, lv_xml_parser_state_t* state, const char** attrs);
+static bool prof_is_descendant(const lv_obj_t* obj, const lv_obj_t* ancestor);
+static uint16_t prof_depth(const lv_obj_t* obj, const lv_obj_t* root);
+static uint32_t prof_count_objs(const lv_obj_t* obj);
+
+/**
+ * The widget processor callbacks carry no user data, so each wrapped
+ * processor gets its own pair of trampolines that know their slot.
+ */
+#define PROF_TRAMPOLINES(n) \
+    static void* prof_create_##n(lv_xml_parser_state_t* state, const char** attrs) { return prof_create(n, state, attrs); } \
+    static void prof_apply_##n(lv_xml_parser_state_t* state, const char** attrs) { prof_apply(n, state, attrs); }
+
+PROF_TRAMPOLINES(0)  PROF_TRAMPOLINES(1)  PROF_TRAMPOLINES(2)  PROF_TRAMPOLINES(3)
+PROF_TRAMPOLINES(4)  PROF_TRAMPOLINES(5)  PROF_TRAMPOLINES(6)  PROF_TRAMPOLINES(7)
+PROF_TRAMPOLINES(8)  PROF_TRAMPOLINES(9)  PROF_TRAMPOLINES(10) PROF_TRAMPOLINES(11)
+PROF_TRAMPOLINES(12) PROF_TRAMPOLINES(13) PROF_TRAMPOLINES(14) PROF_TRAMPOLINES(15)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+// Widgets whose processors are wrapped while profiling
+static const char* const prof_tags[] = {
+    "lv_obj", "lv_label", "lv_button", "lv_textarea",
+    "lv_dropdown", "lv_image", "lv_slider", "lv_checkbox",
+    "lv_arc", "lv_bar", "lv_switch", "lv_roller",
+    "lv_table", "lv_chart", "lv_tabview", "lv_scale",
+};
+
+static const lv_xml_widget_create_cb_t prof_create_cbs[] = {
+    prof_create_0,  prof_create_1,  prof_create_2,  prof_create_3,
+    prof_create_4,  prof_create_5,  prof_create_6,  prof_create_7,
+    prof_create_8,  prof_create_9,  prof_create_10, prof_create_11,
+    prof_create_12, prof_create_13, prof_create_14, prof_create_15,
+};
+
+static const lv_xml_widget_apply_cb_t prof_apply_cbs[] = {
+    prof_apply_0,  prof_apply_1,  prof_apply_2,  prof_apply_3,
+    prof_apply_4,  prof_apply_5,  prof_apply_6,  prof_apply_7,
+    prof_apply_8,  prof_apply_9,  prof_apply_10, prof_apply_11,
+    prof_apply_12, prof_apply_13, prof_apply_14, prof_apply_15,
+};
+
+#define PROF_SLOT_CNT (sizeof(prof_tags) / sizeof(prof_tags[0]))
+
+static prof_slot_t prof_slots[PROF_SLOT_CNT];
+static lvml_xml_profile_t* prof_active = NULL;
+
+// Element currently between its create and apply step
+static int64_t prof_elem_start_us;
+static int64_t prof_elem_time_us;
+static int32_t prof_elem_start_mem;
+static lv_obj_t* prof_elem_item = NULL;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lvml_error_t lvml_xml_profile_begin(lvml_xml_profile_t* profile) {
+    if (profile == NULL || prof_active != NULL) {
+        return LVML_ERROR_INVALID_PARAM;
+    }
+
+    memset(profile, 0, sizeof(lvml_xml_profile_t));
+    profile->elems = (lvml_xml_profile_elem_t*)lv_malloc(PROF_INITIAL_CAP * sizeof(lvml_xml_profile_elem_t));
+    if (profile->elems == NULL) {
+        return LVML_ERROR_MEMORY;
+    }
+    profile->elem_cap = PROF_INITIAL_CAP;
+
+    for (uint32_t i = 0; i < PROF_SLOT_CNT; i++) {
+        lv_widget_processor_t* p = lv_xml_widget_get_processor(prof_tags[i]);
+        prof_slots[i].processor = p;
+        if (p == NULL) {
+            continue;
+        }
+        prof_slots[i].create_cb = p->create_cb;
+        prof_slots[i].apply_cb = p->apply_cb;
+        p->create_cb = prof_create_cbs[i];
+        p->apply_cb = prof_apply_cbs[i];
+    }
+
+    prof_active = profile;
+    prof_elem_item = NULL;
+
+    return LVML_OK;
+}
+
+void lvml_xml_profile_end(lvml_xml_profile_t* profile, lv_obj_t* root) {
+    if (profile == NULL || profile != prof_active) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < PROF_SLOT_CNT; i++) {
+        lv_widget_processor_t* p = prof_slots[i].processor;
+        if (p != NULL) {
+            p->create_cb = prof_slots[i].create_cb;
+            p->apply_cb = prof_slots[i].apply_cb;
+            prof_slots[i].processor = NULL;
+        }
+    }
+    prof_active = NULL;
+
+    if (root == NULL) {
+        return;
+    }
+
+    profile->objects = prof_count_objs(root);
+
+    // Elements were recorded in creation order, which is document pre-order,
+    // so each subtree is the run of following elements below it.
+    for (uint32_t i = 0; i < profile->elem_cnt; i++) {
+        lvml_xml_profile_elem_t* e = &profile->elems[i];
+        e->depth = prof_depth(e->obj, root);
+        e->subtree_us = e->self_us;
+        e->subtree_bytes = e->self_bytes;
+        e->subtree_objs = prof_count_objs(e->obj);
+        for (uint32_t j = i + 1; j < profile->elem_cnt; j++) {
+            if (!prof_is_descendant(profile->elems[j].obj, e->obj)) {
+                break;
+            }
+            e->subtree_us += profile->elems[j].self_us;
+            e->subtree_bytes += profile->elems[j].self_bytes;
+        }
+    }
+}
+
+void lvml_xml_profile_free(lvml_xml_profile_t* profile) {
+    if (profile == NULL) {
+        return;
+    }
+    if (profile->elems != NULL) {
+        lv_free(profile->elems);
+    }
+    profile->elems = NULL;
+    profile->elem_cnt = 0;
+    profile->elem_cap = 0;
+}
+
+int32_t lvml_xml_profile_mem_used(void) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (int32_t)(mon.total_size - mon.free_size);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void* prof_create(uint32_t slot, lv_xml_parser_state_t* state, const char** attrs) {
+    // Memory is sampled outside the timed region; lv_mem_monitor walks the heap
+    prof_elem_start_mem = lvml_xml_profile_mem_used();
+    prof_elem_start_us = lvml_time_us();
+    void* item = prof_slots[slot].create_cb(state, attrs);
+    prof_elem_time_us = lvml_time_us() - prof_elem_start_us;
+    prof_elem_item = (lv_obj_t*)item;
+    return item;
+}
+
+static void prof_apply(uint32_t slot, lv_xml_parser_state_t* state, const char** attrs) {
+    int64_t start_us = lvml_time_us();
+    prof_slots[slot].apply_cb(state, attrs);
+    int64_t apply_us = lvml_time_us() - start_us;
+
+    lvml_xml_profile_t* profile = prof_active;
+    if (profile == NULL) {
+        return;
+    }
+
+    // A component root is applied a second time with the instance's
+    // attributes; account that to the element created earlier
+    if (prof_elem_item == NULL) {
+        if (profile->elem_cnt > 0) {
+            profile->elems[profile->elem_cnt - 1].self_us += (uint32_t)apply_us;
+        }
+        return;
+    }
+
+    lv_obj_t* obj = prof_elem_item;
+    prof_elem_item = NULL;
+
+    if (profile->elem_cnt == profile->elem_cap) {
+        uint32_t new_cap = profile->elem_cap * 2;
+        lvml_xml_profile_elem_t* grown = (lvml_xml_profile_elem_t*)lv_realloc(profile->elems, new_cap * sizeof(lvml_xml_profile_elem_t));
+        if (grown == NULL) {
+            return;
+        }
+        profile->elems = grown;
+        profile->elem_cap = new_cap;
+    }
+
+    lvml_xml_profile_elem_t* e = &profile->elems[profile->elem_cnt++];
+    memset(e, 0, sizeof(lvml_xml_profile_elem_t));
+    e->tag = prof_tags[slot];
+    e->obj = obj;
+    e->self_us = (uint32_t)(prof_elem_time_us + apply_us);
+    e->self_bytes = lvml_xml_profile_mem_used() - prof_elem_start_mem;
+}
+
+static bool prof_is_descendant(const lv_obj_t* obj, const lv_obj_t* ancestor) {
+    for (const lv_obj_t* p = lv_obj_get_parent(obj); p != NULL; p = lv_obj_get_parent(p)) {
+        if (p == ancestor) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint16_t prof_depth(const lv_obj_t* obj, const lv_obj_t* root) {
+    uint16_t depth = 0;
+    for (const lv_obj_t* p = obj; p != NULL && p != root; p = lv_obj_get_parent(p)) {
+        depth++;
+    }
+    return depth;
+}
+
+static uint32_t prof_count_objs(const lv_obj_t* obj) {
+    uint32_t count = 1;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) {
+        count += prof_count_objs(lv_obj_get_child(obj, i));
+    }
+    return count;
+}
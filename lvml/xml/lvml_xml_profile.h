@@ -0,0 +1,89 @@
+/**
+ * @file lvml_xml_profile.h
+ * @brief Per-element build time and memory profiling for XML loads
+ *
+ * While a profile is active, the LVGL XML widget processors of the common
+ * widgets are wrapped so every element's create + apply step is timed and
+ * its LVGL heap usage is measured with lv_mem_monitor(). Subtree totals are
+ * derived from the object tree once loading has finished.
+ */
+
+#ifndef LVML_XML_PROFILE_H
+#define LVML_XML_PROFILE_H
+
+#include "lvgl/lvgl.h"
+#include "utils/lvml_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * One instantiated XML element
+ */
+typedef struct {
+    const char* tag;              // Element name (static string owned by LVGL)
+    lv_obj_t* obj;                // Created object
+    uint16_t depth;               // Depth below the loaded root (root = 0)
+    uint32_t self_us;             // create + apply time of this element
+    int32_t self_bytes;           // LVGL heap delta of this element
+    uint32_t subtree_us;          // self_us of this element and all descendants
+    int32_t subtree_bytes;        // self_bytes of this element and all descendants
+    uint32_t subtree_objs;        // LVGL objects in the subtree (including internal ones)
+} lvml_xml_profile_elem_t;
+
+/**
+ * Result of a profiled XML load
+ */
+typedef struct {
+    uint32_t bind_us;             // Subject binding pre-scan
+    uint32_t parse_us;            // Component registration (parse, consts, styles)
+    int32_t parse_bytes;          // LVGL heap used by the registration
+    bool parse_cached;            // Registration skipped, XML unchanged since last load
+    uint32_t create_us;           // Instantiation of the whole tree
+    int32_t create_bytes;         // LVGL heap used by the instantiation
+    uint32_t objects;             // LVGL objects created
+    lvml_xml_profile_elem_t* elems; // Elements in document (pre-)order
+    uint32_t elem_cnt;
+    uint32_t elem_cap;
+} lvml_xml_profile_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start collecting per-element data (wraps the XML widget processors)
+ * @param profile profile to fill, zeroed by this call
+ * @return LVML_OK on success, error code on failure
+ */
+lvml_error_t lvml_xml_profile_begin(lvml_xml_profile_t* profile);
+
+/**
+ * Stop collecting, restore the widget processors and compute subtree totals
+ * @param profile active profile
+ * @param root root object of the loaded tree (may be NULL on failure)
+ */
+void lvml_xml_profile_end(lvml_xml_profile_t* profile, lv_obj_t* root);
+
+/**
+ * Release memory held by a profile
+ * @param profile profile to free
+ */
+void lvml_xml_profile_free(lvml_xml_profile_t* profile);
+
+/**
+ * Bytes currently used in the LVGL heap
+ * @return used bytes
+ */
+int32_t lvml_xml_profile_mem_used(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_XML_PROFILE_H*/
@@ -0,0 +1,138 @@
+/**
+ * @file lvml_xml_scan.c
+ * @brief Lightweight attribute scanner for LVML XML documents
+ */
+
+#include "lvml_xml_scan.h"
+#include <string.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool is_space(char c);
+static bool is_name_char(char c);
+static const char* skip_past(const char* p, const char* end_marker);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lvml_xml_scan_attrs(const char* xml, lvml_xml_attr_cb_t cb, void* user_data) {
+    if (xml == NULL || cb == NULL) {
+        return;
+    }
+
+    const char* p = xml;
+    while ((p = strchr(p, '<')) != NULL) {
+        p++;
+
+        // Skip comments, declarations, processing instructions and end tags
+        if (strncmp(p, "!--", 3) == 0) {
+            p = skip_past(p + 3, "-->");
+            continue;
+        }
+        if (*p == '!' || *p == '?' || *p == '/') {
+            p = skip_past(p, ">");
+            continue;
+        }
+
+        lvml_xml_str_t tag = { p, 0 };
+        while (is_name_char(*p)) {
+            p++;
+        }
+        tag.len = p - tag.ptr;
+        if (tag.len == 0) {
+            continue;
+        }
+
+        // Attributes until '>' or '/>'
+        while (*p != '\0' && *p != '>') {
+            while (is_space(*p)) {
+                p++;
+            }
+            if (*p == '/' || *p == '>' || *p == '\0') {
+                if (*p == '/') p++;
+                continue;
+            }
+
+            lvml_xml_str_t name = { p, 0 };
+            while (is_name_char(*p)) {
+                p++;
+            }
+            name.len = p - name.ptr;
+            if (name.len == 0) {
+                // Malformed input, resynchronise on the next character
+                p++;
+                continue;
+            }
+
+            while (is_space(*p)) {
+                p++;
+            }
+            if (*p != '=') {
+                continue;
+            }
+            p++;
+            while (is_space(*p)) {
+                p++;
+            }
+
+            char quote = *p;
+            if (quote != '"' && quote != '\'') {
+                continue;
+            }
+            p++;
+            lvml_xml_str_t value = { p, 0 };
+            while (*p != '\0' && *p != quote) {
+                p++;
+            }
+            value.len = p - value.ptr;
+            if (*p == quote) {
+                p++;
+            }
+
+            if (!cb(tag, name, value, user_data)) {
+                return;
+            }
+        }
+    }
+}
+
+bool lvml_xml_str_eq(lvml_xml_str_t s, const char* cstr) {
+    size_t len = strlen(cstr);
+    return s.len == len && memcmp(s.ptr, cstr, len) == 0;
+}
+
+bool lvml_xml_str_starts_with(lvml_xml_str_t s, const char* prefix) {
+    size_t len = strlen(prefix);
+    return s.len >= len && memcmp(s.ptr, prefix, len) == 0;
+}
+
+bool lvml_xml_str_copy(lvml_xml_str_t s, char* buf, size_t buf_size) {
+    if (buf_size == 0) {
+        return false;
+    }
+    size_t len = s.len < buf_size - 1 ? s.len : buf_size - 1;
+    memcpy(buf, s.ptr, len);
+    buf[len] = '\0';
+    return len == s.len;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool is_name_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == '-' || c == ':' || c == '.';
+}
+
+static const char* skip_past(const char* p, const char* end_marker) {
+    const char* end = strstr(p, end_marker);
+    return end != NULL ? end + strlen(end_marker) : p + strlen(p);
+}
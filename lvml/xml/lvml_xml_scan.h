@@ -0,0 +1,85 @@
+/**
+ * @file lvml_xml_scan.h
+ * @brief Lightweight attribute scanner for LVML XML documents
+ *
+ * LVGL's XML loader consumes whole documents. LVML sometimes needs to look
+ * at a document before handing it over (subject bindings, referenced
+ * scripts, links). This scanner walks start tags and reports each attribute
+ * without building a tree or allocating memory.
+ */
+
+#ifndef LVML_XML_SCAN_H
+#define LVML_XML_SCAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Borrowed slice of the scanned document (not NUL-terminated)
+ */
+typedef struct {
+    const char* ptr;
+    size_t len;
+} lvml_xml_str_t;
+
+/**
+ * Attribute callback
+ * @param tag element name
+ * @param name attribute name
+ * @param value attribute value without quotes (entities are not decoded)
+ * @param user_data user pointer passed to lvml_xml_scan_attrs()
+ * @return true to continue scanning, false to stop
+ */
+typedef bool (*lvml_xml_attr_cb_t)(lvml_xml_str_t tag, lvml_xml_str_t name, lvml_xml_str_t value, void* user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Report every attribute of every start tag in document order.
+ * Comments, processing instructions, declarations and end tags are skipped.
+ * @param xml NUL-terminated XML text
+ * @param cb attribute callback
+ * @param user_data user pointer forwarded to the callback
+ */
+void lvml_xml_scan_attrs(const char* xml, lvml_xml_attr_cb_t cb, void* user_data);
+
+/**
+ * Compare a slice with a NUL-terminated string
+ * @param s slice
+ * @param cstr string to compare with
+ * @return true if equal
+ */
+bool lvml_xml_str_eq(lvml_xml_str_t s, const char* cstr);
+
+/**
+ * Check whether a slice starts with a NUL-terminated prefix
+ * @param s slice
+ * @param prefix prefix to look for
+ * @return true if s starts with prefix
+ */
+bool lvml_xml_str_starts_with(lvml_xml_str_t s, const char* prefix);
+
+/**
+ * Copy a slice into a NUL-terminated buffer, truncating if needed
+ * @param s slice
+ * @param buf output buffer
+ * @param buf_size size of the output buffer
+ * @return false if the slice did not fit
+ */
+bool lvml_xml_str_copy(lvml_xml_str_t s, char* buf, size_t buf_size);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LVML_XML_SCAN_H*/
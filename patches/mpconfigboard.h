@@ -15,3 +15,6 @@
 
 #define MICROPY_HW_I2C0_SCL                 (9)
 #define MICROPY_HW_I2C0_SDA                 (8)
+
+// Let LVML write compiled <micropython> scripts to its VFS bytecode cache
+#define MICROPY_PERSISTENT_CODE_SAVE        (1)
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+# make_splash.py - Convert a PNG into an LVML splash for lvml.splash()
+#
+# The splash is RGB565 in the panel's byte order, run-length encoded unless
+# that doesn't make it smaller, so the device streams it to the display
+# without decoding a PNG. Transparent pixels are blended onto --background.
+# The format is described in lvml/utils/lvml_splash.h. Only the standard
+# library is needed (8-bit RGB/RGBA/gray, non-interlaced PNGs). Usage:
+#   python3 scripts/make_splash.py image.png -o splash.lvsp
+#   python3 scripts/make_splash.py image.png --py boot/splash_lvml.py   # frozen into flash
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b"LVSP"                  # LVML_SPLASH_MAGIC
+VERSION = 1                      # LVML_SPLASH_VERSION
+FLAG_RLE = 0x01                  # LVML_SPLASH_FLAG_RLE
+MAX_RUN = 128
+
+CHANNELS = {0: 1, 2: 3, 4: 2, 6: 4}     # PNG color type -> samples per pixel
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s is not a PNG" % path)
+    pos = 8
+    idat = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    if depth != 8 or color not in CHANNELS or interlace:
+        raise ValueError("only 8-bit, non-interlaced RGB, RGBA or gray PNGs are supported")
+
+    bpp = CHANNELS[color]
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+    return width, height, color, rows
+
+
+def to_rgb565(width, color, rows, background):
+    bpp = CHANNELS[color]
+    bg = ((background >> 16) & 0xFF, (background >> 8) & 0xFF, background & 0xFF)
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            s = line[x * bpp:(x + 1) * bpp]
+            if color in (0, 4):
+                rgb, alpha = (s[0], s[0], s[0]), (s[1] if color == 4 else 255)
+            else:
+                rgb, alpha = (s[0], s[1], s[2]), (s[3] if color == 6 else 255)
+            r, g, b = ((v * alpha + k * (255 - alpha)) // 255 for v, k in zip(rgb, bg))
+            pixels.append((r >> 3) << 11 | (g >> 2) << 5 | (b >> 3))
+    return pixels
+
+
+def rle(pixels):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(struct.pack(">H", p))
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_RUN and pixels[i + run] == pixels[i]:
+            run += 1
+        # Two equal pixels cost the same either way; keep them in the literal
+        if run >= 3:
+            flush()
+            out.append(0x80 | (run - 1))
+            out += struct.pack(">H", pixels[i])
+        else:
+            literal.extend(pixels[i:i + run])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def make_splash(path, background=0x000000, compress=True):
+    width, height, color, rows = read_png(path)
+    pixels = to_rgb565(width, color, rows, background)
+    raw = b"".join(struct.pack(">H", p) for p in pixels)
+    body, flags = raw, 0
+    if compress:
+        packed = rle(pixels)
+        if len(packed) < len(raw):
+            body, flags = packed, FLAG_RLE
+    header = MAGIC + struct.pack("<BBHHH", VERSION, flags, width, height, 0)
+    return header + body, width, height, len(raw)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a PNG into an LVML splash")
+    parser.add_argument("png")
+    parser.add_argument("-o", "--output", help="splash file")
+    parser.add_argument("--py", help="Python module with SPLASH_DATA, for freezing into flash")
+    parser.add_argument("--background", default="000000", help="RGB hex color behind transparent pixels")
+    parser.add_argument("--raw", action="store_true", help="don't run-length encode")
+    args = parser.parse_args()
+    if not args.output and not args.py:
+        parser.error("give -o and/or --py")
+
+    splash, width, height, raw_size = make_splash(args.png, int(args.background, 16), not args.raw)
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(splash)
+    if args.py:
+        with open(args.py, "w") as f:
+            f.write("# %s - %s as an LVML splash, for lvml.splash()\n" % (os.path.basename(args.py),
+                                                                         os.path.basename(args.png)))
+            f.write("# Auto-generated by scripts/make_splash.py\n\n")
+            f.write("WIDTH = %d\nHEIGHT = %d\n\n" % (width, height))
+            f.write("SPLASH_DATA = %r\n" % splash)
+    print("%s: %dx%d, %d bytes (%d raw)" % (args.png, width, height, len(splash), raw_size + 12))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+# pack_bundle.py - Pack a screen and the files it references into an LVML bundle
+#
+# The first entry is the screen XML. Every src="..." it references (scripts,
+# images, other XML) is looked up next to the XML and in the --assets
+# directories and stored under the name used in the reference, so
+# lvml.load_bundle() resolves references with a plain name lookup. The
+# format is described in lvml/utils/lvml_bundle.h. Usage:
+#   python3 scripts/pack_bundle.py screen.xml -o screen.lvmb [--assets dir]... [extra files]...
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+MAGIC = b"LVMB"                  # LVML_BUNDLE_MAGIC
+VERSION = 1                      # LVML_BUNDLE_VERSION
+FLAG_ZLIB = 0x01                 # LVML_BUNDLE_FLAG_ZLIB
+WINDOW_BITS = 12                 # 4KB inflate window on the device
+NAME_MAX = 255
+
+FNV_INIT = 0x811C9DC5
+FNV_PRIME = 0x01000193
+
+SRC_ATTR = re.compile(rb'\bsrc\s*=\s*"([^"]*)"')
+
+
+def fnv1a(data, h=FNV_INIT):
+    for b in data:
+        h ^= b
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def compress(data):
+    c = zlib.compressobj(9, zlib.DEFLATED, WINDOW_BITS)
+    return c.compress(data) + c.flush()
+
+
+def find_file(ref, search_dirs):
+    for d in search_dirs:
+        path = os.path.join(d, ref.lstrip("/"))
+        if os.path.isfile(path):
+            return path
+    return None
+
+
+def collect(main_xml, assets, extra):
+    """Return [(name, path)] starting with the main XML"""
+    search_dirs = [os.path.dirname(os.path.abspath(main_xml))] + assets
+    entries = [(os.path.basename(main_xml), main_xml)]
+    seen = {entries[0][0]}
+
+    i = 0
+    while i < len(entries):
+        name, path = entries[i]
+        i += 1
+        if not name.endswith(".xml"):
+            continue
+        with open(path, "rb") as f:
+            refs = [m.decode() for m in SRC_ATTR.findall(f.read())]
+        for ref in refs:
+            # Drive paths ("A:...") and URLs are resolved on the device
+            if ref in seen or ":" in ref:
+                continue
+            found = find_file(ref, search_dirs)
+            if found is None:
+                print("warning: %s references %s, not found" % (name, ref))
+                continue
+            entries.append((ref, found))
+            seen.add(ref)
+
+    for path in extra:
+        name = os.path.basename(path)
+        if name not in seen:
+            entries.append((name, path))
+            seen.add(name)
+    return entries
+
+
+def pack(entries):
+    index = b""
+    data = b""
+    for name, path in entries:
+        with open(path, "rb") as f:
+            content = f.read()
+        encoded = name.encode()
+        if len(encoded) > NAME_MAX:
+            sys.exit("Entry name too long: " + name)
+
+        stored = compress(content)
+        flags = FLAG_ZLIB
+        if len(stored) >= len(content):
+            stored = content
+            flags = 0
+
+        index += struct.pack("<BBHIIII", flags, len(encoded), 0, len(data), len(stored), len(content), fnv1a(content))
+        index += encoded
+        data += stored
+        print("  %-32s %7d -> %7d bytes%s" % (name, len(content), len(stored), " (zlib)" if flags else ""))
+
+    header = MAGIC + struct.pack("<BBHI", VERSION, 0, len(entries), 12 + len(index))
+    return header + index + data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack an LVML bundle")
+    parser.add_argument("xml", help="screen XML, stored as the first entry")
+    parser.add_argument("extra", nargs="*", help="additional files to include")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("--assets", action="append", default=[], help="directory to look up references in")
+    args = parser.parse_intermixed_args()
+
+    entries = collect(args.xml, [os.path.abspath(d) for d in args.assets], args.extra)
+    print("%s:" % args.output)
+    bundle = pack(entries)
+
+    out_dir = os.path.dirname(args.output)
+    if out_dir:
+        os.makedirs(out_dir, exist_ok=True)
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    print("  %d entries, %d bytes" % (len(entries), len(bundle)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# precompile_scripts.py - Compile vfs/web/*.py into LVML bytecode cache entries
+#
+# Writes vfs/cache/mpy/<hash>.mpy in the format lvml/micropython/lvml_script.c
+# reads, so <micropython src="..."> scripts don't need to be compiled on the
+# device the first time they run. Usage:
+#   python3 scripts/precompile_scripts.py [vfs_dir] [mpy_cross]
+
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+PROJECT_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_VFS = os.path.join(PROJECT_ROOT, "vfs")
+DEFAULT_MPY_CROSS = os.path.join(PROJECT_ROOT, "third-party", "micropython", "mpy-cross", "build", "mpy-cross")
+
+SCRIPT_DIRS = ["web"]
+CACHE_DIR = "cache/mpy"          # LVML_SCRIPT_CACHE_DIR
+CACHE_MAGIC = b"LVMC"            # LVML_SCRIPT_CACHE_MAGIC
+
+FNV_INIT = 0x811C9DC5
+FNV_PRIME = 0x01000193
+
+
+def fnv1a(data, h=FNV_INIT):
+    for b in data:
+        h ^= b
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def fnv1a_u32(h, value):
+    return fnv1a(struct.pack("<I", value), h)
+
+
+def mpy_version(mpy_cross):
+    """Return (version, sub_version) of the .mpy format mpy-cross emits"""
+    out = subprocess.run([mpy_cross, "--version"], capture_output=True, text=True, check=True).stdout
+    match = re.search(r"mpy v(\d+)\.(\d+)", out)
+    if not match:
+        sys.exit("Can't determine .mpy version from: " + out.strip())
+    return int(match.group(1)), int(match.group(2))
+
+
+def cache_key(source, version):
+    """Same as lvml_script_cache_key()"""
+    key = fnv1a(source)
+    key = fnv1a_u32(key, len(source))
+    return fnv1a_u32(key, (version[0] << 8) | version[1])
+
+
+def precompile(vfs_dir, mpy_cross):
+    version = mpy_version(mpy_cross)
+    out_dir = os.path.join(vfs_dir, CACHE_DIR)
+    os.makedirs(out_dir, exist_ok=True)
+
+    for script_dir in SCRIPT_DIRS:
+        src_dir = os.path.join(vfs_dir, script_dir)
+        for name in sorted(os.listdir(src_dir)):
+            if not name.endswith(".py"):
+                continue
+            device_path = "/%s/%s" % (script_dir, name)
+            with open(os.path.join(src_dir, name), "rb") as f:
+                source = f.read()
+
+            with tempfile.TemporaryDirectory() as tmp:
+                mpy_path = os.path.join(tmp, "out.mpy")
+                subprocess.run([mpy_cross, "-s", device_path, "-o", mpy_path, os.path.join(src_dir, name)], check=True)
+                with open(mpy_path, "rb") as f:
+                    mpy = f.read()
+
+            entry = "%08x.mpy" % fnv1a(device_path.encode())
+            with open(os.path.join(out_dir, entry), "wb") as f:
+                f.write(CACHE_MAGIC + struct.pack("<I", cache_key(source, version)) + mpy)
+            print("%s -> /%s/%s (%d -> %d bytes)" % (device_path, CACHE_DIR, entry, len(source), len(mpy)))
+
+
+if __name__ == "__main__":
+    vfs_dir = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_VFS
+    mpy_cross = sys.argv[2] if len(sys.argv) > 2 else DEFAULT_MPY_CROSS
+    if not os.path.exists(mpy_cross):
+        sys.exit("mpy-cross not found: %s (run 'make build-mpy-cross')" % mpy_cross)
+    precompile(vfs_dir, mpy_cross)
@@ -0,0 +1,58 @@
+# Benchmark: overlapped boot against the sequential path
+# Run on the device after boot: import bench_boot
+#
+# _boot.py keeps each boot's timeline in NVS when "boot_profile" is set, as
+# "boot_<version>" for the overlapped path and "boot_<version>s" for the
+# sequential one (NVS flag "boot_sequential"). Each run of this benchmark
+# switches the mode and resets; once both timelines are stored it prints
+# them side by side.
+
+import esp32
+import machine
+import lvml
+
+nvs = esp32.NVS("lvml")
+KEY = "boot_" + lvml.get_version().replace(".", "")
+
+def load(key):
+    buf = bytearray(1024)
+    try:
+        size = nvs.get_blob(key, buf)
+    except OSError:
+        return None
+    stages = {}
+    order = []
+    for line in buf[:size].decode().split("\n"):
+        name, time_us = line.split(" ")
+        stages[name] = int(time_us)
+        order.append(name)
+    return order, stages
+
+overlapped = load(KEY)
+sequential = load(KEY + "s")
+if overlapped is None or sequential is None:
+    # Boot the missing mode next
+    nvs.set_i32("boot_profile", 1)
+    nvs.set_i32("boot_sequential", 1 if overlapped is not None else 0)
+    nvs.commit()
+    print("Profiling the %s boot; resetting, run bench_boot again afterwards" %
+          ("sequential" if overlapped is not None else "overlapped"))
+    machine.reset()
+
+print("%-16s %10s %10s" % ("stage (ms)", "sequential", "overlapped"))
+names = sequential[0] + [n for n in overlapped[0] if n not in sequential[1]]
+for name in names:
+    cols = []
+    for _, stages in (sequential, overlapped):
+        cols.append("%10.1f" % (stages[name] / 1000) if name in stages else "%10s" % "-")
+    print("%-16s %s %s" % (name, cols[0], cols[1]))
+
+seq_done = sequential[1].get("boot_done")
+ovl_done = overlapped[1].get("boot_done")
+if seq_done and ovl_done:
+    print("Boot done: %.1f ms sequential, %.1f ms overlapped, %.1f ms saved" %
+          (seq_done / 1000, ovl_done / 1000, (seq_done - ovl_done) / 1000))
+
+# Back to the default, overlapped boot
+nvs.set_i32("boot_sequential", 0)
+nvs.commit()
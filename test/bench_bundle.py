@@ -0,0 +1,50 @@
+# Benchmark: cold load of wifi_settings from loose files vs. from a bundle
+# Build the bundle with 'make pack-bundles' (part of 'make create-vfs'),
+# then run on the device after boot: import bench_bundle
+
+import os
+import time
+import lvml
+
+XML_PATH = "/web/wifi_settings.xml"
+BUNDLE_PATH = "/bundles/wifi_settings.lvmb"
+CACHE_DIR = "/cache/mpy"
+RUNS = 5
+
+def clear_cache():
+    try:
+        for name in os.listdir(CACHE_DIR):
+            os.remove(CACHE_DIR + "/" + name)
+    except OSError:
+        pass
+
+def load_loose():
+    with open(XML_PATH) as f:
+        xml = f.read()
+    lvml.load_xml(xml, base="/web")
+
+def load_bundle():
+    lvml.load_bundle(BUNDLE_PATH)
+
+def bench(load):
+    total = 0
+    for _ in range(RUNS):
+        # Cold: scripts are compiled again on every run
+        clear_cache()
+        start = time.ticks_us()
+        load()
+        total += time.ticks_diff(time.ticks_us(), start)
+        lvml.tick()
+    return total // RUNS
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+
+    loose_us = bench(load_loose)
+    bundle_us = bench(load_bundle)
+    print("loose files: %8d us" % loose_us)
+    print("bundle:      %8d us (%d bytes)" % (bundle_us, os.stat(BUNDLE_PATH)[6]))
+    print("saved:       %7d%%" % (100 * (loose_us - bundle_us) // max(loose_us, 1)))
+
+run()
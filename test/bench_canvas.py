@@ -0,0 +1,62 @@
+# Benchmark: a 200-point sparkline drawn with rect objects vs. on a canvas
+# Run on the device after boot: import bench_canvas
+
+import math
+import time
+import lvml
+
+POINTS = 200
+HEIGHT = 60
+FRAMES = 10
+
+def samples(phase):
+    return [int(HEIGHT / 2 + (HEIGHT / 2 - 2) * math.sin((i + phase) / 12)) for i in range(POINTS)]
+
+def clear():
+    lvml.load_xml('<component><view extends="lv_obj" width="100%" height="100%"/></component>')
+    lvml.tick()
+
+def with_rects(frame):
+    # One small rect per point, redrawn from scratch every frame
+    clear()
+    commands = [("rect", 10 + i, 20 + y, 1, 1, 0x00FF00, 0, 0) for i, y in enumerate(samples(frame))]
+    lvml.batch(commands)
+
+def with_canvas_lines(canvas, frame):
+    canvas.fill(0x000000)
+    ys = samples(frame)
+    for i in range(1, POINTS):
+        canvas.line(i - 1, ys[i - 1], i, ys[i], 0x00FF00)
+
+def with_memoryview(canvas, frame):
+    # Direct writes through the buffer protocol, then one invalidate
+    pixels = memoryview(canvas)
+    stride = canvas.stride
+    canvas.fill(0x000000)
+    for x, y in enumerate(samples(frame)):
+        pixels[y * stride + x] = 0x07E0  # RGB565 green
+    canvas.invalidate()
+
+def bench(name, draw):
+    lvml.refresh_stats(True)
+    start = time.ticks_us()
+    for frame in range(FRAMES):
+        draw(frame)
+        lvml.tick()
+    elapsed = time.ticks_diff(time.ticks_us(), start)
+    stats = lvml.refresh_stats()
+    print("%-12s %7d us/frame, %8d px invalidated/frame" %
+          (name, elapsed // FRAMES, stats["invalidated_px"] // FRAMES))
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+
+    bench("rects", with_rects)
+    clear()
+    canvas = lvml.canvas(10, 20, POINTS, HEIGHT)
+    bench("canvas.line", lambda f: with_canvas_lines(canvas, f))
+    bench("memoryview", lambda f: with_memoryview(canvas, f))
+    canvas.delete()
+
+run()
@@ -0,0 +1,57 @@
+# Benchmark: updating a status panel by drawing new objects on top vs. mutating handles
+# Run on the device after boot: import bench_handles
+
+import time
+import lvml
+
+ROUNDS = 20
+
+def recreate(round_no):
+    # The old way: every change draws a fresh button over the previous one
+    lvml.rect(20, 20, 200, 60, 0x202020, 0, 0)
+    lvml.button(30, 30, 180, 40, "round %d" % round_no, 0x0066CC, 0xFFFFFF)
+
+def mutate(panel, label, round_no):
+    panel.bg = 0x202020 if round_no % 2 else 0x303030
+    label.text = "round %d" % round_no
+
+def bench(update):
+    lvml.tick()
+    lvml.refresh_stats(True)
+    created = lvml.handle_stats()["created"]
+    start = time.ticks_us()
+    for r in range(ROUNDS):
+        update(r)
+        lvml.tick()
+    elapsed = time.ticks_diff(time.ticks_us(), start)
+    stats = lvml.refresh_stats()
+    return elapsed, lvml.handle_stats()["created"] - created, stats["invalidated_px"]
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+
+    panel = lvml.rect(20, 20, 200, 60, 0x202020, 0, 0)
+    label = lvml.button(30, 30, 180, 40, "round", 0x0066CC, 0xFFFFFF)
+
+    us, objects, px = bench(recreate)
+    print("recreate: %8d us, %4d objects, %9d px invalidated" % (us, objects, px))
+    us, objects, px = bench(lambda r: mutate(panel, label, r))
+    print("mutate:   %8d us, %4d objects, %9d px invalidated" % (us, objects, px))
+
+    # Writing the same value again must not invalidate anything
+    lvml.refresh_stats(True)
+    label.text = label.text
+    panel.hidden = False
+    print("no-op writes invalidated:", lvml.refresh_stats()["invalidations"])
+
+    # A deleted object invalidates its handle
+    label.delete()
+    print("valid after delete:", label.valid)
+    try:
+        label.text = "gone"
+    except RuntimeError as e:
+        print("write after delete:", e)
+    print(lvml.handle_stats())
+
+run()
@@ -0,0 +1,66 @@
+# Benchmark: replay a recorded touch session and report what each frame cost
+# Run on the device after boot: import bench_replay
+#
+# The first run records: use the screen until RECORD_MS is over, and the
+# session is saved to RECORDING. Later runs replay that file in place of the
+# touch controller, so every run sees exactly the same input, once in real
+# time and once at SPEED times faster.
+
+import os
+import time
+import lvml
+
+RECORDING = "/bench_input.lvir"
+RECORD_MS = 10000
+SPEED = 4
+
+def exists(path):
+    try:
+        os.stat(path)
+        return True
+    except OSError:
+        return False
+
+def record():
+    print("Recording touch input for %d s..." % (RECORD_MS // 1000))
+    lvml.input_record()
+    start = time.ticks_ms()
+    while time.ticks_diff(time.ticks_ms(), start) < RECORD_MS:
+        lvml.tick()
+        time.sleep_ms(5)
+    records = lvml.input_save(RECORDING)
+    status = lvml.input_status()
+    print("Saved %d states, %d bytes, %d ms to %s" %
+          (records, status["bytes"], status["duration_ms"], RECORDING))
+
+def replay(speed):
+    lvml.refresh_stats(True)
+    lvml.input_replay(RECORDING, speed)
+    ticks = 0
+    worst = 0
+    total = 0
+    while lvml.input_status()["playing"]:
+        start = time.ticks_us()
+        lvml.tick()
+        elapsed = time.ticks_diff(time.ticks_us(), start)
+        total += elapsed
+        worst = max(worst, elapsed)
+        ticks += 1
+    status = lvml.input_status()
+    stats = lvml.refresh_stats()
+    ticks = max(ticks, 1)
+    print("speed %-4s %5d ms, %5d ticks, %5d us/tick avg, %6d max, %8d px invalidated, %d gestures" %
+          (speed, status["elapsed_ms"], ticks, total // ticks, worst, stats["invalidated_px"],
+           status["gestures"]))
+    if status["error"]:
+        print("  recording is corrupt after %d states" % status["played"])
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+    if not exists(RECORDING):
+        record()
+    replay(1)
+    replay(SPEED)
+
+run()
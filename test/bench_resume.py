@@ -0,0 +1,60 @@
+# Benchmark: waking from deep sleep into the saved UI against a cold boot
+# Run on the device after boot: import bench_resume
+#
+# _boot.py keeps each boot's timeline in NVS when "boot_profile" is set, as
+# "boot_<version>" for a cold boot and "boot_<version>r" for a wake that
+# restored the UI saved by resume.sleep(). Each run of this benchmark stores
+# the missing timeline: a reset for the cold one, resume.sleep() with a
+# one-second wake timer for the other. Once both exist it prints them side
+# by side; "boot_done" comes after wait_ready("touch"), so it is the time
+# until the UI is interactive.
+
+import esp32
+import machine
+import lvml
+import resume
+
+nvs = esp32.NVS("lvml")
+KEY = "boot_" + lvml.get_version().replace(".", "")
+
+def load(key):
+    buf = bytearray(1024)
+    try:
+        size = nvs.get_blob(key, buf)
+    except OSError:
+        return None
+    stages = {}
+    order = []
+    for line in buf[:size].decode().split("\n"):
+        name, time_us = line.split(" ")
+        stages[name] = int(time_us)
+        order.append(name)
+    return order, stages
+
+cold = load(KEY)
+resumed = load(KEY + "r")
+if cold is None or resumed is None:
+    nvs.set_i32("boot_profile", 1)
+    nvs.set_i32("boot_sequential", 0)
+    nvs.commit()
+    if cold is None:
+        print("Profiling a cold boot; resetting, run bench_resume again afterwards")
+        resume.forget()
+        machine.reset()
+    state = lvml.snapshot_state()
+    print("Saving %d bytes of UI state; waking in 1 s, run bench_resume again afterwards" % len(state))
+    resume.sleep(1000)
+
+print("%-16s %10s %10s" % ("stage (ms)", "cold", "resumed"))
+names = cold[0] + [n for n in resumed[0] if n not in cold[1]]
+for name in names:
+    cols = []
+    for _, stages in (cold, resumed):
+        cols.append("%10.1f" % (stages[name] / 1000) if name in stages else "%10s" % "-")
+    print("%-16s %s %s" % (name, cols[0], cols[1]))
+
+cold_done = cold[1].get("boot_done")
+resumed_done = resumed[1].get("boot_done")
+if cold_done and resumed_done:
+    print("Interactive after %.1f ms cold, %.1f ms resumed, %.1f ms saved" %
+          (cold_done / 1000, resumed_done / 1000, (cold_done - resumed_done) / 1000))
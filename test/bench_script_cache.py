@@ -0,0 +1,35 @@
+# Benchmark: <micropython> script load time from source vs. from the bytecode cache
+# Run on the device after boot: import bench_script_cache
+
+import os
+import lvml
+
+SCRIPT_DIR = "/web"
+CACHE_DIR = "/cache/mpy"
+
+def clear_cache():
+    try:
+        for name in os.listdir(CACHE_DIR):
+            os.remove(CACHE_DIR + "/" + name)
+    except OSError:
+        pass
+
+def run():
+    scripts = [SCRIPT_DIR + "/" + n for n in os.listdir(SCRIPT_DIR) if n.endswith(".py")]
+
+    # Cold: compile from source and fill the cache, then warm: load bytecode
+    clear_cache()
+    for path in scripts:
+        lvml.run_script(path)
+    for path in scripts:
+        lvml.run_script(path)
+
+    print("%-24s %8s %10s %8s %8s" % ("script", "source", "compile_us", "load_us", "saved"))
+    for s in lvml.script_stats():
+        if s["path"] not in scripts:
+            continue
+        print("%-24s %8d %10d %8d %7d%%" % (
+            s["path"], s["source_bytes"], s["compile_us"], s["load_us"],
+            100 * (s["compile_us"] - s["load_us"]) // max(s["compile_us"], 1)))
+
+run()
@@ -0,0 +1,54 @@
+# Benchmark: 100 bound field updates one by one vs. one lvml.set_many() batch
+# Run on the device after boot: import bench_set_many
+
+import time
+import lvml
+
+FIELDS = 100
+
+def build_xml():
+    labels = []
+    for i in range(FIELDS):
+        x = (i % 5) * 64
+        y = (i // 5) * 12
+        labels.append('<lv_label x="%d" y="%d" bind_text="f%d"/>' % (x, y, i))
+    return '<component><view extends="lv_obj" width="100%%" height="100%%">%s</view></component>' % "".join(labels)
+
+def one_by_one(round_no):
+    start = time.ticks_us()
+    for i in range(FIELDS):
+        lvml.set_many({"f%d" % i: round_no * 1000 + i})
+        lvml.tick()
+    return time.ticks_diff(time.ticks_us(), start)
+
+def batched(round_no):
+    values = {}
+    for i in range(FIELDS):
+        values["f%d" % i] = round_no * 1000 + i
+    start = time.ticks_us()
+    lvml.set_many(values)
+    lvml.tick()
+    return time.ticks_diff(time.ticks_us(), start)
+
+def run(rounds=5):
+    if not lvml.is_initialized():
+        lvml.init()
+    lvml.load_xml(build_xml())
+    lvml.tick()
+
+    single_total = 0
+    batch_total = 0
+    for r in range(rounds):
+        single_total += one_by_one(2 * r + 1)
+        batch_total += batched(2 * r + 2)
+
+    print("one by one: %d us per refresh" % (single_total // rounds))
+    print("set_many:   %d us per refresh" % (batch_total // rounds))
+
+    # Unchanged values must be skipped
+    before = lvml.bind_stats()["skipped"]
+    batched(2 * rounds)
+    print("skipped on repeat:", lvml.bind_stats()["skipped"] - before)
+    print(lvml.bind_stats())
+
+run()
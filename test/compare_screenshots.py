@@ -0,0 +1,92 @@
+# Compare two screenshots taken with lvml.screenshot() (QOI format)
+# Run on the host: python3 test/compare_screenshots.py expected.qoi actual.qoi [--tolerance N] [--diff diff.ppm]
+#
+# Exits with status 1 if more pixels differ by more than the tolerance than
+# --max-pixels allows, so it can gate a regression suite.
+
+import argparse
+import struct
+import sys
+
+
+def decode_qoi(data):
+    """Decode a QOI image to (width, height, list of (r, g, b) tuples)"""
+    if data[:4] != b"qoif":
+        raise ValueError("not a QOI image")
+    width, height = struct.unpack(">II", data[4:12])
+    index = [(0, 0, 0, 0)] * 64
+    r, g, b, a = 0, 0, 0, 255
+    pixels = []
+    pos = 14
+    total = width * height
+    while len(pixels) < total:
+        op = data[pos]
+        pos += 1
+        if op == 0xFE:
+            r, g, b = data[pos], data[pos + 1], data[pos + 2]
+            pos += 3
+        elif op == 0xFF:
+            r, g, b, a = data[pos], data[pos + 1], data[pos + 2], data[pos + 3]
+            pos += 4
+        elif op >> 6 == 0:
+            r, g, b, a = index[op]
+        elif op >> 6 == 1:
+            r = (r + ((op >> 4) & 3) - 2) & 0xFF
+            g = (g + ((op >> 2) & 3) - 2) & 0xFF
+            b = (b + (op & 3) - 2) & 0xFF
+        elif op >> 6 == 2:
+            vg = (op & 0x3F) - 32
+            second = data[pos]
+            pos += 1
+            r = (r + vg + (second >> 4) - 8) & 0xFF
+            g = (g + vg) & 0xFF
+            b = (b + vg + (second & 0x0F) - 8) & 0xFF
+        else:
+            run = (op & 0x3F) + 1
+            pixels.extend([(r, g, b)] * (run - 1))
+        index[(r * 3 + g * 5 + b * 7 + a * 11) % 64] = (r, g, b, a)
+        pixels.append((r, g, b))
+    return width, height, pixels[:total]
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("expected")
+    parser.add_argument("actual")
+    parser.add_argument("--tolerance", type=int, default=8, help="per-channel difference that still matches")
+    parser.add_argument("--max-pixels", type=int, default=0, help="differing pixels allowed")
+    parser.add_argument("--diff", help="write differing pixels in red to this PPM file")
+    args = parser.parse_args()
+
+    with open(args.expected, "rb") as f:
+        ew, eh, expected = decode_qoi(f.read())
+    with open(args.actual, "rb") as f:
+        aw, ah, actual = decode_qoi(f.read())
+    if (ew, eh) != (aw, ah):
+        print("size differs: %dx%d vs %dx%d" % (ew, eh, aw, ah))
+        return 1
+
+    differing = 0
+    max_delta = 0
+    diff = bytearray()
+    for e, a in zip(expected, actual):
+        delta = max(abs(e[0] - a[0]), abs(e[1] - a[1]), abs(e[2] - a[2]))
+        max_delta = max(max_delta, delta)
+        if delta > args.tolerance:
+            differing += 1
+            diff += b"\xff\x00\x00"
+        else:
+            gray = (a[0] + a[1] + a[2]) // 6
+            diff += bytes((gray, gray, gray))
+
+    if args.diff:
+        with open(args.diff, "wb") as f:
+            f.write(b"P6\n%d %d\n255\n" % (aw, ah))
+            f.write(diff)
+
+    print("%dx%d: %d pixels differ (max channel delta %d)" % (aw, ah, differing, max_delta))
+    return 1 if differing > args.max_pixels else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,2 @@
+// Host stand-in for the LVGL header, see mock_mp.h
+#include "mock_mp.h"
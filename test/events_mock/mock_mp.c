@@ -0,0 +1,237 @@
+/**
+ * @file mock_mp.c
+ * @brief MicroPython and LVGL stand-ins for the event bridge host test
+ *
+ * Every Python call is logged as (callback, handle, event name); a callback
+ * equal to MOCK_RAISING raises instead. Scheduled functions wait in a FIFO
+ * that holds at most mock_sched_set_capacity() entries until
+ * mock_sched_run().
+ */
+
+#include "mock_mp.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define MOCK_CALLBACKS_MAX 16
+#define MOCK_SCHED_MAX 8
+#define MOCK_LOG_MAX 256
+#define MOCK_RAISING ((mp_obj_t)(uintptr_t)0xBAD)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_event_cb_t cb;
+    lv_event_code_t filter;
+    void *user_data;
+} mock_callback_t;
+
+struct lv_obj_t {
+    mock_callback_t callbacks[MOCK_CALLBACKS_MAX];
+    uint32_t count;
+};
+
+typedef struct {
+    mp_obj_t callback;
+    mp_obj_t handle;
+    mp_obj_t name;
+} mock_call_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+const int mock_none = 0;
+const mp_obj_type_t mp_type_RuntimeError = { 0 };
+const mp_print_t mp_plat_print = { 0 };
+
+static nlr_buf_t *nlr_top = NULL;
+
+static mock_call_t calls[MOCK_LOG_MAX];
+static size_t calls_count = 0;
+
+static const mock_fun_1_t *sched_queue[MOCK_SCHED_MAX];
+static size_t sched_count = 0;
+static size_t sched_capacity = MOCK_SCHED_MAX;
+
+void mock_root_pointers_clear(void);
+
+/**********************
+ *   MICROPYTHON
+ **********************/
+
+void mock_nlr_push(nlr_buf_t *nlr) {
+    nlr->prev = nlr_top;
+    nlr_top = nlr;
+}
+
+void nlr_pop(void) {
+    nlr_top = nlr_top->prev;
+}
+
+void nlr_raise(void *val) {
+    nlr_buf_t *nlr = nlr_top;
+    nlr_top = nlr->prev;
+    nlr->ret_val = val;
+    longjmp(nlr->jmp, 1);
+}
+
+void mp_raise_msg(const mp_obj_type_t *type, const char *msg) {
+    (void)type;
+    nlr_raise((void *)msg);
+}
+
+mp_obj_t mp_call_function_2(mp_obj_t fun, mp_obj_t arg1, mp_obj_t arg2) {
+    if (calls_count < MOCK_LOG_MAX) {
+        calls[calls_count++] = (mock_call_t){ fun, arg1, arg2 };
+    }
+    if (fun == MOCK_RAISING) {
+        nlr_raise((void *)"callback failed");
+    }
+    return mp_const_none;
+}
+
+bool mp_sched_schedule(mp_obj_t function, mp_obj_t arg) {
+    (void)arg;
+    if (sched_count >= sched_capacity) {
+        return false;
+    }
+    sched_queue[sched_count++] = (const mock_fun_1_t *)function;
+    return true;
+}
+
+int mp_printf(const mp_print_t *print, const char *fmt, ...) {
+    (void)print;
+    (void)fmt;
+    return 0;
+}
+
+void mp_obj_print_exception(const mp_print_t *print, mp_obj_t exc) {
+    (void)print;
+    (void)exc;
+}
+
+/**********************
+ *      LVGL
+ **********************/
+
+void *lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t cb, lv_event_code_t filter, void *user_data) {
+    if (obj->count == MOCK_CALLBACKS_MAX) {
+        return NULL;
+    }
+    mock_callback_t *callback = &obj->callbacks[obj->count++];
+    *callback = (mock_callback_t){ cb, filter, user_data };
+    return callback;
+}
+
+uint32_t lv_obj_remove_event_cb_with_user_data(lv_obj_t *obj, lv_event_cb_t cb, void *user_data) {
+    uint32_t removed = 0;
+    for (uint32_t i = 0; i < obj->count;) {
+        if (obj->callbacks[i].cb == cb && obj->callbacks[i].user_data == user_data) {
+            memmove(&obj->callbacks[i], &obj->callbacks[i + 1], (obj->count - i - 1) * sizeof(mock_callback_t));
+            obj->count--;
+            removed++;
+        } else {
+            i++;
+        }
+    }
+    return removed;
+}
+
+void *lv_event_get_user_data(lv_event_t *e) {
+    return e->user_data;
+}
+
+lv_event_code_t lvml_input_gesture_code(uint8_t type) {
+    return (lv_event_code_t)(LV_EVENT_LAST + type);
+}
+
+/**********************
+ *   TEST INTERFACE
+ **********************/
+
+size_t mock_obj_size(void) {
+    return sizeof(lv_obj_t);
+}
+
+uint32_t mock_obj_callbacks(const lv_obj_t *obj) {
+    return obj->count;
+}
+
+/**
+ * Send an event to the callbacks registered for it, as lv_obj_send_event() does
+ */
+void mock_send(lv_obj_t *obj, lv_event_code_t code) {
+    mock_callback_t callbacks[MOCK_CALLBACKS_MAX];
+    uint32_t count = obj->count;
+    memcpy(callbacks, obj->callbacks, sizeof(callbacks));
+    for (uint32_t i = 0; i < count; i++) {
+        if (callbacks[i].filter == code || callbacks[i].filter == LV_EVENT_ALL) {
+            lv_event_t e = { obj, code, callbacks[i].user_data };
+            callbacks[i].cb(&e);
+        }
+    }
+}
+
+/**
+ * Delete an object: LV_EVENT_DELETE, then its callbacks are gone
+ */
+void mock_delete(lv_obj_t *obj) {
+    mock_send(obj, LV_EVENT_DELETE);
+    obj->count = 0;
+}
+
+/**
+ * lvml_events_register() with the RuntimeError caught
+ * @return 1 registered, 0 unknown event, -1 raised
+ */
+int mock_register(lv_obj_t *obj, mp_obj_t handle, qstr event, mp_obj_t callback) {
+    bool lvml_events_register(lv_obj_t *obj, mp_obj_t handle, qstr event, mp_obj_t callback);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        bool known = lvml_events_register(obj, handle, event, callback);
+        nlr_pop();
+        return known ? 1 : 0;
+    }
+    return -1;
+}
+
+void mock_sched_set_capacity(size_t capacity) {
+    sched_capacity = capacity < MOCK_SCHED_MAX ? capacity : MOCK_SCHED_MAX;
+}
+
+size_t mock_sched_pending(void) {
+    return sched_count;
+}
+
+/**
+ * Run the scheduled functions, as the VM does between bytecodes
+ */
+void mock_sched_run(void) {
+    const mock_fun_1_t *queue[MOCK_SCHED_MAX];
+    size_t count = sched_count;
+    memcpy(queue, sched_queue, sizeof(queue));
+    sched_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        queue[i]->fun(mp_const_none);
+    }
+}
+
+size_t mock_calls(mock_call_t *out, size_t max) {
+    size_t count = calls_count < max ? calls_count : max;
+    memcpy(out, calls, count * sizeof(mock_call_t));
+    calls_count = 0;
+    return count;
+}
+
+/**
+ * Soft reset: the heap, the root pointers and the scheduler queue are gone
+ */
+void mock_soft_reset(void) {
+    mock_root_pointers_clear();
+    sched_count = 0;
+}
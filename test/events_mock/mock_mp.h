@@ -0,0 +1,108 @@
+/**
+ * @file mock_mp.h
+ * @brief Just enough of MicroPython and LVGL to build lvml_events.c on the host
+ *
+ * Implemented by mock_mp.c. Objects are plain structs holding their event
+ * callbacks, Python objects are opaque pointers, calling one only logs the
+ * call, and the scheduler is a FIFO of limited size that runs when the
+ * test asks. A soft reset clears the root pointers and the scheduler, as
+ * the real one does.
+ */
+
+#ifndef MOCK_MP_H
+#define MOCK_MP_H
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* py/obj.h */
+typedef void *mp_obj_t;
+typedef size_t qstr;
+typedef struct { int unused; } mp_obj_type_t;
+typedef struct { mp_obj_t (*fun)(mp_obj_t); } mock_fun_1_t;
+
+#define MP_OBJ_NULL ((mp_obj_t)0)
+#define MP_OBJ_FROM_PTR(p) ((mp_obj_t)(p))
+#define MP_OBJ_NEW_QSTR(q) ((mp_obj_t)(uintptr_t)(q))
+#define MP_ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+#define MP_DEFINE_CONST_FUN_OBJ_1(name, f) const mock_fun_1_t name = { f }
+#define mp_const_none ((mp_obj_t)&mock_none)
+extern const int mock_none;
+extern const mp_obj_type_t mp_type_RuntimeError;
+
+// Same order as EVENTS in test/test_event_bridge.py
+enum {
+    MP_QSTRnull,
+    MP_QSTR_clicked, MP_QSTR_pressed, MP_QSTR_pressing, MP_QSTR_released, MP_QSTR_long_pressed,
+    MP_QSTR_value_changed, MP_QSTR_scroll, MP_QSTR_focused, MP_QSTR_defocused,
+    MP_QSTR_tap, MP_QSTR_double_tap, MP_QSTR_long_press, MP_QSTR_swipe, MP_QSTR_pinch,
+    MP_QSTR_rotate, MP_QSTR_pan,
+};
+
+/* py/mpstate.h: the root pointers of the one file that registers them */
+#define MP_REGISTER_ROOT_POINTER(decl) \
+    static struct { decl; } mock_vm; \
+    void mock_root_pointers_clear(void) { memset(&mock_vm, 0, sizeof(mock_vm)); }
+#define MP_STATE_VM(x) (mock_vm.x)
+
+/* py/runtime.h */
+#define MICROPY_ENABLE_SCHEDULER 1
+
+typedef struct nlr_buf_t {
+    struct nlr_buf_t *prev;
+    void *ret_val;
+    jmp_buf jmp;
+} nlr_buf_t;
+
+typedef struct { int unused; } mp_print_t;
+extern const mp_print_t mp_plat_print;
+
+void mock_nlr_push(nlr_buf_t *nlr);
+#define nlr_push(nlr) (mock_nlr_push(nlr), setjmp((nlr)->jmp))
+void nlr_pop(void);
+void nlr_raise(void *val) __attribute__((noreturn));
+void mp_raise_msg(const mp_obj_type_t *type, const char *msg) __attribute__((noreturn));
+mp_obj_t mp_call_function_2(mp_obj_t fun, mp_obj_t arg1, mp_obj_t arg2);
+bool mp_sched_schedule(mp_obj_t function, mp_obj_t arg);
+int mp_printf(const mp_print_t *print, const char *fmt, ...);
+void mp_obj_print_exception(const mp_print_t *print, mp_obj_t exc);
+
+/* lvgl.h */
+typedef enum {
+    LV_EVENT_ALL = 0,
+    LV_EVENT_PRESSED,
+    LV_EVENT_PRESSING,
+    LV_EVENT_LONG_PRESSED,
+    LV_EVENT_CLICKED,
+    LV_EVENT_RELEASED,
+    LV_EVENT_SCROLL,
+    LV_EVENT_FOCUSED,
+    LV_EVENT_DEFOCUSED,
+    LV_EVENT_VALUE_CHANGED,
+    LV_EVENT_DELETE,
+    LV_EVENT_LAST,              // Gesture codes follow, see lvml_input_gesture_code()
+} lv_event_code_t;
+
+typedef struct lv_obj_t lv_obj_t;
+typedef struct {
+    lv_obj_t *target;
+    lv_event_code_t code;
+    void *user_data;
+} lv_event_t;
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+
+void *lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t cb, lv_event_code_t filter, void *user_data);
+uint32_t lv_obj_remove_event_cb_with_user_data(lv_obj_t *obj, lv_event_cb_t cb, void *user_data);
+void *lv_event_get_user_data(lv_event_t *e);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*MOCK_MP_H*/
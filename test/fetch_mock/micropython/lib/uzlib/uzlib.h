@@ -0,0 +1,77 @@
+/**
+ * @file uzlib.h
+ * @brief Host stand-in for MicroPython's uzlib, on top of zlib
+ *
+ * Only what lvml_fetch.c uses: a gzip stream pulled through
+ * source_read_cb and inflated into dest..dest_limit. zlib keeps its own
+ * window, so the dictionary passed to uzlib_uncompress_init() is unused.
+ */
+
+#ifndef UZLIB_H
+#define UZLIB_H
+
+#include <string.h>
+#include <zlib.h>
+
+#define UZLIB_OK 0
+#define UZLIB_DONE 1
+#define UZLIB_DATA_ERROR (-3)
+#define UZLIB_HEADER_ZLIB 0
+#define UZLIB_HEADER_GZIP 1
+
+typedef struct {
+    const unsigned char *source;
+    const unsigned char *source_limit;
+    int (*source_read_cb)(void *data);
+    void *source_read_data;
+    unsigned char *dest;
+    unsigned char *dest_limit;
+    z_stream zs;
+    unsigned char in;           // Byte from source_read_cb not inflated yet
+} uzlib_uncomp_t;
+
+static inline void uzlib_uncompress_init(uzlib_uncomp_t *d, void *dict, unsigned int dict_size) {
+    (void)dict;
+    (void)dict_size;
+    (void)d;
+}
+
+/**
+ * zlib parses the header itself, so this only starts a gzip inflater
+ */
+static inline int uzlib_parse_zlib_gzip_header(uzlib_uncomp_t *d, int *wbits) {
+    memset(&d->zs, 0, sizeof(d->zs));
+    *wbits = MAX_WBITS;
+    return inflateInit2(&d->zs, 16 + MAX_WBITS) == Z_OK ? UZLIB_HEADER_GZIP : UZLIB_DATA_ERROR;
+}
+
+/**
+ * Inflate until dest is full or the stream ends
+ */
+static inline int uzlib_uncompress_chksum(uzlib_uncomp_t *d) {
+    while (d->dest < d->dest_limit) {
+        if (d->zs.avail_in == 0) {
+            int c = d->source_read_cb(d->source_read_data);
+            if (c < 0) {
+                return UZLIB_DATA_ERROR;
+            }
+            d->in = (unsigned char)c;
+            d->zs.next_in = &d->in;
+            d->zs.avail_in = 1;
+        }
+        d->zs.next_out = d->dest;
+        d->zs.avail_out = (uInt)(d->dest_limit - d->dest);
+        int r = inflate(&d->zs, Z_NO_FLUSH);
+        d->dest = d->zs.next_out;
+        if (r == Z_STREAM_END) {
+            inflateEnd(&d->zs);
+            return UZLIB_DONE;
+        }
+        if (r != Z_OK && r != Z_BUF_ERROR) {
+            return UZLIB_DATA_ERROR;
+        }
+    }
+    return UZLIB_OK;
+}
+
+#endif /*UZLIB_H*/
@@ -0,0 +1,2 @@
+// Host stand-in for the ESP-IDF header, see mock_idf.h
+#include "mock_idf.h"
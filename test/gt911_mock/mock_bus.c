@@ -0,0 +1,291 @@
+/**
+ * @file mock_bus.c
+ * @brief Simulated i2c_master bus with a GT911 on it, for host tests
+ *
+ * Transactions go through a FIFO like the real asynchronous bus: they run
+ * when a later transaction needs the bus or when the bus is waited on.
+ * Every transaction that runs is logged with its register, sizes and
+ * simulated start and end time; the time follows from the SCL clock of
+ * the device (9 clocks per byte plus start/stop).
+ */
+
+#include "mock_idf.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define MOCK_QUEUE_MAX 16
+#define MOCK_LOG_MAX 256
+#define MOCK_START_STOP_CLOCKS 3
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct mock_i2c_bus {
+    size_t queue_depth;
+};
+
+struct mock_i2c_dev {
+    uint16_t address;
+    uint32_t scl_hz;
+    i2c_master_callback_t on_done;
+    void *arg;
+};
+
+typedef struct {
+    uint8_t write[256];
+    size_t write_size;
+    uint8_t *read;
+    size_t read_size;
+} mock_trans_t;
+
+typedef struct {
+    uint16_t reg;
+    uint16_t write_size;        // Bytes written after the register address
+    uint16_t read_size;
+    int64_t start_us;
+    int64_t end_us;
+} mock_log_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static uint8_t mock_regs[0x10000];
+static int64_t mock_now_us = 0;
+static struct mock_i2c_bus mock_bus;
+static struct mock_i2c_dev mock_dev;
+static bool mock_bus_live = false;
+static bool mock_dev_live = false;
+static mock_trans_t mock_queue[MOCK_QUEUE_MAX];
+static size_t mock_queue_count = 0;
+static mock_log_t mock_log[MOCK_LOG_MAX];
+static size_t mock_log_count = 0;
+static int mock_nack_next = 0;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void mock_run(const mock_trans_t *t) {
+    uint16_t reg = (uint16_t)(t->write[0] << 8 | t->write[1]);
+    size_t bytes = 1 + t->write_size + (t->read_size > 0 ? 1 + t->read_size : 0);
+    int64_t clocks = (int64_t)bytes * 9 + MOCK_START_STOP_CLOCKS * (t->read_size > 0 ? 2 : 1);
+    int64_t start = mock_now_us;
+    mock_now_us += (clocks * 1000000 + mock_dev.scl_hz - 1) / mock_dev.scl_hz;
+
+    bool nack = mock_nack_next > 0;
+    if (nack) {
+        mock_nack_next--;
+    } else {
+        size_t data = t->write_size - 2;
+        memcpy(&mock_regs[reg], t->write + 2, data);
+        if (t->read_size > 0) {
+            memcpy(t->read, &mock_regs[reg], t->read_size);
+        }
+    }
+
+    if (mock_log_count < MOCK_LOG_MAX) {
+        mock_log_t *log = &mock_log[mock_log_count++];
+        log->reg = reg;
+        log->write_size = (uint16_t)(t->write_size - 2);
+        log->read_size = (uint16_t)t->read_size;
+        log->start_us = start;
+        log->end_us = mock_now_us;
+    }
+    if (mock_dev.on_done != NULL) {
+        i2c_master_event_data_t evt = { nack ? I2C_EVENT_NACK : I2C_EVENT_DONE };
+        mock_dev.on_done(&mock_dev, &evt, mock_dev.arg);
+    }
+}
+
+static void mock_flush(void) {
+    for (size_t i = 0; i < mock_queue_count; i++) {
+        mock_run(&mock_queue[i]);
+    }
+    mock_queue_count = 0;
+}
+
+static esp_err_t mock_submit(const uint8_t *write, size_t write_size, uint8_t *read, size_t read_size) {
+    if (!mock_dev_live || write_size < 2 || write_size > sizeof(mock_queue[0].write)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (mock_bus.queue_depth == 0) {
+        mock_trans_t t = { .write_size = write_size, .read = read, .read_size = read_size };
+        memcpy(t.write, write, write_size);
+        mock_run(&t);
+        return ESP_OK;
+    }
+    if (mock_queue_count == mock_bus.queue_depth) {
+        mock_flush();
+    }
+    mock_trans_t *t = &mock_queue[mock_queue_count++];
+    memcpy(t->write, write, write_size);
+    t->write_size = write_size;
+    t->read = read;
+    t->read_size = read_size;
+    return ESP_OK;
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/* Test controls */
+
+void mock_reset(void) {
+    memset(mock_regs, 0, sizeof(mock_regs));
+    // Product ID "911", resolution 320x240
+    memcpy(&mock_regs[0x8140], "911", 3);
+    mock_regs[0x8146] = 320 & 0xFF;
+    mock_regs[0x8147] = 320 >> 8;
+    mock_regs[0x8148] = 240;
+    mock_now_us = 0;
+    mock_queue_count = 0;
+    mock_log_count = 0;
+    mock_nack_next = 0;
+}
+
+uint8_t *mock_registers(void) {
+    return mock_regs;
+}
+
+size_t mock_log_size(void) {
+    return mock_log_count;
+}
+
+const mock_log_t *mock_log_entry(size_t i) {
+    return i < mock_log_count ? &mock_log[i] : NULL;
+}
+
+void mock_log_clear(void) {
+    mock_log_count = 0;
+}
+
+size_t mock_pending(void) {
+    return mock_queue_count;
+}
+
+void mock_nack(int count) {
+    mock_nack_next = count;
+}
+
+uint32_t mock_scl_hz(void) {
+    return mock_dev_live ? mock_dev.scl_hz : 0;
+}
+
+bool mock_bus_exists(void) {
+    return mock_bus_live;
+}
+
+int64_t esp_timer_get_time(void) {
+    return mock_now_us;
+}
+
+/* ESP-IDF and FreeRTOS */
+
+const char *esp_err_to_name(esp_err_t code) {
+    return code == ESP_OK ? "ESP_OK" : "ESP_FAIL";
+}
+
+void vTaskDelay(TickType_t ticks) {
+    mock_now_us += (int64_t)ticks * 1000;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(mock_now_us / 1000);
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken) {
+    (void)task;
+    *woken = pdFALSE;
+}
+
+esp_err_t gpio_config(const gpio_config_t *conf) { (void)conf; return ESP_OK; }
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level) { (void)pin; (void)level; return ESP_OK; }
+esp_err_t gpio_install_isr_service(int flags) { (void)flags; return ESP_OK; }
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t handler, void *arg) {
+    (void)pin; (void)handler; (void)arg;
+    return ESP_OK;
+}
+esp_err_t gpio_isr_handler_remove(gpio_num_t pin) { (void)pin; return ESP_OK; }
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t *conf, i2c_master_bus_handle_t *bus) {
+    if (mock_bus_live || conf->trans_queue_depth > MOCK_QUEUE_MAX) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    mock_bus.queue_depth = conf->trans_queue_depth;
+    mock_bus_live = true;
+    *bus = &mock_bus;
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus) {
+    if (bus != &mock_bus || mock_dev_live) {
+        return ESP_ERR_INVALID_STATE;   // Devices must be removed first
+    }
+    mock_bus_live = false;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t *conf,
+                                    i2c_master_dev_handle_t *dev) {
+    if (bus != &mock_bus || mock_dev_live || conf->scl_speed_hz == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(&mock_dev, 0, sizeof(mock_dev));
+    mock_dev.address = conf->device_address;
+    mock_dev.scl_hz = conf->scl_speed_hz;
+    mock_dev_live = true;
+    *dev = &mock_dev;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t dev) {
+    if (dev != &mock_dev || mock_queue_count > 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    mock_dev_live = false;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_register_event_callbacks(i2c_master_dev_handle_t dev, const i2c_master_event_callbacks_t *cbs,
+                                              void *arg) {
+    dev->on_done = cbs->on_trans_done;
+    dev->arg = arg;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus, uint16_t address, int timeout_ms) {
+    (void)timeout_ms;
+    return bus == &mock_bus && address == 0x5D ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t *write, size_t write_size, int timeout_ms) {
+    (void)dev;
+    (void)timeout_ms;
+    return mock_submit(write, write_size, NULL, 0);
+}
+
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t dev, const uint8_t *write, size_t write_size,
+                                      uint8_t *read, size_t read_size, int timeout_ms) {
+    (void)dev;
+    (void)timeout_ms;
+    if (write_size != 2) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return mock_submit(write, write_size, read, read_size);
+}
+
+esp_err_t i2c_master_bus_wait_all_done(i2c_master_bus_handle_t bus, int timeout_ms) {
+    (void)timeout_ms;
+    if (bus != &mock_bus) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mock_flush();
+    return ESP_OK;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file mock_idf.h
+ * @brief Just enough of ESP-IDF and FreeRTOS to build GT911.c on the host
+ *
+ * The i2c_master functions are implemented by mock_bus.c on top of a
+ * simulated GT911 register file. Time only moves when a transaction runs
+ * on the simulated bus or a task delays, so bus timings are exact.
+ */
+
+#ifndef MOCK_IDF_H
+#define MOCK_IDF_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* esp_err.h */
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_TIMEOUT 0x107
+const char *esp_err_to_name(esp_err_t code);
+
+/* esp_log.h */
+#define ESP_LOGE(tag, ...) ((void)(tag))
+#define ESP_LOGW(tag, ...) ((void)(tag))
+#define ESP_LOGI(tag, ...) ((void)(tag))
+#define ESP_LOGD(tag, ...) ((void)(tag))
+
+/* esp_timer.h */
+int64_t esp_timer_get_time(void);
+
+/* FreeRTOS */
+#define IRAM_ATTR
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+#define pdFALSE 0
+#define pdTRUE 1
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+
+/* driver/gpio.h */
+typedef int gpio_num_t;
+#define GPIO_NUM_NC -1
+typedef enum { GPIO_INTR_DISABLE, GPIO_INTR_NEGEDGE } gpio_int_type_t;
+typedef enum { GPIO_MODE_INPUT, GPIO_MODE_OUTPUT } gpio_mode_t;
+typedef struct {
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+    int pull_up_en;
+    int pull_down_en;
+    gpio_int_type_t intr_type;
+} gpio_config_t;
+typedef void (*gpio_isr_t)(void *arg);
+esp_err_t gpio_config(const gpio_config_t *conf);
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level);
+esp_err_t gpio_install_isr_service(int flags);
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t handler, void *arg);
+esp_err_t gpio_isr_handler_remove(gpio_num_t pin);
+
+/* driver/i2c_master.h */
+typedef enum { I2C_NUM_0, I2C_NUM_1 } i2c_port_t;
+typedef enum { I2C_CLK_SRC_DEFAULT } i2c_clock_source_t;
+typedef enum { I2C_ADDR_BIT_LEN_7, I2C_ADDR_BIT_LEN_10 } i2c_addr_bit_len_t;
+typedef enum { I2C_EVENT_ALIVE, I2C_EVENT_DONE, I2C_EVENT_NACK, I2C_EVENT_TIMEOUT } i2c_master_event_t;
+typedef struct mock_i2c_bus *i2c_master_bus_handle_t;
+typedef struct mock_i2c_dev *i2c_master_dev_handle_t;
+
+typedef struct {
+    i2c_port_t i2c_port;
+    gpio_num_t sda_io_num;
+    gpio_num_t scl_io_num;
+    i2c_clock_source_t clk_source;
+    uint8_t glitch_ignore_cnt;
+    int intr_priority;
+    size_t trans_queue_depth;
+    struct {
+        uint32_t enable_internal_pullup : 1;
+    } flags;
+} i2c_master_bus_config_t;
+
+typedef struct {
+    i2c_addr_bit_len_t dev_addr_length;
+    uint16_t device_address;
+    uint32_t scl_speed_hz;
+    uint32_t scl_wait_us;
+} i2c_device_config_t;
+
+typedef struct {
+    i2c_master_event_t event;
+} i2c_master_event_data_t;
+
+typedef bool (*i2c_master_callback_t)(i2c_master_dev_handle_t dev, const i2c_master_event_data_t *evt, void *arg);
+
+typedef struct {
+    i2c_master_callback_t on_trans_done;
+} i2c_master_event_callbacks_t;
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t *conf, i2c_master_bus_handle_t *bus);
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus);
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t *conf,
+                                    i2c_master_dev_handle_t *dev);
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t dev);
+esp_err_t i2c_master_register_event_callbacks(i2c_master_dev_handle_t dev, const i2c_master_event_callbacks_t *cbs,
+                                              void *arg);
+esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus, uint16_t address, int timeout_ms);
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t *write, size_t write_size, int timeout_ms);
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t dev, const uint8_t *write, size_t write_size,
+                                      uint8_t *read, size_t read_size, int timeout_ms);
+esp_err_t i2c_master_bus_wait_all_done(i2c_master_bus_handle_t bus, int timeout_ms);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*MOCK_IDF_H*/
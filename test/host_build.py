@@ -0,0 +1,23 @@
+# Builds LVML sources as a shared library for the host tests
+#
+# build() compiles with $CC (default cc), the lvml directory on the include
+# path after any mock directories, and loads the result with ctypes. The
+# tests declare their sources and the argtypes of what they call.
+
+import ctypes
+import os
+import subprocess
+import tempfile
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+
+def build(name, sources, includes=(), libs=()):
+    """Compile `sources` into lib<name>.so in a temporary directory and load it"""
+    out = os.path.join(tempfile.mkdtemp(), "lib%s.so" % name)
+    cc = os.environ.get("CC", "cc")
+    args = [cc, "-O2", "-Wall", "-shared", "-fPIC"]
+    for path in list(includes) + [os.path.join(ROOT, "lvml")]:
+        args += ["-I", path]
+    subprocess.check_call(args + ["-o", out] + list(sources) + list(libs))
+    return ctypes.CDLL(out)
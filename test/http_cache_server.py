@@ -0,0 +1,108 @@
+# Local HTTP server for testing lvml.load_from_url() caching
+# Run on the host: python3 test/http_cache_server.py [--dir vfs/web] [--port 8000] [--no-gzip] [--latency MS]
+#
+# Serves files with ETag and Last-Modified, answers conditional requests
+# with 304, gzips responses for clients that accept it and logs what each
+# request cost on the wire. Edit a served file to test revalidation.
+# --latency delays every response to imitate a slow network.
+
+import argparse
+import email.utils
+import gzip
+import hashlib
+import os
+import sys
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+totals = {"requests": 0, "full": 0, "not_modified": 0, "wire_bytes": 0, "body_bytes": 0}
+
+
+class CacheHandler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def do_GET(self):
+        if self.server.latency > 0:
+            time.sleep(self.server.latency / 1000.0)
+        path = os.path.normpath(self.path.split("?")[0]).lstrip("/")
+        full_path = os.path.join(self.server.root, path)
+        if path.startswith("..") or not os.path.isfile(full_path):
+            self.send_error(404)
+            return
+
+        with open(full_path, "rb") as f:
+            body = f.read()
+        etag = '"%s"' % hashlib.sha1(body).hexdigest()[:16]
+        mtime = int(os.path.getmtime(full_path))
+        last_modified = email.utils.formatdate(mtime, usegmt=True)
+
+        totals["requests"] += 1
+        if self.not_modified(etag, mtime):
+            totals["not_modified"] += 1
+            self.send_response(304)
+            self.send_header("ETag", etag)
+            self.send_header("Last-Modified", last_modified)
+            self.send_header("Connection", "close")
+            self.end_headers()
+            self.report(304, len(body), 0)
+            return
+
+        payload = body
+        use_gzip = self.server.gzip and "gzip" in self.headers.get("Accept-Encoding", "")
+        if use_gzip:
+            payload = gzip.compress(body)
+
+        totals["full"] += 1
+        self.send_response(200)
+        self.send_header("Content-Type", "application/xml" if path.endswith(".xml") else "application/octet-stream")
+        self.send_header("Content-Length", str(len(payload)))
+        self.send_header("ETag", etag)
+        self.send_header("Last-Modified", last_modified)
+        if use_gzip:
+            self.send_header("Content-Encoding", "gzip")
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.wfile.write(payload)
+        self.report(200, len(body), len(payload))
+
+    def not_modified(self, etag, mtime):
+        if_none_match = self.headers.get("If-None-Match")
+        if if_none_match is not None:
+            return etag in [t.strip() for t in if_none_match.split(",")]
+        if_modified_since = self.headers.get("If-Modified-Since")
+        if if_modified_since is not None:
+            try:
+                since = email.utils.parsedate_to_datetime(if_modified_since).timestamp()
+            except (TypeError, ValueError):
+                return False
+            return mtime <= since
+        return False
+
+    def report(self, status, body_bytes, wire_bytes):
+        totals["wire_bytes"] += wire_bytes
+        totals["body_bytes"] += body_bytes
+        print("%s %d body=%d wire=%d | %s" % (self.path, status, body_bytes, wire_bytes, totals))
+        sys.stdout.flush()
+
+    def log_message(self, fmt, *args):
+        pass
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--dir", default=os.path.join(os.path.dirname(__file__), "..", "vfs", "web"))
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--no-gzip", action="store_true")
+    parser.add_argument("--latency", type=int, default=0, help="delay per response in ms")
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer(("0.0.0.0", args.port), CacheHandler)
+    server.root = os.path.abspath(args.dir)
+    server.gzip = not args.no_gzip
+    server.latency = args.latency
+    print("Serving %s on port %d (gzip %s, latency %d ms)" % (server.root, args.port, "on" if server.gzip else "off", server.latency))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,221 @@
+# Host test for the event bridge (lvml/micropython/lvml_events.c)
+# Run on the host: python3 test/test_event_bridge.py
+#
+# Builds the bridge against the stand-in MicroPython and LVGL headers in
+# test/events_mock. Checks that high-rate events are coalesced into one
+# callback per dispatch, that a full scheduler falls back to the tick
+# poll, that full queues and slots are reported, that deleted objects get
+# no callbacks, and that a reset after a soft reset removes the LVGL
+# callbacks and lets the next event schedule a dispatch again.
+
+import ctypes
+import os
+import sys
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+MOCK = os.path.join(ROOT, "test", "events_mock")
+SOURCES = [os.path.join(ROOT, "lvml", "micropython", "lvml_events.c"), os.path.join(MOCK, "mock_mp.c")]
+SLOTS = 32                  # LVML_EVENTS_SLOTS
+QUEUE_MAX = 32              # LVML_EVENTS_QUEUE_MAX
+RAISING = 0xBAD             # MOCK_RAISING: calling this callback raises
+
+# qstr numbers of the event names, as in mock_mp.h
+EVENTS = ["", "clicked", "pressed", "pressing", "released", "long_pressed", "value_changed", "scroll",
+          "focused", "defocused", "tap", "double_tap", "long_press", "swipe", "pinch", "rotate", "pan"]
+# lv_event_code_t of mock_mp.h
+LV_EVENT_PRESSED = 1
+LV_EVENT_PRESSING = 2
+LV_EVENT_CLICKED = 4
+
+
+class Call(ctypes.Structure):
+    _fields_ = [("callback", ctypes.c_void_p), ("handle", ctypes.c_void_p), ("name", ctypes.c_void_p)]
+
+
+class Stats(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint32) for name in
+                ("received", "coalesced", "dropped", "dispatched", "dispatches", "errors",
+                 "last_latency_us", "avg_latency_us", "max_latency_us")]
+
+
+def build():
+    lib = host_build.build("events_mock", SOURCES, [MOCK])
+    lib.mock_obj_size.restype = ctypes.c_size_t
+    lib.mock_obj_callbacks.restype = ctypes.c_uint32
+    lib.mock_register.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_size_t, ctypes.c_void_p]
+    lib.mock_sched_pending.restype = ctypes.c_size_t
+    lib.mock_calls.restype = ctypes.c_size_t
+    lib.lvml_events_unregister.argtypes = [ctypes.c_void_p, ctypes.c_size_t]
+    lib.lvml_events_unregister.restype = ctypes.c_uint32
+    return lib
+
+
+def start(lib):
+    lib.lvml_events_reset()
+    lib.mock_sched_run()
+    lib.mock_sched_set_capacity(8)
+    calls(lib)
+    lib.lvml_events_get_stats(None, True)
+
+
+def new_obj(lib):
+    return ctypes.create_string_buffer(lib.mock_obj_size())
+
+
+def register(lib, obj, event, callback, handle=1):
+    qstr = EVENTS.index(event) if event in EVENTS else len(EVENTS)
+    return lib.mock_register(obj, handle, qstr, callback)
+
+
+def calls(lib):
+    out = (Call * 256)()
+    count = lib.mock_calls(out, 256)
+    return [(c.callback, c.handle, EVENTS[c.name]) for c in out[:count]]
+
+
+def stats(lib):
+    s = Stats()
+    lib.lvml_events_get_stats(ctypes.byref(s), False)
+    return s
+
+
+def test_coalesce(lib):
+    start(lib)
+    obj = new_obj(lib)
+    assert register(lib, obj, "pressing", 10) == 1
+    assert register(lib, obj, "clicked", 11) == 1
+    for _ in range(5):
+        lib.mock_send(obj, LV_EVENT_PRESSING)
+    lib.mock_send(obj, LV_EVENT_CLICKED)
+    lib.mock_send(obj, LV_EVENT_CLICKED)
+    assert lib.mock_sched_pending() == 1, "one dispatch per frame"
+
+    lib.mock_sched_run()
+    assert calls(lib) == [(10, 1, "pressing"), (11, 1, "clicked"), (11, 1, "clicked")]
+    s = stats(lib)
+    assert (s.received, s.coalesced, s.dispatched, s.dispatches) == (7, 4, 3, 1)
+
+    # Once dispatched, the next pressing is queued again
+    lib.mock_send(obj, LV_EVENT_PRESSING)
+    lib.mock_sched_run()
+    assert calls(lib) == [(10, 1, "pressing")]
+
+
+def test_scheduler_full(lib):
+    start(lib)
+    obj = new_obj(lib)
+    register(lib, obj, "clicked", 10)
+    lib.mock_sched_set_capacity(0)
+    lib.mock_send(obj, LV_EVENT_CLICKED)
+    assert lib.mock_sched_pending() == 0
+    lib.lvml_events_poll()
+    assert calls(lib) == [(10, 1, "clicked")]
+
+    # With room again, the next event is scheduled as usual
+    lib.mock_sched_set_capacity(8)
+    lib.mock_send(obj, LV_EVENT_CLICKED)
+    assert lib.mock_sched_pending() == 1
+
+
+def test_queue_full(lib):
+    start(lib)
+    obj = new_obj(lib)
+    register(lib, obj, "clicked", 10)
+    for _ in range(QUEUE_MAX + 8):
+        lib.mock_send(obj, LV_EVENT_CLICKED)
+    lib.mock_sched_run()
+    assert len(calls(lib)) == QUEUE_MAX
+    s = stats(lib)
+    assert (s.received, s.dropped, s.dispatched) == (QUEUE_MAX + 8, 8, QUEUE_MAX)
+
+
+def test_slots(lib):
+    start(lib)
+    objs = [new_obj(lib) for _ in range(SLOTS + 1)]
+    for obj in objs[:SLOTS]:
+        assert register(lib, obj, "clicked", 10) == 1
+    assert register(lib, objs[SLOTS], "clicked", 10) == -1, "no RuntimeError with all slots in use"
+    assert register(lib, objs[SLOTS], "no_such_event", 10) == 0
+
+    # Registering again replaces the callback without taking a slot
+    assert register(lib, objs[0], "clicked", 12, handle=2) == 1
+    lib.mock_send(objs[0], LV_EVENT_CLICKED)
+    lib.mock_sched_run()
+    assert calls(lib) == [(12, 2, "clicked")]
+
+    assert lib.lvml_events_unregister(objs[0], 0) == 1
+    assert lib.mock_obj_callbacks(objs[0]) == 0
+    assert register(lib, objs[SLOTS], "clicked", 10) == 1
+
+
+def test_deleted(lib):
+    start(lib)
+    obj = new_obj(lib)
+    register(lib, obj, "clicked", 10)
+    lib.mock_send(obj, LV_EVENT_CLICKED)
+    lib.mock_delete(obj)
+    lib.mock_sched_run()
+    assert calls(lib) == [], "callback for a deleted object"
+
+    # The slot is free again and the stale queued event isn't delivered to its new owner
+    other = new_obj(lib)
+    register(lib, other, "clicked", 11)
+    lib.mock_send(other, LV_EVENT_CLICKED)
+    lib.mock_sched_run()
+    assert calls(lib) == [(11, 1, "clicked")]
+
+
+def test_callback_raises(lib):
+    start(lib)
+    obj = new_obj(lib)
+    register(lib, obj, "pressed", RAISING)
+    register(lib, obj, "clicked", 10)
+    lib.mock_send(obj, LV_EVENT_PRESSED)
+    lib.mock_send(obj, LV_EVENT_CLICKED)
+    lib.mock_sched_run()
+    assert calls(lib) == [(RAISING, 1, "pressed"), (10, 1, "clicked")]
+    assert stats(lib).errors == 1
+
+
+def test_soft_reset(lib):
+    start(lib)
+    objs = [new_obj(lib) for _ in range(SLOTS)]
+    for obj in objs:
+        register(lib, obj, "clicked", 10)
+    lib.mock_send(objs[0], LV_EVENT_CLICKED)
+    assert lib.mock_sched_pending() == 1
+
+    # The scheduled dispatch is lost with the rest of the VM; the first import resets the bridge
+    lib.mock_soft_reset()
+    lib.lvml_events_reset()
+    assert all(lib.mock_obj_callbacks(obj) == 0 for obj in objs), "LVGL callbacks left after reset"
+    lib.mock_send(objs[0], LV_EVENT_CLICKED)
+    assert stats(lib).received == 1, "event seen after reset"
+
+    # All slots are free, and an event schedules a dispatch again
+    for obj in objs:
+        assert register(lib, obj, "clicked", 11) == 1
+    lib.mock_send(objs[1], LV_EVENT_CLICKED)
+    assert lib.mock_sched_pending() == 1, "no dispatch scheduled after reset"
+    lib.mock_sched_run()
+    assert calls(lib) == [(11, 1, "clicked")]
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_coalesce, test_scheduler_full, test_queue_full, test_slots, test_deleted,
+                 test_callback_raises, test_soft_reset):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
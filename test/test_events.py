@@ -0,0 +1,43 @@
+# Event bridge: callbacks run once per frame, high-rate events are coalesced
+# Run on the device after boot: import test_events
+# Press and drag on the button for a few seconds, then release.
+
+import time
+import lvml
+
+DURATION_MS = 5000
+
+seen = {"pressing": 0, "clicked": 0, "frames": 0}
+
+def on_event(widget, event):
+    seen[event] += 1
+    if event == "clicked":
+        widget.text = "clicked %d" % seen["clicked"]
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+
+    button = lvml.button(60, 80, 200, 80, "press me", "#0066CC", "#FFFFFF")
+    button.on("pressing", on_event)
+    button.on("clicked", on_event)
+    lvml.event_stats(True)
+
+    start = time.ticks_ms()
+    while time.ticks_diff(time.ticks_ms(), start) < DURATION_MS:
+        lvml.tick()
+        seen["frames"] += 1
+        time.sleep_ms(5)
+
+    stats = lvml.event_stats()
+    print(seen)
+    print(stats)
+    # At most one 'pressing' callback per frame, however many LVGL sent
+    print("pressing callbacks <= frames:", seen["pressing"] <= seen["frames"])
+    print("received = dispatched + coalesced + dropped:",
+          stats["received"] == stats["dispatched"] + stats["coalesced"] + stats["dropped"])
+
+    print("removed:", button.off())
+    button.delete()
+
+run()
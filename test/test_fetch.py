@@ -0,0 +1,42 @@
+# Test lvml.load_from_url() caching against test/http_cache_server.py
+# On the host:   python3 test/http_cache_server.py
+# On the device: set SERVER below, connect WiFi, then: import test_fetch
+
+import time
+import lvml
+
+SERVER = "http://192.168.1.100:8000"
+URL = SERVER + "/wifi_settings.xml"
+
+def wait_revalidation(timeout_ms=5000):
+    before = lvml.fetch_stats()["revalidations"]
+    start = time.ticks_ms()
+    while lvml.fetch_stats()["revalidations"] == before:
+        if time.ticks_diff(time.ticks_ms(), start) > timeout_ms:
+            return False
+        lvml.tick()
+        time.sleep_ms(10)
+    return True
+
+def timed_load():
+    start = time.ticks_us()
+    from_cache = lvml.load_from_url(URL)
+    return from_cache, time.ticks_diff(time.ticks_us(), start)
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+
+    # First load downloads (or uses a cache left by an earlier run)
+    print("load 1: from_cache=%s %d us" % timed_load())
+    wait_revalidation()
+
+    # Second load is served from the cache and revalidated with a 304
+    print("load 2: from_cache=%s %d us" % timed_load())
+    print("revalidated:", wait_revalidation())
+
+    stats = lvml.fetch_stats()
+    print(stats)
+    print("PASS" if stats["cache_hits"] >= 1 and stats["not_modified"] >= 1 else "FAIL")
+
+run()
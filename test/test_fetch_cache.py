@@ -0,0 +1,214 @@
+# Host test for the cached fetcher (lvml/network/lvml_fetch.c)
+# Run on the host: python3 test/test_fetch_cache.py
+#
+# Builds the fetcher and the HTTP client as a shared library, with the
+# zlib-based uzlib stand-in in test/fetch_mock, and runs it against the
+# handler of test/http_cache_server.py on a local port; the default store
+# writes to a temporary directory. Checks that a miss is downloaded and
+# cached, that a hit doesn't touch the network, that revalidating
+# unchanged content gets a 304 and keeps the cache, that changed content
+# is reported by lvml_fetch_poll() and replaces the cache, gzip bodies and
+# error statuses.
+
+import ctypes
+import gzip
+import os
+import sys
+import tempfile
+import threading
+import time
+from http.server import ThreadingHTTPServer
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import host_build  # noqa: E402
+import http_cache_server  # noqa: E402
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+MOCK = os.path.join(ROOT, "test", "fetch_mock")
+SOURCES = [os.path.join(ROOT, "lvml", "network", name) for name in ("lvml_fetch.c", "lvml_http_client.c")]
+LVML_OK, LVML_ERROR_NETWORK = 0, -3
+FETCH_UPDATED = 0
+POLL_TIMEOUT_S = 5
+
+EVENT_CB = ctypes.CFUNCTYPE(ctypes.c_bool, ctypes.c_int, ctypes.c_char_p, ctypes.c_char_p,
+                            ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t, ctypes.c_void_p)
+
+
+class Result(ctypes.Structure):
+    _fields_ = [("data", ctypes.POINTER(ctypes.c_uint8)), ("len", ctypes.c_size_t), ("from_cache", ctypes.c_bool),
+                ("prefetched", ctypes.c_bool), ("revalidating", ctypes.c_bool)]
+
+
+class Stats(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint32) for name in
+                ("requests", "cache_hits", "cache_misses", "revalidations", "not_modified", "updated", "errors",
+                 "prefetch_queued", "prefetch_done", "prefetch_hits", "prefetch_dropped", "prefetch_bytes",
+                 "bytes_received", "bytes_decoded", "bytes_saved")]
+
+
+class Handler(http_cache_server.CacheHandler):
+    def report(self, status, body_bytes, wire_bytes):
+        self.server.statuses.append(status)
+
+
+def start_server(root):
+    server = ThreadingHTTPServer(("127.0.0.1", 0), Handler)
+    server.daemon_threads = True
+    server.root = root
+    server.gzip = True
+    server.latency = 0
+    server.statuses = []
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server, "http://127.0.0.1:%d" % server.server_address[1]
+
+
+def build():
+    lib = host_build.build("lvml_fetch", SOURCES, [MOCK], ["-lz", "-lpthread"])
+    lib.lvml_fetch_get.argtypes = [ctypes.c_char_p, ctypes.c_bool, ctypes.POINTER(Result)]
+    lib.lvml_fetch_poll.argtypes = [EVENT_CB, ctypes.c_void_p]
+    lib.lvml_fetch_poll.restype = ctypes.c_uint32
+    return lib
+
+
+def write(root, name, data):
+    with open(os.path.join(root, name), "wb") as f:
+        f.write(data)
+
+
+def get(lib, url, revalidate=False):
+    result = Result()
+    res = lib.lvml_fetch_get(url.encode(), revalidate, ctypes.byref(result))
+    data = ctypes.string_at(result.data, result.len) if res == LVML_OK else None
+    lib.lvml_fetch_free(ctypes.byref(result))
+    return res, data, result
+
+
+def stats(lib):
+    s = Stats()
+    lib.lvml_fetch_get_stats(ctypes.byref(s))
+    return s
+
+
+def poll_revalidation(lib, count):
+    """Poll until `count` revalidations have completed; returns the UPDATED events"""
+    events = []
+
+    def on_event(event, url, ref, data, length, user_data):
+        events.append((event, url.decode(), ctypes.string_at(data, length)))
+        return False
+
+    cb = EVENT_CB(on_event)
+    deadline = time.time() + POLL_TIMEOUT_S
+    while stats(lib).revalidations < count:
+        assert time.time() < deadline, "revalidation didn't finish"
+        lib.lvml_fetch_poll(cb, None)
+        time.sleep(0.01)
+    return events
+
+
+def test_miss_then_hit(lib, server, base, root):
+    body = b"<screen><label text='one'/></screen>"
+    write(root, "hit.xml", body)
+    before = stats(lib)
+    res, data, result = get(lib, base + "/hit.xml")
+    assert res == LVML_OK and data == body
+    assert not result.from_cache
+    assert stats(lib).cache_misses == before.cache_misses + 1
+
+    requests = len(server.statuses)
+    res, data, result = get(lib, base + "/hit.xml")
+    assert res == LVML_OK and data == body
+    assert result.from_cache and not result.revalidating
+    assert len(server.statuses) == requests, "a cache hit went to the network"
+    assert stats(lib).cache_hits == before.cache_hits + 1
+
+
+def test_not_modified(lib, server, base, root):
+    body = b"<screen><label text='same'/></screen>" * 20
+    write(root, "same.xml", body)
+    assert get(lib, base + "/same.xml")[0] == LVML_OK
+    before = stats(lib)
+
+    res, data, result = get(lib, base + "/same.xml", revalidate=True)
+    assert res == LVML_OK and data == body
+    assert result.from_cache and result.revalidating
+    events = poll_revalidation(lib, before.revalidations + 1)
+    assert events == [], events
+    assert server.statuses[-1] == 304, server.statuses
+    after = stats(lib)
+    assert after.not_modified == before.not_modified + 1
+    assert after.updated == before.updated
+    assert after.bytes_saved == before.bytes_saved + len(body)
+
+    # The cache still answers, with the same content
+    res, data, result = get(lib, base + "/same.xml")
+    assert res == LVML_OK and data == body and result.from_cache
+
+
+def test_updated(lib, server, base, root):
+    old = b"<screen><label text='old'/></screen>"
+    new = b"<screen><label text='new'/><label text='more'/></screen>"
+    write(root, "change.xml", old)
+    assert get(lib, base + "/change.xml")[0] == LVML_OK
+    write(root, "change.xml", new)
+    before = stats(lib)
+
+    # Stale while revalidating: the old content comes back at once
+    res, data, result = get(lib, base + "/change.xml", revalidate=True)
+    assert res == LVML_OK and data == old and result.revalidating
+    events = poll_revalidation(lib, before.revalidations + 1)
+    assert events == [(FETCH_UPDATED, base + "/change.xml", new)], events
+    assert server.statuses[-1] == 200
+    assert stats(lib).updated == before.updated + 1
+
+    requests = len(server.statuses)
+    res, data, result = get(lib, base + "/change.xml")
+    assert res == LVML_OK and data == new and result.from_cache
+    assert len(server.statuses) == requests
+
+    # The new validators are used: revalidating again is a 304
+    get(lib, base + "/change.xml", revalidate=True)
+    poll_revalidation(lib, before.revalidations + 2)
+    assert server.statuses[-1] == 304, server.statuses
+
+
+def test_gzip(lib, server, base, root):
+    body = b"<screen>" + b"<label text='row'/>" * 200 + b"</screen>"
+    write(root, "big.xml", body)
+    before = stats(lib)
+    res, data, result = get(lib, base + "/big.xml")
+    assert res == LVML_OK and data == body
+    after = stats(lib)
+    received = after.bytes_received - before.bytes_received
+    assert received == len(gzip.compress(body)), received
+    assert after.bytes_decoded - before.bytes_decoded == len(body)
+    assert after.bytes_saved - before.bytes_saved == len(body) - received
+
+
+def test_not_found(lib, server, base, root):
+    before = stats(lib)
+    res, data, result = get(lib, base + "/missing.xml")
+    assert res == LVML_ERROR_NETWORK, res
+    assert stats(lib).errors == before.errors + 1
+
+
+def main():
+    lib = build()
+    root = tempfile.mkdtemp()
+    # The default store writes below the working directory
+    os.chdir(tempfile.mkdtemp())
+    server, base = start_server(root)
+    failed = 0
+    for test in (test_miss_then_hit, test_not_modified, test_updated, test_gzip, test_not_found):
+        try:
+            test(lib, server, base, root)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    server.shutdown()
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,131 @@
+# Host test for the gesture recognizer (lvml/utils/lvml_gesture.c)
+# Run on the host: python3 test/test_gestures.py [trace ...]
+#
+# Builds the recognizer as a shared library with the host C compiler and
+# replays the recorded touch traces in test/gesture_traces. A trace has one
+# frame per line, "time_ms id x y [id x y ...]", and an empty contact list
+# when all fingers are up. "# expect:" lists the events it must produce in
+# order: a name for a single event, "name+" for a run of continuous events
+# (pinch+ grows, rotate+ turns clockwise, pan+ moves down), "swipe:left"
+# for a swipe direction.
+
+import ctypes
+import glob
+import os
+import sys
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCE = os.path.join(ROOT, "lvml", "utils", "lvml_gesture.c")
+MAX_CONTACTS = 5
+MAX_EVENTS = 4
+NAMES = ["tap", "double_tap", "long_press", "swipe", "pinch", "rotate", "pan"]
+DIRS = {1: "left", 2: "right", 4: "top", 8: "bottom"}
+
+
+class Contact(ctypes.Structure):
+    _fields_ = [("id", ctypes.c_uint8), ("x", ctypes.c_int32), ("y", ctypes.c_int32)]
+
+
+class Event(ctypes.Structure):
+    _fields_ = [("type", ctypes.c_uint8), ("fingers", ctypes.c_uint8), ("dir", ctypes.c_uint8),
+                ("time_ms", ctypes.c_uint32), ("x", ctypes.c_int32), ("y", ctypes.c_int32),
+                ("dx", ctypes.c_int32), ("dy", ctypes.c_int32), ("vx", ctypes.c_int32),
+                ("vy", ctypes.c_int32), ("scale", ctypes.c_int32), ("angle", ctypes.c_int32)]
+
+
+def build():
+    lib = host_build.build("lvml_gesture", [SOURCE])
+    lib.lvml_gesture_update.restype = ctypes.c_size_t
+    lib.lvml_gesture_update.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(Contact),
+                                        ctypes.c_uint8, ctypes.POINTER(Event)]
+    return lib
+
+
+def load(path):
+    expect = []
+    frames = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith("# expect:"):
+                expect = line[len("# expect:"):].split()
+            elif line and not line.startswith("#"):
+                values = [int(v) for v in line.split()]
+                frames.append((values[0], [tuple(values[i:i + 3]) for i in range(1, len(values), 3)]))
+    return expect, frames
+
+
+def replay(lib, frames):
+    state = ctypes.create_string_buffer(512)    # larger than lvml_gesture_t
+    lib.lvml_gesture_init(state, None)
+    contacts = (Contact * MAX_CONTACTS)()
+    events = (Event * MAX_EVENTS)()
+    produced = []
+    for time_ms, points in frames:
+        for i, (cid, x, y) in enumerate(points):
+            contacts[i] = Contact(cid, x, y)
+        n = lib.lvml_gesture_update(state, time_ms, contacts, len(points), events)
+        for i in range(n):
+            e = events[i]
+            produced.append({f: getattr(e, f) for f, _ in Event._fields_})
+    return produced
+
+
+def check(expect, produced):
+    i = 0
+    for item in expect:
+        name, _, direction = item.partition(":")
+        if name.endswith("+"):
+            name = name[:-1]
+            run = []
+            while i < len(produced) and NAMES[produced[i]["type"]] == name:
+                run.append(produced[i])
+                i += 1
+            if not run:
+                return "expected %s events" % name
+            last = run[-1]
+            if name == "pinch" and last["scale"] <= 65536:
+                return "pinch did not grow (scale %d)" % last["scale"]
+            if name == "rotate" and last["angle"] <= 0:
+                return "rotation not clockwise (angle %d)" % last["angle"]
+            if name == "pan" and last["dy"] <= 0:
+                return "pan did not move down (dy %d)" % last["dy"]
+            continue
+        # Continuous events of other kinds may come along with the expected ones
+        while i < len(produced) and NAMES[produced[i]["type"]] in ("pinch", "rotate", "pan") and name not in ("pinch", "rotate", "pan"):
+            i += 1
+        if i >= len(produced) or NAMES[produced[i]["type"]] != name:
+            return "expected %s at event %d" % (item, i)
+        if direction and DIRS.get(produced[i]["dir"]) != direction:
+            return "expected direction %s, got %s" % (direction, DIRS.get(produced[i]["dir"]))
+        i += 1
+    extra = [NAMES[e["type"]] for e in produced[i:] if NAMES[e["type"]] not in ("pinch", "rotate", "pan")]
+    if extra:
+        return "unexpected events %s" % extra
+    return None
+
+
+def main():
+    lib = build()
+    paths = sys.argv[1:] or sorted(glob.glob(os.path.join(ROOT, "test", "gesture_traces", "*.trace")))
+    failures = 0
+    for path in paths:
+        expect, frames = load(path)
+        produced = replay(lib, frames)
+        error = check(expect, produced)
+        summary = " ".join(NAMES[e["type"]] for e in produced)
+        if len(summary) > 60:
+            summary = summary[:57] + "..."
+        print("%-16s %-4s %s" % (os.path.basename(path), "ok" if error is None else "FAIL", error or summary))
+        if error is not None:
+            failures += 1
+            for e in produced:
+                print("    ", NAMES[e["type"]], e)
+    print("%d of %d traces passed" % (len(paths) - failures, len(paths)))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,217 @@
+# Host test for the GT911 driver (lvml/driver/GT911.c) on a mock I2C bus
+# Run on the host: python3 test/test_gt911.py
+#
+# Builds the driver against the stand-in ESP-IDF headers in test/gt911_mock,
+# whose i2c_master bus simulates a GT911 register file and logs every
+# transaction with its simulated bus time. Checks that a frame is one
+# combined status-and-points read at 400 kHz, that clearing the status
+# register is queued without waiting, also when all five contacts are down,
+# that bus errors are reported, and that initialization leaves its boot
+# stage marks, also from several threads.
+
+import ctypes
+import os
+import struct
+import sys
+import threading
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+MOCK = os.path.join(ROOT, "test", "gt911_mock")
+SOURCES = [os.path.join(ROOT, "lvml", "driver", "GT911.c"), os.path.join(ROOT, "lvml", "utils", "lvml_boot.c"),
+           os.path.join(MOCK, "mock_bus.c")]
+STATUS_REG = 0x814E
+MAX_CONTACTS = 5
+POINT_SIZE = 8
+FAST_MODE_HZ = 400000
+FRAME_BUDGET_US = 1200      # status + 5 points at 400 kHz is about 1.1 ms
+BOOT_MAX_MARKS = 32         # LVML_BOOT_MAX_MARKS
+
+
+class Point(ctypes.Structure):
+    _pack_ = 1
+    _fields_ = [("trackId", ctypes.c_uint8), ("x", ctypes.c_uint16), ("y", ctypes.c_uint16),
+                ("area", ctypes.c_uint16), ("reserved", ctypes.c_uint8)]
+
+
+class LogEntry(ctypes.Structure):
+    _fields_ = [("reg", ctypes.c_uint16), ("write_size", ctypes.c_uint16), ("read_size", ctypes.c_uint16),
+                ("start_us", ctypes.c_int64), ("end_us", ctypes.c_int64)]
+
+
+class BootMark(ctypes.Structure):
+    _fields_ = [("name", ctypes.c_char * 20), ("time_us", ctypes.c_int64)]
+
+
+def build():
+    lib = host_build.build("gt911_mock", SOURCES, [MOCK])
+    lib.mock_registers.restype = ctypes.POINTER(ctypes.c_uint8)
+    lib.mock_log_size.restype = ctypes.c_size_t
+    lib.mock_log_entry.restype = ctypes.POINTER(LogEntry)
+    lib.mock_pending.restype = ctypes.c_size_t
+    lib.mock_scl_hz.restype = ctypes.c_uint32
+    lib.mock_bus_exists.restype = ctypes.c_bool
+    lib.gt911_begin.restype = ctypes.c_bool
+    lib.lvml_boot_get_marks.restype = ctypes.c_void_p
+    lib.lvml_boot_dropped.restype = ctypes.c_uint32
+    lib.gt911_read_frame.restype = ctypes.c_int8
+    lib.gt911_read_frame.argtypes = [ctypes.POINTER(Point)]
+    return lib
+
+
+def begin(lib):
+    lib.mock_reset()
+    # int 3, rst 48, address 0x5D, port 0, sda 8, scl 18, as on the ESP32-S3-Box-3
+    assert lib.gt911_begin(3, 48, 0x5D, 0, 8, 18, FAST_MODE_HZ), "gt911_begin failed"
+    lib.mock_log_clear()
+
+
+def set_frame(lib, points):
+    regs = lib.mock_registers()
+    regs[STATUS_REG] = 0x80 | len(points)
+    for i, (track, x, y) in enumerate(points):
+        data = struct.pack("<BHHHB", track, x, y, 30, 0)
+        for j, b in enumerate(data):
+            regs[STATUS_REG + 1 + i * POINT_SIZE + j] = b
+
+
+def log(lib):
+    return [lib.mock_log_entry(i).contents for i in range(lib.mock_log_size())]
+
+
+def test_fast_mode(lib):
+    begin(lib)
+    assert lib.mock_scl_hz() == FAST_MODE_HZ, lib.mock_scl_hz()
+
+
+def test_one_transaction_per_frame(lib):
+    begin(lib)
+    set_frame(lib, [(1, 100, 50), (2, 200, 150)])
+    points = (Point * MAX_CONTACTS)()
+    assert lib.gt911_read_frame(points) == 2
+    assert [(p.trackId, p.x, p.y) for p in points[:2]] == [(1, 100, 50), (2, 200, 150)]
+
+    entries = log(lib)
+    assert len(entries) == 1, "frame took %d transactions" % len(entries)
+    read = entries[0]
+    assert (read.reg, read.write_size, read.read_size) == (STATUS_REG, 0, 1 + MAX_CONTACTS * POINT_SIZE)
+    bus_us = read.end_us - read.start_us
+    assert bus_us <= FRAME_BUDGET_US, "frame read took %d us" % bus_us
+    print("  frame read: %d us on the bus" % bus_us)
+
+
+def test_clear_is_queued(lib):
+    begin(lib)
+    set_frame(lib, [(1, 10, 20)])
+    points = (Point * MAX_CONTACTS)()
+    assert lib.gt911_read_frame(points) == 1
+    # Returned before the clear ran: it is still queued and the status still set
+    assert lib.mock_pending() == 1
+    assert lib.mock_registers()[STATUS_REG] == 0x81
+
+    # The next read queues behind the clear, so it sees no new frame
+    assert lib.gt911_read_frame(points) == -1
+    entries = log(lib)
+    assert [(e.reg, e.write_size, e.read_size) for e in entries[1:]] == [
+        (STATUS_REG, 1, 0), (STATUS_REG, 0, 1 + MAX_CONTACTS * POINT_SIZE)]
+    assert lib.mock_registers()[STATUS_REG] == 0
+    # No frame, nothing to clear
+    assert lib.mock_pending() == 0
+
+
+def test_all_contacts(lib):
+    begin(lib)
+    touches = [(i + 1, 10 + i * 60, 20 + i * 40) for i in range(MAX_CONTACTS)]
+    set_frame(lib, touches)
+    points = (Point * MAX_CONTACTS)()
+    assert lib.gt911_read_frame(points) == MAX_CONTACTS
+    assert [(p.trackId, p.x, p.y) for p in points] == touches
+    assert lib.mock_pending() == 1, "a full frame must clear the status register too"
+    assert lib.gt911_read_frame(points) == -1
+    assert lib.mock_registers()[STATUS_REG] == 0
+
+
+def test_release_frame(lib):
+    begin(lib)
+    set_frame(lib, [])
+    points = (Point * MAX_CONTACTS)()
+    assert lib.gt911_read_frame(points) == 0
+    assert lib.mock_pending() == 1
+
+
+def test_bus_error(lib):
+    begin(lib)
+    set_frame(lib, [(1, 10, 20)])
+    points = (Point * MAX_CONTACTS)()
+    lib.mock_nack(1)
+    assert lib.gt911_read_frame(points) == -1
+    assert lib.mock_pending() == 0, "nothing may be cleared after a failed read"
+    assert lib.gt911_read_frame(points) == 1
+
+
+def test_rotation(lib):
+    begin(lib)
+    lib.gt911_set_rotation(2)   # GT911_ROTATE_180
+    set_frame(lib, [(1, 100, 40)])
+    points = (Point * MAX_CONTACTS)()
+    assert lib.gt911_read_frame(points) == 1
+    assert (points[0].x, points[0].y) == (320 - 100, 240 - 40)
+    lib.gt911_set_rotation(0)
+
+
+def test_boot_marks(lib):
+    begin(lib)
+    count = ctypes.c_size_t()
+    marks = ctypes.cast(lib.lvml_boot_get_marks(ctypes.byref(count)), ctypes.POINTER(BootMark))
+    names = [marks[i].name.decode() for i in range(count.value)]
+    assert names[-3:] == ["gt911_bus", "gt911_reset", "gt911_probe"], names
+    times = [marks[i].time_us for i in range(count.value)]
+    assert times == sorted(times)
+
+
+def test_boot_marks_threads(lib):
+    # Marks from several threads at once, past the end of the table
+    count = ctypes.c_size_t()
+    lib.lvml_boot_get_marks(ctypes.byref(count))
+    before, dropped = count.value, lib.lvml_boot_dropped()
+    threads = [threading.Thread(target=lambda: [lib.lvml_boot_mark(b"thread") for _ in range(20)])
+               for _ in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    marks = ctypes.cast(lib.lvml_boot_get_marks(ctypes.byref(count)), ctypes.POINTER(BootMark))
+    assert count.value == BOOT_MAX_MARKS
+    assert all(marks[i].name == b"thread" for i in range(before, count.value))
+    assert lib.lvml_boot_dropped() - dropped == 80 - (BOOT_MAX_MARKS - before)
+
+
+def test_deinit(lib):
+    begin(lib)
+    set_frame(lib, [(1, 10, 20)])
+    points = (Point * MAX_CONTACTS)()
+    lib.gt911_read_frame(points)
+    lib.gt911_deinit()
+    assert lib.mock_pending() == 0, "queued clear must finish before the device is removed"
+    assert not lib.mock_bus_exists()
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_fast_mode, test_one_transaction_per_frame, test_clear_is_queued, test_all_contacts,
+                 test_release_frame, test_bus_error, test_rotation, test_boot_marks, test_deinit, test_boot_marks_threads):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+        if lib.mock_bus_exists():
+            lib.gt911_deinit()
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,189 @@
+# Host test for input recordings (lvml/utils/lvml_record.c)
+# Run on the host: python3 test/test_input_replay.py
+#
+# Builds the recorder, the player and the gesture recognizer as a shared
+# library with the host C compiler. Records the touch traces in
+# test/gesture_traces the way the device records its input read callback,
+# replays them at several speeds on a simulated clock and checks that the
+# replayed states arrive on time and produce the same gestures as the
+# original frames.
+
+import ctypes
+import glob
+import os
+import sys
+
+import host_build
+from test_gestures import Contact, Event, MAX_CONTACTS, MAX_EVENTS, NAMES, load
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCES = [os.path.join(ROOT, "lvml", "utils", "lvml_record.c"), os.path.join(ROOT, "lvml", "utils", "lvml_gesture.c")]
+HEADER_SIZE = 12
+STEP = 0
+
+
+class Record(ctypes.Structure):
+    _fields_ = [("time_ms", ctypes.c_uint32), ("pressed", ctypes.c_bool), ("x", ctypes.c_int32),
+                ("y", ctypes.c_int32), ("count", ctypes.c_uint8), ("contacts", Contact * MAX_CONTACTS)]
+
+
+class Recorder(ctypes.Structure):
+    _fields_ = [("data", ctypes.POINTER(ctypes.c_uint8)), ("len", ctypes.c_size_t), ("cap", ctypes.c_size_t),
+                ("records", ctypes.c_uint32), ("skipped", ctypes.c_uint32), ("start_ms", ctypes.c_uint32),
+                ("last", Record)]
+
+
+class Player(ctypes.Structure):
+    _fields_ = [("data", ctypes.c_void_p), ("len", ctypes.c_size_t), ("pos", ctypes.c_size_t),
+                ("width", ctypes.c_uint16), ("height", ctypes.c_uint16), ("speed_pct", ctypes.c_uint16),
+                ("started", ctypes.c_bool), ("has_next", ctypes.c_bool), ("error", ctypes.c_bool),
+                ("start_ms", ctypes.c_uint32), ("played", ctypes.c_uint32), ("next", Record)]
+
+
+def build():
+    lib = host_build.build("lvml_record", SOURCES)
+    lib.lvml_recorder_add.argtypes = [ctypes.POINTER(Recorder), ctypes.POINTER(Record)]
+    lib.lvml_player_open.argtypes = [ctypes.POINTER(Player), ctypes.c_char_p, ctypes.c_size_t, ctypes.c_uint16]
+    lib.lvml_player_poll.argtypes = [ctypes.POINTER(Player), ctypes.c_uint32, ctypes.POINTER(Record)]
+    lib.lvml_player_poll.restype = ctypes.c_bool
+    lib.lvml_player_due.restype = ctypes.c_bool
+    lib.lvml_player_done.restype = ctypes.c_bool
+    lib.lvml_gesture_update.restype = ctypes.c_size_t
+    lib.lvml_gesture_update.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(Contact),
+                                        ctypes.c_uint8, ctypes.POINTER(Event)]
+    return lib
+
+
+def states(frames, base_ms=5000):
+    # What the read callback returns: the pointer follows the first finger and
+    # stays where it was on release. base_ms stands in for the device clock.
+    x = y = 0
+    out = []
+    for time_ms, points in frames:
+        if points:
+            x, y = points[0][1], points[0][2]
+        out.append((base_ms + time_ms, bool(points), x, y, points))
+    return out
+
+
+def record(lib, frames, repeat=1):
+    rec = Recorder()
+    assert lib.lvml_recorder_init(ctypes.byref(rec), 320, 240) == 0
+    for time_ms, pressed, x, y, points in states(frames):
+        r = Record(time_ms, pressed, x, y, len(points))
+        for i, (cid, px, py) in enumerate(points):
+            r.contacts[i] = Contact(cid, px, py)
+        # LVGL reads more often than the controller reports; released repeats are skipped
+        for _ in range(repeat):
+            assert lib.lvml_recorder_add(ctypes.byref(rec), ctypes.byref(r)) == 0
+    data = ctypes.string_at(rec.data, rec.len)
+    stats = (rec.records, rec.skipped)
+    lib.lvml_recorder_free(ctypes.byref(rec))
+    return data, stats
+
+
+def play(lib, data, speed_pct, start_ms=100000, step_ms=1):
+    # Poll like LVGL's read timer, draining due records as continue_reading does
+    player = Player()
+    assert lib.lvml_player_open(ctypes.byref(player), data, len(data), speed_pct) == 0
+    played = []
+    now = start_ms
+    r = Record()
+    while not lib.lvml_player_done(ctypes.byref(player)):
+        while lib.lvml_player_poll(ctypes.byref(player), now, ctypes.byref(r)):
+            played.append((now - start_ms, r.time_ms, r.pressed, r.x, r.y,
+                           [(c.id, c.x, c.y) for c in r.contacts[:r.count]]))
+            if speed_pct == STEP:
+                break
+        now += step_ms
+    return played, player.error
+
+
+def gestures(lib, frames):
+    state = ctypes.create_string_buffer(512)
+    lib.lvml_gesture_init(state, None)
+    contacts = (Contact * MAX_CONTACTS)()
+    events = (Event * MAX_EVENTS)()
+    produced = []
+    for time_ms, points in frames:
+        for i, p in enumerate(points):
+            contacts[i] = Contact(*p)
+        n = lib.lvml_gesture_update(state, time_ms, contacts, len(points), events)
+        produced += [(NAMES[events[i].type], events[i].x, events[i].y, events[i].dx, events[i].dy,
+                      events[i].scale, events[i].angle) for i in range(n)]
+    return produced
+
+
+def traces():
+    return sorted(glob.glob(os.path.join(ROOT, "test", "gesture_traces", "*.trace")))
+
+
+def test_round_trip(lib):
+    for path in traces():
+        _, frames = load(path)
+        data, (records, skipped) = record(lib, frames, repeat=3)
+        assert data[:4] == b"LVIR" and data[6:10] == bytes([64, 1, 240, 0]), data[:12]
+        played, error = play(lib, data, STEP)
+        assert not error
+        # Every pressed read is kept, a release only if it changed something
+        expected = []
+        for t, pressed, x, y, pts in states(frames):
+            state = (t - states(frames)[0][0], pressed, x, y, pts)
+            if pressed:
+                expected += [state] * 3
+            elif not expected or expected[-1][1:] != state[1:]:
+                expected.append(state)
+        got = [(t, p, x, y, pts) for _, t, p, x, y, pts in played]
+        assert got == expected, path
+        assert records == len(expected) and records + skipped == 3 * len(frames), (path, records, skipped)
+    print("  %d traces, e.g. %s: %d frames in %d bytes" % (len(traces()), os.path.basename(path),
+                                                         len(frames), len(data) - HEADER_SIZE))
+
+
+def test_timing(lib):
+    _, frames = load(os.path.join(ROOT, "test", "gesture_traces", "slow_drag.trace"))
+    data, _ = record(lib, frames)
+    for speed_pct in (100, 400, 25):
+        played, _ = play(lib, data, speed_pct)
+        for at_ms, time_ms, *_ in played:
+            due = time_ms * 100 / speed_pct
+            assert due <= at_ms < due + 1, (speed_pct, at_ms, time_ms)
+    played, _ = play(lib, data, STEP, step_ms=1000)
+    assert [at for at, *_ in played] == [1000 * i for i in range(len(played))]
+
+
+def test_same_gestures(lib):
+    for path in traces():
+        _, frames = load(path)
+        data, _ = record(lib, frames)
+        original = gestures(lib, frames)
+        for speed_pct in (100, 800, STEP):
+            played, _ = play(lib, data, speed_pct)
+            replayed = gestures(lib, [(t, pts) for _, t, _, _, _, pts in played])
+            assert replayed == original, (path, speed_pct)
+
+
+def test_corrupt(lib):
+    _, frames = load(os.path.join(ROOT, "test", "gesture_traces", "pinch_out.trace"))
+    data, _ = record(lib, frames)
+    player = Player()
+    assert lib.lvml_player_open(ctypes.byref(player), b"LVMB" + data[4:], len(data), 100) != 0
+    played, error = play(lib, data[:-3], STEP)
+    assert error and len(played) < len(frames)
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_round_trip, test_timing, test_same_gestures, test_corrupt):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
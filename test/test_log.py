@@ -0,0 +1,140 @@
+# Host test for the deferred log ring (lvml/utils/lvml_log.c)
+# Run on the host: python3 test/test_log.py
+#
+# Builds the ring as a shared library with the host C compiler, then checks
+# ordering, formatting at drain time, per-module levels, dropping when full,
+# and several threads logging while the ring is drained.
+
+import ctypes
+import os
+import re
+import sys
+import threading
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCE = os.path.join(ROOT, "lvml", "utils", "lvml_log.c")
+SLOTS = 128
+MOD_TOUCH, MOD_LVGL = 2, 3
+TRACE, DEBUG, INFO, WARN, ERROR = range(5)
+
+# Format strings must outlive their records, like the literals on the device
+FMT_VALUE = ctypes.c_char_p(b"value %d")
+FMT_THREAD = ctypes.c_char_p(b"t%d n%d")
+
+WRITE_CB = ctypes.CFUNCTYPE(None, ctypes.c_char_p, ctypes.c_size_t, ctypes.c_void_p)
+
+
+class Stats(ctypes.Structure):
+    _fields_ = [("written", ctypes.c_uint32), ("dropped", ctypes.c_uint32),
+                ("drained", ctypes.c_uint32), ("pending", ctypes.c_uint32)]
+
+
+def build():
+    lib = host_build.build("lvml_log", [SOURCE])
+    lib.lvml_log_fmt.argtypes = [ctypes.c_uint8, ctypes.c_uint8, ctypes.c_char_p, ctypes.c_uint8,
+                                 ctypes.POINTER(ctypes.c_int32)]
+    lib.lvml_log_text.argtypes = [ctypes.c_uint8, ctypes.c_uint8, ctypes.c_char_p, ctypes.c_size_t]
+    lib.lvml_log_drain.argtypes = [WRITE_CB, ctypes.c_void_p, ctypes.c_uint32]
+    lib.lvml_log_drain.restype = ctypes.c_uint32
+    lib.lvml_log_find_level.argtypes = [ctypes.c_char_p]
+    return lib
+
+
+def log(lib, fmt, *args):
+    values = (ctypes.c_int32 * max(len(args), 1))(*args)
+    lib.lvml_log_fmt(MOD_TOUCH, INFO, fmt, len(args), values)
+
+
+def drain(lib, max_records=0):
+    lines = []
+    cb = WRITE_CB(lambda line, n, user: lines.append(line[:n].decode()))
+    lib.lvml_log_drain(cb, None, max_records)
+    return [re.sub(r"^\[\s*\d+\.\d{3} ", "[", line) for line in lines]
+
+
+def stats(lib, reset=False):
+    s = Stats()
+    lib.lvml_log_get_stats(ctypes.byref(s), reset)
+    return s
+
+
+def test_order_and_format(lib):
+    for i in range(5):
+        log(lib, FMT_VALUE, i)
+    text = b"[Warn] lv_obj_create: something long enough to span several ring slots\n"
+    lib.lvml_log_text(MOD_LVGL, WARN, text, len(text))
+    lines = drain(lib)
+    assert lines[:5] == ["[touch info] value %d" % i for i in range(5)], lines
+    assert lines[5] == "[lvgl warn] " + text.decode().rstrip("\n"), lines[5]
+    assert drain(lib) == []
+
+
+def test_levels(lib):
+    assert lib.lvml_log_find_level(b"warn") == WARN
+    assert lib.lvml_log_find_level(b"loud") == -1
+    lib.lvml_log_set_level(MOD_TOUCH, WARN)
+    assert lib.lvml_log_get_level(MOD_TOUCH) == WARN
+    lib.lvml_log_set_level(MOD_TOUCH, INFO)
+
+
+def test_drop_when_full(lib):
+    stats(lib, True)
+    for i in range(SLOTS + 10):
+        log(lib, FMT_VALUE, i)
+    s = stats(lib)
+    assert s.written + s.dropped == SLOTS + 10 and s.dropped > 0, (s.written, s.dropped)
+    lines = drain(lib)
+    assert len(lines) == s.written
+    assert lines[0] == "[touch info] value 0" and lines[-1] == "[touch info] value %d" % (s.written - 1)
+    # The ring wraps cleanly after being full
+    log(lib, FMT_VALUE, 42)
+    assert drain(lib) == ["[touch info] value 42"]
+
+
+def test_threads(lib):
+    stats(lib, True)
+    threads_n, per_thread = 4, 3000
+    lines = []
+
+    def producer(t):
+        for n in range(per_thread):
+            log(lib, FMT_THREAD, t, n)
+
+    workers = [threading.Thread(target=producer, args=(t,)) for t in range(threads_n)]
+    for w in workers:
+        w.start()
+    while any(w.is_alive() for w in workers):
+        lines += drain(lib, 16)
+    for w in workers:
+        w.join()
+    lines += drain(lib)
+
+    # Every record comes out once, and each thread's records in order
+    last = [-1] * threads_n
+    for line in lines:
+        t, n = (int(v) for v in re.findall(r"\d+", line.split("] ")[1]))
+        assert n > last[t], line
+        last[t] = n
+    s = stats(lib)
+    assert s.written == len(lines) and s.pending == 0, (s.written, len(lines))
+    assert s.written + s.dropped == threads_n * per_thread
+    print("  threads: %d written, %d dropped" % (s.written, s.dropped))
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_order_and_format, test_levels, test_drop_when_full, test_threads):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
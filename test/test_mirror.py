@@ -0,0 +1,406 @@
+# Host test for screen mirroring (lvml/network/lvml_mirror.c)
+# Run on the host: python3 test/test_mirror.py
+#
+# Builds the mirror with the QOI and splash encoders as a shared library;
+# the mirror task runs as a thread on POSIX sockets. The test plays the
+# display driver: it draws into a model frame and flushes the changed areas
+# in render bands, big-endian like the panel gets them, while a local viewer
+# decodes the stream and rebuilds the screen. Checks the viewer ends up with
+# the model's pixels for both codecs, that the frame rate is capped and
+# refreshes merge, that a viewer which stops reading never slows down the
+# flush, that the dirty list stays short, resize and reconnects. Prints
+# bytes per frame, the compression ratio and the cost of a flush.
+
+import array
+import ctypes
+import os
+import random
+import socket
+import struct
+import sys
+import threading
+import time
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import host_build  # noqa: E402
+from compare_screenshots import decode_qoi  # noqa: E402
+
+SOURCES = [os.path.join(ROOT, "lvml", name) for name in
+           ("network/lvml_mirror.c", "utils/lvml_qoi.c", "utils/lvml_splash.c")]
+LVML_OK, LVML_ERROR_INIT, LVML_ERROR_INVALID_PARAM = 0, -1, -6
+RLE, QOI = 0, 1
+RECTS = 8                   # LVML_MIRROR_RECTS
+WIDTH, HEIGHT = 320, 240
+BAND_PIXELS = WIDTH * 24    # Render buffer of the display
+
+
+class Stats(ctypes.Structure):
+    _fields_ = [("connected", ctypes.c_bool)] + [(name, ctypes.c_uint32) for name in
+                ("connects", "disconnects", "flushes", "flush_max_us", "display_frames", "frames", "merged",
+                 "rects", "overflows", "pixels", "bytes", "encode_us")]
+
+
+def build():
+    lib = host_build.build("lvml_mirror", SOURCES, libs=["-lpthread"])
+    lib.lvml_mirror_start.argtypes = [ctypes.c_char_p, ctypes.c_uint16, ctypes.c_int, ctypes.c_uint32]
+    lib.lvml_mirror_resize.argtypes = [ctypes.c_uint32, ctypes.c_uint32]
+    lib.lvml_mirror_flush.argtypes = [ctypes.c_int32] * 4 + [ctypes.c_char_p, ctypes.c_size_t, ctypes.c_bool]
+    lib.lvml_mirror_get_stats.argtypes = [ctypes.POINTER(Stats), ctypes.c_bool]
+    return lib
+
+
+def stats(lib, reset=False):
+    s = Stats()
+    lib.lvml_mirror_get_stats(ctypes.byref(s), reset)
+    return s
+
+
+def wait_for(cond, timeout=10):
+    deadline = time.time() + timeout
+    while not cond():
+        assert time.time() < deadline, "timed out"
+        time.sleep(0.01)
+
+
+# Viewer
+
+def decode_rle(data):
+    assert data[:4] == b"LVSP", data[:4]
+    _, flags, width, height = struct.unpack_from("<BBHH", data, 4)
+    assert flags & 1
+    pixels = []
+    pos = 12
+    while len(pixels) < width * height:
+        c = data[pos]
+        pos += 1
+        if c & 0x80:
+            pixels.extend([(data[pos] << 8) | data[pos + 1]] * ((c & 0x7F) + 1))
+            pos += 2
+        else:
+            pixels.extend(struct.unpack_from(">%dH" % (c + 1), data, pos))
+            pos += 2 * (c + 1)
+    assert pos == len(data)
+    return width, height, pixels
+
+
+def decode(codec, data):
+    if codec == RLE:
+        return decode_rle(data)
+    width, height, rgb = decode_qoi(data)
+    return width, height, [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in rgb]
+
+
+class Viewer:
+    # Listens for the device and rebuilds its screen; accepts `connections` in turn
+
+    def __init__(self, connections=1):
+        self.sock = socket.socket()
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        # Small buffers, so a viewer that stops reading pushes back quickly
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 16384)
+        self.sock.bind(("127.0.0.1", 0))
+        self.sock.listen(2)
+        self.port = self.sock.getsockname()[1]
+        self.connections = connections
+        self.reading = threading.Event()
+        self.reading.set()
+        self.close_after = None      # Frames after which the first connection is dropped
+        self.hellos = []
+        self.sizes = []
+        self.frames = []             # (number, refreshes covered, rects, bytes)
+        self.bytes = 0
+        self.size = (0, 0)
+        self.fb = []
+        self.lock = threading.Lock()
+        threading.Thread(target=self.run, daemon=True).start()
+
+    def run(self):
+        for n in range(self.connections):
+            try:
+                conn, _ = self.sock.accept()
+            except OSError:
+                return
+            try:
+                self.serve(conn.makefile("rb"), n)
+            except (OSError, EOFError):
+                pass
+            conn.close()
+
+    def read(self, f, n):
+        data = f.read(n)
+        if len(data) != n:
+            raise EOFError
+        self.bytes += n
+        return data
+
+    def varint(self, f):
+        value, shift = 0, 0
+        while True:
+            b = self.read(f, 1)[0]
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return value
+
+    def serve(self, f, n):
+        self.hellos.append(f.read(5))
+        codec = self.hellos[-1][4]
+        rects = 0
+        frame_start = self.bytes
+        while True:
+            self.reading.wait()
+            msg = self.read(f, 1)[0]
+            if msg == 0:
+                size = (self.varint(f), self.varint(f))
+                with self.lock:
+                    self.size = size
+                    self.fb = [0] * (size[0] * size[1])
+                    self.sizes.append(size)
+            elif msg == 1:
+                x, y, w, h = (self.varint(f) for _ in range(4))
+                payload = b""
+                while True:
+                    length = self.varint(f)
+                    if length == 0:
+                        break
+                    payload += self.read(f, length)
+                width, height, pixels = decode(codec, payload)
+                assert (width, height) == (w, h)
+                with self.lock:
+                    for row in range(h):
+                        start = (y + row) * self.size[0] + x
+                        self.fb[start:start + w] = pixels[row * w:(row + 1) * w]
+                rects += 1
+            elif msg == 2:
+                number, covered = self.varint(f), self.varint(f)
+                with self.lock:
+                    self.frames.append((number, covered, rects, self.bytes - frame_start))
+                rects = 0
+                frame_start = self.bytes
+                if n == 0 and self.close_after is not None and len(self.frames) >= self.close_after:
+                    return
+            else:
+                raise AssertionError("bad message %d" % msg)
+
+    def matches(self, screen):
+        with self.lock:
+            return self.size == (screen.width, screen.height) and self.fb == list(screen.pixels)
+
+    def close(self):
+        self.sock.close()
+
+
+# Device
+
+class Screen:
+    # The model frame and a display driver that flushes in render bands
+
+    def __init__(self, lib, width=WIDTH, height=HEIGHT):
+        self.lib = lib
+        self.width = width
+        self.height = height
+        self.pixels = array.array("H", [0] * (width * height))
+        self.flush_max_s = 0.0
+
+    def draw(self, x, y, w, h, kind, seed):
+        rnd = random.Random(seed)
+        color = rnd.randrange(0x10000)
+        for row in range(h):
+            if kind == "fill":
+                line = [color] * w
+            elif kind == "gradient":
+                line = [((((x + i) * 31 // self.width) << 11) | (((y + row) * 63 // self.height) << 5) |
+                         (seed & 31)) for i in range(w)]
+            elif kind == "text":      # Short runs of two colors, like glyphs
+                line = [color if (i * 7 + row * 3 + seed) % 5 < 2 else 0xFFFF for i in range(w)]
+            else:
+                line = array.array("H", rnd.randbytes(2 * w))
+            start = (y + row) * self.width + x
+            self.pixels[start:start + w] = array.array("H", line)
+
+    def flush(self, x, y, w, h, last=True):
+        rows = max(1, BAND_PIXELS // w)
+        for y1 in range(y, y + h, rows):
+            y2 = min(y + h, y1 + rows) - 1
+            band = array.array("H")
+            for row in range(y1, y2 + 1):
+                band.extend(self.pixels[row * self.width + x:row * self.width + x + w])
+            if sys.byteorder == "little":
+                band.byteswap()
+            data = band.tobytes()
+            start = time.perf_counter()
+            self.lib.lvml_mirror_flush(x, y1, x + w - 1, y2, data, len(data), last and y2 == y + h - 1)
+            self.flush_max_s = max(self.flush_max_s, time.perf_counter() - start)
+
+    def refresh(self, x, y, w, h, kind, seed, last=True):
+        self.draw(x, y, w, h, kind, seed)
+        self.flush(x, y, w, h, last)
+
+    def full(self, kind="gradient", seed=0):
+        self.refresh(0, 0, self.width, self.height, kind, seed)
+
+
+def start(lib, viewer, codec=RLE, fps=30):
+    stats(lib, reset=True)
+    assert lib.lvml_mirror_start(b"127.0.0.1", viewer.port, codec, fps) == LVML_OK
+    wait_for(lambda: viewer.hellos)
+
+
+def stop(lib, viewer):
+    lib.lvml_mirror_stop()
+    wait_for(lambda: not stats(lib).connected)
+    viewer.close()
+
+
+def ui_frames(screen, count, rnd):
+    # A status bar clock, a button changing color, a list scrolling text
+    for i in range(count):
+        if i % 3 == 0:
+            screen.refresh(20, 60 + rnd.randrange(3) * 50, 120, 40, "fill", rnd.randrange(1000), False)
+        if i % 5 == 0:
+            screen.refresh(160, 40, 150, 190, "text", i * 13, False)
+        screen.refresh(250, 4, 60, 16, "text", i)
+        time.sleep(1 / 60)
+
+
+# Tests
+
+def test_params(lib):
+    assert lib.lvml_mirror_start(b"127.0.0.1", 1, RLE, 10) == LVML_ERROR_INIT    # no screen size yet
+    lib.lvml_mirror_resize(WIDTH, HEIGHT)
+    for host, port, codec, fps in ((b"", 1, RLE, 10), (b"127.0.0.1", 0, RLE, 10), (b"127.0.0.1", 1, 2, 10),
+                                   (b"127.0.0.1", 1, RLE, 0), (b"127.0.0.1", 1, RLE, 61)):
+        assert lib.lvml_mirror_start(host, port, codec, fps) == LVML_ERROR_INVALID_PARAM
+    # Stopped: flushes cost nothing and aren't counted
+    stats(lib, reset=True)
+    Screen(lib).full()
+    assert stats(lib).flushes == 0
+
+
+def check_codec(lib, codec, name):
+    viewer = Viewer()
+    screen = Screen(lib)
+    start(lib, viewer, codec, fps=30)
+    screen.full("gradient")
+    begin = time.time()
+    ui_frames(screen, 120, random.Random(1))
+    elapsed = time.time() - begin
+    wait_for(lambda: viewer.matches(screen))
+    s = stats(lib)
+    assert viewer.sizes == [(WIDTH, HEIGHT)] and viewer.hellos[0] == b"LVM\x01" + bytes([codec])
+    assert s.frames <= elapsed * 30 + 3, (s.frames, elapsed)
+    assert s.merged > 0 and s.display_frames == 121, (s.merged, s.display_frames)
+    assert sum(f[1] for f in viewer.frames) == s.display_frames
+    assert viewer.bytes == s.bytes and s.rects == sum(f[2] for f in viewer.frames), (viewer.bytes, s.bytes)
+    print("  %s: %d refreshes sent as %d frames, %.0f bytes/frame, %.1fx smaller than raw, "
+          "encode %.2f ms/frame, flush max %d us" %
+          (name, s.display_frames, s.frames, s.bytes / s.frames, s.pixels * 2 / s.bytes,
+           s.encode_us / s.frames / 1000, s.flush_max_us))
+    stop(lib, viewer)
+
+
+def test_rle(lib):
+    check_codec(lib, RLE, "rle")
+
+
+def test_qoi(lib):
+    check_codec(lib, QOI, "qoi")
+
+
+def test_slow_viewer(lib):
+    # The viewer stops reading; the display keeps redrawing the whole screen
+    viewer = Viewer()
+    screen = Screen(lib)
+    start(lib, viewer, RLE, fps=60)
+    screen.full()
+    wait_for(lambda: viewer.matches(screen))
+    viewer.reading.clear()
+    begin = time.time()
+    i = 0
+    while time.time() - begin < 1.5:
+        screen.full("noise", i)
+        i += 1
+        time.sleep(1 / 60)
+    s = stats(lib)
+    # Frames stopped going out, the flush path didn't notice
+    assert s.frames < i / 4 and s.flush_max_us < 5000, (s.frames, i, s.flush_max_us)
+    viewer.reading.set()
+    wait_for(lambda: viewer.matches(screen))
+    s = stats(lib)
+    assert s.connects == 1 and s.merged > i / 2, (s.connects, s.merged, i)
+    print("  slow viewer: %d refreshes while stalled, %d frames sent, %d merged, flush max %d us "
+          "(%.2f ms with ctypes)" % (i, s.frames, s.merged, s.flush_max_us, screen.flush_max_s * 1000))
+    stop(lib, viewer)
+
+
+def test_dirty_list(lib):
+    viewer = Viewer()
+    screen = Screen(lib)
+    start(lib, viewer, RLE, fps=2)
+    screen.full()
+    wait_for(lambda: viewer.matches(screen))
+    # Scattered updates between two frames end up in at most RECTS rectangles
+    rnd = random.Random(2)
+    time.sleep(0.1)
+    count = len(viewer.frames)
+    for i in range(40):
+        screen.refresh(rnd.randrange(WIDTH - 16), rnd.randrange(HEIGHT - 16), 16, 16, "noise", i)
+    wait_for(lambda: viewer.matches(screen))
+    assert all(f[2] <= RECTS for f in viewer.frames[count:])
+    s = stats(lib)
+    assert s.overflows > 0
+    # Adjacent render bands of one area come out as one rectangle
+    count = len(viewer.frames)
+    screen.refresh(0, 0, WIDTH, 100, "fill", 3)
+    wait_for(lambda: viewer.matches(screen))
+    assert viewer.frames[count][2] == 1
+    stop(lib, viewer)
+
+
+def test_resize(lib):
+    viewer = Viewer()
+    screen = Screen(lib)
+    start(lib, viewer, QOI, fps=30)
+    screen.full()
+    wait_for(lambda: viewer.matches(screen))
+    lib.lvml_mirror_resize(HEIGHT, WIDTH)
+    screen = Screen(lib, HEIGHT, WIDTH)
+    screen.full("fill", 4)
+    wait_for(lambda: viewer.matches(screen))
+    assert viewer.sizes == [(WIDTH, HEIGHT), (HEIGHT, WIDTH)]
+    stop(lib, viewer)
+    lib.lvml_mirror_resize(WIDTH, HEIGHT)
+
+
+def test_reconnect(lib):
+    # The first connection drops after a frame; the next one gets the whole screen
+    viewer = Viewer(connections=2)
+    viewer.close_after = 1
+    screen = Screen(lib)
+    start(lib, viewer, RLE, fps=30)
+    screen.full("gradient", 5)
+    wait_for(lambda: len(viewer.hellos) == 2, timeout=5)
+    wait_for(lambda: viewer.matches(screen))
+    assert viewer.sizes == [(WIDTH, HEIGHT)] * 2
+    s = stats(lib)
+    assert s.connects == 2 and s.disconnects == 1
+    stop(lib, viewer)
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_params, test_rle, test_qoi, test_slow_viewer, test_dirty_list, test_resize, test_reconnect):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+            lib.lvml_mirror_stop()
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,321 @@
+# Host test for the network manager (lvml/network/lvml_net.c)
+# Run on the host: python3 test/test_net.py
+#
+# Builds the manager and the HTTP client as a shared library with the host
+# C compiler; the network task runs as a thread on POSIX sockets against a
+# local HTTP/1.1 server started by the test. Checks that bodies stream
+# through lvml_net_read() and through a body callback, that requests to one
+# server share a kept-alive connection (and reconnect when it closes), that
+# queued requests run by priority, cancellation (a body callback isn't
+# called once it returns), error statuses and the per-request timing.
+
+import ctypes
+import os
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCES = [os.path.join(ROOT, "lvml", "network", name) for name in ("lvml_net.c", "lvml_http_client.c")]
+HIGH, NORMAL, LOW = 0, 1, 2
+LVML_OK, LVML_ERROR_NETWORK, LVML_ERROR_INVALID_PARAM = 0, -3, -6
+
+BODY_CB = ctypes.CFUNCTYPE(ctypes.c_bool, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t, ctypes.c_void_p)
+
+
+class Request(ctypes.Structure):
+    _fields_ = [("url", ctypes.c_char_p), ("priority", ctypes.c_int), ("on_body", ctypes.c_void_p),
+                ("user_data", ctypes.c_void_p)]
+
+
+class Timing(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint32) for name in
+                ("queued_us", "dns_us", "connect_us", "first_byte_us", "transfer_us", "total_us")]
+
+
+class Result(ctypes.Structure):
+    _fields_ = [("result", ctypes.c_int), ("status", ctypes.c_int), ("bytes", ctypes.c_uint32),
+                ("reused", ctypes.c_bool), ("timing", Timing)]
+
+
+class Stats(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint32) for name in
+                ("requests", "completed", "failed", "cancelled", "connections", "reused", "bytes",
+                 "queue_max", "wifi_connects", "wifi_disconnects")] + [("last", Timing)]
+
+
+class Buffer(ctypes.Structure):
+    _fields_ = [("data", ctypes.POINTER(ctypes.c_uint8)), ("len", ctypes.c_size_t), ("cap", ctypes.c_size_t),
+                ("limit", ctypes.c_size_t)]
+
+
+def body(size):
+    return bytes((i * 7 + 3) & 0xFF for i in range(size))
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def setup(self):
+        super().setup()
+        self.server.connections += 1
+
+    def log_message(self, fmt, *args):
+        pass
+
+    def do_GET(self):
+        parts = self.path.strip("/").split("/")
+        self.server.paths.append(self.path)
+        if parts[0] == "slow":
+            time.sleep(int(parts[1]) / 1000.0)
+            parts = ["data", "10"]
+        if parts[0] == "data":
+            data = body(int(parts[1]))
+            self.send_response(200)
+            self.send_header("Content-Length", str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+        elif parts[0] == "chunked":
+            data = body(int(parts[1]))
+            self.send_response(200)
+            self.send_header("Transfer-Encoding", "chunked")
+            self.end_headers()
+            for i in range(0, len(data), 700):
+                piece = data[i:i + 700]
+                self.wfile.write(b"%x\r\n%s\r\n" % (len(piece), piece))
+            self.wfile.write(b"0\r\n\r\n")
+        elif parts[0] == "close":
+            data = body(100)
+            self.send_response(200)
+            self.send_header("Content-Length", str(len(data)))
+            self.send_header("Connection", "close")
+            self.end_headers()
+            self.wfile.write(data)
+            self.close_connection = True
+        else:
+            # send_error() would close the connection
+            data = b"not found"
+            self.send_response(404)
+            self.send_header("Content-Length", str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+
+
+class Server(ThreadingHTTPServer):
+    daemon_threads = True
+
+    def handle_error(self, request, client_address):
+        pass    # Cancelled downloads reset their connection
+
+
+def start_server():
+    server = Server(("127.0.0.1", 0), Handler)
+    server.connections = 0
+    server.paths = []
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server, "http://127.0.0.1:%d" % server.server_address[1]
+
+
+def build():
+    lib = host_build.build("lvml_net", SOURCES, libs=["-lpthread"])
+    lib.lvml_net_get.argtypes = [ctypes.POINTER(Request)]
+    lib.lvml_net_get.restype = ctypes.c_uint32
+    lib.lvml_net_read.argtypes = [ctypes.c_uint32, ctypes.c_char_p, ctypes.c_size_t]
+    lib.lvml_net_finish.argtypes = [ctypes.c_uint32, ctypes.POINTER(Result)]
+    lib.lvml_net_finish.restype = ctypes.c_bool
+    lib.lvml_net_cancel.argtypes = [ctypes.c_uint32]
+    lib.lvml_net_get_stats.argtypes = [ctypes.POINTER(Stats)]
+    lib.lvml_net_buffer_free.argtypes = [ctypes.POINTER(Buffer)]
+    lib.lvml_net_wifi_state.restype = ctypes.c_int
+    return lib
+
+
+def get(lib, url, priority=NORMAL, on_body=None, user_data=None):
+    req = Request(url.encode(), priority, ctypes.cast(on_body, ctypes.c_void_p) if on_body else None, user_data)
+    return lib.lvml_net_get(ctypes.byref(req))
+
+
+def finish(lib, rid, timeout=10):
+    r = Result()
+    deadline = time.time() + timeout
+    while not lib.lvml_net_finish(rid, ctypes.byref(r)):
+        assert time.time() < deadline, "request %d didn't finish" % rid
+        time.sleep(0.002)
+    return r
+
+
+def read_all(lib, rid, size=300, timeout=10):
+    buf = ctypes.create_string_buffer(size)
+    data = bytearray()
+    deadline = time.time() + timeout
+    while True:
+        n = lib.lvml_net_read(rid, buf, size)
+        if n < 0:
+            return bytes(data)
+        data += buf.raw[:n]
+        if n == 0:
+            assert time.time() < deadline, "body of %d didn't end" % rid
+            time.sleep(0.002)
+
+
+def stats(lib):
+    s = Stats()
+    lib.lvml_net_get_stats(ctypes.byref(s))
+    return s
+
+
+def test_stream(lib, server, base):
+    for path, size in (("/data/", 100000), ("/chunked/", 5000), ("/data/", 0)):
+        rid = get(lib, base + path + str(size))
+        assert rid != 0
+        assert read_all(lib, rid) == body(size), path
+        r = finish(lib, rid)
+        assert (r.result, r.status, r.bytes) == (LVML_OK, 200, size), (path, r.result, r.status, r.bytes)
+        t = r.timing
+        assert t.total_us >= t.queued_us + t.first_byte_us and t.total_us > 0
+    # Finished requests are released
+    r = Result()
+    assert lib.lvml_net_finish(rid, ctypes.byref(r)) and r.result == LVML_ERROR_INVALID_PARAM
+    assert lib.lvml_net_read(rid, ctypes.create_string_buffer(4), 4) == -2
+
+
+def test_keep_alive(lib, server, base):
+    finish(lib, get(lib, base + "/close"))
+    before = server.connections
+    results = []
+    for path in ("/data/2000", "/chunked/3000", "/data/10", "/data/0"):
+        rid = get(lib, base + path)
+        read_all(lib, rid)
+        results.append(finish(lib, rid))
+    assert server.connections == before + 1, server.connections - before
+    assert [r.reused for r in results] == [False, True, True, True]
+    assert results[0].timing.connect_us > 0 and results[1].timing.connect_us == 0
+    # A server that closes gets a new connection next time
+    finish(lib, get(lib, base + "/close"))
+    rid = get(lib, base + "/data/10")
+    read_all(lib, rid)
+    assert not finish(lib, rid).reused
+    assert server.connections == before + 2
+
+
+def test_priority(lib, server, base):
+    # The slow request holds the task while the others queue up
+    slow = get(lib, base + "/slow/300")
+    time.sleep(0.1)
+    order = [("/data/1", LOW), ("/data/2", NORMAL), ("/data/3", HIGH), ("/data/4", LOW), ("/data/5", HIGH)]
+    del server.paths[:]
+    ids = [get(lib, base + path, priority) for path, priority in order]
+    finish(lib, slow)
+    for rid in ids:
+        read_all(lib, rid)
+        finish(lib, rid)
+    assert server.paths == ["/data/3", "/data/5", "/data/2", "/data/1", "/data/4"], server.paths
+
+
+def test_body_callback(lib, server, base):
+    pieces = []
+
+    @BODY_CB
+    def on_body(data, size, user_data):
+        pieces.append(ctypes.string_at(data, size))
+        return True
+
+    rid = get(lib, base + "/chunked/20000", on_body=on_body)
+    assert lib.lvml_net_read(rid, ctypes.create_string_buffer(4), 4) == -2, "body callback requests aren't streamed"
+    r = finish(lib, rid)
+    assert r.result == LVML_OK and b"".join(pieces) == body(20000) and len(pieces) > 1
+    # lvml_net_buffer_append() collects a body; a limit aborts the request
+    lib_append = ctypes.cast(lib.lvml_net_buffer_append, ctypes.c_void_p)
+    buf = Buffer()
+    r = finish(lib, get(lib, base + "/data/9000", on_body=lib_append, user_data=ctypes.addressof(buf)))
+    assert r.result == LVML_OK and ctypes.string_at(buf.data, buf.len) == body(9000) and buf.data[9000] == 0
+    lib.lvml_net_buffer_free(ctypes.byref(buf))
+    small = Buffer(limit=100)
+    r = finish(lib, get(lib, base + "/data/9000", on_body=lib_append, user_data=ctypes.addressof(small)))
+    assert r.result == LVML_ERROR_NETWORK and small.len == 0
+    lib.lvml_net_buffer_free(ctypes.byref(small))
+
+
+def test_cancel(lib, server, base):
+    before = stats(lib)
+    # Running: the stream fills up because nobody reads it
+    running = get(lib, base + "/data/200000")
+    pending = get(lib, base + "/data/10", LOW)
+    time.sleep(0.2)
+    lib.lvml_net_cancel(pending)
+    lib.lvml_net_cancel(running)
+    r = Result()
+    assert lib.lvml_net_finish(running, ctypes.byref(r)) and r.result == LVML_ERROR_INVALID_PARAM
+    # The task is free again
+    rid = get(lib, base + "/data/10")
+    assert read_all(lib, rid) == body(10) and finish(lib, rid).result == LVML_OK
+    after = stats(lib)
+    assert after.cancelled == before.cancelled + 2
+
+    # A running request with a body callback is released by lvml_net_finish()
+    # once the callback can't be called any more
+    calls = []
+
+    @BODY_CB
+    def on_body(data, size, user_data):
+        time.sleep(0.01)
+        calls.append(size)
+        return True
+
+    rid = get(lib, base + "/chunked/200000", on_body=on_body)
+    deadline = time.time() + 10
+    while not calls:
+        assert time.time() < deadline, "body callback wasn't called"
+        time.sleep(0.002)
+    lib.lvml_net_cancel(rid)
+    r = finish(lib, rid)
+    count = len(calls)
+    time.sleep(0.05)
+    assert len(calls) == count, "body callback after lvml_net_finish()"
+    assert lib.lvml_net_finish(rid, ctypes.byref(r)) and r.result == LVML_ERROR_INVALID_PARAM
+    final = stats(lib)
+    assert (final.cancelled, final.failed) == (after.cancelled + 1, after.failed), "counted as failed"
+
+
+def test_errors(lib, server, base):
+    rid = get(lib, base + "/missing")
+    assert read_all(lib, rid) == b""
+    r = finish(lib, rid)
+    assert (r.result, r.status, r.bytes) == (LVML_OK, 404, 0)
+    # The error page was read, so the connection stays usable
+    rid = get(lib, base + "/data/10")
+    read_all(lib, rid)
+    assert finish(lib, rid).reused
+    # Nothing listens on the port of a closed server
+    closed = ThreadingHTTPServer(("127.0.0.1", 0), Handler)
+    port = closed.server_address[1]
+    closed.server_close()
+    r = finish(lib, get(lib, "http://127.0.0.1:%d/data/1" % port))
+    assert (r.result, r.status) == (LVML_ERROR_NETWORK, 0)
+    assert get(lib, "ftp://127.0.0.1/") == 0
+    assert get(lib, base + "/" + "x" * 600) == 0
+    assert get(lib, base + "/data/1", priority=3) == 0
+    assert lib.lvml_net_wifi_state() == 2   # LVML_NET_WIFI_CONNECTED on the host
+
+
+def main():
+    lib = build()
+    server, base = start_server()
+    failed = 0
+    for test in (test_stream, test_keep_alive, test_priority, test_body_callback, test_cancel, test_errors):
+        try:
+            test(lib, server, base)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    s = stats(lib)
+    print("requests %d, connections %d, reused %d, queue_max %d" % (s.requests, s.connections, s.reused, s.queue_max))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,61 @@
+# Compare navigation latency with and without prefetching
+# On the host:   python3 test/http_cache_server.py --latency 200
+# On the device: set SERVER below, connect WiFi, then: import test_prefetch
+#
+# index.xml links to wifi_settings.xml with href, so showing the index
+# prefetches the settings screen in the background.
+
+import os
+import time
+import lvml
+
+SERVER = "http://192.168.1.100:8000"
+INDEX = SERVER + "/index.xml"
+NEXT = SERVER + "/wifi_settings.xml"
+CACHE_DIR = "/cache/http"
+
+def clear_cache():
+    try:
+        for name in os.listdir(CACHE_DIR):
+            os.remove(CACHE_DIR + "/" + name)
+    except OSError:
+        pass
+
+def wait_prefetch(timeout_ms=5000):
+    start = time.ticks_ms()
+    while True:
+        stats = lvml.fetch_stats()
+        if stats["prefetch_done"] + stats["prefetch_dropped"] >= stats["prefetch_queued"]:
+            return True
+        if time.ticks_diff(time.ticks_ms(), start) > timeout_ms:
+            return False
+        lvml.tick()
+        time.sleep_ms(10)
+
+def navigate(prefetch):
+    clear_cache()
+    lvml.load_from_url(INDEX, revalidate=False, prefetch=prefetch)
+    wait_prefetch()
+    # Give the user a moment to "read" the screen
+    for _ in range(20):
+        lvml.tick()
+        time.sleep_ms(10)
+    lvml.load_from_url(NEXT, revalidate=False, prefetch=prefetch)
+    return lvml.prefetch_stats()["last_us"]
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+
+    cold_us = navigate(False)
+    warm_us = navigate(True)
+    print("navigation without prefetch: %d us" % cold_us)
+    print("navigation with prefetch:    %d us" % warm_us)
+
+    stats = lvml.prefetch_stats()
+    print(stats)
+    print(lvml.fetch_stats())
+    print("hit rate: %d/%d" % (stats["prefetched"], stats["navigations"]))
+    print("PASS" if stats["prefetched"] >= 1 and warm_us < cold_us else "FAIL")
+
+run()
@@ -0,0 +1,168 @@
+# Host test for link prefetching (lvml/network/lvml_prefetch.c)
+# Run on the host: python3 test/test_prefetcher.py
+#
+# Builds the prefetcher with the fetcher, the HTTP client and the XML
+# attribute scanner as a shared library (uzlib stand-in from
+# test/fetch_mock) and runs it against the handler of
+# test/http_cache_server.py with every response delayed. Checks which
+# links are resolved and queued, that a prefetched screen is a hit served
+# without waiting for the server, that a link that wasn't prefetched is a
+# miss that waits, and that cached links aren't queued again.
+
+import ctypes
+import os
+import sys
+import tempfile
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import test_fetch_cache  # noqa: E402
+from test_fetch_cache import Result, EVENT_CB, LVML_OK, write, stats  # noqa: E402
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCES = [os.path.join(ROOT, "lvml", "network", "lvml_prefetch.c"), os.path.join(ROOT, "lvml", "xml", "lvml_xml_scan.c")]
+LATENCY_MS = 200
+MAX_URL_LENGTH = 512        # LVML_MAX_URL_LENGTH
+PREFETCH_TIMEOUT_S = 5
+
+
+class NavStats(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint32) for name in ("navigations", "prefetched", "links", "last_us", "avg_us", "max_us")]
+
+
+def build():
+    test_fetch_cache.SOURCES = test_fetch_cache.SOURCES + SOURCES
+    lib = test_fetch_cache.build()
+    lib.lvml_prefetch_links.argtypes = [ctypes.c_char_p, ctypes.c_char_p, ctypes.c_bool]
+    lib.lvml_prefetch_links.restype = ctypes.c_uint32
+    lib.lvml_prefetch_resolve.argtypes = [ctypes.c_char_p, ctypes.c_char_p, ctypes.c_char_p]
+    lib.lvml_prefetch_resolve.restype = ctypes.c_bool
+    return lib
+
+
+def resolve(lib, base, ref):
+    url = ctypes.create_string_buffer(MAX_URL_LENGTH)
+    return url.value.decode() if lib.lvml_prefetch_resolve(base.encode(), ref.encode(), url) else None
+
+
+def wait_prefetched(lib):
+    """Commit finished prefetches until none is outstanding; returns the URLs reported"""
+    urls = []
+
+    def on_event(event, url, ref, data, length, user_data):
+        urls.append(url.decode())
+        return False    # Keep it in memory for lvml_fetch_get()
+
+    cb = EVENT_CB(on_event)
+    deadline = time.time() + PREFETCH_TIMEOUT_S
+    while True:
+        lib.lvml_fetch_poll(cb, None)
+        s = stats(lib)
+        if s.prefetch_done + s.prefetch_dropped >= s.prefetch_queued:
+            return urls
+        assert time.time() < deadline, "prefetches didn't finish"
+        time.sleep(0.01)
+
+
+def timed_get(lib, url):
+    result = Result()
+    start = time.monotonic()
+    res = lib.lvml_fetch_get(url.encode(), False, ctypes.byref(result))
+    elapsed_ms = (time.monotonic() - start) * 1000
+    data = ctypes.string_at(result.data, result.len) if res == LVML_OK else None
+    lib.lvml_fetch_free(ctypes.byref(result))
+    return res, data, result, elapsed_ms
+
+
+def test_resolve(lib, server, base, root):
+    doc = "http://host:8000/app/index.xml"
+    assert resolve(lib, doc, "next.xml") == "http://host:8000/app/next.xml"
+    assert resolve(lib, doc, "/top.xml") == "http://host:8000/top.xml"
+    assert resolve(lib, doc, "http://other/x.png") == "http://other/x.png"
+    assert resolve(lib, "http://host", "a.xml") == "http://host/a.xml"
+    for ref in ("", "#top", "A:img.png", "https://secure/x.xml"):
+        assert resolve(lib, doc, ref) is None, ref
+    assert resolve(lib, doc, "x" * MAX_URL_LENGTH) is None
+
+
+def test_hit(lib, server, base, root):
+    screen = b"<screen><label text='settings'/></screen>"
+    image = bytes(range(256)) * 4
+    write(root, "settings.xml", screen)
+    write(root, "logo.bin", image)
+    index = ("<screen><button href='settings.xml'/><image src='/logo.bin'/>"
+             "<image src='A:local.png'/><button href='#top'/></screen>")
+    before = stats(lib)
+    assert lib.lvml_prefetch_links(index.encode(), (base + "/index.xml").encode(), True) == 2
+    assert stats(lib).prefetch_queued == before.prefetch_queued + 2
+    assert sorted(wait_prefetched(lib)) == [base + "/logo.bin", base + "/settings.xml"]
+
+    res, data, result, elapsed_ms = timed_get(lib, base + "/settings.xml")
+    assert res == LVML_OK and data == screen
+    assert result.prefetched and result.from_cache
+    assert elapsed_ms < LATENCY_MS / 2, "prefetched screen took %.0f ms" % elapsed_ms
+    res, data, result, elapsed_ms = timed_get(lib, base + "/logo.bin")
+    assert res == LVML_OK and data == image and result.prefetched
+    after = stats(lib)
+    assert after.prefetch_hits == before.prefetch_hits + 2
+    assert after.cache_misses == before.cache_misses
+    print("  prefetched: %.1f ms, server latency %d ms" % (elapsed_ms, LATENCY_MS))
+
+
+def test_miss(lib, server, base, root):
+    write(root, "about.xml", b"<screen><label text='about'/></screen>")
+    write(root, "icon.bin", b"icon")
+    index = "<screen><button href='about.xml'/><image src='icon.bin'/></screen>"
+    before = stats(lib)
+    # Assets only: the linked screen isn't fetched ahead
+    assert lib.lvml_prefetch_links(index.encode(), (base + "/index.xml").encode(), False) == 1
+    assert wait_prefetched(lib) == [base + "/icon.bin"]
+
+    res, data, result, elapsed_ms = timed_get(lib, base + "/about.xml")
+    assert res == LVML_OK and not result.prefetched and not result.from_cache
+    assert elapsed_ms >= LATENCY_MS, "miss took only %.0f ms" % elapsed_ms
+    after = stats(lib)
+    assert after.cache_misses == before.cache_misses + 1
+    assert after.prefetch_hits == before.prefetch_hits
+    print("  miss: %.0f ms" % elapsed_ms)
+
+
+def test_cached_not_queued(lib, server, base, root):
+    # settings.xml and about.xml are on disk by now, claimed or downloaded
+    index = "<screen><button href='settings.xml'/><button href='about.xml'/></screen>"
+    requests = len(server.statuses)
+    assert lib.lvml_prefetch_links(index.encode(), (base + "/index.xml").encode(), True) == 0
+    res, data, result, elapsed_ms = timed_get(lib, base + "/settings.xml")
+    assert res == LVML_OK and result.from_cache and not result.prefetched
+    assert len(server.statuses) == requests
+
+
+def test_navigation_stats(lib, server, base, root):
+    lib.lvml_prefetch_record_navigation(1000, True)
+    lib.lvml_prefetch_record_navigation(201000, False)
+    s = NavStats()
+    lib.lvml_prefetch_get_stats(ctypes.byref(s))
+    assert (s.navigations, s.prefetched, s.last_us, s.avg_us, s.max_us) == (2, 1, 201000, 101000, 201000)
+    assert s.links == 3
+
+
+def main():
+    lib = build()
+    root = tempfile.mkdtemp()
+    os.chdir(tempfile.mkdtemp())
+    server, base = test_fetch_cache.start_server(root)
+    server.latency = LATENCY_MS
+    failed = 0
+    for test in (test_resolve, test_hit, test_miss, test_cached_not_queued, test_navigation_stats):
+        try:
+            test(lib, server, base, root)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    server.shutdown()
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
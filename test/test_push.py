@@ -0,0 +1,520 @@
+# Host test for the push channel (lvml/network/lvml_push.c) and the update
+# format (lvml/utils/lvml_patch.c)
+# Run on the host: python3 test/test_push.py
+#
+# Builds both as a shared library with the host C compiler; the channel
+# task runs as a thread on POSIX sockets against push servers started by
+# the test, and the test plays the main thread, calling lvml_push_poll()
+# once per 16 ms frame with a callback that decodes updates through
+# lvml_patch_next(). Checks every command round-trips and corrupt updates
+# are refused, that updates arrive in order, that a server keeping to the
+# window coalesces instead of queueing, that one ignoring it is held back
+# without losing anything, the time budget, oversized updates, close and
+# reconnect. Prints bytes per update, throughput and apply latency.
+
+import ctypes
+import os
+import select
+import socket
+import struct
+import sys
+import threading
+import time
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCES = [os.path.join(ROOT, "lvml", name) for name in ("network/lvml_push.c", "utils/lvml_patch.c")]
+SLOTS, UPDATE_MAX = 16, 2048
+LVML_OK, LVML_ERROR_INVALID_PARAM = 0, -6
+SET, INSERT, REMOVE, BIND_INT, BIND_STRING = range(5)
+TEXT, X, Y, WIDTH, HEIGHT, VALUE = range(6)
+BG_COLOR = 9
+LABEL, SLIDER = 2, 5
+FRAME_S = 0.016
+
+APPLY_CB = ctypes.CFUNCTYPE(ctypes.c_bool, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t, ctypes.c_void_p)
+
+
+class Stats(ctypes.Structure):
+    _fields_ = [("connected", ctypes.c_bool)] + [(name, ctypes.c_uint32) for name in
+                ("connects", "disconnects", "updates", "errors", "bytes", "acks", "full_waits", "queue_max",
+                 "batches", "batch_max_us", "apply_us", "last_latency_us", "avg_latency_us", "max_latency_us")]
+
+
+class Cmd(ctypes.Structure):
+    _fields_ = [("op", ctypes.c_uint8), ("prop", ctypes.c_uint8), ("type", ctypes.c_uint8),
+                ("target", ctypes.c_void_p), ("target_len", ctypes.c_size_t),
+                ("name", ctypes.c_void_p), ("name_len", ctypes.c_size_t),
+                ("str", ctypes.c_void_p), ("str_len", ctypes.c_size_t),
+                ("value", ctypes.c_int32), ("x", ctypes.c_int32), ("y", ctypes.c_int32),
+                ("width", ctypes.c_int32), ("height", ctypes.c_int32)]
+
+
+class Reader(ctypes.Structure):
+    _fields_ = [("data", ctypes.c_void_p), ("len", ctypes.c_size_t), ("pos", ctypes.c_size_t),
+                ("cmds", ctypes.c_uint32), ("error", ctypes.c_bool)]
+
+
+def build():
+    lib = host_build.build("lvml_push", SOURCES, libs=["-lpthread"])
+    lib.lvml_push_connect.argtypes = [ctypes.c_char_p, ctypes.c_uint16]
+    lib.lvml_push_poll.argtypes = [APPLY_CB, ctypes.c_void_p, ctypes.c_uint32]
+    lib.lvml_push_poll.restype = ctypes.c_uint32
+    lib.lvml_push_get_stats.argtypes = [ctypes.POINTER(Stats), ctypes.c_bool]
+    lib.lvml_patch_open.argtypes = [ctypes.POINTER(Reader), ctypes.c_void_p, ctypes.c_size_t]
+    lib.lvml_patch_next.argtypes = [ctypes.POINTER(Reader), ctypes.POINTER(Cmd)]
+    lib.lvml_patch_next.restype = ctypes.c_bool
+    lib.lvml_patch_copy_name.argtypes = [ctypes.c_char_p, ctypes.c_char_p, ctypes.c_size_t]
+    lib.lvml_patch_copy_name.restype = ctypes.c_bool
+    return lib
+
+
+# Encoding, as a server would do it
+
+def varint(value):
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def signed(value):
+    return varint(((value << 1) ^ (value >> 31)) & 0xFFFFFFFF)
+
+
+def string(s):
+    s = s.encode() if isinstance(s, str) else s
+    return varint(len(s)) + s
+
+
+def set_cmd(target, prop, value):
+    return bytes([SET]) + string(target) + bytes([prop]) + (string(value) if prop == TEXT else signed(value))
+
+
+def insert_cmd(parent, index, kind, name, text, x, y, w, h):
+    return (bytes([INSERT]) + string(parent) + signed(index) + bytes([kind]) + string(name) + string(text) +
+            signed(x) + signed(y) + signed(w) + signed(h))
+
+
+def remove_cmd(target):
+    return bytes([REMOVE]) + string(target)
+
+
+def bind_int(subject, value):
+    return bytes([BIND_INT]) + string(subject) + signed(value)
+
+
+def bind_str(subject, value):
+    return bytes([BIND_STRING]) + string(subject) + string(value)
+
+
+def frame(update):
+    return varint(len(update)) + update
+
+
+def decode(lib, data):
+    # Commands as tuples, and whether the update was corrupt
+    buf = ctypes.create_string_buffer(bytes(data), len(data))
+    r = Reader()
+    lib.lvml_patch_open(ctypes.byref(r), buf, len(data))
+    cmds = []
+    c = Cmd()
+    while lib.lvml_patch_next(ctypes.byref(r), ctypes.byref(c)):
+        target = ctypes.string_at(c.target, c.target_len).decode() if c.target_len else ""
+        s = ctypes.string_at(c.str, c.str_len).decode() if c.str_len else ""
+        if c.op == SET:
+            cmds.append((SET, target, c.prop, s if c.prop == TEXT else c.value))
+        elif c.op == INSERT:
+            name = ctypes.string_at(c.name, c.name_len).decode() if c.name_len else ""
+            cmds.append((INSERT, target, c.value, c.type, name, s, c.x, c.y, c.width, c.height))
+        elif c.op == REMOVE:
+            cmds.append((REMOVE, target))
+        else:
+            cmds.append((c.op, target, s if c.op == BIND_STRING else c.value))
+    assert r.cmds == len(cmds)
+    return cmds, r.error
+
+
+# Servers
+
+class Server:
+    # Accepts up to `connections` connections, one at a time, and runs
+    # scenario(server, conn) on each
+
+    def __init__(self, scenario, connections=1):
+        self.sock = socket.socket()
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.sock.bind(("127.0.0.1", 0))
+        self.sock.listen(4)
+        self.port = self.sock.getsockname()[1]
+        self.scenario = scenario
+        self.connections = connections
+        self.hellos = []
+        self.acked = 0
+        self.ack_times = []
+        self.done = threading.Event()
+        threading.Thread(target=self.run, daemon=True).start()
+
+    def run(self):
+        for _ in range(self.connections):
+            try:
+                conn, _ = self.sock.accept()
+            except OSError:
+                return
+            conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            self.hellos.append(self.read_hello(conn))
+            self.rx = b""
+            try:
+                self.scenario(self, conn)
+            except OSError:
+                pass
+            conn.close()
+            self.done.set()
+
+    def read_hello(self, conn):
+        data = b""
+        while len(data) < 7:
+            data += conn.recv(7 - len(data))
+        return data
+
+    def read_acks(self, conn, timeout=0.0):
+        # Credits the device returned; returns how many arrived
+        ready, _, _ = select.select([conn], [], [], timeout)
+        if not ready:
+            return 0
+        chunk = conn.recv(256)
+        if not chunk:
+            raise OSError("closed")
+        self.rx += chunk
+        total = 0
+        while self.rx:
+            value, shift, i = 0, 0, 0
+            while i < len(self.rx):
+                b = self.rx[i]
+                value |= (b & 0x7F) << shift
+                shift += 7
+                i += 1
+                if not b & 0x80:
+                    break
+            else:
+                break
+            self.rx = self.rx[i:]
+            total += value
+        self.acked += total
+        now = time.time()
+        self.ack_times.extend([now] * total)
+        return total
+
+    def close(self):
+        self.sock.close()
+
+
+class Device:
+    # The main thread: applies updates once per frame
+
+    def __init__(self, lib, slow_s=0.0):
+        self.lib = lib
+        self.updates = []
+        self.refuse = False
+        self.slow_s = slow_s
+        self.cb = APPLY_CB(self.apply)
+
+    def apply(self, data, size, user_data):
+        raw = ctypes.string_at(data, size)
+        cmds, error = decode(self.lib, raw)
+        self.updates.append(cmds)
+        if self.slow_s:
+            time.sleep(self.slow_s)
+        return not error and not self.refuse
+
+    def frame(self, budget_us=8000):
+        return self.lib.lvml_push_poll(self.cb, None, budget_us)
+
+    def run_until(self, cond, timeout=10):
+        deadline = time.time() + timeout
+        while not cond():
+            assert time.time() < deadline, "timed out"
+            self.frame()
+            time.sleep(FRAME_S)
+
+
+def stats(lib, reset=False):
+    s = Stats()
+    lib.lvml_push_get_stats(ctypes.byref(s), reset)
+    return s
+
+
+def wait_for(cond, timeout=10):
+    deadline = time.time() + timeout
+    while not cond():
+        assert time.time() < deadline, "timed out"
+        time.sleep(0.005)
+
+
+def connect(lib, server):
+    assert lib.lvml_push_connect(b"127.0.0.1", server.port) == LVML_OK
+    wait_for(lambda: len(server.hellos) > 0 and stats(lib).connected)
+
+
+# Tests
+
+def test_format(lib):
+    cmds = [
+        (SET, "title", TEXT, "Temperature °C"),
+        (SET, "", X, -12),
+        (SET, "gauge", VALUE, 2 ** 31 - 1),
+        (SET, "gauge", BG_COLOR, 0xFF8000),
+        (INSERT, "list", -1, SLIDER, "s1", "", 10, -20, 100, -1),
+        (REMOVE, "old"),
+        (BIND_INT, "temp", -40),
+        (BIND_STRING, "status", "ok"),
+    ]
+    encoded = [set_cmd(*c[1:]) for c in cmds[:4]] + [insert_cmd(*cmds[4][1:]), remove_cmd("old"),
+                                                     bind_int("temp", -40), bind_str("status", "ok")]
+    data = b"".join(encoded)
+    assert decode(lib, data) == (cmds, False)
+    assert len(set_cmd("temp", VALUE, 215)) == 9      # A value change is a handful of bytes
+
+    # Every truncation stops cleanly and is reported
+    for n in range(1, len(data)):
+        got, error = decode(lib, data[:n])
+        boundary = n in [sum(len(e) for e in encoded[:i]) for i in range(1, len(encoded))]
+        assert error != boundary and got == cmds[:len(got)], n
+    for bad in (bytes([9]) + string("x"),                  # unknown op
+                set_cmd("x", 15, 1),                        # unknown property
+                bytes([INSERT]) + string("") + signed(0) + bytes([11]),   # unknown widget type
+                remove_cmd(""), bind_int("", 1),            # root and nameless subjects
+                bytes([SET]) + varint(1 << 40),             # varint too long
+                bytes([BIND_STRING]) + varint(1 << 32 | 1) + b"x" + string("ok")):   # length over 32 bits
+        assert decode(lib, bad)[1], bad
+
+    name = ctypes.create_string_buffer(32)
+    assert lib.lvml_patch_copy_name(name, b"x" * 31, 31) and name.value == b"x" * 31
+    assert not lib.lvml_patch_copy_name(name, b"x" * 32, 32)
+    assert not lib.lvml_patch_copy_name(name, b"a\0b", 3)
+
+
+def test_order(lib):
+    count = 300
+    sent = []
+
+    def scenario(server, conn):
+        for i in range(count):
+            while len(sent) - server.acked >= SLOTS:
+                server.read_acks(conn, 0.05)
+            update = set_cmd("n", VALUE, i) + bind_str("label", "#%d" % i)
+            conn.sendall(frame(update))
+            sent.append(time.time())
+            server.read_acks(conn)
+        while server.acked < count:
+            server.read_acks(conn, 0.05)
+        time.sleep(0.2)
+
+    server = Server(scenario)
+    stats(lib, reset=True)
+    connect(lib, server)
+    hello = server.hellos[0]
+    assert hello[:4] == b"LVP\x01" and hello[4:] == varint(SLOTS) + varint(UPDATE_MAX), hello
+
+    device = Device(lib)
+    device.run_until(lambda: len(device.updates) == count)
+    assert [u[0][3] for u in device.updates] == list(range(count))
+    assert device.updates[-1][1] == (BIND_STRING, "label", "#%d" % (count - 1))
+    wait_for(server.done.is_set)
+    s = stats(lib)
+    assert s.updates == count and s.errors == 0 and s.queue_max <= SLOTS and s.full_waits == 0
+    assert s.avg_latency_us > 0 and s.max_latency_us >= s.avg_latency_us
+    rtt = sorted(a - b for a, b in zip(server.ack_times, sent))
+    print("  order: %d updates, %.1f bytes/update, apply latency avg %.1f ms max %.1f ms, "
+          "ack round trip median %.1f ms" % (count, s.bytes / count, s.avg_latency_us / 1000,
+                                              s.max_latency_us / 1000, rtt[len(rtt) // 2] * 1000))
+    lib.lvml_push_close()
+    server.close()
+
+
+def test_coalescing(lib):
+    # The producer changes a value every 0.1 ms; the server sends only the
+    # latest one whenever the window has room
+    changes = 20000
+    window_max = [0]
+
+    def scenario(server, conn):
+        sent = 0
+        pending = None
+        for i in range(changes):
+            pending = i
+            if i % 20 == 0:
+                time.sleep(0.002)
+            server.read_acks(conn)
+            if sent - server.acked < SLOTS:
+                conn.sendall(frame(bind_int("temp", pending) + set_cmd("t", TEXT, str(pending))))
+                sent += 1
+                pending = None
+            window_max[0] = max(window_max[0], sent - server.acked)
+        while pending is not None:
+            server.read_acks(conn, 0.05)
+            if sent - server.acked < SLOTS:
+                conn.sendall(frame(bind_int("temp", pending) + set_cmd("t", TEXT, str(pending))))
+                sent += 1
+                pending = None
+        server.sent = sent
+        while server.acked < sent:
+            server.read_acks(conn, 0.05)
+        time.sleep(0.2)
+
+    server = Server(scenario)
+    stats(lib, reset=True)
+    connect(lib, server)
+    device = Device(lib)
+    start = time.time()
+    device.run_until(lambda: device.updates and device.updates[-1][0] == (BIND_INT, "temp", changes - 1))
+    elapsed = time.time() - start
+    wait_for(server.done.is_set)
+    s = stats(lib)
+    assert window_max[0] <= SLOTS and s.full_waits == 0 and s.queue_max <= SLOTS, (window_max[0], s.full_waits, s.queue_max)
+    assert s.updates == server.sent < changes, (s.updates, server.sent, s.errors)
+    values = [u[0][2] for u in device.updates]
+    assert values == sorted(values)
+    print("  coalescing: %d changes in %.2f s sent as %d updates (%.0f/s), %d batches, "
+          "latency avg %.1f ms max %.1f ms" % (changes, elapsed, s.updates, s.updates / elapsed, s.batches,
+                                                s.avg_latency_us / 1000, s.max_latency_us / 1000))
+    lib.lvml_push_close()
+    server.close()
+
+
+def test_flood(lib):
+    # A server ignoring the window is held back by TCP; nothing is lost
+    count = 2000
+
+    def scenario(server, conn):
+        for i in range(count):
+            conn.sendall(frame(bind_int("n", i) + bind_str("pad", "x" * 40)))
+        while server.acked < count:
+            server.read_acks(conn, 0.05)
+        time.sleep(0.2)
+
+    server = Server(scenario)
+    stats(lib, reset=True)
+    connect(lib, server)
+    device = Device(lib)
+    time.sleep(0.3)                  # Let the ring fill up before the first frame
+    device.run_until(lambda: len(device.updates) == count, timeout=30)
+    assert [u[0][2] for u in device.updates] == list(range(count))
+    wait_for(server.done.is_set)
+    s = stats(lib)
+    assert s.full_waits > 0 and s.queue_max == SLOTS and s.updates == count
+    assert s.bytes == sum(len(frame(bind_int("n", i) + bind_str("pad", "x" * 40))) for i in range(count))
+
+    # Applying as fast as possible, without frames
+    stats(lib, reset=True)
+    server2 = Server(scenario)
+    connect(lib, server2)
+    device = Device(lib)
+    start = time.time()
+    while len(device.updates) < count:
+        device.frame(1000000)
+    elapsed = time.time() - start
+    s = stats(lib)
+    print("  flood: %d updates of %d bytes at %.0f updates/s, %.0f KB/s, queue_max %d, full_waits %d" %
+          (count, s.bytes // count, count / elapsed, s.bytes / elapsed / 1024, s.queue_max, s.full_waits))
+    wait_for(server2.done.is_set)
+    lib.lvml_push_close()
+    server.close()
+    server2.close()
+
+
+def test_budget(lib):
+    count = 40
+
+    def scenario(server, conn):
+        for i in range(count):
+            conn.sendall(frame(bind_int("n", i)))
+        while server.acked < count:
+            server.read_acks(conn, 0.05)
+
+    server = Server(scenario)
+    stats(lib, reset=True)
+    connect(lib, server)
+    device = Device(lib, slow_s=0.003)
+    wait_for(lambda: stats(lib).queue_max == SLOTS)
+    # A frame stops once the budget is spent, but always applies one
+    assert 1 <= device.frame(8000) <= 4
+    assert device.frame(0) == 1
+    device.slow_s = 0
+    device.run_until(lambda: len(device.updates) == count)
+    assert stats(lib).batch_max_us >= 6000
+    wait_for(server.done.is_set)
+    lib.lvml_push_close()
+    server.close()
+
+
+def test_errors(lib):
+    def scenario(server, conn):
+        conn.sendall(frame(bind_int("a", 1)))
+        conn.sendall(varint(0))                                     # keep-alive
+        conn.sendall(frame(b"\x00" * (UPDATE_MAX + 100)))           # too large: skipped
+        conn.sendall(frame(bytes([SET]) + string("x")))             # corrupt
+        conn.sendall(frame(bind_int("a", 2)))
+        while server.acked < 4:
+            server.read_acks(conn, 0.05)
+
+    server = Server(scenario)
+    stats(lib, reset=True)
+    connect(lib, server)
+    device = Device(lib)
+    device.run_until(lambda: len(device.updates) == 3)
+    wait_for(server.done.is_set)
+    assert [u for u in device.updates] == [[(BIND_INT, "a", 1)], [], [(BIND_INT, "a", 2)]]
+    s = stats(lib)
+    # The skipped update is acknowledged too, so the server's window stays whole
+    assert (s.updates, s.errors, server.acked) == (2, 2, 4), (s.updates, s.errors, server.acked)
+    lib.lvml_push_close()
+    server.close()
+
+
+def test_reconnect(lib):
+    def scenario(server, conn):
+        n = len(server.hellos)
+        conn.sendall(frame(bind_int("session", n)))
+        if n == 1:
+            return                   # drop the first connection right away
+        while server.acked < 2:
+            server.read_acks(conn, 0.05)
+        time.sleep(0.5)
+
+    server = Server(scenario, connections=2)
+    stats(lib, reset=True)
+    connect(lib, server)
+    device = Device(lib)
+    device.run_until(lambda: len(device.updates) == 2, timeout=5)
+    assert [u[0][2] for u in device.updates] == [1, 2]
+    s = stats(lib)
+    assert s.connects == 2 and s.disconnects == 1 and s.connected
+
+    lib.lvml_push_close()
+    wait_for(lambda: not stats(lib).connected, timeout=2)
+    assert stats(lib).disconnects == 2
+    assert lib.lvml_push_connect(b"", 1) == LVML_ERROR_INVALID_PARAM
+    assert lib.lvml_push_connect(b"127.0.0.1", 0) == LVML_ERROR_INVALID_PARAM
+    server.close()
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_format, test_order, test_coalescing, test_flood, test_budget, test_errors, test_reconnect):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+            lib.lvml_push_close()
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,143 @@
+# Host test for the QOI encoder (lvml/utils/lvml_qoi.c)
+# Run on the host: python3 test/test_qoi.py
+#
+# Encodes RGB565 rows with the device's encoder and decodes the result with
+# the decoder of compare_screenshots.py. Checks that every pixel comes back
+# as its RGB565 value expanded to 8 bits, that runs longer than one QOI run
+# op, index hits and all difference ops round-trip, that the output doesn't
+# depend on how the pixels are split into pushes, and that a failing write
+# stops the encoder.
+
+import ctypes
+import os
+import random
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import host_build  # noqa: E402
+from compare_screenshots import decode_qoi  # noqa: E402
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCES = [os.path.join(ROOT, "lvml", "utils", "lvml_qoi.c")]
+ENCODER_SIZE = 1024         # Room for lvml_qoi_encoder_t
+BUF_SIZE = 256              # LVML_QOI_BUF_SIZE
+END_MARKER = b"\x00" * 7 + b"\x01"
+
+WRITE_CB = ctypes.CFUNCTYPE(ctypes.c_bool, ctypes.c_void_p, ctypes.c_size_t, ctypes.c_void_p)
+
+
+def build():
+    lib = host_build.build("lvml_qoi", SOURCES)
+    lib.lvml_qoi_begin.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, WRITE_CB, ctypes.c_void_p]
+    lib.lvml_qoi_begin.restype = ctypes.c_bool
+    lib.lvml_qoi_push_rgb565.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint16), ctypes.c_size_t]
+    lib.lvml_qoi_end.argtypes = [ctypes.c_void_p]
+    lib.lvml_qoi_end.restype = ctypes.c_bool
+    return lib
+
+
+def rgb888(c):
+    r, g, b = (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def encode(lib, width, height, pixels, chunk=None, fail_after=None):
+    """Encode pushing `chunk` pixels at a time (a row by default); returns (ok, bytes, writes)"""
+    out = bytearray()
+    writes = []
+
+    def write(data, size, user_data):
+        if fail_after is not None and len(writes) >= fail_after:
+            return False
+        writes.append(size)
+        out.extend(ctypes.string_at(data, size))
+        return True
+
+    cb = WRITE_CB(write)
+    enc = ctypes.create_string_buffer(ENCODER_SIZE)
+    ok = lib.lvml_qoi_begin(enc, width, height, cb, None)
+    chunk = chunk or width
+    for i in range(0, len(pixels), chunk):
+        part = pixels[i:i + chunk]
+        lib.lvml_qoi_push_rgb565(enc, (ctypes.c_uint16 * len(part))(*part), len(part))
+    ok = lib.lvml_qoi_end(enc) and ok
+    return ok, bytes(out), writes
+
+
+def check_roundtrip(lib, width, height, pixels):
+    ok, data, _ = encode(lib, width, height, pixels)
+    assert ok
+    assert data[:14] == b"qoif" + struct.pack(">II", width, height) + b"\x03\x00"
+    assert data.endswith(END_MARKER)
+    w, h, decoded = decode_qoi(data)
+    assert (w, h) == (width, height)
+    expected = [rgb888(c) for c in pixels]
+    for i, (got, want) in enumerate(zip(decoded, expected)):
+        assert got == want, "pixel %d: %s != %s" % (i, got, want)
+    return data
+
+
+def test_solid(lib):
+    # 320 pixels per row: several full runs of 62 and a short one per row
+    data = check_roundtrip(lib, 320, 4, [0x07E0] * 320 * 4)
+    assert len(data) < 14 + 8 + 30, len(data)
+
+
+def test_gradient(lib):
+    # Neighbours differ a little: diff and luma ops
+    width, height = 64, 32
+    pixels = [((x >> 1) << 11) | ((y + x) & 0x3F) << 5 | ((x + y) >> 2 & 0x1F)
+              for y in range(height) for x in range(width)]
+    check_roundtrip(lib, width, height, pixels)
+
+
+def test_index(lib):
+    # A few colours repeated out of order: index ops
+    palette = [0xF800, 0x07E0, 0x001F, 0xFFFF, 0x0000, 0x8410]
+    rng = random.Random(1)
+    pixels = [rng.choice(palette) for _ in range(40 * 40)]
+    data = check_roundtrip(lib, 40, 40, pixels)
+    ops = data[14:-8]
+    assert any(op >> 6 == 0 for op in ops)
+
+
+def test_random(lib):
+    # Unrelated neighbours: full RGB ops
+    rng = random.Random(2)
+    check_roundtrip(lib, 37, 23, [rng.randrange(0x10000) for _ in range(37 * 23)])
+
+
+def test_chunking(lib):
+    rng = random.Random(3)
+    pixels = [0x1234] * 200 + [rng.randrange(0x10000) for _ in range(300)] + [0xFFFF] * 70 + [0x0000] * 10
+    _, expected, _ = encode(lib, len(pixels), 1, pixels)
+    for chunk in (1, 7, 61, 62, 63, 256):
+        _, data, writes = encode(lib, len(pixels), 1, pixels, chunk)
+        assert data == expected, chunk
+        assert all(size <= BUF_SIZE for size in writes)
+
+
+def test_write_fails(lib):
+    rng = random.Random(4)
+    pixels = [rng.randrange(0x10000) for _ in range(64 * 64)]
+    ok, data, writes = encode(lib, 64, 64, pixels, fail_after=2)
+    assert not ok
+    assert len(writes) == 2 and len(data) == 2 * BUF_SIZE
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_solid, test_gradient, test_index, test_random, test_chunking, test_write_fails):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,36 @@
+# Screenshots: whole screen and an area, as QOI and raw RGB565
+# Run on the device after boot: import test_screenshot
+# Copy the result to the host (mpremote cp :/screenshot.qoi .) and compare with
+#   python3 test/compare_screenshots.py expected.qoi screenshot.qoi
+
+import gc
+import time
+import lvml
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+
+    lvml.set_bg("white")
+    lvml.rect(20, 20, 120, 80, "#FF0000", "#000000", 2)
+    lvml.button(160, 20, 120, 40, "Capture", "#0066CC", "#FFFFFF")
+    lvml.tick()
+
+    gc.collect()
+    free = gc.mem_free()
+    start = time.ticks_us()
+    with open("/screenshot.qoi", "wb") as f:
+        written = lvml.screenshot(f)
+    print("full screen: %d bytes in %d us, heap used %d" %
+          (written, time.ticks_diff(time.ticks_us(), start), free - gc.mem_free()))
+
+    # A raw area is exactly width * height * 2 bytes
+    raw = lvml.screenshot(fmt="rgb565", area=(20, 20, 120, 80))
+    print("area rgb565:", len(raw) == 120 * 80 * 2)
+    # Top-left pixel of the rect is the black border
+    print("border pixel:", hex(raw[0] | raw[1] << 8))
+
+    qoi = lvml.screenshot(area=(160, 20, 120, 40))
+    print("area qoi:", qoi[:4] == b"qoif", len(qoi), "bytes")
+
+run()
@@ -0,0 +1,205 @@
+# Host test for widget tree snapshots (lvml/utils/lvml_snapshot.c)
+# Run on the host: python3 test/test_snapshot.py
+#
+# Builds the snapshot writer and reader as a shared library with the host C
+# compiler. Writes a tree the way the core walks a screen (parents first,
+# shared styles), reads it back and checks every field, that identical
+# styles are stored once, that a full style table degrades to unstyled
+# nodes, and that bad headers and every truncation of a snapshot are
+# refused without reading past the data.
+
+import ctypes
+import os
+import sys
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCES = [os.path.join(ROOT, "lvml", "utils", "lvml_snapshot.c")]
+STYLES_MAX = 64
+SIZE_CONTENT_W = 1 << 3
+FLAG_VALUE = 1 << 6
+BUTTON, LABEL, SLIDER, DROPDOWN = 1, 2, 5, 10
+
+
+class Style(ctypes.Structure):
+    _fields_ = [("set", ctypes.c_uint8), ("bg_color", ctypes.c_uint32), ("border_color", ctypes.c_uint32),
+                ("text_color", ctypes.c_uint32), ("border_width", ctypes.c_int32), ("pad_all", ctypes.c_int32),
+                ("radius", ctypes.c_int32), ("bg_opa", ctypes.c_uint8), ("border_opa", ctypes.c_uint8)]
+
+
+class Node(ctypes.Structure):
+    _fields_ = [("type", ctypes.c_uint8), ("flags", ctypes.c_uint8), ("parent", ctypes.c_uint16),
+                ("x", ctypes.c_int32), ("y", ctypes.c_int32), ("width", ctypes.c_int32), ("height", ctypes.c_int32),
+                ("style", ctypes.c_uint16),
+                ("name", ctypes.c_void_p), ("name_len", ctypes.c_size_t),
+                ("text", ctypes.c_void_p), ("text_len", ctypes.c_size_t),
+                ("extra", ctypes.c_void_p), ("extra_len", ctypes.c_size_t),
+                ("value", ctypes.c_int32), ("min", ctypes.c_int32), ("max", ctypes.c_int32)]
+
+
+class Writer(ctypes.Structure):
+    _fields_ = [("data", ctypes.POINTER(ctypes.c_uint8)), ("len", ctypes.c_size_t), ("cap", ctypes.c_size_t),
+                ("width", ctypes.c_uint16), ("height", ctypes.c_uint16), ("nodes", ctypes.c_uint16),
+                ("styles", ctypes.c_uint16), ("styles_dropped", ctypes.c_uint32), ("failed", ctypes.c_bool),
+                ("style_table", Style * STYLES_MAX)]
+
+
+class Reader(ctypes.Structure):
+    _fields_ = [("data", ctypes.c_void_p), ("len", ctypes.c_size_t), ("pos", ctypes.c_size_t),
+                ("nodes_end", ctypes.c_size_t), ("width", ctypes.c_uint16), ("height", ctypes.c_uint16),
+                ("nodes", ctypes.c_uint16), ("node_index", ctypes.c_uint16), ("screen_style", ctypes.c_uint16),
+                ("styles", ctypes.c_uint16), ("error", ctypes.c_bool), ("style_table", Style * STYLES_MAX)]
+
+
+def build():
+    lib = host_build.build("lvml_snapshot", SOURCES)
+    lib.lvml_snapshot_begin.argtypes = [ctypes.POINTER(Writer), ctypes.c_uint16, ctypes.c_uint16]
+    lib.lvml_snapshot_add_style.argtypes = [ctypes.POINTER(Writer), ctypes.POINTER(Style)]
+    lib.lvml_snapshot_add_style.restype = ctypes.c_uint16
+    lib.lvml_snapshot_add.argtypes = [ctypes.POINTER(Writer), ctypes.POINTER(Node)]
+    lib.lvml_snapshot_add.restype = ctypes.c_uint16
+    lib.lvml_snapshot_end.argtypes = [ctypes.POINTER(Writer), ctypes.c_uint16]
+    lib.lvml_snapshot_free.argtypes = [ctypes.POINTER(Writer)]
+    lib.lvml_snapshot_open.argtypes = [ctypes.POINTER(Reader), ctypes.c_char_p, ctypes.c_size_t]
+    lib.lvml_snapshot_next.argtypes = [ctypes.POINTER(Reader), ctypes.POINTER(Node)]
+    lib.lvml_snapshot_next.restype = ctypes.c_bool
+    lib.lvml_snapshot_get_style.argtypes = [ctypes.POINTER(Reader), ctypes.c_uint16]
+    lib.lvml_snapshot_get_style.restype = ctypes.POINTER(Style)
+    return lib
+
+
+def style(**props):
+    bits = {"bg_color": 0, "bg_opa": 1, "border_color": 2, "border_width": 3, "border_opa": 4,
+            "text_color": 5, "pad_all": 6, "radius": 7}
+    s = Style()
+    for name, value in props.items():
+        s.set |= 1 << bits[name]
+        setattr(s, name, value)
+    return s
+
+
+# (type, flags, parent, x, y, width, height, style key, name, text, extra, (value, min, max))
+TREE = [
+    (0, 0, 0, 0, 0, 320, 240, "panel", b"root", None, None, None),
+    (BUTTON, 0, 1, 10, -4, 100, 40, "button", b"ok", None, None, None),
+    (LABEL, SIZE_CONTENT_W, 2, 0, 0, 0, 20, "text", None, "Grüße".encode(), None, None),
+    (SLIDER, FLAG_VALUE, 1, 10, 60, 200, 10, None, b"volume", None, None, (-5, -20, 20)),
+    (DROPDOWN, FLAG_VALUE | 1, 1, 10, 90, 150, 30, "button", None, None, b"a\nb\nc", (2, 0, 0)),
+    (LABEL, 0, 0, 300000, 5, 10, 10, "text", None, b"x" * 300, None, None),
+]
+STYLES = {
+    "panel": dict(bg_color=0x112233, bg_opa=255, pad_all=0, radius=0),
+    "button": dict(bg_color=0x2196F3, radius=0x7FFF, border_width=2, border_color=0xFFFFFF, border_opa=128),
+    "text": dict(text_color=0xFF0000),
+}
+
+
+def write(lib, tree, styles, screen_style=None):
+    w = Writer()
+    assert lib.lvml_snapshot_begin(ctypes.byref(w), 320, 240) == 0
+    refs = {key: lib.lvml_snapshot_add_style(ctypes.byref(w), style(**props)) for key, props in styles.items()}
+    keep = []
+    for kind, flags, parent, x, y, width, height, key, name, text, extra, value in tree:
+        n = Node(type=kind, flags=flags, parent=parent, x=x, y=y, width=width, height=height,
+                 style=refs.get(key, 0))
+        for field, s in (("name", name), ("text", text), ("extra", extra)):
+            if s is not None:
+                buf = ctypes.create_string_buffer(s)
+                keep.append(buf)
+                setattr(n, field, ctypes.cast(buf, ctypes.c_void_p))
+                setattr(n, field + "_len", len(s))
+        if value is not None:
+            n.value, n.min, n.max = value
+        assert lib.lvml_snapshot_add(ctypes.byref(w), ctypes.byref(n)) != 0
+    assert lib.lvml_snapshot_end(ctypes.byref(w), refs.get(screen_style, 0)) == 0
+    data = ctypes.string_at(w.data, w.len)
+    lib.lvml_snapshot_free(ctypes.byref(w))
+    return data, refs
+
+
+def read(lib, data):
+    r = Reader()
+    buf = ctypes.create_string_buffer(data, len(data))
+    if lib.lvml_snapshot_open(ctypes.byref(r), buf, len(data)) != 0:
+        return None, None
+    nodes = []
+    n = Node()
+    while lib.lvml_snapshot_next(ctypes.byref(r), ctypes.byref(n)):
+        def string(ptr, size):
+            return ctypes.string_at(ptr, size) if ptr else None
+        nodes.append((n.type, n.flags, n.parent, n.x, n.y, n.width, n.height, n.style,
+                      string(n.name, n.name_len), string(n.text, n.text_len), string(n.extra, n.extra_len),
+                      (n.value, n.min, n.max) if n.flags & FLAG_VALUE else None))
+    return r, nodes
+
+
+def test_round_trip(lib):
+    data, refs = write(lib, TREE, STYLES, "panel")
+    r, nodes = read(lib, data)
+    assert not r.error and (r.width, r.height, r.nodes, r.styles) == (320, 240, len(TREE), 3)
+    assert len(nodes) == len(TREE)
+    for got, want in zip(nodes, TREE):
+        want = want[:7] + (refs.get(want[7], 0),) + want[8:]
+        assert got == want, (got, want)
+    for key, props in STYLES.items():
+        s = lib.lvml_snapshot_get_style(ctypes.byref(r), refs[key]).contents
+        assert s.set == style(**props).set
+        for name, value in props.items():
+            assert getattr(s, name) == value, (key, name)
+    assert lib.lvml_snapshot_get_style(ctypes.byref(r), r.screen_style).contents.bg_color == 0x112233
+    assert not lib.lvml_snapshot_get_style(ctypes.byref(r), 0)
+
+
+def test_styles(lib):
+    w = Writer()
+    assert lib.lvml_snapshot_begin(ctypes.byref(w), 320, 240) == 0
+    assert lib.lvml_snapshot_add_style(ctypes.byref(w), style()) == 0
+    a = lib.lvml_snapshot_add_style(ctypes.byref(w), style(bg_color=1, radius=4))
+    # Fields outside the set don't make a style different
+    other = style(bg_color=1, radius=4)
+    other.text_color = 0xABCDEF
+    assert lib.lvml_snapshot_add_style(ctypes.byref(w), other) == a
+    assert lib.lvml_snapshot_add_style(ctypes.byref(w), style(bg_color=1)) != a
+    for i in range(STYLES_MAX - 2):
+        assert lib.lvml_snapshot_add_style(ctypes.byref(w), style(pad_all=i)) == i + 3
+    assert lib.lvml_snapshot_add_style(ctypes.byref(w), style(pad_all=-1)) == 0
+    assert w.styles_dropped == 1
+    # Forward parents and unknown styles are refused
+    assert lib.lvml_snapshot_add(ctypes.byref(w), ctypes.byref(Node(parent=1))) == 0
+    assert w.failed
+    assert lib.lvml_snapshot_end(ctypes.byref(w), 0) != 0
+    lib.lvml_snapshot_free(ctypes.byref(w))
+
+
+def test_invalid(lib):
+    data, _ = write(lib, TREE, STYLES, "panel")
+    r = Reader()
+    assert lib.lvml_snapshot_open(ctypes.byref(r), b"LVSX" + data[4:], len(data)) != 0
+    assert lib.lvml_snapshot_open(ctypes.byref(r), data[:4] + b"\x02" + data[5:], len(data)) != 0
+    # Every truncation either fails to open or stops with an error before the last node
+    for size in range(len(data)):
+        r, nodes = read(lib, data[:size])
+        assert r is None or r.error or len(nodes) < len(TREE), size
+    # A child that points forward is corrupt
+    bad = bytearray(data)
+    bad[22] = 5     # Parent of the first node, after its type and flags
+    r, nodes = read(lib, bytes(bad))
+    assert r.error and nodes == []
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_round_trip, test_styles, test_invalid):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,152 @@
+# Host test for early splashes (scripts/make_splash.py, lvml/utils/lvml_splash.c)
+# Run on the host: python3 test/test_splash.py
+#
+# Converts the boot images with make_splash.py, expands them with the
+# device's reader in DMA-band-sized reads and checks that RLE and raw
+# splashes give the converter's pixels exactly, that runs carry across band
+# boundaries and that bad headers and truncated data are refused. The
+# device's encoder (screenshots saved as splashes) must produce the
+# converter's bytes exactly, however the pixels are split into rows.
+
+import ctypes
+import glob
+import os
+import struct
+import sys
+
+import host_build
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+sys.path.insert(0, os.path.join(ROOT, "scripts"))
+import make_splash  # noqa: E402
+
+SOURCES = [os.path.join(ROOT, "lvml", "utils", "lvml_splash.c")]
+BAND_ROWS = 16              # LCD_SPLASH_ROWS in the LCD driver
+ENCODER_SIZE = 1024         # Room for lvml_splash_encoder_t
+
+WRITE_CB = ctypes.CFUNCTYPE(ctypes.c_bool, ctypes.c_void_p, ctypes.c_size_t, ctypes.c_void_p)
+
+
+class Splash(ctypes.Structure):
+    _fields_ = [("data", ctypes.c_void_p), ("len", ctypes.c_size_t), ("pos", ctypes.c_size_t),
+                ("width", ctypes.c_uint16), ("height", ctypes.c_uint16), ("flags", ctypes.c_uint8),
+                ("left", ctypes.c_uint32), ("run", ctypes.c_uint8), ("run_repeat", ctypes.c_bool),
+                ("run_px", ctypes.c_uint8 * 2)]
+
+
+def build():
+    lib = host_build.build("lvml_splash", SOURCES)
+    lib.lvml_splash_open.argtypes = [ctypes.POINTER(Splash), ctypes.c_char_p, ctypes.c_size_t]
+    lib.lvml_splash_read.argtypes = [ctypes.POINTER(Splash), ctypes.c_void_p, ctypes.c_size_t]
+    lib.lvml_splash_read.restype = ctypes.c_size_t
+    lib.lvml_splash_begin.argtypes = [ctypes.c_void_p, ctypes.c_uint16, ctypes.c_uint16, WRITE_CB, ctypes.c_void_p]
+    lib.lvml_splash_begin.restype = ctypes.c_bool
+    lib.lvml_splash_push_rgb565.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint16), ctypes.c_size_t]
+    lib.lvml_splash_end.argtypes = [ctypes.c_void_p]
+    lib.lvml_splash_end.restype = ctypes.c_bool
+    return lib
+
+
+def expand(lib, data, band_pixels):
+    # Read the way the LCD driver does, one band at a time
+    splash = Splash()
+    buf = ctypes.create_string_buffer(data)     # keeps the bytes alive while reading
+    assert lib.lvml_splash_open(ctypes.byref(splash), buf, len(data)) == 0
+    out = b""
+    band = ctypes.create_string_buffer(band_pixels * 2)
+    while True:
+        n = lib.lvml_splash_read(ctypes.byref(splash), band, band_pixels)
+        if n == 0:
+            break
+        out += band.raw[:n * 2]
+    return splash, out
+
+
+def pixels_of(path):
+    width, height, color, rows = make_splash.read_png(path)
+    pixels = make_splash.to_rgb565(width, color, rows, 0)
+    return width, height, b"".join(struct.pack(">H", p) for p in pixels)
+
+
+def test_images(lib):
+    for path in sorted(glob.glob(os.path.join(ROOT, "boot", "images", "*.png"))):
+        width, height, expected = pixels_of(path)
+        for compress in (True, False):
+            data, w, h, raw_size = make_splash.make_splash(path, compress=compress)
+            assert (w, h) == (width, height)
+            assert len(data) <= raw_size + 12, path
+            splash, out = expand(lib, data, width * BAND_ROWS)
+            assert bool(splash.flags & 1) == (compress and len(data) < raw_size + 12), path
+            assert out == expected, (path, compress)
+            assert splash.left == 0
+
+
+def test_band_boundaries(lib):
+    # Long runs and literals split by odd band sizes
+    pixels = [0x1234] * 300 + list(range(1, 200)) + [0xFFFF] * 7 + [0, 0] + [0xF800] * 129
+    body = make_splash.rle(pixels)
+    data = b"LVSP" + struct.pack("<BBHHH", 1, 1, len(pixels), 1, 0) + body
+    expected = b"".join(struct.pack(">H", p) for p in pixels)
+    for band in (1, 3, 127, 128, 129, 500, len(pixels)):
+        _, out = expand(lib, data, band)
+        assert out == expected, band
+
+
+def encode(lib, width, height, pixels, chunk):
+    out = bytearray()
+
+    def write(data, size, user_data):
+        out.extend(ctypes.string_at(data, size))
+        return True
+
+    cb = WRITE_CB(write)
+    enc = ctypes.create_string_buffer(ENCODER_SIZE)
+    assert lib.lvml_splash_begin(enc, width, height, cb, None)
+    for i in range(0, len(pixels), chunk):
+        part = pixels[i:i + chunk]
+        lib.lvml_splash_push_rgb565(enc, (ctypes.c_uint16 * len(part))(*part), len(part))
+    assert lib.lvml_splash_end(enc)
+    return bytes(out)
+
+
+def test_encoder(lib):
+    pixels = [0x1234] * 300 + list(range(1, 200)) + [0xFFFF] * 7 + [0, 0] + [0xF800] * 129 + [7, 7, 7]
+    for chunk in (1, 2, 129, 320, len(pixels)):
+        data = encode(lib, len(pixels), 1, pixels, chunk)
+        assert data[:12] == b"LVSP" + struct.pack("<BBHHH", 1, 1, len(pixels), 1, 0)
+        assert data[12:] == make_splash.rle(pixels), chunk
+    path = os.path.join(ROOT, "boot", "images", "dict.png")
+    expected, width, height, _ = make_splash.make_splash(path)
+    w, _, color, rows = make_splash.read_png(path)
+    assert encode(lib, width, height, make_splash.to_rgb565(w, color, rows, 0), width) == expected
+
+
+def test_invalid(lib):
+    path = os.path.join(ROOT, "boot", "images", "dict.png")
+    rle, _, _, _ = make_splash.make_splash(path)
+    raw, _, _, _ = make_splash.make_splash(path, compress=False)
+    splash = Splash()
+    assert lib.lvml_splash_open(ctypes.byref(splash), b"LVSX" + rle[4:], len(rle)) != 0
+    assert lib.lvml_splash_open(ctypes.byref(splash), rle[:4] + b"\x02" + rle[5:], len(rle)) != 0
+    assert lib.lvml_splash_open(ctypes.byref(splash), rle[:8], 8) != 0
+    assert lib.lvml_splash_open(ctypes.byref(splash), raw[:-2], len(raw) - 2) != 0
+    # Truncated runs stop short instead of reading past the data
+    _, out = expand(lib, rle[:len(rle) // 2], 320 * BAND_ROWS)
+    assert 0 < len(out) < 320 * 240 * 2
+
+
+def main():
+    lib = build()
+    failed = 0
+    for test in (test_images, test_band_boundaries, test_encoder, test_invalid):
+        try:
+            test(lib)
+            print("PASS %s" % test.__name__)
+        except AssertionError as e:
+            failed += 1
+            print("FAIL %s: %s" % (test.__name__, e))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
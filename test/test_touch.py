@@ -0,0 +1,57 @@
+# Touch sampling: lvml.tick() must not wait on the touch controller
+# Run on the device after boot: import test_touch
+# Leave the screen alone for the first part, then tap and drag when asked.
+
+import time
+import lvml
+
+IDLE_MS = 2000
+TOUCH_MS = 5000
+
+def measure_ticks(duration_ms):
+    worst = 0
+    total = 0
+    count = 0
+    start = time.ticks_ms()
+    while time.ticks_diff(time.ticks_ms(), start) < duration_ms:
+        t0 = time.ticks_us()
+        lvml.tick()
+        elapsed = time.ticks_diff(time.ticks_us(), t0)
+        worst = max(worst, elapsed)
+        total += elapsed
+        count += 1
+        time.sleep_ms(5)
+    return total // count, worst
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+    if not lvml.touch_enabled():
+        print("touch not available")
+        return
+
+    presses = [0]
+    button = lvml.button(60, 80, 200, 80, "tap me", "#0066CC", "#FFFFFF")
+    button.on("pressed", lambda widget, event: presses.__setitem__(0, presses[0] + 1))
+
+    # Polling used to spin up to 20 ms per input read when nothing was touched
+    lvml.touch_stats(True)
+    avg, worst = measure_ticks(IDLE_MS)
+    print("idle tick: avg %d us, max %d us" % (avg, worst))
+    print("idle:", lvml.touch_stats(True))
+
+    print("tap and drag on the button for %d s..." % (TOUCH_MS // 1000))
+    avg, worst = measure_ticks(TOUCH_MS)
+    stats = lvml.touch_stats()
+    print("touch tick: avg %d us, max %d us" % (avg, worst))
+    print("touch:", stats)
+    print("presses seen:", presses[0])
+    print("read callback under 1 ms:", stats["read_max_us"] < 1000)
+    print("samples = delivered + queued:", stats["samples"] >= stats["delivered"])
+    print("frame read at 400 kHz under 1.5 ms:", stats["i2c_avg_us"] < 1500)
+    # One read per frame, plus one queued clear for each new frame
+    print("bus transfers per frame: %.2f" % (stats["bus_transfers"] / max(stats["frames"], 1)))
+
+    button.delete()
+
+run()
@@ -0,0 +1,62 @@
+# 3-point touch calibration
+# Run on the device after boot: import touch_calibrate
+# Tap the center of each cross as it appears.
+
+import time
+import lvml
+
+TARGETS = ((30, 30), (290, 120), (160, 210))
+ARM = 10
+
+def wait_tap():
+    # Wait for a press, keep its last raw point, return on release
+    while not lvml.touch_point()[2]:
+        lvml.tick()
+        time.sleep_ms(10)
+    raw = None
+    while True:
+        x, y, pressed = lvml.touch_point(True)
+        if not pressed:
+            return raw
+        raw = (x, y)
+        lvml.tick()
+        time.sleep_ms(10)
+
+def cross(x, y):
+    return (lvml.rect(x - ARM, y, 2 * ARM + 1, 1, "red", "red", 0),
+            lvml.rect(x, y - ARM, 1, 2 * ARM + 1, "red", "red", 0))
+
+def run():
+    if not lvml.is_initialized():
+        lvml.init()
+    if not lvml.touch_enabled():
+        print("touch not available")
+        return
+
+    lvml.set_bg("white")
+    lvml.touch_calibrate()
+    raws = []
+    for x, y in TARGETS:
+        marks = cross(x, y)
+        raws.append(wait_tap())
+        for mark in marks:
+            mark.delete()
+        print("target", (x, y), "raw", raws[-1])
+
+    lvml.touch_calibrate(TARGETS, raws)
+    print("calibrated; tap anywhere to check, 5 s")
+    lvml.touch_stats(True)
+    start = time.ticks_ms()
+    while time.ticks_diff(time.ticks_ms(), start) < 5000:
+        lvml.tick()
+        x, y, pressed = lvml.touch_point()
+        if pressed:
+            print("touch", x, y)
+        time.sleep_ms(50)
+
+    stats = lvml.touch_stats()
+    frames = max(stats["frames"], 1)
+    print("I2C transactions per frame: %.1f" % (stats["bus_transfers"] / frames))
+    print("transform max cycles:", stats["xform_max_cycles"])
+
+run()